@@ -21,14 +21,34 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //
+#include <algorithm>
 #include <iostream>
+#include <math.h>
+#include <string.h>
+#include <thread>
+#include <vector>
 
 #include "FixedUtil.h"
 #include "Fixed32.h"
 #include "Fixed64.h"
+#include "FixedCheck.h"
+#include "FixedConvert.h"
+#include "FixedFFT.h"
+#include "FixedFile.h"
+#include "FixedFilter.h"
+#include "FixedGemm.h"
+#include "FixedPacked.h"
+#include "FixedParallel.h"
+#include "FixedPhysics.h"
+#include "FixedRayPacket.h"
+#include "FixedReduce.h"
+#include "FixedTier.h"
 
 #include "UnitTest.h"
 
+// In InstrumentTest.cpp, which is the only translation unit compiled with FP_INSTRUMENT
+void TestInstrument();
+
 void Test32()
 {
 	double v = 0.0001f;
@@ -77,6 +97,1283 @@ void Test64()
 	}
 }
 
+static Fixed32::FP_INT NextRandom(uint32_t& seed)
+{
+	seed = seed * 1664525 + 1013904223;
+	return (Fixed32::FP_INT)(seed >> 14) - (1 << 17);
+}
+
+static int CheckGemm(int m, int n, int k)
+{
+	std::vector<Fixed32::FP_INT> a(m * k), b(k * n), c(m * n), cpar(m * n), y(m);
+
+	// Deterministic pseudo-random inputs in [-2, 2[
+	uint32_t seed = 12345;
+	for (size_t i = 0; i < a.size(); i++)
+		a[i] = NextRandom(seed);
+	for (size_t i = 0; i < b.size(); i++)
+		b[i] = NextRandom(seed);
+
+	FixedGemm::Gemm(m, n, k, &a[0], k, &b[0], n, &c[0], n);
+	FixedGemm::GemmParallel(m, n, k, &a[0], k, &b[0], n, &cpar[0], n, FixedGemm::ShiftQ16, 4);
+	FixedGemm::Gemv(m, k, &a[0], k, &b[0], &y[0]);
+
+	// Compare against a straightforward 64-bit accumulating reference
+	int numErrors = 0;
+	for (int i = 0; i < m; i++)
+	{
+		for (int j = 0; j < n; j++)
+		{
+			Fixed32::FP_LONG acc = 0;
+			for (int p = 0; p < k; p++)
+				acc += (Fixed32::FP_LONG)a[i * k + p] * b[p * n + j];
+			Fixed32::FP_INT ref = (Fixed32::FP_INT)((acc + (1 << 15)) >> 16);
+			if (c[i * n + j] != ref || cpar[i * n + j] != ref)
+				numErrors++;
+		}
+
+		Fixed32::FP_LONG acc = 0;
+		for (int p = 0; p < k; p++)
+			acc += (Fixed32::FP_LONG)a[i * k + p] * b[p];
+		if (y[i] != (Fixed32::FP_INT)((acc + (1 << 15)) >> 16))
+			numErrors++;
+	}
+	return numErrors;
+}
+
+void TestGemm()
+{
+	// The second case spans several MB row bands, NC column panels and KC depth blocks.
+	int numErrors = CheckGemm(67, 45, 300);
+	numErrors += CheckGemm(FixedGemm::MB + 37, FixedGemm::NC + 21, FixedGemm::KC + 19);
+
+	std::cout << "Gemm/Gemv: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestFFT()
+{
+	int numErrors = 0;
+	for (int n = 1; n <= 2048; n *= 2)
+	{
+		std::vector<Fixed32::FP_INT> re(n), im(n);
+		std::vector<Fixed64::FP_LONG> re64(n), im64(n);
+		uint32_t seed = 54321;
+		for (int i = 0; i < n; i++)
+		{
+			re[i] = NextRandom(seed) >> 1;
+			im[i] = NextRandom(seed) >> 1;
+			re64[i] = (Fixed64::FP_LONG)re[i] << 16;
+			im64[i] = (Fixed64::FP_LONG)im[i] << 16;
+		}
+		std::vector<Fixed32::FP_INT> origRe = re, origIm = im;
+
+		FixedFFT::Forward(&re[0], &im[0], n);
+		FixedFFT::Forward(&re64[0], &im64[0], n);
+
+		// Compare against a double precision DFT (scaled by 1/n)
+		double maxError = 0.0, maxError64 = 0.0;
+		for (int k = 0; k < n; k++)
+		{
+			double sr = 0.0, si = 0.0;
+			for (int t = 0; t < n; t++)
+			{
+				double angle = -2.0 * 3.14159265358979323846 * (double)((Fixed64::FP_LONG)k * t % n) / n;
+				sr += Fixed32::ToDouble(origRe[t]) * cos(angle) - Fixed32::ToDouble(origIm[t]) * sin(angle);
+				si += Fixed32::ToDouble(origRe[t]) * sin(angle) + Fixed32::ToDouble(origIm[t]) * cos(angle);
+			}
+			sr /= n;
+			si /= n;
+			maxError = std::max(maxError, std::max(fabs(Fixed32::ToDouble(re[k]) - sr), fabs(Fixed32::ToDouble(im[k]) - si)));
+			maxError64 = std::max(maxError64, std::max(fabs(Fixed64::ToDouble(re64[k]) - sr), fabs(Fixed64::ToDouble(im64[k]) - si)));
+		}
+
+		// Round trip
+		FixedFFT::Inverse(&re[0], &im[0], n);
+		double maxRoundTrip = 0.0;
+		for (int i = 0; i < n; i++)
+			maxRoundTrip = std::max(maxRoundTrip, std::max(fabs(Fixed32::ToDouble(re[i] - origRe[i])), fabs(Fixed32::ToDouble(im[i] - origIm[i]))));
+
+		if (maxError > 4.0 / 65536.0 || maxError64 > 1e-8 || maxRoundTrip > n / 65536.0)
+			numErrors++;
+	}
+
+	std::cout << "FFT: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestFilter()
+{
+	const int numTaps = 37, numSamples = 1000, numChannels = 6;
+	int numErrors = 0;
+
+	uint32_t seed = 777;
+	std::vector<Fixed32::FP_INT> coeffs(numTaps), input(numSamples * numChannels);
+	for (int i = 0; i < numTaps; i++)
+		coeffs[i] = NextRandom(seed) << 7; // s2.30 in [-0.25, 0.25[
+	for (size_t i = 0; i < input.size(); i++)
+		input[i] = NextRandom(seed);
+
+	// Reference FIR output
+	std::vector<Fixed32::FP_INT> ref(numSamples);
+	for (int n = 0; n < numSamples; n++)
+	{
+		Fixed32::FP_LONG acc = 0;
+		for (int k = 0; k < numTaps && k <= n; k++)
+			acc += (Fixed32::FP_LONG)coeffs[k] * input[n - k];
+		ref[n] = (Fixed32::FP_INT)((acc + (1 << 29)) >> 30);
+	}
+
+	// FIR, fed in uneven blocks
+	FixedFilter::Fir fir(&coeffs[0], numTaps);
+	std::vector<Fixed32::FP_INT> output(numSamples * 4);
+	for (int pos = 0, block = 1; pos < numSamples; pos += block, block = block * 3 % 301)
+		fir.Process(&input[pos], &output[pos], std::min(block, numSamples - pos));
+	for (int n = 0; n < numSamples; n++)
+		numErrors += (output[n] != ref[n]) ? 1 : 0;
+
+	// Decimator keeps every 3rd output
+	FixedFilter::FirDecimator decimator(&coeffs[0], numTaps, 3);
+	int numDecimated = decimator.Process(&input[0], &output[0], 500);
+	numDecimated += decimator.Process(&input[500], &output[numDecimated], numSamples - 500);
+	numErrors += (numDecimated != (numSamples + 2) / 3) ? 1 : 0;
+	for (int n = 0; n < numDecimated; n++)
+		numErrors += (output[n] != ref[n * 3]) ? 1 : 0;
+
+	// Interpolator equals the FIR applied to the zero-stuffed input
+	std::vector<Fixed32::FP_INT> stuffed(numSamples * 4, 0), stuffedRef(numSamples * 4);
+	for (int n = 0; n < numSamples; n++)
+		stuffed[n * 4] = input[n];
+	FixedFilter::Fir(&coeffs[0], numTaps).Process(&stuffed[0], &stuffedRef[0], numSamples * 4);
+	FixedFilter::FirInterpolator interpolator(&coeffs[0], numTaps, 4);
+	interpolator.Process(&input[0], &output[0], numSamples);
+	for (int n = 0; n < numSamples * 4; n++)
+		numErrors += (output[n] != stuffedRef[n]) ? 1 : 0;
+
+	// Biquad cascade over interleaved channels, compared against a single-channel run per channel
+	FixedFilter::BiquadCoeffs sections[2] = {
+		{ 4210035, 8420070, 4210035, -2050822453, 993921567 },  // lowpass, fc = 0.02 fs
+		{ 1073741824 / 2, 0, -1073741824 / 2, -1073741824, 268435456 },
+	};
+	FixedFilter::BiquadCascade bank(sections, 2, numChannels);
+	std::vector<Fixed32::FP_INT> bankOut(numSamples * numChannels);
+	bank.Process(&input[0], &bankOut[0], 123);
+	bank.Process(&input[123 * numChannels], &bankOut[123 * numChannels], numSamples - 123);
+	for (int ch = 0; ch < numChannels; ch++)
+	{
+		std::vector<Fixed32::FP_INT> channel(numSamples);
+		for (int n = 0; n < numSamples; n++)
+			channel[n] = input[n * numChannels + ch];
+
+		FixedFilter::BiquadCascade single(sections, 2);
+		single.Process(&channel[0], &channel[0], numSamples);
+		for (int n = 0; n < numSamples; n++)
+			numErrors += (bankOut[n * numChannels + ch] != channel[n]) ? 1 : 0;
+	}
+
+	std::cout << "Filters: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+static void RunPhysics(FixedPhysics::World& world, int numThreads)
+{
+	// A 10x10 grid of stacked spheres dropped onto the ground
+	for (int i = 0; i < 200; i++)
+	{
+		Fixed64::FP_LONG x = Fixed64::FromDouble((i % 10) * 1.05 + (i / 100) * 0.3);
+		Fixed64::FP_LONG y = Fixed64::FromDouble(1.0 + (i / 100) * 2.5 + (i % 3) * 0.01);
+		Fixed64::FP_LONG z = Fixed64::FromDouble(((i / 10) % 10) * 1.05);
+		int body = world.AddBody(x, y, z, Fixed64::FromDouble(0.5), Fixed64::One);
+		world.angY[body] = Fixed64::FromDouble(0.1 * (i % 7));
+	}
+	world.numThreads = numThreads;
+
+	Fixed64::FP_LONG dt = Fixed64::FromDouble(1.0 / 60.0);
+	for (int step = 0; step < 240; step++)
+		world.Step(dt, 8);
+}
+
+void TestPhysics()
+{
+	FixedPhysics::World serial, parallel;
+	RunPhysics(serial, 1);
+	RunPhysics(parallel, 4);
+
+	// Results must not depend on the thread count
+	int numErrors = 0;
+	for (int i = 0; i < serial.NumBodies(); i++)
+	{
+		if (serial.posX[i] != parallel.posX[i] || serial.posY[i] != parallel.posY[i] || serial.posZ[i] != parallel.posZ[i] ||
+			serial.velY[i] != parallel.velY[i] || serial.rotW[i] != parallel.rotW[i] || serial.rotY[i] != parallel.rotY[i])
+			numErrors++;
+
+		// Everything should have come to rest in two layers, without sinking through the ground
+		if (Fixed64::ToDouble(serial.posY[i]) < 0.45 || Fixed64::ToDouble(serial.posY[i]) > 1.6)
+			numErrors++;
+	}
+
+	// A copy of a world must step exactly like the original
+	FixedPhysics::World copy = parallel;
+	Fixed64::FP_LONG dt = Fixed64::FromDouble(1.0 / 60.0);
+	parallel.Step(dt, 8);
+	copy.Step(dt, 8);
+	for (int i = 0; i < copy.NumBodies(); i++)
+		numErrors += (copy.posY[i] != parallel.posY[i] || copy.velY[i] != parallel.velY[i]) ? 1 : 0;
+
+	// Free fall without contacts: both integrators give x_n = x_0 + g*dt^2*n*(n+1)/2 and
+	// v_n = g*dt*n from rest. The static body must not move.
+	for (int verlet = 0; verlet < 2; verlet++)
+	{
+		FixedPhysics::World fall;
+		fall.AddBody(0, Fixed64::FromDouble(100.0), 0, Fixed64::FromDouble(0.5), Fixed64::One);
+		fall.AddBody(Fixed64::FromDouble(3.0), Fixed64::FromDouble(100.0), 0, Fixed64::FromDouble(0.5), 0);
+		const int numSteps = 120;
+		for (int step = 0; step < numSteps; step++)
+		{
+			if (verlet)
+				fall.IntegrateVerlet(dt);
+			else
+				fall.IntegrateEuler(dt);
+		}
+
+		double t = Fixed64::ToDouble(dt), g = Fixed64::ToDouble(fall.gravityY);
+		double y = 100.0 + g * t * t * numSteps * (numSteps + 1) / 2.0;
+		numErrors += (fabs(Fixed64::ToDouble(fall.posY[0]) - y) > 1e-5) ? 1 : 0;
+		numErrors += (fabs(Fixed64::ToDouble(fall.velY[0]) - g * t * numSteps) > 1e-4) ? 1 : 0;
+		numErrors += (fall.posX[0] != 0 || fall.velX[0] != 0) ? 1 : 0;
+		numErrors += (fall.posY[1] != Fixed64::FromDouble(100.0) || fall.velY[1] != 0) ? 1 : 0;
+	}
+
+	std::cout << "Physics: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+// Reference conversion of a scaled value for the non-default modes.
+static int64_t ConvertReference(double x, FixedConvert::Rounding rounding, int64_t minValue, int64_t maxValue)
+{
+	if (x != x)
+		return 0;
+	double r = (rounding == FixedConvert::Nearest) ? rint(x) : (rounding == FixedConvert::Floor) ? floor(x) : x;
+	if (r >= -(double)minValue)
+		return maxValue;
+	if (r < (double)minValue)
+		return minValue;
+	return (int64_t)r;
+}
+
+void TestConvert()
+{
+	const int count = 67;   // not a multiple of the SIMD width, to cover the scalar tail
+	uint32_t seed = 2468;
+	int numErrors = 0;
+
+	std::vector<double> d(count);
+	std::vector<float> f(count);
+	std::vector<Fixed32::FP_INT> x32(count);
+	std::vector<Fixed64::FP_LONG> x64(count);
+	std::vector<float> outF(count);
+	std::vector<double> outD(count);
+	for (int iter = 0; iter < 40; iter++)
+	{
+		// Magnitudes from tiny to far outside both formats; some exact halfway cases
+		for (int i = 0; i < count; i++)
+		{
+			double r = NextRandom(seed) / 65536.0;
+			int exponent = (i * 7 + iter) % 44 - 10;
+			d[i] = ((i % 5) == 0) ? (floor(r * 1000.0) + 0.5) / 65536.0 : ldexp(r, exponent);
+			f[i] = (float)d[i];
+		}
+
+		// Default mode: identical to the scalar conversions for all in-range values
+		FixedConvert::FromDoubleArray(&d[0], &x32[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (fabs(d[i]) < 32768.0 && x32[i] != Fixed32::FromDouble(d[i])) ? 1 : 0;
+		FixedConvert::FromFloatArray(&f[0], &x32[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (fabs(f[i]) < 32768.0f && x32[i] != Fixed32::FromFloat(f[i])) ? 1 : 0;
+		FixedConvert::FromDoubleArray(&d[0], &x64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (fabs(d[i]) < 2147483648.0 && x64[i] != Fixed64::FromDouble(d[i])) ? 1 : 0;
+		FixedConvert::FromFloatArray(&f[0], &x64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (fabs(f[i]) < 2147483648.0f && x64[i] != Fixed64::FromFloat(f[i])) ? 1 : 0;
+
+		// Other rounding modes with saturation, including NaN
+		d[iter % count] = NAN;
+		f[iter % count] = NAN;
+		for (int mode = 0; mode < 3; mode++)
+		{
+			FixedConvert::Rounding rounding = (FixedConvert::Rounding)mode;
+			FixedConvert::FromDoubleArray(&d[0], &x32[0], count, rounding, FixedConvert::Saturate);
+			for (int i = 0; i < count; i++)
+				numErrors += (x32[i] != ConvertReference(d[i] * 65536.0, rounding, INT32_MIN, INT32_MAX)) ? 1 : 0;
+			FixedConvert::FromFloatArray(&f[0], &x32[0], count, rounding, FixedConvert::Saturate);
+			for (int i = 0; i < count; i++)
+				numErrors += (x32[i] != ConvertReference(f[i] * 65536.0f, rounding, INT32_MIN, INT32_MAX)) ? 1 : 0;
+			FixedConvert::FromDoubleArray(&d[0], &x64[0], count, rounding, FixedConvert::Saturate);
+			for (int i = 0; i < count; i++)
+				numErrors += (x64[i] != ConvertReference(d[i] * 4294967296.0, rounding, INT64_MIN, INT64_MAX)) ? 1 : 0;
+			FixedConvert::FromFloatArray(&f[0], &x64[0], count, rounding, FixedConvert::Saturate);
+			for (int i = 0; i < count; i++)
+				numErrors += (x64[i] != ConvertReference(f[i] * 4294967296.0f, rounding, INT64_MIN, INT64_MAX)) ? 1 : 0;
+		}
+
+		// Back to floating point, over the full range of both formats
+		for (int i = 0; i < count; i++)
+		{
+			x32[i] = NextRandom(seed) * ((i % 3 == 0) ? 16384 : 1);
+			x64[i] = ((Fixed64::FP_LONG)NextRandom(seed) << (i % 47)) + NextRandom(seed);
+		}
+		x64[0] = Fixed64::MinValue;
+		x64[1] = Fixed64::MaxValue;
+		FixedConvert::ToFloatArray(&x32[0], &outF[0], count);
+		FixedConvert::ToDoubleArray(&x32[0], &outD[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (outF[i] != Fixed32::ToFloat(x32[i]) || outD[i] != Fixed32::ToDouble(x32[i])) ? 1 : 0;
+		FixedConvert::ToFloatArray(&x64[0], &outF[0], count);
+		FixedConvert::ToDoubleArray(&x64[0], &outD[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (outF[i] != Fixed64::ToFloat(x64[i]) || outD[i] != Fixed64::ToDouble(x64[i])) ? 1 : 0;
+	}
+
+	std::cout << "Convert: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+// Reference narrowing: round (or floor) first, then saturate or wrap the result.
+static int16_t NarrowReference(int64_t x, int shift, FixedPacked::Rounding rounding, FixedPacked::Overflow overflow)
+{
+	int64_t r = (x >> shift) + ((rounding == FixedPacked::Round) ? ((x >> (shift - 1)) & 1) : 0);
+	if (overflow == FixedPacked::Saturate)
+		return (int16_t)std::min<int64_t>(std::max<int64_t>(r, INT16_MIN), INT16_MAX);
+	return (int16_t)(uint16_t)(uint64_t)r;
+}
+
+void TestPacked()
+{
+	const int count = 61;   // not a multiple of the SIMD width, to cover the scalar tail
+	uint32_t seed = 777;
+	int numErrors = 0;
+
+	std::vector<Fixed32::FP_INT> x32(count);
+	std::vector<Fixed64::FP_LONG> x64(count);
+	std::vector<int16_t> packed(count);
+	for (int iter = 0; iter < 20; iter++)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			// Mix small values, values around the saturation limits and extremes
+			int kind = (i + iter) % 4;
+			Fixed32::FP_INT r = NextRandom(seed);
+			x32[i] = (kind == 0) ? r / 4 : (kind == 1) ? r * 16384 : (kind == 2) ? r * 128 : ((r & 1) ? INT32_MAX : INT32_MIN) + (r >> 20);
+			x64[i] = (kind == 3) ? ((r & 1) ? INT64_MAX : INT64_MIN) + (r >> 20) : ((Fixed64::FP_LONG)x32[i] << 16) + (r & 0xFFFF);
+		}
+
+		for (int mode = 0; mode < 4; mode++)
+		{
+			FixedPacked::Rounding rounding = (mode & 1) ? FixedPacked::Floor : FixedPacked::Round;
+			FixedPacked::Overflow overflow = (mode & 2) ? FixedPacked::Wrap : FixedPacked::Saturate;
+
+			FixedPacked::Fixed32ToQ15(&x32[0], &packed[0], count, rounding, overflow);
+			for (int i = 0; i < count; i++)
+				numErrors += (packed[i] != NarrowReference(x32[i], 1, rounding, overflow)) ? 1 : 0;
+			FixedPacked::Fixed32ToQ8_8(&x32[0], &packed[0], count, rounding, overflow);
+			for (int i = 0; i < count; i++)
+				numErrors += (packed[i] != NarrowReference(x32[i], 8, rounding, overflow)) ? 1 : 0;
+			FixedPacked::Fixed64ToQ15(&x64[0], &packed[0], count, rounding, overflow);
+			for (int i = 0; i < count; i++)
+				numErrors += (packed[i] != NarrowReference(x64[i], 17, rounding, overflow)) ? 1 : 0;
+			FixedPacked::Fixed64ToQ8_8(&x64[0], &packed[0], count, rounding, overflow);
+			for (int i = 0; i < count; i++)
+				numErrors += (packed[i] != NarrowReference(x64[i], 24, rounding, overflow)) ? 1 : 0;
+		}
+
+		// Widening is exact, and narrowing the result gives back the packed value
+		for (int i = 0; i < count; i++)
+			packed[i] = (int16_t)NextRandom(seed);
+		std::vector<int16_t> back(count);
+		FixedPacked::Q15ToFixed32(&packed[0], &x32[0], count);
+		FixedPacked::Q8_8ToFixed64(&packed[0], &x64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (x32[i] != packed[i] * 2 || x64[i] != (Fixed64::FP_LONG)packed[i] << 24) ? 1 : 0;
+		FixedPacked::Fixed32ToQ15(&x32[0], &back[0], count);
+		numErrors += (back != packed) ? 1 : 0;
+		FixedPacked::Fixed64ToQ8_8(&x64[0], &back[0], count);
+		numErrors += (back != packed) ? 1 : 0;
+		FixedPacked::Q8_8ToFixed32(&packed[0], &x32[0], count);
+		FixedPacked::Q15ToFixed64(&packed[0], &x64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (x32[i] != packed[i] * 256 || x64[i] != (Fixed64::FP_LONG)packed[i] << 17) ? 1 : 0;
+	}
+
+	std::cout << "Packed: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestRayPacket()
+{
+	// Random segments between points in [-4, 4)^3 (s32.32)
+	uint32_t seed = 4321;
+	int numErrors = 0;
+	for (int iter = 0; iter < 200; iter++)
+	{
+		Fixed64::FP_LONG from[3][8], to[3][8];
+		for (int c = 0; c < 3; c++)
+		{
+			for (int i = 0; i < 8; i++)
+			{
+				from[c][i] = (Fixed64::FP_LONG)NextRandom(seed) << 17;
+				to[c][i] = (Fixed64::FP_LONG)NextRandom(seed) << 17;
+			}
+		}
+		FixedRayPacket::RayPacket rays;
+		int active = FixedRayPacket::InitSegments(rays, from[0], from[1], from[2], to[0], to[1], to[2], 7);
+		numErrors += (active != 0x7F) ? 1 : 0;
+
+		// Packet kernels must give exactly the same hits and distances as the per-lane versions
+		FixedRayPacket::RayPacket scalar = rays;
+		for (int prim = 0; prim < 16; prim++)
+		{
+			Fixed64::FP_LONG x = (Fixed64::FP_LONG)NextRandom(seed) << 17;
+			Fixed64::FP_LONG y = (Fixed64::FP_LONG)NextRandom(seed) << 17;
+			Fixed64::FP_LONG z = (Fixed64::FP_LONG)NextRandom(seed) << 17;
+			Fixed64::FP_LONG r = ((Fixed64::FP_LONG)NextRandom(seed) << 15) + Fixed64::One;
+
+			int hits = (prim == 0)
+				? FixedRayPacket::IntersectPlane(rays, active, 0, Fixed64::One, 0, x)
+				: FixedRayPacket::IntersectSphere(rays, active, x, y, z, r);
+			int expected = 0;
+			for (int i = 0; i < 8; i++)
+			{
+				bool hit = ((active >> i) & 1) && ((prim == 0)
+					? FixedRayPacket::IntersectPlane1(scalar, i, 0, Fixed64::One, 0, x)
+					: FixedRayPacket::IntersectSphere1(scalar, i, x, y, z, r));
+				expected |= hit ? (1 << i) : 0;
+				numErrors += (rays.maxDist[i] != scalar.maxDist[i]) ? 1 : 0;
+			}
+			numErrors += (hits != expected) ? 1 : 0;
+		}
+	}
+
+	std::cout << "RayPacket: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestParallel()
+{
+	FixedParallel::ThreadPool pool(4);
+
+	// Every task must run exactly once, also across repeated runs on the same pool
+	int numErrors = 0;
+	for (int numTasks = 0; numTasks < 200; numTasks += 7)
+	{
+		std::vector<int> counts(numTasks, 0);
+		pool.Run(numTasks, [&](int task) { counts[task]++; });
+		for (int i = 0; i < numTasks; i++)
+			numErrors += (counts[i] != 1) ? 1 : 0;
+	}
+
+	// ParallelFor() covers every element exactly once, in chunks of grainSize
+	for (int count = 0; count < 1000; count += 97)
+	{
+		for (int grainSize = 1; grainSize < 300; grainSize += 61)
+		{
+			std::vector<int> counts(count, 0);
+			FixedParallel::ParallelFor(pool, count, grainSize, [&](int begin, int end)
+			{
+				if (begin % grainSize != 0 || (end - begin != grainSize && end != count))
+					counts[begin] += 100;
+				for (int i = begin; i < end; i++)
+					counts[i]++;
+			});
+			for (int i = 0; i < count; i++)
+				numErrors += (counts[i] != 1) ? 1 : 0;
+		}
+	}
+
+	// Batch operations give the same results as serial ones, for any thread count and pinning
+	const int count = 10007;
+	uint32_t seed = 1234;
+	std::vector<Fixed64::FP_LONG> a(count), b(count), serial(count), parallel(count);
+	for (int i = 0; i < count; i++)
+	{
+		a[i] = (Fixed64::FP_LONG)NextRandom(seed) << 16;
+		b[i] = (Fixed64::FP_LONG)NextRandom(seed) << 16;
+	}
+	Fixed64::MulBatch(&a[0], &b[0], &serial[0], count);
+	for (int numThreads = 1; numThreads <= 4; numThreads++)
+	{
+		FixedParallel::ThreadPool pinned(numThreads, FixedParallel::PinThreads);
+		FixedParallel::ParallelBatch(pinned, Fixed64::MulBatch, &a[0], &b[0], &parallel[0], count, 333);
+		numErrors += (parallel != serial) ? 1 : 0;
+	}
+	Fixed64::SqrtBatch(&serial[0], &b[0], count);
+	FixedParallel::ParallelBatch(pool, Fixed64::SqrtBatch, &serial[0], &parallel[0], count);
+	numErrors += (parallel != b) ? 1 : 0;
+
+	std::cout << "Parallel: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+static int64_t Clamp64(int64_t x, int64_t minValue, int64_t maxValue)
+{
+	return (x < minValue) ? minValue : (x > maxValue) ? maxValue : x;
+}
+
+// Signed 64x64 -> 128 bit product (hi:lo), via the unsigned product and sign corrections.
+static void MulWideReference(int64_t a, int64_t b, int64_t& hi, uint64_t& lo)
+{
+	uint64_t ua = (uint64_t)a, ub = (uint64_t)b;
+	uint64_t p0 = (ua & 0xFFFFFFFF) * (ub & 0xFFFFFFFF);
+	uint64_t p1 = (ua >> 32) * (ub & 0xFFFFFFFF);
+	uint64_t p2 = (ua & 0xFFFFFFFF) * (ub >> 32);
+	uint64_t p3 = (ua >> 32) * (ub >> 32);
+	uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+	uint64_t uhi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+	lo = (mid << 32) | (p0 & 0xFFFFFFFF);
+	hi = (int64_t)(uhi - ((a < 0) ? ub : 0) - ((b < 0) ? ua : 0));
+}
+
+static int64_t AddSat64Reference(int64_t a, int64_t b)
+{
+	if (b > 0 && a > INT64_MAX - b) return INT64_MAX;
+	if (b < 0 && a < INT64_MIN - b) return INT64_MIN;
+	return a + b;
+}
+
+static int64_t SubSat64Reference(int64_t a, int64_t b)
+{
+	if (b < 0 && a > INT64_MAX + b) return INT64_MAX;
+	if (b > 0 && a < INT64_MIN + b) return INT64_MIN;
+	return a - b;
+}
+
+static int64_t MulSat64Reference(int64_t a, int64_t b)
+{
+	int64_t hi;
+	uint64_t lo;
+	MulWideReference(a, b, hi, lo);
+	if (hi >= (int64_t)1 << 31) return INT64_MAX;
+	if (hi < -((int64_t)1 << 31)) return INT64_MIN;
+	return (int64_t)(((uint64_t)hi << 32) | (lo >> 32));
+}
+
+void TestSaturate()
+{
+	const int count = 67;   // not a multiple of the SIMD width, to cover the scalar tail
+	uint32_t seed = 4242;
+	int numErrors = 0;
+
+	std::vector<Fixed32::FP_INT> a32(count), b32(count), t32(count), r32(count);
+	std::vector<Fixed64::FP_LONG> a64(count), b64(count), t64(count), r64(count);
+	for (int iter = 0; iter < 50; iter++)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			// Mix small values, large values and values next to MinValue/MaxValue
+			Fixed32::FP_INT r[3];
+			for (int k = 0; k < 3; k++)
+			{
+				Fixed32::FP_INT v = NextRandom(seed);
+				int kind = (i + k + iter) % 4;
+				r[k] = (kind == 0) ? v : (kind == 1) ? v * 16384 : (kind == 2) ? v * 512 : ((v & 1) ? INT32_MAX : INT32_MIN) + (v >> 20);
+			}
+			a32[i] = r[0];
+			b32[i] = r[1];
+			t32[i] = (iter & 1) ? r[2] : r[2] / 4;
+			a64[i] = (int64_t)r[0] << ((i * 7 + iter) % 33);
+			b64[i] = (int64_t)r[1] << ((i * 5 + iter) % 33);
+			t64[i] = (int64_t)t32[i] << 16;
+		}
+
+		Fixed32::AddSatBatch(&a32[0], &b32[0], &r32[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (r32[i] != Clamp64((int64_t)a32[i] + b32[i], INT32_MIN, INT32_MAX)) ? 1 : 0;
+		Fixed32::SubSatBatch(&a32[0], &b32[0], &r32[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (r32[i] != Clamp64((int64_t)a32[i] - b32[i], INT32_MIN, INT32_MAX)) ? 1 : 0;
+		Fixed32::MulSatBatch(&a32[0], &b32[0], &r32[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (r32[i] != Clamp64(((int64_t)a32[i] * b32[i]) >> 16, INT32_MIN, INT32_MAX)) ? 1 : 0;
+		Fixed32::LerpSatBatch(&a32[0], &b32[0], &t32[0], &r32[0], count);
+		for (int i = 0; i < count; i++)
+		{
+			double exact = floor(((double)a32[i] * (65536.0 - t32[i]) + (double)b32[i] * t32[i]) / 65536.0);
+			Fixed32::FP_INT expected = (Fixed32::FP_INT)std::min(std::max(exact, (double)INT32_MIN), (double)INT32_MAX);
+			numErrors += (abs((int64_t)r32[i] - expected) > 1) ? 1 : 0;   // the double reference may be off by one
+			if (fabs(exact) < 2147483647.0 && t32[i] >= 0 && t32[i] <= 65536)
+				numErrors += (r32[i] != Fixed32::Lerp(a32[i], b32[i], t32[i])) ? 1 : 0;
+		}
+
+		Fixed64::AddSatBatch(&a64[0], &b64[0], &r64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (r64[i] != AddSat64Reference(a64[i], b64[i])) ? 1 : 0;
+		Fixed64::SubSatBatch(&a64[0], &b64[0], &r64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (r64[i] != SubSat64Reference(a64[i], b64[i])) ? 1 : 0;
+		Fixed64::MulSatBatch(&a64[0], &b64[0], &r64[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (r64[i] != MulSat64Reference(a64[i], b64[i])) ? 1 : 0;
+		Fixed64::LerpSatBatch(&a64[0], &b64[0], &t64[0], &r64[0], count);
+		for (int i = 0; i < count; i++)
+		{
+			int64_t oneMinusT = SubSat64Reference(Fixed64::One, t64[i]);
+			numErrors += (r64[i] != AddSat64Reference(MulSat64Reference(a64[i], oneMinusT), MulSat64Reference(b64[i], t64[i]))) ? 1 : 0;
+		}
+
+		// Packed 16-bit formats
+		std::vector<int16_t> pa(count), pb(count), pr(count);
+		for (int i = 0; i < count; i++)
+		{
+			pa[i] = (i % 5 == 0) ? INT16_MIN : (int16_t)(a32[i] >> 16);
+			pb[i] = (i % 7 == 0) ? INT16_MIN : (int16_t)(b32[i] >> 16);
+		}
+		FixedPacked::AddSat(&pa[0], &pb[0], &pr[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (pr[i] != Clamp64(pa[i] + pb[i], INT16_MIN, INT16_MAX)) ? 1 : 0;
+		FixedPacked::SubSat(&pa[0], &pb[0], &pr[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (pr[i] != Clamp64(pa[i] - pb[i], INT16_MIN, INT16_MAX)) ? 1 : 0;
+		FixedPacked::MulSatQ15(&pa[0], &pb[0], &pr[0], count);
+		for (int i = 0; i < count; i++)
+			numErrors += (pr[i] != Clamp64((pa[i] * pb[i] + 16384) >> 15, INT16_MIN, INT16_MAX)) ? 1 : 0;
+	}
+
+	std::cout << "Saturate: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestReduce()
+{
+	const int count = 100003;   // several chunks and a partial one
+	uint32_t seed = 31337;
+	int numErrors = 0;
+
+	std::vector<Fixed32::FP_INT> x32(count), y32(count);
+	std::vector<Fixed64::FP_LONG> x64(count), y64(count);
+	for (int i = 0; i < count; i++)
+	{
+		Fixed32::FP_INT r0 = NextRandom(seed), r1 = NextRandom(seed), r2 = NextRandom(seed);
+		x32[i] = r0 * 16384;
+		y32[i] = r1 * 16384;
+		x64[i] = (int64_t)(((uint64_t)(uint32_t)r0 << 32) | (uint32_t)r2);    // full 64-bit range
+		y64[i] = ((int64_t)r1 << 29) + r2;                                      // below 2^47
+	}
+
+	// References accumulate one element at a time into 128 bits
+	FixedReduce::Int128 sum32, sum64, dot32, dot64;
+	for (int i = 0; i < count; i++)
+	{
+		int64_t hi;
+		uint64_t lo;
+		sum32 = FixedReduce::Add(sum32, FixedReduce::Int128(x32[i] < 0 ? -1 : 0, (uint64_t)(int64_t)x32[i]));
+		sum64 = FixedReduce::Add(sum64, FixedReduce::Int128(x64[i] < 0 ? -1 : 0, (uint64_t)x64[i]));
+		int64_t p = (int64_t)x32[i] * y32[i];
+		dot32 = FixedReduce::Add(dot32, FixedReduce::Int128(p < 0 ? -1 : 0, (uint64_t)p));
+		MulWideReference(y64[i], y64[i], hi, lo);
+		dot64 = FixedReduce::Add(dot64, FixedReduce::Int128(hi, lo));
+	}
+
+	numErrors += (FixedReduce::SumExact(&x32[0], count) != sum32) ? 1 : 0;
+	numErrors += (FixedReduce::SumExact(&x64[0], count) != sum64) ? 1 : 0;
+	numErrors += (FixedReduce::DotExact(&x32[0], &y32[0], count) != dot32) ? 1 : 0;
+	numErrors += (FixedReduce::DotExact(&y64[0], &y64[0], count) != dot64) ? 1 : 0;
+
+	// Same results for any thread count
+	for (int numThreads = 1; numThreads <= 4; numThreads++)
+	{
+		FixedParallel::ThreadPool pool(numThreads);
+		numErrors += (FixedReduce::SumExactParallel(pool, &x32[0], count) != sum32) ? 1 : 0;
+		numErrors += (FixedReduce::SumExactParallel(pool, &x64[0], count) != sum64) ? 1 : 0;
+		numErrors += (FixedReduce::DotExactParallel(pool, &x32[0], &y32[0], count) != dot32) ? 1 : 0;
+		numErrors += (FixedReduce::DotExactParallel(pool, &y64[0], &y64[0], count) != dot64) ? 1 : 0;
+		numErrors += (FixedReduce::SumParallel(pool, &x64[0], count) != FixedReduce::Sum(&x64[0], count)) ? 1 : 0;
+		numErrors += (FixedReduce::DotParallel(pool, &y64[0], &y64[0], count) != FixedReduce::Dot(&y64[0], &y64[0], count)) ? 1 : 0;
+	}
+
+	// Rounding and saturation of the final results
+	for (int n = 1; n < 200; n += 13)
+	{
+		double sum = 0.0, dot = 0.0;
+		for (int i = 0; i < n; i++)
+		{
+			sum += Fixed32::ToDouble(x32[i]);
+			dot += Fixed32::ToDouble(x32[i]) * Fixed32::ToDouble(y32[i]);
+		}
+		double sumClamped = std::min(std::max(sum, -32768.0), INT32_MAX / 65536.0);
+		numErrors += (fabs(Fixed32::ToDouble(FixedReduce::Sum(&x32[0], n)) - sumClamped) > 1.0 / 65536.0) ? 1 : 0;
+		numErrors += (fabs(FixedReduce::ToDouble(FixedReduce::DotExact(&x32[0], &y32[0], n), 32) - dot) > 1e-6 * fabs(dot)) ? 1 : 0;
+		int64_t expectedDot = (int64_t)floor(dot * 65536.0);
+		if (expectedDot >= INT32_MIN && expectedDot <= INT32_MAX)
+			numErrors += (abs((int64_t)FixedReduce::Dot(&x32[0], &y32[0], n) - expectedDot) > 1) ? 1 : 0;
+		else
+			numErrors += (FixedReduce::Dot(&x32[0], &y32[0], n) != (expectedDot < 0 ? INT32_MIN : INT32_MAX)) ? 1 : 0;
+	}
+	int64_t big[3] = { INT64_MAX, INT64_MAX, INT64_MIN };
+	numErrors += (FixedReduce::Sum(big, 2) != INT64_MAX || FixedReduce::Sum(big, 3) != INT64_MAX - 1) ? 1 : 0;
+	numErrors += (FixedReduce::Sum(big + 2, 1) != INT64_MIN || FixedReduce::Dot(big, big, 1) != INT64_MAX) ? 1 : 0;
+
+	std::cout << "Reduce: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestFile()
+{
+	const char* path = "FixedFileTest.bin";
+	const int count = 10000;
+	uint32_t seed = 2024;
+	int numErrors = 0;
+
+	std::vector<Fixed64::FP_LONG> values(count);
+	for (int i = 0; i < count; i++)
+		values[i] = ((Fixed64::FP_LONG)NextRandom(seed) << 16) + NextRandom(seed);
+
+	// Stream the values in uneven chunks
+	FixedFile::Writer writer;
+	numErrors += writer.Open(path, FixedFile::Int64, Fixed64::Shift) ? 0 : 1;
+	for (int begin = 0; begin < count; begin += 3001)
+		numErrors += writer.Write(&values[begin], std::min(3001, count - begin)) ? 0 : 1;
+	numErrors += writer.Write((const int32_t*)&values[0], 1) ? 1 : 0;     // wrong element type
+	numErrors += (!writer.Close() && writer.Error() != 0) ? 0 : 1;
+
+	// Rewrite it properly
+	numErrors += writer.Open(path, FixedFile::Int64, Fixed64::Shift, 4096) ? 0 : 1;
+	numErrors += writer.Write(&values[0], count) ? 0 : 1;
+	numErrors += writer.Close() ? 0 : 1;
+
+	{
+		FixedFile::MappedFile file;
+		numErrors += file.Open(path) ? 0 : 1;
+		Fixed64::FP_LONG* data = file.Int64Data();
+		numErrors += (data != 0 && file.Int32Data() == 0 && file.Count() == (uint64_t)count && file.FractionBits() == 32) ? 0 : 1;
+		numErrors += (((uintptr_t)data & 4095) == 0) ? 0 : 1;
+		if (data)
+		{
+			numErrors += (memcmp(data, &values[0], count * sizeof(Fixed64::FP_LONG)) == 0) ? 0 : 1;
+
+			// The mapping can be used as a batch output without modifying the file
+			Fixed64::MulBatch(data, data, data, count);
+			numErrors += (data[1] == Fixed64::Mul(values[1], values[1])) ? 0 : 1;
+		}
+	}
+	{
+		FixedFile::MappedFile file;
+		numErrors += (file.Open(path) && memcmp(file.Int64Data(), &values[0], count * sizeof(Fixed64::FP_LONG)) == 0) ? 0 : 1;
+	}
+
+	// Truncated and invalid files are rejected
+	FILE* f = fopen(path, "rb");
+	if (f)
+	{
+		fseek(f, 0, SEEK_END);
+		long size = ftell(f);
+		fclose(f);
+		std::vector<char> bytes(size - 8);
+		f = fopen(path, "rb");
+		numErrors += (fread(&bytes[0], 1, bytes.size(), f) == bytes.size()) ? 0 : 1;
+		fclose(f);
+		f = fopen(path, "wb");
+		fwrite(&bytes[0], 1, bytes.size(), f);
+		fclose(f);
+	}
+	FixedFile::MappedFile file;
+	numErrors += (!file.Open(path) && file.Error() != 0 && file.Int64Data() == 0) ? 0 : 1;
+	remove(path);
+	numErrors += file.Open(path) ? 1 : 0;
+
+	std::cout << "File: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestCheck()
+{
+	int numErrors = 0;
+	FixedCheck::Reset();
+
+	// Not checked by default
+	FP_CHECKED(Mul, Fixed64::FromInt(1 << 20), Fixed64::FromInt(1 << 20));
+	numErrors += (FixedCheck::NumChecks() == 0) ? 0 : 1;
+
+#ifdef FP_CHECK_DISABLE
+	// Compiled out, so nothing is checked even when sampling is enabled
+	FixedCheck::SetSampleInterval(1);
+	FP_CHECKED(Mul, Fixed64::FromInt(1 << 20), Fixed64::FromInt(1 << 20));
+	numErrors += (FixedCheck::NumChecks() == 0) ? 0 : 1;
+#else
+	// Overflow is reported with the call site and inputs
+	FixedCheck::SetSampleInterval(1);
+	Fixed64::FP_LONG big = Fixed64::FromInt(1 << 20);
+	int overflowLine = __LINE__ + 1;
+	FP_CHECKED(Mul, big, big);
+	std::vector<FixedCheck::Event> events = FixedCheck::GetEvents();
+	numErrors += (events.size() == 1 && events[0].kind == FixedCheck::Overflow && events[0].line == overflowLine) ? 0 : 1;
+	numErrors += (events.size() == 1 && events[0].inputs[0] == big && events[0].inputs[1] == big && events[0].reference == 1099511627776.0) ? 0 : 1;
+
+	// Results within the default tolerance are not reported
+	uint32_t seed = 987;
+	for (int i = 0; i < 1000; i++)
+	{
+		Fixed32::FP_INT a = NextRandom(seed);
+		Fixed32::FP_INT b = NextRandom(seed);
+		FP_CHECKED(Add, a, b);
+		FP_CHECKED(Mul, a, b);
+		FP_CHECKED(Sqrt, Fixed32::Abs(a));
+		FP_CHECKED(Mul, (Fixed64::FP_LONG)a << 16, (Fixed64::FP_LONG)b << 16);
+		FP_CHECKED(Sqrt, (Fixed64::FP_LONG)Fixed32::Abs(a) << 16);
+	}
+	numErrors += (FixedCheck::NumChecks() == 5001 && FixedCheck::GetEvents().size() == 1) ? 0 : 1;
+
+	// Zero tolerance reports the rounding error of Sqrt(2)
+	FixedCheck::SetTolerance(0.0, 0.0);
+	FP_CHECKED(Sqrt, Fixed32::FromInt(2));
+	events = FixedCheck::GetEvents();
+	numErrors += (events.size() == 2 && events[1].kind == FixedCheck::PrecisionLoss && strcmp(events[1].function, "Fixed32::Sqrt") == 0) ? 0 : 1;
+	numErrors += (FixedCheck::NumEvents(FixedCheck::Overflow) == 1 && FixedCheck::NumEvents(FixedCheck::PrecisionLoss) == 1) ? 0 : 1;
+	FixedCheck::SetTolerance(1e-5, 4.0);
+
+	// Sampling checks roughly one in interval calls
+	FixedCheck::Reset();
+	FixedCheck::SetSampleInterval(100);
+	for (int i = 0; i < 100000; i++)
+		FP_CHECKED(Add, i, i);
+	uint64_t numChecks = FixedCheck::NumChecks();
+	numErrors += (numChecks > 800 && numChecks < 1200) ? 0 : 1;
+
+	// The largest interval is clamped rather than overflowing the gap computation
+	FixedCheck::Reset();
+	FixedCheck::SetSampleInterval(0x7FFFFFFF);
+	for (int i = 0; i < 1000; i++)
+		FP_CHECKED(Add, i, i);
+	numErrors += (FixedCheck::NumChecks() <= 1) ? 0 : 1;
+#endif
+
+	FixedCheck::SetSampleInterval(0);
+	FixedCheck::Reset();
+
+	std::cout << "Check: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestTier()
+{
+	int numErrors = 0;
+	FixedTier::Reset();
+
+	// One pass with full precision, then each of the two call sites with Fast and Fastest
+	int numPasses = 0;
+	while (FixedTier::NextPass())
+	{
+		Fixed64::FP_LONG sumSqrt = 0;
+		Fixed64::FP_LONG sumSin = 0;
+		for (int i = 0; i < 100; i++)
+		{
+			Fixed64::FP_LONG x = Fixed64::FromDouble(i * 0.05);
+			Fixed64::FP_LONG s = FP_TIER(Sqrt, x);
+			sumSqrt += s;
+			sumSin += FP_TIER(Sin, x);
+			if (numPasses == 0)
+				numErrors += (s == Fixed64::Sqrt(x)) ? 0 : 1;
+		}
+		FixedTier::Output(sumSqrt, 1.0);
+		FixedTier::Output(sumSin, 1e-9);
+		numPasses++;
+	}
+	numErrors += (numPasses == 5) ? 0 : 1;
+
+	std::vector<FixedTier::SiteReport> report = FixedTier::Report();
+	numErrors += (report.size() == 2) ? 0 : 1;
+	if (report.size() == 2)
+	{
+		const FixedTier::SiteReport& sqrt = report[0];
+		const FixedTier::SiteReport& sin = report[1];
+		numErrors += (strcmp(sqrt.function, "Sqrt") == 0 && strcmp(sin.function, "Sin") == 0) ? 0 : 1;
+		numErrors += (sqrt.calls == 100 && sin.calls == 100) ? 0 : 1;
+
+		// Loose budget allows any tier, the tight one only full precision
+		numErrors += (sqrt.withinBudget[FixedTier::Fast] && sqrt.withinBudget[FixedTier::Fastest]) ? 0 : 1;
+		numErrors += (!sin.withinBudget[FixedTier::Fast] && !sin.withinBudget[FixedTier::Fastest] && sin.recommended == FixedTier::Full) ? 0 : 1;
+		numErrors += (sin.maxLocalError[FixedTier::Full] == 0.0 && sin.maxLocalError[FixedTier::Fastest] > 0.0) ? 0 : 1;
+		numErrors += (sin.maxBudgetUsed[FixedTier::Fastest] > 1.0 && sqrt.maxBudgetUsed[FixedTier::Fastest] <= 1.0) ? 0 : 1;
+		numErrors += (sqrt.nsPerCall[FixedTier::Full] > 0.0 && sqrt.savedNsPerPass >= 0.0) ? 0 : 1;
+	}
+
+	FILE* csv = tmpfile();
+	if (csv)
+	{
+		numErrors += FixedTier::WriteCsv(csv, report) ? 0 : 1;
+		fclose(csv);
+	}
+
+	std::cout << "Tier: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+struct EstrinPair
+{
+	Fixed32::FP_INT (*horner)(Fixed32::FP_INT);
+	Fixed32::FP_INT (*estrin)(Fixed32::FP_INT);
+	bool oneInclusive;  // domain includes 1.0
+};
+
+void TestEstrin()
+{
+	int numErrors = 0;
+	static const EstrinPair pairs[] =
+	{
+		{ FixedUtil::Exp2Poly4, FixedUtil::Exp2Poly4Estrin, false },
+		{ FixedUtil::Exp2Poly5, FixedUtil::Exp2Poly5Estrin, false },
+		{ FixedUtil::RcpPoly4, FixedUtil::RcpPoly4Estrin, false },
+		{ FixedUtil::RcpPoly6, FixedUtil::RcpPoly6Estrin, false },
+		{ FixedUtil::RcpPoly4Lut8, FixedUtil::RcpPoly4Lut8Estrin, false },
+		{ FixedUtil::SqrtPoly4, FixedUtil::SqrtPoly4Estrin, false },
+		{ FixedUtil::RSqrtPoly5, FixedUtil::RSqrtPoly5Estrin, false },
+		{ FixedUtil::LogPoly5, FixedUtil::LogPoly5Estrin, false },
+		{ FixedUtil::LogPoly5Lut8, FixedUtil::LogPoly5Lut8Estrin, false },
+		{ FixedUtil::Log2Poly5, FixedUtil::Log2Poly5Estrin, false },
+		{ FixedUtil::Log2Poly4Lut16, FixedUtil::Log2Poly4Lut16Estrin, false },
+		{ FixedUtil::SinPoly4, FixedUtil::SinPoly4Estrin, true },
+		{ FixedUtil::AtanPoly4, FixedUtil::AtanPoly4Estrin, true },
+		{ FixedUtil::AtanPoly5Lut8, FixedUtil::AtanPoly5Lut8Estrin, true },
+	};
+
+	// Same polynomials, so the results may only differ by the rounding of the evaluation
+	for (size_t p = 0; p < sizeof(pairs) / sizeof(pairs[0]); p++)
+	{
+		Fixed32::FP_INT end = pairs[p].oneInclusive ? (1 << 30) : (1 << 30) - 1;
+		int maxDiff = 0;
+		for (Fixed32::FP_INT a = 0; ; a += 997)
+		{
+			a = (a > end) ? end : a;
+			int diff = abs(pairs[p].estrin(a) - pairs[p].horner(a));
+			maxDiff = (diff > maxDiff) ? diff : maxDiff;
+			if (a == end)
+				break;
+		}
+		numErrors += (maxDiff <= 4) ? 0 : 1;
+		numErrors += (pairs[p].estrin(0) == pairs[p].horner(0)) ? 0 : 1;
+	}
+
+	std::cout << "Estrin: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestUltra()
+{
+	int numErrors = 0;
+	const int count = 4096;
+	std::vector<Fixed32::FP_INT> x32(count), out32(count);
+	std::vector<Fixed64::FP_LONG> x64(count), out64(count);
+
+	// Angles over several periods
+	double maxSin = 0.0, maxCos = 0.0;
+	for (int i = 0; i < count; i++)
+	{
+		double x = (i - count / 2) * 0.01;
+		x32[i] = Fixed32::FromDouble(x);
+		x64[i] = Fixed64::FromDouble(x);
+		maxSin = fmax(maxSin, fabs(Fixed64::ToDouble(Fixed64::SinUltra(x64[i])) - sin(Fixed64::ToDouble(x64[i]))));
+		maxCos = fmax(maxCos, fabs(Fixed64::ToDouble(Fixed64::CosUltra(x64[i])) - cos(Fixed64::ToDouble(x64[i]))));
+		maxSin = fmax(maxSin, fabs(Fixed32::ToDouble(Fixed32::SinUltra(x32[i])) - sin(Fixed32::ToDouble(x32[i]))));
+	}
+	numErrors += (maxSin < 1.0 / 8192 && maxCos < 1.0 / 8192) ? 0 : 1;
+
+	Fixed32::SinUltraBatch(&x32[0], &out32[0], count);
+	Fixed64::CosUltraBatch(&x64[0], &out64[0], count);
+	for (int i = 0; i < count; i++)
+	{
+		numErrors += (out32[i] == Fixed32::SinUltra(x32[i])) ? 0 : 1;
+		numErrors += (out64[i] == Fixed64::CosUltra(x64[i])) ? 0 : 1;
+	}
+
+	// Absolute error of Log2
+	double maxLog2 = 0.0;
+	for (int i = 0; i < count; i++)
+	{
+		double x = (i - count / 2) * 0.005;
+		x64[i] = Fixed64::FromDouble(x);
+		double y = Fixed64::ToDouble(Fixed64::Log2Ultra(x64[i] + Fixed64::One * 11));
+		maxLog2 = fmax(maxLog2, fabs(y - log2(Fixed64::ToDouble(x64[i] + Fixed64::One * 11))));
+	}
+	numErrors += (maxLog2 < 1.0 / 65536) ? 0 : 1;
+
+	// Relative error of Log2 close to 1.0
+	double maxLog2Rel = 0.0;
+	for (int i = -count / 2; i < count / 2; i++)
+	{
+		Fixed64::FP_LONG x = Fixed64::One + (Fixed64::FP_LONG)i * 65537;
+		double ref = log2(Fixed64::ToDouble(x));
+		if (ref != 0.0)
+			maxLog2Rel = fmax(maxLog2Rel, fabs(Fixed64::ToDouble(Fixed64::Log2Ultra(x)) / ref - 1.0));
+	}
+	numErrors += (maxLog2Rel < 1.0 / 16384) ? 0 : 1;
+
+	// Fixed32 has no fraction bits to spare, so close to 1.0 the series should be within an ulp
+	double maxLog2Near = 0.0;
+	for (int i = -4095; i < 4096; i++)
+	{
+		Fixed32::FP_INT x = Fixed32::One + i;
+		maxLog2Near = fmax(maxLog2Near, fabs(Fixed32::ToDouble(Fixed32::Log2Ultra(x)) - log2(Fixed32::ToDouble(x))));
+	}
+	numErrors += (maxLog2Near <= 1.0 / 65536) ? 0 : 1;
+	numErrors += (Fixed64::Log2Ultra(Fixed64::One) == 0 && Fixed32::Log2Ultra(Fixed32::One) == 0 && Fixed64::SinUltra(0) == 0) ? 0 : 1;
+
+	std::cout << "Ultra: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestPow()
+{
+	int numErrors = 0;
+
+	// Fast paths give the same results as the corresponding functions
+	for (int i = 1; i < 4096; i++)
+	{
+		Fixed32::FP_INT x32 = i * 997;
+		Fixed64::FP_LONG x64 = (Fixed64::FP_LONG)i * 6553711;
+		numErrors += (Fixed32::Pow(x32, Fixed32::Half) == Fixed32::Sqrt(x32)) ? 0 : 1;
+		numErrors += (Fixed32::PowFast(x32, Fixed32::Neg1) == Fixed32::RcpFast(x32)) ? 0 : 1;
+		numErrors += (Fixed64::Pow(x64, -Fixed64::Half) == Fixed64::RSqrt(x64)) ? 0 : 1;
+		numErrors += (Fixed64::PowFastest(x64, Fixed64::Half) == Fixed64::SqrtFastest(x64)) ? 0 : 1;
+		numErrors += (Fixed64::Pow(x64, Fixed64::One * 2) == Fixed64::PowInt(x64, 2)) ? 0 : 1;
+		numErrors += (Fixed64::PowInt(x64, 1) == x64 && Fixed64::PowInt(x64, 2) == Fixed64::MulSat(x64, x64)) ? 0 : 1;
+
+		// Negative powers use the reciprocal of the same tier
+		numErrors += (Fixed32::PowFast(x32, Fixed32::FromInt(-2)) == Fixed32::PowIntFast(x32, -2)) ? 0 : 1;
+		numErrors += (Fixed32::PowIntFastest(x32, -1) == Fixed32::RcpFastest(x32)) ? 0 : 1;
+		numErrors += (Fixed64::PowFastest(x64, Fixed64::FromInt(-3)) == Fixed64::PowIntFastest(x64, -3)) ? 0 : 1;
+		numErrors += (Fixed64::PowIntFast(x64, -1) == Fixed64::RcpFast(x64) && Fixed64::PowInt(x64, -1) == Fixed64::Rcp(x64)) ? 0 : 1;
+	}
+
+	// PowInt() handles negative bases, negative powers and overflow
+	double maxInt = 0.0;
+	for (int n = -6; n <= 6; n++)
+	{
+		for (int i = 0; i < 256; i++)
+		{
+			Fixed64::FP_LONG x = Fixed64::FromDouble(-4.0 + i * (8.0 / 256) + 0.01);
+			double ref = pow(Fixed64::ToDouble(x), n);
+			if (fabs(ref) < 1e6)
+				maxInt = fmax(maxInt, fabs(Fixed64::ToDouble(Fixed64::PowInt(x, n)) - ref) / fmax(fabs(ref), 1.0));
+		}
+	}
+	numErrors += (maxInt < 4e-7) ? 0 : 1;  // |n| times the relative error of Rcp()
+	numErrors += (Fixed32::PowInt(Fixed32::FromDouble(-10.0), 7) == -Fixed32::MaxValue) ? 0 : 1;
+	numErrors += (Fixed32::PowInt(Fixed32::FromDouble(10.0), 8) == Fixed32::MaxValue) ? 0 : 1;
+	numErrors += (Fixed64::PowInt(Fixed64::FromDouble(-0.5), -3) == Fixed64::FromDouble(-8.0)) ? 0 : 1;
+	numErrors += (Fixed64::PowInt(Fixed64::MinValue, 0) == Fixed64::One) ? 0 : 1;
+
+	// General path is at least as precise as Exp(Mul(e, Log(x)))
+	double maxNew = 0.0, maxOld = 0.0;
+	for (int i = 1; i < 8192; i++)
+	{
+		Fixed32::FP_INT x = Fixed32::FromDouble(0.05 + i * 0.0013);
+		Fixed32::FP_INT e = Fixed32::FromDouble(-2.7 + i * 0.00067);
+		double ref = pow(Fixed32::ToDouble(x), Fixed32::ToDouble(e));
+		if (ref < 0.01 || ref > 10000.0)
+			continue;
+		maxNew = fmax(maxNew, fabs(Fixed32::ToDouble(Fixed32::Pow(x, e)) / ref - 1.0));
+		maxOld = fmax(maxOld, fabs(Fixed32::ToDouble(Fixed32::Exp(Fixed32::Mul(e, Fixed32::Log(x)))) / ref - 1.0));
+	}
+	numErrors += (maxNew <= maxOld) ? 0 : 1;
+
+	// Fixed64 general path is limited by Exp2() (23 bits) rather than by the error of the logarithm
+	// multiplied by the exponent, also for large exponents
+	double maxPow64 = 0.0;
+	for (int i = 1; i < 16384; i++)
+	{
+		Fixed64::FP_LONG x = Fixed64::FromDouble(1.0 + i * 0.00061);
+		Fixed64::FP_LONG e = Fixed64::FromDouble(((i & 1) ? 40.0 : -40.0) + i * 0.00013);
+		double ref = pow(Fixed64::ToDouble(x), Fixed64::ToDouble(e));
+		if (ref < 1.0 || ref > 1e6)
+			continue;
+		maxPow64 = fmax(maxPow64, fabs(Fixed64::ToDouble(Fixed64::Pow(x, e)) / ref - 1.0));
+	}
+	numErrors += (maxPow64 < 1.2e-7) ? 0 : 1;
+
+	std::cout << "Pow: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestExp10Log10Cbrt()
+{
+	int numErrors = 0;
+	const int count = 4096;
+	std::vector<Fixed32::FP_INT> x32(count), out32(count);
+	std::vector<Fixed64::FP_LONG> x64(count), out64(count);
+
+	// Errors relative to max(|y|, 1), so that results close to zero are compared absolutely
+	double maxExp10 = 0.0, maxLog10 = 0.0, maxCbrt = 0.0, maxCbrt32 = 0.0;
+	for (int i = 0; i < count; i++)
+	{
+		double e = (i - count / 2) * (16.0 / count);
+		Fixed64::FP_LONG xe = Fixed64::FromDouble(e);
+		double ye = pow(10.0, Fixed64::ToDouble(xe));
+		maxExp10 = fmax(maxExp10, fabs(Fixed64::ToDouble(Fixed64::Exp10(xe)) - ye) / fmax(ye, 1.0));
+
+		Fixed64::FP_LONG xl = Fixed64::FromDouble(pow(10.0, (i - count / 2) * (12.0 / count)));
+		maxLog10 = fmax(maxLog10, fabs(Fixed64::ToDouble(Fixed64::Log10(xl)) - log10(Fixed64::ToDouble(xl))));
+
+		x64[i] = Fixed64::FromDouble((i - count / 2) * 1.7);
+		double yc = cbrt(Fixed64::ToDouble(x64[i]));
+		maxCbrt = fmax(maxCbrt, fabs(Fixed64::ToDouble(Fixed64::Cbrt(x64[i])) - yc) / fmax(fabs(yc), 1.0));
+
+		x32[i] = Fixed32::FromDouble((i - count / 2) * 0.013);
+		yc = cbrt(Fixed32::ToDouble(x32[i]));
+		maxCbrt32 = fmax(maxCbrt32, fabs(Fixed32::ToDouble(Fixed32::Cbrt(x32[i])) - yc) / fmax(fabs(yc), 1.0));
+		numErrors += (Fixed64::Cbrt(-x64[i]) == -Fixed64::Cbrt(x64[i])) ? 0 : 1;
+	}
+	numErrors += (maxExp10 < 1e-6 && maxLog10 < 1e-8 && maxCbrt < 1e-6 && maxCbrt32 < 1.0 / 32768) ? 0 : 1;
+
+	// Exact values and saturation
+	numErrors += (Fixed64::Log10(Fixed64::One) == 0 && Fixed64::Cbrt(Fixed64::FromInt(8)) == Fixed64::FromInt(2)) ? 0 : 1;
+	numErrors += (Fixed32::Exp10(Fixed32::FromInt(6)) == Fixed32::MaxValue && Fixed32::Exp10(Fixed32::FromInt(-6)) == 0) ? 0 : 1;
+	numErrors += (Fixed64::Exp10(Fixed64::FromInt(1000000000)) == Fixed64::MaxValue) ? 0 : 1;
+
+	// Batch variants match the scalar functions
+	Fixed32::CbrtFastBatch(&x32[0], &out32[0], count);
+	Fixed64::Exp10FastestBatch(&x64[0], &out64[0], count);
+	for (int i = 0; i < count; i++)
+	{
+		numErrors += (out32[i] == Fixed32::CbrtFast(x32[i])) ? 0 : 1;
+		numErrors += (out64[i] == Fixed64::Exp10Fastest(x64[i])) ? 0 : 1;
+	}
+
+	std::cout << "Exp10/Log10/Cbrt: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestTurns()
+{
+	int numErrors = 0;
+	const int count = 4096;
+	std::vector<Fixed32::FP_INT> angle(count), sin32(count), cos32(count), turns(count);
+	std::vector<Fixed64::FP_LONG> sin64(count), cos64(count);
+
+	// Binary angles match the radian functions, and angles one turn apart give the same result
+	double maxSin = 0.0, maxAtan = 0.0;
+	for (int i = 0; i < count; i++)
+	{
+		angle[i] = (Fixed32::FP_INT)((uint32_t)i * 1048573u);
+		double r = (double)angle[i] * (2.0 * 3.14159265358979323846 / 4294967296.0);
+		maxSin = fmax(maxSin, fabs(Fixed64::ToDouble(Fixed64::SinTurns(angle[i])) - sin(r)));
+		maxSin = fmax(maxSin, fabs(Fixed64::ToDouble(Fixed64::CosTurns(angle[i])) - cos(r)));
+
+		Fixed64::FP_LONG y = Fixed64::FromDouble(sin(r) * 100.0);
+		Fixed64::FP_LONG x = Fixed64::FromDouble(cos(r) * 100.0);
+		Fixed32::FP_INT t = Fixed64::Atan2Turns(y, x);
+		maxAtan = fmax(maxAtan, fabs((double)(Fixed32::FP_INT)((uint32_t)t - (uint32_t)angle[i])));
+	}
+	numErrors += (maxSin < 1e-7 && maxAtan < 64.0) ? 0 : 1;
+	numErrors += (Fixed64::SinTurns(Fixed32::MinValue) == Fixed64::SinTurns(0) && Fixed64::CosTurns(1 << 30) == 0) ? 0 : 1;
+	numErrors += (Fixed32::Atan2Turns(0, -Fixed32::One) == Fixed32::MinValue && Fixed32::Atan2Turns(-Fixed32::One, 0) == -(1 << 30)) ? 0 : 1;
+
+	// Batch variants match the scalar functions
+	Fixed64::SinCosTurnsFastBatch(&angle[0], &sin64[0], &cos64[0], count);
+	Fixed32::SinCosTurnsBatch(&angle[0], &sin32[0], &cos32[0], count);
+	Fixed32::Atan2TurnsFastestBatch(&sin32[0], &cos32[0], &turns[0], count);
+	for (int i = 0; i < count; i++)
+	{
+		Fixed64::FP_LONG s, c;
+		Fixed64::SinCosTurnsFast(angle[i], s, c);
+		numErrors += (sin64[i] == s && cos64[i] == c && s == Fixed64::SinTurnsFast(angle[i])) ? 0 : 1;
+		numErrors += (sin32[i] == Fixed32::SinTurns(angle[i]) && cos32[i] == Fixed32::CosTurns(angle[i])) ? 0 : 1;
+		numErrors += (turns[i] == Fixed32::Atan2TurnsFastest(sin32[i], cos32[i])) ? 0 : 1;
+	}
+
+	std::cout << "Turns: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+void TestRefined()
+{
+	int numErrors = 0;
+	const int count = 4096;
+	std::vector<Fixed64::FP_LONG> a(count), b(count), quot(count), root(count), rcp(count);
+	std::vector<Fixed32::FP_INT> x32(count), root32(count);
+
+	// Quotients and reciprocals are within 1 ULP of DivPrecise(), square roots are exact (rounded down)
+	uint64_t seed = 12345;
+	for (int i = 0; i < count; i++)
+	{
+		seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+		a[i] = (Fixed64::FP_LONG)(seed >> ((seed & 63) | 1));
+		seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+		b[i] = (Fixed64::FP_LONG)(seed >> ((seed & 63) | 1)) | 1;
+		if (i & 1)
+			b[i] = -b[i];
+		x32[i] = (Fixed32::FP_INT)(a[i] >> 33) | 1;
+
+		if ((uint64_t)(a[i] >> 31) < (uint64_t)Fixed64::Abs(b[i]))
+			numErrors += (Fixed64::Abs(Fixed64::DivRefined(a[i], b[i]) - Fixed64::DivPrecise(a[i], b[i])) <= 1) ? 0 : 1;
+		if (Fixed64::Abs(b[i]) > 2)
+			numErrors += (Fixed64::Abs(Fixed64::RcpRefined(b[i]) - Fixed64::DivPrecise(Fixed64::One, b[i])) <= 1) ? 0 : 1;
+
+		uint64_t r = (uint64_t)Fixed64::SqrtRefined(a[i]);
+		uint64_t rem = ((uint64_t)a[i] << 32) - r * r;
+		numErrors += (rem <= 2 * r) ? 0 : 1;
+
+		int64_t r32 = Fixed32::SqrtRefined(x32[i]);
+		int64_t n32 = (int64_t)x32[i] << 16;
+		numErrors += (r32 * r32 <= n32 && (r32 + 1) * (r32 + 1) > n32) ? 0 : 1;
+	}
+
+	// Overflowing quotients saturate, invalid arguments return 0
+	numErrors += (Fixed64::DivRefined(Fixed64::MaxValue, 1) == Fixed64::MaxValue && Fixed64::DivRefined(Fixed64::MaxValue, -1) == Fixed64::MinValue) ? 0 : 1;
+	numErrors += (Fixed64::DivRefined(Fixed64::One, 0) == 0 && Fixed64::SqrtRefined(-Fixed64::One) == 0 && Fixed32::SqrtRefined(-Fixed32::One) == 0) ? 0 : 1;
+	numErrors += (Fixed64::SqrtRefined(Fixed64::FromInt(4)) == Fixed64::FromInt(2) && Fixed32::SqrtRefined(Fixed32::FromInt(9)) == Fixed32::FromInt(3)) ? 0 : 1;
+
+	// Batch variants match the scalar functions
+	Fixed64::DivRefinedBatch(&a[0], &b[0], &quot[0], count);
+	Fixed64::SqrtRefinedBatch(&a[0], &root[0], count);
+	Fixed64::RcpRefinedBatch(&b[0], &rcp[0], count);
+	Fixed32::SqrtRefinedBatch(&x32[0], &root32[0], count);
+	for (int i = 0; i < count; i++)
+	{
+		numErrors += (quot[i] == Fixed64::DivRefined(a[i], b[i]) && root[i] == Fixed64::SqrtRefined(a[i])) ? 0 : 1;
+		numErrors += (rcp[i] == Fixed64::RcpRefined(b[i]) && root32[i] == Fixed32::SqrtRefined(x32[i])) ? 0 : 1;
+	}
+
+	std::cout << "Refined: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
+// Bit-by-bit square root loops that SqrtPrecise() used for all inputs
+static Fixed32::FP_INT SqrtLoop32(Fixed32::FP_INT a)
+{
+	uint32_t r = (uint32_t)a, b = 0x40000000, q = 0;
+	for (; b > 0x40; b >>= 1, r <<= 1)
+	{
+		if (r >= q + b)
+		{
+			r -= q + b;
+			q += 2 * b;
+		}
+	}
+	return (Fixed32::FP_INT)(q >> 8);
+}
+
+static Fixed64::FP_LONG SqrtLoop64(Fixed64::FP_LONG a)
+{
+	uint64_t r = (uint64_t)a, b = 0x4000000000000000ull, q = 0;
+	for (; b > 0x40; b >>= 1, r <<= 1)
+	{
+		if (r >= q + b)
+		{
+			r -= q + b;
+			q += 2 * b;
+		}
+	}
+	return (Fixed64::FP_LONG)(q >> 16);
+}
+
+void TestSqrtPrecise()
+{
+	int numErrors = 0;
+
+	// Results are bit-identical to the loops, also where their remainder overflows
+	for (int64_t x = 1; x <= Fixed32::MaxValue; x += 1 + (x >> 10))
+		numErrors += (Fixed32::SqrtPrecise((Fixed32::FP_INT)x) == SqrtLoop32((Fixed32::FP_INT)x)) ? 0 : 1;
+	for (int k = 0; k < 63; k++)
+	{
+		for (int d = -256; d <= 256; d++)
+		{
+			Fixed64::FP_LONG x = (Fixed64::FP_LONG)(((uint64_t)1 << k) + (uint64_t)(int64_t)d);
+			if (x > 0)
+				numErrors += (Fixed64::SqrtPrecise(x) == SqrtLoop64(x)) ? 0 : 1;
+		}
+	}
+	uint64_t seed = 54321;
+	for (int i = 0; i < 100000; i++)
+	{
+		seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+		Fixed64::FP_LONG x = (Fixed64::FP_LONG)(seed >> ((seed & 63) | 1));
+		numErrors += (Fixed64::SqrtPrecise(x) == SqrtLoop64(x)) ? 0 : 1;
+	}
+
+	std::cout << "SqrtPrecise: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
+
 int main()
 {
 	std::cout << "Testing 16.16 fixed point numbers.." << std::endl;
@@ -86,6 +1383,90 @@ int main()
 	std::cout << "Testing 32.32 fixed point numbers.." << std::endl;
 	Test64();
 
+	std::cout << std::endl;
+	std::cout << "Testing matrix multiply kernels.." << std::endl;
+	TestGemm();
+
+	std::cout << std::endl;
+	std::cout << "Testing FFT.." << std::endl;
+	TestFFT();
+
+	std::cout << std::endl;
+	std::cout << "Testing filters.." << std::endl;
+	TestFilter();
+
+	std::cout << std::endl;
+	std::cout << "Testing physics.." << std::endl;
+	TestPhysics();
+
+	std::cout << std::endl;
+	std::cout << "Testing float conversions.." << std::endl;
+	TestConvert();
+
+	std::cout << std::endl;
+	std::cout << "Testing packed formats.." << std::endl;
+	TestPacked();
+
+	std::cout << std::endl;
+	std::cout << "Testing ray packets.." << std::endl;
+	TestRayPacket();
+
+	std::cout << std::endl;
+	std::cout << "Testing thread pool.." << std::endl;
+	TestParallel();
+
+	std::cout << std::endl;
+	std::cout << "Testing saturating arithmetic.." << std::endl;
+	TestSaturate();
+
+	std::cout << std::endl;
+	std::cout << "Testing reductions.." << std::endl;
+	TestReduce();
+
+	std::cout << std::endl;
+	std::cout << "Testing array files.." << std::endl;
+	TestFile();
+
+	std::cout << std::endl;
+	std::cout << "Testing instrumentation.." << std::endl;
+	TestInstrument();
+
+	std::cout << std::endl;
+	std::cout << "Testing sampled checks.." << std::endl;
+	TestCheck();
+
+	std::cout << std::endl;
+	std::cout << "Testing precision tier profiling.." << std::endl;
+	TestTier();
+
+	std::cout << std::endl;
+	std::cout << "Testing Estrin-scheme kernels.." << std::endl;
+	TestEstrin();
+
+	std::cout << std::endl;
+	std::cout << "Testing table-interpolated Ultra tier.." << std::endl;
+	TestUltra();
+
+	std::cout << std::endl;
+	std::cout << "Testing Pow fast paths.." << std::endl;
+	TestPow();
+
+	std::cout << std::endl;
+	std::cout << "Testing Exp10, Log10 and Cbrt.." << std::endl;
+	TestExp10Log10Cbrt();
+
+	std::cout << std::endl;
+	std::cout << "Testing binary angle functions.." << std::endl;
+	TestTurns();
+
+	std::cout << std::endl;
+	std::cout << "Testing Newton-refined division and square root.." << std::endl;
+	TestRefined();
+
+	std::cout << std::endl;
+	std::cout << "Testing exact square root.." << std::endl;
+	TestSqrtPrecise();
+
 	std::cout << std::endl;
 	std::cout << "Executing all unit tests.." << std::endl;
 	UnitTest_TestAll();
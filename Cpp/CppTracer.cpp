@@ -0,0 +1,650 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// C++ port of Examples/FixedTracer, used as a macro-benchmark. The same tracer is instantiated
+// with Fixed64 (colors in Fixed32, like the C# version) and with double, and both are rendered
+// with tile-parallel work stealing over a BVH of the spheres.
+//
+// Usage: CppTracer [width] [height] [samples] [threads] [extraSpheres] [out.ppm]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "FixedUtil.h"
+#include "Fixed32.h"
+#include "Fixed64.h"
+#include "FixedParallel.h"
+
+// Scalar operations for the Fixed64 tracer. Positions and distances are s32.32, colors s16.16.
+struct FixedMath
+{
+    typedef Fixed64::FP_LONG Scalar;
+    typedef Fixed32::FP_INT Channel;
+
+    static const char* Name() { return "Fixed64"; }
+
+    static Scalar FromInt(int v) { return Fixed64::FromInt(v); }
+    static Scalar Ratio(int a, int b) { return ((Scalar)a << 32) / b; }
+    static Scalar Half() { return Fixed64::Half; }
+    static Scalar MaxValue() { return Fixed64::MaxValue; }
+    static Scalar Mul(Scalar a, Scalar b) { return Fixed64::Mul(a, b); }
+    static Scalar SqrtFast(Scalar a) { return Fixed64::SqrtFast(a); }
+    static Scalar RSqrt(Scalar a) { return Fixed64::RSqrt(a); }
+    static Scalar RSqrtFastest(Scalar a) { return Fixed64::RSqrtFastest(a); }
+    static Scalar RcpFast(Scalar a) { return Fixed64::RcpFast(a); }
+    static int FloorToInt(Scalar a) { return Fixed64::FloorToInt(a); }
+    static Scalar PlaneEpsilon() { return (Scalar)1 << 24; }
+
+    // Reciprocal for slab tests, clamped to +-2^16 so that axis-aligned directions don't overflow.
+    static Scalar RcpDir(Scalar a)
+    {
+        const Scalar limit = (Scalar)1 << 16;
+        if (a >= 0 && a < limit) return (Scalar)1 << 48;
+        if (a < 0 && a > -limit) return -((Scalar)1 << 48);
+        return Fixed64::RcpFast(a);
+    }
+
+    // Sub-pixel offset in [-0.5, 0.5) from a 31-bit random number.
+    static Scalar JitterFromRandom(uint32_t r) { return (Scalar)r * 2 - Fixed64::Half; }
+
+    static Channel ToChannel(Scalar a) { return (Channel)(a >> 16); }
+    static Channel ChannelRatio(int a, int b) { return (Channel)(((int64_t)a << 16) / b); }
+    static Channel ChannelOne() { return Fixed32::One; }
+    static Channel ChannelMul(Channel a, Channel b) { return Fixed32::Mul(a, b); }
+    static Channel ChannelMax0(Channel a) { return Fixed32::Max(0, a); }
+    static Channel ChannelPow(Channel a, Channel b) { return Fixed32::PowFastest(a, b); }
+    static int ChannelToByte(Channel a) { return Fixed32::RoundToInt(Fixed32::Clamp(a, 0, Fixed32::One) * 255); }
+};
+
+// Scalar operations for the double-precision twin.
+struct DoubleMath
+{
+    typedef double Scalar;
+    typedef double Channel;
+
+    static const char* Name() { return "Double"; }
+
+    static Scalar FromInt(int v) { return (double)v; }
+    static Scalar Ratio(int a, int b) { return (double)a / (double)b; }
+    static Scalar Half() { return 0.5; }
+    static Scalar MaxValue() { return 1e300; }
+    static Scalar Mul(Scalar a, Scalar b) { return a * b; }
+    static Scalar SqrtFast(Scalar a) { return sqrt(a); }
+    static Scalar RSqrt(Scalar a) { return 1.0 / sqrt(a); }
+    static Scalar RSqrtFastest(Scalar a) { return 1.0 / sqrt(a); }
+    static Scalar RcpFast(Scalar a) { return 1.0 / a; }
+    static int FloorToInt(Scalar a) { return (int)floor(a); }
+    static Scalar PlaneEpsilon() { return 1.0 / 256.0; }
+    static Scalar RcpDir(Scalar a) { return (fabs(a) < 1.0 / 65536.0) ? (a < 0.0 ? -65536.0 : 65536.0) : 1.0 / a; }
+    static Scalar JitterFromRandom(uint32_t r) { return r * (1.0 / 2147483648.0) - 0.5; }
+
+    static Channel ToChannel(Scalar a) { return a; }
+    static Channel ChannelRatio(int a, int b) { return (double)a / (double)b; }
+    static Channel ChannelOne() { return 1.0; }
+    static Channel ChannelMul(Channel a, Channel b) { return a * b; }
+    static Channel ChannelMax0(Channel a) { return std::max(0.0, a); }
+    static Channel ChannelPow(Channel a, Channel b) { return pow(a, b); }
+    static int ChannelToByte(Channel a) { return (int)floor(std::min(std::max(a, 0.0), 1.0) * 255.0 + 0.5); }
+};
+
+template <typename M>
+struct Vec3
+{
+    typedef typename M::Scalar S;
+    S x, y, z;
+
+    Vec3() : x(0), y(0), z(0) { }
+    Vec3(S x_, S y_, S z_) : x(x_), y(y_), z(z_) { }
+
+    static Vec3 Ratio100(int x, int y, int z) { return Vec3(M::Ratio(x, 100), M::Ratio(y, 100), M::Ratio(z, 100)); }
+
+    Vec3 operator+(const Vec3& o) const { return Vec3(x + o.x, y + o.y, z + o.z); }
+    Vec3 operator-(const Vec3& o) const { return Vec3(x - o.x, y - o.y, z - o.z); }
+    S operator[](int axis) const { return (axis == 0) ? x : (axis == 1) ? y : z; }
+
+    static Vec3 Scale(S s, const Vec3& v) { return Vec3(M::Mul(s, v.x), M::Mul(s, v.y), M::Mul(s, v.z)); }
+    static S Dot(const Vec3& a, const Vec3& b) { return M::Mul(a.x, b.x) + M::Mul(a.y, b.y) + M::Mul(a.z, b.z); }
+    static S LengthSqr(const Vec3& a) { return Dot(a, a); }
+    static Vec3 Normalize(const Vec3& a) { return Scale(M::RSqrt(LengthSqr(a)), a); }
+    static Vec3 NormalizeFastest(const Vec3& a) { return Scale(M::RSqrtFastest(LengthSqr(a)), a); }
+    static Vec3 Cross(const Vec3& a, const Vec3& b)
+    {
+        return Vec3(
+            M::Mul(a.y, b.z) - M::Mul(a.z, b.y),
+            M::Mul(a.z, b.x) - M::Mul(a.x, b.z),
+            M::Mul(a.x, b.y) - M::Mul(a.y, b.x));
+    }
+};
+
+template <typename M>
+struct Color
+{
+    typedef typename M::Channel C;
+    C r, g, b;
+
+    Color() : r(0), g(0), b(0) { }
+    Color(C r_, C g_, C b_) : r(r_), g(g_), b(b_) { }
+
+    static Color Ratio100(int r, int g, int b) { return Color(M::ChannelRatio(r, 100), M::ChannelRatio(g, 100), M::ChannelRatio(b, 100)); }
+    static Color White() { return Color(M::ChannelOne(), M::ChannelOne(), M::ChannelOne()); }
+    static Color Background() { return Color(M::ChannelRatio(4, 10), M::ChannelRatio(6, 10), M::ChannelOne()); }
+
+    Color operator+(const Color& o) const { return Color(r + o.r, g + o.g, b + o.b); }
+    Color operator*(const Color& o) const { return Color(M::ChannelMul(r, o.r), M::ChannelMul(g, o.g), M::ChannelMul(b, o.b)); }
+    static Color Scale(C s, const Color& c) { return Color(M::ChannelMul(s, c.r), M::ChannelMul(s, c.g), M::ChannelMul(s, c.b)); }
+};
+
+template <typename M>
+struct Material
+{
+    Color<M>            diffuse;
+    Color<M>            specular;
+    typename M::Channel reflect;
+    typename M::Channel roughness;
+
+    Material(const Color<M>& d, const Color<M>& s, typename M::Channel refl, typename M::Channel rough)
+        : diffuse(d), specular(s), reflect(refl), roughness(rough) { }
+};
+
+template <typename M>
+struct Sphere
+{
+    Vec3<M>             center;
+    typename M::Scalar  radius;
+    int                 material;
+};
+
+template <typename M>
+struct Light
+{
+    Vec3<M>     pos;
+    Color<M>    color;
+};
+
+template <typename M>
+struct Ray
+{
+    Vec3<M>     start;
+    Vec3<M>     dir;
+    Vec3<M>     invDir;     // clamped reciprocal of dir, for the BVH slab test
+
+    Ray(const Vec3<M>& s, const Vec3<M>& d)
+        : start(s), dir(d), invDir(M::RcpDir(d.x), M::RcpDir(d.y), M::RcpDir(d.z)) { }
+};
+
+template <typename M>
+struct Hit
+{
+    typename M::Scalar  dist;
+    Vec3<M>             pos;
+    Vec3<M>             normal;
+    int                 material;
+};
+
+// Bounding volume hierarchy over the spheres. Leaves reference a contiguous range of the
+// reordered sphere array; inner nodes store the index of their left child, the right child
+// immediately follows the left subtree.
+template <typename M>
+class Bvh
+{
+public:
+    typedef typename M::Scalar S;
+
+    struct Node
+    {
+        Vec3<M> boundsMin;
+        Vec3<M> boundsMax;
+        int     first;      // first sphere (leaf) or right child (inner node)
+        int     count;      // number of spheres, zero for inner nodes
+    };
+
+    static const int MaxLeafSize = 2;
+
+    void Build(std::vector<Sphere<M> >& spheres)
+    {
+        m_nodes.clear();
+        if (!spheres.empty())
+            BuildNode(spheres, 0, (int)spheres.size());
+    }
+
+    const std::vector<Node>& Nodes() const { return m_nodes; }
+
+    // Returns true if the ray segment [0, maxDist] touches the box. The test never culls a real hit,
+    // but it does cull the spurious hits that the sphere test can report for distant rays with
+    // approximately normalized directions (disc suffers from cancellation), so a Fixed64 image
+    // can differ slightly from a brute-force loop over all spheres.
+    static bool HitsBox(const Ray<M>& ray, const Node& node, S maxDist)
+    {
+        S tmin = 0;
+        S tmax = maxDist;
+        for (int axis = 0; axis < 3; axis++)
+        {
+            S inv = ray.invDir[axis];
+            S t0 = M::Mul(node.boundsMin[axis] - ray.start[axis], inv);
+            S t1 = M::Mul(node.boundsMax[axis] - ray.start[axis], inv);
+            if (t0 > t1) std::swap(t0, t1);
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+            if (tmin > tmax)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    int BuildNode(std::vector<Sphere<M> >& spheres, int first, int count)
+    {
+        int index = (int)m_nodes.size();
+        m_nodes.push_back(Node());
+
+        // Pad the boxes slightly so that rounding in the sphere test can't escape them.
+        S pad = M::Ratio(1, 1000);
+        Vec3<M> bmin(M::MaxValue(), M::MaxValue(), M::MaxValue());
+        Vec3<M> bmax(-M::MaxValue(), -M::MaxValue(), -M::MaxValue());
+        for (int i = first; i < first + count; i++)
+        {
+            const Sphere<M>& s = spheres[i];
+            S r = s.radius + pad;
+            bmin = Vec3<M>(std::min(bmin.x, s.center.x - r), std::min(bmin.y, s.center.y - r), std::min(bmin.z, s.center.z - r));
+            bmax = Vec3<M>(std::max(bmax.x, s.center.x + r), std::max(bmax.y, s.center.y + r), std::max(bmax.z, s.center.z + r));
+        }
+        m_nodes[index].boundsMin = bmin;
+        m_nodes[index].boundsMax = bmax;
+
+        if (count <= MaxLeafSize)
+        {
+            m_nodes[index].first = first;
+            m_nodes[index].count = count;
+            return index;
+        }
+
+        // Median split along the largest axis of the box.
+        Vec3<M> extent = bmax - bmin;
+        int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z) ? 1 : 2;
+        int half = count / 2;
+        std::nth_element(spheres.begin() + first, spheres.begin() + first + half, spheres.begin() + first + count,
+            [axis](const Sphere<M>& a, const Sphere<M>& b) { return a.center[axis] < b.center[axis]; });
+
+        BuildNode(spheres, first, half);
+        int right = BuildNode(spheres, first + half, count - half);
+        m_nodes[index].first = right;
+        m_nodes[index].count = 0;
+        return index;
+    }
+
+    std::vector<Node> m_nodes;
+};
+
+template <typename M>
+class Scene
+{
+public:
+    typedef typename M::Scalar S;
+    typedef typename M::Channel C;
+
+    static const int MaxDepth = 5;
+
+    enum { MaterialWhite, MaterialBlack, MaterialShiny };
+
+    std::vector<Sphere<M> >     spheres;
+    std::vector<Light<M> >      lights;
+    std::vector<Material<M> >   materials;
+    Vec3<M>                     planeNorm;
+    S                           planeOffset;
+    Vec3<M>                     cameraPos;
+    Vec3<M>                     cameraForward;
+    Vec3<M>                     cameraUp;
+    Vec3<M>                     cameraRight;
+    Bvh<M>                      bvh;
+
+    // The scene of the C# tracer, optionally with a field of small random spheres on the floor.
+    explicit Scene(int numExtraSpheres)
+    {
+        materials.push_back(Material<M>(Color<M>::White(), Color<M>::White(), M::ChannelRatio(1, 10), M::ChannelRatio(150, 1)));
+        materials.push_back(Material<M>(Color<M>(), Color<M>::White(), M::ChannelRatio(7, 10), M::ChannelRatio(150, 1)));
+        materials.push_back(Material<M>(Color<M>::White(), Color<M>::Ratio100(50, 50, 50), M::ChannelRatio(6, 10), M::ChannelRatio(50, 1)));
+
+        planeNorm = Vec3<M>::Ratio100(0, 100, 0);
+        planeOffset = 0;
+
+        AddSphere(Vec3<M>::Ratio100(0, 100, 0), M::FromInt(1));
+        AddSphere(Vec3<M>::Ratio100(-100, 50, 150), M::Half());
+
+        uint32_t seed = 12345;
+        for (int i = 0; i < numExtraSpheres; i++)
+        {
+            int x = (int)(NextRandom(seed) % 1200) - 600;
+            int z = (int)(NextRandom(seed) % 1200) - 600;
+            int r = 5 + (int)(NextRandom(seed) % 20);
+            AddSphere(Vec3<M>::Ratio100(x, r, z), M::Ratio(r, 100));
+        }
+
+        AddLight(Vec3<M>::Ratio100(-200, 250, 0), Color<M>::Ratio100(49, 7, 7));
+        AddLight(Vec3<M>::Ratio100(150, 250, 150), Color<M>::Ratio100(7, 7, 49));
+        AddLight(Vec3<M>::Ratio100(150, 250, -150), Color<M>::Ratio100(7, 49, 7));
+        AddLight(Vec3<M>::Ratio100(0, 350, 0), Color<M>::Ratio100(21, 21, 35));
+
+        Vec3<M> lookAt = Vec3<M>::Ratio100(-100, 50, 0);
+        cameraPos = Vec3<M>(M::FromInt(3), M::FromInt(2), M::FromInt(4));
+        cameraForward = Vec3<M>::Normalize(lookAt - cameraPos);
+        Vec3<M> down(0, -M::FromInt(1), 0);
+        cameraRight = Vec3<M>::Scale(M::Ratio(15, 10), Vec3<M>::Normalize(Vec3<M>::Cross(cameraForward, down)));
+        cameraUp = Vec3<M>::Scale(M::Ratio(15, 10), Vec3<M>::Normalize(Vec3<M>::Cross(cameraForward, cameraRight)));
+
+        bvh.Build(spheres);
+    }
+
+    // Renders numSamples jittered rays per pixel into rgb (3 bytes per pixel). Returns the number of
+    // rays traced, including shadow and reflection rays.
+    int64_t Render(FixedParallel::ThreadPool& pool, int width, int height, int numSamples, std::vector<unsigned char>& rgb) const
+    {
+        const int TileSize = 16;
+        int tilesX = (width + TileSize - 1) / TileSize;
+        int tilesY = (height + TileSize - 1) / TileSize;
+        rgb.resize((size_t)width * height * 3);
+
+        S sx = M::Ratio(1, 2 * width);
+        S ox = M::Mul(M::Half(), M::FromInt(width));
+        S sy = -M::Ratio(1, 2 * height);
+        S oy = M::Mul(M::Half(), M::FromInt(height));
+        C ooNumSamples = M::ChannelRatio(1, numSamples);
+
+        std::atomic<int64_t> totalRays(0);
+        pool.Run(tilesX * tilesY, [&](int tile)
+        {
+            int x0 = (tile % tilesX) * TileSize;
+            int y0 = (tile / tilesX) * TileSize;
+            int x1 = std::min(x0 + TileSize, width);
+            int y1 = std::min(y0 + TileSize, height);
+            int64_t numRays = 0;
+
+            for (int y = y0; y < y1; y++)
+            {
+                for (int x = x0; x < x1; x++)
+                {
+                    // Seed per pixel, so the image doesn't depend on which thread rendered the tile.
+                    uint32_t seed = (uint32_t)(y * width + x) * 29827341u + 23427343u;
+                    Color<M> accum;
+                    for (int i = 0; i < numSamples; i++)
+                    {
+                        S rx = M::JitterFromRandom(NextRandom(seed));
+                        S ry = M::JitterFromRandom(NextRandom(seed));
+                        S xx = M::Mul(M::FromInt(x) + rx - ox, sx);
+                        S yy = M::Mul(M::FromInt(y) + ry - oy, sy);
+                        Vec3<M> rayDir = Vec3<M>::Normalize(cameraForward + Vec3<M>::Scale(xx, cameraRight) + Vec3<M>::Scale(yy, cameraUp));
+                        accum = accum + TraceRay(Ray<M>(cameraPos, rayDir), 0, numRays);
+                    }
+
+                    Color<M> color = Color<M>::Scale(ooNumSamples, accum);
+                    unsigned char* dst = &rgb[((size_t)y * width + x) * 3];
+                    dst[0] = (unsigned char)M::ChannelToByte(color.r);
+                    dst[1] = (unsigned char)M::ChannelToByte(color.g);
+                    dst[2] = (unsigned char)M::ChannelToByte(color.b);
+                }
+            }
+
+            totalRays += numRays;
+        });
+
+        return totalRays;
+    }
+
+private:
+    static uint32_t NextRandom(uint32_t& seed)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 1;
+    }
+
+    void AddSphere(const Vec3<M>& center, S radius)
+    {
+        Sphere<M> s;
+        s.center = center;
+        s.radius = radius;
+        s.material = MaterialShiny;
+        spheres.push_back(s);
+    }
+
+    void AddLight(const Vec3<M>& pos, const Color<M>& color)
+    {
+        Light<M> light;
+        light.pos = pos;
+        light.color = color;
+        lights.push_back(light);
+    }
+
+    static bool IntersectSphere(const Sphere<M>& sphere, const Ray<M>& ray, S& dist)
+    {
+        Vec3<M> eo = sphere.center - ray.start;
+        S v = Vec3<M>::Dot(eo, ray.dir);
+        if (v < 0)
+            return false;
+
+        S disc = M::Mul(sphere.radius, sphere.radius) - (Vec3<M>::Dot(eo, eo) - M::Mul(v, v));
+        dist = (disc < 0) ? 0 : v - M::SqrtFast(disc);
+        return dist != 0;
+    }
+
+    bool IntersectPlane(const Ray<M>& ray, S& dist) const
+    {
+        S denom = Vec3<M>::Dot(planeNorm, ray.dir);
+        if (denom > -M::PlaneEpsilon())
+            return false;
+
+        dist = M::Mul(Vec3<M>::Dot(planeNorm, ray.start) + planeOffset, M::RcpFast(-denom));
+        return true;
+    }
+
+    // Finds the nearest sphere hit closer than bestDist. With a positive shadowDistSqr, returns the
+    // first hit whose squared distance is below it instead.
+    int IntersectSpheres(const Ray<M>& ray, S& bestDist, S shadowDistSqr) const
+    {
+        const std::vector<typename Bvh<M>::Node>& nodes = bvh.Nodes();
+        if (nodes.empty())
+            return -1;
+
+        int best = -1;
+        int stack[64];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0)
+        {
+            const typename Bvh<M>::Node& node = nodes[stack[--stackSize]];
+            // Rays starting inside overlapping spheres get negative distances. Those spheres
+            // contain the ray start, so their boxes still pass the test against [0, 0].
+            if (!Bvh<M>::HitsBox(ray, node, std::max(bestDist, (S)0)))
+                continue;
+
+            if (node.count == 0)
+            {
+                stack[stackSize++] = node.first;
+                stack[stackSize++] = (int)(&node - &nodes[0]) + 1;
+                continue;
+            }
+
+            for (int i = node.first; i < node.first + node.count; i++)
+            {
+                S dist;
+                if (!IntersectSphere(spheres[i], ray, dist))
+                    continue;
+
+                if (shadowDistSqr > 0)
+                {
+                    if (M::Mul(dist, dist) < shadowDistSqr)
+                        return i;
+                }
+                else if (dist < bestDist)
+                {
+                    best = i;
+                    bestDist = dist;
+                }
+            }
+        }
+        return best;
+    }
+
+    bool IntersectRay(const Ray<M>& ray, Hit<M>& hit) const
+    {
+        S bestDist = M::MaxValue();
+        int sphere = IntersectSpheres(ray, bestDist, 0);
+
+        S planeDist;
+        if (IntersectPlane(ray, planeDist) && planeDist <= bestDist)
+        {
+            hit.dist = planeDist;
+            hit.pos = ray.start + Vec3<M>::Scale(planeDist, ray.dir);
+            hit.normal = planeNorm;
+            bool isWhite = ((M::FloorToInt(hit.pos.z) + M::FloorToInt(hit.pos.x)) & 1) != 0;
+            hit.material = isWhite ? MaterialWhite : MaterialBlack;
+            return true;
+        }
+
+        if (sphere < 0)
+            return false;
+
+        const Sphere<M>& s = spheres[sphere];
+        hit.dist = bestDist;
+        hit.pos = ray.start + Vec3<M>::Scale(bestDist, ray.dir);
+        hit.normal = Vec3<M>::Normalize(hit.pos - s.center);
+        hit.material = s.material;
+        return true;
+    }
+
+    // The C# tracer looks for the nearest hit and compares its squared distance to the light.
+    // Shadow rays start on a surface, so any hit closer than the light gives the same answer.
+    bool IsInShadow(const Ray<M>& ray, S distSqr) const
+    {
+        S planeDist;
+        if (IntersectPlane(ray, planeDist) && M::Mul(planeDist, planeDist) < distSqr)
+            return true;
+
+        S bestDist = M::MaxValue();
+        return IntersectSpheres(ray, bestDist, distSqr) >= 0;
+    }
+
+    Color<M> TraceRay(const Ray<M>& ray, int depth, int64_t& numRays) const
+    {
+        numRays++;
+        Hit<M> hit;
+        if (!IntersectRay(ray, hit))
+            return Color<M>::Background();
+        return Shade(ray, hit, depth, numRays);
+    }
+
+    Color<M> GetNaturalColor(const Material<M>& material, const Vec3<M>& pos, const Vec3<M>& norm, const Vec3<M>& rd, int64_t& numRays) const
+    {
+        Color<M> ret;
+        for (size_t i = 0; i < lights.size(); i++)
+        {
+            const Light<M>& light = lights[i];
+            Vec3<M> ldis = light.pos - pos;
+            Vec3<M> livec = Vec3<M>::NormalizeFastest(ldis);
+            numRays++;
+            if (!IsInShadow(Ray<M>(pos, livec), Vec3<M>::LengthSqr(ldis)))
+            {
+                C illum = M::ChannelMax0(M::ToChannel(Vec3<M>::Dot(livec, norm)));
+                Color<M> lcolor = Color<M>::Scale(illum, light.color);
+                C specular = M::ToChannel(Vec3<M>::Dot(livec, Vec3<M>::NormalizeFastest(rd)));
+                Color<M> scolor = (specular > 0) ? Color<M>::Scale(M::ChannelPow(specular, material.roughness), light.color) : Color<M>();
+                ret = ret + material.diffuse * lcolor + material.specular * scolor;
+            }
+        }
+        return ret;
+    }
+
+    Color<M> Shade(const Ray<M>& ray, const Hit<M>& hit, int depth, int64_t& numRays) const
+    {
+        const Material<M>& material = materials[hit.material];
+        Vec3<M> reflectDir = ray.dir - Vec3<M>::Scale(2 * Vec3<M>::Dot(hit.normal, ray.dir), hit.normal);
+        Color<M> ret = GetNaturalColor(material, hit.pos, hit.normal, reflectDir, numRays);
+        if (depth >= MaxDepth)
+            return ret + Color<M>(M::ChannelRatio(1, 2), M::ChannelRatio(1, 2), M::ChannelRatio(1, 2));
+
+        Vec3<M> reflectPos = hit.pos + Vec3<M>::Scale(M::Ratio(1, 1000), reflectDir);
+        return ret + Color<M>::Scale(material.reflect, TraceRay(Ray<M>(reflectPos, reflectDir), depth + 1, numRays));
+    }
+};
+
+template <typename M>
+static void Benchmark(FixedParallel::ThreadPool& pool, int width, int height, int numSamples, int numExtraSpheres, std::vector<unsigned char>& rgb)
+{
+    Scene<M> scene(numExtraSpheres);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int64_t numRays = scene.Render(pool, width, height, numSamples, rgb);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-8s %8.3fs  %10lld rays  %8.3f Mrays/s\n", M::Name(), elapsed, (long long)numRays, numRays / elapsed * 1e-6);
+}
+
+static void WritePpm(const char* path, int width, int height, const std::vector<unsigned char>& rgb)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file)
+    {
+        fprintf(stderr, "Unable to write '%s'\n", path);
+        return;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    fwrite(&rgb[0], 1, rgb.size(), file);
+    fclose(file);
+}
+
+int main(int argc, char** argv)
+{
+    int width = (argc > 1) ? atoi(argv[1]) : 600;
+    int height = (argc > 2) ? atoi(argv[2]) : 600;
+    int numSamples = (argc > 3) ? atoi(argv[3]) : 16;
+    int numThreads = (argc > 4) ? atoi(argv[4]) : 0;
+    int numExtraSpheres = (argc > 5) ? atoi(argv[5]) : 0;
+    const char* outPath = (argc > 6) ? argv[6] : 0;
+
+    FixedParallel::ThreadPool pool(numThreads);
+    printf("Rendering %dx%d, %d samples, %d spheres, %d threads\n", width, height, numSamples, numExtraSpheres + 2, pool.NumThreads());
+
+    std::vector<unsigned char> fixedRgb, doubleRgb;
+    Benchmark<FixedMath>(pool, width, height, numSamples, numExtraSpheres, fixedRgb);
+    Benchmark<DoubleMath>(pool, width, height, numSamples, numExtraSpheres, doubleRgb);
+
+    double sumDiff = 0.0;
+    int maxDiff = 0;
+    for (size_t i = 0; i < fixedRgb.size(); i++)
+    {
+        int diff = abs((int)fixedRgb[i] - (int)doubleRgb[i]);
+        sumDiff += diff;
+        maxDiff = std::max(maxDiff, diff);
+    }
+    printf("Fixed64 vs Double: mean abs diff %.3f, max %d (of 255)\n", sumDiff / fixedRgb.size(), maxDiff);
+
+    if (outPath)
+        WritePpm(outPath, width, height, fixedRgb);
+
+    return 0;
+}
@@ -0,0 +1,392 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Benchmarks the polynomial/lookup table kernels of FixedUtil.h on the host CPU and writes a header
+// that binds each precision tier (the FP_KERNEL_* macros in FixedUtil.h) to the fastest kernel that
+// is at least as precise as the default kernel of the tier.
+//
+// Each kernel is timed in four conditions: a dependent chain of calls (scalar) and an independent
+// loop over an array (batch), both with the tables in cache (hot) and after evicting the caches
+// (cold). The kernels are ranked by the average of the four timings, or with --latency by the
+// average of the two scalar timings, which favors the shorter dependency chains of the XxxEstrin
+// kernels for code that is bound by latency rather than throughput. Cold timings only apply to the
+// kernels with a lookup table; they are shown as n/a for the others, and their hot timings are
+// used in the average instead.
+//
+// Usage: CppTuner [--latency] [out.h]   (default FixedKernels.h)
+//
+// Build the library with the generated header included before FixedUtil.h, or with
+// -DFP_KERNEL_CONFIG='"FixedKernels.h"'.
+//
+// Note that other kernels give slightly different (but not less precise) results, so a tuned build
+// is no longer bit-exact with the C# and Java versions or with builds using another configuration.
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "FixedUtil.h"
+
+typedef FixedUtil::FP_INT FP_INT;
+typedef std::chrono::steady_clock Clock;
+
+static const int NumRounds = 3;
+static const int NumInputs = 1024;          // inputs per timing loop, covering the whole domain
+static const int NumColdSamples = 128;      // cache evictions per cold timing
+static const int ColdCalls = 4;             // calls timed after each eviction
+static const size_t EvictBytes = 16 << 20;
+
+static volatile FP_INT s_zero = 0;          // breaks the dependency analysis of the scalar chains
+static volatile FP_INT s_sink = 0;          // keeps the results alive
+static std::vector<unsigned char> s_evictBuffer(EvictBytes);
+
+static void EvictCaches()
+{
+    static unsigned char value = 0;
+    value++;
+    for (size_t i = 0; i < s_evictBuffer.size(); i += 64)
+        s_evictBuffer[i] = (unsigned char)(s_evictBuffer[i] + value);
+}
+
+static double Seconds(Clock::duration d)
+{
+    return std::chrono::duration<double>(d).count();
+}
+
+static double Median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+// Timings in nanoseconds per call.
+struct Timings
+{
+    double scalarHot;
+    double batchHot;
+    double scalarCold;
+    double batchCold;
+};
+
+static Timings Fastest(const Timings& a, const Timings& b)
+{
+    Timings t;
+    t.scalarHot = fmin(a.scalarHot, b.scalarHot);
+    t.batchHot = fmin(a.batchHot, b.batchHot);
+    t.scalarCold = fmin(a.scalarCold, b.scalarCold);
+    t.batchCold = fmin(a.batchCold, b.batchCold);
+    return t;
+}
+
+static FP_INT Identity(FP_INT a) { return a; }
+
+template <FP_INT (*Func)(FP_INT)>
+static FP_INT RunScalar(const FP_INT* inputs, int count, FP_INT y)
+{
+    FP_INT zero = s_zero;
+    for (int i = 0; i < count; i++)
+        y = Func(inputs[i] ^ (y & zero));
+    return y;
+}
+
+template <FP_INT (*Func)(FP_INT)>
+static void RunBatch(const FP_INT* inputs, FP_INT* outputs, int count)
+{
+    for (int i = 0; i < count; i++)
+        outputs[i] = Func(inputs[i]);
+}
+
+template <FP_INT (*Func)(FP_INT)>
+static Timings Measure(const std::vector<FP_INT>& inputs)
+{
+    std::vector<FP_INT> outputs(inputs.size());
+    Timings t;
+    FP_INT y = 0;
+
+    // Hot: repeat until 10ms have passed.
+    int64_t numCalls = 0;
+    Clock::time_point start = Clock::now();
+    do
+    {
+        for (int rep = 0; rep < 64; rep++)
+            y = RunScalar<Func>(&inputs[0], NumInputs, y);
+        numCalls += 64 * NumInputs;
+    } while (Clock::now() - start < std::chrono::milliseconds(10));
+    t.scalarHot = Seconds(Clock::now() - start) * 1e9 / numCalls;
+
+    numCalls = 0;
+    start = Clock::now();
+    do
+    {
+        for (int rep = 0; rep < 64; rep++)
+            RunBatch<Func>(&inputs[0], &outputs[0], NumInputs);
+        numCalls += 64 * NumInputs;
+    } while (Clock::now() - start < std::chrono::milliseconds(10));
+    t.batchHot = Seconds(Clock::now() - start) * 1e9 / numCalls;
+
+    // Cold: only the calls right after an eviction are timed. The median filters out interrupts.
+    std::vector<double> scalar(NumColdSamples);
+    std::vector<double> batch(NumColdSamples);
+    for (int s = 0; s < NumColdSamples; s++)
+    {
+        const FP_INT* in = &inputs[(s * 37 * ColdCalls) % (NumInputs - ColdCalls)];
+        EvictCaches();
+        start = Clock::now();
+        y = RunScalar<Func>(in, ColdCalls, y);
+        scalar[s] = Seconds(Clock::now() - start);
+
+        EvictCaches();
+        start = Clock::now();
+        RunBatch<Func>(in, &outputs[0], ColdCalls);
+        batch[s] = Seconds(Clock::now() - start);
+        y ^= outputs[0];
+    }
+    t.scalarCold = Median(scalar) * 1e9 / ColdCalls;
+    t.batchCold = Median(batch) * 1e9 / ColdCalls;
+
+    s_sink = y ^ outputs[NumInputs - 1];
+    return t;
+}
+
+// Kernel families. All kernels take an s2.30 input in [0, 1) and return an s2.30 result.
+enum Family { EXP2, RCP, SQRT, RSQRT, LOG, LOG2, SIN, ATAN, NumFamilies };
+
+struct FamilyInfo
+{
+    const char* name;
+    const char* defaults[3];    // Full, Fast and Fastest kernels
+    double (*reference)(double);
+};
+
+static double RefExp2(double a) { return pow(2.0, a); }
+static double RefRcp(double a) { return 1.0 / (1.0 + a); }
+static double RefSqrt(double a) { return sqrt(1.0 + a); }
+static double RefRSqrt(double a) { return 1.0 / sqrt(1.0 + a); }
+static double RefLog(double a) { return log(1.0 + a); }
+static double RefLog2(double a) { return log(1.0 + a) / log(2.0); }
+static double RefSin(double a) { return (a > 0.0) ? sin(sqrt(a) * 1.5707963267948966) / sqrt(a) : 1.5707963267948966; }
+static double RefAtan(double a) { return atan(a); }
+
+static const FamilyInfo s_families[NumFamilies] =
+{
+    { "EXP2", { "Exp2Poly5", "Exp2Poly4", "Exp2Poly3" }, RefExp2 },
+    { "RCP", { "RcpPoly4Lut8", "RcpPoly6", "RcpPoly4" }, RefRcp },
+    { "SQRT", { "SqrtPoly3Lut8", "SqrtPoly4", "SqrtPoly3" }, RefSqrt },
+    { "RSQRT", { "RSqrtPoly3Lut16", "RSqrtPoly5", "RSqrtPoly3" }, RefRSqrt },
+    { "LOG", { "LogPoly5Lut8", "LogPoly3Lut8", "LogPoly5" }, RefLog },
+    { "LOG2", { "Log2Poly4Lut16", "Log2Poly3Lut16", "Log2Poly5" }, RefLog2 },
+    { "SIN", { "SinPoly4", "SinPoly3", "SinPoly2" }, RefSin },
+    { "ATAN", { "AtanPoly5Lut8", "AtanPoly3Lut8", "AtanPoly4" }, RefAtan },
+};
+
+static const char* const s_tierNames[3] = { "FULL", "FAST", "FASTEST" };
+
+struct Kernel
+{
+    Family      family;
+    const char* name;
+    FP_INT      (*func)(FP_INT);
+    Timings     (*measure)(const std::vector<FP_INT>&);
+    double      bits;
+    Timings     timings;
+    double      score;
+};
+
+#define KERNEL(family, name) { family, #name, FixedUtil::name, Measure<FixedUtil::name>, 0.0, Timings(), 0.0 }
+
+static Kernel s_kernels[] =
+{
+    KERNEL(EXP2, Exp2Poly3),
+    KERNEL(EXP2, Exp2Poly4),
+    KERNEL(EXP2, Exp2Poly4Estrin),
+    KERNEL(EXP2, Exp2Poly5),
+    KERNEL(EXP2, Exp2Poly5Estrin),
+    KERNEL(RCP, RcpPoly4),
+    KERNEL(RCP, RcpPoly4Estrin),
+    KERNEL(RCP, RcpPoly6),
+    KERNEL(RCP, RcpPoly6Estrin),
+    KERNEL(RCP, RcpPoly3Lut4),
+    KERNEL(RCP, RcpPoly4Lut8),
+    KERNEL(RCP, RcpPoly4Lut8Estrin),
+    KERNEL(SQRT, SqrtPoly3),
+    KERNEL(SQRT, SqrtPoly4),
+    KERNEL(SQRT, SqrtPoly4Estrin),
+    KERNEL(SQRT, SqrtPoly3Lut8),
+    KERNEL(RSQRT, RSqrtPoly3),
+    KERNEL(RSQRT, RSqrtPoly5),
+    KERNEL(RSQRT, RSqrtPoly5Estrin),
+    KERNEL(RSQRT, RSqrtPoly3Lut16),
+    KERNEL(LOG, LogPoly5),
+    KERNEL(LOG, LogPoly5Estrin),
+    KERNEL(LOG, LogPoly3Lut4),
+    KERNEL(LOG, LogPoly3Lut8),
+    KERNEL(LOG, LogPoly5Lut8),
+    KERNEL(LOG, LogPoly5Lut8Estrin),
+    KERNEL(LOG2, Log2Poly5),
+    KERNEL(LOG2, Log2Poly5Estrin),
+    KERNEL(LOG2, Log2Poly4Lut4),
+    KERNEL(LOG2, Log2Poly5Lut4),
+    KERNEL(LOG2, Log2Poly3Lut8),
+    KERNEL(LOG2, Log2Poly3Lut16),
+    KERNEL(LOG2, Log2Poly4Lut16),
+    KERNEL(LOG2, Log2Poly4Lut16Estrin),
+    KERNEL(SIN, SinPoly2),
+    KERNEL(SIN, SinPoly3),
+    KERNEL(SIN, SinPoly4),
+    KERNEL(SIN, SinPoly4Estrin),
+    KERNEL(ATAN, AtanPoly4),
+    KERNEL(ATAN, AtanPoly4Estrin),
+    KERNEL(ATAN, AtanPoly3Lut8),
+    KERNEL(ATAN, AtanPoly5Lut8),
+    KERNEL(ATAN, AtanPoly5Lut8Estrin),
+};
+
+static const int NumKernels = (int)(sizeof(s_kernels) / sizeof(s_kernels[0]));
+
+// Returns the precision in bits (-log2 of the largest absolute error) over the whole input domain.
+static double MeasureBits(const Kernel& kernel)
+{
+    double (*reference)(double) = s_families[kernel.family].reference;
+    double maxError = 0.0;
+    for (FP_INT a = 0; a < (1 << 30); a += 61)
+    {
+        double error = fabs(kernel.func(a) / 1073741824.0 - reference(a / 1073741824.0));
+        if (error > maxError)
+            maxError = error;
+    }
+    return -log2(maxError);
+}
+
+static const Kernel* FindKernel(const char* name)
+{
+    for (int i = 0; i < NumKernels; i++)
+    {
+        if (strcmp(s_kernels[i].name, name) == 0)
+            return &s_kernels[i];
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    bool latency = (argc > 1 && strcmp(argv[1], "--latency") == 0);
+    if (latency)
+    {
+        argc--;
+        argv++;
+    }
+    const char* outPath = (argc > 1) ? argv[1] : "FixedKernels.h";
+
+    // Inputs spread over [0, 1) in s2.30, in a scrambled order so that the table lookups don't
+    // follow a predictable pattern.
+    std::vector<FP_INT> inputs(NumInputs);
+    uint32_t seed = 12345;
+    for (int i = 0; i < NumInputs; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        inputs[i] = (FP_INT)(seed >> 2);
+    }
+
+    // Each kernel is timed in several rounds, keeping the fastest time of each condition. The baseline
+    // for the loop and timer overhead is subtracted from the kernel timings.
+    Timings base = Measure<Identity>(inputs);
+    for (int round = 0; round < NumRounds; round++)
+    {
+        if (round > 0)
+            base = Fastest(base, Measure<Identity>(inputs));
+        for (int i = 0; i < NumKernels; i++)
+        {
+            Timings t = s_kernels[i].measure(inputs);
+            s_kernels[i].timings = (round == 0) ? t : Fastest(s_kernels[i].timings, t);
+        }
+    }
+
+    printf("%-20s %6s %10s %10s %10s %10s %8s\n", "kernel", "bits", "scalarHot", "batchHot", "scalarCold", "batchCold", "score");
+    for (int i = 0; i < NumKernels; i++)
+    {
+        Kernel& k = s_kernels[i];
+        k.bits = MeasureBits(k);
+        Timings t = k.timings;
+        const double minNs = 0.01;
+        k.timings.scalarHot = fmax(t.scalarHot - base.scalarHot, minNs);
+        k.timings.batchHot = fmax(t.batchHot - base.batchHot, minNs);
+
+        // Kernels without a table have no data to evict, so the cold timings only measure noise
+        // around the baseline. They are reported as not applicable and the hot timings are scored
+        // in their place.
+        bool hasTable = (strstr(k.name, "Lut") != 0);
+        k.timings.scalarCold = hasTable ? fmax(t.scalarCold - base.scalarCold, minNs) : k.timings.scalarHot;
+        k.timings.batchCold = hasTable ? fmax(t.batchCold - base.batchCold, minNs) : k.timings.batchHot;
+        if (latency)
+            k.score = (k.timings.scalarHot + k.timings.scalarCold) / 2.0;
+        else
+            k.score = (k.timings.scalarHot + k.timings.batchHot + k.timings.scalarCold + k.timings.batchCold) / 4.0;
+
+        char scalarCold[16] = "n/a";
+        char batchCold[16] = "n/a";
+        if (hasTable)
+        {
+            snprintf(scalarCold, sizeof(scalarCold), "%.2f", k.timings.scalarCold);
+            snprintf(batchCold, sizeof(batchCold), "%.2f", k.timings.batchCold);
+        }
+        printf("%-20s %6.2f %10.2f %10.2f %10s %10s %8.2f\n", k.name, k.bits, k.timings.scalarHot, k.timings.batchHot, scalarCold, batchCold, k.score);
+    }
+
+    FILE* file = fopen(outPath, "w");
+    if (!file)
+    {
+        printf("Cannot write %s\n", outPath);
+        return 1;
+    }
+    fprintf(file, "//\n// GENERATED FILE!!!\n//\n");
+    fprintf(file, "// Generated by CppTuner%s: approximation kernels of the FixPointCS precision tiers for the CPU it ran on.\n", latency ? " --latency" : "");
+    fprintf(file, "// Include before FixedUtil.h, or build with -DFP_KERNEL_CONFIG='\"FixedKernels.h\"'.\n//\n");
+    fprintf(file, "#pragma once\n\n");
+
+    printf("\n");
+    for (int f = 0; f < NumFamilies; f++)
+    {
+        for (int tier = 0; tier < 3; tier++)
+        {
+            // The precision floor of a tier is the precision of its default kernel.
+            const Kernel* def = FindKernel(s_families[f].defaults[tier]);
+            const Kernel* best = def;
+            for (int i = 0; i < NumKernels; i++)
+            {
+                const Kernel& k = s_kernels[i];
+                if (k.family == f && k.bits >= def->bits - 0.01 && k.score < best->score)
+                    best = &k;
+            }
+            printf("FP_KERNEL_%s_%s: %s (default %s)\n", s_families[f].name, s_tierNames[tier], best->name, def->name);
+            fprintf(file, "#define FP_KERNEL_%s_%s %s    // %.2f bits, %.2f ns\n", s_families[f].name, s_tierNames[tier], best->name, best->bits, best->score);
+        }
+    }
+
+    bool ok = (fclose(file) == 0);
+    printf("%s %s\n", ok ? "Wrote" : "Failed to write", outPath);
+    return ok ? 0 : 1;
+}
@@ -89,6 +89,8 @@ namespace Fixed32
     // Private constants
     static const FP_INT RCP_LN2       = (FP_INT)(0x171547652L >> 16);    // 1.0 / log(2.0) ~= 1.4426950408889634
     static const FP_INT RCP_LOG2_E    = (FP_INT)(2977044471L >> 16);     // 1.0 / log2(e) ~= 0.6931471805599453
+    static const FP_INT LOG2_10       = 1783446566;                   // log2(10.0) ~= 3.321928094887362 (s3.29)
+    static const FP_LONG LOG10_2      = INT64_C(1292913986);                  // log10(2.0) ~= 0.3010299956639812 (s32.32)
     static const FP_INT RCP_TWO_PI    = 683565276;                    // 1.0 / (4.0 * 0.5 * pi);  -- the 4.0 factor converts directly to s2.30
 
     /// <summary>
@@ -96,6 +98,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT FromInt(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::FromInt", v);
         return (FP_INT)v << Shift;
     }
 
@@ -104,6 +107,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT FromDouble(double v)
     {
+        FP_INSTRUMENT_CALL0("Fixed32::FromDouble");
         return (FP_INT)(v * 65536.0);
     }
 
@@ -112,6 +116,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT FromFloat(float v)
     {
+        FP_INSTRUMENT_CALL0("Fixed32::FromFloat");
         return (FP_INT)(v * 65536.0f);
     }
 
@@ -120,6 +125,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT CeilToInt(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::CeilToInt", v);
         return (FP_INT)((v + (One - 1)) >> Shift);
     }
 
@@ -128,6 +134,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT FloorToInt(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::FloorToInt", v);
         return (FP_INT)(v >> Shift);
     }
 
@@ -136,6 +143,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT RoundToInt(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::RoundToInt", v);
         return (FP_INT)((v + Half) >> Shift);
     }
 
@@ -144,6 +152,7 @@ namespace Fixed32
     /// </summary>
     static double ToDouble(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::ToDouble", v);
         return (double)v * (1.0 / 65536.0);
     }
 
@@ -152,6 +161,7 @@ namespace Fixed32
     /// </summary>
     static float ToFloat(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::ToFloat", v);
         return (float)v * (1.0f / 65536.0f);
     }
 
@@ -164,6 +174,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Abs(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Abs", x);
         // \note fails with MinValue
         FP_INT mask = x >> 31;
         return (x + mask) ^ mask;
@@ -174,6 +185,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Nabs(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Nabs", x);
         return -Abs(x);
     }
 
@@ -182,6 +194,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Ceil(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Ceil", x);
         return (x + FractionMask) & IntegerMask;
     }
 
@@ -190,6 +203,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Floor(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Floor", x);
         return x & IntegerMask;
     }
 
@@ -198,6 +212,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Round(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Round", x);
         return (x + Half) & IntegerMask;
     }
 
@@ -206,6 +221,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Fract(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Fract", x);
         return x & FractionMask;
     }
 
@@ -214,6 +230,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Min(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Min", a, b);
         return (a < b) ? a : b;
     }
 
@@ -222,6 +239,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Max(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Max", a, b);
         return (a > b) ? a : b;
     }
 
@@ -230,6 +248,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Clamp(FP_INT a, FP_INT min, FP_INT max)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Clamp", a, min);
         return (a > max) ? max : (a < min) ? min : a;
     }
 
@@ -238,6 +257,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Sign(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Sign", x);
         // https://stackoverflow.com/questions/14579920/fast-sign-of-integer-in-c/14612418#14612418
         return ((x >> 31) | (FP_INT)(((FP_UINT)-x) >> 31));
     }
@@ -247,6 +267,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Add(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Add", a, b);
         return a + b;
     }
 
@@ -255,6 +276,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Sub(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Sub", a, b);
         return a - b;
     }
 
@@ -263,6 +285,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Mul(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Mul", a, b);
         return (FP_INT)(((FP_LONG)a * (FP_LONG)b) >> Shift);
     }
 
@@ -271,16 +294,54 @@ namespace Fixed32
     /// </summary>
     static FP_INT Lerp(FP_INT a, FP_INT b, FP_INT t)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Lerp", a, b);
         FP_LONG ta = (FP_LONG)a * (One - (FP_LONG)t);
         FP_LONG tb = (FP_LONG)b * (FP_LONG)t;
         return (FP_INT)((ta + tb) >> Shift);
     }
 
+    /// <summary>
+    /// Adds the two FP numbers together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    static FP_INT AddSat(FP_INT a, FP_INT b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::AddSat", a, b);
+        return FixedUtil::SaturateToInt((FP_LONG)a + (FP_LONG)b);
+    }
+
+    /// <summary>
+    /// Subtracts the two FP numbers from each other, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    static FP_INT SubSat(FP_INT a, FP_INT b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::SubSat", a, b);
+        return FixedUtil::SaturateToInt((FP_LONG)a - (FP_LONG)b);
+    }
+
+    /// <summary>
+    /// Multiplies two FP values together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    static FP_INT MulSat(FP_INT a, FP_INT b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::MulSat", a, b);
+        return FixedUtil::SaturateToInt(((FP_LONG)a * (FP_LONG)b) >> Shift);
+    }
+
+    /// <summary>
+    /// Linearly interpolate from a to b by t, saturating to MinValue/MaxValue on overflow.
+    /// Returns the same value as Lerp() whenever that does not overflow.
+    /// </summary>
+    static FP_INT LerpSat(FP_INT a, FP_INT b, FP_INT t)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::LerpSat", a, b);
+        // a*(1-t) + b*t == a + (b-a)*t, with a single rounding like in Lerp().
+        FP_LONG delta = ((FP_LONG)b - (FP_LONG)a) * (FP_LONG)t;
+        return FixedUtil::SaturateToInt((FP_LONG)a + (delta >> Shift));
+    }
+
     static FP_INT Nlz(FP_UINT x)
     {
-    #if NET5_0_OR_GREATER
-        return System.Numerics.BitOperations.LeadingZeroCount(x);
-    #else
+        //return System.Numerics.BitOperations.LeadingZeroCount(x); \note Disabled as this is slower in benchmarks
         FP_INT n = 0;
         if (x <= 0x0000FFFF) { n = n + 16; x = x << 16; }
         if (x <= 0x00FFFFFF) { n = n + 8; x = x << 8; }
@@ -289,7 +350,6 @@ namespace Fixed32
         if (x <= 0x7FFFFFFF) { n = n + 1; }
         if (x == 0) return 32;
         return n;
-    #endif
     }
 
     /// <summary>
@@ -297,6 +357,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT DivPrecise(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::DivPrecise", a, b);
         if (b == MinValue || b == 0)
             return 0;
 
@@ -309,6 +370,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Div(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Div", a, b);
         if (b == MinValue || b == 0)
         {
             FixedUtil::InvalidArgument("Fixed32.Div", "b", b);
@@ -323,6 +385,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT DivFast(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::DivFast", a, b);
         if (b == MinValue || b == 0)
         {
             FixedUtil::InvalidArgument("Fixed32.DivFast", "b", b);
@@ -340,7 +403,7 @@ namespace Fixed32
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly6(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FAST(n - ONE);
 
         // Multiply by reciprocal, apply exponent, convert back to s16.16.
         FP_INT y = FixedUtil::Qmul30(res, a);
@@ -352,6 +415,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT DivFastest(FP_INT a, FP_INT b)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::DivFastest", a, b);
         if (b == MinValue || b == 0)
         {
             FixedUtil::InvalidArgument("Fixed32.DivFastest", "b", b);
@@ -369,7 +433,7 @@ namespace Fixed32
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FASTEST(n - ONE);
 
         // Multiply by reciprocal, apply exponent, convert back to s16.16.
         FP_INT y = FixedUtil::Qmul30(res, a);
@@ -381,44 +445,19 @@ namespace Fixed32
     /// </summary>
     static FP_INT Mod(FP_INT a, FP_INT b)
     {
-        FP_INT di = a / b;
-        FP_INT ret = a - (di * b);
-        return ret;
-    }
-
-    /// <summary>
-    /// Calculates the square root of the given number.
-    /// </summary>
-    static FP_INT SqrtPrecise(FP_INT a)
-    {
-        // Adapted from https://github.com/chmike/fpsqrt
-        if (a <= 0)
+        FP_INSTRUMENT_CALL2("Fixed32::Mod", a, b);
+        if (b == 0)
         {
-            if (a < 0)
-                FixedUtil::InvalidArgument("Fixed32.SqrtPrecise", "a", a);
+            FixedUtil::InvalidArgument("Fixed32.Mod", "b", b);
             return 0;
         }
 
-        FP_UINT r = (FP_UINT)a;
-        FP_UINT b = 0x40000000;
-        FP_UINT q = 0;
-        while (b > 0x40)
-        {
-            FP_UINT t = q + b;
-            if (r >= t)
-            {
-                r -= t;
-                q = t + b;
-            }
-            r <<= 1;
-            b >>= 1;
-        }
-        q >>= 8;
-        return (FP_INT)q;
+        return a % b;
     }
 
     static FP_INT Sqrt(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Sqrt", x);
         // Return 0 for all non-positive values.
         if (x <= 0)
         {
@@ -435,7 +474,7 @@ namespace Fixed32
         FP_INT offset = 15 - Nlz((FP_UINT)x);
         FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::SqrtPoly3Lut8(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_SQRT_FULL(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? SQRT2 : ONE;
@@ -448,6 +487,7 @@ namespace Fixed32
 
     static FP_INT SqrtFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::SqrtFast", x);
         // Return 0 for all non-positive values.
         if (x <= 0)
         {
@@ -464,7 +504,7 @@ namespace Fixed32
         FP_INT offset = 15 - Nlz((FP_UINT)x);
         FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::SqrtPoly4(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_SQRT_FAST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? SQRT2 : ONE;
@@ -477,6 +517,7 @@ namespace Fixed32
 
     static FP_INT SqrtFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::SqrtFastest", x);
         // Return 0 for all non-positive values.
         if (x <= 0)
         {
@@ -493,7 +534,7 @@ namespace Fixed32
         FP_INT offset = 15 - Nlz((FP_UINT)x);
         FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::SqrtPoly3(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_SQRT_FASTEST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? SQRT2 : ONE;
@@ -504,11 +545,203 @@ namespace Fixed32
         return FixedUtil::ShiftRight(yr, 14 - offset);
     }
 
+    /// <summary>
+    /// Calculates the square root with one Newton-Raphson refinement step, rounded down to the
+    /// exact result.
+    /// </summary>
+    static FP_INT SqrtRefined(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SqrtRefined", x);
+        // Return 0 for all non-positive values.
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil::InvalidArgument("Fixed32.SqrtRefined", "x", x);
+            return 0;
+        }
+
+        // One Newton-Raphson step y = (y0 + n / y0) / 2 from the polynomial approximation (in 64 bits).
+        FP_LONG n = (FP_LONG)x << Shift;
+        FP_LONG y0 = Sqrt(x);
+        FP_LONG y = (y0 + n / y0) >> 1;
+
+        // The step never undershoots, round down to the exact square root.
+        if (y * y > n)
+            y--;
+        return (FP_INT)y;
+    }
+
+    /// <summary>
+    /// Calculates the square root of the given number. Raw values below 2^30 use SqrtRefined(),
+    /// larger ones a bit-by-bit loop.
+    /// </summary>
+    static FP_INT SqrtPrecise(FP_INT a)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SqrtPrecise", a);
+        // Adapted from https://github.com/chmike/fpsqrt
+        if (a <= 0)
+        {
+            if (a < 0)
+                FixedUtil::InvalidArgument("Fixed32.SqrtPrecise", "a", a);
+            return 0;
+        }
+
+        // Below 2^30 the loop yields the exact square root (rounded down), which SqrtRefined()
+        // computes much faster. Larger values overflow the remainder of the loop, so keep using
+        // it for them.
+        if (a < (1 << 30))
+            return SqrtRefined(a);
+
+        FP_UINT r = (FP_UINT)a;
+        FP_UINT b = 0x40000000;
+        FP_UINT q = 0;
+        while (b > 0x40)
+        {
+            FP_UINT t = q + b;
+            if (r >= t)
+            {
+                r -= t;
+                q = t + b;
+            }
+            r <<= 1;
+            b >>= 1;
+        }
+        q >>= 8;
+        return (FP_INT)q;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    static FP_INT Cbrt(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Cbrt", x);
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT CBRT2 = 1352829926; // cbrt(2.0)
+        static const FP_INT CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        FP_INT ax = (x == MinValue) ? MaxValue : Abs(x);
+        FP_INT offset = 15 - Nlz((FP_UINT)ax);
+        FP_INT n = FixedUtil::ShiftRight(ax, offset - 14);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::CbrtPoly3Lut8(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        FP_INT q = (offset + 18) / 3 - 6;
+        FP_INT r = offset - 3 * q;
+        FP_INT adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s16.16 (the adjusted value can reach 2.0, so use s3.29).
+        FP_INT yr = (FP_INT)(((FP_LONG)adjust * (FP_LONG)y) >> 31);
+        yr = FixedUtil::ShiftRight(yr, 13 - q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    static FP_INT CbrtFast(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::CbrtFast", x);
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT CBRT2 = 1352829926; // cbrt(2.0)
+        static const FP_INT CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        FP_INT ax = (x == MinValue) ? MaxValue : Abs(x);
+        FP_INT offset = 15 - Nlz((FP_UINT)ax);
+        FP_INT n = FixedUtil::ShiftRight(ax, offset - 14);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::CbrtPoly4(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        FP_INT q = (offset + 18) / 3 - 6;
+        FP_INT r = offset - 3 * q;
+        FP_INT adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s16.16 (the adjusted value can reach 2.0, so use s3.29).
+        FP_INT yr = (FP_INT)(((FP_LONG)adjust * (FP_LONG)y) >> 31);
+        yr = FixedUtil::ShiftRight(yr, 13 - q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    static FP_INT CbrtFastest(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::CbrtFastest", x);
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT CBRT2 = 1352829926; // cbrt(2.0)
+        static const FP_INT CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        FP_INT ax = (x == MinValue) ? MaxValue : Abs(x);
+        FP_INT offset = 15 - Nlz((FP_UINT)ax);
+        FP_INT n = FixedUtil::ShiftRight(ax, offset - 14);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::CbrtPoly3(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        FP_INT q = (offset + 18) / 3 - 6;
+        FP_INT r = offset - 3 * q;
+        FP_INT adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s16.16 (the adjusted value can reach 2.0, so use s3.29).
+        FP_INT yr = (FP_INT)(((FP_LONG)adjust * (FP_LONG)y) >> 31);
+        yr = FixedUtil::ShiftRight(yr, 13 - q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates Cbrt() for the first count elements of x into result.
+    /// </summary>
+    static void CbrtBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CbrtBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Cbrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFast() for the first count elements of x into result.
+    /// </summary>
+    static void CbrtFastBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CbrtFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CbrtFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFastest() for the first count elements of x into result.
+    /// </summary>
+    static void CbrtFastestBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CbrtFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CbrtFastest(x[i]);
+    }
+
     /// <summary>
     /// Calculates the reciprocal square root.
     /// </summary>
     static FP_INT RSqrt(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::RSqrt", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -524,7 +757,7 @@ namespace Fixed32
         FP_INT offset = 1 - Nlz((FP_UINT)x);
         FP_INT n = FixedUtil::ShiftRight(x, offset);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::RSqrtPoly3Lut16(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_RSQRT_FULL(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
@@ -540,6 +773,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT RSqrtFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::RSqrtFast", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -555,7 +789,7 @@ namespace Fixed32
         FP_INT offset = 1 - Nlz((FP_UINT)x);
         FP_INT n = FixedUtil::ShiftRight(x, offset);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::RSqrtPoly5(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_RSQRT_FAST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
@@ -571,6 +805,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT RSqrtFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::RSqrtFastest", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -586,7 +821,7 @@ namespace Fixed32
         FP_INT offset = 1 - Nlz((FP_UINT)x);
         FP_INT n = FixedUtil::ShiftRight(x, offset);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::RSqrtPoly3(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_RSQRT_FASTEST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
@@ -602,6 +837,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT Rcp(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Rcp", x);
         if (x == MinValue || x == 0)
         {
             FixedUtil::InvalidArgument("Fixed32.Rcp", "x", x);
@@ -619,7 +855,7 @@ namespace Fixed32
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4Lut8(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FULL(n - ONE);
 
         // Apply exponent, convert back to s16.16.
         return FixedUtil::ShiftRight(sign * res, offset);
@@ -630,6 +866,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT RcpFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::RcpFast", x);
         if (x == MinValue || x == 0)
         {
             FixedUtil::InvalidArgument("Fixed32.RcpFast", "x", x);
@@ -647,7 +884,7 @@ namespace Fixed32
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly6(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FAST(n - ONE);
         //FP_INT res = Util.RcpPoly3Lut8(n - ONE);
 
         // Apply exponent, convert back to s16.16.
@@ -659,6 +896,7 @@ namespace Fixed32
     /// </summary>
     static FP_INT RcpFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::RcpFastest", x);
         if (x == MinValue || x == 0)
         {
             FixedUtil::InvalidArgument("Fixed32.RcpFastest", "x", x);
@@ -676,25 +914,126 @@ namespace Fixed32
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FASTEST(n - ONE);
         //FP_INT res = Util.RcpPoly3Lut4(n - ONE);
 
         // Apply exponent, convert back to s16.16.
         return FixedUtil::ShiftRight(sign * res, offset);
     }
 
+    /// <summary>
+    /// Calculates AddSat() for the first count elements of a and b into result.
+    /// </summary>
+    static void AddSatBatch(FP_INT* a, FP_INT* b, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::AddSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = AddSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates SubSat() for the first count elements of a and b into result.
+    /// </summary>
+    static void SubSatBatch(FP_INT* a, FP_INT* b, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SubSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SubSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates MulSat() for the first count elements of a and b into result.
+    /// </summary>
+    static void MulSatBatch(FP_INT* a, FP_INT* b, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::MulSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = MulSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates LerpSat() for the first count elements of a, b and t into result.
+    /// </summary>
+    static void LerpSatBatch(FP_INT* a, FP_INT* b, FP_INT* t, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::LerpSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = LerpSat(a[i], b[i], t[i]);
+    }
+
+    /// <summary>
+    /// Calculates Mul() for the first count elements of a and b into result.
+    /// </summary>
+    static void MulBatch(FP_INT* a, FP_INT* b, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::MulBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Mul(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Div() for the first count elements of a and b into result.
+    /// </summary>
+    static void DivBatch(FP_INT* a, FP_INT* b, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::DivBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Div(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Sqrt() for the first count elements of x into result.
+    /// </summary>
+    static void SqrtBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SqrtBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Sqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates RSqrt() for the first count elements of x into result.
+    /// </summary>
+    static void RSqrtBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::RSqrtBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = RSqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Rcp() for the first count elements of x into result.
+    /// </summary>
+    static void RcpBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::RcpBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Rcp(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SqrtRefined() for the first count elements of x into result.
+    /// </summary>
+    static void SqrtRefinedBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SqrtRefinedBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SqrtRefined(x[i]);
+    }
+
     /// <summary>
     /// Calculates the base 2 exponent.
     /// </summary>
     static FP_INT Exp2(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp2", x);
         // Handle values that would under or overflow.
         if (x >= 15 * One) return MaxValue;
         if (x <= -16 * One) return 0;
 
         // Compute exp2 for fractional part.
         FP_INT k = (x & FractionMask) << 14;
-        FP_INT y = FixedUtil::Exp2Poly5(k);
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FULL(k);
 
         // Combine integer and fractional result, and convert back to s16.16.
         FP_INT intPart = x >> Shift;
@@ -706,13 +1045,14 @@ namespace Fixed32
     /// </summary>
     static FP_INT Exp2Fast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp2Fast", x);
         // Handle values that would under or overflow.
         if (x >= 15 * One) return MaxValue;
         if (x <= -16 * One) return 0;
 
         // Compute exp2 for fractional part.
         FP_INT k = (x & FractionMask) << 14;
-        FP_INT y = FixedUtil::Exp2Poly4(k);
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FAST(k);
 
         // Combine integer and fractional result, and convert back to s16.16.
         FP_INT intPart = x >> Shift;
@@ -724,13 +1064,14 @@ namespace Fixed32
     /// </summary>
     static FP_INT Exp2Fastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp2Fastest", x);
         // Handle values that would under or overflow.
         if (x >= 15 * One) return MaxValue;
         if (x <= -16 * One) return 0;
 
         // Compute exp2 for fractional part.
         FP_INT k = (x & FractionMask) << 14;
-        FP_INT y = FixedUtil::Exp2Poly3(k);
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FASTEST(k);
 
         // Combine integer and fractional result, and convert back to s16.16.
         FP_INT intPart = x >> Shift;
@@ -739,24 +1080,106 @@ namespace Fixed32
 
     static FP_INT Exp(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp", x);
         // e^x == 2^(x / ln(2))
         return Exp2(Mul(x, RCP_LN2));
     }
 
     static FP_INT ExpFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::ExpFast", x);
         // e^x == 2^(x / ln(2))
         return Exp2Fast(Mul(x, RCP_LN2));
     }
 
     static FP_INT ExpFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::ExpFastest", x);
         // e^x == 2^(x / ln(2))
         return Exp2Fastest(Mul(x, RCP_LN2));
     }
 
+    static FP_INT Exp10(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp10", x);
+        // 10^x == 2^(x * log2(10)), with the product kept as s33.30.
+        FP_LONG p = ((FP_LONG)x * (FP_LONG)LOG2_10) >> 15;
+
+        // Handle values that would under or overflow.
+        if (p >= ( INT64_C(15) << 30)) return MaxValue;
+        if (p <= -( INT64_C(16) << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FULL((FP_INT)(p & 0x3FFFFFFF));
+        FP_INT intPart = (FP_INT)(p >> 30);
+        return FixedUtil::ShiftRight(y, 14 - intPart);
+    }
+
+    static FP_INT Exp10Fast(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp10Fast", x);
+        // 10^x == 2^(x * log2(10)), with the product kept as s33.30.
+        FP_LONG p = ((FP_LONG)x * (FP_LONG)LOG2_10) >> 15;
+
+        // Handle values that would under or overflow.
+        if (p >= ( INT64_C(15) << 30)) return MaxValue;
+        if (p <= -( INT64_C(16) << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FAST((FP_INT)(p & 0x3FFFFFFF));
+        FP_INT intPart = (FP_INT)(p >> 30);
+        return FixedUtil::ShiftRight(y, 14 - intPart);
+    }
+
+    static FP_INT Exp10Fastest(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Exp10Fastest", x);
+        // 10^x == 2^(x * log2(10)), with the product kept as s33.30.
+        FP_LONG p = ((FP_LONG)x * (FP_LONG)LOG2_10) >> 15;
+
+        // Handle values that would under or overflow.
+        if (p >= ( INT64_C(15) << 30)) return MaxValue;
+        if (p <= -( INT64_C(16) << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FASTEST((FP_INT)(p & 0x3FFFFFFF));
+        FP_INT intPart = (FP_INT)(p >> 30);
+        return FixedUtil::ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates Exp10() for the first count elements of x into result.
+    /// </summary>
+    static void Exp10Batch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Exp10Batch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Exp10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fast() for the first count elements of x into result.
+    /// </summary>
+    static void Exp10FastBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Exp10FastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Exp10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fastest() for the first count elements of x into result.
+    /// </summary>
+    static void Exp10FastestBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Exp10FastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Exp10Fastest(x[i]);
+    }
+
     static FP_INT Log(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Log", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -771,7 +1194,7 @@ namespace Fixed32
         // Polynomial approximation.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::LogPoly5Lut8(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_LOG_FULL(n - ONE);
 
         // Combine integer and fractional parts (into s16.16).
         return offset * RCP_LOG2_E + (y >> 14);
@@ -779,6 +1202,7 @@ namespace Fixed32
 
     static FP_INT LogFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::LogFast", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -793,7 +1217,7 @@ namespace Fixed32
         // Polynomial approximation.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::LogPoly3Lut8(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_LOG_FAST(n - ONE);
 
         // Combine integer and fractional parts (into s16.16).
         return offset * RCP_LOG2_E + (y >> 14);
@@ -801,6 +1225,7 @@ namespace Fixed32
 
     static FP_INT LogFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::LogFastest", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -815,7 +1240,7 @@ namespace Fixed32
         // Polynomial approximation.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::LogPoly5(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_LOG_FASTEST(n - ONE);
 
         // Combine integer and fractional parts (into s16.16).
         return offset * RCP_LOG2_E + (y >> 14);
@@ -823,6 +1248,7 @@ namespace Fixed32
 
     static FP_INT Log2(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Log2", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -837,7 +1263,7 @@ namespace Fixed32
         // Polynomial approximation of mantissa.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::Log2Poly4Lut16(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_LOG2_FULL(n - ONE);
 
         // Combine integer and fractional parts (into s16.16).
         return (offset << Shift) + (y >> 14);
@@ -845,6 +1271,7 @@ namespace Fixed32
 
     static FP_INT Log2Fast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Log2Fast", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -859,7 +1286,7 @@ namespace Fixed32
         // Polynomial approximation of mantissa.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::Log2Poly3Lut16(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_LOG2_FAST(n - ONE);
 
         // Combine integer and fractional parts (into s16.16).
         return (offset << Shift) + (y >> 14);
@@ -867,6 +1294,7 @@ namespace Fixed32
 
     static FP_INT Log2Fastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Log2Fastest", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -881,49 +1309,375 @@ namespace Fixed32
         // Polynomial approximation of mantissa.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::Log2Poly5(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_LOG2_FASTEST(n - ONE);
 
         // Combine integer and fractional parts (into s16.16).
         return (offset << Shift) + (y >> 14);
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates the base 2 logarithm with about 18 bits of precision, by linear interpolation
+    /// of a 256-entry table (about 15 bits of relative precision near 1.0, where a short series
+    /// is used instead). Cheaper than Log2Fastest().
     /// </summary>
-    static FP_INT Pow(FP_INT x, FP_INT exponent)
+    static FP_INT Log2Ultra(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Log2Ultra", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
-            if (x < 0)
-                FixedUtil::InvalidArgument("Fixed32.Pow", "x", x);
+            FixedUtil::InvalidArgument("Fixed32.Log2Ultra", "x", x);
             return 0;
         }
 
-        return Exp(Mul(exponent, Log(x)));
+        // Close to 1.0 the result approaches zero and the table loses relative precision, so use
+        // log2(1 + e) = (e - e^2/2 + e^3/3 - e^4/4 + e^5/5) / ln(2) on e = x - 1 (as s0.32) instead.
+        FP_INT d = x - One;
+        if (d > -(One >> 4) && d < (One >> 4))
+        {
+            FP_LONG e = (FP_LONG)d * 65536;
+            FP_LONG t = 309816401; // 1 / (5 * ln(2))
+            t = -387270501 + ((e * t) >> 32); // -1 / (4 * ln(2))
+            t = 516360668 + ((e * t) >> 32); // 1 / (3 * ln(2))
+            t = -774541002 + ((e * t) >> 32); // -1 / (2 * ln(2))
+            t = 1549082005 + ((e * t) >> 32); // 1 / ln(2)
+            return (FP_INT)((e * t) >> 46);
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+
+        // Table approximation of mantissa.
+        static const FP_INT ONE = (1 << 30);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::Log2Lut256(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return offset * One + (y >> 14);
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates Log2Ultra() for the first count elements of x into result.
     /// </summary>
-    static FP_INT PowFast(FP_INT x, FP_INT exponent)
+    static void Log2UltraBatch(FP_INT* x, FP_INT* result, FP_INT count)
     {
+        FP_INSTRUMENT_CALL0("Fixed32::Log2UltraBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log2Ultra(x[i]);
+    }
+
+    static FP_INT Log10(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Log10", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
-            if (x < 0)
-                FixedUtil::InvalidArgument("Fixed32.PowFast", "x", x);
+            FixedUtil::InvalidArgument("Fixed32.Log10", "x", x);
             return 0;
         }
 
-        return ExpFast(Mul(exponent, LogFast(x)));
-    }
-
-    /// <summary>
-    /// Calculates x to the power of the exponent.
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+
+        // Polynomial approximation.
+        static const FP_INT ONE = (1 << 30);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::Log10Poly5Lut8(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return (FP_INT)(((FP_LONG)offset * LOG10_2 + ((FP_LONG)y << 2)) >> 16);
+    }
+
+    static FP_INT Log10Fast(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Log10Fast", x);
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil::InvalidArgument("Fixed32.Log10Fast", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+
+        // Polynomial approximation.
+        static const FP_INT ONE = (1 << 30);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::Log10Poly3Lut8(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return (FP_INT)(((FP_LONG)offset * LOG10_2 + ((FP_LONG)y << 2)) >> 16);
+    }
+
+    static FP_INT Log10Fastest(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Log10Fastest", x);
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil::InvalidArgument("Fixed32.Log10Fastest", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+
+        // Polynomial approximation.
+        static const FP_INT ONE = (1 << 30);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::Log10Poly5(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return (FP_INT)(((FP_LONG)offset * LOG10_2 + ((FP_LONG)y << 2)) >> 16);
+    }
+
+    /// <summary>
+    /// Calculates Log10() for the first count elements of x into result.
+    /// </summary>
+    static void Log10Batch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Log10Batch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fast() for the first count elements of x into result.
+    /// </summary>
+    static void Log10FastBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Log10FastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fastest() for the first count elements of x into result.
+    /// </summary>
+    static void Log10FastestBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Log10FastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log10Fastest(x[i]);
+    }
+
+    // x^m for x >= 0 and m >= 0 by repeated squaring. All factors are >= 1 whenever the result
+    // can overflow, so a saturated value stays saturated.
+    static FP_INT PowIntAbs(FP_INT x, FP_LONG m)
+    {
+        FP_INT r = ((m & 1) != 0) ? x : One;
+        m >>= 1;
+        while (m != 0)
+        {
+            x = MulSat(x, x);
+            if ((m & 1) != 0)
+                r = MulSat(r, x);
+            m >>= 1;
+        }
+        return r;
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike Pow(), x can be
+    /// negative. Negative powers use Rcp(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    static FP_INT PowInt(FP_INT x, FP_INT n)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::PowInt", x, n);
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil::InvalidArgument("Fixed32.PowInt", "n", n);
+            return 0;
+        }
+
+        FP_INT sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        FP_INT ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(Rcp(ax), -(FP_LONG)n));
+        return sign * Rcp(PowIntAbs(ax, -(FP_LONG)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFast(), x can be
+    /// negative. Negative powers use RcpFast(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    static FP_INT PowIntFast(FP_INT x, FP_INT n)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::PowIntFast", x, n);
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil::InvalidArgument("Fixed32.PowIntFast", "n", n);
+            return 0;
+        }
+
+        FP_INT sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        FP_INT ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFast(ax), -(FP_LONG)n));
+        return sign * RcpFast(PowIntAbs(ax, -(FP_LONG)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFastest(), x can be
+    /// negative. Negative powers use RcpFastest(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    static FP_INT PowIntFastest(FP_INT x, FP_INT n)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::PowIntFastest", x, n);
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil::InvalidArgument("Fixed32.PowIntFastest", "n", n);
+            return 0;
+        }
+
+        FP_INT sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        FP_INT ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFastest(ax), -(FP_LONG)n));
+        return sign * RcpFastest(PowIntAbs(ax, -(FP_LONG)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowInt(),
+    /// and exponents of 0.5, -0.5 and -1 with Sqrt(), RSqrt() and Rcp().
+    /// </summary>
+    static FP_INT Pow(FP_INT x, FP_INT exponent)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::Pow", x, exponent);
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil::InvalidArgument("Fixed32.Pow", "x", x);
+            return 0;
+        }
+
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return Sqrt(x);
+        if (exponent == -Half)
+            return RSqrt(x);
+        if (exponent == Neg1)
+            return Rcp(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowInt(x, (FP_INT)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) is kept as s5.26 and the product as s33.30, instead of
+        // rounding both to s16.16 (and converting to and from natural logarithms).
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+        FP_INT lg = offset * (1 << 26) + (FixedUtil::FP_KERNEL_LOG2_FULL(n - (1 << 30)) >> 4);
+        FP_LONG p = ((FP_LONG)exponent * (FP_LONG)lg) >> 12;
+
+        // Handle values that would under or overflow.
+        if (p >= ( INT64_C(15) << 30)) return MaxValue;
+        if (p <= -( INT64_C(16) << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FULL((FP_INT)(p & 0x3FFFFFFF));
+        FP_INT intPart = (FP_INT)(p >> 30);
+        return FixedUtil::ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFast(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFast(), RSqrtFast() and RcpFast().
+    /// </summary>
+    static FP_INT PowFast(FP_INT x, FP_INT exponent)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::PowFast", x, exponent);
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil::InvalidArgument("Fixed32.PowFast", "x", x);
+            return 0;
+        }
+
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFast(x);
+        if (exponent == -Half)
+            return RSqrtFast(x);
+        if (exponent == Neg1)
+            return RcpFast(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFast(x, (FP_INT)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) is kept as s5.26 and the product as s33.30, instead of
+        // rounding both to s16.16 (and converting to and from natural logarithms).
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+        FP_INT lg = offset * (1 << 26) + (FixedUtil::FP_KERNEL_LOG2_FAST(n - (1 << 30)) >> 4);
+        FP_LONG p = ((FP_LONG)exponent * (FP_LONG)lg) >> 12;
+
+        // Handle values that would under or overflow.
+        if (p >= ( INT64_C(15) << 30)) return MaxValue;
+        if (p <= -( INT64_C(16) << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FAST((FP_INT)(p & 0x3FFFFFFF));
+        FP_INT intPart = (FP_INT)(p >> 30);
+        return FixedUtil::ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFastest(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFastest(), RSqrtFastest() and RcpFastest().
     /// </summary>
     static FP_INT PowFastest(FP_INT x, FP_INT exponent)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::PowFastest", x, exponent);
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -932,7 +1686,268 @@ namespace Fixed32
             return 0;
         }
 
-        return ExpFastest(Mul(exponent, LogFastest(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFastest(x);
+        if (exponent == -Half)
+            return RSqrtFastest(x);
+        if (exponent == Neg1)
+            return RcpFastest(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFastest(x, (FP_INT)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) is kept as s5.26 and the product as s33.30, instead of
+        // rounding both to s16.16 (and converting to and from natural logarithms).
+        FP_INT offset = 15 - Nlz((FP_UINT)x);
+        FP_INT n = FixedUtil::ShiftRight(x, offset - 14);
+        FP_INT lg = offset * (1 << 26) + (FixedUtil::FP_KERNEL_LOG2_FASTEST(n - (1 << 30)) >> 4);
+        FP_LONG p = ((FP_LONG)exponent * (FP_LONG)lg) >> 12;
+
+        // Handle values that would under or overflow.
+        if (p >= ( INT64_C(15) << 30)) return MaxValue;
+        if (p <= -( INT64_C(16) << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        FP_INT y = FixedUtil::FP_KERNEL_EXP2_FASTEST((FP_INT)(p & 0x3FFFFFFF));
+        FP_INT intPart = (FP_INT)(p >> 30);
+        return FixedUtil::ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    static FP_INT Sigmoid(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Sigmoid", x);
+        // Handle values that saturate to 0 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        FP_INT y = FixedUtil::SigmoidPoly5Lut64(Abs(x) << 10) >> 14;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    static FP_INT SigmoidFast(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SigmoidFast", x);
+        // Handle values that saturate to 0 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        FP_INT y = FixedUtil::SigmoidPoly3Lut64(Abs(x) << 10) >> 14;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    static FP_INT SigmoidFastest(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SigmoidFastest", x);
+        // Handle values that saturate to 0 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        FP_INT y = FixedUtil::SigmoidPoly2Lut64(Abs(x) << 10) >> 14;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    static FP_INT Tanh(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Tanh", x);
+        // Handle values that saturate to -1 or 1.
+        if (x >= 8 * One) return One;
+        if (x <= -8 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        FP_INT y = (FixedUtil::SigmoidPoly5Lut64(Abs(x) << 11) - (1 << 29)) >> 13;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    static FP_INT TanhFast(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::TanhFast", x);
+        // Handle values that saturate to -1 or 1.
+        if (x >= 8 * One) return One;
+        if (x <= -8 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        FP_INT y = (FixedUtil::SigmoidPoly3Lut64(Abs(x) << 11) - (1 << 29)) >> 13;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    static FP_INT TanhFastest(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::TanhFastest", x);
+        // Handle values that saturate to -1 or 1.
+        if (x >= 8 * One) return One;
+        if (x <= -8 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        FP_INT y = (FixedUtil::SigmoidPoly2Lut64(Abs(x) << 11) - (1 << 29)) >> 13;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    static FP_INT Softplus(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::Softplus", x);
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 16 * One) return x;
+        if (x <= -16 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        FP_INT y = FixedUtil::SoftplusPoly5Lut64(Abs(x) << 10) >> 14;
+        return Max(x, 0) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    static FP_INT SoftplusFast(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SoftplusFast", x);
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 16 * One) return x;
+        if (x <= -16 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        FP_INT y = FixedUtil::SoftplusPoly3Lut64(Abs(x) << 10) >> 14;
+        return Max(x, 0) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    static FP_INT SoftplusFastest(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SoftplusFastest", x);
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 16 * One) return x;
+        if (x <= -16 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        FP_INT y = FixedUtil::SoftplusPoly2Lut64(Abs(x) << 10) >> 14;
+        return Max(x, 0) + y;
+    }
+
+    /// <summary>
+    /// Calculates Sigmoid() for the first count elements of x into result.
+    /// </summary>
+    static void SigmoidBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SigmoidBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Sigmoid(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFast() for the first count elements of x into result.
+    /// </summary>
+    static void SigmoidFastBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SigmoidFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SigmoidFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFastest() for the first count elements of x into result.
+    /// </summary>
+    static void SigmoidFastestBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SigmoidFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SigmoidFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Tanh() for the first count elements of x into result.
+    /// </summary>
+    static void TanhBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::TanhBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Tanh(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFast() for the first count elements of x into result.
+    /// </summary>
+    static void TanhFastBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::TanhFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = TanhFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFastest() for the first count elements of x into result.
+    /// </summary>
+    static void TanhFastestBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::TanhFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = TanhFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Softplus() for the first count elements of x into result.
+    /// </summary>
+    static void SoftplusBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SoftplusBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Softplus(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFast() for the first count elements of x into result.
+    /// </summary>
+    static void SoftplusFastBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SoftplusFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SoftplusFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFastest() for the first count elements of x into result.
+    /// </summary>
+    static void SoftplusFastestBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SoftplusFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SoftplusFastest(x[i]);
     }
 
     static FP_INT UnitSin(FP_INT z)
@@ -950,7 +1965,7 @@ namespace Fixed32
 
         // Polynomial approximation.
         FP_INT zz = FixedUtil::Qmul30(z, z);
-        FP_INT res = FixedUtil::Qmul30(FixedUtil::SinPoly4(zz), z);
+        FP_INT res = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_SIN_FULL(zz), z);
 
         // Return as s2.30.
         return res;
@@ -971,7 +1986,7 @@ namespace Fixed32
 
         // Polynomial approximation.
         FP_INT zz = FixedUtil::Qmul30(z, z);
-        FP_INT res = FixedUtil::Qmul30(FixedUtil::SinPoly3(zz), z);
+        FP_INT res = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_SIN_FAST(zz), z);
 
         // Return as s2.30.
         return res;
@@ -992,7 +2007,7 @@ namespace Fixed32
 
         // Polynomial approximation.
         FP_INT zz = FixedUtil::Qmul30(z, z);
-        FP_INT res = FixedUtil::Qmul30(FixedUtil::SinPoly2(zz), z);
+        FP_INT res = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_SIN_FASTEST(zz), z);
 
         // Return as s2.30.
         return res;
@@ -1000,6 +2015,7 @@ namespace Fixed32
 
     static FP_INT Sin(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Sin", x);
         // Map [0, 2pi] to [0, 4] (as s2.30).
         // This also wraps the values into one period.
         FP_INT z = Mul(RCP_TWO_PI, x);
@@ -1010,6 +2026,7 @@ namespace Fixed32
 
     static FP_INT SinFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::SinFast", x);
         // Map [0, 2pi] to [0, 4] (as s2.30).
         // This also wraps the values into one period.
         FP_INT z = Mul(RCP_TWO_PI, x);
@@ -1020,6 +2037,7 @@ namespace Fixed32
 
     static FP_INT SinFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::SinFastest", x);
         // Map [0, 2pi] to [0, 4] (as s2.30).
         // This also wraps the values into one period.
         FP_INT z = Mul(RCP_TWO_PI, x);
@@ -1028,42 +2046,293 @@ namespace Fixed32
         return UnitSinFastest(z) >> 14;
     }
 
+    /// <summary>
+    /// Calculates sine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than SinFastest().
+    /// </summary>
+    static FP_INT SinUltra(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinUltra", x);
+        // Map [0, 2pi] to [0, 4] (as s2.30).
+        // This also wraps the values into one period.
+        FP_INT z = Mul(RCP_TWO_PI, x);
+
+        // Interpolate sin from the table and convert back to s16.16.
+        return FixedUtil::SinLut256(z) >> 14;
+    }
+
     static FP_INT Cos(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Cos", x);
         return Sin(x + PiHalf);
     }
 
     static FP_INT CosFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::CosFast", x);
         return SinFast(x + PiHalf);
     }
 
     static FP_INT CosFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::CosFastest", x);
         return SinFastest(x + PiHalf);
     }
 
+    /// <summary>
+    /// Calculates cosine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than CosFastest().
+    /// </summary>
+    static FP_INT CosUltra(FP_INT x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::CosUltra", x);
+        return SinUltra(x + PiHalf);
+    }
+
+    /// <summary>
+    /// Calculates SinUltra() for the first count elements of x into result.
+    /// </summary>
+    static void SinUltraBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinUltraBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosUltra() for the first count elements of x into result.
+    /// </summary>
+    static void CosUltraBatch(FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CosUltraBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Advances a binary angle by a quarter turn, wrapping around at a full turn.
+    /// </summary>
+    static FP_INT AddQuarterTurn(FP_INT angle)
+    {
+        return (FP_INT)((FP_UINT)angle + (FP_UINT)(1 << 30));  // wrap without signed overflow
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full FP_INT range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    static FP_INT SinTurns(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinTurns", angle);
+        // A binary angle is the s2.30 quarter-turn value that UnitSin() takes.
+        return UnitSin(angle) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full FP_INT range is one turn.
+    /// </summary>
+    static FP_INT CosTurns(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::CosTurns", angle);
+        return UnitSin(AddQuarterTurn(angle)) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates both sine and cosine of a binary angle, where the full FP_INT range is one turn.
+    /// Not available in Java, see SinCosTurnsBatch().
+    /// </summary>
+    static void SinCosTurns(FP_INT angle, FP_INT& sinX, FP_INT& cosX)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinCosTurns", angle);
+        sinX = UnitSin(angle) >> 14;
+        cosX = UnitSin(AddQuarterTurn(angle)) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full FP_INT range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    static FP_INT SinTurnsFast(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinTurnsFast", angle);
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFast() takes.
+        return UnitSinFast(angle) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full FP_INT range is one turn.
+    /// </summary>
+    static FP_INT CosTurnsFast(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::CosTurnsFast", angle);
+        return UnitSinFast(AddQuarterTurn(angle)) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates both sine and cosine of a binary angle, where the full FP_INT range is one turn.
+    /// Not available in Java, see SinCosTurnsFastBatch().
+    /// </summary>
+    static void SinCosTurnsFast(FP_INT angle, FP_INT& sinX, FP_INT& cosX)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinCosTurnsFast", angle);
+        sinX = UnitSinFast(angle) >> 14;
+        cosX = UnitSinFast(AddQuarterTurn(angle)) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full FP_INT range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    static FP_INT SinTurnsFastest(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinTurnsFastest", angle);
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFastest() takes.
+        return UnitSinFastest(angle) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full FP_INT range is one turn.
+    /// </summary>
+    static FP_INT CosTurnsFastest(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::CosTurnsFastest", angle);
+        return UnitSinFastest(AddQuarterTurn(angle)) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates both sine and cosine of a binary angle, where the full FP_INT range is one turn.
+    /// Not available in Java, see SinCosTurnsFastestBatch().
+    /// </summary>
+    static void SinCosTurnsFastest(FP_INT angle, FP_INT& sinX, FP_INT& cosX)
+    {
+        FP_INSTRUMENT_CALL1("Fixed32::SinCosTurnsFastest", angle);
+        sinX = UnitSinFastest(angle) >> 14;
+        cosX = UnitSinFastest(AddQuarterTurn(angle)) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates SinTurns() for the first count elements of angle into result.
+    /// </summary>
+    static void SinTurnsBatch(FP_INT* angle, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinTurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurns() for the first count elements of angle into result.
+    /// </summary>
+    static void CosTurnsBatch(FP_INT* angle, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CosTurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    static void SinCosTurnsBatch(FP_INT* angle, FP_INT* sinX, FP_INT* cosX, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinCosTurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+        {
+            sinX[i] = UnitSin(angle[i]) >> 14;
+            cosX[i] = UnitSin(AddQuarterTurn(angle[i])) >> 14;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    static void SinTurnsFastBatch(FP_INT* angle, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinTurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    static void CosTurnsFastBatch(FP_INT* angle, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CosTurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    static void SinCosTurnsFastBatch(FP_INT* angle, FP_INT* sinX, FP_INT* cosX, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinCosTurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+        {
+            sinX[i] = UnitSinFast(angle[i]) >> 14;
+            cosX[i] = UnitSinFast(AddQuarterTurn(angle[i])) >> 14;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    static void SinTurnsFastestBatch(FP_INT* angle, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinTurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    static void CosTurnsFastestBatch(FP_INT* angle, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::CosTurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    static void SinCosTurnsFastestBatch(FP_INT* angle, FP_INT* sinX, FP_INT* cosX, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::SinCosTurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+        {
+            sinX[i] = UnitSinFastest(angle[i]) >> 14;
+            cosX[i] = UnitSinFastest(AddQuarterTurn(angle[i])) >> 14;
+        }
+    }
+
     static FP_INT Tan(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Tan", x);
         FP_INT z = Mul(RCP_TWO_PI, x);
         FP_INT sinX = UnitSin(z);
-        FP_INT cosX = UnitSin(z + (1 << 30));
+        FP_INT cosX = UnitSin(AddQuarterTurn(z));
         return Div(sinX, cosX);
     }
 
     static FP_INT TanFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::TanFast", x);
         FP_INT z = Mul(RCP_TWO_PI, x);
         FP_INT sinX = UnitSinFast(z);
-        FP_INT cosX = UnitSinFast(z + (1 << 30));
+        FP_INT cosX = UnitSinFast(AddQuarterTurn(z));
         return DivFast(sinX, cosX);
     }
 
     static FP_INT TanFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::TanFastest", x);
         FP_INT z = Mul(RCP_TWO_PI, x);
         FP_INT sinX = UnitSinFastest(z);
-        FP_INT cosX = UnitSinFastest(z + (1 << 30));
+        FP_INT cosX = UnitSinFastest(AddQuarterTurn(z));
         return DivFastest(sinX, cosX);
     }
 
@@ -1079,7 +2348,7 @@ namespace Fixed32
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation of reciprocal.
-        FP_INT oox = FixedUtil::RcpPoly4Lut8(n - ONE);
+        FP_INT oox = FixedUtil::FP_KERNEL_RCP_FULL(n - ONE);
         FP_ASSERT(oox >= HALF && oox <= ONE);
 
         // Apply exponent and multiply.
@@ -1089,6 +2358,7 @@ namespace Fixed32
 
     static FP_INT Atan2(FP_INT y, FP_INT x)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Atan2", y, x);
         // See: https://www.dsprelated.com/showarticle/1052.php
 
         if (x == 0)
@@ -1107,7 +2377,7 @@ namespace Fixed32
         if (nx >= ny)
         {
             FP_INT k = Atan2Div(ny, nx);
-            FP_INT z = FixedUtil::AtanPoly5Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FULL(k);
             FP_INT angle = (negMask ^ (z >> 14)) - negMask;
             if (x > 0) return angle;
             if (y >= 0) return angle + Pi;
@@ -1116,7 +2386,7 @@ namespace Fixed32
         else
         {
             FP_INT k = Atan2Div(nx, ny);
-            FP_INT z = FixedUtil::AtanPoly5Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FULL(k);
             FP_INT angle = negMask ^  (z >> 14);
             return ((y > 0) ? PiHalf : -PiHalf) - angle;
         }
@@ -1133,7 +2403,7 @@ namespace Fixed32
         FP_INT n = FixedUtil::ShiftRight(x, offset);
 
         // Polynomial approximation.
-        FP_INT oox = FixedUtil::RcpPoly6(n - ONE);
+        FP_INT oox = FixedUtil::FP_KERNEL_RCP_FAST(n - ONE);
         FP_ASSERT(oox >= HALF && oox <= ONE);
 
         // Apply exponent and multiply.
@@ -1143,6 +2413,7 @@ namespace Fixed32
 
     static FP_INT Atan2Fast(FP_INT y, FP_INT x)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Atan2Fast", y, x);
         // See: https://www.dsprelated.com/showarticle/1052.php
 
         if (x == 0)
@@ -1161,7 +2432,7 @@ namespace Fixed32
         if (nx >= ny)
         {
             FP_INT k = Atan2DivFast(ny, nx);
-            FP_INT z = FixedUtil::AtanPoly3Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FAST(k);
             FP_INT angle = negMask ^ (z >> 14);
             if (x > 0) return angle;
             if (y >= 0) return angle + Pi;
@@ -1170,7 +2441,7 @@ namespace Fixed32
         else
         {
             FP_INT k = Atan2DivFast(nx, ny);
-            FP_INT z = FixedUtil::AtanPoly3Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FAST(k);
             FP_INT angle = negMask ^ (z >> 14);
             return ((y > 0) ? PiHalf : -PiHalf) - angle;
         }
@@ -1187,7 +2458,7 @@ namespace Fixed32
         FP_INT n = FixedUtil::ShiftRight(x, offset);
 
         // Polynomial approximation.
-        FP_INT oox = FixedUtil::RcpPoly4(n - ONE);
+        FP_INT oox = FixedUtil::FP_KERNEL_RCP_FASTEST(n - ONE);
         FP_ASSERT(oox >= HALF && oox <= ONE);
 
         // Apply exponent and multiply.
@@ -1197,6 +2468,7 @@ namespace Fixed32
 
     static FP_INT Atan2Fastest(FP_INT y, FP_INT x)
     {
+        FP_INSTRUMENT_CALL2("Fixed32::Atan2Fastest", y, x);
         // See: https://www.dsprelated.com/showarticle/1052.php
 
         if (x == 0)
@@ -1215,7 +2487,7 @@ namespace Fixed32
         if (nx >= ny)
         {
             FP_INT k = Atan2DivFastest(ny, nx);
-            FP_INT z = FixedUtil::AtanPoly4(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FASTEST(k);
             FP_INT angle = negMask ^ (z >> 14);
             if (x > 0) return angle;
             if (y >= 0) return angle + Pi;
@@ -1224,14 +2496,168 @@ namespace Fixed32
         else
         {
             FP_INT k = Atan2DivFastest(nx, ny);
-            FP_INT z = FixedUtil::AtanPoly4(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FASTEST(k);
             FP_INT angle = negMask ^ (z >> 14);
             return ((y > 0) ? PiHalf : -PiHalf) - angle;
         }
     }
 
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full FP_INT range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    static FP_INT Atan2Turns(FP_INT y, FP_INT x)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::Atan2Turns", y, x);
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil::InvalidArgument("Fixed32.Atan2Turns", "y, x", y, x);
+            return 0;
+        }
+
+        FP_INT nx = Abs(x);
+        FP_INT ny = Abs(y);
+        FP_INT negMask = ((x ^ y) >> 31);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            FP_INT k = Atan2Div(ny, nx);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FULL(k), RCP_TWO_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            FP_INT k = Atan2Div(nx, ny);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FULL(k), RCP_TWO_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full FP_INT range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    static FP_INT Atan2TurnsFast(FP_INT y, FP_INT x)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::Atan2TurnsFast", y, x);
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil::InvalidArgument("Fixed32.Atan2TurnsFast", "y, x", y, x);
+            return 0;
+        }
+
+        FP_INT nx = Abs(x);
+        FP_INT ny = Abs(y);
+        FP_INT negMask = ((x ^ y) >> 31);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            FP_INT k = Atan2DivFast(ny, nx);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FAST(k), RCP_TWO_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            FP_INT k = Atan2DivFast(nx, ny);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FAST(k), RCP_TWO_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full FP_INT range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    static FP_INT Atan2TurnsFastest(FP_INT y, FP_INT x)
+    {
+        FP_INSTRUMENT_CALL2("Fixed32::Atan2TurnsFastest", y, x);
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil::InvalidArgument("Fixed32.Atan2TurnsFastest", "y, x", y, x);
+            return 0;
+        }
+
+        FP_INT nx = Abs(x);
+        FP_INT ny = Abs(y);
+        FP_INT negMask = ((x ^ y) >> 31);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            FP_INT k = Atan2DivFastest(ny, nx);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FASTEST(k), RCP_TWO_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            FP_INT k = Atan2DivFastest(nx, ny);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FASTEST(k), RCP_TWO_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates Atan2Turns() for the first count elements of y and x into result.
+    /// </summary>
+    static void Atan2TurnsBatch(FP_INT* y, FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Atan2TurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Atan2Turns(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFast() for the first count elements of y and x into result.
+    /// </summary>
+    static void Atan2TurnsFastBatch(FP_INT* y, FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Atan2TurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Atan2TurnsFast(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFastest() for the first count elements of y and x into result.
+    /// </summary>
+    static void Atan2TurnsFastestBatch(FP_INT* y, FP_INT* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed32::Atan2TurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Atan2TurnsFastest(y[i], x[i]);
+    }
+
     static FP_INT Asin(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Asin", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1247,6 +2673,7 @@ namespace Fixed32
 
     static FP_INT AsinFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::AsinFast", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1262,6 +2689,7 @@ namespace Fixed32
 
     static FP_INT AsinFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::AsinFastest", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1277,6 +2705,7 @@ namespace Fixed32
 
     static FP_INT Acos(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Acos", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1292,6 +2721,7 @@ namespace Fixed32
 
     static FP_INT AcosFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::AcosFast", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1307,6 +2737,7 @@ namespace Fixed32
 
     static FP_INT AcosFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::AcosFastest", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1322,16 +2753,19 @@ namespace Fixed32
 
     static FP_INT Atan(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::Atan", x);
         return Atan2(x, One);
     }
 
     static FP_INT AtanFast(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::AtanFast", x);
         return Atan2Fast(x, One);
     }
 
     static FP_INT AtanFastest(FP_INT x)
     {
+        FP_INSTRUMENT_CALL1("Fixed32::AtanFastest", x);
         return Atan2Fastest(x, One);
     }
 
@@ -88,6 +88,8 @@ namespace Fixed64
     // Private constants
     static const FP_LONG RCP_LN2      = INT64_C(0x171547652); // 1.0 / log(2.0) ~= 1.4426950408889634
     static const FP_LONG RCP_LOG2_E   = INT64_C(2977044471);  // 1.0 / log2(e) ~= 0.6931471805599453
+    static const FP_LONG LOG2_10      = INT64_C(14267572527); // log2(10.0) ~= 3.321928094887362
+    static const FP_LONG LOG10_2      = INT64_C(1292913986);  // log10(2.0) ~= 0.3010299956639812
     static const FP_INT  RCP_HALF_PI  = 683565276; // 1.0 / (4.0 * 0.5 * Math.PI);  // the 4.0 factor converts directly to s2.30
 
     /// <summary>
@@ -95,6 +97,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG FromInt(FP_INT v)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::FromInt", v);
         return (FP_LONG)v << Shift;
     }
 
@@ -103,6 +106,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG FromDouble(double v)
     {
+        FP_INSTRUMENT_CALL0("Fixed64::FromDouble");
         return (FP_LONG)(v * 4294967296.0);
     }
 
@@ -111,6 +115,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG FromFloat(float v)
     {
+        FP_INSTRUMENT_CALL0("Fixed64::FromFloat");
         return (FP_LONG)(v * 4294967296.0f);
     }
 
@@ -119,6 +124,7 @@ namespace Fixed64
     /// </summary>
     static FP_INT CeilToInt(FP_LONG v)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::CeilToInt", v);
         return (FP_INT)((v + (One - 1)) >> Shift);
     }
 
@@ -127,6 +133,7 @@ namespace Fixed64
     /// </summary>
     static FP_INT FloorToInt(FP_LONG v)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::FloorToInt", v);
         return (FP_INT)(v >> Shift);
     }
 
@@ -135,6 +142,7 @@ namespace Fixed64
     /// </summary>
     static FP_INT RoundToInt(FP_LONG v)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::RoundToInt", v);
         return (FP_INT)((v + Half) >> Shift);
     }
 
@@ -143,6 +151,7 @@ namespace Fixed64
     /// </summary>
     static double ToDouble(FP_LONG v)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::ToDouble", v);
         return (double)v * (1.0 / 4294967296.0);
     }
 
@@ -151,6 +160,7 @@ namespace Fixed64
     /// </summary>
     static float ToFloat(FP_LONG v)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::ToFloat", v);
         return (float)v * (1.0f / 4294967296.0f);
     }
 
@@ -163,6 +173,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Abs(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Abs", x);
         // \note fails with LONG_MIN
         FP_LONG mask = x >> 63;
         return (x + mask) ^ mask;
@@ -173,6 +184,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Nabs(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Nabs", x);
         return -Abs(x);
     }
 
@@ -181,6 +193,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Ceil(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Ceil", x);
         return (x + FractionMask) & IntegerMask;
     }
 
@@ -189,6 +202,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Floor(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Floor", x);
         return x & IntegerMask;
     }
 
@@ -197,6 +211,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Round(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Round", x);
         return (x + Half) & IntegerMask;
     }
 
@@ -205,6 +220,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Fract(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Fract", x);
         return x & FractionMask;
     }
 
@@ -213,6 +229,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Min(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Min", a, b);
         return (a < b) ? a : b;
     }
 
@@ -221,6 +238,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Max(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Max", a, b);
         return (a > b) ? a : b;
     }
 
@@ -229,6 +247,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Clamp(FP_LONG a, FP_LONG min, FP_LONG max)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Clamp", a, min);
         return (a > max) ? max : (a < min) ? min : a;
     }
 
@@ -237,6 +256,7 @@ namespace Fixed64
     /// </summary>
     static FP_INT Sign(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Sign", x);
         // https://stackoverflow.com/questions/14579920/fast-sign-of-integer-in-c/14612418#14612418
         return (FP_INT)((x >> 63) | (FP_LONG)(((FP_ULONG)-x) >> 63));
     }
@@ -246,6 +266,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Add(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Add", a, b);
         return a + b;
     }
 
@@ -254,6 +275,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Sub(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Sub", a, b);
         return a - b;
     }
 
@@ -262,6 +284,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Mul(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Mul", a, b);
         FP_LONG ai = a >> Shift;
         FP_LONG af = (a & FractionMask);
         FP_LONG bi = b >> Shift;
@@ -290,7 +313,66 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Lerp(FP_LONG a, FP_LONG b, FP_LONG t)
     {
-        return Mul(a, t) + Mul(b, One - t);
+        FP_INSTRUMENT_CALL2("Fixed64::Lerp", a, b);
+        return Mul(a, One - t) + Mul(b, t);
+    }
+
+    /// <summary>
+    /// Adds the two FP numbers together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    static FP_LONG AddSat(FP_LONG a, FP_LONG b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::AddSat", a, b);
+        FP_LONG r = (FP_LONG)((FP_ULONG)a + (FP_ULONG)b);  // wrap without signed overflow
+        FP_LONG overflow = ((a ^ r) & (b ^ r)) >> 63;  // result sign differs from both inputs
+        FP_LONG sat = (a >> 63) ^ MaxValue;
+        return (r & ~overflow) | (sat & overflow);
+    }
+
+    /// <summary>
+    /// Subtracts the two FP numbers from each other, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    static FP_LONG SubSat(FP_LONG a, FP_LONG b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::SubSat", a, b);
+        FP_LONG r = (FP_LONG)((FP_ULONG)a - (FP_ULONG)b);  // wrap without signed overflow
+        FP_LONG overflow = ((a ^ b) & (a ^ r)) >> 63;  // input signs differ and result sign differs from a
+        FP_LONG sat = (a >> 63) ^ MaxValue;
+        return (r & ~overflow) | (sat & overflow);
+    }
+
+    /// <summary>
+    /// Multiplies two FP values together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    static FP_LONG MulSat(FP_LONG a, FP_LONG b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::MulSat", a, b);
+        // High 64 bits of the full 128-bit product, from 32-bit halves.
+        FP_LONG alo = a & INT64_C(0xFFFFFFFF);
+        FP_LONG ahi = a >> 32;
+        FP_LONG blo = b & INT64_C(0xFFFFFFFF);
+        FP_LONG bhi = b >> 32;
+        // The product of the unsigned low halves can exceed MaxValue, so multiply them unsigned.
+        FP_LONG lolo = (FP_LONG)(((FP_ULONG)alo * (FP_ULONG)blo) >> 32);
+        FP_LONG mid1 = ahi * blo + lolo;
+        FP_LONG mid2 = alo * bhi + (mid1 & INT64_C(0xFFFFFFFF));
+        FP_LONG hi = ahi * bhi + (mid1 >> 32) + (mid2 >> 32);
+
+        // The result (product >> 32) fits in a FP_LONG iff hi fits in an FP_INT.
+        FP_LONG check = (hi + INT64_C(0x80000000)) >> 32;
+        FP_LONG overflow = (check | -check) >> 63;
+        FP_LONG sat = (hi >> 63) ^ MaxValue;
+        return (Mul(a, b) & ~overflow) | (sat & overflow);
+    }
+
+    /// <summary>
+    /// Linearly interpolate from a to b by t, saturating to MinValue/MaxValue on overflow.
+    /// Returns the same value as Lerp() whenever none of its terms overflow.
+    /// </summary>
+    static FP_LONG LerpSat(FP_LONG a, FP_LONG b, FP_LONG t)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::LerpSat", a, b);
+        return AddSat(MulSat(a, SubSat(One, t)), MulSat(b, t));
     }
 
     static FP_INT Nlz(FP_ULONG x)
@@ -315,7 +397,8 @@ namespace Fixed64
     /// </summary>
     static FP_LONG DivPrecise(FP_LONG arg_a, FP_LONG arg_b)
     {
-        // From http://www.hackersdelight.org/hdcodetxt/divlu.c.txt
+        FP_INSTRUMENT_CALL2("Fixed64::DivPrecise", arg_a, arg_b);
+        // From https://web.archive.org/web/20190109053731/http://www.hackersdelight.org/hdcodetxt/divlu.c.txt
 
         FP_LONG sign_dif = arg_a ^ arg_b;
 
@@ -385,6 +468,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Div(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Div", a, b);
         if (b == MinValue || b == 0)
         {
             FixedUtil::InvalidArgument("Fixed64::Div", "b", b);
@@ -402,7 +486,7 @@ namespace Fixed64
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4Lut8(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FULL(n - ONE);
 
         // Apply exponent, convert back to s32.32.
         FP_LONG y = MulIntLongLong(res, a) << 2;
@@ -414,6 +498,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG DivFast(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::DivFast", a, b);
         if (b == MinValue || b == 0)
         {
             FixedUtil::InvalidArgument("Fixed64::DivFast", "b", b);
@@ -431,7 +516,7 @@ namespace Fixed64
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly6(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FAST(n - ONE);
 
         // Apply exponent, convert back to s32.32.
         FP_LONG y = MulIntLongLong(res, a) << 2;
@@ -443,6 +528,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG DivFastest(FP_LONG a, FP_LONG b)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::DivFastest", a, b);
         if (b == MinValue || b == 0)
         {
             FixedUtil::InvalidArgument("Fixed64::DivFastest", "b", b);
@@ -460,7 +546,7 @@ namespace Fixed64
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FASTEST(n - ONE);
 
         // Apply exponent, convert back to s32.32.
         FP_LONG y = MulIntLongLong(res, a) << 2;
@@ -468,52 +554,97 @@ namespace Fixed64
     }
 
     /// <summary>
-    /// Divides two FP values and returns the modulus.
+    /// Returns (a * b) >> 62 for non-negative a and b, with b at most 2^62. The result is at
+    /// most 2 smaller than the exact value.
     /// </summary>
-    static FP_LONG Mod(FP_LONG a, FP_LONG b)
+    static FP_LONG MulHigh62(FP_LONG a, FP_LONG b)
     {
-        if (b == 0)
-        {
-            FixedUtil::InvalidArgument("Fixed64::Mod", "b", b);
+        FP_LONG ah = a >> 31;
+        FP_LONG al = a & 0x7FFFFFFF;
+        FP_LONG bh = b >> 31;
+        FP_LONG bl = b & 0x7FFFFFFF;
+        return ah * bh + ((ah * bl) >> 31) + ((al * bh) >> 31);
+    }
+
+    // Computes a / b for b != 0 and b != MinValue (see DivRefined()).
+    static FP_LONG RefinedQuotient(FP_LONG a, FP_LONG b)
+    {
+        // Handle negative values (|MinValue| is clamped to MaxValue).
+        FP_INT sign = ((a ^ b) < 0) ? -1 : 1;
+        FP_LONG ua = (a == MinValue) ? MaxValue : Abs(a);
+        FP_LONG ub = Abs(b);
+        if (ua == 0)
+            return 0;
+
+        // Saturate if the quotient does not fit in s32.32.
+        if ((ua >> 31) >= ub)
+            return (sign < 0) ? MinValue : MaxValue;
+
+        // Normalize both inputs into [1.0, 2.0( range (as s1.62).
+        FP_INT ka = Nlz((FP_ULONG)ua) - 1;
+        FP_INT kb = Nlz((FP_ULONG)ub) - 1;
+        FP_LONG ma = ua << ka;
+        FP_LONG mb = ub << kb;
+
+        // Polynomial approximation of 1 / mb (s2.30, about 24 bits), refined with one
+        // Newton-Raphson step r = r0 + r0 * (1 - mb * r0) to about 46 bits (as s1.62).
+        static const FP_INT ONE = (1 << 30);
+        FP_INT r0 = FixedUtil::FP_KERNEL_RCP_FULL((FP_INT)(mb >> 32) - ONE);
+        FP_LONG e = ( INT64_C(1) << 62) - (((mb >> 31) * r0) << 1) - (((mb & 0x7FFFFFFF) * r0) >> 30);
+        FP_LONG r = ((FP_LONG)r0 << 32) + (((FP_LONG)r0 * (e >> 10)) >> 20);
+
+        // Quotient of the mantissas (s1.62), apply exponent to convert to s32.32.
+        FP_INT shift = 30 + ka - kb;
+        if (shift >= 63)
             return 0;
+        FP_LONG q = FixedUtil::ShiftRight(MulHigh62(ma, r), shift);
+
+        // Quotients with more significant bits than the reciprocal are corrected with the
+        // residual a - q * b. Here ub is small enough for the residual to fit in 64 bits.
+        if (shift <= 22)
+        {
+            FP_LONG rem = (FP_LONG)(((FP_ULONG)ua << 32) - (FP_ULONG)q * (FP_ULONG)ub);  // wraps to the exact value
+            FP_LONG d = FixedUtil::ShiftRight(MulHigh62(Abs(rem) << 4, r), 66 - kb);
+            q += (rem < 0) ? -d : d;
         }
 
-        return a % b;
+        return sign * q;
     }
 
     /// <summary>
-    /// Calculates the square root of the given number.
+    /// Calculates division with one Newton-Raphson refinement step. Within 1 ULP of DivPrecise()
+    /// but considerably faster. Saturates to MinValue/MaxValue if the quotient overflows.
     /// </summary>
-    static FP_LONG SqrtPrecise(FP_LONG a)
+    static FP_LONG DivRefined(FP_LONG a, FP_LONG b)
     {
-        // Adapted from https://github.com/chmike/fpsqrt
-        if (a <= 0)
+        FP_INSTRUMENT_CALL2("Fixed64::DivRefined", a, b);
+        if (b == MinValue || b == 0)
         {
-            if (a < 0)
-                FixedUtil::InvalidArgument("Fixed64::SqrtPrecise", "a", a);
+            FixedUtil::InvalidArgument("Fixed64::DivRefined", "b", b);
             return 0;
         }
 
-        FP_ULONG r = (FP_ULONG)a;
-        FP_ULONG b = INT64_C(0x4000000000000000);
-        FP_ULONG q = INT64_C(0);
-        while (b > INT64_C(0x40))
+        return RefinedQuotient(a, b);
+    }
+
+    /// <summary>
+    /// Divides two FP values and returns the modulus.
+    /// </summary>
+    static FP_LONG Mod(FP_LONG a, FP_LONG b)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::Mod", a, b);
+        if (b == 0)
         {
-            FP_ULONG t = q + b;
-            if (r >= t)
-            {
-                r -= t;
-                q = t + b;
-            }
-            r <<= 1;
-            b >>= 1;
+            FixedUtil::InvalidArgument("Fixed64::Mod", "b", b);
+            return 0;
         }
-        q >>= 16;
-        return (FP_LONG)q;
+
+        return a % b;
     }
 
     static FP_LONG Sqrt(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Sqrt", x);
         // Return 0 for all non-positive values.
         if (x <= 0)
         {
@@ -530,7 +661,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::SqrtPoly3Lut8(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_SQRT_FULL(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? SQRT2 : ONE;
@@ -543,6 +674,7 @@ namespace Fixed64
 
     static FP_LONG SqrtFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::SqrtFast", x);
         // Return 0 for all non-positive values.
         if (x <= 0)
         {
@@ -559,7 +691,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::SqrtPoly4(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_SQRT_FAST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? SQRT2 : ONE;
@@ -572,6 +704,7 @@ namespace Fixed64
 
     static FP_LONG SqrtFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::SqrtFastest", x);
         // Return 0 for all non-positive values.
         if (x <= 0)
         {
@@ -588,7 +721,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::SqrtPoly3(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_SQRT_FASTEST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? SQRT2 : ONE;
@@ -599,11 +732,230 @@ namespace Fixed64
         return (offset >= 0) ? (yr << offset) : (yr >> -offset);
     }
 
+    /// <summary>
+    /// Calculates the square root with one Newton-Raphson refinement step, rounded down to the
+    /// exact result.
+    /// </summary>
+    static FP_LONG SqrtRefined(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SqrtRefined", x);
+        // Return 0 for all non-positive values.
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil::InvalidArgument("Fixed64::SqrtRefined", "x", x);
+            return 0;
+        }
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT SQRT2 = 1518500249; // sqrt(2.0)
+
+        // Normalize input into [1.0, 4.0( range (as s2.60), using an even exponent.
+        FP_INT offset = (Nlz((FP_ULONG)x) - 2) & ~1;
+        FP_LONG m = FixedUtil::ShiftRight(x, -offset);
+
+        // Polynomial approximation of sqrt(m) (as s2.30, about 23 bits).
+        FP_LONG y0 = (m >= ( INT64_C(1) << 61))
+            ? ((FP_LONG)SQRT2 * FixedUtil::FP_KERNEL_SQRT_FULL((FP_INT)(m >> 31) - ONE)) >> 30
+            : FixedUtil::FP_KERNEL_SQRT_FULL((FP_INT)(m >> 30) - ONE);
+
+        // One Newton-Raphson step y = y0 + (m - y0^2) / (2 * y0) (as s2.61). The residual is
+        // exact and only needs a rough reciprocal of y0.
+        FP_INT r = (y0 >= ( INT64_C(1) << 31)) ? (1 << 29) : FixedUtil::FP_KERNEL_RCP_FULL((FP_INT)y0 - ONE);
+        FP_LONG d = m - y0 * y0;
+        FP_LONG y = (y0 << 31) + (((d >> 10) * r) >> 20);
+
+        // Apply exponent, convert back to s32.32.
+        FP_LONG res = y >> (15 + offset / 2);
+
+        // Round down to the exact square root using the residual x - res^2 (as s0.64), which
+        // is small enough to be exact in 64 bits.
+        FP_LONG rem = (FP_LONG)(((FP_ULONG)x << 32) - (FP_ULONG)res * (FP_ULONG)res);  // wraps to the exact value
+        while (rem < 0)
+        {
+            res--;
+            rem += 2 * res + 1;
+        }
+        while (rem > 2 * res)
+        {
+            rem -= 2 * res + 1;
+            res++;
+        }
+        return res;
+    }
+
+    /// <summary>
+    /// Calculates the square root of the given number. Raw values below 2^62 use SqrtRefined(),
+    /// larger ones a bit-by-bit loop.
+    /// </summary>
+    static FP_LONG SqrtPrecise(FP_LONG a)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SqrtPrecise", a);
+        // Adapted from https://github.com/chmike/fpsqrt
+        if (a <= 0)
+        {
+            if (a < 0)
+                FixedUtil::InvalidArgument("Fixed64::SqrtPrecise", "a", a);
+            return 0;
+        }
+
+        // Below 2^62 the loop yields the exact square root (rounded down), which SqrtRefined()
+        // computes much faster. Larger values overflow the remainder of the loop, so keep using
+        // it for them.
+        if (a < ( INT64_C(1) << 62))
+            return SqrtRefined(a);
+
+        FP_ULONG r = (FP_ULONG)a;
+        FP_ULONG b = INT64_C(0x4000000000000000);
+        FP_ULONG q = INT64_C(0);
+        while (b > INT64_C(0x40))
+        {
+            FP_ULONG t = q + b;
+            if (r >= t)
+            {
+                r -= t;
+                q = t + b;
+            }
+            r <<= 1;
+            b >>= 1;
+        }
+        q >>= 16;
+        return (FP_LONG)q;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    static FP_LONG Cbrt(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Cbrt", x);
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT CBRT2 = 1352829926; // cbrt(2.0)
+        static const FP_INT CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        FP_LONG ax = (x == MinValue) ? MaxValue : Abs(x);
+        FP_INT offset = 31 - Nlz((FP_ULONG)ax);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (ax >> offset) : (ax << -offset)) >> 2);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::CbrtPoly3Lut8(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        FP_INT q = (offset + 33) / 3 - 11;
+        FP_INT r = offset - 3 * q;
+        FP_INT adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s32.32 (the adjusted value can reach 2.0).
+        FP_LONG yr = ((FP_LONG)adjust * (FP_LONG)y) >> 28;
+        yr = (q >= 0) ? (yr << q) : (yr >> -q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    static FP_LONG CbrtFast(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::CbrtFast", x);
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT CBRT2 = 1352829926; // cbrt(2.0)
+        static const FP_INT CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        FP_LONG ax = (x == MinValue) ? MaxValue : Abs(x);
+        FP_INT offset = 31 - Nlz((FP_ULONG)ax);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (ax >> offset) : (ax << -offset)) >> 2);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::CbrtPoly4(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        FP_INT q = (offset + 33) / 3 - 11;
+        FP_INT r = offset - 3 * q;
+        FP_INT adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s32.32 (the adjusted value can reach 2.0).
+        FP_LONG yr = ((FP_LONG)adjust * (FP_LONG)y) >> 28;
+        yr = (q >= 0) ? (yr << q) : (yr >> -q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    static FP_LONG CbrtFastest(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::CbrtFastest", x);
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT CBRT2 = 1352829926; // cbrt(2.0)
+        static const FP_INT CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        FP_LONG ax = (x == MinValue) ? MaxValue : Abs(x);
+        FP_INT offset = 31 - Nlz((FP_ULONG)ax);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (ax >> offset) : (ax << -offset)) >> 2);
+        FP_ASSERT(n >= ONE);
+        FP_INT y = FixedUtil::CbrtPoly3(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        FP_INT q = (offset + 33) / 3 - 11;
+        FP_INT r = offset - 3 * q;
+        FP_INT adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s32.32 (the adjusted value can reach 2.0).
+        FP_LONG yr = ((FP_LONG)adjust * (FP_LONG)y) >> 28;
+        yr = (q >= 0) ? (yr << q) : (yr >> -q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates Cbrt() for the first count elements of x into result.
+    /// </summary>
+    static void CbrtBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CbrtBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Cbrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFast() for the first count elements of x into result.
+    /// </summary>
+    static void CbrtFastBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CbrtFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CbrtFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFastest() for the first count elements of x into result.
+    /// </summary>
+    static void CbrtFastestBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CbrtFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CbrtFastest(x[i]);
+    }
+
     /// <summary>
     /// Calculates the reciprocal square root.
     /// </summary>
     static FP_LONG RSqrt(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::RSqrt", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -619,7 +971,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::RSqrtPoly3Lut16(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_RSQRT_FULL(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
@@ -635,6 +987,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG RSqrtFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::RSqrtFast", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -650,7 +1003,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::RSqrtPoly5(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_RSQRT_FAST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
@@ -666,6 +1019,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG RSqrtFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::RSqrtFastest", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -681,7 +1035,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_INT y = FixedUtil::RSqrtPoly3(n - ONE);
+        FP_INT y = FixedUtil::FP_KERNEL_RSQRT_FASTEST(n - ONE);
 
         // Divide offset by 2 (to get sqrt), compute adjust value for odd exponents.
         FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
@@ -697,6 +1051,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Rcp(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Rcp", x);
         if (x == MinValue || x == 0)
         {
             FixedUtil::InvalidArgument("Fixed64::Rcp", "x", x);
@@ -714,7 +1069,7 @@ namespace Fixed64
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4Lut8(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FULL(n - ONE);
         FP_LONG y = (FP_LONG)(sign * res) << 2;
 
         // Apply exponent, convert back to s32.32.
@@ -726,6 +1081,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG RcpFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::RcpFast", x);
         if (x == MinValue || x == 0)
         {
             FixedUtil::InvalidArgument("Fixed64::RcpFast", "x", x);
@@ -743,7 +1099,7 @@ namespace Fixed64
         FP_ASSERT(n >= ONE);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly6(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FAST(n - ONE);
         FP_LONG y = (FP_LONG)(sign * res) << 2;
 
         // Apply exponent, convert back to s32.32.
@@ -755,6 +1111,7 @@ namespace Fixed64
     /// </summary>
     static FP_LONG RcpFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::RcpFastest", x);
         if (x == MinValue || x == 0)
         {
             FixedUtil::InvalidArgument("Fixed64::RcpFastest", "x", x);
@@ -772,25 +1129,163 @@ namespace Fixed64
         //FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
 
         // Polynomial approximation.
-        FP_INT res = FixedUtil::RcpPoly4(n - ONE);
+        FP_INT res = FixedUtil::FP_KERNEL_RCP_FASTEST(n - ONE);
         FP_LONG y = (FP_LONG)(sign * res) << 2;
 
         // Apply exponent, convert back to s32.32.
         return FixedUtil::ShiftRight(y, offset);
     }
 
+    /// <summary>
+    /// Calculates reciprocal with one Newton-Raphson refinement step. Within 1 ULP of
+    /// DivPrecise(One, x) but considerably faster. Saturates to MinValue/MaxValue if the
+    /// result overflows.
+    /// </summary>
+    static FP_LONG RcpRefined(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::RcpRefined", x);
+        if (x == MinValue || x == 0)
+        {
+            FixedUtil::InvalidArgument("Fixed64::RcpRefined", "x", x);
+            return 0;
+        }
+
+        return RefinedQuotient(One, x);
+    }
+
+    /// <summary>
+    /// Calculates AddSat() for the first count elements of a and b into result.
+    /// </summary>
+    static void AddSatBatch(FP_LONG* a, FP_LONG* b, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::AddSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = AddSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates SubSat() for the first count elements of a and b into result.
+    /// </summary>
+    static void SubSatBatch(FP_LONG* a, FP_LONG* b, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SubSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SubSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates MulSat() for the first count elements of a and b into result.
+    /// </summary>
+    static void MulSatBatch(FP_LONG* a, FP_LONG* b, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::MulSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = MulSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates LerpSat() for the first count elements of a, b and t into result.
+    /// </summary>
+    static void LerpSatBatch(FP_LONG* a, FP_LONG* b, FP_LONG* t, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::LerpSatBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = LerpSat(a[i], b[i], t[i]);
+    }
+
+    /// <summary>
+    /// Calculates Mul() for the first count elements of a and b into result.
+    /// </summary>
+    static void MulBatch(FP_LONG* a, FP_LONG* b, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::MulBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Mul(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Div() for the first count elements of a and b into result.
+    /// </summary>
+    static void DivBatch(FP_LONG* a, FP_LONG* b, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::DivBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Div(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Sqrt() for the first count elements of x into result.
+    /// </summary>
+    static void SqrtBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SqrtBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Sqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates RSqrt() for the first count elements of x into result.
+    /// </summary>
+    static void RSqrtBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::RSqrtBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = RSqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Rcp() for the first count elements of x into result.
+    /// </summary>
+    static void RcpBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::RcpBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Rcp(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates DivRefined() for the first count elements of a and b into result.
+    /// </summary>
+    static void DivRefinedBatch(FP_LONG* a, FP_LONG* b, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::DivRefinedBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = DivRefined(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates SqrtRefined() for the first count elements of x into result.
+    /// </summary>
+    static void SqrtRefinedBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SqrtRefinedBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SqrtRefined(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates RcpRefined() for the first count elements of x into result.
+    /// </summary>
+    static void RcpRefinedBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::RcpRefinedBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = RcpRefined(x[i]);
+    }
+
     /// <summary>
     /// Calculates the base 2 exponent.
     /// </summary>
     static FP_LONG Exp2(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Exp2", x);
         // Handle values that would under or overflow.
         if (x >= 32 * One) return MaxValue;
         if (x <= -32 * One) return 0;
 
         // Compute exp2 for fractional part.
         FP_INT k = (FP_INT)((x & FractionMask) >> 2);
-        FP_LONG y = (FP_LONG)FixedUtil::Exp2Poly5(k) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_EXP2_FULL(k) << 2;
 
         // Combine integer and fractional result, and convert back to s32.32.
         FP_INT intPart = (FP_INT)(x >> Shift);
@@ -802,13 +1297,14 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Exp2Fast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Exp2Fast", x);
         // Handle values that would under or overflow.
         if (x >= 32 * One) return MaxValue;
         if (x <= -32 * One) return 0;
 
         // Compute exp2 for fractional part.
         FP_INT k = (FP_INT)((x & FractionMask) >> 2);
-        FP_LONG y = (FP_LONG)FixedUtil::Exp2Poly4(k) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_EXP2_FAST(k) << 2;
 
         // Combine integer and fractional result, and convert back to s32.32.
         FP_INT intPart = (FP_INT)(x >> Shift);
@@ -820,13 +1316,14 @@ namespace Fixed64
     /// </summary>
     static FP_LONG Exp2Fastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Exp2Fastest", x);
         // Handle values that would under or overflow.
         if (x >= 32 * One) return MaxValue;
         if (x <= -32 * One) return 0;
 
         // Compute exp2 for fractional part.
         FP_INT k = (FP_INT)((x & FractionMask) >> 2);
-        FP_LONG y = (FP_LONG)FixedUtil::Exp2Poly3(k) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_EXP2_FASTEST(k) << 2;
 
         // Combine integer and fractional result, and convert back to s32.32.
         FP_INT intPart = (FP_INT)(x >> Shift);
@@ -835,27 +1332,82 @@ namespace Fixed64
 
     static FP_LONG Exp(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Exp", x);
         // e^x == 2^(x / ln(2))
         return Exp2(Mul(x, RCP_LN2));
     }
 
     static FP_LONG ExpFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::ExpFast", x);
         // e^x == 2^(x / ln(2))
         return Exp2Fast(Mul(x, RCP_LN2));
     }
 
     static FP_LONG ExpFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::ExpFastest", x);
         // e^x == 2^(x / ln(2))
         return Exp2Fastest(Mul(x, RCP_LN2));
     }
 
-    // Natural logarithm (base e).
-    static FP_LONG Log(FP_LONG x)
+    static FP_LONG Exp10(FP_LONG x)
     {
-        // Return 0 for invalid values
-        if (x <= 0)
+        FP_INSTRUMENT_CALL1("Fixed64::Exp10", x);
+        // 10^x == 2^(x * log2(10))
+        return Exp2(MulSat(x, LOG2_10));
+    }
+
+    static FP_LONG Exp10Fast(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Exp10Fast", x);
+        // 10^x == 2^(x * log2(10))
+        return Exp2Fast(MulSat(x, LOG2_10));
+    }
+
+    static FP_LONG Exp10Fastest(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Exp10Fastest", x);
+        // 10^x == 2^(x * log2(10))
+        return Exp2Fastest(MulSat(x, LOG2_10));
+    }
+
+    /// <summary>
+    /// Calculates Exp10() for the first count elements of x into result.
+    /// </summary>
+    static void Exp10Batch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Exp10Batch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Exp10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fast() for the first count elements of x into result.
+    /// </summary>
+    static void Exp10FastBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Exp10FastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Exp10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fastest() for the first count elements of x into result.
+    /// </summary>
+    static void Exp10FastestBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Exp10FastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Exp10Fastest(x[i]);
+    }
+
+    // Natural logarithm (base e).
+    static FP_LONG Log(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Log", x);
+        // Return 0 for invalid values
+        if (x <= 0)
         {
             FixedUtil::InvalidArgument("Fixed64::Log", "x", x);
             return 0;
@@ -866,7 +1418,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_LONG y = (FP_LONG)FixedUtil::LogPoly5Lut8(n - ONE) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_LOG_FULL(n - ONE) << 2;
 
         // Combine integer and fractional parts (into s32.32).
         return (FP_LONG)offset * RCP_LOG2_E + y;
@@ -874,6 +1426,7 @@ namespace Fixed64
 
     static FP_LONG LogFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::LogFast", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -886,7 +1439,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_LONG y = (FP_LONG)FixedUtil::LogPoly3Lut8(n - ONE) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_LOG_FAST(n - ONE) << 2;
 
         // Combine integer and fractional parts (into s32.32).
         return (FP_LONG)offset * RCP_LOG2_E + y;
@@ -894,6 +1447,7 @@ namespace Fixed64
 
     static FP_LONG LogFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::LogFastest", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -906,7 +1460,7 @@ namespace Fixed64
         FP_INT offset = 31 - Nlz((FP_ULONG)x);
         FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
         FP_ASSERT(n >= ONE);
-        FP_LONG y = (FP_LONG)FixedUtil::LogPoly5(n - ONE) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_LOG_FASTEST(n - ONE) << 2;
 
         // Combine integer and fractional parts (into s32.32).
         return (FP_LONG)offset * RCP_LOG2_E + y;
@@ -914,6 +1468,7 @@ namespace Fixed64
 
     static FP_LONG Log2(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Log2", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -928,7 +1483,7 @@ namespace Fixed64
         // Polynomial approximation of mantissa.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_LONG y = (FP_LONG)FixedUtil::Log2Poly4Lut16(n - ONE) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_LOG2_FULL(n - ONE) << 2;
 
         // Combine integer and fractional parts (into s32.32).
         return ((FP_LONG)offset << Shift) + y;
@@ -936,6 +1491,7 @@ namespace Fixed64
 
     static FP_LONG Log2Fast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Log2Fast", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -950,7 +1506,7 @@ namespace Fixed64
         // Polynomial approximation of mantissa.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_LONG y = (FP_LONG)FixedUtil::Log2Poly3Lut16(n - ONE) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_LOG2_FAST(n - ONE) << 2;
 
         // Combine integer and fractional parts (into s32.32).
         return ((FP_LONG)offset << Shift) + y;
@@ -958,6 +1514,7 @@ namespace Fixed64
 
     static FP_LONG Log2Fastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Log2Fastest", x);
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -972,17 +1529,335 @@ namespace Fixed64
         // Polynomial approximation of mantissa.
         static const FP_INT ONE = (1 << 30);
         FP_ASSERT(n >= ONE);
-        FP_LONG y = (FP_LONG)FixedUtil::Log2Poly5(n - ONE) << 2;
+        FP_LONG y = (FP_LONG)FixedUtil::FP_KERNEL_LOG2_FASTEST(n - ONE) << 2;
 
         // Combine integer and fractional parts (into s32.32).
         return ((FP_LONG)offset << Shift) + y;
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates the base 2 logarithm with about 18 bits of precision, by linear interpolation
+    /// of a 256-entry table (about 15 bits of relative precision near 1.0, where a short series
+    /// is used instead). Cheaper than Log2Fastest().
+    /// </summary>
+    static FP_LONG Log2Ultra(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Log2Ultra", x);
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil::InvalidArgument("Fixed64::Log2Ultra", "x", x);
+            return 0;
+        }
+
+        // Close to 1.0 the result approaches zero and the table loses relative precision, so use
+        // log2(1 + e) = (e - e^2/2 + e^3/3 - e^4/4 + e^5/5) / ln(2) on e = x - 1 (as s0.32) instead.
+        FP_LONG e = x - One;
+        if (e > -(One >> 4) && e < (One >> 4))
+        {
+            FP_LONG t = 309816401; // 1 / (5 * ln(2))
+            t = -387270501 + ((e * t) >> 32); // -1 / (4 * ln(2))
+            t = 516360668 + ((e * t) >> 32); // 1 / (3 * ln(2))
+            t = -774541002 + ((e * t) >> 32); // -1 / (2 * ln(2))
+            t = 1549082005 + ((e * t) >> 32); // 1 / ln(2)
+            return (e * t) >> 30;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        FP_INT offset = 31 - Nlz((FP_ULONG)x);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+
+        // Table approximation of mantissa.
+        static const FP_INT ONE = (1 << 30);
+        FP_ASSERT(n >= ONE);
+        FP_LONG y = (FP_LONG)FixedUtil::Log2Lut256(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return offset * One + y;
+    }
+
+    /// <summary>
+    /// Calculates Log2Ultra() for the first count elements of x into result.
+    /// </summary>
+    static void Log2UltraBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Log2UltraBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log2Ultra(x[i]);
+    }
+
+    static FP_LONG Log10(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Log10", x);
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil::InvalidArgument("Fixed64::Log10", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        static const FP_INT ONE = (1 << 30);
+        FP_INT offset = 31 - Nlz((FP_ULONG)x);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        FP_ASSERT(n >= ONE);
+        FP_LONG y = (FP_LONG)FixedUtil::Log10Poly5Lut8(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return (FP_LONG)offset * LOG10_2 + y;
+    }
+
+    static FP_LONG Log10Fast(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Log10Fast", x);
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil::InvalidArgument("Fixed64::Log10Fast", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        static const FP_INT ONE = (1 << 30);
+        FP_INT offset = 31 - Nlz((FP_ULONG)x);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        FP_ASSERT(n >= ONE);
+        FP_LONG y = (FP_LONG)FixedUtil::Log10Poly3Lut8(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return (FP_LONG)offset * LOG10_2 + y;
+    }
+
+    static FP_LONG Log10Fastest(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Log10Fastest", x);
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil::InvalidArgument("Fixed64::Log10Fastest", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        static const FP_INT ONE = (1 << 30);
+        FP_INT offset = 31 - Nlz((FP_ULONG)x);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        FP_ASSERT(n >= ONE);
+        FP_LONG y = (FP_LONG)FixedUtil::Log10Poly5(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return (FP_LONG)offset * LOG10_2 + y;
+    }
+
+    /// <summary>
+    /// Calculates Log10() for the first count elements of x into result.
+    /// </summary>
+    static void Log10Batch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Log10Batch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fast() for the first count elements of x into result.
+    /// </summary>
+    static void Log10FastBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Log10FastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fastest() for the first count elements of x into result.
+    /// </summary>
+    static void Log10FastestBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Log10FastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Log10Fastest(x[i]);
+    }
+
+    // x^m for x >= 0 and m >= 0 by repeated squaring. All factors are >= 1 whenever the result
+    // can overflow, so a saturated value stays saturated.
+    static FP_LONG PowIntAbs(FP_LONG x, FP_LONG m)
+    {
+        FP_LONG r = ((m & 1) != 0) ? x : One;
+        m >>= 1;
+        while (m != 0)
+        {
+            x = MulSat(x, x);
+            if ((m & 1) != 0)
+                r = MulSat(r, x);
+            m >>= 1;
+        }
+        return r;
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike Pow(), x can be
+    /// negative. Negative powers use Rcp(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    static FP_LONG PowInt(FP_LONG x, FP_INT n)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::PowInt", x, n);
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil::InvalidArgument("Fixed64::PowInt", "n", n);
+            return 0;
+        }
+
+        FP_LONG sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        FP_LONG ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(Rcp(ax), -(FP_LONG)n));
+        return sign * Rcp(PowIntAbs(ax, -(FP_LONG)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFast(), x can be
+    /// negative. Negative powers use RcpFast(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    static FP_LONG PowIntFast(FP_LONG x, FP_INT n)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::PowIntFast", x, n);
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil::InvalidArgument("Fixed64::PowIntFast", "n", n);
+            return 0;
+        }
+
+        FP_LONG sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        FP_LONG ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFast(ax), -(FP_LONG)n));
+        return sign * RcpFast(PowIntAbs(ax, -(FP_LONG)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFastest(), x can be
+    /// negative. Negative powers use RcpFastest(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    static FP_LONG PowIntFastest(FP_LONG x, FP_INT n)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::PowIntFastest", x, n);
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil::InvalidArgument("Fixed64::PowIntFastest", "n", n);
+            return 0;
+        }
+
+        FP_LONG sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        FP_LONG ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFastest(ax), -(FP_LONG)n));
+        return sign * RcpFastest(PowIntAbs(ax, -(FP_LONG)n));
+    }
+
+    // Log2Wide() reduces the mantissa m in [1 + i/64, 1 + (i+1)/64( to m * r - 1, where r is
+    // Log2WideRcpTable[i] / 1024 (close to the reciprocal of the interval midpoint), and
+    // Log2WideTable[i] is -log2(r) as s13.50.
+    static FP_INT Log2WideRcpTable[] =
+    {
+        1016, 1001, 986, 971, 957, 943, 930, 917, 904, 892, 880, 868, 857, 846, 835, 824,
+        814, 804, 794, 785, 776, 767, 758, 749, 741, 732, 724, 716, 708, 701, 694, 686,
+        679, 672, 665, 659, 652, 646, 639, 633, 627, 621, 615, 610, 604, 599, 593, 588,
+        583, 577, 572, 567, 563, 558, 553, 548, 544, 539, 535, 531, 526, 522, 518, 514,
+    };
+
+    static FP_LONG Log2WideTable[] =
+    {
+        INT64_C(12739910109114), INT64_C(36899952123439), INT64_C(61424779539800), INT64_C(86325577023921),
+        INT64_C(109915849505706), INT64_C(133853780600797), INT64_C(156402239599007), INT64_C(179268120991617),
+        INT64_C(202460489465084), INT64_C(224166784132086), INT64_C(246167078174630), INT64_C(268469445177499),
+        INT64_C(289185821441394), INT64_C(310169827108682), INT64_C(331428467647269), INT64_C(352969027239626),
+        INT64_C(372802365368826), INT64_C(392880868394535), INT64_C(413210673347539), INT64_C(431727621067932),
+        INT64_C(450458093710443), INT64_C(469407073229532), INT64_C(488579717997901), INT64_C(507981371235725),
+        INT64_C(525424010923084), INT64_C(545273506959864), INT64_C(563123469139974), INT64_C(581171768291806),
+        INT64_C(599422861565083), INT64_C(615562542235566), INT64_C(631864200901458), INT64_C(650697225927101),
+        INT64_C(667357169019477), INT64_C(684189757083279), INT64_C(701198605818097), INT64_C(715920732690888),
+        INT64_C(733266910480454), INT64_C(748283937736819), INT64_C(765981095648219), INT64_C(781305079227158),
+        INT64_C(796775007702725), INT64_C(812393687771805), INT64_C(828164007882271), INT64_C(841423919984538),
+        INT64_C(857480033045678), INT64_C(870982440073696), INT64_C(887334895752236), INT64_C(901088832392313),
+        INT64_C(914960225079413), INT64_C(931763790921570), INT64_C(945900783657030), INT64_C(960161895563393),
+        INT64_C(971661626513226), INT64_C(986151733416957), INT64_C(1000772266078475), INT64_C(1015525593769779),
+        INT64_C(1027425502026676), INT64_C(1042424040836402), INT64_C(1054523390725611), INT64_C(1066713543339329),
+        INT64_C(1082081020424012), INT64_C(1094480547904240), INT64_C(1106975457302149), INT64_C(1119567227429205),
+    };
+
+    /// <summary>
+    /// Calculates log2(x) as s13.50 for Pow(), with a precision of about 39 bits (wider than the
+    /// s2.30 kernels of Log2() can provide).
+    /// </summary>
+    static FP_LONG Log2Wide(FP_LONG x)
+    {
+        // Normalize value to range [1.0, 2.0( as s23.40 and extract exponent.
+        FP_INT nlz = Nlz((FP_ULONG)x);
+        FP_LONG m = (nlz >= 23) ? (x << (nlz - 23)) : (x >> (23 - nlz));
+        FP_INT offset = 31 - nlz;
+
+        // z = m * r - 1 is exact (as s13.50) and |z| < 2^-6.9.
+        static const FP_LONG ONE = INT64_C(1) << 50;
+        FP_INT i = (FP_INT)(m >> 34) & 63;
+        FP_LONG z = m * Log2WideRcpTable[i] - ONE;
+
+        // ln(1 + z) = z - z^2/2 + z^3/3 - z^4/4 + z^5/5, where (Mul(a, b) >> 18) multiplies two s13.50 values.
+        FP_LONG t = INT64_C(225179981368525); // 1/5
+        t = INT64_C(-281474976710656) + (Mul(z, t) >> 18); // -1/4
+        t = INT64_C(375299968947541) + (Mul(z, t) >> 18); // 1/3
+        t = INT64_C(-562949953421312) + (Mul(z, t) >> 18); // -1/2
+        t = ONE + (Mul(z, t) >> 18);
+        FP_LONG lnz = Mul(z, t) >> 18;
+
+        // log2(x) = offset - log2(r) + ln(1 + z) / ln(2), where 1/ln(2) is s32.32.
+        return offset * ONE + Log2WideTable[i] + Mul(lnz, INT64_C(6196328019));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowInt(),
+    /// and exponents of 0.5, -0.5 and -1 with Sqrt(), RSqrt() and Rcp().
     /// </summary>
     static FP_LONG Pow(FP_LONG x, FP_LONG exponent)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Pow", x, exponent);
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -991,14 +1866,33 @@ namespace Fixed64
             return 0;
         }
 
-        return Exp(Mul(exponent, Log(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return Sqrt(x);
+        if (exponent == -Half)
+            return RSqrt(x);
+        if (exponent == Neg1)
+            return Rcp(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowInt(x, (FP_INT)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) and the product are kept as s13.50, so that the error of
+        // the logarithm is not multiplied by the exponent (and without converting to and from
+        // natural logarithms).
+        return Exp2(MulSat(exponent, Log2Wide(x)) >> 18);
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFast(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFast(), RSqrtFast() and RcpFast().
     /// </summary>
     static FP_LONG PowFast(FP_LONG x, FP_LONG exponent)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::PowFast", x, exponent);
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -1007,14 +1901,31 @@ namespace Fixed64
             return 0;
         }
 
-        return ExpFast(Mul(exponent, LogFast(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFast(x);
+        if (exponent == -Half)
+            return RSqrtFast(x);
+        if (exponent == Neg1)
+            return RcpFast(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFast(x, (FP_INT)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)), without the rounding of converting to and from natural logarithms.
+        return Exp2Fast(MulSat(exponent, Log2Fast(x)));
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFastest(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFastest(), RSqrtFastest() and RcpFastest().
     /// </summary>
     static FP_LONG PowFastest(FP_LONG x, FP_LONG exponent)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::PowFastest", x, exponent);
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -1023,7 +1934,255 @@ namespace Fixed64
             return 0;
         }
 
-        return ExpFastest(Mul(exponent, LogFastest(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFastest(x);
+        if (exponent == -Half)
+            return RSqrtFastest(x);
+        if (exponent == Neg1)
+            return RcpFastest(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFastest(x, (FP_INT)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)), without the rounding of converting to and from natural logarithms.
+        return Exp2Fastest(MulSat(exponent, Log2Fastest(x)));
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    static FP_LONG Sigmoid(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Sigmoid", x);
+        // Handle values that saturate to 0 or 1.
+        if (x >= 32 * One) return One;
+        if (x <= -32 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        FP_LONG y = (FP_LONG)FixedUtil::SigmoidPoly5Lut64((FP_INT)(Abs(x) >> 6)) << 2;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    static FP_LONG SigmoidFast(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SigmoidFast", x);
+        // Handle values that saturate to 0 or 1.
+        if (x >= 32 * One) return One;
+        if (x <= -32 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        FP_LONG y = (FP_LONG)FixedUtil::SigmoidPoly3Lut64((FP_INT)(Abs(x) >> 6)) << 2;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    static FP_LONG SigmoidFastest(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SigmoidFastest", x);
+        // Handle values that saturate to 0 or 1.
+        if (x >= 32 * One) return One;
+        if (x <= -32 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        FP_LONG y = (FP_LONG)FixedUtil::SigmoidPoly2Lut64((FP_INT)(Abs(x) >> 6)) << 2;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    static FP_LONG Tanh(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Tanh", x);
+        // Handle values that saturate to -1 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        FP_LONG y = (FP_LONG)(FixedUtil::SigmoidPoly5Lut64((FP_INT)(Abs(x) >> 5)) - (1 << 29)) << 3;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    static FP_LONG TanhFast(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::TanhFast", x);
+        // Handle values that saturate to -1 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        FP_LONG y = (FP_LONG)(FixedUtil::SigmoidPoly3Lut64((FP_INT)(Abs(x) >> 5)) - (1 << 29)) << 3;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    static FP_LONG TanhFastest(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::TanhFastest", x);
+        // Handle values that saturate to -1 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        FP_LONG y = (FP_LONG)(FixedUtil::SigmoidPoly2Lut64((FP_INT)(Abs(x) >> 5)) - (1 << 29)) << 3;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    static FP_LONG Softplus(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::Softplus", x);
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 32 * One) return x;
+        if (x <= -32 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        FP_LONG y = (FP_LONG)FixedUtil::SoftplusPoly5Lut64((FP_INT)(Abs(x) >> 6)) << 2;
+        return Max(x, Zero) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    static FP_LONG SoftplusFast(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SoftplusFast", x);
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 32 * One) return x;
+        if (x <= -32 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        FP_LONG y = (FP_LONG)FixedUtil::SoftplusPoly3Lut64((FP_INT)(Abs(x) >> 6)) << 2;
+        return Max(x, Zero) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    static FP_LONG SoftplusFastest(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SoftplusFastest", x);
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 32 * One) return x;
+        if (x <= -32 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        FP_LONG y = (FP_LONG)FixedUtil::SoftplusPoly2Lut64((FP_INT)(Abs(x) >> 6)) << 2;
+        return Max(x, Zero) + y;
+    }
+
+    /// <summary>
+    /// Calculates Sigmoid() for the first count elements of x into result.
+    /// </summary>
+    static void SigmoidBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SigmoidBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Sigmoid(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFast() for the first count elements of x into result.
+    /// </summary>
+    static void SigmoidFastBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SigmoidFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SigmoidFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFastest() for the first count elements of x into result.
+    /// </summary>
+    static void SigmoidFastestBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SigmoidFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SigmoidFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Tanh() for the first count elements of x into result.
+    /// </summary>
+    static void TanhBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::TanhBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Tanh(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFast() for the first count elements of x into result.
+    /// </summary>
+    static void TanhFastBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::TanhFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = TanhFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFastest() for the first count elements of x into result.
+    /// </summary>
+    static void TanhFastestBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::TanhFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = TanhFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Softplus() for the first count elements of x into result.
+    /// </summary>
+    static void SoftplusBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SoftplusBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Softplus(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFast() for the first count elements of x into result.
+    /// </summary>
+    static void SoftplusFastBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SoftplusFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SoftplusFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFastest() for the first count elements of x into result.
+    /// </summary>
+    static void SoftplusFastestBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SoftplusFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SoftplusFastest(x[i]);
     }
 
     static FP_INT UnitSin(FP_INT z)
@@ -1041,7 +2200,7 @@ namespace Fixed64
 
         // Polynomial approximation.
         FP_INT zz = FixedUtil::Qmul30(z, z);
-        FP_INT res = FixedUtil::Qmul30(FixedUtil::SinPoly4(zz), z);
+        FP_INT res = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_SIN_FULL(zz), z);
 
         // Return s2.30 value.
         return res;
@@ -1062,7 +2221,7 @@ namespace Fixed64
 
         // Polynomial approximation.
         FP_INT zz = FixedUtil::Qmul30(z, z);
-        FP_INT res = FixedUtil::Qmul30(FixedUtil::SinPoly3(zz), z);
+        FP_INT res = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_SIN_FAST(zz), z);
 
         // Return s2.30 value.
         return res;
@@ -1083,7 +2242,7 @@ namespace Fixed64
 
         // Polynomial approximation.
         FP_INT zz = FixedUtil::Qmul30(z, z);
-        FP_INT res = FixedUtil::Qmul30(FixedUtil::SinPoly2(zz), z);
+        FP_INT res = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_SIN_FASTEST(zz), z);
 
         // Return s2.30 value.
         return res;
@@ -1091,70 +2250,325 @@ namespace Fixed64
 
     static FP_LONG Sin(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Sin", x);
         // Map [0, 2pi] to [0, 4] (as s2.30).
         // This also wraps the values into one period.
         FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
 
         // Compute sine and convert to s32.32.
-        return (FP_LONG)UnitSin(z) << 2;
+        return (FP_LONG)UnitSin(z) * 4;
     }
 
     static FP_LONG SinFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::SinFast", x);
         // Map [0, 2pi] to [0, 4] (as s2.30).
         // This also wraps the values into one period.
         FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
 
         // Compute sine and convert to s32.32.
-        return (FP_LONG)UnitSinFast(z) << 2;
+        return (FP_LONG)UnitSinFast(z) * 4;
     }
 
     static FP_LONG SinFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::SinFastest", x);
         // Map [0, 2pi] to [0, 4] (as s2.30).
         // This also wraps the values into one period.
         FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
 
         // Compute sine and convert to s32.32.
-        return (FP_LONG)UnitSinFastest(z) << 2;
+        return (FP_LONG)UnitSinFastest(z) * 4;
+    }
+
+    /// <summary>
+    /// Calculates sine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than SinFastest().
+    /// </summary>
+    static FP_LONG SinUltra(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinUltra", x);
+        // Map [0, 2pi] to [0, 4] (as s2.30).
+        // This also wraps the values into one period.
+        FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
+
+        // Interpolate sine from the table and convert to s32.32.
+        return (FP_LONG)FixedUtil::SinLut256(z) * 4;
     }
 
     static FP_LONG Cos(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Cos", x);
         return Sin(x + PiHalf);
     }
 
     static FP_LONG CosFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::CosFast", x);
         return SinFast(x + PiHalf);
     }
 
     static FP_LONG CosFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::CosFastest", x);
         return SinFastest(x + PiHalf);
     }
 
+    /// <summary>
+    /// Calculates cosine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than CosFastest().
+    /// </summary>
+    static FP_LONG CosUltra(FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::CosUltra", x);
+        return SinUltra(x + PiHalf);
+    }
+
+    /// <summary>
+    /// Calculates SinUltra() for the first count elements of x into result.
+    /// </summary>
+    static void SinUltraBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinUltraBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosUltra() for the first count elements of x into result.
+    /// </summary>
+    static void CosUltraBatch(FP_LONG* x, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CosUltraBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Advances a binary angle by a quarter turn, wrapping around at a full turn.
+    /// </summary>
+    static FP_INT AddQuarterTurn(FP_INT angle)
+    {
+        return (FP_INT)((FP_UINT)angle + (FP_UINT)(1 << 30));  // wrap without signed overflow
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full FP_INT range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    static FP_LONG SinTurns(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinTurns", angle);
+        // A binary angle is the s2.30 quarter-turn value that UnitSin() takes. The s2.30 result
+        // is scaled to s32.32 with a multiply, as it can be negative.
+        return (FP_LONG)UnitSin(angle) * 4;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full FP_INT range is one turn.
+    /// </summary>
+    static FP_LONG CosTurns(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::CosTurns", angle);
+        return (FP_LONG)UnitSin(AddQuarterTurn(angle)) * 4;
+    }
+
+    /// <summary>
+    /// Calculates both sine and cosine of a binary angle, where the full FP_INT range is one turn.
+    /// Not available in Java, see SinCosTurnsBatch().
+    /// </summary>
+    static void SinCosTurns(FP_INT angle, FP_LONG& sinX, FP_LONG& cosX)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinCosTurns", angle);
+        sinX = (FP_LONG)UnitSin(angle) * 4;
+        cosX = (FP_LONG)UnitSin(AddQuarterTurn(angle)) * 4;
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full FP_INT range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    static FP_LONG SinTurnsFast(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinTurnsFast", angle);
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFast() takes.
+        return (FP_LONG)UnitSinFast(angle) * 4;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full FP_INT range is one turn.
+    /// </summary>
+    static FP_LONG CosTurnsFast(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::CosTurnsFast", angle);
+        return (FP_LONG)UnitSinFast(AddQuarterTurn(angle)) * 4;
+    }
+
+    /// <summary>
+    /// Calculates both sine and cosine of a binary angle, where the full FP_INT range is one turn.
+    /// Not available in Java, see SinCosTurnsFastBatch().
+    /// </summary>
+    static void SinCosTurnsFast(FP_INT angle, FP_LONG& sinX, FP_LONG& cosX)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinCosTurnsFast", angle);
+        sinX = (FP_LONG)UnitSinFast(angle) * 4;
+        cosX = (FP_LONG)UnitSinFast(AddQuarterTurn(angle)) * 4;
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full FP_INT range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    static FP_LONG SinTurnsFastest(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinTurnsFastest", angle);
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFastest() takes.
+        return (FP_LONG)UnitSinFastest(angle) * 4;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full FP_INT range is one turn.
+    /// </summary>
+    static FP_LONG CosTurnsFastest(FP_INT angle)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::CosTurnsFastest", angle);
+        return (FP_LONG)UnitSinFastest(AddQuarterTurn(angle)) * 4;
+    }
+
+    /// <summary>
+    /// Calculates both sine and cosine of a binary angle, where the full FP_INT range is one turn.
+    /// Not available in Java, see SinCosTurnsFastestBatch().
+    /// </summary>
+    static void SinCosTurnsFastest(FP_INT angle, FP_LONG& sinX, FP_LONG& cosX)
+    {
+        FP_INSTRUMENT_CALL1("Fixed64::SinCosTurnsFastest", angle);
+        sinX = (FP_LONG)UnitSinFastest(angle) * 4;
+        cosX = (FP_LONG)UnitSinFastest(AddQuarterTurn(angle)) * 4;
+    }
+
+    /// <summary>
+    /// Calculates SinTurns() for the first count elements of angle into result.
+    /// </summary>
+    static void SinTurnsBatch(FP_INT* angle, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinTurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurns() for the first count elements of angle into result.
+    /// </summary>
+    static void CosTurnsBatch(FP_INT* angle, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CosTurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    static void SinCosTurnsBatch(FP_INT* angle, FP_LONG* sinX, FP_LONG* cosX, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinCosTurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+        {
+            sinX[i] = (FP_LONG)UnitSin(angle[i]) * 4;
+            cosX[i] = (FP_LONG)UnitSin(AddQuarterTurn(angle[i])) * 4;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    static void SinTurnsFastBatch(FP_INT* angle, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinTurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    static void CosTurnsFastBatch(FP_INT* angle, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CosTurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    static void SinCosTurnsFastBatch(FP_INT* angle, FP_LONG* sinX, FP_LONG* cosX, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinCosTurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+        {
+            sinX[i] = (FP_LONG)UnitSinFast(angle[i]) * 4;
+            cosX[i] = (FP_LONG)UnitSinFast(AddQuarterTurn(angle[i])) * 4;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    static void SinTurnsFastestBatch(FP_INT* angle, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinTurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = SinTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    static void CosTurnsFastestBatch(FP_INT* angle, FP_LONG* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::CosTurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = CosTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    static void SinCosTurnsFastestBatch(FP_INT* angle, FP_LONG* sinX, FP_LONG* cosX, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::SinCosTurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+        {
+            sinX[i] = (FP_LONG)UnitSinFastest(angle[i]) * 4;
+            cosX[i] = (FP_LONG)UnitSinFastest(AddQuarterTurn(angle[i])) * 4;
+        }
+    }
+
     static FP_LONG Tan(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Tan", x);
         FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
         FP_LONG sinX = (FP_LONG)UnitSin(z) << 32;
-        FP_LONG cosX = (FP_LONG)UnitSin(z + (1 << 30)) << 32;
+        FP_LONG cosX = (FP_LONG)UnitSin(AddQuarterTurn(z)) << 32;
         return Div(sinX, cosX);
     }
 
     static FP_LONG TanFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::TanFast", x);
         FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
         FP_LONG sinX = (FP_LONG)UnitSinFast(z) << 32;
-        FP_LONG cosX = (FP_LONG)UnitSinFast(z + (1 << 30)) << 32;
+        FP_LONG cosX = (FP_LONG)UnitSinFast(AddQuarterTurn(z)) << 32;
         return DivFast(sinX, cosX);
     }
 
     static FP_LONG TanFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::TanFastest", x);
         FP_INT z = MulIntLongLow(RCP_HALF_PI, x);
         FP_LONG sinX = (FP_LONG)UnitSinFastest(z) << 32;
-        FP_LONG cosX = (FP_LONG)UnitSinFastest(z + (1 << 30)) << 32;
+        FP_LONG cosX = (FP_LONG)UnitSinFastest(AddQuarterTurn(z)) << 32;
         return DivFastest(sinX, cosX);
     }
 
@@ -1170,7 +2584,7 @@ namespace Fixed64
         FP_INT k = n - ONE;
 
         // Polynomial approximation of reciprocal.
-        FP_INT oox = FixedUtil::RcpPoly4Lut8(k);
+        FP_INT oox = FixedUtil::FP_KERNEL_RCP_FULL(k);
         FP_ASSERT(oox >= HALF && oox <= ONE);
 
         // Apply exponent and multiply.
@@ -1180,6 +2594,7 @@ namespace Fixed64
 
     static FP_LONG Atan2(FP_LONG y, FP_LONG x)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Atan2", y, x);
         // See: https://www.dsprelated.com/showarticle/1052.php
 
         if (x == 0)
@@ -1199,7 +2614,7 @@ namespace Fixed64
         if (nx >= ny)
         {
             FP_INT k = Atan2Div(ny, nx);
-            FP_INT z = FixedUtil::AtanPoly5Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FULL(k);
             FP_LONG angle = negMask ^ ((FP_LONG)z << 2);
             if (x > 0) return angle;
             if (y >= 0) return angle + Pi;
@@ -1208,7 +2623,7 @@ namespace Fixed64
         else
         {
             FP_INT k = Atan2Div(nx, ny);
-            FP_INT z = FixedUtil::AtanPoly5Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FULL(k);
             FP_LONG angle = negMask ^ ((FP_LONG)z << 2);
             return ((y > 0) ? PiHalf : -PiHalf) - angle;
         }
@@ -1226,7 +2641,7 @@ namespace Fixed64
         FP_INT k = n - ONE;
 
         // Polynomial approximation.
-        FP_INT oox = FixedUtil::RcpPoly6(k);
+        FP_INT oox = FixedUtil::FP_KERNEL_RCP_FAST(k);
         FP_ASSERT(oox >= HALF && oox <= ONE);
 
         // Apply exponent and multiply.
@@ -1236,6 +2651,7 @@ namespace Fixed64
 
     static FP_LONG Atan2Fast(FP_LONG y, FP_LONG x)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Atan2Fast", y, x);
         // See: https://www.dsprelated.com/showarticle/1052.php
 
         if (x == 0)
@@ -1255,7 +2671,7 @@ namespace Fixed64
         if (nx >= ny)
         {
             FP_INT k = Atan2DivFast(ny, nx);
-            FP_INT z = FixedUtil::AtanPoly3Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FAST(k);
             FP_LONG angle = negMask ^ ((FP_LONG)z << 2);
             if (x > 0) return angle;
             if (y >= 0) return angle + Pi;
@@ -1264,7 +2680,7 @@ namespace Fixed64
         else
         {
             FP_INT k = Atan2DivFast(nx, ny);
-            FP_INT z = FixedUtil::AtanPoly3Lut8(k);
+            FP_INT z = FixedUtil::FP_KERNEL_ATAN_FAST(k);
             FP_LONG angle = negMask ^ ((FP_LONG)z << 2);
             return ((y > 0) ? PiHalf : -PiHalf) - angle;
         }
@@ -1282,7 +2698,7 @@ namespace Fixed64
         FP_INT k = n - ONE;
 
         // Polynomial approximation.
-        FP_INT oox = FixedUtil::RcpPoly4(k);
+        FP_INT oox = FixedUtil::FP_KERNEL_RCP_FASTEST(k);
         FP_ASSERT(oox >= HALF && oox <= ONE);
 
         // Apply exponent and multiply.
@@ -1292,6 +2708,7 @@ namespace Fixed64
 
     static FP_LONG Atan2Fastest(FP_LONG y, FP_LONG x)
     {
+        FP_INSTRUMENT_CALL2("Fixed64::Atan2Fastest", y, x);
         // See: https://www.dsprelated.com/showarticle/1052.php
 
         if (x == 0)
@@ -1311,7 +2728,7 @@ namespace Fixed64
         if (nx >= ny)
         {
             FP_INT z = Atan2DivFastest(ny, nx);
-            FP_INT res = FixedUtil::AtanPoly4(z);
+            FP_INT res = FixedUtil::FP_KERNEL_ATAN_FASTEST(z);
             FP_LONG angle = negMask ^ ((FP_LONG)res << 2);
             if (x > 0) return angle;
             if (y >= 0) return angle + Pi;
@@ -1320,14 +2737,171 @@ namespace Fixed64
         else
         {
             FP_INT z = Atan2DivFastest(nx, ny);
-            FP_INT res = FixedUtil::AtanPoly4(z);
+            FP_INT res = FixedUtil::FP_KERNEL_ATAN_FASTEST(z);
             FP_LONG angle = negMask ^ ((FP_LONG)res << 2);
             return ((y > 0) ? PiHalf : -PiHalf) - angle;
         }
     }
 
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full FP_INT range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    static FP_INT Atan2Turns(FP_LONG y, FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::Atan2Turns", y, x);
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil::InvalidArgument("Fixed64::Atan2Turns", "y, x", y, x);
+            return 0;
+        }
+
+        // \note these round negative numbers slightly
+        FP_LONG nx = x ^ (x >> 63);
+        FP_LONG ny = y ^ (y >> 63);
+        FP_INT negMask = (FP_INT)((x ^ y) >> 63);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            FP_INT k = Atan2Div(ny, nx);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FULL(k), RCP_HALF_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            FP_INT k = Atan2Div(nx, ny);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FULL(k), RCP_HALF_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full FP_INT range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    static FP_INT Atan2TurnsFast(FP_LONG y, FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::Atan2TurnsFast", y, x);
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil::InvalidArgument("Fixed64::Atan2TurnsFast", "y, x", y, x);
+            return 0;
+        }
+
+        // \note these round negative numbers slightly
+        FP_LONG nx = x ^ (x >> 63);
+        FP_LONG ny = y ^ (y >> 63);
+        FP_INT negMask = (FP_INT)((x ^ y) >> 63);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            FP_INT k = Atan2DivFast(ny, nx);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FAST(k), RCP_HALF_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            FP_INT k = Atan2DivFast(nx, ny);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FAST(k), RCP_HALF_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full FP_INT range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    static FP_INT Atan2TurnsFastest(FP_LONG y, FP_LONG x)
+    {
+        FP_INSTRUMENT_CALL2("Fixed64::Atan2TurnsFastest", y, x);
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil::InvalidArgument("Fixed64::Atan2TurnsFastest", "y, x", y, x);
+            return 0;
+        }
+
+        // \note these round negative numbers slightly
+        FP_LONG nx = x ^ (x >> 63);
+        FP_LONG ny = y ^ (y >> 63);
+        FP_INT negMask = (FP_INT)((x ^ y) >> 63);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            FP_INT k = Atan2DivFastest(ny, nx);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FASTEST(k), RCP_HALF_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            FP_INT k = Atan2DivFastest(nx, ny);
+            FP_INT z = FixedUtil::Qmul30(FixedUtil::FP_KERNEL_ATAN_FASTEST(k), RCP_HALF_PI);
+            FP_INT angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates Atan2Turns() for the first count elements of y and x into result.
+    /// </summary>
+    static void Atan2TurnsBatch(FP_LONG* y, FP_LONG* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Atan2TurnsBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Atan2Turns(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFast() for the first count elements of y and x into result.
+    /// </summary>
+    static void Atan2TurnsFastBatch(FP_LONG* y, FP_LONG* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Atan2TurnsFastBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Atan2TurnsFast(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFastest() for the first count elements of y and x into result.
+    /// </summary>
+    static void Atan2TurnsFastestBatch(FP_LONG* y, FP_LONG* x, FP_INT* result, FP_INT count)
+    {
+        FP_INSTRUMENT_CALL0("Fixed64::Atan2TurnsFastestBatch");
+        for (FP_INT i = 0; i < count; i++)
+            result[i] = Atan2TurnsFastest(y[i], x[i]);
+    }
+
     static FP_LONG Asin(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Asin", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1340,6 +2914,7 @@ namespace Fixed64
 
     static FP_LONG AsinFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::AsinFast", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1352,6 +2927,7 @@ namespace Fixed64
 
     static FP_LONG AsinFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::AsinFastest", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1364,6 +2940,7 @@ namespace Fixed64
 
     static FP_LONG Acos(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Acos", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1376,6 +2953,7 @@ namespace Fixed64
 
     static FP_LONG AcosFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::AcosFast", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1388,6 +2966,7 @@ namespace Fixed64
 
     static FP_LONG AcosFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::AcosFastest", x);
         // Return 0 for invalid values
         if (x < -One || x > One)
         {
@@ -1400,16 +2979,19 @@ namespace Fixed64
 
     static FP_LONG Atan(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::Atan", x);
         return Atan2(x, One);
     }
 
     static FP_LONG AtanFast(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::AtanFast", x);
         return Atan2Fast(x, One);
     }
 
     static FP_LONG AtanFastest(FP_LONG x)
     {
+        FP_INSTRUMENT_CALL1("Fixed64::AtanFastest", x);
         return Atan2Fastest(x, One);
     }
 
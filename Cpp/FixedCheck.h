@@ -0,0 +1,277 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDCHECK_H
+#define __FIXEDCHECK_H
+
+// Sampled overflow and precision-loss detection for Fixed32/Fixed64 calls.
+//
+// Calls written as FP_CHECKED(Mul, a, b) (or FixedCheck::Mul(a, b, __FILE__, __LINE__)) return the
+// same value as Fixed32::Mul()/Fixed64::Mul(), chosen by the argument type. A random sample of the
+// calls (on average one in SetSampleInterval() calls, none by default) is also evaluated in double
+// precision. If the exact result does not fit the format, an Overflow event is recorded; if the
+// result is off by more than the allowed tolerance, a PrecisionLoss event. Events keep the call
+// site, the inputs, the result and the reference value.
+//
+// A call that is not sampled only costs a load of the interval and a decrement of a thread-local
+// counter. A new interval takes effect once the current gap has been counted down. Defining
+// FP_CHECK_DISABLE compiles the sampling out, so that FP_CHECKED() calls only the function.
+//
+// Note that the double reference has a 53-bit mantissa, so for Fixed64 it is only meaningful
+// as a relative error check, and overflow checks are exact except within 2^-53 of the limits.
+
+#include <stdint.h>
+#include <math.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "Fixed32.h"
+#include "Fixed64.h"
+
+#define FP_CHECKED(func, ...) FixedCheck::func(__VA_ARGS__, __FILE__, __LINE__)
+
+namespace FixedCheck
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    // Maximum number of events kept by GetEvents(); later events are only counted.
+    static const int MaxEvents = 1024;
+
+    enum EventKind
+    {
+        Overflow,           // the exact result is outside the range of the format
+        PrecisionLoss,      // the result differs from the reference by more than the tolerance
+    };
+
+    struct Event
+    {
+        EventKind   kind;
+        const char* function;       // e.g. "Fixed64::Mul"
+        const char* file;
+        int         line;
+        int         numInputs;
+        FP_LONG     inputs[2];      // raw input values
+        FP_LONG     result;         // raw result
+        double      reference;      // expected result as a real number
+    };
+
+    // Shared state. The functions are 'inline' rather than 'static' so that all translation
+    // units share the same settings and events.
+    struct State
+    {
+        std::atomic<int>        sampleInterval;
+        std::atomic<uint64_t>   numChecks;
+        std::atomic<uint64_t>   numEvents[2];
+        double                  maxRelativeError;
+        double                  maxUlps;
+        std::mutex              mutex;
+        std::vector<Event>      events;
+    };
+
+    inline State& GetState()
+    {
+        static State* state = []
+        {
+            State* s = new State();     // value-initialized, so the atomics start at zero
+            s->maxRelativeError = 1e-5;
+            s->maxUlps = 4.0;         // the approximated functions are accurate to a few ulps
+            return s;
+        }();
+        return *state;
+    }
+
+    /// <summary>
+    /// Checks on average one in interval calls. Zero or negative disables checking. Intervals
+    /// above 2^30 are clamped to 2^30, so that the random gaps fit in an int.
+    /// </summary>
+    inline void SetSampleInterval(int interval)
+    {
+        if (interval > (1 << 30))
+            interval = 1 << 30;
+        GetState().sampleInterval.store(interval, std::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Sets the tolerance for PrecisionLoss events: a result is reported when its error exceeds
+    /// both maxUlps units in the last place and maxRelativeError relative to the reference. Should
+    /// be set before checking is enabled.
+    /// </summary>
+    inline void SetTolerance(double maxRelativeError, double maxUlps)
+    {
+        GetState().maxRelativeError = maxRelativeError;
+        GetState().maxUlps = maxUlps;
+    }
+
+    /// <summary>
+    /// Returns the number of calls that were checked.
+    /// </summary>
+    inline uint64_t NumChecks() { return GetState().numChecks.load(std::memory_order_relaxed); }
+
+    /// <summary>
+    /// Returns the number of events of the given kind, including the ones not kept.
+    /// </summary>
+    inline uint64_t NumEvents(EventKind kind) { return GetState().numEvents[kind].load(std::memory_order_relaxed); }
+
+    /// <summary>
+    /// Returns a copy of the first MaxEvents events.
+    /// </summary>
+    inline std::vector<Event> GetEvents()
+    {
+        std::lock_guard<std::mutex> lock(GetState().mutex);
+        return GetState().events;
+    }
+
+    /// <summary>
+    /// Clears the events and counters.
+    /// </summary>
+    inline void Reset()
+    {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.events.clear();
+        state.numChecks.store(0);
+        state.numEvents[Overflow].store(0);
+        state.numEvents[PrecisionLoss].store(0);
+    }
+
+    // Returns true for a random subset of the calls, on average one in sampleInterval.
+    inline bool ShouldSample()
+    {
+        int interval = GetState().sampleInterval.load(std::memory_order_relaxed);
+        if (interval <= 0)
+            return false;
+
+        thread_local int countdown = 1;
+        if (--countdown > 0)
+            return false;
+
+        // Random gaps in [1, 2 * interval - 1] avoid locking onto periodic call patterns.
+        thread_local uint32_t seed = 0x9E3779B9u ^ (uint32_t)(uintptr_t)&countdown;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        countdown = 1 + (int)(seed % (2u * (uint32_t)interval - 1u));
+        return true;
+    }
+
+    static inline double ToReal(FP_INT v) { return Fixed32::ToDouble(v); }
+    static inline double ToReal(FP_LONG v) { return Fixed64::ToDouble(v); }
+    static inline int ShiftOf(FP_INT) { return Fixed32::Shift; }
+    static inline int ShiftOf(FP_LONG) { return Fixed64::Shift; }
+
+    // Compares a sampled result against the reference (NaN means no reference) and records events.
+    template <typename T>
+    static void Verify(const char* function, T result, double reference, int numInputs, T input0, T input1, const char* file, int line)
+    {
+        State& state = GetState();
+        state.numChecks.fetch_add(1, std::memory_order_relaxed);
+        if (reference != reference)
+            return;
+
+        double limit = ldexp(1.0, 8 * (int)sizeof(T) - 1);
+        double exactRaw = ldexp(reference, ShiftOf(result));
+        EventKind kind;
+        if (!(exactRaw >= -limit && exactRaw < limit))
+            kind = Overflow;
+        else
+        {
+            double error = fabs((double)result - exactRaw);
+            if (error <= state.maxUlps || error <= state.maxRelativeError * fabs(exactRaw))
+                return;
+            kind = PrecisionLoss;
+        }
+
+        state.numEvents[kind].fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if ((int)state.events.size() < MaxEvents)
+        {
+            Event e = { kind, function, file, line, numInputs, { input0, input1 }, result, reference };
+            state.events.push_back(e);
+        }
+    }
+
+    template <typename T>
+    static inline T Checked1(const char* function, T (*func)(T), double (*reference)(double), T x, const char* file, int line)
+    {
+        T result = func(x);
+#ifndef FP_CHECK_DISABLE
+        if (ShouldSample())
+            Verify(function, result, reference(ToReal(x)), 1, x, (T)0, file, line);
+#else
+        (void)function; (void)reference; (void)file; (void)line;
+#endif
+        return result;
+    }
+
+    template <typename T>
+    static inline T Checked2(const char* function, T (*func)(T, T), double (*reference)(double, double), T a, T b, const char* file, int line)
+    {
+        T result = func(a, b);
+#ifndef FP_CHECK_DISABLE
+        if (ShouldSample())
+            Verify(function, result, reference(ToReal(a), ToReal(b)), 2, a, b, file, line);
+#else
+        (void)function; (void)reference; (void)file; (void)line;
+#endif
+        return result;
+    }
+
+    // Reference implementations, returning NaN for invalid inputs (those are reported through
+    // FixedUtil::InvalidArgument() instead).
+    static inline double RefAdd(double a, double b) { return a + b; }
+    static inline double RefSub(double a, double b) { return a - b; }
+    static inline double RefMul(double a, double b) { return a * b; }
+    static inline double RefDiv(double a, double b) { return (b != 0.0) ? a / b : NAN; }
+    static inline double RefSqrt(double x) { return (x >= 0.0) ? sqrt(x) : NAN; }
+    static inline double RefExp(double x) { return exp(x); }
+    static inline double RefExp2(double x) { return pow(2.0, x); }
+    static inline double RefLog(double x) { return (x > 0.0) ? log(x) : NAN; }
+    static inline double RefLog2(double x) { return (x > 0.0) ? log(x) / log(2.0) : NAN; }
+    static inline double RefPow(double x, double e) { return (x > 0.0) ? pow(x, e) : NAN; }
+
+    static inline FP_INT Add(FP_INT a, FP_INT b, const char* file, int line) { return Checked2("Fixed32::Add", Fixed32::Add, RefAdd, a, b, file, line); }
+    static inline FP_INT Sub(FP_INT a, FP_INT b, const char* file, int line) { return Checked2("Fixed32::Sub", Fixed32::Sub, RefSub, a, b, file, line); }
+    static inline FP_INT Mul(FP_INT a, FP_INT b, const char* file, int line) { return Checked2("Fixed32::Mul", Fixed32::Mul, RefMul, a, b, file, line); }
+    static inline FP_INT Div(FP_INT a, FP_INT b, const char* file, int line) { return Checked2("Fixed32::Div", Fixed32::Div, RefDiv, a, b, file, line); }
+    static inline FP_INT Sqrt(FP_INT x, const char* file, int line) { return Checked1("Fixed32::Sqrt", Fixed32::Sqrt, RefSqrt, x, file, line); }
+    static inline FP_INT Exp(FP_INT x, const char* file, int line) { return Checked1("Fixed32::Exp", Fixed32::Exp, RefExp, x, file, line); }
+    static inline FP_INT Exp2(FP_INT x, const char* file, int line) { return Checked1("Fixed32::Exp2", Fixed32::Exp2, RefExp2, x, file, line); }
+    static inline FP_INT Log(FP_INT x, const char* file, int line) { return Checked1("Fixed32::Log", Fixed32::Log, RefLog, x, file, line); }
+    static inline FP_INT Log2(FP_INT x, const char* file, int line) { return Checked1("Fixed32::Log2", Fixed32::Log2, RefLog2, x, file, line); }
+    static inline FP_INT Pow(FP_INT x, FP_INT e, const char* file, int line) { return Checked2("Fixed32::Pow", Fixed32::Pow, RefPow, x, e, file, line); }
+
+    static inline FP_LONG Add(FP_LONG a, FP_LONG b, const char* file, int line) { return Checked2("Fixed64::Add", Fixed64::Add, RefAdd, a, b, file, line); }
+    static inline FP_LONG Sub(FP_LONG a, FP_LONG b, const char* file, int line) { return Checked2("Fixed64::Sub", Fixed64::Sub, RefSub, a, b, file, line); }
+    static inline FP_LONG Mul(FP_LONG a, FP_LONG b, const char* file, int line) { return Checked2("Fixed64::Mul", Fixed64::Mul, RefMul, a, b, file, line); }
+    static inline FP_LONG Div(FP_LONG a, FP_LONG b, const char* file, int line) { return Checked2("Fixed64::Div", Fixed64::Div, RefDiv, a, b, file, line); }
+    static inline FP_LONG Sqrt(FP_LONG x, const char* file, int line) { return Checked1("Fixed64::Sqrt", Fixed64::Sqrt, RefSqrt, x, file, line); }
+    static inline FP_LONG Exp(FP_LONG x, const char* file, int line) { return Checked1("Fixed64::Exp", Fixed64::Exp, RefExp, x, file, line); }
+    static inline FP_LONG Exp2(FP_LONG x, const char* file, int line) { return Checked1("Fixed64::Exp2", Fixed64::Exp2, RefExp2, x, file, line); }
+    static inline FP_LONG Log(FP_LONG x, const char* file, int line) { return Checked1("Fixed64::Log", Fixed64::Log, RefLog, x, file, line); }
+    static inline FP_LONG Log2(FP_LONG x, const char* file, int line) { return Checked1("Fixed64::Log2", Fixed64::Log2, RefLog2, x, file, line); }
+    static inline FP_LONG Pow(FP_LONG x, FP_LONG e, const char* file, int line) { return Checked2("Fixed64::Pow", Fixed64::Pow, RefPow, x, e, file, line); }
+}
+
+#endif // __FIXEDCHECK_H
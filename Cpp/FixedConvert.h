@@ -0,0 +1,374 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDCONVERT_H
+#define __FIXEDCONVERT_H
+
+// Bulk conversions between float/double arrays and Fixed32/Fixed64 arrays.
+//
+// In the default mode (Truncate, Unchecked), the results are identical to calling FromFloat(),
+// FromDouble(), ToFloat() and ToDouble() on each element, and out-of-range inputs are just as
+// undefined. The other modes round to nearest (ties to even) or down instead of towards zero, and
+// clamp out-of-range inputs to MinValue/MaxValue (NaN converts to zero).
+//
+// With AVX2, 4 or 8 values are converted per iteration. AVX2 has no 64-bit integer <-> double
+// conversions, so the Fixed64 paths use exact bit tricks and fall back to scalar code for groups
+// containing values outside their range (beyond +-2^18 for FromDouble(), +-2^21 for ToFloat()).
+
+#include <math.h>
+#include <stdint.h>
+#include "Fixed32.h"
+#include "Fixed64.h"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+namespace FixedConvert
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    enum Rounding
+    {
+        Truncate,   // towards zero, like a cast
+        Nearest,    // to nearest, ties to even
+        Floor,      // towards negative infinity
+    };
+
+    enum Overflow
+    {
+        Unchecked,  // out-of-range values are undefined, like a cast
+        Saturate,   // clamp to MinValue/MaxValue, NaN to zero
+    };
+
+    // Rounds an already scaled value to an integer (Truncate is left to the cast).
+    static inline double RoundScaled(double x, Rounding rounding)
+    {
+        if (rounding == Truncate)
+            return x;
+
+        double r = floor(x);
+        if (rounding == Nearest)
+        {
+            double frac = x - r;
+            if (frac > 0.5 || (frac == 0.5 && fmod(r, 2.0) != 0.0))
+                r += 1.0;
+        }
+        return r;
+    }
+
+    static inline FP_INT ScaledToInt(double x, Rounding rounding, Overflow overflow)
+    {
+        x = RoundScaled(x, rounding);
+        if (overflow == Saturate)
+        {
+            if (x != x) return 0;
+            if (x >= 2147483648.0) return Fixed32::MaxValue;
+            if (x < -2147483648.0) return Fixed32::MinValue;
+        }
+        return (FP_INT)x;
+    }
+
+    static inline FP_LONG ScaledToLong(double x, Rounding rounding, Overflow overflow)
+    {
+        x = RoundScaled(x, rounding);
+        if (overflow == Saturate)
+        {
+            if (x != x) return 0;
+            if (x >= 9223372036854775808.0) return Fixed64::MaxValue;
+            if (x < -9223372036854775808.0) return Fixed64::MinValue;
+        }
+        return (FP_LONG)x;
+    }
+
+#if defined(__AVX2__)
+    static inline __m256 RoundScaled8(__m256 x, Rounding rounding)
+    {
+        if (rounding == Nearest)
+            return _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        if (rounding == Floor)
+            return _mm256_round_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        return x;
+    }
+
+    static inline __m256d RoundScaled4(__m256d x, Rounding rounding)
+    {
+        if (rounding == Nearest)
+            return _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        if (rounding == Floor)
+            return _mm256_round_pd(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        return x;
+    }
+
+    // Converts 8 scaled floats to int32 with cast semantics, or saturating.
+    static inline __m256i ScaledToInt8(__m256 x, Rounding rounding, Overflow overflow)
+    {
+        x = RoundScaled8(x, rounding);
+        __m256i r = _mm256_cvttps_epi32(x);
+        if (overflow == Saturate)
+        {
+            // Too large values convert to 0x80000000 (like too small ones), fix them to MaxValue.
+            __m256 tooLarge = _mm256_cmp_ps(x, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+            r = _mm256_blendv_epi8(r, _mm256_set1_epi32(Fixed32::MaxValue), _mm256_castps_si256(tooLarge));
+            __m256 isNumber = _mm256_cmp_ps(x, x, _CMP_ORD_Q);
+            r = _mm256_and_si256(r, _mm256_castps_si256(isNumber));
+        }
+        return r;
+    }
+
+    // Converts 4 scaled doubles to int32 with cast semantics, or saturating.
+    static inline __m128i ScaledToInt4(__m256d x, Rounding rounding, Overflow overflow)
+    {
+        x = RoundScaled4(x, rounding);
+        if (overflow == Saturate)
+        {
+            x = _mm256_and_pd(x, _mm256_cmp_pd(x, x, _CMP_ORD_Q));
+            x = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-2147483648.0)), _mm256_set1_pd(2147483647.0));
+        }
+        return _mm256_cvttpd_epi32(x);
+    }
+
+    // Converts 4 scaled doubles to int64. Returns false if any of the values is too large for the
+    // bit trick (or NaN), in which case the caller converts them.
+    static inline bool ScaledToLong4(__m256d x, Rounding rounding, __m256i& result)
+    {
+        // Adding 1.5 * 2^52 puts any integer below 2^51 in magnitude into the low mantissa bits.
+        // The range check leaves room for rounding up.
+        const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+        __m256d absX = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+        if (_mm256_movemask_pd(_mm256_cmp_pd(absX, _mm256_set1_pd(1125899906842624.0), _CMP_LT_OQ)) != 0xF)
+            return false;
+
+        x = (rounding == Truncate) ? _mm256_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC) : RoundScaled4(x, rounding);
+        result = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(x, magic)), _mm256_castpd_si256(magic));
+        return true;
+    }
+
+    // Converts 4 int64 values to double with a single rounding.
+    static inline __m256d LongToDouble4(__m256i x)
+    {
+        // The high 16 bits and the low 48 bits are both converted exactly using magic exponents,
+        // the final addition is the only rounding step.
+        __m256i hi = _mm256_srai_epi32(x, 16);
+        hi = _mm256_blend_epi16(hi, _mm256_setzero_si256(), 0x33);
+        hi = _mm256_add_epi64(hi, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.0)));      // 3 * 2^67
+        __m256i lo = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)), 0x88);  // 2^52
+        __m256d f = _mm256_sub_pd(_mm256_castsi256_pd(hi), _mm256_set1_pd(442726361368656609280.0));   // 3 * 2^67 + 2^52
+        return _mm256_add_pd(f, _mm256_castsi256_pd(lo));
+    }
+#endif
+
+    /// <summary>
+    /// Converts count floats to Fixed32 values.
+    /// </summary>
+    static void FromFloatArray(const float* src, FP_INT* dst, int count, Rounding rounding = Truncate, Overflow overflow = Unchecked)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m256 scale = _mm256_set1_ps(65536.0f);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 x = _mm256_mul_ps(_mm256_loadu_ps(&src[i]), scale);
+            _mm256_storeu_si256((__m256i*)&dst[i], ScaledToInt8(x, rounding, overflow));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            if (rounding == Truncate && overflow == Unchecked)
+                dst[i] = Fixed32::FromFloat(src[i]);
+            else
+                dst[i] = ScaledToInt(src[i] * 65536.0f, rounding, overflow);
+        }
+    }
+
+    /// <summary>
+    /// Converts count doubles to Fixed32 values.
+    /// </summary>
+    static void FromDoubleArray(const double* src, FP_INT* dst, int count, Rounding rounding = Truncate, Overflow overflow = Unchecked)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m256d scale = _mm256_set1_pd(65536.0);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d x = _mm256_mul_pd(_mm256_loadu_pd(&src[i]), scale);
+            _mm_storeu_si128((__m128i*)&dst[i], ScaledToInt4(x, rounding, overflow));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            if (rounding == Truncate && overflow == Unchecked)
+                dst[i] = Fixed32::FromDouble(src[i]);
+            else
+                dst[i] = ScaledToInt(src[i] * 65536.0, rounding, overflow);
+        }
+    }
+
+    /// <summary>
+    /// Converts count floats to Fixed64 values.
+    /// </summary>
+    static void FromFloatArray(const float* src, FP_LONG* dst, int count, Rounding rounding = Truncate, Overflow overflow = Unchecked)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        // The scaling is done in float like in Fixed64::FromFloat(), widening to double is exact.
+        __m128 scale = _mm_set1_ps(4294967296.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d x = _mm256_cvtps_pd(_mm_mul_ps(_mm_loadu_ps(&src[i]), scale));
+            __m256i r;
+            if (ScaledToLong4(x, rounding, r))
+            {
+                _mm256_storeu_si256((__m256i*)&dst[i], r);
+                continue;
+            }
+            for (int j = i; j < i + 4; j++)
+                dst[j] = ScaledToLong(src[j] * 4294967296.0f, rounding, overflow);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            if (rounding == Truncate && overflow == Unchecked)
+                dst[i] = Fixed64::FromFloat(src[i]);
+            else
+                dst[i] = ScaledToLong(src[i] * 4294967296.0f, rounding, overflow);
+        }
+    }
+
+    /// <summary>
+    /// Converts count doubles to Fixed64 values.
+    /// </summary>
+    static void FromDoubleArray(const double* src, FP_LONG* dst, int count, Rounding rounding = Truncate, Overflow overflow = Unchecked)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m256d scale = _mm256_set1_pd(4294967296.0);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d x = _mm256_mul_pd(_mm256_loadu_pd(&src[i]), scale);
+            __m256i r;
+            if (ScaledToLong4(x, rounding, r))
+            {
+                _mm256_storeu_si256((__m256i*)&dst[i], r);
+                continue;
+            }
+            for (int j = i; j < i + 4; j++)
+                dst[j] = ScaledToLong(src[j] * 4294967296.0, rounding, overflow);
+        }
+#endif
+        for (; i < count; i++)
+        {
+            if (rounding == Truncate && overflow == Unchecked)
+                dst[i] = Fixed64::FromDouble(src[i]);
+            else
+                dst[i] = ScaledToLong(src[i] * 4294967296.0, rounding, overflow);
+        }
+    }
+
+    /// <summary>
+    /// Converts count Fixed32 values to floats.
+    /// </summary>
+    static void ToFloatArray(const FP_INT* src, float* dst, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m256 scale = _mm256_set1_ps(1.0f / 65536.0f);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256 x = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)&src[i]));
+            _mm256_storeu_ps(&dst[i], _mm256_mul_ps(x, scale));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = Fixed32::ToFloat(src[i]);
+    }
+
+    /// <summary>
+    /// Converts count Fixed32 values to doubles.
+    /// </summary>
+    static void ToDoubleArray(const FP_INT* src, double* dst, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m256d scale = _mm256_set1_pd(1.0 / 65536.0);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d x = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)&src[i]));
+            _mm256_storeu_pd(&dst[i], _mm256_mul_pd(x, scale));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = Fixed32::ToDouble(src[i]);
+    }
+
+    /// <summary>
+    /// Converts count Fixed64 values to floats.
+    /// </summary>
+    static void ToFloatArray(const FP_LONG* src, float* dst, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        // Values below 2^53 convert to double exactly, so there is only one rounding (to float).
+        __m128 scale = _mm_set1_ps(1.0f / 4294967296.0f);
+        __m256i limit = _mm256_set1_epi64x((FP_LONG)1 << 53);
+        __m256i negLimit = _mm256_set1_epi64x(-((FP_LONG)1 << 53));
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)&src[i]);
+            __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(v, limit), _mm256_cmpgt_epi64(negLimit, v));
+            if (!_mm256_testz_si256(outside, outside))
+            {
+                for (int j = i; j < i + 4; j++)
+                    dst[j] = Fixed64::ToFloat(src[j]);
+                continue;
+            }
+            __m128 x = _mm256_cvtpd_ps(LongToDouble4(v));
+            _mm_storeu_ps(&dst[i], _mm_mul_ps(x, scale));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = Fixed64::ToFloat(src[i]);
+    }
+
+    /// <summary>
+    /// Converts count Fixed64 values to doubles.
+    /// </summary>
+    static void ToDoubleArray(const FP_LONG* src, double* dst, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m256d scale = _mm256_set1_pd(1.0 / 4294967296.0);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256d x = LongToDouble4(_mm256_loadu_si256((const __m256i*)&src[i]));
+            _mm256_storeu_pd(&dst[i], _mm256_mul_pd(x, scale));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = Fixed64::ToDouble(src[i]);
+    }
+}
+
+#endif // __FIXEDCONVERT_H
@@ -0,0 +1,405 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDFFT_H
+#define __FIXEDFFT_H
+
+// In-place complex FFT for Fixed32 and Fixed64 data.
+//
+// The transform is a decimation-in-frequency FFT with radix-4 stages (and one radix-2 stage for
+// odd powers of two), followed by a digit-reversal permutation. Twiddle factors are s2.30 values
+// generated with UnitSin(), so the results are bit-exact across platforms and compilers.
+//
+// Complex data is passed as separate real and imaginary arrays. The transforms are linear, so
+// the fixed-point format of the data does not matter (s16.16, s2.30, s32.32, ..). With scaling
+// enabled, every stage divides its output by its radix, so that the result is DFT(x) / n and
+// intermediate values never grow beyond the input magnitude. Without scaling, the caller must
+// make sure the values have enough headroom (log2(n) bits).
+//
+// Plans (twiddle tables and permutation) are created on first use for each size and cached, so
+// repeated transforms of the same size do not allocate.
+
+#include <stdint.h>
+#include <mutex>
+#include <vector>
+#include "Fixed64.h"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+// If FP_ASSERT is not custom-defined, then use the standard one
+#ifndef FP_ASSERT
+#   include <assert.h>
+#   define FP_ASSERT(x) assert(x)
+#endif
+
+namespace FixedFFT
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    static const int MaxLog2Size = 24;
+
+    // Precomputed tables for one transform size.
+    struct Plan
+    {
+        int                 size;
+        std::vector<int>    spans;          // sub-transform length for each stage (radix is 4, or 2 for the last stage when span == 2)
+        std::vector<int>    twiddleOffsets; // start of each radix-4 stage's twiddles in twiddles
+        std::vector<FP_INT> twiddles;       // per stage: re(w^j), im(w^j), re(w^2j), im(w^2j), re(w^3j), im(w^3j), each span/4 long
+        std::vector<int>    swaps;          // pairs of indices which, swapped in order, undo the digit reversal
+    };
+
+    // Computes e^(-2*pi*i * k/n) as s2.30.
+    static void Twiddle(int k, int log2n, FP_INT& re, FP_INT& im)
+    {
+        // One full turn is 4.0 in s2.30, which wraps to zero in 32 bits.
+        FP_INT z = (FP_INT)((uint32_t)k << (32 - log2n));
+        re = Fixed64::UnitSin((FP_INT)((uint32_t)z + (1u << 30)));
+        im = -Fixed64::UnitSin(z);
+    }
+
+    static Plan* CreatePlan(int log2n)
+    {
+        Plan* plan = new Plan();
+        int n = 1 << log2n;
+        plan->size = n;
+
+        // Radix-4 stages, followed by a radix-2 stage if needed.
+        for (int span = n; span >= 4; span >>= 2)
+            plan->spans.push_back(span);
+        if ((log2n & 1) != 0)
+            plan->spans.push_back(2);
+
+        for (size_t s = 0; s < plan->spans.size(); s++)
+        {
+            int span = plan->spans[s];
+            plan->twiddleOffsets.push_back((int)plan->twiddles.size());
+            if (span == 2)
+                continue;
+
+            // Stage twiddles are w_span^(q*j) == w_n^(q*j*n/span).
+            int quarter = span / 4;
+            int stride = n / span;
+            size_t base = plan->twiddles.size();
+            plan->twiddles.resize(base + 6 * (size_t)quarter);
+            for (int q = 1; q <= 3; q++)
+            {
+                FP_INT* twRe = &plan->twiddles[base + (size_t)(2 * q - 2) * quarter];
+                FP_INT* twIm = &plan->twiddles[base + (size_t)(2 * q - 1) * quarter];
+                for (int j = 0; j < quarter; j++)
+                    Twiddle((q * j * stride) & (n - 1), log2n, twRe[j], twIm[j]);
+            }
+        }
+
+        // Frequency k ends up at position pos(k), where the digits of k (in the stage radices) are reversed.
+        std::vector<int> at(n), where(n);
+        for (int i = 0; i < n; i++)
+            at[i] = where[i] = i;
+
+        for (int k = 0; k < n; k++)
+        {
+            int pos = 0;
+            int rem = k;
+            int size = n;
+            for (size_t s = 0; s < plan->spans.size(); s++)
+            {
+                int radix = (plan->spans[s] == 2) ? 2 : 4;
+                size /= radix;
+                pos += (rem % radix) * size;
+                rem /= radix;
+            }
+
+            // Move the element originally at pos into slot k.
+            int src = where[pos];
+            if (src != k)
+            {
+                int displaced = at[k];
+                at[k] = pos;
+                at[src] = displaced;
+                where[pos] = k;
+                where[displaced] = src;
+                plan->swaps.push_back(k);
+                plan->swaps.push_back(src);
+            }
+        }
+
+        return plan;
+    }
+
+    /// <summary>
+    /// Returns the (cached) plan for a transform of size n, which must be a power of two.
+    /// </summary>
+    static const Plan& GetPlan(int n)
+    {
+        static std::mutex mutex;
+        static Plan* plans[MaxLog2Size + 1] = { 0 };
+
+        int log2n = 0;
+        while ((1 << log2n) < n)
+            log2n++;
+        FP_ASSERT(n >= 1 && (1 << log2n) == n && log2n <= MaxLog2Size);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!plans[log2n])
+            plans[log2n] = CreatePlan(log2n);
+        return *plans[log2n];
+    }
+
+    // Computes round(a * w), where w is s2.30. Exact for |a| < 2^62.
+    static inline FP_LONG MulQ30(FP_LONG a, FP_INT w)
+    {
+        FP_LONG ai = a >> 30;
+        FP_LONG af = a & ((1 << 30) - 1);
+        return ai * w + ((af * w + (1 << 29)) >> 30);
+    }
+
+    static inline FP_LONG Scale(FP_LONG v, int shift, bool scale)
+    {
+        return scale ? ((v + (1 << (shift - 1))) >> shift) : v;
+    }
+
+    template <typename T>
+    static void Radix4Stage(T* re, T* im, int n, int span, const FP_INT* tw, bool inverse, bool scale)
+    {
+        int quarter = span / 4;
+        for (int base = 0; base < n; base += span)
+        {
+            T* r = re + base;
+            T* i = im + base;
+            for (int j = 0; j < quarter; j++)
+            {
+                int j1 = j + quarter, j2 = j1 + quarter, j3 = j2 + quarter;
+
+                FP_LONG a0r = (FP_LONG)r[j] + r[j2], a0i = (FP_LONG)i[j] + i[j2];
+                FP_LONG a1r = (FP_LONG)r[j] - r[j2], a1i = (FP_LONG)i[j] - i[j2];
+                FP_LONG a2r = (FP_LONG)r[j1] + r[j3], a2i = (FP_LONG)i[j1] + i[j3];
+                FP_LONG a3r = (FP_LONG)r[j1] - r[j3], a3i = (FP_LONG)i[j1] - i[j3];
+
+                // Multiply a3 by -i (forward) or +i (inverse).
+                FP_LONG b3r = inverse ? -a3i : a3i;
+                FP_LONG b3i = inverse ? a3r : -a3r;
+
+                FP_LONG y0r = Scale(a0r + a2r, 2, scale), y0i = Scale(a0i + a2i, 2, scale);
+                FP_LONG y1r = Scale(a1r + b3r, 2, scale), y1i = Scale(a1i + b3i, 2, scale);
+                FP_LONG y2r = Scale(a0r - a2r, 2, scale), y2i = Scale(a0i - a2i, 2, scale);
+                FP_LONG y3r = Scale(a1r - b3r, 2, scale), y3i = Scale(a1i - b3i, 2, scale);
+
+                FP_INT w1r = tw[j], w1i = tw[quarter + j];
+                FP_INT w2r = tw[2 * quarter + j], w2i = tw[3 * quarter + j];
+                FP_INT w3r = tw[4 * quarter + j], w3i = tw[5 * quarter + j];
+                if (inverse)
+                {
+                    w1i = -w1i;
+                    w2i = -w2i;
+                    w3i = -w3i;
+                }
+
+                r[j] = (T)y0r;
+                i[j] = (T)y0i;
+                r[j1] = (T)(MulQ30(y1r, w1r) - MulQ30(y1i, w1i));
+                i[j1] = (T)(MulQ30(y1r, w1i) + MulQ30(y1i, w1r));
+                r[j2] = (T)(MulQ30(y2r, w2r) - MulQ30(y2i, w2i));
+                i[j2] = (T)(MulQ30(y2r, w2i) + MulQ30(y2i, w2r));
+                r[j3] = (T)(MulQ30(y3r, w3r) - MulQ30(y3i, w3i));
+                i[j3] = (T)(MulQ30(y3r, w3i) + MulQ30(y3i, w3r));
+            }
+        }
+    }
+
+#if defined(__AVX2__)
+    // Packs the low 32 bits of each 64-bit lane.
+    static inline __m128i Narrow(__m256i v)
+    {
+        return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+    }
+
+    static inline __m256i Load4(const FP_INT* p)
+    {
+        return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)p));
+    }
+
+    // Low 32 bits of round(a * w) for 32-bit a and s2.30 w. The logical shift gives the same low
+    // bits as the arithmetic one, so this matches MulQ30() after truncation to 32 bits.
+    static inline __m256i MulQ30x4(__m256i a, __m256i w)
+    {
+        return _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(a, w), _mm256_set1_epi64x(1 << 29)), 30);
+    }
+
+    // Scaled radix-4 stage for 32-bit data, four butterflies at a time. Bit-identical to Radix4Stage().
+    static void Radix4StageAvx2(FP_INT* re, FP_INT* im, int n, int span, const FP_INT* tw, bool inverse)
+    {
+        int quarter = span / 4;
+        const __m256i round = _mm256_set1_epi64x(2);
+        const __m256i zero = _mm256_setzero_si256();
+        for (int base = 0; base < n; base += span)
+        {
+            FP_INT* r = re + base;
+            FP_INT* i = im + base;
+            for (int j = 0; j < quarter; j += 4)
+            {
+                int j1 = j + quarter, j2 = j1 + quarter, j3 = j2 + quarter;
+
+                __m256i x0r = Load4(r + j), x0i = Load4(i + j);
+                __m256i x1r = Load4(r + j1), x1i = Load4(i + j1);
+                __m256i x2r = Load4(r + j2), x2i = Load4(i + j2);
+                __m256i x3r = Load4(r + j3), x3i = Load4(i + j3);
+
+                __m256i a0r = _mm256_add_epi64(x0r, x2r), a0i = _mm256_add_epi64(x0i, x2i);
+                __m256i a1r = _mm256_sub_epi64(x0r, x2r), a1i = _mm256_sub_epi64(x0i, x2i);
+                __m256i a2r = _mm256_add_epi64(x1r, x3r), a2i = _mm256_add_epi64(x1i, x3i);
+                __m256i a3r = _mm256_sub_epi64(x1r, x3r), a3i = _mm256_sub_epi64(x1i, x3i);
+
+                __m256i b3r = inverse ? _mm256_sub_epi64(zero, a3i) : a3i;
+                __m256i b3i = inverse ? a3r : _mm256_sub_epi64(zero, a3r);
+
+                // Scaled values fit in 32 bits, so logical shifts give the correct low halves.
+                __m256i y0r = _mm256_srli_epi64(_mm256_add_epi64(_mm256_add_epi64(a0r, a2r), round), 2);
+                __m256i y0i = _mm256_srli_epi64(_mm256_add_epi64(_mm256_add_epi64(a0i, a2i), round), 2);
+                __m256i y1r = _mm256_srli_epi64(_mm256_add_epi64(_mm256_add_epi64(a1r, b3r), round), 2);
+                __m256i y1i = _mm256_srli_epi64(_mm256_add_epi64(_mm256_add_epi64(a1i, b3i), round), 2);
+                __m256i y2r = _mm256_srli_epi64(_mm256_add_epi64(_mm256_sub_epi64(a0r, a2r), round), 2);
+                __m256i y2i = _mm256_srli_epi64(_mm256_add_epi64(_mm256_sub_epi64(a0i, a2i), round), 2);
+                __m256i y3r = _mm256_srli_epi64(_mm256_add_epi64(_mm256_sub_epi64(a1r, b3r), round), 2);
+                __m256i y3i = _mm256_srli_epi64(_mm256_add_epi64(_mm256_sub_epi64(a1i, b3i), round), 2);
+
+                __m256i w1r = Load4(tw + j), w1i = Load4(tw + quarter + j);
+                __m256i w2r = Load4(tw + 2 * quarter + j), w2i = Load4(tw + 3 * quarter + j);
+                __m256i w3r = Load4(tw + 4 * quarter + j), w3i = Load4(tw + 5 * quarter + j);
+                if (inverse)
+                {
+                    w1i = _mm256_sub_epi64(zero, w1i);
+                    w2i = _mm256_sub_epi64(zero, w2i);
+                    w3i = _mm256_sub_epi64(zero, w3i);
+                }
+
+                _mm_storeu_si128((__m128i*)(r + j), Narrow(y0r));
+                _mm_storeu_si128((__m128i*)(i + j), Narrow(y0i));
+                _mm_storeu_si128((__m128i*)(r + j1), Narrow(_mm256_sub_epi64(MulQ30x4(y1r, w1r), MulQ30x4(y1i, w1i))));
+                _mm_storeu_si128((__m128i*)(i + j1), Narrow(_mm256_add_epi64(MulQ30x4(y1r, w1i), MulQ30x4(y1i, w1r))));
+                _mm_storeu_si128((__m128i*)(r + j2), Narrow(_mm256_sub_epi64(MulQ30x4(y2r, w2r), MulQ30x4(y2i, w2i))));
+                _mm_storeu_si128((__m128i*)(i + j2), Narrow(_mm256_add_epi64(MulQ30x4(y2r, w2i), MulQ30x4(y2i, w2r))));
+                _mm_storeu_si128((__m128i*)(r + j3), Narrow(_mm256_sub_epi64(MulQ30x4(y3r, w3r), MulQ30x4(y3i, w3i))));
+                _mm_storeu_si128((__m128i*)(i + j3), Narrow(_mm256_add_epi64(MulQ30x4(y3r, w3i), MulQ30x4(y3i, w3r))));
+            }
+        }
+    }
+#endif
+
+    template <typename T>
+    static void Radix4Stage(T* re, T* im, const Plan& plan, size_t stage, bool inverse, bool scale)
+    {
+        Radix4Stage(re, im, plan.size, plan.spans[stage], &plan.twiddles[plan.twiddleOffsets[stage]], inverse, scale);
+    }
+
+#if defined(__AVX2__)
+    static void Radix4Stage(FP_INT* re, FP_INT* im, const Plan& plan, size_t stage, bool inverse, bool scale)
+    {
+        int span = plan.spans[stage];
+        const FP_INT* tw = &plan.twiddles[plan.twiddleOffsets[stage]];
+        if (scale && span >= 16)
+            Radix4StageAvx2(re, im, plan.size, span, tw, inverse);
+        else
+            Radix4Stage(re, im, plan.size, span, tw, inverse, scale);
+    }
+#endif
+
+    template <typename T>
+    static void Radix2Stage(T* re, T* im, int n, bool scale)
+    {
+        for (int j = 0; j < n; j += 2)
+        {
+            FP_LONG x0r = re[j], x0i = im[j];
+            FP_LONG x1r = re[j + 1], x1i = im[j + 1];
+            re[j] = (T)Scale(x0r + x1r, 1, scale);
+            im[j] = (T)Scale(x0i + x1i, 1, scale);
+            re[j + 1] = (T)Scale(x0r - x1r, 1, scale);
+            im[j + 1] = (T)Scale(x0i - x1i, 1, scale);
+        }
+    }
+
+    template <typename T>
+    static void Transform(T* re, T* im, int n, bool inverse, bool scale)
+    {
+        const Plan& plan = GetPlan(n);
+
+        for (size_t s = 0; s < plan.spans.size(); s++)
+        {
+            if (plan.spans[s] == 2)
+                Radix2Stage(re, im, n, scale);
+            else
+                Radix4Stage(re, im, plan, s, inverse, scale);
+        }
+
+        // Undo the digit reversal.
+        const int* swaps = plan.swaps.empty() ? 0 : &plan.swaps[0];
+        for (size_t k = 0; k < plan.swaps.size(); k += 2)
+        {
+            int a = swaps[k], b = swaps[k + 1];
+            T tr = re[a]; re[a] = re[b]; re[b] = tr;
+            T ti = im[a]; im[a] = im[b]; im[b] = ti;
+        }
+    }
+
+    /// <summary>
+    /// Computes the forward DFT of n complex values in-place. With scale enabled (default), the
+    /// result is divided by n, which guarantees no overflow as long as the input magnitudes are
+    /// below 2^31.
+    /// </summary>
+    static void Forward(FP_INT* re, FP_INT* im, int n, bool scale = true)
+    {
+        Transform(re, im, n, false, scale);
+    }
+
+    /// <summary>
+    /// Computes the inverse DFT of n complex values in-place. The result is not divided by n by
+    /// default, so that Inverse(Forward(x)) reproduces x.
+    /// </summary>
+    static void Inverse(FP_INT* re, FP_INT* im, int n, bool scale = false)
+    {
+        Transform(re, im, n, true, scale);
+    }
+
+    /// <summary>
+    /// Computes the forward DFT of n complex Fixed64 values in-place. See the 32-bit overload.
+    /// Input magnitudes must be below 2^61.
+    /// </summary>
+    static void Forward(FP_LONG* re, FP_LONG* im, int n, bool scale = true)
+    {
+        Transform(re, im, n, false, scale);
+    }
+
+    /// <summary>
+    /// Computes the inverse DFT of n complex Fixed64 values in-place. See the 32-bit overload.
+    /// </summary>
+    static void Inverse(FP_LONG* re, FP_LONG* im, int n, bool scale = false)
+    {
+        Transform(re, im, n, true, scale);
+    }
+
+    #undef FP_ASSERT
+}
+
+#endif // __FIXEDFFT_H
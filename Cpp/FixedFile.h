@@ -0,0 +1,420 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDFILE_H
+#define __FIXEDFILE_H
+
+// Binary file format for arrays of fixed-point values, with a streaming writer and a memory-mapped
+// zero-copy reader.
+//
+// A file is a 64-byte header followed by the raw little-endian elements, which start at an offset
+// aligned to the alignment stored in the header (64 bytes by default, so the mapped data can be
+// used with aligned SIMD loads):
+//
+//   offset  size  field
+//        0     4  magic "FXPA"
+//        4     2  version (1)
+//        6     2  header size (64)
+//        8     1  element type (ElementType)
+//        9     1  number of fractional bits (e.g. 16 for Fixed32, 32 for Fixed64)
+//       10     2  reserved (0)
+//       12     4  data alignment in bytes (power of two)
+//       16     8  data offset in bytes
+//       24     8  element count
+//       32    32  reserved (0)
+//
+// The reader maps the file copy-on-write: the data can be passed directly to the batch functions,
+// including as output arrays, and modifications never reach the file. Pages are only read from
+// disk when they are first accessed.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace FixedFile
+{
+    typedef int16_t FP_SHORT;
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    enum ElementType
+    {
+        Int16 = 1,      // FP_SHORT, e.g. Q15 or Q8_8 (see FixedPacked.h)
+        Int32 = 2,      // FP_INT, e.g. Fixed32
+        Int64 = 3,      // FP_LONG, e.g. Fixed64
+    };
+
+    static const uint32_t Magic = 0x41505846;      // "FXPA" when stored little-endian
+    static const uint16_t Version = 1;
+    static const int HeaderSize = 64;
+    static const int DefaultAlignment = 64;
+
+    static inline int ElementSize(int type)
+    {
+        return (type == Int16) ? 2 : (type == Int32) ? 4 : (type == Int64) ? 8 : 0;
+    }
+
+    static inline bool IsLittleEndian()
+    {
+        const uint16_t probe = 1;
+        return *(const uint8_t*)&probe == 1;
+    }
+
+    // Little-endian field access, independent of the alignment of p.
+    static inline void Store(uint8_t* p, uint64_t v, int size)
+    {
+        for (int i = 0; i < size; i++)
+            p[i] = (uint8_t)(v >> (8 * i));
+    }
+
+    static inline uint64_t Load(const uint8_t* p, int size)
+    {
+        uint64_t v = 0;
+        for (int i = 0; i < size; i++)
+            v |= (uint64_t)p[i] << (8 * i);
+        return v;
+    }
+
+    /// <summary>
+    /// Decoded file header.
+    /// </summary>
+    struct Header
+    {
+        int         elementType;
+        int         fractionBits;
+        uint32_t    alignment;
+        uint64_t    dataOffset;
+        uint64_t    count;
+    };
+
+    static inline void EncodeHeader(const Header& h, uint8_t* bytes)
+    {
+        memset(bytes, 0, HeaderSize);
+        Store(bytes + 0, Magic, 4);
+        Store(bytes + 4, Version, 2);
+        Store(bytes + 6, HeaderSize, 2);
+        Store(bytes + 8, (uint64_t)h.elementType, 1);
+        Store(bytes + 9, (uint64_t)h.fractionBits, 1);
+        Store(bytes + 12, h.alignment, 4);
+        Store(bytes + 16, h.dataOffset, 8);
+        Store(bytes + 24, h.count, 8);
+    }
+
+    // Returns null on success, or a description of the problem.
+    static inline const char* DecodeHeader(const uint8_t* bytes, uint64_t fileSize, Header& h)
+    {
+        if (fileSize < (uint64_t)HeaderSize || Load(bytes + 0, 4) != Magic)
+            return "not a fixed-point array file";
+        if (Load(bytes + 4, 2) != Version || Load(bytes + 6, 2) != (uint64_t)HeaderSize)
+            return "unsupported version";
+
+        h.elementType = (int)Load(bytes + 8, 1);
+        h.fractionBits = (int)Load(bytes + 9, 1);
+        h.alignment = (uint32_t)Load(bytes + 12, 4);
+        h.dataOffset = Load(bytes + 16, 8);
+        h.count = Load(bytes + 24, 8);
+
+        int elementSize = ElementSize(h.elementType);
+        if (elementSize == 0 || h.fractionBits >= 8 * elementSize)
+            return "invalid element type";
+        if (h.alignment == 0 || (h.alignment & (h.alignment - 1)) != 0 || h.dataOffset % h.alignment != 0 || h.dataOffset < (uint64_t)HeaderSize)
+            return "invalid data alignment";
+        if (h.dataOffset > fileSize || h.count > (fileSize - h.dataOffset) / (uint64_t)elementSize)
+            return "file is truncated";
+        return 0;
+    }
+
+    /// <summary>
+    /// Writes an array file element by element or in chunks, without holding all the data in
+    /// memory. The element count in the header is filled in by Close().
+    /// </summary>
+    class Writer
+    {
+    public:
+        Writer() : m_file(0), m_error(0) { memset(&m_header, 0, sizeof(m_header)); }
+        ~Writer() { Close(); }
+
+        /// <summary>
+        /// Creates (or overwrites) the file. Alignment must be a power of two.
+        /// </summary>
+        bool Open(const char* path, ElementType type, int fractionBits, int alignment = DefaultAlignment)
+        {
+            Close();
+            m_error = 0;
+            if (!IsLittleEndian())
+                return Fail("big-endian hosts are not supported");
+            if (alignment <= 0 || (alignment & (alignment - 1)) != 0 || fractionBits < 0 || fractionBits >= 8 * ElementSize(type))
+                return Fail("invalid arguments");
+
+            m_file = fopen(path, "wb");
+            if (!m_file)
+                return Fail("cannot create file");
+
+            m_header.elementType = type;
+            m_header.fractionBits = fractionBits;
+            m_header.alignment = (uint32_t)alignment;
+            m_header.dataOffset = ((uint64_t)HeaderSize + alignment - 1) & ~(uint64_t)(alignment - 1);
+            m_header.count = 0;
+
+            // Header with a zero count, then padding up to the data offset.
+            uint8_t bytes[HeaderSize];
+            EncodeHeader(m_header, bytes);
+            if (fwrite(bytes, 1, HeaderSize, m_file) != (size_t)HeaderSize)
+                return Fail("write failed");
+            for (uint64_t pos = HeaderSize; pos < m_header.dataOffset; pos++)
+            {
+                if (fputc(0, m_file) == EOF)
+                    return Fail("write failed");
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Appends count values. The pointer type must match the element type of the file.
+        /// </summary>
+        bool Write(const FP_SHORT* data, int count) { return WriteRaw(Int16, data, count); }
+        bool Write(const FP_INT* data, int count) { return WriteRaw(Int32, data, count); }
+        bool Write(const FP_LONG* data, int count) { return WriteRaw(Int64, data, count); }
+
+        /// <summary>
+        /// Finishes the file by writing the element count into the header. Returns false if
+        /// anything failed since Open().
+        /// </summary>
+        bool Close()
+        {
+            if (!m_file)
+                return m_error == 0;
+
+            uint8_t bytes[HeaderSize];
+            EncodeHeader(m_header, bytes);
+            bool ok = (m_error == 0)
+                && fseek(m_file, 0, SEEK_SET) == 0
+                && fwrite(bytes, 1, HeaderSize, m_file) == (size_t)HeaderSize;
+            ok = (fclose(m_file) == 0) && ok;
+            m_file = 0;
+            if (!ok && m_error == 0)
+                m_error = "write failed";
+            return ok;
+        }
+
+        uint64_t Count() const { return m_header.count; }
+
+        /// <summary>
+        /// Returns a description of the first error, or null.
+        /// </summary>
+        const char* Error() const { return m_error; }
+
+    private:
+        Writer(const Writer&);
+        Writer& operator=(const Writer&);
+
+        bool Fail(const char* error)
+        {
+            if (m_error == 0)
+                m_error = error;
+            return false;
+        }
+
+        bool WriteRaw(ElementType type, const void* data, int count)
+        {
+            if (!m_file || m_error)
+                return Fail("file is not open");
+            if (type != m_header.elementType)
+                return Fail("element type mismatch");
+            if (count <= 0)
+                return true;
+            if (fwrite(data, (size_t)ElementSize(type), (size_t)count, m_file) != (size_t)count)
+                return Fail("write failed");
+            m_header.count += (uint64_t)count;
+            return true;
+        }
+
+        FILE*       m_file;
+        Header      m_header;
+        const char* m_error;
+    };
+
+    /// <summary>
+    /// Memory-maps an array file and exposes its elements in place.
+    /// </summary>
+    class MappedFile
+    {
+    public:
+        MappedFile() : m_base(0), m_size(0), m_error(0)
+#if defined(_WIN32)
+            , m_file(INVALID_HANDLE_VALUE), m_mapping(0)
+#endif
+        {
+            memset(&m_header, 0, sizeof(m_header));
+        }
+
+        ~MappedFile() { Close(); }
+
+        /// <summary>
+        /// Maps the file and validates its header. The data stays valid until Close().
+        /// </summary>
+        bool Open(const char* path)
+        {
+            Close();
+            m_error = 0;
+            if (!IsLittleEndian())
+                return Fail("big-endian hosts are not supported");
+            if (!Map(path))
+                return false;
+
+            const char* error = DecodeHeader(m_base, m_size, m_header);
+            if (error)
+            {
+                Close();
+                return Fail(error);
+            }
+            return true;
+        }
+
+        void Close()
+        {
+            if (m_base)
+            {
+#if defined(_WIN32)
+                UnmapViewOfFile(m_base);
+#else
+                munmap(m_base, (size_t)m_size);
+#endif
+            }
+#if defined(_WIN32)
+            if (m_mapping)
+                CloseHandle(m_mapping);
+            if (m_file != INVALID_HANDLE_VALUE)
+                CloseHandle(m_file);
+            m_mapping = 0;
+            m_file = INVALID_HANDLE_VALUE;
+#endif
+            m_base = 0;
+            m_size = 0;
+            memset(&m_header, 0, sizeof(m_header));
+        }
+
+        bool IsOpen() const { return m_base != 0; }
+        ElementType Type() const { return (ElementType)m_header.elementType; }
+        int FractionBits() const { return m_header.fractionBits; }
+        uint64_t Count() const { return m_header.count; }
+
+        /// <summary>
+        /// Returns the elements, or null if the file is not open or has a different element type.
+        /// </summary>
+        FP_SHORT* Int16Data() { return (FP_SHORT*)Data(Int16); }
+        FP_INT* Int32Data() { return (FP_INT*)Data(Int32); }
+        FP_LONG* Int64Data() { return (FP_LONG*)Data(Int64); }
+
+        /// <summary>
+        /// Returns a description of the last Open() failure, or null.
+        /// </summary>
+        const char* Error() const { return m_error; }
+
+    private:
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+
+        bool Fail(const char* error)
+        {
+            m_error = error;
+            return false;
+        }
+
+        void* Data(ElementType type)
+        {
+            if (!m_base || m_header.elementType != type)
+                return 0;
+            return m_base + m_header.dataOffset;
+        }
+
+        bool Map(const char* path)
+        {
+#if defined(_WIN32)
+            m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+            if (m_file == INVALID_HANDLE_VALUE)
+                return Fail("cannot open file");
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(m_file, &size) || size.QuadPart < HeaderSize || (uint64_t)size.QuadPart > (size_t)-1)
+            {
+                Close();
+                return Fail("not a fixed-point array file");
+            }
+            m_mapping = CreateFileMappingA(m_file, 0, PAGE_WRITECOPY, 0, 0, 0);
+            m_base = m_mapping ? (uint8_t*)MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0) : 0;
+            if (!m_base)
+            {
+                Close();
+                return Fail("cannot map file");
+            }
+            m_size = (uint64_t)size.QuadPart;
+#else
+            int fd = open(path, O_RDONLY);
+            if (fd < 0)
+                return Fail("cannot open file");
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size < HeaderSize || (uint64_t)st.st_size > (size_t)-1)
+            {
+                close(fd);
+                return Fail("not a fixed-point array file");
+            }
+
+            // Private mapping: writes go to copy-on-write pages and never reach the file.
+            void* base = mmap(0, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (base == MAP_FAILED)
+                return Fail("cannot map file");
+            m_base = (uint8_t*)base;
+            m_size = (uint64_t)st.st_size;
+#endif
+            return true;
+        }
+
+        uint8_t*    m_base;
+        uint64_t    m_size;
+        Header      m_header;
+        const char* m_error;
+#if defined(_WIN32)
+        HANDLE      m_file;
+        HANDLE      m_mapping;
+#endif
+    };
+}
+
+#endif // __FIXEDFILE_H
@@ -0,0 +1,362 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDFILTER_H
+#define __FIXEDFILTER_H
+
+// Streaming FIR and IIR filters for 32-bit fixed-point samples.
+//
+// Filter coefficients are s2.30 values and samples can be in any 32-bit format (usually s16.16).
+// Each output sample is accumulated exactly in 64 bits and rounded once, instead of truncating
+// after every tap like a chain of Fixed32::Mul() calls would.
+//
+// All filters keep their state between Process() calls, so a signal can be fed in blocks of any
+// size and the output is identical to processing it in one go. Work buffers are allocated in the
+// constructor, so Process() never allocates.
+//
+// FIR filters need at least one tap. Zero taps trigger FP_ASSERT, and if asserts are disabled the
+// filter behaves like a single zero tap (all outputs are zero). Likewise, a decimation or
+// interpolation factor below 1 triggers FP_ASSERT and is treated as 1 if asserts are disabled.
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "FixedGemm.h"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+// If FP_ASSERT is not custom-defined, then use the standard one
+#ifndef FP_ASSERT
+#   include <assert.h>
+#   define FP_ASSERT(x) assert(x)
+#endif
+
+namespace FixedFilter
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    // Number of input samples processed per inner block (bounds the size of the work buffers).
+    static const int BlockSize = 256;
+
+    // Converts an s2.30 * sample accumulator back to the sample format (round half up).
+    static inline FP_INT RoundQ30(FP_LONG acc)
+    {
+        return (FP_INT)((acc + (1 << 29)) >> 30);
+    }
+
+    /// <summary>
+    /// Direct-form FIR filter: y[n] = sum(h[k] * x[n-k]).
+    /// </summary>
+    class Fir
+    {
+    public:
+        Fir(const FP_INT* coeffs, int numTaps)
+            : m_numTaps((numTaps > 0) ? numTaps : 1)
+            , m_coeffs((size_t)m_numTaps, 0)
+            , m_buffer((size_t)(m_numTaps - 1 + BlockSize))
+        {
+            FP_ASSERT(numTaps > 0);
+
+            // Store the taps reversed, so that each output is a straight dot product over the buffer.
+            for (int i = 0; i < numTaps; i++)
+                m_coeffs[numTaps - 1 - i] = coeffs[i];
+        }
+
+        /// <summary>
+        /// Clears the filter history.
+        /// </summary>
+        void Reset()
+        {
+            memset(&m_buffer[0], 0, sizeof(FP_INT) * m_buffer.size());
+        }
+
+        /// <summary>
+        /// Filters count samples from input into output. Input and output may be the same array.
+        /// </summary>
+        void Process(const FP_INT* input, FP_INT* output, int count)
+        {
+            int history = m_numTaps - 1;
+            while (count > 0)
+            {
+                int n = (count < BlockSize) ? count : BlockSize;
+                memcpy(&m_buffer[history], input, sizeof(FP_INT) * n);
+
+                for (int i = 0; i < n; i++)
+                    output[i] = RoundQ30(FixedGemm::DotAcc(&m_coeffs[0], &m_buffer[i], m_numTaps));
+
+                memmove(&m_buffer[0], &m_buffer[n], sizeof(FP_INT) * history);
+                input += n;
+                output += n;
+                count -= n;
+            }
+        }
+
+    private:
+        int                 m_numTaps;
+        std::vector<FP_INT> m_coeffs;   // reversed taps
+        std::vector<FP_INT> m_buffer;   // numTaps-1 samples of history followed by the current block
+    };
+
+    /// <summary>
+    /// Decimating FIR filter: filters the input and keeps every factor'th output. Only the kept
+    /// outputs are computed.
+    /// </summary>
+    class FirDecimator
+    {
+    public:
+        FirDecimator(const FP_INT* coeffs, int numTaps, int factor)
+            : m_numTaps((numTaps > 0) ? numTaps : 1)
+            , m_factor((factor > 0) ? factor : 1)
+            , m_phase(0)
+            , m_coeffs((size_t)m_numTaps, 0)
+            , m_buffer((size_t)(m_numTaps - 1 + BlockSize))
+        {
+            FP_ASSERT(numTaps > 0);
+            FP_ASSERT(factor > 0);
+            for (int i = 0; i < numTaps; i++)
+                m_coeffs[numTaps - 1 - i] = coeffs[i];
+        }
+
+        void Reset()
+        {
+            m_phase = 0;
+            memset(&m_buffer[0], 0, sizeof(FP_INT) * m_buffer.size());
+        }
+
+        /// <summary>
+        /// Consumes count input samples and returns the number of samples written to output
+        /// (at most count / factor + 1).
+        /// </summary>
+        int Process(const FP_INT* input, FP_INT* output, int count)
+        {
+            int history = m_numTaps - 1;
+            int numOutputs = 0;
+            while (count > 0)
+            {
+                int n = (count < BlockSize) ? count : BlockSize;
+                memcpy(&m_buffer[history], input, sizeof(FP_INT) * n);
+
+                // m_phase is the index (within this block) of the next input sample that produces an output.
+                int i = m_phase;
+                for (; i < n; i += m_factor)
+                    output[numOutputs++] = RoundQ30(FixedGemm::DotAcc(&m_coeffs[0], &m_buffer[i], m_numTaps));
+                m_phase = i - n;
+
+                memmove(&m_buffer[0], &m_buffer[n], sizeof(FP_INT) * history);
+                input += n;
+                count -= n;
+            }
+            return numOutputs;
+        }
+
+    private:
+        int                 m_numTaps;
+        int                 m_factor;
+        int                 m_phase;
+        std::vector<FP_INT> m_coeffs;
+        std::vector<FP_INT> m_buffer;
+    };
+
+    /// <summary>
+    /// Polyphase interpolating FIR filter: equivalent to inserting factor-1 zeros after each input
+    /// sample and filtering the result, without the multiplications by zero. Note that the passband
+    /// gain of the output is 1/factor of the coefficient sum, so scale the coefficients accordingly.
+    /// </summary>
+    class FirInterpolator
+    {
+    public:
+        FirInterpolator(const FP_INT* coeffs, int numTaps, int factor)
+            : m_factor((factor > 0) ? factor : 1)
+            , m_phaseTaps((numTaps > 0) ? (numTaps + m_factor - 1) / m_factor : 1)
+            , m_coeffs((size_t)m_factor * m_phaseTaps, 0)
+            , m_buffer((size_t)(m_phaseTaps - 1 + BlockSize))
+        {
+            FP_ASSERT(numTaps > 0);
+            FP_ASSERT(factor > 0);
+
+            // Phase p uses taps h[p], h[p + factor], h[p + 2*factor], .. (reversed and zero-padded).
+            for (int p = 0; p < m_factor; p++)
+                for (int k = 0; k < m_phaseTaps; k++)
+                    if (p + k * m_factor < numTaps)
+                        m_coeffs[(size_t)p * m_phaseTaps + (m_phaseTaps - 1 - k)] = coeffs[p + k * m_factor];
+        }
+
+        void Reset()
+        {
+            memset(&m_buffer[0], 0, sizeof(FP_INT) * m_buffer.size());
+        }
+
+        /// <summary>
+        /// Consumes count input samples and writes count * factor samples to output.
+        /// </summary>
+        void Process(const FP_INT* input, FP_INT* output, int count)
+        {
+            int history = m_phaseTaps - 1;
+            while (count > 0)
+            {
+                int n = (count < BlockSize) ? count : BlockSize;
+                memcpy(&m_buffer[history], input, sizeof(FP_INT) * n);
+
+                for (int i = 0; i < n; i++)
+                    for (int p = 0; p < m_factor; p++)
+                        *output++ = RoundQ30(FixedGemm::DotAcc(&m_coeffs[(size_t)p * m_phaseTaps], &m_buffer[i], m_phaseTaps));
+
+                memmove(&m_buffer[0], &m_buffer[n], sizeof(FP_INT) * history);
+                input += n;
+                count -= n;
+            }
+        }
+
+    private:
+        int                 m_factor;
+        int                 m_phaseTaps;
+        std::vector<FP_INT> m_coeffs;   // factor sub-filters of phaseTaps reversed taps each
+        std::vector<FP_INT> m_buffer;
+    };
+
+    /// <summary>
+    /// Biquad section coefficients as s2.30, normalized so that a0 == 1:
+    /// y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+    /// </summary>
+    struct BiquadCoeffs
+    {
+        FP_INT b0, b1, b2, a1, a2;
+    };
+
+    /// <summary>
+    /// Cascade of biquad sections (direct form I) applied to any number of channels with the same
+    /// coefficients. Samples are interleaved by channel (frame by frame). Each section output is
+    /// rounded once from an exact 64-bit accumulator. With AVX2, four channels are filtered at a time.
+    /// </summary>
+    class BiquadCascade
+    {
+    public:
+        BiquadCascade(const BiquadCoeffs* sections, int numSections, int numChannels = 1)
+            : m_numSections(numSections)
+            , m_numChannels(numChannels)
+            , m_sections(sections, sections + numSections)
+            , m_state((size_t)numSections * numChannels * 4, 0)
+        {
+        }
+
+        void Reset()
+        {
+            memset(&m_state[0], 0, sizeof(FP_INT) * m_state.size());
+        }
+
+        /// <summary>
+        /// Filters numFrames frames (of numChannels samples each) from input into output. Input
+        /// and output may be the same array.
+        /// </summary>
+        void Process(const FP_INT* input, FP_INT* output, int numFrames)
+        {
+            // Run each section over the whole block: the first one reads the input, the rest work in-place.
+            for (int s = 0; s < m_numSections; s++)
+            {
+                const FP_INT* src = (s == 0) ? input : output;
+                FP_INT* state = &m_state[(size_t)s * m_numChannels * 4];
+                int ch = 0;
+#if defined(__AVX2__)
+                for (; ch + 4 <= m_numChannels; ch += 4)
+                    ProcessSectionAvx2(m_sections[s], state, ch, src, output, numFrames);
+#endif
+                for (; ch < m_numChannels; ch++)
+                    ProcessSection(m_sections[s], state, ch, src, output, numFrames);
+            }
+        }
+
+    private:
+        // State layout per section: x1[numChannels], x2[numChannels], y1[numChannels], y2[numChannels].
+        void ProcessSection(const BiquadCoeffs& c, FP_INT* state, int ch, const FP_INT* src, FP_INT* dst, int numFrames)
+        {
+            int nc = m_numChannels;
+            FP_INT x1 = state[ch], x2 = state[nc + ch];
+            FP_INT y1 = state[2 * nc + ch], y2 = state[3 * nc + ch];
+            for (int f = 0; f < numFrames; f++)
+            {
+                FP_INT x = src[(size_t)f * nc + ch];
+                FP_LONG acc = (FP_LONG)c.b0 * x + (FP_LONG)c.b1 * x1 + (FP_LONG)c.b2 * x2 - (FP_LONG)c.a1 * y1 - (FP_LONG)c.a2 * y2;
+                FP_INT y = RoundQ30(acc);
+                dst[(size_t)f * nc + ch] = y;
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+            }
+            state[ch] = x1;
+            state[nc + ch] = x2;
+            state[2 * nc + ch] = y1;
+            state[3 * nc + ch] = y2;
+        }
+
+#if defined(__AVX2__)
+        // Same as ProcessSection() for channels [ch, ch+4). Products are exact 64-bit values
+        // and only the low 32 bits of the shifted accumulator are kept, like RoundQ30() does.
+        void ProcessSectionAvx2(const BiquadCoeffs& c, FP_INT* state, int ch, const FP_INT* src, FP_INT* dst, int numFrames)
+        {
+            int nc = m_numChannels;
+            const __m256i b0 = _mm256_set1_epi64x(c.b0), b1 = _mm256_set1_epi64x(c.b1), b2 = _mm256_set1_epi64x(c.b2);
+            const __m256i a1 = _mm256_set1_epi64x(c.a1), a2 = _mm256_set1_epi64x(c.a2);
+            const __m256i round = _mm256_set1_epi64x(1 << 29);
+            const __m256i narrow = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+            __m256i x1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&state[ch]));
+            __m256i x2 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&state[nc + ch]));
+            __m256i y1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&state[2 * nc + ch]));
+            __m256i y2 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&state[3 * nc + ch]));
+            for (int f = 0; f < numFrames; f++)
+            {
+                __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&src[(size_t)f * nc + ch]));
+                __m256i acc = _mm256_add_epi64(_mm256_mul_epi32(b0, x), _mm256_mul_epi32(b1, x1));
+                acc = _mm256_add_epi64(acc, _mm256_mul_epi32(b2, x2));
+                acc = _mm256_sub_epi64(acc, _mm256_mul_epi32(a1, y1));
+                acc = _mm256_sub_epi64(acc, _mm256_mul_epi32(a2, y2));
+                __m256i y = _mm256_srli_epi64(_mm256_add_epi64(acc, round), 30);
+                _mm_storeu_si128((__m128i*)&dst[(size_t)f * nc + ch], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(y, narrow)));
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+            }
+            _mm_storeu_si128((__m128i*)&state[ch], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x1, narrow)));
+            _mm_storeu_si128((__m128i*)&state[nc + ch], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(x2, narrow)));
+            _mm_storeu_si128((__m128i*)&state[2 * nc + ch], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(y1, narrow)));
+            _mm_storeu_si128((__m128i*)&state[3 * nc + ch], _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(y2, narrow)));
+        }
+#endif
+
+        int                         m_numSections;
+        int                         m_numChannels;
+        std::vector<BiquadCoeffs>   m_sections;
+        std::vector<FP_INT>         m_state;
+    };
+
+    #undef FP_ASSERT
+}
+
+#endif // __FIXEDFILTER_H
@@ -0,0 +1,334 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDGEMM_H
+#define __FIXEDGEMM_H
+
+// Matrix multiply kernels for 32-bit fixed-point data (Fixed32 s16.16 or s2.30).
+//
+// All products are accumulated at full precision in 64 bits and the result is rounded only
+// once per output element, so the results are more precise than chained Fixed32::Mul() calls
+// and identical regardless of blocking, SIMD or threading. The accumulator wraps on overflow,
+// which only happens if the sum of products exceeds the s33.30 (or s17.46) range.
+//
+// Matrices are row-major with an explicit row stride (in elements).
+
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "FixedParallel.h"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+namespace FixedGemm
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    // Number of fractional bits for the supported formats.
+    static const int ShiftQ16 = 16;     // Fixed32 (s16.16)
+    static const int ShiftQ30 = 30;     // s2.30
+
+    // Blocking parameters: the micro-kernel computes an MR x NR block of C in registers. A packed
+    // block of A (MC x KC, 64 kB) stays in L2 and each KC x NR sliver of the packed B panel (8 kB)
+    // in L1. The whole B panel (KC x NC, 512 kB) is packed once per MB-row band and reused by all
+    // MC blocks of the band from L2/L3, and the 64-bit sums of a band (MB x NC, 1 MB) are kept in
+    // a scratch buffer until the full k dimension has been accumulated.
+    static const int MR = 4;
+    static const int NR = 8;
+    static const int MC = 64;
+    static const int MB = 256;
+    static const int KC = 256;
+    static const int NC = 512;
+
+    // Rounds a 64-bit accumulator to the output format (round half up).
+    static inline FP_INT RoundAcc(FP_LONG acc, int shift)
+    {
+        return (FP_INT)((acc + ((FP_LONG)1 << (shift - 1))) >> shift);
+    }
+
+    // Packs a KC x NR sliver of B (zero-padded) so that the micro-kernel reads it sequentially.
+    static inline void PackB(int kc, int nr, const FP_INT* b, int ldb, FP_INT* dst)
+    {
+        for (int p = 0; p < kc; p++)
+        {
+            const FP_INT* src = b + (size_t)p * ldb;
+            int j = 0;
+            for (; j < nr; j++)
+                dst[j] = src[j];
+            for (; j < NR; j++)
+                dst[j] = 0;
+            dst += NR;
+        }
+    }
+
+    // Packs an MR x KC sliver of A (zero-padded), column by column.
+    static inline void PackA(int mr, int kc, const FP_INT* a, int lda, FP_INT* dst)
+    {
+        for (int p = 0; p < kc; p++)
+        {
+            int i = 0;
+            for (; i < mr; i++)
+                dst[i] = a[(size_t)i * lda + p];
+            for (; i < MR; i++)
+                dst[i] = 0;
+            dst += MR;
+        }
+    }
+
+    // Micro-kernel: acc[MR][NR] += packedA[kc][MR] * packedB[kc][NR], where row i of acc starts at
+    // acc + i * ldacc. The accumulators are loaded once, kept in registers for the kc steps and
+    // stored back once.
+    static inline void MicroKernel(int kc, const FP_INT* pa, const FP_INT* pb, FP_LONG* acc, int ldacc)
+    {
+#if defined(__AVX2__)
+        // vpmuldq multiplies the low signed 32 bits of each 64-bit lane into a full 64-bit product.
+        __m256i c00 = _mm256_loadu_si256((const __m256i*)&acc[0 * ldacc + 0]);
+        __m256i c01 = _mm256_loadu_si256((const __m256i*)&acc[0 * ldacc + 4]);
+        __m256i c10 = _mm256_loadu_si256((const __m256i*)&acc[1 * ldacc + 0]);
+        __m256i c11 = _mm256_loadu_si256((const __m256i*)&acc[1 * ldacc + 4]);
+        __m256i c20 = _mm256_loadu_si256((const __m256i*)&acc[2 * ldacc + 0]);
+        __m256i c21 = _mm256_loadu_si256((const __m256i*)&acc[2 * ldacc + 4]);
+        __m256i c30 = _mm256_loadu_si256((const __m256i*)&acc[3 * ldacc + 0]);
+        __m256i c31 = _mm256_loadu_si256((const __m256i*)&acc[3 * ldacc + 4]);
+
+        for (int p = 0; p < kc; p++)
+        {
+            __m256i b0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&pb[0]));
+            __m256i b1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&pb[4]));
+            __m256i a0 = _mm256_set1_epi64x(pa[0]);
+            __m256i a1 = _mm256_set1_epi64x(pa[1]);
+            __m256i a2 = _mm256_set1_epi64x(pa[2]);
+            __m256i a3 = _mm256_set1_epi64x(pa[3]);
+            c00 = _mm256_add_epi64(c00, _mm256_mul_epi32(a0, b0));
+            c01 = _mm256_add_epi64(c01, _mm256_mul_epi32(a0, b1));
+            c10 = _mm256_add_epi64(c10, _mm256_mul_epi32(a1, b0));
+            c11 = _mm256_add_epi64(c11, _mm256_mul_epi32(a1, b1));
+            c20 = _mm256_add_epi64(c20, _mm256_mul_epi32(a2, b0));
+            c21 = _mm256_add_epi64(c21, _mm256_mul_epi32(a2, b1));
+            c30 = _mm256_add_epi64(c30, _mm256_mul_epi32(a3, b0));
+            c31 = _mm256_add_epi64(c31, _mm256_mul_epi32(a3, b1));
+            pa += MR;
+            pb += NR;
+        }
+
+        _mm256_storeu_si256((__m256i*)&acc[0 * ldacc + 0], c00);
+        _mm256_storeu_si256((__m256i*)&acc[0 * ldacc + 4], c01);
+        _mm256_storeu_si256((__m256i*)&acc[1 * ldacc + 0], c10);
+        _mm256_storeu_si256((__m256i*)&acc[1 * ldacc + 4], c11);
+        _mm256_storeu_si256((__m256i*)&acc[2 * ldacc + 0], c20);
+        _mm256_storeu_si256((__m256i*)&acc[2 * ldacc + 4], c21);
+        _mm256_storeu_si256((__m256i*)&acc[3 * ldacc + 0], c30);
+        _mm256_storeu_si256((__m256i*)&acc[3 * ldacc + 4], c31);
+#else
+        FP_LONG c[MR][NR];
+        for (int i = 0; i < MR; i++)
+            for (int j = 0; j < NR; j++)
+                c[i][j] = acc[i * ldacc + j];
+
+        for (int p = 0; p < kc; p++)
+        {
+            FP_LONG b0 = pb[0], b1 = pb[1], b2 = pb[2], b3 = pb[3];
+            FP_LONG b4 = pb[4], b5 = pb[5], b6 = pb[6], b7 = pb[7];
+            for (int i = 0; i < MR; i++)
+            {
+                FP_LONG ai = pa[i];
+                c[i][0] += ai * b0; c[i][1] += ai * b1; c[i][2] += ai * b2; c[i][3] += ai * b3;
+                c[i][4] += ai * b4; c[i][5] += ai * b5; c[i][6] += ai * b6; c[i][7] += ai * b7;
+            }
+            pa += MR;
+            pb += NR;
+        }
+
+        for (int i = 0; i < MR; i++)
+            for (int j = 0; j < NR; j++)
+                acc[i * ldacc + j] = c[i][j];
+#endif
+    }
+
+    // Packing and accumulation buffers, allocated once per thread and reused by all calls.
+    struct Scratch
+    {
+        std::vector<FP_INT>     packA;
+        std::vector<FP_INT>     packB;
+        std::vector<FP_LONG>    accum;
+    };
+
+    static inline Scratch& GetScratch()
+    {
+        thread_local Scratch scratch;
+        if (scratch.accum.empty())
+        {
+            scratch.packA.resize((size_t)MC * KC);
+            scratch.packB.resize((size_t)KC * NC);
+            scratch.accum.resize((size_t)MB * NC);
+        }
+        return scratch;
+    }
+
+    // Computes rows [rowBegin, rowEnd( of C = A * B, where A is m x k, B is k x n and C is m x n.
+    // The full k dimension is accumulated before rounding, so the KC blocking is only a cache
+    // optimization: the 64-bit partial sums for one MB x NC band of C are kept in a scratch buffer.
+    static void GemmRows(int rowBegin, int rowEnd, int n, int k, const FP_INT* a, int lda, const FP_INT* b, int ldb, FP_INT* c, int ldc, int shift)
+    {
+        Scratch& scratch = GetScratch();
+        FP_INT* packA = &scratch.packA[0];
+        FP_INT* packB = &scratch.packB[0];
+        FP_LONG* accum = &scratch.accum[0];
+
+        for (int mb = rowBegin; mb < rowEnd; mb += MB)
+        {
+            int mbEnd = (rowEnd - mb < MB) ? rowEnd : mb + MB;
+
+            for (int jc = 0; jc < n; jc += NC)
+            {
+                int nc = (n - jc < NC) ? (n - jc) : NC;
+
+                // Only clear the part of the band that the micro-kernels touch (rows and columns
+                // rounded up to the MR x NR tile size).
+                int rowsUsed = ((mbEnd - mb + MR - 1) / MR) * MR;
+                int colsUsed = ((nc + NR - 1) / NR) * NR;
+                for (int i = 0; i < rowsUsed; i++)
+                    memset(accum + (size_t)i * NC, 0, sizeof(FP_LONG) * colsUsed);
+
+                for (int pc = 0; pc < k; pc += KC)
+                {
+                    int kc = (k - pc < KC) ? (k - pc) : KC;
+
+                    // Pack the B panel once per (band, jc, pc), it is shared by all MC blocks.
+                    for (int jr = 0; jr < nc; jr += NR)
+                        PackB(kc, (nc - jr < NR) ? (nc - jr) : NR, b + (size_t)pc * ldb + jc + jr, ldb, &packB[(size_t)jr * kc]);
+
+                    for (int ic = mb; ic < mbEnd; ic += MC)
+                    {
+                        int mc = (mbEnd - ic < MC) ? (mbEnd - ic) : MC;
+                        for (int ir = 0; ir < mc; ir += MR)
+                            PackA((mc - ir < MR) ? (mc - ir) : MR, kc, a + (size_t)(ic + ir) * lda + pc, lda, &packA[(size_t)ir * kc]);
+
+                        FP_LONG* accBlock = accum + (size_t)(ic - mb) * NC;
+                        for (int jr = 0; jr < nc; jr += NR)
+                        {
+                            for (int ir = 0; ir < mc; ir += MR)
+                                MicroKernel(kc, &packA[(size_t)ir * kc], &packB[(size_t)jr * kc], accBlock + (size_t)ir * NC + jr, NC);
+                        }
+                    }
+                }
+
+                // Round once per output element.
+                for (int i = mb; i < mbEnd; i++)
+                {
+                    FP_INT* dst = c + (size_t)i * ldc + jc;
+                    const FP_LONG* src = accum + (size_t)(i - mb) * NC;
+                    for (int j = 0; j < nc; j++)
+                        dst[j] = RoundAcc(src[j], shift);
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Computes C = A * B, where A is m x k, B is k x n and C is m x n. Shift is the number of
+    /// fractional bits of the values (ShiftQ16 or ShiftQ30), the same for all matrices.
+    /// </summary>
+    static void Gemm(int m, int n, int k, const FP_INT* a, int lda, const FP_INT* b, int ldb, FP_INT* c, int ldc, int shift = ShiftQ16)
+    {
+        GemmRows(0, m, n, k, a, lda, b, ldb, c, ldc, shift);
+    }
+
+    /// <summary>
+    /// Multithreaded Gemm(). Rows of C are split into MB-row bands, which are run as tasks on the
+    /// pool, so each task packs its B panels once for the whole band. The result is identical to
+    /// Gemm().
+    /// </summary>
+    static void GemmParallel(FixedParallel::ThreadPool& pool, int m, int n, int k, const FP_INT* a, int lda, const FP_INT* b, int ldb, FP_INT* c, int ldc, int shift = ShiftQ16)
+    {
+        FixedParallel::ParallelFor(pool, m, MB, [&](int rowBegin, int rowEnd)
+        {
+            GemmRows(rowBegin, rowEnd, n, k, a, lda, b, ldb, c, ldc, shift);
+        });
+    }
+
+    /// <summary>
+    /// Multithreaded Gemm() on a temporary pool of numThreads threads (0 means use the hardware
+    /// concurrency). The result is identical to Gemm().
+    /// </summary>
+    static void GemmParallel(int m, int n, int k, const FP_INT* a, int lda, const FP_INT* b, int ldb, FP_INT* c, int ldc, int shift = ShiftQ16, int numThreads = 0)
+    {
+        int numBands = (m + MB - 1) / MB;
+        if (numThreads <= 0)
+            numThreads = (int)std::thread::hardware_concurrency();
+        if (numThreads > numBands)
+            numThreads = numBands;
+        if (numThreads <= 1)
+        {
+            GemmRows(0, m, n, k, a, lda, b, ldb, c, ldc, shift);
+            return;
+        }
+
+        FixedParallel::ThreadPool pool(numThreads);
+        GemmParallel(pool, m, n, k, a, lda, b, ldb, c, ldc, shift);
+    }
+
+    /// <summary>
+    /// Returns the exact 64-bit sum of a[i] * b[i] over n elements (without any shifting).
+    /// </summary>
+    static inline FP_LONG DotAcc(const FP_INT* a, const FP_INT* b, int n)
+    {
+        int j = 0;
+        FP_LONG acc = 0;
+#if defined(__AVX2__)
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256i a0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&a[j + 0]));
+            __m256i a1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&a[j + 4]));
+            __m256i b0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&b[j + 0]));
+            __m256i b1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)&b[j + 4]));
+            acc0 = _mm256_add_epi64(acc0, _mm256_mul_epi32(a0, b0));
+            acc1 = _mm256_add_epi64(acc1, _mm256_mul_epi32(a1, b1));
+        }
+        FP_LONG lanes[4];
+        _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(acc0, acc1));
+        acc = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+        for (; j < n; j++)
+            acc += (FP_LONG)a[j] * (FP_LONG)b[j];
+        return acc;
+    }
+
+    /// <summary>
+    /// Computes y = A * x, where A is m x n, x has n elements and y has m elements.
+    /// </summary>
+    static void Gemv(int m, int n, const FP_INT* a, int lda, const FP_INT* x, FP_INT* y, int shift = ShiftQ16)
+    {
+        for (int i = 0; i < m; i++)
+            y[i] = RoundAcc(DotAcc(a + (size_t)i * lda, x, n), shift);
+    }
+}
+
+#endif // __FIXEDGEMM_H
@@ -0,0 +1,300 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDINSTRUMENT_H
+#define __FIXEDINSTRUMENT_H
+
+// Call counters, argument histograms and invalid-argument tallies for the Fixed32/Fixed64
+// functions, enabled by defining FP_INSTRUMENT before including FixedUtil.h (or Fixed32.h/Fixed64.h).
+//
+// Every thread records into its own counters, so recording takes no locks and causes no cache
+// line sharing between threads; only the first call of a function on a thread allocates. Snapshot()
+// adds up the counters of all threads (including threads that have exited).
+//
+// The histograms are over the raw argument values: bucket 0 counts zeros and bucket b counts
+// values with 2^(b-1) <= |raw| < 2^b. For Fixed64 values bucket b covers magnitudes from
+// 2^(b-33) to 2^(b-32), for Fixed32 values from 2^(b-17) to 2^(b-16).
+//
+// Calls made by the library functions themselves (e.g. Mul() called from Lerp()) are counted too.
+//
+// The functions here are 'inline' rather than 'static' so that all translation units share the
+// same counters.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace FixedInstrument
+{
+    static const int MaxFunctions = 512;
+    static const int NumArgs = 2;           // histograms are kept for the first two arguments
+    static const int NumBuckets = 65;
+
+    struct Counters
+    {
+        std::atomic<uint64_t>   calls;
+        std::atomic<uint64_t>   invalidArgs;
+        std::atomic<uint64_t>   histogram[NumArgs][NumBuckets];
+    };
+
+    // Counters of one thread. Only the owning thread writes to them.
+    struct ThreadCounters
+    {
+        std::atomic<Counters*>  functions[MaxFunctions];
+    };
+
+    /// <summary>
+    /// Counters of one function, summed over all threads.
+    /// </summary>
+    struct FunctionStats
+    {
+        std::string name;
+        uint64_t    calls;
+        uint64_t    invalidArgs;
+        uint64_t    histogram[NumArgs][NumBuckets];
+    };
+
+    class Registry
+    {
+    public:
+        ~Registry()
+        {
+            for (size_t t = 0; t < m_threads.size(); t++)
+            {
+                for (int f = 0; f < MaxFunctions; f++)
+                    delete m_threads[t]->functions[f].load();
+                delete m_threads[t];
+            }
+        }
+
+        int Register(const char* name)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t i = 0; i < m_names.size(); i++)
+            {
+                if (m_names[i] == name)
+                    return (int)i;
+            }
+            if ((int)m_names.size() == MaxFunctions)
+                return -1;
+            m_names.push_back(name);
+            return (int)m_names.size() - 1;
+        }
+
+        ThreadCounters* AddThread()
+        {
+            ThreadCounters* counters = new ThreadCounters();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_threads.push_back(counters);
+            return counters;
+        }
+
+        std::vector<FunctionStats> Snapshot()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<FunctionStats> stats(m_names.size());
+            for (size_t f = 0; f < m_names.size(); f++)
+            {
+                FunctionStats& s = stats[f];
+                memset(s.histogram, 0, sizeof(s.histogram));
+                s.name = m_names[f];
+                s.calls = 0;
+                s.invalidArgs = 0;
+                for (size_t t = 0; t < m_threads.size(); t++)
+                {
+                    const Counters* c = m_threads[t]->functions[f].load(std::memory_order_acquire);
+                    if (!c)
+                        continue;
+                    s.calls += c->calls.load(std::memory_order_relaxed);
+                    s.invalidArgs += c->invalidArgs.load(std::memory_order_relaxed);
+                    for (int a = 0; a < NumArgs; a++)
+                    {
+                        for (int b = 0; b < NumBuckets; b++)
+                            s.histogram[a][b] += c->histogram[a][b].load(std::memory_order_relaxed);
+                    }
+                }
+            }
+            return stats;
+        }
+
+        void Reset()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (size_t t = 0; t < m_threads.size(); t++)
+            {
+                for (int f = 0; f < MaxFunctions; f++)
+                {
+                    Counters* c = m_threads[t]->functions[f].load(std::memory_order_acquire);
+                    if (!c)
+                        continue;
+                    c->calls.store(0, std::memory_order_relaxed);
+                    c->invalidArgs.store(0, std::memory_order_relaxed);
+                    for (int a = 0; a < NumArgs; a++)
+                    {
+                        for (int b = 0; b < NumBuckets; b++)
+                            c->histogram[a][b].store(0, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+    private:
+        std::mutex                      m_mutex;
+        std::vector<std::string>        m_names;
+        std::vector<ThreadCounters*>    m_threads;
+    };
+
+    inline Registry& GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    inline Counters* GetCounters(int id)
+    {
+        thread_local ThreadCounters* local = GetRegistry().AddThread();
+        Counters* counters = local->functions[id].load(std::memory_order_relaxed);
+        if (!counters)
+        {
+            counters = new Counters();
+            local->functions[id].store(counters, std::memory_order_release);
+        }
+        return counters;
+    }
+
+    // Single writer per counter, so a plain load and store is enough (no locked instructions).
+    inline void Increment(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Returns the histogram bucket of a raw value: the number of significant bits of |v|.
+    /// </summary>
+    inline int Bucket(int64_t v)
+    {
+        uint64_t m = (v < 0) ? (uint64_t)0 - (uint64_t)v : (uint64_t)v;
+        int bucket = 0;
+        if (m >> 32) { bucket += 32; m >>= 32; }
+        if (m >> 16) { bucket += 16; m >>= 16; }
+        if (m >> 8) { bucket += 8; m >>= 8; }
+        if (m >> 4) { bucket += 4; m >>= 4; }
+        if (m >> 2) { bucket += 2; m >>= 2; }
+        if (m >> 1) { bucket += 1; m >>= 1; }
+        return bucket + (int)m;
+    }
+
+    /// <summary>
+    /// Returns the id for a function name, registering it on first use. Returns -1 if there are
+    /// too many functions.
+    /// </summary>
+    inline int Register(const char* funcName)
+    {
+        return GetRegistry().Register(funcName);
+    }
+
+    inline void Record(int id)
+    {
+        if (id >= 0)
+            Increment(GetCounters(id)->calls);
+    }
+
+    inline void Record(int id, int64_t a)
+    {
+        if (id < 0)
+            return;
+        Counters* c = GetCounters(id);
+        Increment(c->calls);
+        Increment(c->histogram[0][Bucket(a)]);
+    }
+
+    inline void Record(int id, int64_t a, int64_t b)
+    {
+        if (id < 0)
+            return;
+        Counters* c = GetCounters(id);
+        Increment(c->calls);
+        Increment(c->histogram[0][Bucket(a)]);
+        Increment(c->histogram[1][Bucket(b)]);
+    }
+
+    /// <summary>
+    /// Counts an invalid argument passed to funcName (e.g. "Fixed64::Div").
+    /// </summary>
+    inline void RecordInvalid(const char* funcName)
+    {
+        int id = Register(funcName);
+        if (id >= 0)
+            Increment(GetCounters(id)->invalidArgs);
+    }
+
+    /// <summary>
+    /// Returns the counters of all functions called so far, summed over all threads. Counts that
+    /// are being updated at the same time may or may not be included.
+    /// </summary>
+    inline std::vector<FunctionStats> Snapshot()
+    {
+        return GetRegistry().Snapshot();
+    }
+
+    /// <summary>
+    /// Clears all counters. Should be called while no other thread is calling the library, as
+    /// concurrent updates can be lost or survive the reset.
+    /// </summary>
+    inline void Reset()
+    {
+        GetRegistry().Reset();
+    }
+
+    /// <summary>
+    /// Writes a snapshot as CSV with the columns function,counter,argument,bucket,value. Each
+    /// function has a 'calls' and an 'invalid_args' row, followed by 'histogram' rows for the
+    /// non-empty buckets.
+    /// </summary>
+    inline bool WriteCsv(FILE* file, const std::vector<FunctionStats>& stats)
+    {
+        bool ok = fprintf(file, "function,counter,argument,bucket,value\n") > 0;
+        for (size_t f = 0; f < stats.size(); f++)
+        {
+            const FunctionStats& s = stats[f];
+            ok = ok && fprintf(file, "%s,calls,,,%llu\n", s.name.c_str(), (unsigned long long)s.calls) > 0;
+            ok = ok && fprintf(file, "%s,invalid_args,,,%llu\n", s.name.c_str(), (unsigned long long)s.invalidArgs) > 0;
+            for (int a = 0; a < NumArgs; a++)
+            {
+                for (int b = 0; b < NumBuckets; b++)
+                {
+                    if (s.histogram[a][b] != 0)
+                        ok = ok && fprintf(file, "%s,histogram,%d,%d,%llu\n", s.name.c_str(), a, b, (unsigned long long)s.histogram[a][b]) > 0;
+                }
+            }
+        }
+        return ok;
+    }
+}
+
+#endif // __FIXEDINSTRUMENT_H
@@ -0,0 +1,314 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDPACKED_H
+#define __FIXEDPACKED_H
+
+// Packed 16-bit storage formats and bulk conversions to and from Fixed32 and Fixed64.
+//
+// Q15 (s0.15) covers [-1.0, 1.0( with a precision of 2^-15, suitable for normals, weights and
+// audio samples. Q8_8 (s7.8) covers [-128.0, 128.0( with a precision of 2^-8.
+//
+// Widening is exact. Narrowing drops fractional bits, either rounding to nearest (ties towards
+// positive infinity, like Fixed32::RoundToInt()) or rounding down (like Fixed32::FloorToInt()),
+// and either saturates values outside the 16-bit range or wraps them (keeps the low 16 bits).
+// The SIMD and scalar paths give identical results.
+//
+// AddSat(), SubSat() and MulSatQ15() operate directly on packed values and clamp results to the
+// 16-bit range. They map to the saturating 16-bit SIMD instructions (vpaddsw, vpsubsw, vpmulhrsw).
+
+#include <stdint.h>
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+namespace FixedPacked
+{
+    typedef int16_t FP_SHORT;
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    // Number of fractional bits for the packed formats.
+    static const int ShiftQ15 = 15;
+    static const int ShiftQ8_8 = 8;
+
+    enum Rounding
+    {
+        Round,      // to nearest, ties up
+        Floor,      // towards negative infinity
+    };
+
+    enum Overflow
+    {
+        Saturate,   // clamp to [-32768, 32767]
+        Wrap,       // keep the low 16 bits
+    };
+
+    // Narrows a single value with 'shift' more fractional bits than the packed format.
+    static inline FP_SHORT Narrow(FP_LONG x, int shift, Rounding rounding, Overflow overflow)
+    {
+        if (overflow == Saturate)
+        {
+            // Clamping to the representable range first keeps the rounding from overflowing.
+            FP_LONG lo = INT16_MIN * ((FP_LONG)1 << shift);
+            FP_LONG hi = INT16_MAX * ((FP_LONG)1 << shift);
+            x = (x < lo) ? lo : (x > hi) ? hi : x;
+        }
+        uint64_t half = (rounding == Round) ? ((uint64_t)1 << (shift - 1)) : 0;
+        return (FP_SHORT)(uint16_t)(((uint64_t)x + half) >> shift);
+    }
+
+#if defined(__AVX2__)
+    // Packs the low 16 bits of eight 32-bit lanes.
+    static inline __m128i TruncatePack(__m256i v)
+    {
+        const __m256i pick = _mm256_setr_epi8(
+            0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+            0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, pick), 0x08);
+        return _mm256_castsi256_si128(packed);
+    }
+
+    // Narrows four 64-bit lanes, leaving the result in the low 32 bits of each lane.
+    static inline __m256i Narrow4(__m256i x, int shift, Rounding rounding, Overflow overflow)
+    {
+        if (overflow == Saturate)
+        {
+            __m256i lo = _mm256_set1_epi64x(INT16_MIN * ((FP_LONG)1 << shift));
+            __m256i hi = _mm256_set1_epi64x(INT16_MAX * ((FP_LONG)1 << shift));
+            x = _mm256_blendv_epi8(x, lo, _mm256_cmpgt_epi64(lo, x));
+            x = _mm256_blendv_epi8(x, hi, _mm256_cmpgt_epi64(x, hi));
+        }
+        if (rounding == Round)
+            x = _mm256_add_epi64(x, _mm256_set1_epi64x((FP_LONG)1 << (shift - 1)));
+
+        // A logical shift is fine, only the low 16 bits are kept.
+        return _mm256_srl_epi64(x, _mm_cvtsi32_si128(shift));
+    }
+#endif
+
+    static void WidenToFixed32(const FP_SHORT* src, FP_INT* dst, int count, int shift)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m128i s = _mm_cvtsi32_si128(shift);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)&src[i]));
+            _mm256_storeu_si256((__m256i*)&dst[i], _mm256_sll_epi32(v, s));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = (FP_INT)((uint32_t)(FP_INT)src[i] << shift);
+    }
+
+    static void WidenToFixed64(const FP_SHORT* src, FP_LONG* dst, int count, int shift)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m128i s = _mm_cvtsi32_si128(shift);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i v = _mm256_cvtepi16_epi64(_mm_loadl_epi64((const __m128i*)&src[i]));
+            _mm256_storeu_si256((__m256i*)&dst[i], _mm256_sll_epi64(v, s));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = (FP_LONG)((uint64_t)(FP_LONG)src[i] << shift);
+    }
+
+    static void NarrowFromFixed32(const FP_INT* src, FP_SHORT* dst, int count, int shift, Rounding rounding, Overflow overflow)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        __m128i s = _mm_cvtsi32_si128(shift);
+        __m256i lo = _mm256_set1_epi32(INT16_MIN * (1 << shift));
+        __m256i hi = _mm256_set1_epi32(INT16_MAX * (1 << shift));
+        __m256i half = _mm256_set1_epi32((rounding == Round) ? (1 << (shift - 1)) : 0);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i x = _mm256_loadu_si256((const __m256i*)&src[i]);
+            if (overflow == Saturate)
+                x = _mm256_min_epi32(_mm256_max_epi32(x, lo), hi);
+
+            // Wrapping add and logical shift match the scalar version in the low 16 bits.
+            x = _mm256_srl_epi32(_mm256_add_epi32(x, half), s);
+            _mm_storeu_si128((__m128i*)&dst[i], TruncatePack(x));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            // Only the low 16 bits are kept, so 32-bit arithmetic is enough.
+            FP_INT x = src[i];
+            if (overflow == Saturate)
+            {
+                FP_INT lo = INT16_MIN * (1 << shift);
+                FP_INT hi = INT16_MAX * (1 << shift);
+                x = (x < lo) ? lo : (x > hi) ? hi : x;
+            }
+            uint32_t half = (rounding == Round) ? (1u << (shift - 1)) : 0;
+            dst[i] = (FP_SHORT)(uint16_t)(((uint32_t)x + half) >> shift);
+        }
+    }
+
+    static void NarrowFromFixed64(const FP_LONG* src, FP_SHORT* dst, int count, int shift, Rounding rounding, Overflow overflow)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i a = Narrow4(_mm256_loadu_si256((const __m256i*)&src[i + 0]), shift, rounding, overflow);
+            __m256i b = Narrow4(_mm256_loadu_si256((const __m256i*)&src[i + 4]), shift, rounding, overflow);
+
+            // Gather the low 32 bits of each 64-bit lane into one register.
+            const __m256i order = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+            __m256i lowA = _mm256_permutevar8x32_epi32(a, order);
+            __m256i lowB = _mm256_permutevar8x32_epi32(b, order);
+            _mm_storeu_si128((__m128i*)&dst[i], TruncatePack(_mm256_blend_epi32(lowA, lowB, 0xF0)));
+        }
+#endif
+        for (; i < count; i++)
+            dst[i] = Narrow(src[i], shift, rounding, overflow);
+    }
+
+    /// <summary>
+    /// Converts count Q15 values to Fixed32 (exact).
+    /// </summary>
+    static void Q15ToFixed32(const FP_SHORT* src, FP_INT* dst, int count) { WidenToFixed32(src, dst, count, 16 - ShiftQ15); }
+
+    /// <summary>
+    /// Converts count Q8_8 values to Fixed32 (exact).
+    /// </summary>
+    static void Q8_8ToFixed32(const FP_SHORT* src, FP_INT* dst, int count) { WidenToFixed32(src, dst, count, 16 - ShiftQ8_8); }
+
+    /// <summary>
+    /// Converts count Q15 values to Fixed64 (exact).
+    /// </summary>
+    static void Q15ToFixed64(const FP_SHORT* src, FP_LONG* dst, int count) { WidenToFixed64(src, dst, count, 32 - ShiftQ15); }
+
+    /// <summary>
+    /// Converts count Q8_8 values to Fixed64 (exact).
+    /// </summary>
+    static void Q8_8ToFixed64(const FP_SHORT* src, FP_LONG* dst, int count) { WidenToFixed64(src, dst, count, 32 - ShiftQ8_8); }
+
+    /// <summary>
+    /// Converts count Fixed32 values to Q15.
+    /// </summary>
+    static void Fixed32ToQ15(const FP_INT* src, FP_SHORT* dst, int count, Rounding rounding = Round, Overflow overflow = Saturate)
+    {
+        NarrowFromFixed32(src, dst, count, 16 - ShiftQ15, rounding, overflow);
+    }
+
+    /// <summary>
+    /// Converts count Fixed32 values to Q8_8.
+    /// </summary>
+    static void Fixed32ToQ8_8(const FP_INT* src, FP_SHORT* dst, int count, Rounding rounding = Round, Overflow overflow = Saturate)
+    {
+        NarrowFromFixed32(src, dst, count, 16 - ShiftQ8_8, rounding, overflow);
+    }
+
+    /// <summary>
+    /// Converts count Fixed64 values to Q15.
+    /// </summary>
+    static void Fixed64ToQ15(const FP_LONG* src, FP_SHORT* dst, int count, Rounding rounding = Round, Overflow overflow = Saturate)
+    {
+        NarrowFromFixed64(src, dst, count, 32 - ShiftQ15, rounding, overflow);
+    }
+
+    /// <summary>
+    /// Converts count Fixed64 values to Q8_8.
+    /// </summary>
+    static void Fixed64ToQ8_8(const FP_LONG* src, FP_SHORT* dst, int count, Rounding rounding = Round, Overflow overflow = Saturate)
+    {
+        NarrowFromFixed64(src, dst, count, 32 - ShiftQ8_8, rounding, overflow);
+    }
+
+    static inline FP_SHORT Clamp16(FP_INT x)
+    {
+        return (FP_SHORT)((x < INT16_MIN) ? INT16_MIN : (x > INT16_MAX) ? INT16_MAX : x);
+    }
+
+    /// <summary>
+    /// Adds count packed values (Q15 or Q8_8) together, saturating to the 16-bit range.
+    /// </summary>
+    static void AddSat(const FP_SHORT* a, const FP_SHORT* b, FP_SHORT* result, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i va = _mm256_loadu_si256((const __m256i*)&a[i]);
+            __m256i vb = _mm256_loadu_si256((const __m256i*)&b[i]);
+            _mm256_storeu_si256((__m256i*)&result[i], _mm256_adds_epi16(va, vb));
+        }
+#endif
+        for (; i < count; i++)
+            result[i] = Clamp16((FP_INT)a[i] + b[i]);
+    }
+
+    /// <summary>
+    /// Subtracts count packed values (Q15 or Q8_8) from each other, saturating to the 16-bit range.
+    /// </summary>
+    static void SubSat(const FP_SHORT* a, const FP_SHORT* b, FP_SHORT* result, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i va = _mm256_loadu_si256((const __m256i*)&a[i]);
+            __m256i vb = _mm256_loadu_si256((const __m256i*)&b[i]);
+            _mm256_storeu_si256((__m256i*)&result[i], _mm256_subs_epi16(va, vb));
+        }
+#endif
+        for (; i < count; i++)
+            result[i] = Clamp16((FP_INT)a[i] - b[i]);
+    }
+
+    /// <summary>
+    /// Multiplies count Q15 values together, rounding to nearest and saturating to the 16-bit range.
+    /// Only -1.0 * -1.0 overflows, and it returns the largest Q15 value.
+    /// </summary>
+    static void MulSatQ15(const FP_SHORT* a, const FP_SHORT* b, FP_SHORT* result, int count)
+    {
+        int i = 0;
+#if defined(__AVX2__)
+        const __m256i minValue = _mm256_set1_epi16(INT16_MIN);
+        for (; i + 16 <= count; i += 16)
+        {
+            __m256i va = _mm256_loadu_si256((const __m256i*)&a[i]);
+            __m256i vb = _mm256_loadu_si256((const __m256i*)&b[i]);
+
+            // vpmulhrsw wraps -1.0 * -1.0 to 0x8000, flipping the bits turns that into 0x7FFF.
+            __m256i product = _mm256_mulhrs_epi16(va, vb);
+            __m256i overflow = _mm256_and_si256(_mm256_cmpeq_epi16(va, minValue), _mm256_cmpeq_epi16(vb, minValue));
+            _mm256_storeu_si256((__m256i*)&result[i], _mm256_xor_si256(product, overflow));
+        }
+#endif
+        for (; i < count; i++)
+            result[i] = Clamp16(((FP_INT)a[i] * b[i] + (1 << (ShiftQ15 - 1))) >> ShiftQ15);
+    }
+}
+
+#endif // __FIXEDPACKED_H
@@ -0,0 +1,329 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDPARALLEL_H
+#define __FIXEDPARALLEL_H
+
+// Work-stealing thread pool for running independent tasks (image tiles, array chunks, ..).
+//
+// Run() splits the task indices into contiguous runs, one per thread. Each thread takes tasks
+// from the front of its own queue and, when that runs out, steals from the back of the other
+// queues. The calling thread participates as one of the workers.
+//
+// ParallelFor() and ParallelBatch() split an index range (e.g. the elements of a batch operation)
+// into fixed-size chunks and run them on a pool. The chunk boundaries only depend on the element
+// count and the grain size, never on the number of threads or on which thread runs which chunk.
+
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#elif defined(__linux__)
+#   include <pthread.h>
+#   include <sched.h>
+#endif
+
+namespace FixedParallel
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    // Size of the chunks ParallelBatch() splits arrays into, by default. Small enough that the
+    // inputs and outputs of a chunk stay in the L2 cache.
+    static const int ChunkBytes = 64 * 1024;
+
+    enum Affinity
+    {
+        NoAffinity,     // let the OS schedule the worker threads
+        PinThreads,     // pin worker thread i to logical CPU i (modulo the CPU count)
+    };
+
+    // Pins the calling thread to a single logical CPU. Returns false if not supported.
+    static inline bool PinCurrentThread(int cpu)
+    {
+#if defined(_WIN32)
+        return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (cpu % 64)) != 0;
+#elif defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu % CPU_SETSIZE, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        (void)cpu;
+        return false;
+#endif
+    }
+
+    class ThreadPool
+    {
+    public:
+        /// <summary>
+        /// Creates a pool with numThreads threads in total, including the thread calling Run().
+        /// Zero means one thread per hardware thread. With PinThreads, worker thread i (1 and up)
+        /// is pinned to logical CPU i. The calling thread is left as is.
+        /// </summary>
+        explicit ThreadPool(int numThreads = 0, Affinity affinity = NoAffinity)
+            : m_job(0)
+            , m_generation(0)
+            , m_numActive(0)
+            , m_stop(false)
+        {
+            if (numThreads <= 0)
+                numThreads = (int)std::thread::hardware_concurrency();
+            if (numThreads <= 0)
+                numThreads = 1;
+
+            for (int i = 0; i < numThreads; i++)
+                m_queues.push_back(std::unique_ptr<Queue>(new Queue()));
+            for (int i = 1; i < numThreads; i++)
+                m_workers.push_back(std::thread(&ThreadPool::WorkerMain, this, i, affinity));
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wakeCv.notify_all();
+            for (size_t i = 0; i < m_workers.size(); i++)
+                m_workers[i].join();
+        }
+
+        int NumThreads() const { return (int)m_queues.size(); }
+
+        /// <summary>
+        /// Calls func(taskIndex) for every task in [0, numTasks) and waits for all of them to
+        /// finish. Tasks may run in any order and on any thread. Only one Run() may be in progress
+        /// at a time.
+        /// </summary>
+        void Run(int numTasks, const std::function<void(int)>& func)
+        {
+            int numThreads = NumThreads();
+            if (numThreads == 1 || numTasks <= 1)
+            {
+                for (int i = 0; i < numTasks; i++)
+                    func(i);
+                return;
+            }
+
+            for (int q = 0; q < numThreads; q++)
+            {
+                std::lock_guard<std::mutex> lock(m_queues[q]->mutex);
+                int begin = (int)((int64_t)numTasks * q / numThreads);
+                int end = (int)((int64_t)numTasks * (q + 1) / numThreads);
+                for (int i = begin; i < end; i++)
+                    m_queues[q]->tasks.push_back(i);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_job = &func;
+                m_numActive = numThreads - 1;
+                m_generation++;
+            }
+            m_wakeCv.notify_all();
+
+            Work(0, func);
+
+            // Workers only go idle once all queues are empty and their own tasks have finished.
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_doneCv.wait(lock, [this] { return m_numActive == 0; });
+            m_job = 0;
+        }
+
+    private:
+        struct Queue
+        {
+            std::mutex      mutex;
+            std::deque<int> tasks;
+        };
+
+        bool PopOwn(int self, int& task)
+        {
+            Queue& queue = *m_queues[self];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                return false;
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            return true;
+        }
+
+        bool Steal(int self, int& task)
+        {
+            int numThreads = NumThreads();
+            for (int i = 1; i < numThreads; i++)
+            {
+                Queue& queue = *m_queues[(self + i) % numThreads];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (!queue.tasks.empty())
+                {
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Work(int self, const std::function<void(int)>& func)
+        {
+            // No tasks are added during a Run(), so once every queue is empty we are done.
+            int task;
+            while (PopOwn(self, task) || Steal(self, task))
+                func(task);
+        }
+
+        void WorkerMain(int self, Affinity affinity)
+        {
+            if (affinity == PinThreads)
+            {
+                int numCpus = (int)std::thread::hardware_concurrency();
+                PinCurrentThread(self % ((numCpus > 0) ? numCpus : 1));
+            }
+
+            uint64_t seenGeneration = 0;
+            for (;;)
+            {
+                const std::function<void(int)>* job;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wakeCv.wait(lock, [&] { return m_stop || m_generation != seenGeneration; });
+                    if (m_stop)
+                        return;
+                    seenGeneration = m_generation;
+                    job = m_job;
+                }
+
+                Work(self, *job);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_numActive == 0)
+                    m_doneCv.notify_all();
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>>     m_queues;   // one per thread, index 0 is the caller of Run()
+        std::vector<std::thread>                m_workers;
+        std::mutex                              m_mutex;
+        std::condition_variable                 m_wakeCv;
+        std::condition_variable                 m_doneCv;
+        const std::function<void(int)>*         m_job;
+        uint64_t                                m_generation;
+        int                                     m_numActive;
+        bool                                    m_stop;
+    };
+
+    /// <summary>
+    /// Returns the number of elements per chunk that keeps a chunk at about ChunkBytes, when each
+    /// element reads and writes bytesPerElement bytes in total.
+    /// </summary>
+    static inline int GrainSize(int bytesPerElement)
+    {
+        int grain = ChunkBytes / ((bytesPerElement > 0) ? bytesPerElement : 1);
+        return (grain > 0) ? grain : 1;
+    }
+
+    /// <summary>
+    /// Splits [0, count) into chunks of grainSize elements (the last one may be shorter) and calls
+    /// func(begin, end) for each chunk on the threads of the pool. Runs func(0, count) inline if
+    /// there is only one chunk or one thread.
+    /// </summary>
+    template <typename Func>
+    static void ParallelFor(ThreadPool& pool, int count, int grainSize, const Func& func)
+    {
+        if (count <= 0)
+            return;
+        if (grainSize <= 0)
+            grainSize = 1;
+        if (count <= grainSize || pool.NumThreads() == 1)
+        {
+            func(0, count);
+            return;
+        }
+
+        int numChunks = (int)(((FP_LONG)count + grainSize - 1) / grainSize);
+        pool.Run(numChunks, [&](int chunk)
+        {
+            int begin = chunk * grainSize;
+            int end = (count - begin < grainSize) ? count : begin + grainSize;
+            func(begin, end);
+        });
+    }
+
+    /// <summary>
+    /// Runs a unary batch operation (e.g. Fixed64::SqrtBatch) over count elements on the pool.
+    /// Zero grainSize picks a chunk size from ChunkBytes.
+    /// </summary>
+    template <typename T>
+    static void ParallelBatch(ThreadPool& pool, void (*batch)(T*, T*, FP_INT), T* x, T* result, int count, int grainSize = 0)
+    {
+        ParallelFor(pool, count, (grainSize > 0) ? grainSize : GrainSize(2 * sizeof(T)), [&](int begin, int end)
+        {
+            batch(x + begin, result + begin, end - begin);
+        });
+    }
+
+    /// <summary>
+    /// Runs a binary batch operation (e.g. Fixed64::MulBatch) over count elements on the pool.
+    /// Zero grainSize picks a chunk size from ChunkBytes.
+    /// </summary>
+    template <typename T>
+    static void ParallelBatch(ThreadPool& pool, void (*batch)(T*, T*, T*, FP_INT), T* a, T* b, T* result, int count, int grainSize = 0)
+    {
+        ParallelFor(pool, count, (grainSize > 0) ? grainSize : GrainSize(3 * sizeof(T)), [&](int begin, int end)
+        {
+            batch(a + begin, b + begin, result + begin, end - begin);
+        });
+    }
+
+    /// <summary>
+    /// Runs a ternary batch operation (e.g. Fixed64::LerpSatBatch) over count elements on the pool.
+    /// Zero grainSize picks a chunk size from ChunkBytes.
+    /// </summary>
+    template <typename T>
+    static void ParallelBatch(ThreadPool& pool, void (*batch)(T*, T*, T*, T*, FP_INT), T* a, T* b, T* c, T* result, int count, int grainSize = 0)
+    {
+        ParallelFor(pool, count, (grainSize > 0) ? grainSize : GrainSize(4 * sizeof(T)), [&](int begin, int end)
+        {
+            batch(a + begin, b + begin, c + begin, result + begin, end - begin);
+        });
+    }
+}
+
+#endif // __FIXEDPARALLEL_H
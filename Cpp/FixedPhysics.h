@@ -0,0 +1,461 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDPHYSICS_H
+#define __FIXEDPHYSICS_H
+
+// Deterministic rigid-body simulation of spheres on Fixed64 (s32.32).
+//
+// Body state is stored as structure-of-arrays, so the integrators can run the Fixed64 batch
+// kernels over contiguous data. Contacts (sphere-sphere and sphere-ground) are resolved with a
+// sequential impulse solver. The contacts are grouped into batches in which no two contacts touch
+// the same body, so each batch can be solved in parallel; batches are always solved in the same
+// order, which keeps the results bit-identical for any thread count.
+//
+// The contacts are frictionless, so they do not apply torques: angular velocities only affect
+// the integrated orientations.
+
+#include <stdint.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "Fixed64.h"
+#include "FixedParallel.h"
+
+namespace FixedPhysics
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    class World
+    {
+    public:
+        // Body state (one element per body).
+        std::vector<FP_LONG> posX, posY, posZ;
+        std::vector<FP_LONG> prevX, prevY, prevZ;       // positions at the previous step (Verlet)
+        std::vector<FP_LONG> velX, velY, velZ;
+        std::vector<FP_LONG> rotW, rotX, rotY, rotZ;    // orientation quaternions
+        std::vector<FP_LONG> angX, angY, angZ;          // angular velocities (radians per second)
+        std::vector<FP_LONG> invMass;                   // zero for static bodies
+        std::vector<FP_LONG> radius;
+
+        // Contacts found by FindContacts(). Normals point from body A to body B (-1 is the ground).
+        std::vector<FP_INT>  contactA, contactB;
+        std::vector<FP_LONG> contactNX, contactNY, contactNZ;
+        std::vector<FP_LONG> contactDepth;
+
+        FP_LONG gravityX, gravityY, gravityZ;
+        FP_LONG groundY;            // height of the ground plane
+        FP_LONG baumgarte;          // fraction of the penetration resolved per step
+        FP_LONG slop;               // allowed penetration
+        int     numThreads;
+
+        World()
+            : gravityX(0), gravityY(Fixed64::FromDouble(-9.81)), gravityZ(0)
+            , groundY(0)
+            , baumgarte(Fixed64::FromDouble(0.2))
+            , slop(Fixed64::FromDouble(0.005))
+            , numThreads(1)
+        {
+        }
+
+        int NumBodies() const { return (int)posX.size(); }
+
+        /// <summary>
+        /// Adds a sphere at rest and returns its index. Use zero invMass for static bodies.
+        /// </summary>
+        int AddBody(FP_LONG x, FP_LONG y, FP_LONG z, FP_LONG r, FP_LONG invM)
+        {
+            posX.push_back(x); posY.push_back(y); posZ.push_back(z);
+            prevX.push_back(x); prevY.push_back(y); prevZ.push_back(z);
+            velX.push_back(0); velY.push_back(0); velZ.push_back(0);
+            rotW.push_back(Fixed64::One); rotX.push_back(0); rotY.push_back(0); rotZ.push_back(0);
+            angX.push_back(0); angY.push_back(0); angZ.push_back(0);
+            invMass.push_back(invM);
+            radius.push_back(r);
+            m_scratch.resize(posX.size());
+            return (int)posX.size() - 1;
+        }
+
+        /// <summary>
+        /// Advances the simulation by dt: gravity, contact resolution, then position integration
+        /// (semi-implicit Euler).
+        /// </summary>
+        void Step(FP_LONG dt, int numIterations)
+        {
+            ApplyGravity(dt);
+            FindContacts();
+            SolveContacts(dt, numIterations);
+            IntegratePositions(dt);
+        }
+
+        /// <summary>
+        /// Semi-implicit Euler step without contacts: v += g*dt, x += v*dt.
+        /// </summary>
+        void IntegrateEuler(FP_LONG dt)
+        {
+            ApplyGravity(dt);
+            IntegratePositions(dt);
+        }
+
+        void ApplyGravity(FP_LONG dt)
+        {
+            FP_LONG dvx = Fixed64::Mul(gravityX, dt);
+            FP_LONG dvy = Fixed64::Mul(gravityY, dt);
+            FP_LONG dvz = Fixed64::Mul(gravityZ, dt);
+            ParallelRanges(NumBodies(), [&](int begin, int end)
+            {
+                for (int i = begin; i < end; i++)
+                {
+                    if (invMass[i] == 0)
+                        continue;
+                    velX[i] += dvx;
+                    velY[i] += dvy;
+                    velZ[i] += dvz;
+                }
+            });
+        }
+
+        /// <summary>
+        /// Integrates positions and orientations with the current velocities. The previous positions
+        /// are kept in prevX/prevY/prevZ, so Verlet steps can follow.
+        /// </summary>
+        void IntegratePositions(FP_LONG dt)
+        {
+            FP_LONG halfDt = dt >> 1;
+            ParallelRanges(NumBodies(), [&](int begin, int end)
+            {
+                int count = end - begin;
+                for (int i = begin; i < end; i++)
+                {
+                    if (invMass[i] == 0)
+                        continue;
+                    prevX[i] = posX[i];
+                    prevY[i] = posY[i];
+                    prevZ[i] = posZ[i];
+                    posX[i] += Fixed64::Mul(velX[i], dt);
+                    posY[i] += Fixed64::Mul(velY[i], dt);
+                    posZ[i] += Fixed64::Mul(velZ[i], dt);
+                }
+
+                // q += 0.5 * dt * (0, w) * q
+                for (int i = begin; i < end; i++)
+                {
+                    FP_LONG wx = Fixed64::Mul(angX[i], halfDt), wy = Fixed64::Mul(angY[i], halfDt), wz = Fixed64::Mul(angZ[i], halfDt);
+                    FP_LONG qw = rotW[i], qx = rotX[i], qy = rotY[i], qz = rotZ[i];
+                    rotW[i] = qw - Fixed64::Mul(wx, qx) - Fixed64::Mul(wy, qy) - Fixed64::Mul(wz, qz);
+                    rotX[i] = qx + Fixed64::Mul(wx, qw) + Fixed64::Mul(wy, qz) - Fixed64::Mul(wz, qy);
+                    rotY[i] = qy + Fixed64::Mul(wy, qw) + Fixed64::Mul(wz, qx) - Fixed64::Mul(wx, qz);
+                    rotZ[i] = qz + Fixed64::Mul(wz, qw) + Fixed64::Mul(wx, qy) - Fixed64::Mul(wy, qx);
+                    m_scratch[i] = Fixed64::Mul(rotW[i], rotW[i]) + Fixed64::Mul(rotX[i], rotX[i]) + Fixed64::Mul(rotY[i], rotY[i]) + Fixed64::Mul(rotZ[i], rotZ[i]);
+                }
+
+                // Renormalize the quaternions.
+                Fixed64::RSqrtBatch(&m_scratch[begin], &m_scratch[begin], count);
+                Fixed64::MulBatch(&rotW[begin], &m_scratch[begin], &rotW[begin], count);
+                Fixed64::MulBatch(&rotX[begin], &m_scratch[begin], &rotX[begin], count);
+                Fixed64::MulBatch(&rotY[begin], &m_scratch[begin], &rotY[begin], count);
+                Fixed64::MulBatch(&rotZ[begin], &m_scratch[begin], &rotZ[begin], count);
+            });
+        }
+
+        /// <summary>
+        /// Position Verlet step without contacts: x' = 2x - x_prev + g*dt^2. Velocities are updated
+        /// from the position change.
+        /// </summary>
+        void IntegrateVerlet(FP_LONG dt)
+        {
+            FP_LONG dt2 = Fixed64::Mul(dt, dt);
+            FP_LONG ax = Fixed64::Mul(gravityX, dt2), ay = Fixed64::Mul(gravityY, dt2), az = Fixed64::Mul(gravityZ, dt2);
+            FP_LONG rcpDt = Fixed64::Rcp(dt);
+            ParallelRanges(NumBodies(), [&](int begin, int end)
+            {
+                for (int i = begin; i < end; i++)
+                {
+                    if (invMass[i] == 0)
+                        continue;
+                    FP_LONG x = posX[i], y = posY[i], z = posZ[i];
+                    posX[i] = x + (x - prevX[i]) + ax;
+                    posY[i] = y + (y - prevY[i]) + ay;
+                    posZ[i] = z + (z - prevZ[i]) + az;
+                    prevX[i] = x;
+                    prevY[i] = y;
+                    prevZ[i] = z;
+                    velX[i] = Fixed64::Mul(posX[i] - x, rcpDt);
+                    velY[i] = Fixed64::Mul(posY[i] - y, rcpDt);
+                    velZ[i] = Fixed64::Mul(posZ[i] - z, rcpDt);
+                }
+            });
+        }
+
+        /// <summary>
+        /// Finds all sphere-ground and sphere-sphere contacts (sweep and prune along x).
+        /// </summary>
+        void FindContacts()
+        {
+            int n = NumBodies();
+            contactA.clear();
+            contactB.clear();
+            contactNX.clear();
+            contactNY.clear();
+            contactNZ.clear();
+            contactDepth.clear();
+
+            for (int i = 0; i < n; i++)
+            {
+                FP_LONG depth = groundY - (posY[i] - radius[i]);
+                if (invMass[i] != 0 && depth > 0)
+                    AddContact(i, -1, 0, -Fixed64::One, 0, depth);
+            }
+
+            // Sort by the lower x bound (ties broken by index, so the order is deterministic).
+            m_order.resize(n);
+            for (int i = 0; i < n; i++)
+                m_order[i] = i;
+            std::sort(m_order.begin(), m_order.end(), [&](FP_INT a, FP_INT b)
+            {
+                FP_LONG ma = posX[a] - radius[a], mb = posX[b] - radius[b];
+                return (ma != mb) ? (ma < mb) : (a < b);
+            });
+
+            // Collect overlapping pairs with their squared distances.
+            m_pairDistSq.clear();
+            m_coincidentPairs.clear();
+            size_t firstPair = contactA.size();
+            for (int oi = 0; oi < n; oi++)
+            {
+                int a = m_order[oi];
+                FP_LONG maxX = posX[a] + radius[a];
+                for (int oj = oi + 1; oj < n; oj++)
+                {
+                    int b = m_order[oj];
+                    if (posX[b] - radius[b] > maxX)
+                        break;
+                    if (invMass[a] == 0 && invMass[b] == 0)
+                        continue;
+
+                    FP_LONG r = radius[a] + radius[b];
+                    FP_LONG dx = posX[b] - posX[a], dy = posY[b] - posY[a], dz = posZ[b] - posZ[a];
+                    if (Fixed64::Abs(dy) >= r || Fixed64::Abs(dz) >= r)
+                        continue;
+
+                    FP_LONG distSq = Fixed64::Mul(dx, dx) + Fixed64::Mul(dy, dy) + Fixed64::Mul(dz, dz);
+                    if (distSq >= Fixed64::Mul(r, r))
+                        continue;
+
+                    // Coincident centers get an arbitrary (upward) normal and zero distance, which is
+                    // fixed up after the batch normalization (RSqrt() does not accept 0).
+                    if (distSq == 0)
+                    {
+                        m_coincidentPairs.push_back((FP_INT)m_pairDistSq.size());
+                        dy = Fixed64::One;
+                        distSq = Fixed64::One;
+                    }
+                    AddContact(a, b, dx, dy, dz, r);
+                    m_pairDistSq.push_back(distSq);
+                }
+            }
+
+            // Normalize the pair normals and compute the depths with the batch kernels.
+            int numPairs = (int)m_pairDistSq.size();
+            if (numPairs > 0)
+            {
+                m_pairRcpDist.resize(numPairs);
+                m_pairDist.resize(numPairs);
+                Fixed64::RSqrtBatch(&m_pairDistSq[0], &m_pairRcpDist[0], numPairs);
+                Fixed64::MulBatch(&contactNX[firstPair], &m_pairRcpDist[0], &contactNX[firstPair], numPairs);
+                Fixed64::MulBatch(&contactNY[firstPair], &m_pairRcpDist[0], &contactNY[firstPair], numPairs);
+                Fixed64::MulBatch(&contactNZ[firstPair], &m_pairRcpDist[0], &contactNZ[firstPair], numPairs);
+                Fixed64::MulBatch(&m_pairDistSq[0], &m_pairRcpDist[0], &m_pairDist[0], numPairs);
+                for (size_t k = 0; k < m_coincidentPairs.size(); k++)
+                {
+                    int p = m_coincidentPairs[k];
+                    contactNY[firstPair + p] = Fixed64::One;
+                    m_pairDist[p] = 0;
+                }
+                for (int p = 0; p < numPairs; p++)
+                    contactDepth[firstPair + p] -= m_pairDist[p];
+            }
+        }
+
+        /// <summary>
+        /// Resolves the current contacts with numIterations rounds of sequential impulses.
+        /// </summary>
+        void SolveContacts(FP_LONG dt, int numIterations)
+        {
+            int numContacts = (int)contactA.size();
+            if (numContacts == 0)
+                return;
+
+            // Effective masses and velocity biases (baumgarte * penetration / dt).
+            FP_LONG biasRate = Fixed64::Mul(baumgarte, Fixed64::Rcp(dt));
+            m_mass.resize(numContacts);
+            m_bias.resize(numContacts);
+            m_impulse.assign(numContacts, 0);
+            for (int c = 0; c < numContacts; c++)
+            {
+                m_mass[c] = invMass[contactA[c]] + ((contactB[c] >= 0) ? invMass[contactB[c]] : 0);
+                m_bias[c] = Fixed64::Mul(biasRate, Fixed64::Max(contactDepth[c] - slop, 0));
+            }
+            Fixed64::RcpBatch(&m_mass[0], &m_mass[0], numContacts);
+
+            // Assign each contact to the first batch after all earlier batches using its (dynamic) bodies.
+            // Static bodies are never written to, so they can be shared within a batch.
+            int n = NumBodies();
+            m_nextBatch.assign(n, 0);
+            m_contactBatch.resize(numContacts);
+            int numBatches = 0;
+            for (int c = 0; c < numContacts; c++)
+            {
+                int a = contactA[c], b = contactB[c];
+                int batch = 0;
+                if (IsDynamic(a))
+                    batch = m_nextBatch[a];
+                if (IsDynamic(b))
+                    batch = std::max(batch, m_nextBatch[b]);
+                m_contactBatch[c] = batch;
+                if (IsDynamic(a))
+                    m_nextBatch[a] = batch + 1;
+                if (IsDynamic(b))
+                    m_nextBatch[b] = batch + 1;
+                numBatches = std::max(numBatches, batch + 1);
+            }
+
+            // Counting sort of the contacts by batch (stable).
+            m_batchStart.assign(numBatches + 1, 0);
+            for (int c = 0; c < numContacts; c++)
+                m_batchStart[m_contactBatch[c] + 1]++;
+            for (int b = 0; b < numBatches; b++)
+                m_batchStart[b + 1] += m_batchStart[b];
+            m_batchContacts.resize(numContacts);
+            m_nextBatch.assign(m_batchStart.begin(), m_batchStart.end() - 1);
+            for (int c = 0; c < numContacts; c++)
+                m_batchContacts[m_nextBatch[m_contactBatch[c]]++] = c;
+
+            for (int iter = 0; iter < numIterations; iter++)
+            {
+                for (int b = 0; b < numBatches; b++)
+                {
+                    const FP_INT* contacts = &m_batchContacts[m_batchStart[b]];
+                    ParallelRanges(m_batchStart[b + 1] - m_batchStart[b], [&](int begin, int end)
+                    {
+                        for (int k = begin; k < end; k++)
+                            SolveContact(contacts[k]);
+                    });
+                }
+            }
+        }
+
+    private:
+        // Calls func(begin, end) for chunks of [0, count), on a pool of numThreads threads.
+        template <typename Func>
+        void ParallelRanges(int count, const Func& func)
+        {
+            if (numThreads <= 1)
+            {
+                if (count > 0)
+                    func(0, count);
+                return;
+            }
+
+            if (!m_pool.pool || m_pool.pool->NumThreads() != numThreads)
+                m_pool.pool.reset(new FixedParallel::ThreadPool(numThreads));
+
+            // A few chunks per thread, so that stealing can even out the load.
+            int grainSize = std::max(count / (numThreads * 4), 64);
+            FixedParallel::ParallelFor(*m_pool.pool, count, grainSize, func);
+        }
+
+        bool IsDynamic(int i) const
+        {
+            return (i >= 0) && (invMass[i] != 0);
+        }
+
+        void AddContact(int a, int b, FP_LONG nx, FP_LONG ny, FP_LONG nz, FP_LONG depth)
+        {
+            contactA.push_back(a);
+            contactB.push_back(b);
+            contactNX.push_back(nx);
+            contactNY.push_back(ny);
+            contactNZ.push_back(nz);
+            contactDepth.push_back(depth);
+        }
+
+        void SolveContact(int c)
+        {
+            int a = contactA[c], b = contactB[c];
+            FP_LONG nx = contactNX[c], ny = contactNY[c], nz = contactNZ[c];
+
+            // Relative velocity of B with respect to A along the normal (negative when approaching).
+            FP_LONG rvx = -velX[a], rvy = -velY[a], rvz = -velZ[a];
+            if (b >= 0)
+            {
+                rvx += velX[b];
+                rvy += velY[b];
+                rvz += velZ[b];
+            }
+            FP_LONG vn = Fixed64::Mul(rvx, nx) + Fixed64::Mul(rvy, ny) + Fixed64::Mul(rvz, nz);
+
+            // Clamp the accumulated impulse so that contacts only push.
+            FP_LONG lambda = Fixed64::Mul(m_mass[c], m_bias[c] - vn);
+            FP_LONG newImpulse = Fixed64::Max(m_impulse[c] + lambda, 0);
+            lambda = newImpulse - m_impulse[c];
+            m_impulse[c] = newImpulse;
+
+            FP_LONG px = Fixed64::Mul(lambda, nx), py = Fixed64::Mul(lambda, ny), pz = Fixed64::Mul(lambda, nz);
+            if (IsDynamic(a))
+            {
+                velX[a] -= Fixed64::Mul(px, invMass[a]);
+                velY[a] -= Fixed64::Mul(py, invMass[a]);
+                velZ[a] -= Fixed64::Mul(pz, invMass[a]);
+            }
+            if (IsDynamic(b))
+            {
+                velX[b] += Fixed64::Mul(px, invMass[b]);
+                velY[b] += Fixed64::Mul(py, invMass[b]);
+                velZ[b] += Fixed64::Mul(pz, invMass[b]);
+            }
+        }
+
+        // Each world owns its thread pool. Copying a world does not copy the pool: the copy creates
+        // its own on first use, so copies can be stepped concurrently.
+        struct OwnedPool
+        {
+            std::unique_ptr<FixedParallel::ThreadPool> pool;
+
+            OwnedPool() {}
+            OwnedPool(const OwnedPool&) {}
+            OwnedPool& operator=(const OwnedPool&) { return *this; }
+        };
+
+        OwnedPool            m_pool;
+        std::vector<FP_LONG> m_scratch;
+        std::vector<FP_INT>  m_order, m_coincidentPairs;
+        std::vector<FP_LONG> m_pairDistSq, m_pairRcpDist, m_pairDist;
+        std::vector<FP_LONG> m_mass, m_bias, m_impulse;
+        std::vector<FP_INT>  m_nextBatch, m_contactBatch, m_batchStart, m_batchContacts;
+    };
+}
+
+#endif // __FIXEDPHYSICS_H
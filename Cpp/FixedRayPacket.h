@@ -0,0 +1,484 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDRAYPACKET_H
+#define __FIXEDRAYPACKET_H
+
+// Ray packet intersection kernels on Fixed64 (s32.32) values.
+//
+// A packet holds 8 rays in structure-of-arrays layout. Each kernel tests all active lanes of a
+// packet against one primitive and returns a bit mask of the lanes that hit. With AVX2, the dot
+// products, square roots and reciprocals are evaluated for 4 lanes at a time; otherwise the
+// square root or reciprocal is only evaluated for the lanes that survive the cheaper tests. A
+// kernel returns as soon as no lanes are left. Results are bit-identical to the scalar per-ray versions (IntersectSphere1(),
+// IntersectPlane1()), which follow Examples/FixedTracer.
+//
+// A hit updates the lane's maxDist, so testing a packet against a list of primitives finds the
+// nearest hits. For visibility queries, clear the hit lanes from the active mask instead and stop
+// when it becomes zero.
+
+#include <stdint.h>
+#include "Fixed64.h"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+namespace FixedRayPacket
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    static const int PacketSize = 8;
+    static const int AllLanes = (1 << PacketSize) - 1;
+
+    // Planes only report hits for rays that approach them at least this steeply (2^-8).
+    static const FP_LONG PlaneEpsilon = (FP_LONG)1 << 24;
+
+    struct RayPacket
+    {
+        alignas(32) FP_LONG originX[PacketSize];
+        alignas(32) FP_LONG originY[PacketSize];
+        alignas(32) FP_LONG originZ[PacketSize];
+        alignas(32) FP_LONG dirX[PacketSize];      // directions must be normalized
+        alignas(32) FP_LONG dirY[PacketSize];
+        alignas(32) FP_LONG dirZ[PacketSize];
+        alignas(32) FP_LONG maxDist[PacketSize];   // only hits in (0, maxDist) are reported
+    };
+
+    /// <summary>
+    /// Calculates both the square root and the reciprocal square root of x, sharing the range
+    /// reduction and a single polynomial evaluation. The reciprocal square root is identical to
+    /// Fixed64::RSqrtFast(), the square root is x * RSqrtFast(x). Returns zeros for x <= 0.
+    /// </summary>
+    static void SqrtRSqrt(FP_LONG x, FP_LONG& sqrtX, FP_LONG& rsqrtX)
+    {
+        if (x <= 0)
+        {
+            sqrtX = 0;
+            rsqrtX = 0;
+            return;
+        }
+
+        // Constants (s2.30).
+        static const FP_INT ONE = (1 << 30);
+        static const FP_INT HALF_SQRT2 = 759250125; // 0.5 * sqrt(2.0)
+
+        // Normalize input into [1.0, 2.0( range (as s2.30).
+        FP_INT offset = 31 - Fixed64::Nlz((Fixed64::FP_ULONG)x);
+        FP_INT n = (FP_INT)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        FP_INT y = FixedUtil::RSqrtPoly5(n - ONE);
+
+        // Divide offset by 2, compute adjust value for odd exponents.
+        FP_INT adjust = ((offset & 1) != 0) ? HALF_SQRT2 : ONE;
+        offset = offset >> 1;
+
+        // Apply exponent, convert back to s32.32.
+        FP_LONG yr = (FP_LONG)FixedUtil::Qmul30(adjust, y) << 2;
+        rsqrtX = (offset >= 0) ? (yr >> offset) : (yr << -offset);
+        sqrtX = Fixed64::Mul(x, rsqrtX);
+    }
+
+    /// <summary>
+    /// Sets up lanes [0, count) of a packet as segments from (fromX, fromY, fromZ) to (toX, toY, toZ),
+    /// for line-of-sight queries: the direction is normalized and maxDist is the segment length.
+    /// Returns the mask of usable lanes (count lanes, minus any zero-length segments).
+    /// </summary>
+    static int InitSegments(RayPacket& rays, const FP_LONG* fromX, const FP_LONG* fromY, const FP_LONG* fromZ,
+        const FP_LONG* toX, const FP_LONG* toY, const FP_LONG* toZ, int count)
+    {
+        int mask = 0;
+        for (int i = 0; i < PacketSize; i++)
+        {
+            int src = (i < count) ? i : 0;
+            FP_LONG dx = toX[src] - fromX[src];
+            FP_LONG dy = toY[src] - fromY[src];
+            FP_LONG dz = toZ[src] - fromZ[src];
+            FP_LONG lenSqr = Fixed64::Mul(dx, dx) + Fixed64::Mul(dy, dy) + Fixed64::Mul(dz, dz);
+            FP_LONG len, ooLen;
+            SqrtRSqrt(lenSqr, len, ooLen);
+
+            rays.originX[i] = fromX[src];
+            rays.originY[i] = fromY[src];
+            rays.originZ[i] = fromZ[src];
+            rays.dirX[i] = Fixed64::Mul(dx, ooLen);
+            rays.dirY[i] = Fixed64::Mul(dy, ooLen);
+            rays.dirZ[i] = Fixed64::Mul(dz, ooLen);
+            rays.maxDist[i] = len;
+            if (i < count && len > 0)
+                mask |= 1 << i;
+        }
+        return mask;
+    }
+
+    /// <summary>
+    /// Intersects lane i of a packet with a sphere. Returns true and updates maxDist[i] on a hit.
+    /// </summary>
+    static bool IntersectSphere1(RayPacket& rays, int i, FP_LONG centerX, FP_LONG centerY, FP_LONG centerZ, FP_LONG radius)
+    {
+        FP_LONG eoX = centerX - rays.originX[i];
+        FP_LONG eoY = centerY - rays.originY[i];
+        FP_LONG eoZ = centerZ - rays.originZ[i];
+        FP_LONG v = Fixed64::Mul(eoX, rays.dirX[i]) + Fixed64::Mul(eoY, rays.dirY[i]) + Fixed64::Mul(eoZ, rays.dirZ[i]);
+        if (v < 0)
+            return false;
+
+        FP_LONG eoSqr = Fixed64::Mul(eoX, eoX) + Fixed64::Mul(eoY, eoY) + Fixed64::Mul(eoZ, eoZ);
+        FP_LONG disc = Fixed64::Mul(radius, radius) - (eoSqr - Fixed64::Mul(v, v));
+        if (disc < 0)
+            return false;
+
+        FP_LONG dist = v - Fixed64::SqrtFast(disc);
+        if (dist <= 0 || dist >= rays.maxDist[i])
+            return false;
+
+        rays.maxDist[i] = dist;
+        return true;
+    }
+
+    /// <summary>
+    /// Intersects lane i of a packet with the plane dot(normal, p) + offset = 0, seen from the
+    /// positive side. Returns true and updates maxDist[i] on a hit.
+    /// </summary>
+    static bool IntersectPlane1(RayPacket& rays, int i, FP_LONG normalX, FP_LONG normalY, FP_LONG normalZ, FP_LONG offset)
+    {
+        FP_LONG denom = Fixed64::Mul(normalX, rays.dirX[i]) + Fixed64::Mul(normalY, rays.dirY[i]) + Fixed64::Mul(normalZ, rays.dirZ[i]);
+        if (denom > -PlaneEpsilon)
+            return false;
+
+        FP_LONG height = Fixed64::Mul(normalX, rays.originX[i]) + Fixed64::Mul(normalY, rays.originY[i]) + Fixed64::Mul(normalZ, rays.originZ[i]) + offset;
+        FP_LONG dist = Fixed64::Mul(height, Fixed64::RcpFast(-denom));
+        if (dist <= 0 || dist >= rays.maxDist[i])
+            return false;
+
+        rays.maxDist[i] = dist;
+        return true;
+    }
+
+#if defined(__AVX2__)
+    // Fixed64::Mul() for 4 lanes: the low 64 bits of the 128-bit product shifted right by 32,
+    // assembled from unsigned 32x32 products with corrections for negative operands.
+    static inline __m256i Mul4(__m256i a, __m256i b)
+    {
+        __m256i aHi = _mm256_srli_epi64(a, 32);
+        __m256i bHi = _mm256_srli_epi64(b, 32);
+        __m256i lo = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+        __m256i mid = _mm256_add_epi64(_mm256_mul_epu32(aHi, b), _mm256_mul_epu32(a, bHi));
+        __m256i hi = _mm256_slli_epi64(_mm256_mul_epu32(aHi, bHi), 32);
+        __m256i zero = _mm256_setzero_si256();
+        __m256i fixA = _mm256_and_si256(_mm256_cmpgt_epi64(zero, a), _mm256_slli_epi64(b, 32));
+        __m256i fixB = _mm256_and_si256(_mm256_cmpgt_epi64(zero, b), _mm256_slli_epi64(a, 32));
+        __m256i sum = _mm256_add_epi64(_mm256_add_epi64(lo, mid), hi);
+        return _mm256_sub_epi64(sum, _mm256_add_epi64(fixA, fixB));
+    }
+
+    static inline __m256i Load4(const FP_LONG* p) { return _mm256_load_si256((const __m256i*)p); }
+
+    static inline __m256i Dot4(__m256i ax, __m256i ay, __m256i az, __m256i bx, __m256i by, __m256i bz)
+    {
+        return _mm256_add_epi64(_mm256_add_epi64(Mul4(ax, bx), Mul4(ay, by)), Mul4(az, bz));
+    }
+
+    // Mask bits of the lanes where a < 0.
+    static inline int NegativeMask4(__m256i a)
+    {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(a));
+    }
+
+    // All-ones lanes for the set bits of a 4-bit lane mask.
+    static inline __m256i LaneMask4(int mask)
+    {
+        __m256i bits = _mm256_set_epi64x(8, 4, 2, 1);
+        return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(mask), bits), bits);
+    }
+
+    // Shifts positive x left until its top bit is set and returns the shift amount (the number of
+    // leading zeros) in nlz. Lanes with x == 0 are left as they are.
+    static inline __m256i Normalize4(__m256i x, __m256i& nlz)
+    {
+        __m256i zero = _mm256_setzero_si256();
+        nlz = zero;
+        for (int s = 32; s > 0; s >>= 1)
+        {
+            __m256i top = _mm256_cmpeq_epi64(_mm256_srli_epi64(x, 64 - s), zero);
+            nlz = _mm256_add_epi64(nlz, _mm256_and_si256(top, _mm256_set1_epi64x(s)));
+            x = _mm256_blendv_epi8(x, _mm256_slli_epi64(x, s), top);
+        }
+        return x;
+    }
+
+    // FixedUtil::Qmul30() on the low 32 bits of each lane (the result is in the low 32 bits).
+    static inline __m256i Qmul30x4(__m256i a, __m256i b)
+    {
+        return _mm256_srli_epi64(_mm256_mul_epi32(a, b), 30);
+    }
+
+    // Shifts left by shift where it is positive and right by -shift where it is negative (for
+    // non-negative values).
+    static inline __m256i ShiftLeft4(__m256i v, __m256i shift)
+    {
+        __m256i zero = _mm256_setzero_si256();
+        __m256i neg = _mm256_cmpgt_epi64(zero, shift);
+        __m256i left = _mm256_sllv_epi64(v, _mm256_andnot_si256(neg, shift));
+        __m256i right = _mm256_srlv_epi64(v, _mm256_and_si256(neg, _mm256_sub_epi64(zero, shift)));
+        return _mm256_blendv_epi8(left, right, neg);
+    }
+
+    // Horner evaluation of a FixedUtil polynomial kernel on the low 32 bits of each lane, with the
+    // coefficients taken from its table (highest order first, numCoefs - 1 multiplications).
+    static inline __m256i Horner4(__m256i a, const FP_INT* coefs, int numCoefs)
+    {
+        __m256i y = Qmul30x4(a, _mm256_set1_epi64x(coefs[0]));
+        for (int i = 1; i < numCoefs - 1; i++)
+            y = Qmul30x4(a, _mm256_add_epi32(y, _mm256_set1_epi64x(coefs[i])));
+        return _mm256_add_epi32(y, _mm256_set1_epi64x(coefs[numCoefs - 1]));
+    }
+
+    // Fixed64::SqrtFast() for 4 lanes of x >= 0 (with the default SqrtPoly4 kernel).
+    static inline __m256i SqrtFast4(__m256i x)
+    {
+        const int ONE = (1 << 30);
+        const int SQRT2 = 1518500249; // sqrt(2.0)
+
+        // Normalize input into [1.0, 2.0( range (as s2.30), offset = 31 - nlz.
+        __m256i nlz;
+        __m256i n = _mm256_srli_epi64(Normalize4(x, nlz), 33);
+        __m256i a = _mm256_sub_epi32(n, _mm256_set1_epi64x(ONE));
+
+        __m256i y = Horner4(a, FixedUtil::SqrtPoly4Table, 5);
+
+        // Odd offsets (even nlz) are adjusted by sqrt(2), then offset / 2 is applied.
+        __m256i one = _mm256_set1_epi64x(1);
+        __m256i odd = _mm256_cmpeq_epi64(_mm256_and_si256(nlz, one), _mm256_setzero_si256());
+        __m256i adjust = _mm256_blendv_epi8(_mm256_set1_epi64x(ONE), _mm256_set1_epi64x(SQRT2), odd);
+        __m256i yr = _mm256_slli_epi64(_mm256_and_si256(Qmul30x4(adjust, y), _mm256_set1_epi64x(0xFFFFFFFF)), 2);
+        __m256i halfOffset = _mm256_sub_epi64(_mm256_srli_epi64(_mm256_sub_epi64(_mm256_set1_epi64x(31 + 64), nlz), 1), _mm256_set1_epi64x(32));
+        __m256i res = ShiftLeft4(yr, halfOffset);
+        return _mm256_andnot_si256(_mm256_cmpeq_epi64(x, _mm256_setzero_si256()), res);
+    }
+
+    // Fixed64::RcpFast() for 4 lanes of x > 0 (with the default RcpPoly6 kernel).
+    static inline __m256i RcpFast4(__m256i x)
+    {
+        const int ONE = (1 << 30);
+
+        // Normalize input into [1.0, 2.0( range (as s2.30), offset = 31 - nlz.
+        __m256i nlz;
+        __m256i n = _mm256_srli_epi64(Normalize4(x, nlz), 33);
+        __m256i a = _mm256_sub_epi32(n, _mm256_set1_epi64x(ONE));
+
+        __m256i y = Horner4(a, FixedUtil::RcpPoly6Table, 7);
+
+        // Apply exponent (shift right by offset), convert back to s32.32.
+        __m256i yr = _mm256_slli_epi64(_mm256_and_si256(y, _mm256_set1_epi64x(0xFFFFFFFF)), 2);
+        return ShiftLeft4(yr, _mm256_sub_epi64(nlz, _mm256_set1_epi64x(31)));
+    }
+#endif
+
+    // The packet square roots and reciprocals replicate the default SqrtFast()/RcpFast() kernels.
+    // If FP_KERNEL_* bindings select other kernels, the lanes use the scalar functions instead, so
+    // the results stay identical to the scalar versions. The bindings are compared by name: an
+    // FP_PACKET_KERNEL_<name> macro is defined (as 1) for each kernel that has a packet version.
+#define FP_PACKET_KERNEL_SqrtPoly4 1
+#define FP_PACKET_KERNEL_RcpPoly6 1
+#define FP_PACKET_KERNEL_CAT2(a, b) a##b
+#define FP_PACKET_KERNEL_CAT(a, b) FP_PACKET_KERNEL_CAT2(a, b)
+#if defined(__AVX2__) && FP_PACKET_KERNEL_CAT(FP_PACKET_KERNEL_, FP_KERNEL_SQRT_FAST) && FP_PACKET_KERNEL_CAT(FP_PACKET_KERNEL_, FP_KERNEL_RCP_FAST)
+#define FP_PACKET_KERNELS 1
+#else
+#define FP_PACKET_KERNELS 0
+#endif
+
+    /// <summary>
+    /// Intersects the active lanes of a packet with a sphere. Returns the mask of lanes that hit,
+    /// their maxDist is updated to the hit distance.
+    /// </summary>
+    static int IntersectSphere(RayPacket& rays, int activeMask, FP_LONG centerX, FP_LONG centerY, FP_LONG centerZ, FP_LONG radius)
+    {
+        alignas(32) FP_LONG v[PacketSize];
+        alignas(32) FP_LONG disc[PacketSize];
+        int mask = activeMask;
+
+#if defined(__AVX2__)
+        __m256i cx = _mm256_set1_epi64x(centerX);
+        __m256i cy = _mm256_set1_epi64x(centerY);
+        __m256i cz = _mm256_set1_epi64x(centerZ);
+        __m256i eoX[2], eoY[2], eoZ[2], vv[2];
+        for (int h = 0; h < 2; h++)
+        {
+            int o = h * 4;
+            eoX[h] = _mm256_sub_epi64(cx, Load4(&rays.originX[o]));
+            eoY[h] = _mm256_sub_epi64(cy, Load4(&rays.originY[o]));
+            eoZ[h] = _mm256_sub_epi64(cz, Load4(&rays.originZ[o]));
+            vv[h] = Dot4(eoX[h], eoY[h], eoZ[h], Load4(&rays.dirX[o]), Load4(&rays.dirY[o]), Load4(&rays.dirZ[o]));
+            mask &= ~(NegativeMask4(vv[h]) << o);
+        }
+        if (mask == 0)
+            return 0;
+
+        __m256i rr = _mm256_set1_epi64x(Fixed64::Mul(radius, radius));
+        for (int h = 0; h < 2; h++)
+        {
+            int o = h * 4;
+            __m256i eoSqr = Dot4(eoX[h], eoY[h], eoZ[h], eoX[h], eoY[h], eoZ[h]);
+            __m256i d = _mm256_sub_epi64(rr, _mm256_sub_epi64(eoSqr, Mul4(vv[h], vv[h])));
+            mask &= ~(NegativeMask4(d) << o);
+            _mm256_store_si256((__m256i*)&v[o], vv[h]);
+            _mm256_store_si256((__m256i*)&disc[o], d);
+        }
+#else
+        for (int i = 0; i < PacketSize; i++)
+        {
+            FP_LONG eoX = centerX - rays.originX[i];
+            FP_LONG eoY = centerY - rays.originY[i];
+            FP_LONG eoZ = centerZ - rays.originZ[i];
+            v[i] = Fixed64::Mul(eoX, rays.dirX[i]) + Fixed64::Mul(eoY, rays.dirY[i]) + Fixed64::Mul(eoZ, rays.dirZ[i]);
+            mask &= ~((int)(v[i] < 0) << i);
+        }
+        if (mask == 0)
+            return 0;
+
+        FP_LONG rr = Fixed64::Mul(radius, radius);
+        for (int i = 0; i < PacketSize; i++)
+        {
+            FP_LONG eoX = centerX - rays.originX[i];
+            FP_LONG eoY = centerY - rays.originY[i];
+            FP_LONG eoZ = centerZ - rays.originZ[i];
+            FP_LONG eoSqr = Fixed64::Mul(eoX, eoX) + Fixed64::Mul(eoY, eoY) + Fixed64::Mul(eoZ, eoZ);
+            disc[i] = rr - (eoSqr - Fixed64::Mul(v[i], v[i]));
+            mask &= ~((int)(disc[i] < 0) << i);
+        }
+#endif
+
+#if FP_PACKET_KERNELS
+        // Square roots for all lanes at once.
+        int hitMask = 0;
+        for (int h = 0; h < 2; h++)
+        {
+            int o = h * 4;
+            __m256i dist = _mm256_sub_epi64(Load4(&v[o]), SqrtFast4(Load4(&disc[o])));
+            __m256i maxDist = Load4(&rays.maxDist[o]);
+            __m256i hit = _mm256_and_si256(LaneMask4(mask >> o), _mm256_and_si256(_mm256_cmpgt_epi64(dist, _mm256_setzero_si256()), _mm256_cmpgt_epi64(maxDist, dist)));
+            _mm256_store_si256((__m256i*)&rays.maxDist[o], _mm256_blendv_epi8(maxDist, dist, hit));
+            hitMask |= _mm256_movemask_pd(_mm256_castsi256_pd(hit)) << o;
+        }
+        return hitMask;
+#else
+        // Square roots only for the remaining lanes.
+        int hitMask = 0;
+        for (int i = 0; i < PacketSize; i++)
+        {
+            if ((mask & (1 << i)) == 0)
+                continue;
+
+            FP_LONG dist = v[i] - Fixed64::SqrtFast(disc[i]);
+            if (dist > 0 && dist < rays.maxDist[i])
+            {
+                rays.maxDist[i] = dist;
+                hitMask |= 1 << i;
+            }
+        }
+        return hitMask;
+#endif
+    }
+
+    /// <summary>
+    /// Intersects the active lanes of a packet with the plane dot(normal, p) + offset = 0, seen
+    /// from the positive side. Returns the mask of lanes that hit, their maxDist is updated to the
+    /// hit distance.
+    /// </summary>
+    static int IntersectPlane(RayPacket& rays, int activeMask, FP_LONG normalX, FP_LONG normalY, FP_LONG normalZ, FP_LONG offset)
+    {
+        alignas(32) FP_LONG denom[PacketSize];
+        int mask = activeMask;
+
+#if defined(__AVX2__)
+        __m256i nx = _mm256_set1_epi64x(normalX);
+        __m256i ny = _mm256_set1_epi64x(normalY);
+        __m256i nz = _mm256_set1_epi64x(normalZ);
+        __m256i limit = _mm256_set1_epi64x(-PlaneEpsilon);
+        for (int h = 0; h < 2; h++)
+        {
+            int o = h * 4;
+            __m256i d = Dot4(nx, ny, nz, Load4(&rays.dirX[o]), Load4(&rays.dirY[o]), Load4(&rays.dirZ[o]));
+            int towards = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(limit, d)));
+            mask &= ~((~towards & 0xF) << o);
+            _mm256_store_si256((__m256i*)&denom[o], d);
+        }
+#else
+        for (int i = 0; i < PacketSize; i++)
+        {
+            denom[i] = Fixed64::Mul(normalX, rays.dirX[i]) + Fixed64::Mul(normalY, rays.dirY[i]) + Fixed64::Mul(normalZ, rays.dirZ[i]);
+            mask &= ~((int)(denom[i] > -PlaneEpsilon) << i);
+        }
+#endif
+
+#if FP_PACKET_KERNELS
+        // Reciprocals for all lanes at once (the lanes that are not heading towards the plane
+        // get a dummy denominator).
+        if (mask == 0)
+            return 0;
+        __m256i off = _mm256_set1_epi64x(offset);
+        int hitMask = 0;
+        for (int h = 0; h < 2; h++)
+        {
+            int o = h * 4;
+            __m256i active = LaneMask4(mask >> o);
+            __m256i denomNeg = _mm256_blendv_epi8(_mm256_set1_epi64x(Fixed64::One), _mm256_sub_epi64(_mm256_setzero_si256(), Load4(&denom[o])), active);
+            __m256i height = _mm256_add_epi64(Dot4(nx, ny, nz, Load4(&rays.originX[o]), Load4(&rays.originY[o]), Load4(&rays.originZ[o])), off);
+            __m256i dist = Mul4(height, RcpFast4(denomNeg));
+            __m256i maxDist = Load4(&rays.maxDist[o]);
+            __m256i hit = _mm256_and_si256(active, _mm256_and_si256(_mm256_cmpgt_epi64(dist, _mm256_setzero_si256()), _mm256_cmpgt_epi64(maxDist, dist)));
+            _mm256_store_si256((__m256i*)&rays.maxDist[o], _mm256_blendv_epi8(maxDist, dist, hit));
+            hitMask |= _mm256_movemask_pd(_mm256_castsi256_pd(hit)) << o;
+        }
+        return hitMask;
+#else
+        // Reciprocals only for the lanes heading towards the plane.
+        int hitMask = 0;
+        for (int i = 0; i < PacketSize; i++)
+        {
+            if ((mask & (1 << i)) == 0)
+                continue;
+
+            FP_LONG height = Fixed64::Mul(normalX, rays.originX[i]) + Fixed64::Mul(normalY, rays.originY[i]) + Fixed64::Mul(normalZ, rays.originZ[i]) + offset;
+            FP_LONG dist = Fixed64::Mul(height, Fixed64::RcpFast(-denom[i]));
+            if (dist > 0 && dist < rays.maxDist[i])
+            {
+                rays.maxDist[i] = dist;
+                hitMask |= 1 << i;
+            }
+        }
+        return hitMask;
+#endif
+    }
+
+    #undef FP_PACKET_KERNEL_SqrtPoly4
+    #undef FP_PACKET_KERNEL_RcpPoly6
+    #undef FP_PACKET_KERNEL_CAT2
+    #undef FP_PACKET_KERNEL_CAT
+    #undef FP_PACKET_KERNELS
+}
+
+#endif // __FIXEDRAYPACKET_H
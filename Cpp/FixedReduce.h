@@ -0,0 +1,347 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDREDUCE_H
+#define __FIXEDREDUCE_H
+
+// Deterministic Sum() and Dot() reductions over Fixed32 and Fixed64 arrays.
+//
+// Values and products are accumulated exactly into 128-bit integers, so the order of the additions
+// does not matter: the serial, SIMD and multithreaded versions return bit-identical results for
+// any thread count or chunk size. Dot() rounds the exact sum of products down once at the end,
+// so it is more precise than summing Mul() results (which rounds every product).
+//
+// Sums are exact for any array length. Dot products are exact as long as the result fits in 128
+// bits, e.g. for up to 2^31 pairs of Fixed64 values with magnitudes below 65536.0.
+
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include "FixedParallel.h"
+
+#if defined(__AVX2__)
+#   include <immintrin.h>
+#endif
+
+namespace FixedReduce
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    // Number of elements summed by each task of the parallel reductions.
+    static const int ChunkSize = 16384;
+
+    /// <summary>
+    /// Signed 128-bit integer (two's complement, hi:lo).
+    /// </summary>
+    struct Int128
+    {
+        uint64_t    lo;
+        FP_LONG     hi;
+
+        Int128() : lo(0), hi(0) { }
+        Int128(FP_LONG hi_, uint64_t lo_) : lo(lo_), hi(hi_) { }
+
+        bool operator==(const Int128& o) const { return lo == o.lo && hi == o.hi; }
+        bool operator!=(const Int128& o) const { return !(*this == o); }
+    };
+
+    static inline Int128 FromLong(FP_LONG v)
+    {
+        return Int128(v >> 63, (uint64_t)v);
+    }
+
+    static inline Int128 Add(Int128 a, Int128 b)
+    {
+        uint64_t lo = a.lo + b.lo;
+        return Int128((FP_LONG)((uint64_t)a.hi + (uint64_t)b.hi + (lo < a.lo ? 1 : 0)), lo);
+    }
+
+    // Returns hi * 2^32 + lo exactly.
+    static inline Int128 Combine(FP_LONG hi, uint64_t lo)
+    {
+        return Add(Int128(hi >> 32, (uint64_t)hi << 32), Int128(0, lo));
+    }
+
+    // Exact signed 64x64 -> 128-bit product.
+    static inline Int128 MulWide(FP_LONG a, FP_LONG b)
+    {
+        uint64_t alo = (uint64_t)a & 0xFFFFFFFF;
+        uint64_t blo = (uint64_t)b & 0xFFFFFFFF;
+        FP_LONG ahi = a >> 32;
+        FP_LONG bhi = b >> 32;
+        uint64_t lolo = alo * blo;
+        FP_LONG mid1 = ahi * (FP_LONG)blo + (FP_LONG)(lolo >> 32);
+        FP_LONG mid2 = (FP_LONG)alo * bhi + (mid1 & 0xFFFFFFFF);
+        FP_LONG hi = ahi * bhi + (mid1 >> 32) + (mid2 >> 32);
+        return Int128(hi, ((uint64_t)mid2 << 32) | (lolo & 0xFFFFFFFF));
+    }
+
+    /// <summary>
+    /// Shifts v right by shift bits (rounding down) and saturates the result to the FP_LONG range.
+    /// </summary>
+    static inline FP_LONG ToLongSat(Int128 v, int shift)
+    {
+        FP_LONG hi = v.hi;
+        uint64_t lo = v.lo;
+        if (shift > 0)
+        {
+            lo = (lo >> shift) | ((uint64_t)hi << (64 - shift));
+            hi >>= shift;
+        }
+
+        // The result fits iff hi is the sign extension of lo.
+        if (hi != ((FP_LONG)lo >> 63))
+            return (hi < 0) ? INT64_MIN : INT64_MAX;
+        return (FP_LONG)lo;
+    }
+
+    /// <summary>
+    /// Shifts v right by shift bits (rounding down) and saturates the result to the FP_INT range.
+    /// </summary>
+    static inline FP_INT ToIntSat(Int128 v, int shift)
+    {
+        FP_LONG r = ToLongSat(v, shift);
+        return (FP_INT)((r < INT32_MIN) ? INT32_MIN : (r > INT32_MAX) ? INT32_MAX : r);
+    }
+
+    /// <summary>
+    /// Converts v (with shift fractional bits) to a double. Not deterministic across platforms.
+    /// </summary>
+    static inline double ToDouble(Int128 v, int shift)
+    {
+        double value = (double)v.hi * 18446744073709551616.0 + (double)v.lo;
+        return ldexp(value, -shift);
+    }
+
+    /// <summary>
+    /// Returns the exact sum of the first count elements of x.
+    /// </summary>
+    static Int128 SumExact(const FP_INT* x, int count)
+    {
+        // count < 2^31, so 64 bits are enough for the exact sum.
+        FP_LONG sum = 0;
+        int i = 0;
+#if defined(__AVX2__)
+        __m256i acc0 = _mm256_setzero_si256();
+        __m256i acc1 = _mm256_setzero_si256();
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)&x[i]);
+            acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+            acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+        }
+        FP_LONG lanes[4];
+        _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(acc0, acc1));
+        sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+        for (; i < count; i++)
+            sum += x[i];
+        return FromLong(sum);
+    }
+
+    /// <summary>
+    /// Returns the exact sum of the first count elements of x.
+    /// </summary>
+    static Int128 SumExact(const FP_LONG* x, int count)
+    {
+        // Sum the signed high and unsigned low 32-bit halves separately. With count < 2^31
+        // neither of them can overflow 64 bits, so no carries need to be tracked.
+        FP_LONG hi = 0;
+        uint64_t lo = 0;
+        int i = 0;
+#if defined(__AVX2__)
+        __m256i accHi = _mm256_setzero_si256();
+        __m256i accLo = _mm256_setzero_si256();
+        const __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFF);
+        for (; i + 4 <= count; i += 4)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)&x[i]);
+
+            // Move the high halves down with sign extension (there is no 64-bit arithmetic shift).
+            __m256i high = _mm256_blend_epi32(_mm256_srli_epi64(v, 32), _mm256_srai_epi32(v, 31), 0xAA);
+            accHi = _mm256_add_epi64(accHi, high);
+            accLo = _mm256_add_epi64(accLo, _mm256_and_si256(v, lowMask));
+        }
+        FP_LONG lanesHi[4];
+        uint64_t lanesLo[4];
+        _mm256_storeu_si256((__m256i*)lanesHi, accHi);
+        _mm256_storeu_si256((__m256i*)lanesLo, accLo);
+        hi = lanesHi[0] + lanesHi[1] + lanesHi[2] + lanesHi[3];
+        lo = lanesLo[0] + lanesLo[1] + lanesLo[2] + lanesLo[3];
+#endif
+        for (; i < count; i++)
+        {
+            hi += x[i] >> 32;
+            lo += (uint64_t)x[i] & 0xFFFFFFFF;
+        }
+        return Combine(hi, lo);
+    }
+
+    /// <summary>
+    /// Returns the exact sum of the products of the first count elements of a and b (with 32
+    /// fractional bits, i.e. before the final rounding).
+    /// </summary>
+    static Int128 DotExact(const FP_INT* a, const FP_INT* b, int count)
+    {
+        // Same split as in SumExact(): the products are below 2^62.
+        FP_LONG hi = 0;
+        uint64_t lo = 0;
+        for (int i = 0; i < count; i++)
+        {
+            FP_LONG p = (FP_LONG)a[i] * b[i];
+            hi += p >> 32;
+            lo += (uint64_t)p & 0xFFFFFFFF;
+        }
+        return Combine(hi, lo);
+    }
+
+    /// <summary>
+    /// Returns the exact sum of the products of the first count elements of a and b (with 64
+    /// fractional bits, i.e. before the final rounding).
+    /// </summary>
+    static Int128 DotExact(const FP_LONG* a, const FP_LONG* b, int count)
+    {
+        Int128 sum;
+        for (int i = 0; i < count; i++)
+            sum = Add(sum, MulWide(a[i], b[i]));
+        return sum;
+    }
+
+    // Runs reduce(begin, end) over ChunkSize element chunks on the pool and adds up the results.
+    template <typename Reduce>
+    static Int128 ReduceParallel(FixedParallel::ThreadPool& pool, int count, const Reduce& reduce)
+    {
+        std::vector<Int128> partial((count + ChunkSize - 1) / ChunkSize);
+        FixedParallel::ParallelFor(pool, count, ChunkSize, [&](int begin, int end)
+        {
+            partial[begin / ChunkSize] = reduce(begin, end);
+        });
+
+        Int128 sum;
+        for (size_t i = 0; i < partial.size(); i++)
+            sum = Add(sum, partial[i]);
+        return sum;
+    }
+
+    /// <summary>
+    /// SumExact() using all threads of the pool. Returns the same value as SumExact().
+    /// </summary>
+    static Int128 SumExactParallel(FixedParallel::ThreadPool& pool, const FP_INT* x, int count)
+    {
+        return ReduceParallel(pool, count, [&](int begin, int end) { return SumExact(x + begin, end - begin); });
+    }
+
+    /// <summary>
+    /// SumExact() using all threads of the pool. Returns the same value as SumExact().
+    /// </summary>
+    static Int128 SumExactParallel(FixedParallel::ThreadPool& pool, const FP_LONG* x, int count)
+    {
+        return ReduceParallel(pool, count, [&](int begin, int end) { return SumExact(x + begin, end - begin); });
+    }
+
+    /// <summary>
+    /// DotExact() using all threads of the pool. Returns the same value as DotExact().
+    /// </summary>
+    static Int128 DotExactParallel(FixedParallel::ThreadPool& pool, const FP_INT* a, const FP_INT* b, int count)
+    {
+        return ReduceParallel(pool, count, [&](int begin, int end) { return DotExact(a + begin, b + begin, end - begin); });
+    }
+
+    /// <summary>
+    /// DotExact() using all threads of the pool. Returns the same value as DotExact().
+    /// </summary>
+    static Int128 DotExactParallel(FixedParallel::ThreadPool& pool, const FP_LONG* a, const FP_LONG* b, int count)
+    {
+        return ReduceParallel(pool, count, [&](int begin, int end) { return DotExact(a + begin, b + begin, end - begin); });
+    }
+
+    /// <summary>
+    /// Returns the sum of the first count elements of x, saturated to the Fixed32 range.
+    /// </summary>
+    static FP_INT Sum(const FP_INT* x, int count)
+    {
+        return ToIntSat(SumExact(x, count), 0);
+    }
+
+    /// <summary>
+    /// Returns the sum of the first count elements of x, saturated to the Fixed64 range.
+    /// </summary>
+    static FP_LONG Sum(const FP_LONG* x, int count)
+    {
+        return ToLongSat(SumExact(x, count), 0);
+    }
+
+    /// <summary>
+    /// Returns the dot product of the first count elements of a and b, rounded down and saturated
+    /// to the Fixed32 range.
+    /// </summary>
+    static FP_INT Dot(const FP_INT* a, const FP_INT* b, int count)
+    {
+        return ToIntSat(DotExact(a, b, count), 16);
+    }
+
+    /// <summary>
+    /// Returns the dot product of the first count elements of a and b, rounded down and saturated
+    /// to the Fixed64 range.
+    /// </summary>
+    static FP_LONG Dot(const FP_LONG* a, const FP_LONG* b, int count)
+    {
+        return ToLongSat(DotExact(a, b, count), 32);
+    }
+
+    /// <summary>
+    /// Sum() using all threads of the pool. Returns the same value as Sum().
+    /// </summary>
+    static FP_INT SumParallel(FixedParallel::ThreadPool& pool, const FP_INT* x, int count)
+    {
+        return ToIntSat(SumExactParallel(pool, x, count), 0);
+    }
+
+    /// <summary>
+    /// Sum() using all threads of the pool. Returns the same value as Sum().
+    /// </summary>
+    static FP_LONG SumParallel(FixedParallel::ThreadPool& pool, const FP_LONG* x, int count)
+    {
+        return ToLongSat(SumExactParallel(pool, x, count), 0);
+    }
+
+    /// <summary>
+    /// Dot() using all threads of the pool. Returns the same value as Dot().
+    /// </summary>
+    static FP_INT DotParallel(FixedParallel::ThreadPool& pool, const FP_INT* a, const FP_INT* b, int count)
+    {
+        return ToIntSat(DotExactParallel(pool, a, b, count), 16);
+    }
+
+    /// <summary>
+    /// Dot() using all threads of the pool. Returns the same value as Dot().
+    /// </summary>
+    static FP_LONG DotParallel(FixedParallel::ThreadPool& pool, const FP_LONG* a, const FP_LONG* b, int count)
+    {
+        return ToLongSat(DotExactParallel(pool, a, b, count), 32);
+    }
+}
+
+#endif // __FIXEDREDUCE_H
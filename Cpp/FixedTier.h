@@ -0,0 +1,450 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#pragma once
+#ifndef __FIXEDTIER_H
+#define __FIXEDTIER_H
+
+// Precision tier profiler: finds the call sites where the Fast or Fastest variant of a function
+// (e.g. SinFast() instead of Sin()) keeps the results of a computation within an error budget.
+//
+// Call sites are written as FP_TIER(Sin, x), which returns the same value as Fixed32::Sin(x) or
+// Fixed64::Sin(x) (chosen by the argument type), and the results of the computation are tagged
+// with FixedTier::Output(). The computation is then run once per pass:
+//
+//     FixedTier::Reset();
+//     while (FixedTier::NextPass())
+//     {
+//         RunSimulation();
+//         FixedTier::Output(energy, 0.001);    // value and acceptable error
+//     }
+//     FixedTier::WriteCsv(stdout, FixedTier::Report());
+//
+// The first pass uses the full precision variants everywhere and records the outputs. Each of the
+// following passes switches a single call site to Fast or Fastest, and the outputs are compared
+// against the first pass. As the library is deterministic, any difference is caused by the
+// switched call site. Every call also evaluates all three variants side by side to record the
+// local error at the call site.
+//
+// Report() recommends the cheapest variant whose outputs stayed within all budgets, and estimates
+// the time saved per pass from a timing of each variant on inputs recorded at the call site.
+//
+// The profiler is meant for offline runs: it is not thread safe and every profiled call costs
+// about three calls.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include "Fixed32.h"
+#include "Fixed64.h"
+
+#define FP_TIER(func, ...) FixedTier::func(([]() { static const int fpTierSite = FixedTier::RegisterSite(__FILE__, __LINE__, #func); return fpTierSite; })(), __VA_ARGS__)
+
+namespace FixedTier
+{
+    typedef int32_t FP_INT;
+    typedef int64_t FP_LONG;
+
+    enum Tier
+    {
+        Full,           // e.g. Sin()
+        Fast,           // e.g. SinFast()
+        Fastest,        // e.g. SinFastest()
+        NumTiers
+    };
+
+    static const char* const TierNames[NumTiers] = { "Full", "Fast", "Fastest" };
+
+    // Number of inputs recorded per call site for timing.
+    static const int NumSamples = 64;
+
+    /// <summary>
+    /// Profiling results of one call site.
+    /// </summary>
+    struct SiteReport
+    {
+        const char* file;
+        int         line;
+        const char* function;               // e.g. "Sin"
+        uint64_t    calls;                  // calls in the first pass
+        double      maxLocalError[NumTiers];    // largest difference to the full precision result
+        double      maxBudgetUsed[NumTiers];    // largest output error divided by its budget
+        bool        withinBudget[NumTiers];
+        double      nsPerCall[NumTiers];
+        Tier        recommended;
+        double      savedNsPerPass;         // estimated time saved by the recommended tier
+    };
+
+    template <typename T>
+    struct Funcs
+    {
+        T (*unary[NumTiers])(T);
+        T (*binary[NumTiers])(T, T);
+    };
+
+    struct Site
+    {
+        const char*     file;
+        int             line;
+        const char*     function;
+        uint64_t        calls;
+        int             numArgs;
+        bool            is64;
+        Funcs<FP_INT>   funcs32;
+        Funcs<FP_LONG>  funcs64;
+        std::vector<FP_LONG> samples;       // numArgs values per recorded call
+        double          maxLocalError[NumTiers];
+        double          maxBudgetUsed[NumTiers];
+        bool            tested[NumTiers];
+    };
+
+    struct OutputValue
+    {
+        double  value;
+        double  budget;
+    };
+
+    struct State
+    {
+        std::vector<Site>           sites;
+        std::vector<OutputValue>    baseline;       // outputs of the first pass in call order
+        int                         pass;           // -1 before the first pass
+        std::vector<int>            candidates;     // sites reached in the first pass
+        int                         numOutputs;     // outputs seen in the current pass
+        int                         activeSite;     // site switched to activeTier, or -1
+        Tier                        activeTier;
+    };
+
+    inline State& GetState()
+    {
+        static State state = { std::vector<Site>(), std::vector<OutputValue>(), -1, std::vector<int>(), 0, -1, Full };
+        return state;
+    }
+
+    inline int RegisterSite(const char* file, int line, const char* function)
+    {
+        Site site = Site();
+        site.file = file;
+        site.line = line;
+        site.function = function;
+        GetState().sites.push_back(site);
+        return (int)GetState().sites.size() - 1;
+    }
+
+    /// <summary>
+    /// Clears all results. Call sites stay registered.
+    /// </summary>
+    inline void Reset()
+    {
+        State& state = GetState();
+        for (size_t i = 0; i < state.sites.size(); i++)
+        {
+            Site& site = state.sites[i];
+            site.calls = 0;
+            site.samples.clear();
+            for (int t = 0; t < NumTiers; t++)
+            {
+                site.maxLocalError[t] = 0.0;
+                site.maxBudgetUsed[t] = 0.0;
+                site.tested[t] = false;
+            }
+        }
+        state.baseline.clear();
+        state.pass = -1;
+        state.candidates.clear();
+        state.numOutputs = 0;
+        state.activeSite = -1;
+        state.activeTier = Full;
+    }
+
+    // Finishes the current pass: outputs missing compared to the first pass exceed the budget.
+    inline void FinishPass()
+    {
+        State& state = GetState();
+        if (state.activeSite >= 0 && state.numOutputs != (int)state.baseline.size())
+            state.sites[state.activeSite].maxBudgetUsed[state.activeTier] = INFINITY;
+    }
+
+    /// <summary>
+    /// Starts the next profiling pass. Returns false when all call sites have been tested.
+    /// </summary>
+    inline bool NextPass()
+    {
+        State& state = GetState();
+        FinishPass();
+        state.pass++;
+        state.numOutputs = 0;
+        if (state.pass == 0)
+        {
+            state.activeSite = -1;
+            state.activeTier = Full;
+            return true;
+        }
+
+        // Sites first reached after the first pass have no reference results and are not tested.
+        if (state.pass == 1)
+        {
+            for (size_t i = 0; i < state.sites.size(); i++)
+            {
+                if (state.sites[i].calls > 0)
+                    state.candidates.push_back((int)i);
+            }
+        }
+
+        int candidate = state.pass - 1;
+        if (candidate >= (int)state.candidates.size() * (NumTiers - 1))
+        {
+            state.activeSite = -1;
+            state.activeTier = Full;
+            return false;
+        }
+        state.activeSite = state.candidates[candidate / (NumTiers - 1)];
+        state.activeTier = (Tier)(Fast + candidate % (NumTiers - 1));
+        state.sites[state.activeSite].tested[state.activeTier] = true;
+        return true;
+    }
+
+    /// <summary>
+    /// Records an output of the computation (as a real number) and the largest acceptable error in it.
+    /// The outputs are matched between passes by the order of the calls.
+    /// </summary>
+    inline void Output(double value, double budget)
+    {
+        State& state = GetState();
+        int index = state.numOutputs++;
+        if (state.pass == 0)
+        {
+            OutputValue output = { value, budget };
+            state.baseline.push_back(output);
+        }
+        else if (state.activeSite >= 0)
+        {
+            double used = INFINITY;
+            if (index < (int)state.baseline.size())
+            {
+                const OutputValue& ref = state.baseline[index];
+                double error = fabs(value - ref.value);
+                used = (error == 0.0) ? 0.0 : error / ref.budget;
+            }
+            Site& site = state.sites[state.activeSite];
+            site.maxBudgetUsed[state.activeTier] = fmax(site.maxBudgetUsed[state.activeTier], used);
+        }
+    }
+
+    inline void Output(FP_INT value, double budget) { Output(Fixed32::ToDouble(value), budget); }
+    inline void Output(FP_LONG value, double budget) { Output(Fixed64::ToDouble(value), budget); }
+
+    static inline double ToReal(FP_INT v) { return Fixed32::ToDouble(v); }
+    static inline double ToReal(FP_LONG v) { return Fixed64::ToDouble(v); }
+    static inline Funcs<FP_INT>& GetFuncs(Site& site, FP_INT) { return site.funcs32; }
+    static inline Funcs<FP_LONG>& GetFuncs(Site& site, FP_LONG) { return site.funcs64; }
+
+    // Evaluates all tiers, updates the statistics and returns the result of the active tier.
+    template <typename T>
+    static T Evaluate(int siteIndex, int numArgs, const T results[NumTiers], T a, T b)
+    {
+        State& state = GetState();
+        Site& site = state.sites[siteIndex];
+        double full = ToReal(results[Full]);
+        for (int t = Fast; t < NumTiers; t++)
+            site.maxLocalError[t] = fmax(site.maxLocalError[t], fabs(ToReal(results[t]) - full));
+
+        if (state.pass == 0)
+        {
+            site.calls++;
+            site.numArgs = numArgs;
+            site.is64 = (sizeof(T) == 8);
+            if ((int)site.samples.size() < NumSamples * numArgs)
+            {
+                site.samples.push_back(a);
+                if (numArgs == 2)
+                    site.samples.push_back(b);
+            }
+        }
+
+        return (siteIndex == state.activeSite) ? results[state.activeTier] : results[Full];
+    }
+
+    template <typename T>
+    static inline T Unary(int site, T x, T (*full)(T), T (*fast)(T), T (*fastest)(T))
+    {
+        Funcs<T>& funcs = GetFuncs(GetState().sites[site], x);
+        funcs.unary[Full] = full;
+        funcs.unary[Fast] = fast;
+        funcs.unary[Fastest] = fastest;
+        T results[NumTiers] = { full(x), fast(x), fastest(x) };
+        return Evaluate(site, 1, results, x, (T)0);
+    }
+
+    template <typename T>
+    static inline T Binary(int site, T a, T b, T (*full)(T, T), T (*fast)(T, T), T (*fastest)(T, T))
+    {
+        Funcs<T>& funcs = GetFuncs(GetState().sites[site], a);
+        funcs.binary[Full] = full;
+        funcs.binary[Fast] = fast;
+        funcs.binary[Fastest] = fastest;
+        T results[NumTiers] = { full(a, b), fast(a, b), fastest(a, b) };
+        return Evaluate(site, 2, results, a, b);
+    }
+
+    // Returns the average time of one call of the given tier on the recorded inputs.
+    template <typename T>
+    static double TimeTier(const Site& site, const Funcs<T>& funcs, Tier tier)
+    {
+        std::vector<T> inputs(site.samples.begin(), site.samples.end());
+        int numCalls = (int)inputs.size() / site.numArgs;
+        if (numCalls == 0)
+            return 0.0;
+
+        typedef std::chrono::steady_clock Clock;
+        volatile T sink = 0;
+        int64_t count = 0;
+        Clock::time_point start = Clock::now();
+        Clock::duration elapsed;
+        do
+        {
+            for (int rep = 0; rep < 16; rep++)
+            {
+                if (site.numArgs == 1)
+                {
+                    for (int i = 0; i < numCalls; i++)
+                        sink = funcs.unary[tier](inputs[i]);
+                }
+                else
+                {
+                    for (int i = 0; i < numCalls; i++)
+                        sink = funcs.binary[tier](inputs[2 * i], inputs[2 * i + 1]);
+                }
+            }
+            count += 16 * numCalls;
+            elapsed = Clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds(2));
+        (void)sink;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (double)count;
+    }
+
+    /// <summary>
+    /// Returns the results for all call sites reached in the first pass. Times each variant of
+    /// each call site, which takes a few milliseconds per call site.
+    /// </summary>
+    inline std::vector<SiteReport> Report()
+    {
+        State& state = GetState();
+        std::vector<SiteReport> report;
+        for (size_t i = 0; i < state.sites.size(); i++)
+        {
+            const Site& site = state.sites[i];
+            if (site.calls == 0)
+                continue;
+
+            SiteReport r;
+            r.file = site.file;
+            r.line = site.line;
+            r.function = site.function;
+            r.calls = site.calls;
+            r.recommended = Full;
+            for (int t = 0; t < NumTiers; t++)
+            {
+                r.maxLocalError[t] = site.maxLocalError[t];
+                r.maxBudgetUsed[t] = site.maxBudgetUsed[t];
+                r.withinBudget[t] = (t == Full) || (site.tested[t] && site.maxBudgetUsed[t] <= 1.0);
+                r.nsPerCall[t] = site.is64 ? TimeTier(site, site.funcs64, (Tier)t) : TimeTier(site, site.funcs32, (Tier)t);
+                if (r.withinBudget[t] && r.nsPerCall[t] < r.nsPerCall[r.recommended])
+                    r.recommended = (Tier)t;
+            }
+            r.savedNsPerPass = (r.nsPerCall[Full] - r.nsPerCall[r.recommended]) * (double)site.calls;
+            report.push_back(r);
+        }
+        return report;
+    }
+
+    /// <summary>
+    /// Writes a report as CSV, one row per call site.
+    /// </summary>
+    inline bool WriteCsv(FILE* file, const std::vector<SiteReport>& report)
+    {
+        bool ok = fprintf(file, "file,line,function,calls,recommended,saved_ns_per_pass") > 0;
+        for (int t = 0; t < NumTiers; t++)
+            ok = ok && fprintf(file, ",%s_local_error,%s_budget_used,%s_ns", TierNames[t], TierNames[t], TierNames[t]) > 0;
+        ok = ok && fprintf(file, "\n") > 0;
+        for (size_t i = 0; i < report.size(); i++)
+        {
+            const SiteReport& r = report[i];
+            ok = ok && fprintf(file, "%s,%d,%s,%llu,%s,%.0f", r.file, r.line, r.function, (unsigned long long)r.calls, TierNames[r.recommended], r.savedNsPerPass) > 0;
+            for (int t = 0; t < NumTiers; t++)
+                ok = ok && fprintf(file, ",%g,%g,%.2f", r.maxLocalError[t], r.maxBudgetUsed[t], r.nsPerCall[t]) > 0;
+            ok = ok && fprintf(file, "\n") > 0;
+        }
+        return ok;
+    }
+
+    static inline FP_INT Sqrt(int site, FP_INT x) { return Unary(site, x, Fixed32::Sqrt, Fixed32::SqrtFast, Fixed32::SqrtFastest); }
+    static inline FP_INT RSqrt(int site, FP_INT x) { return Unary(site, x, Fixed32::RSqrt, Fixed32::RSqrtFast, Fixed32::RSqrtFastest); }
+    static inline FP_INT Rcp(int site, FP_INT x) { return Unary(site, x, Fixed32::Rcp, Fixed32::RcpFast, Fixed32::RcpFastest); }
+    static inline FP_INT Cbrt(int site, FP_INT x) { return Unary(site, x, Fixed32::Cbrt, Fixed32::CbrtFast, Fixed32::CbrtFastest); }
+    static inline FP_INT Div(int site, FP_INT a, FP_INT b) { return Binary(site, a, b, Fixed32::Div, Fixed32::DivFast, Fixed32::DivFastest); }
+    static inline FP_INT Exp(int site, FP_INT x) { return Unary(site, x, Fixed32::Exp, Fixed32::ExpFast, Fixed32::ExpFastest); }
+    static inline FP_INT Exp2(int site, FP_INT x) { return Unary(site, x, Fixed32::Exp2, Fixed32::Exp2Fast, Fixed32::Exp2Fastest); }
+    static inline FP_INT Exp10(int site, FP_INT x) { return Unary(site, x, Fixed32::Exp10, Fixed32::Exp10Fast, Fixed32::Exp10Fastest); }
+    static inline FP_INT Log(int site, FP_INT x) { return Unary(site, x, Fixed32::Log, Fixed32::LogFast, Fixed32::LogFastest); }
+    static inline FP_INT Log2(int site, FP_INT x) { return Unary(site, x, Fixed32::Log2, Fixed32::Log2Fast, Fixed32::Log2Fastest); }
+    static inline FP_INT Log10(int site, FP_INT x) { return Unary(site, x, Fixed32::Log10, Fixed32::Log10Fast, Fixed32::Log10Fastest); }
+    static inline FP_INT Pow(int site, FP_INT x, FP_INT e) { return Binary(site, x, e, Fixed32::Pow, Fixed32::PowFast, Fixed32::PowFastest); }
+    static inline FP_INT Sin(int site, FP_INT x) { return Unary(site, x, Fixed32::Sin, Fixed32::SinFast, Fixed32::SinFastest); }
+    static inline FP_INT Cos(int site, FP_INT x) { return Unary(site, x, Fixed32::Cos, Fixed32::CosFast, Fixed32::CosFastest); }
+    static inline FP_INT Tan(int site, FP_INT x) { return Unary(site, x, Fixed32::Tan, Fixed32::TanFast, Fixed32::TanFastest); }
+    static inline FP_INT Asin(int site, FP_INT x) { return Unary(site, x, Fixed32::Asin, Fixed32::AsinFast, Fixed32::AsinFastest); }
+    static inline FP_INT Acos(int site, FP_INT x) { return Unary(site, x, Fixed32::Acos, Fixed32::AcosFast, Fixed32::AcosFastest); }
+    static inline FP_INT Atan(int site, FP_INT x) { return Unary(site, x, Fixed32::Atan, Fixed32::AtanFast, Fixed32::AtanFastest); }
+    static inline FP_INT Atan2(int site, FP_INT y, FP_INT x) { return Binary(site, y, x, Fixed32::Atan2, Fixed32::Atan2Fast, Fixed32::Atan2Fastest); }
+    static inline FP_INT Sigmoid(int site, FP_INT x) { return Unary(site, x, Fixed32::Sigmoid, Fixed32::SigmoidFast, Fixed32::SigmoidFastest); }
+    static inline FP_INT Tanh(int site, FP_INT x) { return Unary(site, x, Fixed32::Tanh, Fixed32::TanhFast, Fixed32::TanhFastest); }
+    static inline FP_INT Softplus(int site, FP_INT x) { return Unary(site, x, Fixed32::Softplus, Fixed32::SoftplusFast, Fixed32::SoftplusFastest); }
+
+    static inline FP_LONG Sqrt(int site, FP_LONG x) { return Unary(site, x, Fixed64::Sqrt, Fixed64::SqrtFast, Fixed64::SqrtFastest); }
+    static inline FP_LONG RSqrt(int site, FP_LONG x) { return Unary(site, x, Fixed64::RSqrt, Fixed64::RSqrtFast, Fixed64::RSqrtFastest); }
+    static inline FP_LONG Rcp(int site, FP_LONG x) { return Unary(site, x, Fixed64::Rcp, Fixed64::RcpFast, Fixed64::RcpFastest); }
+    static inline FP_LONG Cbrt(int site, FP_LONG x) { return Unary(site, x, Fixed64::Cbrt, Fixed64::CbrtFast, Fixed64::CbrtFastest); }
+    static inline FP_LONG Div(int site, FP_LONG a, FP_LONG b) { return Binary(site, a, b, Fixed64::Div, Fixed64::DivFast, Fixed64::DivFastest); }
+    static inline FP_LONG Exp(int site, FP_LONG x) { return Unary(site, x, Fixed64::Exp, Fixed64::ExpFast, Fixed64::ExpFastest); }
+    static inline FP_LONG Exp2(int site, FP_LONG x) { return Unary(site, x, Fixed64::Exp2, Fixed64::Exp2Fast, Fixed64::Exp2Fastest); }
+    static inline FP_LONG Exp10(int site, FP_LONG x) { return Unary(site, x, Fixed64::Exp10, Fixed64::Exp10Fast, Fixed64::Exp10Fastest); }
+    static inline FP_LONG Log(int site, FP_LONG x) { return Unary(site, x, Fixed64::Log, Fixed64::LogFast, Fixed64::LogFastest); }
+    static inline FP_LONG Log2(int site, FP_LONG x) { return Unary(site, x, Fixed64::Log2, Fixed64::Log2Fast, Fixed64::Log2Fastest); }
+    static inline FP_LONG Log10(int site, FP_LONG x) { return Unary(site, x, Fixed64::Log10, Fixed64::Log10Fast, Fixed64::Log10Fastest); }
+    static inline FP_LONG Pow(int site, FP_LONG x, FP_LONG e) { return Binary(site, x, e, Fixed64::Pow, Fixed64::PowFast, Fixed64::PowFastest); }
+    static inline FP_LONG Sin(int site, FP_LONG x) { return Unary(site, x, Fixed64::Sin, Fixed64::SinFast, Fixed64::SinFastest); }
+    static inline FP_LONG Cos(int site, FP_LONG x) { return Unary(site, x, Fixed64::Cos, Fixed64::CosFast, Fixed64::CosFastest); }
+    static inline FP_LONG Tan(int site, FP_LONG x) { return Unary(site, x, Fixed64::Tan, Fixed64::TanFast, Fixed64::TanFastest); }
+    static inline FP_LONG Asin(int site, FP_LONG x) { return Unary(site, x, Fixed64::Asin, Fixed64::AsinFast, Fixed64::AsinFastest); }
+    static inline FP_LONG Acos(int site, FP_LONG x) { return Unary(site, x, Fixed64::Acos, Fixed64::AcosFast, Fixed64::AcosFastest); }
+    static inline FP_LONG Atan(int site, FP_LONG x) { return Unary(site, x, Fixed64::Atan, Fixed64::AtanFast, Fixed64::AtanFastest); }
+    static inline FP_LONG Atan2(int site, FP_LONG y, FP_LONG x) { return Binary(site, y, x, Fixed64::Atan2, Fixed64::Atan2Fast, Fixed64::Atan2Fastest); }
+    static inline FP_LONG Sigmoid(int site, FP_LONG x) { return Unary(site, x, Fixed64::Sigmoid, Fixed64::SigmoidFast, Fixed64::SigmoidFastest); }
+    static inline FP_LONG Tanh(int site, FP_LONG x) { return Unary(site, x, Fixed64::Tanh, Fixed64::TanhFast, Fixed64::TanhFastest); }
+    static inline FP_LONG Softplus(int site, FP_LONG x) { return Unary(site, x, Fixed64::Softplus, Fixed64::SoftplusFast, Fixed64::SoftplusFastest); }
+}
+
+#endif // __FIXEDTIER_H
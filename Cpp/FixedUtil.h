@@ -34,6 +34,102 @@
 // Include numeric types
 #include <stdint.h>
 
+// If FP_INSTRUMENT is defined, every public Fixed32/Fixed64 function counts its calls, builds log2
+// histograms of its first two arguments and counts invalid arguments, see FixedInstrument.h. With
+// FP_CUSTOM_INVALID_ARGS, the custom handlers need to call FixedInstrument::RecordInvalid() themselves.
+//#define FP_INSTRUMENT
+#ifdef FP_INSTRUMENT
+#   include "FixedInstrument.h"
+#   define FP_INSTRUMENT_CALL0(funcName) static const int fpInstrumentId = FixedInstrument::Register(funcName); FixedInstrument::Record(fpInstrumentId)
+#   define FP_INSTRUMENT_CALL1(funcName, a) static const int fpInstrumentId = FixedInstrument::Register(funcName); FixedInstrument::Record(fpInstrumentId, (int64_t)(a))
+#   define FP_INSTRUMENT_CALL2(funcName, a, b) static const int fpInstrumentId = FixedInstrument::Register(funcName); FixedInstrument::Record(fpInstrumentId, (int64_t)(a), (int64_t)(b))
+#   define FP_INSTRUMENT_INVALID(funcName) FixedInstrument::RecordInvalid(funcName)
+#else
+#   define FP_INSTRUMENT_CALL0(funcName)
+#   define FP_INSTRUMENT_CALL1(funcName, a)
+#   define FP_INSTRUMENT_CALL2(funcName, a, b)
+#   define FP_INSTRUMENT_INVALID(funcName)
+#endif
+
+// Approximation kernels used by the precision tiers (e.g. FP_KERNEL_RCP_FAST in RcpFast() and DivFast()).
+// CppTuner benchmarks the alternatives on the host CPU and writes a header that redefines them; include
+// it before FixedUtil.h, or name it in FP_KERNEL_CONFIG (e.g. -DFP_KERNEL_CONFIG='"FixedKernels.h"').
+#ifdef FP_KERNEL_CONFIG
+#   include FP_KERNEL_CONFIG
+#endif
+#ifndef FP_KERNEL_EXP2_FULL
+#   define FP_KERNEL_EXP2_FULL Exp2Poly5
+#endif
+#ifndef FP_KERNEL_EXP2_FAST
+#   define FP_KERNEL_EXP2_FAST Exp2Poly4
+#endif
+#ifndef FP_KERNEL_EXP2_FASTEST
+#   define FP_KERNEL_EXP2_FASTEST Exp2Poly3
+#endif
+#ifndef FP_KERNEL_RCP_FULL
+#   define FP_KERNEL_RCP_FULL RcpPoly4Lut8
+#endif
+#ifndef FP_KERNEL_RCP_FAST
+#   define FP_KERNEL_RCP_FAST RcpPoly6
+#endif
+#ifndef FP_KERNEL_RCP_FASTEST
+#   define FP_KERNEL_RCP_FASTEST RcpPoly4
+#endif
+#ifndef FP_KERNEL_SQRT_FULL
+#   define FP_KERNEL_SQRT_FULL SqrtPoly3Lut8
+#endif
+#ifndef FP_KERNEL_SQRT_FAST
+#   define FP_KERNEL_SQRT_FAST SqrtPoly4
+#endif
+#ifndef FP_KERNEL_SQRT_FASTEST
+#   define FP_KERNEL_SQRT_FASTEST SqrtPoly3
+#endif
+#ifndef FP_KERNEL_RSQRT_FULL
+#   define FP_KERNEL_RSQRT_FULL RSqrtPoly3Lut16
+#endif
+#ifndef FP_KERNEL_RSQRT_FAST
+#   define FP_KERNEL_RSQRT_FAST RSqrtPoly5
+#endif
+#ifndef FP_KERNEL_RSQRT_FASTEST
+#   define FP_KERNEL_RSQRT_FASTEST RSqrtPoly3
+#endif
+#ifndef FP_KERNEL_LOG_FULL
+#   define FP_KERNEL_LOG_FULL LogPoly5Lut8
+#endif
+#ifndef FP_KERNEL_LOG_FAST
+#   define FP_KERNEL_LOG_FAST LogPoly3Lut8
+#endif
+#ifndef FP_KERNEL_LOG_FASTEST
+#   define FP_KERNEL_LOG_FASTEST LogPoly5
+#endif
+#ifndef FP_KERNEL_LOG2_FULL
+#   define FP_KERNEL_LOG2_FULL Log2Poly4Lut16
+#endif
+#ifndef FP_KERNEL_LOG2_FAST
+#   define FP_KERNEL_LOG2_FAST Log2Poly3Lut16
+#endif
+#ifndef FP_KERNEL_LOG2_FASTEST
+#   define FP_KERNEL_LOG2_FASTEST Log2Poly5
+#endif
+#ifndef FP_KERNEL_SIN_FULL
+#   define FP_KERNEL_SIN_FULL SinPoly4
+#endif
+#ifndef FP_KERNEL_SIN_FAST
+#   define FP_KERNEL_SIN_FAST SinPoly3
+#endif
+#ifndef FP_KERNEL_SIN_FASTEST
+#   define FP_KERNEL_SIN_FASTEST SinPoly2
+#endif
+#ifndef FP_KERNEL_ATAN_FULL
+#   define FP_KERNEL_ATAN_FULL AtanPoly5Lut8
+#endif
+#ifndef FP_KERNEL_ATAN_FAST
+#   define FP_KERNEL_ATAN_FAST AtanPoly3Lut8
+#endif
+#ifndef FP_KERNEL_ATAN_FASTEST
+#   define FP_KERNEL_ATAN_FASTEST AtanPoly4
+#endif
+
 
 // If FP_ASSERT is not custom-defined, then use the standard one
 #ifndef FP_ASSERT
@@ -68,10 +164,10 @@ namespace FixedUtil
     extern void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue);
     extern void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue1, FP_LONG argValue2);
 #else
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue) { }
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue1, FP_INT argValue2) { }
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue) { }
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue1, FP_LONG argValue2) { }
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue) { FP_INSTRUMENT_INVALID(funcName); }
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue1, FP_INT argValue2) { FP_INSTRUMENT_INVALID(funcName); }
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue) { FP_INSTRUMENT_INVALID(funcName); }
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue1, FP_LONG argValue2) { FP_INSTRUMENT_INVALID(funcName); }
 #endif
 
 
@@ -89,6 +185,28 @@ namespace FixedUtil
         return (FP_INT)((FP_LONG)a * (FP_LONG)b >> 30);
     }
 
+    // The XxxEstrin kernels evaluate the same polynomials as Xxx with Estrin's scheme: pairs of
+    // terms are computed in parallel and combined with powers of a^2, which roughly halves the
+    // chain of dependent multiplies compared to Horner's rule. Use them where latency matters
+    // more than throughput (e.g. with the FP_KERNEL_* tiers in C++).
+
+    /// <summary>
+    /// Returns a^2 as s1.31 (one more fractional bit than s2.30). Requires 0 <= a <= 1.0.
+    /// </summary>
+    static FP_LONG EstrinSquare(FP_INT a)
+    {
+        return (FP_LONG)a * (FP_LONG)a >> 29;
+    }
+
+    /// <summary>
+    /// Returns a * b + a2 * c as s2.30, where a2 comes from EstrinSquare(). The products are
+    /// summed at full precision and truncated only once.
+    /// </summary>
+    static FP_INT EstrinStep(FP_INT a, FP_INT b, FP_LONG a2, FP_INT c)
+    {
+        return (FP_INT)(((FP_LONG)a * (FP_LONG)b + (a2 * (FP_LONG)c >> 1)) >> 30);
+    }
+
     static FP_INT ShiftLeft(FP_INT v, FP_INT shift)
     {
         return (shift >= 0) ? (v << shift) : (v >> -shift);
@@ -109,6 +227,17 @@ namespace FixedUtil
         return (FP_LONG)((FP_ULONG)v >> shift);
     }
 
+    /// <summary>
+    /// Clamps v to the FP_INT range without branching. Requires |v| < 2^62.
+    /// </summary>
+    static FP_INT SaturateToInt(FP_LONG v)
+    {
+        FP_LONG hi = (v + INT64_C(0x80000000)) >> 32;         // zero iff v fits in an FP_INT
+        FP_LONG overflow = (hi | -hi) >> 63;           // all ones iff v does not fit
+        FP_LONG sat = (v >> 63) ^ INT64_C(0x7FFFFFFF);         // FP_INT.MaxValue or FP_INT.MinValue
+        return (FP_INT)((v & ~overflow) | (sat & overflow));
+    }
+
     // Exp2()
 
     // Precision: 13.24 bits
@@ -132,6 +261,16 @@ namespace FixedUtil
         return y;
     }
 
+    // Exp2Poly4 evaluated with Estrin's scheme.
+    // Precision: 18.19 bits
+    static FP_INT Exp2Poly4Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, 55869331, a2, 14555373) + 259179547;
+        y = EstrinStep(a, 744137573, a2, y) + 1073741824;
+        return y;
+    }
+
     // Precision: 23.37 bits
     static FP_INT Exp2Poly5(FP_INT a)
     {
@@ -144,6 +283,17 @@ namespace FixedUtil
         return y;
     }
 
+    // Exp2Poly5 evaluated with Estrin's scheme.
+    // Precision: 23.37 bits
+    static FP_INT Exp2Poly5Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = Qmul30(a, 2017903) + 9654007;
+        y = EstrinStep(a, 59934847, a2, y) + 257869054;
+        y = EstrinStep(a, 744266012, a2, y) + 1073741824;
+        return y;
+    }
+
     // Rcp()
 
     // Precision: 11.33 bits
@@ -157,16 +307,48 @@ namespace FixedUtil
         return y;
     }
 
+    // RcpPoly4 evaluated with Estrin's scheme.
+    // Precision: 11.33 bits
+    static FP_INT RcpPoly4Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, -581431354, a2, 166123244) + 939345296;
+        y = EstrinStep(a, -1060908097, a2, y) + 1073741824;
+        return y;
+    }
+
+    static FP_INT RcpPoly6Table[] =
+    {
+        77852993, // 0.0725062501842326696626758301282171253618850679805450684783331254738896577827939599454470990870969993306249485759929666981
+        -350338469, // -0.326278125829047013482041235576977064128482805912452808152499064632503460022572819754511945891936496987812268591968349959
+        723231606, // 0.673561921455982545223734340382301840739167811454662043292934558465813280438563313561682188125190962075365760110255605888
+        -974250754, // -0.907341721411285515029553588773713935349385980480415781958608445152553325879092398556945676696228380651281188866035287881
+        1059679220, // 0.986903179099804504543521516658287329916121575881841375617775839327272856972646872081214163224722216327427202183393238047
+        -1073045505, // -0.999351503499687190918336862818115296539305668924179897277936013481919009292338927276885827848845300094324453411638172793
+        1073741824, // 1.0
+    };
+
     // Precision: 16.53 bits
     static FP_INT RcpPoly6(FP_INT a)
     {
-        FP_INT y = Qmul30(a, 77852993); // 0.0725062501842326696626758301282171253618850679805450684783331254738896577827939599454470990870969993306249485759929666981
-        y = Qmul30(a, y + -350338469); // -0.326278125829047013482041235576977064128482805912452808152499064632503460022572819754511945891936496987812268591968349959
-        y = Qmul30(a, y + 723231606); // 0.673561921455982545223734340382301840739167811454662043292934558465813280438563313561682188125190962075365760110255605888
-        y = Qmul30(a, y + -974250754); // -0.907341721411285515029553588773713935349385980480415781958608445152553325879092398556945676696228380651281188866035287881
-        y = Qmul30(a, y + 1059679220); // 0.986903179099804504543521516658287329916121575881841375617775839327272856972646872081214163224722216327427202183393238047
-        y = Qmul30(a, y + -1073045505); // -0.999351503499687190918336862818115296539305668924179897277936013481919009292338927276885827848845300094324453411638172793
-        y = y + 1073741824;
+        FP_INT y = Qmul30(a, RcpPoly6Table[0]);
+        y = Qmul30(a, y + RcpPoly6Table[1]);
+        y = Qmul30(a, y + RcpPoly6Table[2]);
+        y = Qmul30(a, y + RcpPoly6Table[3]);
+        y = Qmul30(a, y + RcpPoly6Table[4]);
+        y = Qmul30(a, y + RcpPoly6Table[5]);
+        y = y + RcpPoly6Table[6];
+        return y;
+    }
+
+    // RcpPoly6 evaluated with Estrin's scheme.
+    // Precision: 16.53 bits
+    static FP_INT RcpPoly6Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, RcpPoly6Table[1], a2, RcpPoly6Table[0]) + RcpPoly6Table[2];
+        y = EstrinStep(a, RcpPoly6Table[3], a2, y) + RcpPoly6Table[4];
+        y = EstrinStep(a, RcpPoly6Table[5], a2, y) + RcpPoly6Table[6];
         return y;
     }
 
@@ -213,6 +395,17 @@ namespace FixedUtil
         return y;
     }
 
+    // RcpPoly4Lut8 evaluated with Estrin's scheme.
+    // Precision: 24.07 bits
+    static FP_INT RcpPoly4Lut8Estrin(FP_INT a)
+    {
+        FP_INT offset = (a >> 27) * 5;
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, RcpPoly4Lut8Table[offset + 1], a2, RcpPoly4Lut8Table[offset + 0]) + RcpPoly4Lut8Table[offset + 2];
+        y = EstrinStep(a, RcpPoly4Lut8Table[offset + 3], a2, y) + RcpPoly4Lut8Table[offset + 4];
+        return y;
+    }
+
     // Sqrt()
 
     // Precision: 13.36 bits
@@ -225,14 +418,33 @@ namespace FixedUtil
         return y;
     }
 
+    static FP_INT SqrtPoly4Table[] =
+    {
+        -11559524, // -0.0107656468280005064933278905326776959702034851444407595549875999349858889266381514341825269487372902092181743561671344361
+        49235626, // 0.0458542501550120083313075597659725264999808459122954966477604412728019257521420334516113399358029950852981420572751187192
+        -129356986, // -0.120473082434524586846319215086079446047783981719931015048359535322204769538816469963000080874223090148906445903268633479
+        536439312, // 0.499598041480608133810028270062482694087678496329024351132266431975121211175419626795958802214798958007840324433072946221
+        1073741824, // 1.0
+    };
+
     // Precision: 16.50 bits
     static FP_INT SqrtPoly4(FP_INT a)
     {
-        FP_INT y = Qmul30(a, -11559524); // -0.0107656468280005064933278905326776959702034851444407595549875999349858889266381514341825269487372902092181743561671344361
-        y = Qmul30(a, y + 49235626); // 0.0458542501550120083313075597659725264999808459122954966477604412728019257521420334516113399358029950852981420572751187192
-        y = Qmul30(a, y + -129356986); // -0.120473082434524586846319215086079446047783981719931015048359535322204769538816469963000080874223090148906445903268633479
-        y = Qmul30(a, y + 536439312); // 0.499598041480608133810028270062482694087678496329024351132266431975121211175419626795958802214798958007840324433072946221
-        y = y + 1073741824; // 1.0
+        FP_INT y = Qmul30(a, SqrtPoly4Table[0]);
+        y = Qmul30(a, y + SqrtPoly4Table[1]);
+        y = Qmul30(a, y + SqrtPoly4Table[2]);
+        y = Qmul30(a, y + SqrtPoly4Table[3]);
+        y = y + SqrtPoly4Table[4];
+        return y;
+    }
+
+    // SqrtPoly4 evaluated with Estrin's scheme.
+    // Precision: 16.50 bits
+    static FP_INT SqrtPoly4Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, SqrtPoly4Table[1], a2, SqrtPoly4Table[0]) + SqrtPoly4Table[2];
+        y = EstrinStep(a, SqrtPoly4Table[3], a2, y) + SqrtPoly4Table[4];
         return y;
     }
 
@@ -283,6 +495,17 @@ namespace FixedUtil
         return y;
     }
 
+    // RSqrtPoly5 evaluated with Estrin's scheme.
+    // Precision: 16.08 bits
+    static FP_INT RSqrtPoly5Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = Qmul30(a, -34036183) + 140361627;
+        y = EstrinStep(a, -276049470, a2, y) + 391366758;
+        y = EstrinStep(a, -536134428, a2, y) + 1073741824;
+        return y;
+    }
+
     static FP_INT RSqrtPoly3Lut16Table[] =
     {
         -301579590, 401404709, -536857690, 1073741824,
@@ -314,6 +537,52 @@ namespace FixedUtil
         return y;
     }
 
+    // Cbrt()
+
+    // Precision: 13.28 bits
+    static FP_INT CbrtPoly3(FP_INT a)
+    {
+        FP_INT y = Qmul30(a, 24875688); // 0.02316728991615364536258091267227721181491
+        y = Qmul30(a, y + -101146232); // -0.09419977006585153966092771834623725687397
+        y = Qmul30(a, y + 355358647); // 0.3309535300445710590655574129521883956293
+        y = y + 1073741824; // 1.0
+        return y;
+    }
+
+    // Precision: 16.36 bits
+    static FP_INT CbrtPoly4(FP_INT a)
+    {
+        FP_INT y = Qmul30(a, -11429392); // -0.01064445152739261550540420979128303469646
+        y = Qmul30(a, y + 47171277); // 0.04393167535154753567149215682904135053567
+        y = Qmul30(a, y + -114101665); // -0.1062654575380883535291394673628276059506
+        y = Qmul30(a, y + 357447884); // 0.3328992836088065981302621276032976406817
+        y = y + 1073741824; // 1.0
+        return y;
+    }
+
+    static FP_INT CbrtPoly3Lut8Table[] =
+    {
+        56556123, -118605505, 357899400, 1073741824,
+        42015208, -113333164, 357239065, 1073770386,
+        32159428, -106051399, 355430016, 1073921534,
+        25223762, -98319174, 352545504, 1074281630,
+        20189917, -90815234, 348808740, 1074903258,
+        16440629, -83817509, 344449173, 1075809854,
+        13585999, -77417347, 339661473, 1077004835,
+        11371011, -71619481, 334599157, 1078479240,
+    };
+
+    // Precision: 23.49 bits
+    static FP_INT CbrtPoly3Lut8(FP_INT a)
+    {
+        FP_INT offset = (a >> 27) * 4;
+        FP_INT y = Qmul30(a, CbrtPoly3Lut8Table[offset + 0]);
+        y = Qmul30(a, y + CbrtPoly3Lut8Table[offset + 1]);
+        y = Qmul30(a, y + CbrtPoly3Lut8Table[offset + 2]);
+        y = y + CbrtPoly3Lut8Table[offset + 3];
+        return y;
+    }
+
     // Log()
 
     // Precision: 12.18 bits
@@ -327,6 +596,17 @@ namespace FixedUtil
         return y;
     }
 
+    // LogPoly5 evaluated with Estrin's scheme.
+    // Precision: 12.18 bits
+    static FP_INT LogPoly5Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = Qmul30(a, 34835446) + -149023176;
+        y = EstrinStep(a, 315630515, a2, y) + -530763208;
+        y = EstrinStep(a, 1073581542, a2, y);
+        return y;
+    }
+
     static FP_INT LogPoly3Lut4Table[] =
     {
         270509931, -528507852, 1073614348, 0,
@@ -394,6 +674,30 @@ namespace FixedUtil
         return y;
     }
 
+    static FP_INT LogPoly5Lut8EstrinTable[] =
+    {
+        166189159, -263271008, 357682461, -536867223, 1073741814, 0,
+        91797130, -221452381, 347549389, -535551692, 1073651718, 2559,
+        55429773, -177286543, 325776420, -530104991, 1072960646, 38103,
+        35101911, -139778071, 297915163, -519690478, 1071001695, 186417,
+        23102252, -110088504, 268427087, -504993810, 1067326167, 555414,
+        15701243, -87124604, 239861114, -487185708, 1061762610, 1252264,
+        10960108, -69430156, 213404033, -467374507, 1054333366, 2368437,
+        7703441, -55178389, 188423866, -445453304, 1044702281, 4063225,
+    };
+
+    // LogPoly5Lut8 evaluated with Estrin's scheme, with the constant terms refit for its rounding.
+    // Precision: 28.93 bits
+    static FP_INT LogPoly5Lut8Estrin(FP_INT a)
+    {
+        FP_INT offset = (a >> 27) * 6;
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = Qmul30(a, LogPoly5Lut8EstrinTable[offset + 0]) + LogPoly5Lut8EstrinTable[offset + 1];
+        y = EstrinStep(a, LogPoly5Lut8EstrinTable[offset + 2], a2, y) + LogPoly5Lut8EstrinTable[offset + 3];
+        y = EstrinStep(a, LogPoly5Lut8EstrinTable[offset + 4], a2, y) + LogPoly5Lut8EstrinTable[offset + 5];
+        return y;
+    }
+
     // Log2()
 
     // Precision: 12.29 bits
@@ -407,6 +711,17 @@ namespace FixedUtil
         return y;
     }
 
+    // Log2Poly5 evaluated with Estrin's scheme.
+    // Precision: 12.29 bits
+    static FP_INT Log2Poly5Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = Qmul30(a, 47840369) + -208941842;
+        y = EstrinStep(a, 450346773, a2, y) + -764275149;
+        y = EstrinStep(a, 1548771675, a2, y);
+        return y;
+    }
+
     static FP_INT Log2Poly4Lut4Table[] =
     {
         -262388804, 497357316, -773551400, 1549073482, 0,
@@ -534,6 +849,127 @@ namespace FixedUtil
         return y;
     }
 
+    // Log2Poly4Lut16 evaluated with Estrin's scheme.
+    // Precision: 28.75 bits
+    static FP_INT Log2Poly4Lut16Estrin(FP_INT a)
+    {
+        FP_INT offset = (a >> 26) * 5;
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, Log2Poly4Lut16Table[offset + 1], a2, Log2Poly4Lut16Table[offset + 0]) + Log2Poly4Lut16Table[offset + 2];
+        y = EstrinStep(a, Log2Poly4Lut16Table[offset + 3], a2, y) + Log2Poly4Lut16Table[offset + 4];
+        return y;
+    }
+
+    // log2(1 + x) at i/256 for i = 0..256 (as s2.30)
+    static FP_INT Log2Lut256Table[] =
+    {
+        0, 6039314, 12055174, 18047761, 24017256, 29963836, 35887675, 41788947,
+        47667823, 53524472, 59359063, 65171760, 70962728, 76732128, 82480119, 88206862,
+        93912511, 99597222, 105261148, 110904440, 116527248, 122129721, 127712004, 133274244,
+        138816582, 144339162, 149842124, 155325606, 160789745, 166234679, 171660541, 177067464,
+        182455581, 187825021, 193175914, 198508388, 203822568, 209118580, 214396548, 219656594,
+        224898839, 230123404, 235330407, 240519966, 245692198, 250847218, 255985140, 261106077,
+        266210141, 271297442, 276368092, 281422197, 286459867, 291481207, 296486323, 301475319,
+        306448299, 311405366, 316346620, 321272163, 326182095, 331076513, 335955515, 340819199,
+        345667660, 350500993, 355319292, 360122651, 364911162, 369684916, 374444004, 379188517,
+        383918542, 388634168, 393335482, 398022572, 402695523, 407354420, 411999347, 416630388,
+        421247625, 425851141, 430441017, 435017334, 439580170, 444129607, 448665721, 453188592,
+        457698295, 462194908, 466678506, 471149164, 475606957, 480051959, 484484242, 488903880,
+        493310944, 497705506, 502087636, 506457405, 510814882, 515160136, 519493235, 523814248,
+        528123241, 532420281, 536705435, 540978767, 545240343, 549490228, 553728485, 557955178,
+        562170370, 566374123, 570566499, 574747559, 578917365, 583075977, 587223455, 591359858,
+        595485245, 599599675, 603703206, 607795895, 611877800, 615948977, 620009483, 624059373,
+        628098702, 632127527, 636145900, 640153876, 644151509, 648138853, 652115959, 656082880,
+        660039669, 663986377, 667923055, 671849754, 675766525, 679673418, 683570481, 687457766,
+        691335320, 695203192, 699061430, 702910083, 706749198, 710578822, 714399001, 718209783,
+        722011213, 725803337, 729586201, 733359850, 737124328, 740879680, 744625951, 748363183,
+        752091421, 755810707, 759521085, 763222597, 766915285, 770599192, 774274358, 777940826,
+        781598637, 785247830, 788888448, 792520529, 796144114, 799759243, 803365955, 806964289,
+        810554283, 814135978, 817709409, 821274617, 824831638, 828380510, 831921271, 835453956,
+        838978604, 842495250, 846003931, 849504683, 852997541, 856482542, 859959719, 863429109,
+        866890747, 870344666, 873790901, 877229486, 880660455, 884083842, 887499680, 890908003,
+        894308843, 897702233, 901088206, 904466794, 907838029, 911201944, 914558569, 917907937,
+        921250079, 924585025, 927912807, 931233456, 934547002, 937853475, 941152905, 944445323,
+        947730758, 951009239, 954280797, 957545460, 960803257, 964054218, 967298370, 970535742,
+        973766362, 976990259, 980207461, 983417995, 986621888, 989819169, 993009864, 996194001,
+        999371606, 1002542707, 1005707329, 1008865499, 1012017244, 1015162589, 1018301561, 1021434185,
+        1024560487, 1027680492, 1030794226, 1033901713, 1037002979, 1040098049, 1043186948, 1046269699,
+        1049346328, 1052416858, 1055481314, 1058539720, 1061592099, 1064638476, 1067678873, 1070713315,
+        1073741824
+    };
+
+    // Linear interpolation of a 256-entry table, for a in [0, 1).
+    // Precision: 18.48 bits
+    static FP_INT Log2Lut256(FP_INT a)
+    {
+        FP_INT i = a >> 22;
+        FP_INT y0 = Log2Lut256Table[i];
+        FP_INT y1 = Log2Lut256Table[i + 1];
+        return y0 + (FP_INT)((FP_LONG)(y1 - y0) * (a & 0x3FFFFF) >> 22);
+    }
+
+    // Log10()
+
+    // Precision: 10.55 bits
+    static FP_INT Log10Poly5(FP_INT a)
+    {
+        FP_INT y = Qmul30(a, 14401385); // 0.01341233540708803861268695554178794449247
+        y = Qmul30(a, y + -62897759); // -0.05857810354309957455195914770509620204025
+        y = Qmul30(a, y + 135567884); // 0.1262574308424707705095453355596477125153
+        y = Qmul30(a, y + -230069742); // -0.2142691458391756083071417748030756161058
+        y = Qmul30(a, y + 466226730); // 0.4342074787966324247783220399856858257022
+        y = y + 0; // 4.342944819032301129270337046468306605951e-14
+        return y;
+    }
+
+    static FP_INT Log10Poly3Lut8Table[] =
+    {
+        134357621, -232117025, 466312112, 0,
+        93397598, -218148521, 464644185, 70233,
+        68962641, -200181898, 460200861, 439946,
+        52414821, -181753295, 453333082, 1296480,
+        40772928, -164396362, 444688431, 2734809,
+        32333652, -148631924, 434858811, 4780708,
+        26050683, -134521774, 424285688, 7424218,
+        21000288, -121209431, 412578701, 10858939,
+    };
+
+    // Precision: 14.09 bits
+    static FP_INT Log10Poly3Lut8(FP_INT a)
+    {
+        FP_INT offset = (a >> 27) * 4;
+        FP_INT y = Qmul30(a, Log10Poly3Lut8Table[offset + 0]);
+        y = Qmul30(a, y + Log10Poly3Lut8Table[offset + 1]);
+        y = Qmul30(a, y + Log10Poly3Lut8Table[offset + 2]);
+        y = y + Log10Poly3Lut8Table[offset + 3];
+        return y;
+    }
+
+    static FP_INT Log10Poly5Lut8Table[] =
+    {
+        72100478, -114317608, 155337913, -233158429, 466320145, 0,
+        39832033, -96143027, 150926869, -232584998, 466280826, 1118,
+        24054082, -76965305, 141464748, -230216073, 465980029, 16600,
+        15233783, -60681265, 129362345, -225689763, 465128187, 81127,
+        10026621, -47792374, 116555669, -219304398, 463530610, 241577,
+        6814771, -37823311, 104150532, -211568452, 461112976, 544491,
+        4757116, -30141743, 92661666, -202963113, 457885051, 1029591,
+        3343609, -23954416, 81813919, -193441326, 453700593, 1766119,
+    };
+
+    // Precision: 24.96 bits
+    static FP_INT Log10Poly5Lut8(FP_INT a)
+    {
+        FP_INT offset = (a >> 27) * 6;
+        FP_INT y = Qmul30(a, Log10Poly5Lut8Table[offset + 0]);
+        y = Qmul30(a, y + Log10Poly5Lut8Table[offset + 1]);
+        y = Qmul30(a, y + Log10Poly5Lut8Table[offset + 2]);
+        y = Qmul30(a, y + Log10Poly5Lut8Table[offset + 3]);
+        y = Qmul30(a, y + Log10Poly5Lut8Table[offset + 4]);
+        y = y + Log10Poly5Lut8Table[offset + 5];
+        return y;
+    }
+
     // Sin()
 
     // Precision: 12.55 bits
@@ -566,6 +1002,65 @@ namespace FixedUtil
         return y;
     }
 
+    // SinPoly4 evaluated with Estrin's scheme.
+    // Precision: 27.13 bits
+    static FP_INT SinPoly4Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, -5018587, a2, 162679) + 85566362;
+        y = EstrinStep(a, -693598342, a2, y) + 1686629713;
+        return y;
+    }
+
+    // sin(2pi * x) at i/256 for i = 0..256 (as s2.30)
+    static FP_INT SinLut256Table[] =
+    {
+        0, 26350943, 52686014, 78989349, 105245103, 131437462, 157550647, 183568930,
+        209476638, 235258165, 260897982, 286380643, 311690799, 336813204, 361732726, 386434353,
+        410903207, 435124548, 459083786, 482766489, 506158392, 529245404, 552013618, 574449320,
+        596538995, 618269338, 639627258, 660599890, 681174602, 701339000, 721080937, 740388522,
+        759250125, 777654384, 795590213, 813046808, 830013654, 846480531, 862437520, 877875009,
+        892783698, 907154608, 920979082, 934248793, 946955747, 959092290, 970651112, 981625251,
+        992008094, 1001793390, 1010975242, 1019548121, 1027506862, 1034846671, 1041563127, 1047652185,
+        1053110176, 1057933813, 1062120190, 1065666786, 1068571464, 1070832474, 1072448455, 1073418433,
+        1073741824, 1073418433, 1072448455, 1070832474, 1068571464, 1065666786, 1062120190, 1057933813,
+        1053110176, 1047652185, 1041563127, 1034846671, 1027506862, 1019548121, 1010975242, 1001793390,
+        992008094, 981625251, 970651112, 959092290, 946955747, 934248793, 920979082, 907154608,
+        892783698, 877875009, 862437520, 846480531, 830013654, 813046808, 795590213, 777654384,
+        759250125, 740388522, 721080937, 701339000, 681174602, 660599890, 639627258, 618269338,
+        596538995, 574449320, 552013618, 529245404, 506158392, 482766489, 459083786, 435124548,
+        410903207, 386434353, 361732726, 336813204, 311690799, 286380643, 260897982, 235258165,
+        209476638, 183568930, 157550647, 131437462, 105245103, 78989349, 52686014, 26350943,
+        0, -26350943, -52686014, -78989349, -105245103, -131437462, -157550647, -183568930,
+        -209476638, -235258165, -260897982, -286380643, -311690799, -336813204, -361732726, -386434353,
+        -410903207, -435124548, -459083786, -482766489, -506158392, -529245404, -552013618, -574449320,
+        -596538995, -618269338, -639627258, -660599890, -681174602, -701339000, -721080937, -740388522,
+        -759250125, -777654384, -795590213, -813046808, -830013654, -846480531, -862437520, -877875009,
+        -892783698, -907154608, -920979082, -934248793, -946955747, -959092290, -970651112, -981625251,
+        -992008094, -1001793390, -1010975242, -1019548121, -1027506862, -1034846671, -1041563127, -1047652185,
+        -1053110176, -1057933813, -1062120190, -1065666786, -1068571464, -1070832474, -1072448455, -1073418433,
+        -1073741824, -1073418433, -1072448455, -1070832474, -1068571464, -1065666786, -1062120190, -1057933813,
+        -1053110176, -1047652185, -1041563127, -1034846671, -1027506862, -1019548121, -1010975242, -1001793390,
+        -992008094, -981625251, -970651112, -959092290, -946955747, -934248793, -920979082, -907154608,
+        -892783698, -877875009, -862437520, -846480531, -830013654, -813046808, -795590213, -777654384,
+        -759250125, -740388522, -721080937, -701339000, -681174602, -660599890, -639627258, -618269338,
+        -596538995, -574449320, -552013618, -529245404, -506158392, -482766489, -459083786, -435124548,
+        -410903207, -386434353, -361732726, -336813204, -311690799, -286380643, -260897982, -235258165,
+        -209476638, -183568930, -157550647, -131437462, -105245103, -78989349, -52686014, -26350943,
+        0
+    };
+
+    // Returns sin(z * pi/2) by linear interpolation of a 256-entry table. Unlike the polynomials
+    // above, takes the angle z directly: the whole FP_INT range is one period (z = 1.0 is pi/2).
+    // Precision: 13.69 bits
+    static FP_INT SinLut256(FP_INT z)
+    {
+        FP_INT i = (z >> 24) & 0xFF;
+        FP_INT y0 = SinLut256Table[i];
+        FP_INT y1 = SinLut256Table[i + 1];
+        return y0 + (FP_INT)((FP_LONG)(y1 - y0) * (z & 0xFFFFFF) >> 24);
+    }
+
     // Atan()
 
     // Precision: 11.51 bits
@@ -578,6 +1073,16 @@ namespace FixedUtil
         return y;
     }
 
+    // AtanPoly4 evaluated with Estrin's scheme.
+    // Precision: 11.51 bits
+    static FP_INT AtanPoly4Estrin(FP_INT a)
+    {
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = EstrinStep(a, -389730008, a2, 160726798) + -1791887;
+        y = EstrinStep(a, 1074109956, a2, y);
+        return y;
+    }
+
     static FP_INT AtanPoly5Lut8Table[] =
     {
         204464916, 1544566, -357994250, 1395, 1073741820, 0,
@@ -604,6 +1109,31 @@ namespace FixedUtil
         return y;
     }
 
+    static FP_INT AtanPoly5Lut8EstrinTable[] =
+    {
+        204464916, 1544566, -357994250, 1395, 1073741820, 0,
+        119369854, 56362968, -372884915, 2107694, 1073588633, 4535,
+        10771151, 190921163, -440520632, 19339556, 1071365339, 120611,
+        -64491917, 329189978, -542756389, 57373179, 1064246365, 656900,
+        -89925028, 390367074, -601765924, 85907899, 1057328034, 1329794,
+        -80805750, 360696628, -563142238, 60762238, 1065515580, 263159,
+        -58345538, 276259197, -435975641, -35140679, 1101731779, -5215391,
+        -36116738, 179244146, -266417331, -183483381, 1166696761, -16608599,
+        0, 0, 0, 0, 0, 843314857 // Atan(1.0)
+    };
+
+    // AtanPoly5Lut8 evaluated with Estrin's scheme, with the constant terms refit for its rounding.
+    // Precision: 29.07 bits
+    static FP_INT AtanPoly5Lut8Estrin(FP_INT a)
+    {
+        FP_INT offset = (a >> 27) * 6;
+        FP_LONG a2 = EstrinSquare(a);
+        FP_INT y = Qmul30(a, AtanPoly5Lut8EstrinTable[offset + 0]) + AtanPoly5Lut8EstrinTable[offset + 1];
+        y = EstrinStep(a, AtanPoly5Lut8EstrinTable[offset + 2], a2, y) + AtanPoly5Lut8EstrinTable[offset + 3];
+        y = EstrinStep(a, AtanPoly5Lut8EstrinTable[offset + 4], a2, y) + AtanPoly5Lut8EstrinTable[offset + 5];
+        return y;
+    }
+
     static FP_INT AtanPoly3Lut8Table[] =
     {
         -351150132, -463916, 1073745980, 0,
@@ -629,6 +1159,493 @@ namespace FixedUtil
     }
 
 
+    // Sigmoid()
+
+    static FP_INT SigmoidPoly2Lut64Table[] =
+    {
+        -4052889, 135542595, 536870912,
+        -10363694, 126971248, 668360618,
+        -12791601, 105687339, 784968172,
+        -11873682, 79758433, 877863909,
+        -9367057, 55908119, 945748661,
+        -6683980, 37212937, 992289723,
+        -4480454, 23929830, 1022818680,
+        -2889220, 15050442, 1042268056,
+        -1819174, 9334580, 1054429278,
+        -1128801, 5739546, 1061944684,
+        -694199, 3510316, 1066555430,
+        -424609, 2139928, 1069371547,
+        -258857, 1301934, 1071086865,
+        -157492, 791141, 1072129942,
+        -95704, 480396, 1072763590,
+        -58113, 291576, 1073148282,
+        -35272, 176923, 1073381745,
+        -21403, 107337, 1073523396,
+        -12985, 65113, 1073609330,
+        -7877, 39497, 1073661458,
+        -4778, 23957, 1073693078,
+        -2898, 14531, 1073712258,
+        -1758, 8814, 1073723891,
+        -1066, 5346, 1073730947,
+        -647, 3243, 1073735227,
+        -392, 1967, 1073737823,
+        -238, 1193, 1073739397,
+        -144, 724, 1073740352,
+        -88, 439, 1073740931,
+        -53, 266, 1073741282,
+        -32, 161, 1073741496,
+        -20, 98, 1073741625,
+        -12, 59, 1073741703,
+        -7, 36, 1073741751,
+        -4, 22, 1073741780,
+        -3, 13, 1073741797,
+        -2, 8, 1073741808,
+        -1, 5, 1073741814,
+        -1, 3, 1073741818,
+        0, 2, 1073741820,
+        0, 1, 1073741822,
+        0, 1, 1073741823,
+        0, 0, 1073741823,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824,
+        0, 0, 1073741824
+    };
+
+    // Precision: 13.06 bits
+    static FP_INT SigmoidPoly2Lut64(FP_INT a)
+    {
+        FP_INT offset = (a >> 25) * 3;
+        FP_INT k = (a & 0x1FFFFFF) << 5;
+        FP_INT y = Qmul30(k, SigmoidPoly2Lut64Table[offset + 0]);
+        y = Qmul30(k, y + SigmoidPoly2Lut64Table[offset + 1]);
+        y = y + SigmoidPoly2Lut64Table[offset + 2];
+        return y;
+    }
+
+    static FP_INT SigmoidPoly3Lut64Table[] =
+    {
+        -2601291, -157661, 134248657, 536870912,
+        -1494265, -8136357, 126238176, 668360618,
+        -160923, -12559592, 105616252, 784968172,
+        674064, -12889895, 80100583, 877863909,
+        924425, -10754043, 56370680, 945748661,
+        833288, -7932118, 37627787, 992289723,
+        630811, -5424538, 24243103, 1022818680,
+        435501, -3540702, 15266423, 1042268056,
+        285301, -2245852, 9475958, 1054429278,
+        181234, -1399800, 5829312, 1061944684,
+        113032, -863200, 3566285, 1066555430,
+        69722, -528850, 2174446, 1069371547,
+        42722, -322728, 1323083, 1071086865,
+        26073, -196471, 804047, 1072129942,
+        15873, -119434, 488253, 1072763590,
+        9650, -72539, 296352, 1073148282,
+        5861, -44034, 179824, 1073381745,
+        3558, -26721, 109098, 1073523396,
+        2159, -16212, 66182, 1073609330,
+        1310, -9835, 40145, 1073661458,
+        795, -5966, 24351, 1073693078,
+        482, -3619, 14770, 1073712258,
+        292, -2195, 8959, 1073723891,
+        177, -1331, 5434, 1073730947,
+        108, -808, 3296, 1073735227,
+        65, -490, 1999, 1073737823,
+        40, -297, 1212, 1073739397,
+        24, -180, 735, 1073740352,
+        15, -109, 446, 1073740931,
+        9, -66, 271, 1073741282,
+        5, -40, 164, 1073741496,
+        3, -24, 100, 1073741625,
+        2, -15, 60, 1073741703,
+        1, -9, 37, 1073741751,
+        1, -5, 22, 1073741780,
+        0, -3, 13, 1073741797,
+        0, -2, 8, 1073741808,
+        0, -1, 5, 1073741814,
+        0, -1, 3, 1073741818,
+        0, 0, 2, 1073741820,
+        0, 0, 1, 1073741822,
+        0, 0, 1, 1073741823,
+        0, 0, 0, 1073741823,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824,
+        0, 0, 0, 1073741824
+    };
+
+    // Precision: 18.13 bits
+    static FP_INT SigmoidPoly3Lut64(FP_INT a)
+    {
+        FP_INT offset = (a >> 25) * 4;
+        FP_INT k = (a & 0x1FFFFFF) << 5;
+        FP_INT y = Qmul30(k, SigmoidPoly3Lut64Table[offset + 0]);
+        y = Qmul30(k, y + SigmoidPoly3Lut64Table[offset + 1]);
+        y = Qmul30(k, y + SigmoidPoly3Lut64Table[offset + 2]);
+        y = y + SigmoidPoly3Lut64Table[offset + 3];
+        return y;
+    }
+
+    static FP_INT SigmoidPoly5Lut64Table[] =
+    {
+        60253, 14286, -2804344, 1928, 134217582, 536870912,
+        9996, 323925, -2171065, -7721715, 126166413, 668360618,
+        -28410, 358947, -796528, -12193409, 105555138, 784968172,
+        -30667, 204847, 353194, -12715057, 80072436, 877863909,
+        -16804, 49836, 873265, -10733302, 56368067, 945748661,
+        -5001, -31700, 911169, -7982198, 37636686, 992289723,
+        724, -54478, 737670, -5488590, 24254050, 1022818680,
+        2409, -49744, 528010, -3595057, 15275603, 1042268056,
+        2349, -37312, 353123, -2285344, 9482591, 1054429278,
+        1792, -25507, 227056, -1426355, 5833760, 1061944684,
+        1232, -16588, 142638, -880311, 3569146, 1066555430,
+        803, -10486, 88367, -539610, 2176243, 1069371547,
+        508, -6519, 54289, -329397, 1324196, 1071086865,
+        316, -4013, 33184, -200569, 804731, 1072129942,
+        195, -2456, 20222, -121939, 488671, 1072763590,
+        119, -1498, 12300, -74066, 296606, 1073148282,
+        73, -912, 7473, -44962, 179979, 1073381745,
+        44, -554, 4538, -27285, 109192, 1073523396,
+        27, -336, 2754, -16555, 66239, 1073609330,
+        16, -204, 1671, -10043, 40180, 1073661458,
+        10, -124, 1014, -6092, 24372, 1073693078,
+        6, -75, 615, -3695, 14783, 1073712258,
+        4, -46, 373, -2241, 8966, 1073723891,
+        2, -28, 226, -1360, 5438, 1073730947,
+        1, -17, 137, -825, 3299, 1073735227,
+        1, -10, 83, -500, 2001, 1073737823,
+        0, -6, 50, -303, 1213, 1073739397,
+        0, -4, 31, -184, 736, 1073740352,
+        0, -2, 19, -112, 446, 1073740931,
+        0, -1, 11, -68, 271, 1073741282,
+        0, -1, 7, -41, 164, 1073741496,
+        0, -1, 4, -25, 100, 1073741625,
+        0, 0, 3, -15, 60, 1073741703,
+        0, 0, 2, -9, 37, 1073741751,
+        0, 0, 1, -6, 22, 1073741780,
+        0, 0, 1, -3, 13, 1073741797,
+        0, 0, 0, -2, 8, 1073741808,
+        0, 0, 0, -1, 5, 1073741814,
+        0, 0, 0, -1, 3, 1073741818,
+        0, 0, 0, 0, 2, 1073741820,
+        0, 0, 0, 0, 1, 1073741822,
+        0, 0, 0, 0, 1, 1073741823,
+        0, 0, 0, 0, 0, 1073741823,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824,
+        0, 0, 0, 0, 0, 1073741824
+    };
+
+    // Precision: 27.56 bits
+    static FP_INT SigmoidPoly5Lut64(FP_INT a)
+    {
+        FP_INT offset = (a >> 25) * 6;
+        FP_INT k = (a & 0x1FFFFFF) << 5;
+        FP_INT y = Qmul30(k, SigmoidPoly5Lut64Table[offset + 0]);
+        y = Qmul30(k, y + SigmoidPoly5Lut64Table[offset + 1]);
+        y = Qmul30(k, y + SigmoidPoly5Lut64Table[offset + 2]);
+        y = Qmul30(k, y + SigmoidPoly5Lut64Table[offset + 3]);
+        y = Qmul30(k, y + SigmoidPoly5Lut64Table[offset + 4]);
+        y = y + SigmoidPoly5Lut64Table[offset + 5];
+        return y;
+    }
+
+    // Softplus()
+
+    static FP_INT SoftplusPoly2Lut64Table[] =
+    {
+        32926999, -268151832, 744261118,
+        29183064, -201857174, 509036286,
+        23227285, -143323600, 336362176,
+        16957134, -96935081, 216265860,
+        11616004, -63196711, 136287914,
+        7614878, -40151814, 84707207,
+        4849204, -25075207, 52170272,
+        3031235, -15487166, 31944268,
+        1872910, -9498821, 19488337,
+        1148912, -5800787, 11862426,
+        701675, -3533031, 7210551,
+        427378, -2148326, 4379195,
+        259879, -1305033, 2658247,
+        157869, -792283, 1613093,
+        95842, -480816, 978680,
+        58165, -291730, 593706,
+        35291, -176980, 360140,
+        21409, -107358, 218450,
+        12987, -65121, 132502,
+        7878, -39500, 80369,
+        4778, -23958, 48747,
+        2898, -14532, 29567,
+        1758, -8814, 17933,
+        1066, -5346, 10877,
+        647, -3243, 6597,
+        392, -1967, 4001,
+        238, -1193, 2427,
+        144, -724, 1472,
+        88, -439, 893,
+        53, -266, 542,
+        32, -161, 328,
+        20, -98, 199,
+        12, -59, 121,
+        7, -36, 73,
+        4, -22, 44,
+        3, -13, 27,
+        2, -8, 16,
+        1, -5, 10,
+        1, -3, 6,
+        0, -2, 4,
+        0, -1, 2,
+        0, -1, 1,
+        0, 0, 1,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0,
+        0, 0, 0
+    };
+
+    // Precision: 13.35 bits
+    static FP_INT SoftplusPoly2Lut64(FP_INT a)
+    {
+        FP_INT offset = (a >> 25) * 3;
+        FP_INT k = (a & 0x1FFFFFF) << 5;
+        FP_INT y = Qmul30(k, SoftplusPoly2Lut64Table[offset + 0]);
+        y = Qmul30(k, y + SoftplusPoly2Lut64Table[offset + 1]);
+        y = y + SoftplusPoly2Lut64Table[offset + 2];
+        return y;
+    }
+
+    static FP_INT SoftplusPoly3Lut64Table[] =
+    {
+        -678101, 33956998, -268503729, 744261118,
+        -1732822, 31789833, -202731120, 509036286,
+        -2136291, 26432569, -144392593, 336362176,
+        -1980978, 19925162, -97922130, 216265860,
+        -1561301, 13953268, -63972674, 136287914,
+        -1113294, 9280601, -40704243, 84707207,
+        -745904, 5964870, -25444969, 52170272,
+        -480841, 3750295, -15725386, 31944268,
+        -302695, 2325511, -9648727, 19488337,
+        -187799, 1429695, -5893771, 11862426,
+        -115485, 874331, -3590202, 7210551,
+        -70633, 532975, -2183290, 4379195,
+        -43059, 324253, -1326347, 2658247,
+        -26197, 197034, -805250, 1613093,
+        -15919, 119641, -488696, 978680,
+        -9666, 72616, -296515, 593706,
+        -5867, 44062, -179884, 360140,
+        -3560, 26732, -109120, 218450,
+        -2160, 16216, -66190, 132502,
+        -1310, 9836, -40148, 80369,
+        -795, 5966, -24352, 48747,
+        -482, 3619, -14770, 29567,
+        -292, 2195, -8959, 17933,
+        -177, 1331, -5434, 10877,
+        -108, 808, -3296, 6597,
+        -65, 490, -1999, 4001,
+        -40, 297, -1212, 2427,
+        -24, 180, -735, 1472,
+        -15, 109, -446, 893,
+        -9, 66, -271, 542,
+        -5, 40, -164, 328,
+        -3, 24, -100, 199,
+        -2, 15, -60, 121,
+        -1, 9, -37, 73,
+        -1, 5, -22, 44,
+        0, 3, -13, 27,
+        0, 2, -8, 16,
+        0, 1, -5, 10,
+        0, 1, -3, 6,
+        0, 0, -2, 4,
+        0, 0, -1, 2,
+        0, 0, -1, 1,
+        0, 0, 0, 1,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0,
+        0, 0, 0, 0
+    };
+
+    // Precision: 18.23 bits
+    static FP_INT SoftplusPoly3Lut64(FP_INT a)
+    {
+        FP_INT offset = (a >> 25) * 4;
+        FP_INT k = (a & 0x1FFFFFF) << 5;
+        FP_INT y = Qmul30(k, SoftplusPoly3Lut64Table[offset + 0]);
+        y = Qmul30(k, y + SoftplusPoly3Lut64Table[offset + 1]);
+        y = Qmul30(k, y + SoftplusPoly3Lut64Table[offset + 2]);
+        y = y + SoftplusPoly3Lut64Table[offset + 3];
+        return y;
+    }
+
+    static FP_INT SoftplusPoly5Lut64Table[] =
+    {
+        16510, -367400, 8879, 33552497, -268435319, 744261118,
+        34921, -274248, -1285472, 31541266, -202690578, 509036286,
+        28802, -91664, -2036230, 26389665, -144386889, 336362176,
+        12813, 52719, -2123523, 20019072, -97939027, 216265860,
+        775, 113866, -1791276, 14092548, -63996620, 136287914,
+        -4425, 115303, -1331083, 9409331, -40726062, 84707207,
+        -5269, 92011, -914666, 6063491, -25461570, 52170272,
+        -4372, 65330, -598836, 3818826, -15736879, 31944268,
+        -3144, 43485, -380558, 2370574, -9656268, 19488337,
+        -2102, 27881, -237472, 1458384, -5898566, 11862426,
+        -1350, 17485, -146544, 892248, -3593194, 7210551,
+        -848, 10821, -89821, 544036, -2185137, 4379195,
+        -525, 6644, -54827, 331033, -1327478, 2658247,
+        -322, 4060, -33383, 201173, -805940, 1613093,
+        -197, 2473, -20296, 122162, -489116, 978680,
+        -120, 1504, -12327, 74148, -296771, 593706,
+        -73, 914, -7483, 44993, -180040, 360140,
+        -44, 555, -4541, 27297, -109214, 218450,
+        -27, 337, -2755, 16559, -66247, 132502,
+        -16, 204, -1672, 10044, -40183, 80369,
+        -10, 124, -1014, 6093, -24373, 48747,
+        -6, 75, -615, 3695, -14783, 29567,
+        -4, 46, -373, 2241, -8966, 17933,
+        -2, 28, -226, 1360, -5438, 10877,
+        -1, 17, -137, 825, -3299, 6597,
+        -1, 10, -83, 500, -2001, 4001,
+        0, 6, -50, 303, -1214, 2427,
+        0, 4, -31, 184, -736, 1472,
+        0, 2, -19, 112, -446, 893,
+        0, 1, -11, 68, -271, 542,
+        0, 1, -7, 41, -164, 328,
+        0, 1, -4, 25, -100, 199,
+        0, 0, -3, 15, -60, 121,
+        0, 0, -2, 9, -37, 73,
+        0, 0, -1, 6, -22, 44,
+        0, 0, -1, 3, -13, 27,
+        0, 0, 0, 2, -8, 16,
+        0, 0, 0, 1, -5, 10,
+        0, 0, 0, 1, -3, 6,
+        0, 0, 0, 0, -2, 4,
+        0, 0, 0, 0, -1, 2,
+        0, 0, 0, 0, -1, 1,
+        0, 0, 0, 0, 0, 1,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0
+    };
+
+    // Precision: 28.40 bits
+    static FP_INT SoftplusPoly5Lut64(FP_INT a)
+    {
+        FP_INT offset = (a >> 25) * 6;
+        FP_INT k = (a & 0x1FFFFFF) << 5;
+        FP_INT y = Qmul30(k, SoftplusPoly5Lut64Table[offset + 0]);
+        y = Qmul30(k, y + SoftplusPoly5Lut64Table[offset + 1]);
+        y = Qmul30(k, y + SoftplusPoly5Lut64Table[offset + 2]);
+        y = Qmul30(k, y + SoftplusPoly5Lut64Table[offset + 3]);
+        y = Qmul30(k, y + SoftplusPoly5Lut64Table[offset + 4]);
+        y = y + SoftplusPoly5Lut64Table[offset + 5];
+        return y;
+    }
+
+
 
 
     #undef FP_ASSERT
@@ -0,0 +1,89 @@
+//
+// FixPointCS
+//
+// Copyright(c) Jere Sanisalo, Petri Kero
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Compiled with instrumentation so that the rest of the test binary runs without it.
+#define FP_INSTRUMENT
+
+#include <iostream>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "FixedUtil.h"
+#include "Fixed32.h"
+#include "Fixed64.h"
+#include "FixedInstrument.h"
+
+static const FixedInstrument::FunctionStats* FindStats(const std::vector<FixedInstrument::FunctionStats>& stats, const char* name)
+{
+	for (size_t i = 0; i < stats.size(); i++)
+	{
+		if (stats[i].name == name)
+			return &stats[i];
+	}
+	return 0;
+}
+
+void TestInstrument()
+{
+	int numErrors = 0;
+	FixedInstrument::Reset();
+
+	// Calls from several threads are all counted
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 3; t++)
+	{
+		threads.push_back(std::thread([]()
+		{
+			for (int i = 0; i < 1000; i++)
+				Fixed64::Sqrt(Fixed64::One);
+			Fixed64::Div(Fixed64::One, 0);
+		}));
+	}
+	for (size_t t = 0; t < threads.size(); t++)
+		threads[t].join();
+	Fixed32::Mul(-Fixed32::Half, 3 << 20);
+
+	std::vector<FixedInstrument::FunctionStats> stats = FixedInstrument::Snapshot();
+	const FixedInstrument::FunctionStats* sqrt = FindStats(stats, "Fixed64::Sqrt");
+	const FixedInstrument::FunctionStats* div = FindStats(stats, "Fixed64::Div");
+	const FixedInstrument::FunctionStats* mul = FindStats(stats, "Fixed32::Mul");
+	numErrors += (sqrt && sqrt->calls == 3000 && sqrt->invalidArgs == 0 && sqrt->histogram[0][33] == 3000) ? 0 : 1;
+	numErrors += (div && div->calls == 3 && div->invalidArgs == 3 && div->histogram[1][0] == 3) ? 0 : 1;
+	numErrors += (mul && mul->calls == 1 && mul->histogram[0][16] == 1 && mul->histogram[1][22] == 1) ? 0 : 1;
+
+	FILE* csv = tmpfile();
+	if (csv)
+	{
+		numErrors += FixedInstrument::WriteCsv(csv, stats) ? 0 : 1;
+		numErrors += (ftell(csv) > 0) ? 0 : 1;
+		fclose(csv);
+	}
+
+	FixedInstrument::Reset();
+	stats = FixedInstrument::Snapshot();
+	sqrt = FindStats(stats, "Fixed64::Sqrt");
+	numErrors += (sqrt && sqrt->calls == 0 && sqrt->histogram[0][33] == 0) ? 0 : 1;
+
+	std::cout << "Instrument: " << (numErrors == 0 ? "OK" : "MISMATCH") << " (" << numErrors << " errors)" << std::endl;
+}
@@ -395,6 +395,15 @@ namespace UnitTest
 			Util::Check("Fixed64::RcpFastest", Fixed64::RcpFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.RcpRefined()
+	static void Fixed64_RcpRefined()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFC50AE044CDLL, (int64_t)0xFFFFFFFFFFFF5685LL, (int64_t)0x366DF9D4CLL, (int64_t)0x5LL, (int64_t)0xFFFFFFFFCE180EC1LL, (int64_t)0xFFFFEC9321EFB416LL, (int64_t)0x7CDFF28B8LL, (int64_t)0xC990CB7LL, (int64_t)0xFFFFFFFFFFFF8B33LL, (int64_t)0xFFFFFE7D23ECFD47LL, (int64_t)0xB65E21FLL, (int64_t)0xB402F63BB7LL, (int64_t)0xFFA2195B4A5B5DBCLL, (int64_t)0xFFFFFFFFFFD71EEFLL, (int64_t)0x34FEAF3A7FB69C00LL, (int64_t)0x13ALL, (int64_t)0xFFFFFD24C6B6F80CLL, (int64_t)0xC799AE2E04CCB200LL, (int64_t)0x83BLL, (int64_t)0x965C29F3B2C0300LL, (int64_t)0xFFFFFFFFFE9ED53DLL, (int64_t)0xFE483216C0612DB0LL, (int64_t)0x1LL, (int64_t)0x91D3DADB35B5LL, (int64_t)0xFFFFFFFFFFFFC8EELL, (int64_t)0xFFFFFFFFFF57A8D5LL, (int64_t)0x179LL, (int64_t)0x35E8LL, (int64_t)0xFFFFFFFFFBCCEAADLL, (int64_t)0xFFFFFFFFFFFE79F8LL, (int64_t)0xBLL, (int64_t)0x949LL, (int64_t)0xFFFF5C14FF8AAB64LL, (int64_t)0xFFFFFFFFB845D8A0LL, (int64_t)0x680AB8LL, (int64_t)0xD8EF5793ELL, (int64_t)0xFFFFFFFFFFFFD0F5LL, (int64_t)0xFFFFFFFFFFFFFFD9LL, (int64_t)0x1FALL, (int64_t)0xE44DE1A005247LL, (int64_t)0xFD895D0ECC1D7E00LL, (int64_t)0xFFFFFFFFFFFEBE4FLL, (int64_t)0x168C49ALL, (int64_t)0x260A95383637B60LL, (int64_t)0xFFFF87982AE90CA0LL, (int64_t)0xFFFFFFB4C57BCCD4LL, (int64_t)0x3F0E3F279LL, (int64_t)0x1A7143F7604FCD00LL, (int64_t)0xFFFFFFBC2CBF50F8LL, (int64_t)0xFFFFFFFFFFFFFFEALL, (int64_t)0x3E405DC8971LL, (int64_t)0x291E12B351EFEC0LL, (int64_t)0xFFFFFFFFFFFFFF54LL, (int64_t)0xFFFFFFFF34AD1A40LL, (int64_t)0x68D3E3B4514C4CLL, (int64_t)0x89457145D85LL, (int64_t)0xFFFFFFFFFFFF98CDLL, (int64_t)0xFFFE81CBBA46C5A9LL, (int64_t)0x5F5C7DC31A561LL, (int64_t)0x4BLL, (int64_t)0xFFFFFFF2D35D5C0CLL, (int64_t)0xFFFFFFFFFFDAEFDELL, (int64_t)0x2LL, (int64_t)0x132A6A1C641D1900LL, (int64_t)0xFFFFFFDCD7A74F55LL, (int64_t)0xFFFFFFFFFFFEC5C8LL, (int64_t)0x46489804F9AD84LL, (int64_t)0x14F23D8LL, (int64_t)0xE6DA8CEE2DC20300LL, (int64_t)0xFFFFFFFFFC176435LL, (int64_t)0x1AB58A1FB8C15D0LL, (int64_t)0x12A660789ELL, (int64_t)0xFFE381347F1661F3LL, (int64_t)0xFFFFFFFFFFDB157BLL, (int64_t)0x3LL, (int64_t)0x119LL, (int64_t)0xFFFFFFFEC7EA7FE8LL, (int64_t)0xFFFFFFFFFFFFFFD4LL, (int64_t)0x1LL, (int64_t)0x2EDA3D39B5LL, (int64_t)0xFFF55236AE6F29C4LL, (int64_t)0xFFFFFFFFFFFFFC6FLL, (int64_t)0x32DE26D4D7LL, (int64_t)0x2F0949LL, (int64_t)0xFFFFFFE6F02B8497LL, (int64_t)0xFFFFFFFFFFFFFEEELL, (int64_t)0xDLL, (int64_t)0xCE62LL, (int64_t)0xFFFFFFD4356EEEC1LL, (int64_t)0xFFFFFCF7E16FC43ALL, (int64_t)0x21A1F3LL, (int64_t)0x7E0BE1FLL, (int64_t)0xFFFFFFFFFFFE5AFCLL, (int64_t)0xFFFFFFFFFFFFFFFALL, (int64_t)0x11545LL, (int64_t)0x1103E73AE4LL, (int64_t)0xFFFFFFFFFFFF94C4LL, (int64_t)0xFFFFFFFFFB4B4967LL, (int64_t)0x114FF7LL, (int64_t)0x62187C41LL };
+		static const int64_t output0[] = { (int64_t)0xFFFFFFFFFBA86B80LL, (int64_t)0xFFFE7D4FF7C962D4LL, (int64_t)0x4B40D06BLL, (int64_t)0x3333333333333333LL, (int64_t)0xFFFFFFFADECFD608LL, (int64_t)0xFFFFFFFFFFF2D240LL, (int64_t)0x20CD04D0LL, (int64_t)0x1452284B85LL, (int64_t)0xFFFDCEE869AF2959LL, (int64_t)0xFFFFFFFFFF56984CLL, (int64_t)0x1675CA3A61LL, (int64_t)0x16C10C3LL, (int64_t)0xFFFFFFFFFFFFFD47LL, (int64_t)0xFFFFF9BCD60EDE32LL, (int64_t)0x4LL, (int64_t)0xD0B69FCBD2580DLL, (int64_t)0xFFFFFFFFFFA65FFALL, (int64_t)0xFFFFFFFFFFFFFFFCLL, (int64_t)0x1F1A9BC34007C6LL, (int64_t)0x1BLL, (int64_t)0xFFFFFF466EF480A2LL, (int64_t)0xFFFFFFFFFFFFFF6BLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x1C168LL, (int64_t)0xFFFB59F52D6ECDC6LL, (int64_t)0xFFFFFE7AB19CFFB7LL, (int64_t)0xADD5E6323FD48ALL, (int64_t)0x4BFBD83A2CD18LL, (int64_t)0xFFFFFFC30A7F24B7LL, (int64_t)0xFFFF57F8F1B42651LL, (int64_t)0x1745D1745D1745D1LL, (int64_t)0x1B9225B1CF8919LL, (int64_t)0xFFFFFFFFFFFE7031LL, (int64_t)0xFFFFFFFC6E50C230LL, (int64_t)0x275E676C924LL, (int64_t)0x12E198CCLL, (int64_t)0xFFFA8EE4011AF9B0LL, (int64_t)0xF96F96F96F96F970LL, (int64_t)0x81848DA8FAF0D2LL, (int64_t)0x11F0LL, (int64_t)0xFFFFFFFFFFFFFF99LL, (int64_t)0xFFFF3446DCE9E057LL, (int64_t)0xB5A82C106CLL, (int64_t)0x6BLL, (int64_t)0xFFFFFFFFFFFDDFB5LL, (int64_t)0xFFFFFFFFFC98D77CLL, (int64_t)0x40F55FB8LL, (int64_t)0x9LL, (int64_t)0xFFFFFFFFFC39C066LL, (int64_t)0xF45D1745D1745D18LL, (int64_t)0x41CC35LL, (int64_t)0x63LL, (int64_t)0xFE82FA0BE82FA0BFLL, (int64_t)0xFFFFFFFEBDAD3D85LL, (int64_t)0x271LL, (int64_t)0x1DD6B6LL, (int64_t)0xFFFD84F4D8C8DAB0LL, (int64_t)0xFFFFFFFFFFFF5489LL, (int64_t)0x2AF3LL, (int64_t)0x369D0369D0369D0LL, (int64_t)0xFFFFFFFFEC917CD8LL, (int64_t)0xFFFFF917C4B7AFB2LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0xDLL, (int64_t)0xFFFFFFFFF8B7EFC8LL, (int64_t)0xFFFF2F6E929937D6LL, (int64_t)0x3A4LL, (int64_t)0xC38C51A195LL, (int64_t)0xFFFFFFFFFFFFFFF6LL, (int64_t)0xFFFFFFBE80FCE2F9LL, (int64_t)0x99LL, (int64_t)0xDBA02FDLL, (int64_t)0xFFFFFFFFFFFFF705LL, (int64_t)0xFFFFF910BB176D6ALL, (int64_t)0x5555555555555555LL, (int64_t)0xE939651FE2D8D3LL, (int64_t)0xFFFFFFFF2E0157C4LL, (int64_t)0xFA2E8BA2E8BA2E8CLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x576C5D8LL, (int64_t)0xFFFFFFFFFFFFE808LL, (int64_t)0xFFB83814303A5270LL, (int64_t)0x5085C18LL, (int64_t)0x5714EC91850LL, (int64_t)0xFFFFFFFFF5C9072ALL, (int64_t)0xFF10D148E03BCBAELL, (int64_t)0x13B13B13B13B13B1LL, (int64_t)0x13D8BBB0A6FD9LL, (int64_t)0xFFFFFFFFFA27723CLL, (int64_t)0xFFFFFFFFFFAB8F34LL, (int64_t)0x79C95B41C21LL, (int64_t)0x207EF798FFLL, (int64_t)0xFFFF64569C0F8B1BLL, (int64_t)0xD555555555555556LL, (int64_t)0xEC5CB0892A8ALL, (int64_t)0xF0B9AB8LL, (int64_t)0xFFFD9CDA49C84588LL, (int64_t)0xFFFFFFC999AF7802LL, (int64_t)0xEC980C17976LL, (int64_t)0x29C152925LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::RcpRefined", Fixed64::RcpRefined(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Rcp()
 	static void Fixed32_Rcp()
 	{
@@ -452,6 +461,16 @@ namespace UnitTest
 			Util::Check("Fixed64::DivFastest", Fixed64::DivFastest(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
 
+	// Fixed64.DivRefined()
+	static void Fixed64_DivRefined()
+	{
+		static const int64_t input0[] = { (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x1130FFFFLL, (int64_t)0x36C2FDA30A8LL, (int64_t)0x2CC8FF17AC9LL, (int64_t)0xFFFFFF895240CB03LL, (int64_t)0x5EE2A31C0DLL, (int64_t)0xFFFFFCCCA2E9106ALL, (int64_t)0x209DBEF191LL, (int64_t)0xFFFFFD31F2271074LL, (int64_t)0xA94537AF82LL, (int64_t)0x3D161B29DD2LL, (int64_t)0xFFFFFD15E40E3DFCLL, (int64_t)0x2AE6AFD320CLL, (int64_t)0xFFFFFE72D1FEDD96LL, (int64_t)0x353814405D7LL, (int64_t)0xDA030E9764LL, (int64_t)0xFFFFFDF1DA44CCB4LL, (int64_t)0xFFFFFE3BC1AC5B08LL, (int64_t)0xFFFFFED5C02688FCLL, (int64_t)0xFFFFFF2BB8150E28LL, (int64_t)0xFFFFFD2F17B3F26FLL, (int64_t)0x2863DBD63FCLL, (int64_t)0xFFFFFE54EC2D7BFALL, (int64_t)0x3BF9D1C334FLL, (int64_t)0xFFFFFD948B174DDALL, (int64_t)0xFFFFFC32EF754E36LL, (int64_t)0xFFFFFE72C60C5536LL, (int64_t)0xC87AB6FE10F56E00LL, (int64_t)0x790215C8F204400LL, (int64_t)0x229D9B80C53B3800LL, (int64_t)0x3C70312DF8E06400LL, (int64_t)0x127BC3CEA4F78800LL, (int64_t)0x3AA922AFF5524400LL, (int64_t)0x158155A4AB02AC00LL, (int64_t)0xF6AE42456D5C8400LL, (int64_t)0xDF7EC1F83EFD8400LL, (int64_t)0xC428332708506600LL, (int64_t)0x30888FE9E1112000LL, (int64_t)0xCB4B2BB216965800LL, (int64_t)0xC5A784370B4F0800LL, (int64_t)0xCE9A12CB1D342600LL, (int64_t)0xFCDDDF5979BBBE00LL, (int64_t)0xE893BA1151277400LL, (int64_t)0x2DCA7BE9DB94F800LL, (int64_t)0xC8AFDE2E115FBC00LL, (int64_t)0xF044914560892200LL, (int64_t)0x235D61A8C6BAC400LL, (int64_t)0xD0A5126E214A2400LL, (int64_t)0xC59E486B0B3C9000LL, (int64_t)0xD1C8D7F32391B000LL, (int64_t)0xD5D3FBD42BA7F800LL, (int64_t)0x2A91E811D523D000LL, (int64_t)0x3E78E5F1779LL, (int64_t)0x3E7F310E7EDLL, (int64_t)0x3E7B841BBCBLL, (int64_t)0x3E78048FF81LL, (int64_t)0x3E73572839ALL, (int64_t)0x3E705B8DD26LL, (int64_t)0x3E76B8E92D2LL, (int64_t)0x3E799933F59LL, (int64_t)0x3E723BC9238LL, (int64_t)0x3E7EF7D184BLL, (int64_t)0x3E72CEF6384LL, (int64_t)0x3E70D01E8E2LL, (int64_t)0x3E746A6DA0CLL, (int64_t)0x3E75BC9E394LL, (int64_t)0x3E7FDF25935LL, (int64_t)0x3E756C05984LL, (int64_t)0x3E75019A3E6LL, (int64_t)0x3E7D7B01273LL, (int64_t)0x3E74E42E1C8LL, (int64_t)0x3E76218415ELL, (int64_t)0x3E78FAD945FLL, (int64_t)0x3E762E11ADCLL, (int64_t)0x3E7DAB8E325LL, (int64_t)0x3E71A7CB9BELL, (int64_t)0x3E7FBD0FE1BLL };
+		static const int64_t input1[] = { (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFEF9ED0001LL, (int64_t)0xFFFFFFFCABAF92C1LL, (int64_t)0xFFF7574570D439B9LL, (int64_t)0x2FE8DB6DFLL, (int64_t)0x128E56D41489FLL, (int64_t)0xFB47FD93160D94C0LL, (int64_t)0xFFF4589E8FE66A83LL, (int64_t)0xDCB6426C500DLL, (int64_t)0x27AC09259632LL, (int64_t)0xFCAAE7B99A171160LL, (int64_t)0xFFFFFF83B95905F6LL, (int64_t)0x3875E598EE76LL, (int64_t)0x13E83FCDCFLL, (int64_t)0xFFFFFDAFFE17FE90LL, (int64_t)0xFFFFFF377D5600F3LL, (int64_t)0x2199E24EDBDB4600LL, (int64_t)0x34930619D546DE00LL, (int64_t)0xFFFD7DCF8A1692A6LL, (int64_t)0xFFFFFFC3CF7A14A4LL, (int64_t)0x248F400F322C9LL, (int64_t)0x3A64D65E46E19A0LL, (int64_t)0xFFFFEAA578BCFE07LL, (int64_t)0xFFFFFFFE90D3E5FELL, (int64_t)0x77DF8CB27LL, (int64_t)0x1400605DE05LL, (int64_t)0xFFFFFB8455C5D8F4LL, (int64_t)0x1ABD37A8B57A7000LL, (int64_t)0x243170EDC862E000LL, (int64_t)0xF0061339E00C400LL, (int64_t)0xD35AD53F26B5AA00LL, (int64_t)0x3199D02DE333A000LL, (int64_t)0xC52F068C0A5E0C00LL, (int64_t)0x52863278A50C800LL, (int64_t)0x233E59BEC67CB400LL, (int64_t)0xD9CF7AFD339EF600LL, (int64_t)0x2778A1E6CEF14400LL, (int64_t)0xCBD1BEAA17A37E00LL, (int64_t)0x20BCEFE1C179E000LL, (int64_t)0xFC59EE7B78B3DC00LL, (int64_t)0xDB536C9B36A6D800LL, (int64_t)0xE3063466460C6800LL, (int64_t)0x2574E29ACAE9C400LL, (int64_t)0x1BBB1CBAB7763800LL, (int64_t)0xC7CC70E90F98E200LL, (int64_t)0xDC78F22638F1E400LL, (int64_t)0xCB801B6C17003800LL, (int64_t)0x337EF029E6FDE000LL, (int64_t)0x446078C888C1000LL, (int64_t)0xCA9ECBE8153D9800LL, (int64_t)0xCC7C91D618F92400LL, (int64_t)0x5CABFDF8B958000LL, (int64_t)0xFFFFFC18962C149ALL, (int64_t)0xFFFFFC18045C50FDLL, (int64_t)0xFFFFFC1815603467LL, (int64_t)0xFFFFFC18EB583F30LL, (int64_t)0xFFFFFC1811DA1031LL, (int64_t)0xFFFFFC18D3119FC8LL, (int64_t)0xFFFFFC184CDAB5F5LL, (int64_t)0xFFFFFC187AF86145LL, (int64_t)0xFFFFFC1864DFD541LL, (int64_t)0xFFFFFC18AB2B771ELL, (int64_t)0xFFFFFC18E8B2DAD6LL, (int64_t)0xFFFFFC182DF0F57DLL, (int64_t)0xFFFFFC18B9CC4C04LL, (int64_t)0xFFFFFC1801D38DA1LL, (int64_t)0xFFFFFC1836C79959LL, (int64_t)0xFFFFFC1853EB157FLL, (int64_t)0xFFFFFC18D8195F96LL, (int64_t)0xFFFFFC18AB08B542LL, (int64_t)0xFFFFFC18B8D63F16LL, (int64_t)0xFFFFFC18E6E2FAB8LL, (int64_t)0xFFFFFC18421823ADLL, (int64_t)0xFFFFFC188F30A098LL, (int64_t)0xFFFFFC184C3101C3LL, (int64_t)0xFFFFFC18C50074EALL, (int64_t)0xFFFFFC183FC022ADLL };
+		static const int64_t output0[] = { (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFFFFEF35010CLL, (int64_t)0xFFFFFEF8D46146B2LL, (int64_t)0xFFFFFFFFFFAD3F5ALL, (int64_t)0xFFFFFFD85DA44558LL, (int64_t)0x51D0B4LL, (int64_t)0xADA3LL, (int64_t)0xFFFFFFFFFFFD3385LL, (int64_t)0xFFFFFFFFFCBF2433LL, (int64_t)0x444496BLL, (int64_t)0xFFFFFFFFFFFEDAB5LL, (int64_t)0x600EF03FDLL, (int64_t)0xC2850BBLL, (int64_t)0xFFFFFFEC0C68149BLL, (int64_t)0xFFFFFFFE8FC94978LL, (int64_t)0xFFFFFFFEE9A7B208LL, (int64_t)0xFFFFFFFFFFFFF058LL, (int64_t)0xFFFFFFFFFFFFF766LL, (int64_t)0x76E49FLL, (int64_t)0x386E134E9LL, (int64_t)0xFFFFFFFFFEC4802FLL, (int64_t)0xB112LL, (int64_t)0x14000F0BLL, (int64_t)0xFFFFFD62F00FB3DBLL, (int64_t)0xFFFFFFAD5185224DLL, (int64_t)0xFFFFFFFCF59B0469LL, (int64_t)0x589B2008LL, (int64_t)0xFFFFFFFDEC723D42LL, (int64_t)0x357E920ALL, (int64_t)0x24EB725C0LL, (int64_t)0xFFFFFFFEA570E28FLL, (int64_t)0x5F659A29LL, (int64_t)0xFFFFFFFF00AD667BLL, (int64_t)0x42B6356F5LL, (int64_t)0xFFFFFFFFBC4E995BLL, (int64_t)0xD9E4AEC2LL, (int64_t)0xFFFFFFFE7BDFC99CLL, (int64_t)0xFFFFFFFF11E4B9E1LL, (int64_t)0xFFFFFFFE63DAC9C1LL, (int64_t)0xFFDA3D043LL, (int64_t)0x158D19B58LL, (int64_t)0x1BAEC5DALL, (int64_t)0xFFFFFFFF5FE9FE3ALL, (int64_t)0x1A6B9031CLL, (int64_t)0xFBF40F68LL, (int64_t)0x715C5E40LL, (int64_t)0xFFFFFFFF538DA2B7LL, (int64_t)0xFFFFFFFF149599DCLL, (int64_t)0xFFFFFFF256BDE798LL, (int64_t)0xDDA438A1LL, (int64_t)0xD193ACC2LL, (int64_t)0x7598C3CAALL, (int64_t)0xFFFFFFFEFFF6A3ACLL, (int64_t)0xFFFFFFFF000231E0LL, (int64_t)0xFFFFFFFF000CE528LL, (int64_t)0xFFFFFFFEFFE46BE1LL, (int64_t)0xFFFFFFFF002F4967LL, (int64_t)0xFFFFFFFF000A0BBALL, (int64_t)0xFFFFFFFF0012550DLL, (int64_t)0xFFFFFFFEFFFABCE4LL, (int64_t)0xFFFFFFFF001E935ELL, (int64_t)0xFFFFFFFEFFD86186LL, (int64_t)0xFFFFFFFEFFFA74ECLL, (int64_t)0xFFFFFFFF00327446LL, (int64_t)0xFFFFFFFEFFFFE281LL, (int64_t)0xFFFFFFFF00299224LL, (int64_t)0xFFFFFFFEFFF27FCALL, (int64_t)0xFFFFFFFF0015DA0BLL, (int64_t)0xFFFFFFFEFFF5B347LL, (int64_t)0xFFFFFFFEFFDE834ALL, (int64_t)0xFFFFFFFEFFFE2E7BLL, (int64_t)0xFFFFFFFEFFED4CC7LL, (int64_t)0xFFFFFFFF000BD65CLL, (int64_t)0xFFFFFFFF0003917ALL, (int64_t)0xFFFFFFFEFFF608FFLL, (int64_t)0xFFFFFFFF00085449LL, (int64_t)0xFFFFFFFEFFF0BF41LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::DivRefined", Fixed64::DivRefined(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
+	}
+
 	// Fixed32.Div()
 	static void Fixed32_Div()
 	{
@@ -518,6 +537,15 @@ namespace UnitTest
 			Util::Check("Fixed64::SqrtFastest", Fixed64::SqrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.SqrtRefined()
+	static void Fixed64_SqrtRefined()
+	{
+		static const int64_t input0[] = { (int64_t)0x1AFAD15FE4B78800LL, (int64_t)0x19698D290198DALL, (int64_t)0x625A197B29LL, (int64_t)0x231DC824LL, (int64_t)0x3CFA3265LL, (int64_t)0x64BB7F8D9078BLL, (int64_t)0x3LL, (int64_t)0x5BLL, (int64_t)0x85C56LL, (int64_t)0x6DCCLL, (int64_t)0x15E89094469LL, (int64_t)0x56517E2LL, (int64_t)0x3C265A827LL, (int64_t)0x184060B2995DLL, (int64_t)0xCA9E8680A37LL, (int64_t)0x14620018622C8BLL, (int64_t)0xAF65D4LL, (int64_t)0x145A04E7087650LL, (int64_t)0x106DLL, (int64_t)0x57D1DC16FLL, (int64_t)0x207138E312DB020LL, (int64_t)0x40DC0DLL, (int64_t)0xD56315BB966328LL, (int64_t)0xACADB2730746D0LL, (int64_t)0xD2AEB510ADLL, (int64_t)0x1F805B9383E10BLL, (int64_t)0x3D99BCA57E874A00LL, (int64_t)0x170ELL, (int64_t)0x29C482CFLL, (int64_t)0x5A9E3ALL, (int64_t)0x4335B2A16360FLL, (int64_t)0x72D8FC7F50LL, (int64_t)0xEF3A4309C6LL, (int64_t)0x99LL, (int64_t)0x984A6FF2E51E4LL, (int64_t)0x2A3592LL, (int64_t)0x1LL, (int64_t)0x1LL, (int64_t)0x2F81F883LL, (int64_t)0x64CLL, (int64_t)0x71AF0E7787A9DC0LL, (int64_t)0xFFDBDB882EF8LL, (int64_t)0xC52D6ELL, (int64_t)0x8A1CLL, (int64_t)0xCA04DB0BDACAB0LL, (int64_t)0x3C8BC41BEC78EA00LL, (int64_t)0x15440F0CLL, (int64_t)0xA1EC9D55LL, (int64_t)0xD0CF8BB6LL, (int64_t)0x3AD8316036CLL, (int64_t)0x4D51E772LL, (int64_t)0x29LL, (int64_t)0x52A2LL, (int64_t)0x7889D4C50C8LL, (int64_t)0x78284A0560F774LL, (int64_t)0x6A7D20ED1ALL, (int64_t)0x79F2C93135EE2C0LL, (int64_t)0x2473C88217C0LL, (int64_t)0xAAADE4C396767LL, (int64_t)0x7BE28C74C3LL, (int64_t)0x68A7F9300E506LL, (int64_t)0x9C77CAA0D4729LL, (int64_t)0x8C886E9E98LL, (int64_t)0x5E7A32B048CEF40LL, (int64_t)0x688E342LL, (int64_t)0x3LL, (int64_t)0x1717B0E08CC5FLL, (int64_t)0x646086ALL, (int64_t)0xA31100F44269D0LL, (int64_t)0x4CCE3BLL, (int64_t)0xEB8D59E5D6F6ALL, (int64_t)0x946DAELL, (int64_t)0x6DAAB6LL, (int64_t)0x2LL, (int64_t)0x31707F9AAELL, (int64_t)0x207LL, (int64_t)0x150D5ADA56FCCC00LL, (int64_t)0x18B862D8C58LL, (int64_t)0x36B4734EA40BE800LL, (int64_t)0xDEB395FFBCLL, (int64_t)0x17B375CLL, (int64_t)0x6163BB64LL, (int64_t)0x7111E8DB1E3LL, (int64_t)0x2D6D4E2FA762ELL, (int64_t)0x4B01DC086FFC08LL, (int64_t)0x1A1889C0ABE1LL, (int64_t)0x163CD52LL, (int64_t)0x7F04A5C4830DB80LL, (int64_t)0x51B5LL, (int64_t)0x16E1LL, (int64_t)0x1626E58LL, (int64_t)0x26E4ALL, (int64_t)0x716LL, (int64_t)0x188AF9B37B598DLL, (int64_t)0x3DA479LL, (int64_t)0xBALL, (int64_t)0x1D2LL, (int64_t)0x8591F9BLL, (int64_t)0x548A8965C3060LL, (int64_t)0x42303F666CEA88LL };
+		static const int64_t output0[] = { (int64_t)0x531B75DDCB0CLL, (int64_t)0x50A8310DBD1LL, (int64_t)0x9EAD13D21LL, (int64_t)0x5ED08071LL, (int64_t)0x7CF0D686LL, (int64_t)0x28256E6599CLL, (int64_t)0x1BB67LL, (int64_t)0x98A15LL, (int64_t)0x2E43861LL, (int64_t)0xA7A787LL, (int64_t)0x12B8FB8545LL, (int64_t)0x2529BE88LL, (int64_t)0x1F05C43D8LL, (int64_t)0x4ECB130C1ELL, (int64_t)0x38F010A670LL, (int64_t)0x483C58A85D6LL, (int64_t)0xD3E6882LL, (int64_t)0x482E32C86EDLL, (int64_t)0x40D891LL, (int64_t)0x257C21196LL, (int64_t)0x16C882F08261LL, (int64_t)0x80DB511LL, (int64_t)0xE9B970D6F72LL, (int64_t)0xD24062E60D6LL, (int64_t)0xE83D0C6AELL, (int64_t)0x59CD40BC148LL, (int64_t)0x7D93DE72F6FDLL, (int64_t)0x4CD310LL, (int64_t)0x676793C2LL, (int64_t)0x984F449LL, (int64_t)0x20CAE954231LL, (int64_t)0xAB7797ACELL, (int64_t)0xF778C3EC0LL, (int64_t)0xC5E8BLL, (int64_t)0x315CCA184C9LL, (int64_t)0x67F3290LL, (int64_t)0x10000LL, (int64_t)0x10000LL, (int64_t)0x6E4804F2LL, (int64_t)0x282654LL, (int64_t)0x2AA627CEB179LL, (int64_t)0xFFEDED20C3LL, (int64_t)0xE0ABFCDLL, (int64_t)0xBC082BLL, (int64_t)0xE369D4BF847LL, (int64_t)0x7C7F80A00D76LL, (int64_t)0x49C8AB65LL, (int64_t)0xCB996201LL, (int64_t)0xE7345DA5LL, (int64_t)0x1EAF1F1B99LL, (int64_t)0x8CB0D8F0LL, (int64_t)0x66733LL, (int64_t)0x9171B3LL, (int64_t)0x2BEA7E8549LL, (int64_t)0xAF62D865A86LL, (int64_t)0xA51C048BBLL, (int64_t)0x2C2C0E860CFELL, (int64_t)0x6099E552E6LL, (int64_t)0x3441F957C4DLL, (int64_t)0xB215F6580LL, (int64_t)0x28EBAEB5B36LL, (int64_t)0x3208EC6C99FLL, (int64_t)0xBDACAED2CLL, (int64_t)0x26E13954D978LL, (int64_t)0x28E6A4ABLL, (int64_t)0x1BB67LL, (int64_t)0x1338CD25FE8LL, (int64_t)0x28134979LL, (int64_t)0xCC50E181985LL, (int64_t)0x8C38D9FLL, (int64_t)0x3D640DAB666LL, (int64_t)0xC2EE103LL, (int64_t)0xA78E1AELL, (int64_t)0x16A09LL, (int64_t)0x7080485DFLL, (int64_t)0x16C815LL, (int64_t)0x496987A0F763LL, (int64_t)0x13E3461BE2LL, (int64_t)0x7657247EB703LL, (int64_t)0xEEC55FA32LL, (int64_t)0x137935B0LL, (int64_t)0x9DE5D9B2LL, (int64_t)0x2A88A36CA4LL, (int64_t)0x1AF5B6643E3LL, (int64_t)0x8A921E448B5LL, (int64_t)0x51BC0C0B08LL, (int64_t)0x12DCDAEALL, (int64_t)0x2D14B7FD3451LL, (int64_t)0x90A08ALL, (int64_t)0x4C87F2LL, (int64_t)0x12D38AEFLL, (int64_t)0x18F21ADLL, (int64_t)0x2A9750LL, (int64_t)0x4F43E59443DLL, (int64_t)0x7D9ECF5LL, (int64_t)0xDA35FLL, (int64_t)0x159647LL, (int64_t)0x2E3AA1E2LL, (int64_t)0x24C74C349B6LL, (int64_t)0x822B89D7767LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SqrtRefined", Fixed64::SqrtRefined(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.SqrtPrecise()
 	static void Fixed32_SqrtPrecise()
 	{
@@ -554,6 +582,69 @@ namespace UnitTest
 			Util::Check("Fixed32::SqrtFastest", Fixed32::SqrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.SqrtRefined()
+	static void Fixed32_SqrtRefined()
+	{
+		static const int32_t input0[] = { (int32_t)0xF5E, (int32_t)0x1711BE, (int32_t)0x4B, (int32_t)0x18A5C5, (int32_t)0x38, (int32_t)0x59, (int32_t)0x77B9182, (int32_t)0x8E4D256, (int32_t)0x2524, (int32_t)0xB58E, (int32_t)0x1EC61B9, (int32_t)0x37B, (int32_t)0xA101D, (int32_t)0x68, (int32_t)0x7B3, (int32_t)0x4, (int32_t)0xD03A, (int32_t)0x564ACC2, (int32_t)0x1AEEBD1F, (int32_t)0x11B86, (int32_t)0x1A09, (int32_t)0x3C, (int32_t)0x2, (int32_t)0xB, (int32_t)0x124, (int32_t)0x1489, (int32_t)0x3, (int32_t)0x67DA, (int32_t)0x10, (int32_t)0x16291, (int32_t)0x22C0B690, (int32_t)0x8B87, (int32_t)0x7F827A9, (int32_t)0xA9, (int32_t)0x66, (int32_t)0x61CE01, (int32_t)0x5A660D, (int32_t)0x105BA, (int32_t)0x158E8, (int32_t)0x10, (int32_t)0x588, (int32_t)0x60BF88, (int32_t)0xF0DC, (int32_t)0x35AD161, (int32_t)0x2B, (int32_t)0x1B64, (int32_t)0x26, (int32_t)0x18C43FAE, (int32_t)0x5D2, (int32_t)0x12, (int32_t)0x135D937E, (int32_t)0xFA2, (int32_t)0x9C7EB39, (int32_t)0xA8D09F9, (int32_t)0x278, (int32_t)0x82, (int32_t)0x168D31, (int32_t)0xC, (int32_t)0x2B23, (int32_t)0xB16C17, (int32_t)0x2D, (int32_t)0x24E3, (int32_t)0x112C4D4, (int32_t)0x6B43BC1, (int32_t)0x14E5A, (int32_t)0x70E, (int32_t)0x1BF5, (int32_t)0x1E64, (int32_t)0x2, (int32_t)0x50A0F, (int32_t)0x317, (int32_t)0x32EADBFF, (int32_t)0x801, (int32_t)0x33E924B, (int32_t)0x66, (int32_t)0x11399C, (int32_t)0x100A39, (int32_t)0x27, (int32_t)0x113A7ABA, (int32_t)0x2AB7E33, (int32_t)0x111, (int32_t)0xA, (int32_t)0x23, (int32_t)0x3ABFB221, (int32_t)0x493CA, (int32_t)0x47204, (int32_t)0x390FB, (int32_t)0x3057334B, (int32_t)0x112A9097, (int32_t)0x3243C01C, (int32_t)0x8, (int32_t)0xE19D8, (int32_t)0xC, (int32_t)0x7C6A85, (int32_t)0x172F40AA, (int32_t)0x99A27F6, (int32_t)0x1688EDC5, (int32_t)0x8FB62, (int32_t)0x523, (int32_t)0x18A6F54 };
+		static const int32_t output0[] = { (int32_t)0x3EB8, (int32_t)0x4CD94, (int32_t)0x8A9, (int32_t)0x4F6F1, (int32_t)0x77B, (int32_t)0x96F, (int32_t)0x2BC467, (int32_t)0x2FB74F, (int32_t)0x6182, (int32_t)0xD796, (int32_t)0x16308E, (int32_t)0x1DD9, (int32_t)0x32C16, (int32_t)0xA32, (int32_t)0x2C65, (int32_t)0x200, (int32_t)0xE6E1, (int32_t)0x25284D, (int32_t)0x5308D9, (int32_t)0x10D69, (int32_t)0x51A3, (int32_t)0x7BE, (int32_t)0x16A, (int32_t)0x351, (int32_t)0x1116, (int32_t)0x4881, (int32_t)0x1BB, (int32_t)0xA30D, (int32_t)0x400, (int32_t)0x12D47, (int32_t)0x5E5288, (int32_t)0xBCFE, (int32_t)0x2D2B06, (int32_t)0xD00, (int32_t)0xA19, (int32_t)0x9E3BE, (int32_t)0x98200, (int32_t)0x102D8, (int32_t)0x12925, (int32_t)0x400, (int32_t)0x25A1, (int32_t)0x9D608, (int32_t)0xF850, (int32_t)0x1D4E3B, (int32_t)0x68E, (int32_t)0x53BC, (int32_t)0x62A, (int32_t)0x4FA02C, (int32_t)0x2699, (int32_t)0x43E, (int32_t)0x4668F9, (int32_t)0x3F42, (int32_t)0x320A07, (int32_t)0x33F8B5, (int32_t)0x1923, (int32_t)0xB66, (int32_t)0x4BFB4, (int32_t)0x376, (int32_t)0x6915, (int32_t)0xD51EB, (int32_t)0x6B5, (int32_t)0x612C, (int32_t)0x10937E, (int32_t)0x296D6D, (int32_t)0x12490, (int32_t)0x2A7F, (int32_t)0x5499, (int32_t)0x5834, (int32_t)0x16A, (int32_t)0x23EAD, (int32_t)0x1C1F, (int32_t)0x722B99, (int32_t)0x2D44, (int32_t)0x1CD1D3, (int32_t)0xA19, (int32_t)0x4267A, (int32_t)0x40146, (int32_t)0x63E, (int32_t)0x426954, (int32_t)0x1A24C9, (int32_t)0x1085, (int32_t)0x329, (int32_t)0x5EA, (int32_t)0x7AA2ED, (int32_t)0x223B3, (int32_t)0x21BC0, (int32_t)0x1E372, (int32_t)0x6F3E6E, (int32_t)0x424AA0, (int32_t)0x716FA4, (int32_t)0x2D4, (int32_t)0x3C14F, (int32_t)0x376, (int32_t)0xB2779, (int32_t)0x4D0A64, (int32_t)0x31946D, (int32_t)0x4BF416, (int32_t)0x2FF3A, (int32_t)0x2443, (int32_t)0x13DC42 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SqrtRefined", Fixed32::SqrtRefined(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Cbrt()
+	static void Fixed64_Cbrt()
+	{
+		static const int64_t input0[] = { (int64_t)0x20B0C97347LL, (int64_t)0xAAA033A850B200LL, (int64_t)0xB75C6382LL, (int64_t)0x3LL, (int64_t)0xB05F41CLL, (int64_t)0x75C53281AC99100LL, (int64_t)0x10E7072F800375LL, (int64_t)0x2FAF27FLL, (int64_t)0xA47C0D9CLL, (int64_t)0x196LL, (int64_t)0x1AB99LL, (int64_t)0x1273698589D71LL, (int64_t)0x3D634BD4LL, (int64_t)0x2LL, (int64_t)0x10298219BF03ALL, (int64_t)0x578F0CBLL, (int64_t)0x1AED5C5E1364920LL, (int64_t)0x1LL, (int64_t)0x4A3AAE68809DFLL, (int64_t)0x13E71568075E4F0LL, (int64_t)0xADA2EDLL, (int64_t)0x1476FA0FD1A1050LL, (int64_t)0x1ELL, (int64_t)0x6219DCDC0F417LL, (int64_t)0x2B9C2B1LL, (int64_t)0x234CBD2D8F43CLL, (int64_t)0x40FE9LL, (int64_t)0x6189LL, (int64_t)0xED71ALL, (int64_t)0x2556C6106LL, (int64_t)0x19A13D8161LL, (int64_t)0x40345ECFC6EELL, (int64_t)0xB0D36FB34485680LL, (int64_t)0xC14LL, (int64_t)0x524323B7D8D8LL, (int64_t)0xF412A01LL, (int64_t)0x120F108420CB720LL, (int64_t)0xF511LL, (int64_t)0x537C6LL, (int64_t)0xFAF23113C2ELL, (int64_t)0x8DD5LL, (int64_t)0x1E7C8B8D8BA68600LL, (int64_t)0x7D064C2F27AB5LL, (int64_t)0x2525B231LL, (int64_t)0xDD185F0LL, (int64_t)0x84359242411LL, (int64_t)0x6AB872LL, (int64_t)0x5D01FC5LL, (int64_t)0x2EF41C4ALL, (int64_t)0x659BA407F96LL, (int64_t)0xFFFFFAB21B4E97A5LL, (int64_t)0xFFFCD66214758A38LL, (int64_t)0xFFFFFFFFFFFFDFCBLL, (int64_t)0xFFFFFFFC4C5312C4LL, (int64_t)0xFFFFFFFFFFFFFF53LL, (int64_t)0xFFFFF99C40E77E59LL, (int64_t)0xFFFA622B57D31149LL, (int64_t)0xFFFFF88609F0E8DCLL, (int64_t)0xFFFFFFB9376BD461LL, (int64_t)0xFFFFFEC03ACFBE08LL, (int64_t)0xFFFFFE302095ED4DLL, (int64_t)0xFFFFFFD3A31A5C90LL, (int64_t)0xFFFFFFFFFFFFFFCDLL, (int64_t)0xEE611A4A589F8600LL, (int64_t)0xFFFFFFFC09DB2818LL, (int64_t)0xFFFFFFFE55C32441LL, (int64_t)0xFFF9526B0F015367LL, (int64_t)0xFFFFFFFFFFFAEAFALL, (int64_t)0xFFFFFFFFFFFE5E51LL, (int64_t)0xFFFFFFFFFFEF0C4ELL, (int64_t)0xFFFFFFFEC9B1BF08LL, (int64_t)0xFFFFFE3DF180AEC8LL, (int64_t)0xFFFFF0A446CAED39LL, (int64_t)0xFFFFFFFFFFFFFFB5LL, (int64_t)0xFFFFFDC13A719DFFLL, (int64_t)0xFFFFFFFFFE937CA2LL, (int64_t)0xFFFFFFFFFFFFFFD7LL, (int64_t)0xFFFFFFCBA911A29ALL, (int64_t)0xFFFFFFFFFF8E695BLL, (int64_t)0xFFFFEAE3A33806A8LL, (int64_t)0xFFFFFFFFFAB52C42LL, (int64_t)0xFFD346BB9057A8B8LL, (int64_t)0xFFFF7B0D56B1E210LL, (int64_t)0xFFFFFF6A70D3BCF7LL, (int64_t)0xFFE3D7A3C9A72164LL, (int64_t)0xFFFDF955EFE9DC1FLL, (int64_t)0xFFFFFFFE01ACD4F8LL, (int64_t)0xFFFFFFFFFD03BB25LL, (int64_t)0xFFFFFFFFFFFFFFEFLL, (int64_t)0xFFFFFFFFFFFFFFF4LL, (int64_t)0xFFFFFF522CDFDFA4LL, (int64_t)0xFFFFFFFFFFFFD95BLL, (int64_t)0xFFFFFF226B5ED379LL, (int64_t)0xFFFFFEF4A7144262LL, (int64_t)0xFFFFFFFFFFFFFFF8LL, (int64_t)0xFFFFFF3362B76DB5LL, (int64_t)0xFF6831308B6E57D8LL, (int64_t)0xFFE39E623D9781DELL, (int64_t)0xFDA7DE1FF906F840LL, (int64_t)0xFDECD6683C0EA460LL };
+		static const int64_t output0[] = { (int64_t)0x3328DE10ELL, (int64_t)0xDF9E660780LL, (int64_t)0xE50C9C4ALL, (int64_t)0x3A25DALL, (int64_t)0x59BA789BLL, (int64_t)0x1F1FAE12E00LL, (int64_t)0x67780B51C0LL, (int64_t)0x3A05226FLL, (int64_t)0xDCE72E25LL, (int64_t)0x12A8A25LL, (int64_t)0x788A47DLL, (int64_t)0x2A47701A80LL, (int64_t)0x9F0B98F4LL, (int64_t)0x32CBFDLL, (int64_t)0x2874051F40LL, (int64_t)0x470C584ELL, (int64_t)0x13081BD7800LL, (int64_t)0x285145LL, (int64_t)0x433E1FAA00LL, (int64_t)0x11351CEE400LL, (int64_t)0x236C75D2LL, (int64_t)0x115E32A5800LL, (int64_t)0x7D4698LL, (int64_t)0x49CAD57B00LL, (int64_t)0x38517595LL, (int64_t)0x347C6DA780LL, (int64_t)0xA219CF8LL, (int64_t)0x49A6710LL, (int64_t)0xF9A8A9ALL, (int64_t)0x153903300LL, (int64_t)0x2F2C86082LL, (int64_t)0x196CEA3220LL, (int64_t)0x23A3A642000LL, (int64_t)0x24B5CE2LL, (int64_t)0x1B9D783F00LL, (int64_t)0x63FDA0A1LL, (int64_t)0x10A8A617800LL, (int64_t)0x6420514LL, (int64_t)0xB035CCALL, (int64_t)0xFE4DDC6E8LL, (int64_t)0x5370D32LL, (int64_t)0x31FBA770600LL, (int64_t)0x500157EE00LL, (int64_t)0x86865628LL, (int64_t)0x60BFBD72LL, (int64_t)0xCD63FF6A8LL, (int64_t)0x1E1E437ALL, (int64_t)0x487E141FLL, (int64_t)0x91736828LL, (int64_t)0xBC2285210LL, (int64_t)0xFFFFFFF4ED290070LL, (int64_t)0xFFFFFFC4D1FB7780LL, (int64_t)0xFFFFFFFFFCD18071LL, (int64_t)0xFFFFFFFE73FBCC1ELL, (int64_t)0xFFFFFFFFFF1F594ELL, (int64_t)0xFFFFFFF437ABED90LL, (int64_t)0xFFFFFFB855637400LL, (int64_t)0xFFFFFFF3958884C0LL, (int64_t)0xFFFFFFFBDD077D20LL, (int64_t)0xFFFFFFF929675D88LL, (int64_t)0xFFFFFFF8424AD9ECLL, (int64_t)0xFFFFFFFC75C0CBEELL, (int64_t)0xFFFFFFFFFF6A7C49LL, (int64_t)0xFFFFFD65D61B7000LL, (int64_t)0xFFFFFFFE6AEEEF12LL, (int64_t)0xFFFFFFFED09486F0LL, (int64_t)0xFFFFFFB41390EE00LL, (int64_t)0xFFFFFFFFF5154D23LL, (int64_t)0xFFFFFFFFF8866135LL, (int64_t)0xFFFFFFFFEFB053E1LL, (int64_t)0xFFFFFFFEEF0BB544LL, (int64_t)0xFFFFFFF8562A639CLL, (int64_t)0xFFFFFFF03781F5A0LL, (int64_t)0xFFFFFFFFFF55F981LL, (int64_t)0xFFFFFFF7AF8264E0LL, (int64_t)0xFFFFFFFFD2A46D81LL, (int64_t)0xFFFFFFFFFF74FA03LL, (int64_t)0xFFFFFFFC4266D758LL, (int64_t)0xFFFFFFFFE13FC401LL, (int64_t)0xFFFFFFEE737FDF00LL, (int64_t)0xFFFFFFFFB9BD7299LL, (int64_t)0xFFFFFF70E39FB200LL, (int64_t)0xFFFFFFDF97C6C100LL, (int64_t)0xFFFFFFFAB12167DCLL, (int64_t)0xFFFFFF8557D27180LL, (int64_t)0xFFFFFFCCFBD572A0LL, (int64_t)0xFFFFFFFEBDCFF644LL, (int64_t)0xFFFFFFFFC5F24B15LL, (int64_t)0xFFFFFFFFFF98551ALL, (int64_t)0xFFFFFFFFFFA3B22FLL, (int64_t)0xFFFFFFFA6B4A7DBCLL, (int64_t)0xFFFFFFFFFC9E7EDBLL, (int64_t)0xFFFFFFF9F2E26050LL, (int64_t)0xFFFFFFF98ED4A004LL, (int64_t)0xFFFFFFFFFFAF5D75LL, (int64_t)0xFFFFFFFA1B7A0A5CLL, (int64_t)0xFFFFFF28EC9CB900LL, (int64_t)0xFFFFFF8504E76500LL, (int64_t)0xFFFFFEABEC9B9F00LL, (int64_t)0xFFFFFEB97C4B4100LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Cbrt", Fixed64::Cbrt(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CbrtFast()
+	static void Fixed64_CbrtFast()
+	{
+		static const int64_t input0[] = { (int64_t)0x1LL, (int64_t)0x966C3B950EADLL, (int64_t)0x723LL, (int64_t)0xE7CFLL, (int64_t)0x28FFE09D7BLL, (int64_t)0x294B94841E8DE80LL, (int64_t)0x131DCD15BDB9FB00LL, (int64_t)0x7644LL, (int64_t)0xDLL, (int64_t)0x2CLL, (int64_t)0x15127D0C538A06LL, (int64_t)0xE5C2F78CDD50LL, (int64_t)0x3DBC798LL, (int64_t)0x2F6EA83D9A0F7C00LL, (int64_t)0x9CLL, (int64_t)0xB4C1CE2LL, (int64_t)0x5LL, (int64_t)0x3FAD91EF0C838LL, (int64_t)0x7975961DADLL, (int64_t)0xC8A8659CEFLL, (int64_t)0x4AD248DFF08A800LL, (int64_t)0x1LL, (int64_t)0x151B89D3F1LL, (int64_t)0x8B3B234CF26548LL, (int64_t)0x7327ADFC4B4A44LL, (int64_t)0x56EBLL, (int64_t)0x2445LL, (int64_t)0x1CA4D41D4A6D29LL, (int64_t)0x8C4LL, (int64_t)0x1D8C4LL, (int64_t)0xAA0LL, (int64_t)0x61F7C379FC173LL, (int64_t)0x13A4FLL, (int64_t)0x912E56CDE0DB1LL, (int64_t)0x168LL, (int64_t)0x3LL, (int64_t)0x55EB2906A4D5B0LL, (int64_t)0x15256B83CC63670LL, (int64_t)0x3C4FE5BLL, (int64_t)0x10A91BF6F753ALL, (int64_t)0x3LL, (int64_t)0x1B4F8FLL, (int64_t)0x26E8E03ALL, (int64_t)0x49668370CA0D8CLL, (int64_t)0x1E7A01E0LL, (int64_t)0x5769E2017F1F14LL, (int64_t)0x26A057C8CLL, (int64_t)0x156233BD54LL, (int64_t)0x743AF7A89CLL, (int64_t)0x61LL, (int64_t)0xFFFFFFFFFFE1CF17LL, (int64_t)0xFFFF5B8E70B2B1A3LL, (int64_t)0xFFFFFFFFFFFF611ELL, (int64_t)0xFFFFFFFC4C42793DLL, (int64_t)0xFFFFFFF87CA1D2FFLL, (int64_t)0xCA5AFCE93ADF1600LL, (int64_t)0xFFFFFFFFFFFFF8E0LL, (int64_t)0xFFFFFFFFFFFCB813LL, (int64_t)0xFFFFFFFFFF7F2A66LL, (int64_t)0xFFFFFFFFFF873F19LL, (int64_t)0xFFFFEDC8A663B30DLL, (int64_t)0xFFFFFFFFFFFFFF56LL, (int64_t)0xFFFFFFFFFFFFFFF3LL, (int64_t)0xFFFE37FCCC2440B6LL, (int64_t)0xFEF5F4750EB16E70LL, (int64_t)0xFFFFFFFFFFFFFFFDLL, (int64_t)0xFFFFFFFF44DD2FB7LL, (int64_t)0xFFFFFFE4C8EDE287LL, (int64_t)0xFFDE5CD62EA39EF8LL, (int64_t)0xFFFFFFFFFFFFFFCFLL, (int64_t)0xFFFFFFF795B0D682LL, (int64_t)0xFFFFFFFFFFFFFF07LL, (int64_t)0xFFFFFFFFFEF1B68ELL, (int64_t)0xFFE2D6D0764F2757LL, (int64_t)0xFFFFFFC041C4D77FLL, (int64_t)0xFFFFFFD42A7A6AA0LL, (int64_t)0xFFFFFFFD6D44C41FLL, (int64_t)0xFFFFED987F0FA5CALL, (int64_t)0xFFFFFFFFFB6E7994LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFF6FFB836C43DLL, (int64_t)0xFFFFFF937134CFC6LL, (int64_t)0xFFFFFFFFFFFFC0EALL, (int64_t)0xFFFFFFFFFFFFFFEALL, (int64_t)0xFC15CF3543E2ED00LL, (int64_t)0xFFFFFFFFFBDD5286LL, (int64_t)0xFFFFFFF62265C6E0LL, (int64_t)0xFFFFEAC65CD96F30LL, (int64_t)0xFFFFFFFFFFFECAD3LL, (int64_t)0xFFFFFFFFFFFFFE52LL, (int64_t)0xFFE383A712DE4146LL, (int64_t)0xFFFFFFE5D0201F9ELL, (int64_t)0xFFFFFFFD5FB476A3LL, (int64_t)0xFFFFFFFFFFFFFFF9LL, (int64_t)0xFFFFFFFFFFFFFFF2LL, (int64_t)0xFED21FD3861B9890LL, (int64_t)0xFFFFFFFFFFFDF9B0LL, (int64_t)0xFFFFFA8A054B7D0CLL, (int64_t)0xEE57BD8C83EF8100LL, (int64_t)0xFFFFFFFFF724F549LL };
+		static const int64_t output0[] = { (int64_t)0x285145LL, (int64_t)0x21C4DE4580LL, (int64_t)0x1ECE0C1LL, (int64_t)0x624993ALL, (int64_t)0x372C01874LL, (int64_t)0x15F28F6CF00LL, (int64_t)0x2AC81823400LL, (int64_t)0x4E898E8LL, (int64_t)0x5ECC7ALL, (int64_t)0x8E5602LL, (int64_t)0x6F5C8D0780LL, (int64_t)0x26E3E0F480LL, (int64_t)0x3F3CB078LL, (int64_t)0x39EAE528600LL, (int64_t)0xD90A00LL, (int64_t)0x5A776796LL, (int64_t)0x44F14ELL, (int64_t)0x3FE4867DE0LL, (int64_t)0x4F3D02AF0LL, (int64_t)0x5DAB8C0D4LL, (int64_t)0x1AC18D03900LL, (int64_t)0x285145LL, (int64_t)0x2C37F2D5CLL, (int64_t)0xD0F643E100LL, (int64_t)0xC426667D80LL, (int64_t)0x46E00C0LL, (int64_t)0x34F64AFLL, (int64_t)0x7B5BE57640LL, (int64_t)0x20FD53FLL, (int64_t)0x7CA4E67LL, (int64_t)0x232CCF7LL, (int64_t)0x49C2251800LL, (int64_t)0x6CC9612LL, (int64_t)0x5417899640LL, (int64_t)0x11ECFC7LL, (int64_t)0x3A25CALL, (int64_t)0xB1E844B880LL, (int64_t)0x118F0FA2400LL, (int64_t)0x3EBF3A42LL, (int64_t)0x28DD4B0C20LL, (int64_t)0x3A25CALL, (int64_t)0x131F17A2LL, (int64_t)0x889ED014LL, (int64_t)0xA8CEB2B480LL, (int64_t)0x7DEFE949LL, (int64_t)0xB2EED94A00LL, (int64_t)0x1576C7959LL, (int64_t)0x2C6912E1CLL, (int64_t)0x4E157A6E0LL, (int64_t)0xB93EE3LL, (int64_t)0xFFFFFFFFEC3A7153LL, (int64_t)0xFFFFFFDD36622300LL, (int64_t)0xFFFFFFFFFA957293LL, (int64_t)0xFFFFFFFE73F8AD3ALL, (int64_t)0xFFFFFFFE0A9950D5LL, (int64_t)0xFFFFFC3A84BCF000LL, (int64_t)0xFFFFFFFFFE136465LL, (int64_t)0xFFFFFFFFF690A3ECLL, (int64_t)0xFFFFFFFFDFEE428CLL, (int64_t)0xFFFFFFFFE09D8411LL, (int64_t)0xFFFFFFEF4B04B280LL, (int64_t)0xFFFFFFFFFF20A705LL, (int64_t)0xFFFFFFFFFFA13386LL, (int64_t)0xFFFFFFCF206D1300LL, (int64_t)0xFFFFFEFCB27C5000LL, (int64_t)0xFFFFFFFFFFC5DA36LL, (int64_t)0xFFFFFFFF1963B64ALL, (int64_t)0xFFFFFFFCFDF9054ALL, (int64_t)0xFFFFFF7DDAC4F600LL, (int64_t)0xFFFFFFFFFF6C7795LL, (int64_t)0xFFFFFFFDF74BC220LL, (int64_t)0xFFFFFFFFFF025A2DLL, (int64_t)0xFFFFFFFFD6F24FACLL, (int64_t)0xFFFFFF83E7198180LL, (int64_t)0xFFFFFFFC015E9C88LL, (int64_t)0xFFFFFFFC795C29DALL, (int64_t)0xFFFFFFFEA1317E53LL, (int64_t)0xFFFFFFEF3C56ED00LL, (int64_t)0xFFFFFFFFBD1A0B95LL, (int64_t)0xFFFFFFFFFFD7AEBBLL, (int64_t)0xFFFFFFF2CAB60600LL, (int64_t)0xFFFFFFFB3ACAD540LL, (int64_t)0xFFFFFFFFFC04E422LL, (int64_t)0xFFFFFFFFFF8F0722LL, (int64_t)0xFFFFFE6C86FE9700LL, (int64_t)0xFFFFFFFFBF49432BLL, (int64_t)0xFFFFFFFDDAF0FFF0LL, (int64_t)0xFFFFFFEE6B59C200LL, (int64_t)0xFFFFFFFFF93CF1D3LL, (int64_t)0xFFFFFFFFFECFB17ALL, (int64_t)0xFFFFFF84DE5D0540LL, (int64_t)0xFFFFFFFD07CBC91ALL, (int64_t)0xFFFFFFFE9ECD4696LL, (int64_t)0xFFFFFFFFFFB2E034LL, (int64_t)0xFFFFFFFFFF9ED460LL, (int64_t)0xFFFFFEF18A2AF400LL, (int64_t)0xFFFFFFFFF7F7A091LL, (int64_t)0xFFFFFFF4D181E8D8LL, (int64_t)0xFFFFFD6561C66000LL, (int64_t)0xFFFFFFFFAC967D49LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::CbrtFast", Fixed64::CbrtFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CbrtFastest()
+	static void Fixed64_CbrtFastest()
+	{
+		static const int64_t input0[] = { (int64_t)0x16C9LL, (int64_t)0x5C9A7FLL, (int64_t)0x36928D2FE6593400LL, (int64_t)0x2B481F1A573AD200LL, (int64_t)0x2CCLL, (int64_t)0x4LL, (int64_t)0x15DFA36E1A646ELL, (int64_t)0xF3LL, (int64_t)0x2DLL, (int64_t)0x24B597F0D663LL, (int64_t)0x2266070FC11B9LL, (int64_t)0x2BB783B6762LL, (int64_t)0x4C869B9B1ALL, (int64_t)0x5E6C63LL, (int64_t)0x3D4E96BE8CB2LL, (int64_t)0xF00DB04953F340LL, (int64_t)0x2E71028LL, (int64_t)0x11C1B0266ELL, (int64_t)0x2A8DB73BFLL, (int64_t)0x319AB5LL, (int64_t)0x6E752D9B296FA80LL, (int64_t)0x55CEF0CEC6LL, (int64_t)0xEFA43FAB35D32LL, (int64_t)0x4350CC5LL, (int64_t)0x156LL, (int64_t)0xBDAFDB2LL, (int64_t)0x198F6599934453LL, (int64_t)0x2630LL, (int64_t)0x1LL, (int64_t)0x1FA81F6AALL, (int64_t)0x4694CLL, (int64_t)0x4EC13E38145A9LL, (int64_t)0x1BD686638E8ELL, (int64_t)0x7927256E358B0LL, (int64_t)0x15AC5LL, (int64_t)0x32EBLL, (int64_t)0xF738LL, (int64_t)0x367DEELL, (int64_t)0x27423LL, (int64_t)0x228490LL, (int64_t)0x153A33A97FLL, (int64_t)0x21DA3B0EB8B0LL, (int64_t)0x2C1E35B8LL, (int64_t)0x2LL, (int64_t)0x1124FE341B3ELL, (int64_t)0x2LL, (int64_t)0x3D8F91418BF01800LL, (int64_t)0x109LL, (int64_t)0x42D6LL, (int64_t)0x8321LL, (int64_t)0xFFFFFFFFFFFF17AALL, (int64_t)0xFFFFFFB0C4D65DE5LL, (int64_t)0xFFFFE37C993C697ALL, (int64_t)0xFFFFEDDE4F8C6921LL, (int64_t)0xFFFFFFFFFFC3939FLL, (int64_t)0xFFFFFFEF00F6143CLL, (int64_t)0xFFFFFFFE744CFE9CLL, (int64_t)0xFFFFFFF307642D7ELL, (int64_t)0xFFDFA88A2C20E742LL, (int64_t)0xFFFFF0E2E46B0E15LL, (int64_t)0xFFFFFFFFFFFFF50ELL, (int64_t)0xFFFFFF6D60FD6F5ALL, (int64_t)0xFFFFFFFFFFFFFF1FLL, (int64_t)0xFFFFFFFA384DEC9BLL, (int64_t)0xFFFFFFFFF7ADAB34LL, (int64_t)0xE40BCBEE3908D000LL, (int64_t)0xF9B7E8565C362D80LL, (int64_t)0xFFFD7931AA7C9B02LL, (int64_t)0xFFFFFFFFFFFFFFBBLL, (int64_t)0xFFFFFFFECBC9A5A7LL, (int64_t)0xFFFFFF076B811A73LL, (int64_t)0xFFFFFFFFFFFFFFF3LL, (int64_t)0xFFFFFFFFFFF8C366LL, (int64_t)0xFFFFFFFFFFFFEC47LL, (int64_t)0xFFFF6A71AB537969LL, (int64_t)0xFFFFFFFFFFFFCBCCLL, (int64_t)0xFFFFFFFFFFFFFE0FLL, (int64_t)0xFFF985FCF14B1AB5LL, (int64_t)0xFFFFF04B66653FE0LL, (int64_t)0xFFFFFFFFFFFFFF80LL, (int64_t)0xFFFFFFFFF3ACC158LL, (int64_t)0xFFFFE754F0E64089LL, (int64_t)0xDB6E3B02B94C3800LL, (int64_t)0xFFFF7954F7FEB2DBLL, (int64_t)0xFFFFFFFFFFFDD1EALL, (int64_t)0xFFFFFC6FCAD1CF2CLL, (int64_t)0xFFFFFFFFFFFFFFD4LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFDFEB3E35LL, (int64_t)0xFFFFFAE639D0058BLL, (int64_t)0xFFFFF7C397867770LL, (int64_t)0xFFFFFB3C3698B7C3LL, (int64_t)0xFFFFFFFF942ADBF4LL, (int64_t)0xFFFFFFF59C188D54LL, (int64_t)0xFFFFFFFFFFFFFCD9LL, (int64_t)0xF6BBF9BC1D1D6D00LL, (int64_t)0xFFFFFFD99F793737LL, (int64_t)0xFE178053081E99C0LL, (int64_t)0xFFFFFFEE36E61A18LL, (int64_t)0xFFFFD8BF7A9753DELL };
+		static const int64_t output0[] = { (int64_t)0x2D5D3B8LL, (int64_t)0x1CBAD461LL, (int64_t)0x3CB002BF800LL, (int64_t)0x382E39D4200LL, (int64_t)0x168B873LL, (int64_t)0x400000LL, (int64_t)0x70C368C880LL, (int64_t)0xFB9138LL, (int64_t)0x8F6B1ELL, (int64_t)0x1519D72170LL, (int64_t)0x3407D13500LL, (int64_t)0x8E0A3C420LL, (int64_t)0x43ECF72C0LL, (int64_t)0x1CEAB08BLL, (int64_t)0x1908ECAC90LL, (int64_t)0xFA8B8D6480LL, (int64_t)0x3984707BLL, (int64_t)0x29BCE370ELL, (int64_t)0x162B53103LL, (int64_t)0x1755023ALL, (int64_t)0x1E76E926000LL, (int64_t)0x469381430LL, (int64_t)0x635F39AB40LL, (int64_t)0x4114D2BFLL, (int64_t)0x119F721LL, (int64_t)0x5BF0DB12LL, (int64_t)0x76C4DBAA80LL, (int64_t)0x35E0883LL, (int64_t)0x285145LL, (int64_t)0x1415F447CLL, (int64_t)0xA69A025LL, (int64_t)0x4494B63400LL, (int64_t)0x133E2E50C0LL, (int64_t)0x4F29BF4400LL, (int64_t)0x706AC1ELL, (int64_t)0x3B4E681LL, (int64_t)0x64691F2LL, (int64_t)0x1812723DLL, (int64_t)0x8905EFDLL, (int64_t)0x14AC1190LL, (int64_t)0x2C4DD3EB8LL, (int64_t)0x1489E6E570LL, (int64_t)0x8E7952BALL, (int64_t)0x32CBFDLL, (int64_t)0x105F070C40LL, (int64_t)0x32CBFDLL, (int64_t)0x3F2BCE30800LL, (int64_t)0x102F2F3LL, (int64_t)0x40ED465LL, (int64_t)0x514863ELL, (int64_t)0xFFFFFFFFF9DA5BCDLL, (int64_t)0xFFFFFFFBB47DABE0LL, (int64_t)0xFFFFFFEC9A6E2680LL, (int64_t)0xFFFFFFEF5206AE40LL, (int64_t)0xFFFFFFFFE7161455LL, (int64_t)0xFFFFFFFD6DDBFAD6LL, (int64_t)0xFFFFFFFED7FBC55CLL, (int64_t)0xFFFFFFFDA67BBF10LL, (int64_t)0xFFFFFF7F8C91DE00LL, (int64_t)0xFFFFFFF04D76BFB8LL, (int64_t)0xFFFFFFFFFDC78F8ALL, (int64_t)0xFFFFFFFABA345910LL, (int64_t)0xFFFFFFFFFF0ACBDFLL, (int64_t)0xFFFFFFFE3486A8C4LL, (int64_t)0xFFFFFFFFAE4DEC9CLL, (int64_t)0xFFFFFCF71A75F600LL, (int64_t)0xFFFFFE279E6F5100LL, (int64_t)0xFFFFFFC9164AEA00LL, (int64_t)0xFFFFFFFFFF5AA6BCLL, (int64_t)0xFFFFFFFEEFAC4714LL, (int64_t)0xFFFFFFF9B6793868LL, (int64_t)0xFFFFFFFFFFA13274LL, (int64_t)0xFFFFFFFFF3B8262BLL, (int64_t)0xFFFFFFFFFD4C5979LL, (int64_t)0xFFFFFFDE4C66B880LL, (int64_t)0xFFFFFFFFFC433540LL, (int64_t)0xFFFFFFFFFEC0A9F9LL, (int64_t)0xFFFFFFB4D84D3D00LL, (int64_t)0xFFFFFFF0197E5A00LL, (int64_t)0xFFFFFFFFFF34D00BLL, (int64_t)0xFFFFFFFFA2DCB5ECLL, (int64_t)0xFFFFFFED83C0B640LL, (int64_t)0xFFFFFCAE590BF400LL, (int64_t)0xFFFFFFDF74D49480LL, (int64_t)0xFFFFFFFFF7C484EELL, (int64_t)0xFFFFFFF64D696D60LL, (int64_t)0xFFFFFFFFFF71A749LL, (int64_t)0xFFFFFFFFFFD7AEBBLL, (int64_t)0xFFFFFFFF7FE48A9ALL, (int64_t)0xFFFFFFF511DAE038LL, (int64_t)0xFFFFFFF32D880988LL, (int64_t)0xFFFFFFF550DF8070LL, (int64_t)0xFFFFFFFF4019FAE3LL, (int64_t)0xFFFFFFFDD15C7778LL, (int64_t)0xFFFFFFFFFE889D0FLL, (int64_t)0xFFFFFDE659DF4000LL, (int64_t)0xFFFFFFFCA089DF08LL, (int64_t)0xFFFFFEC2806D3000LL, (int64_t)0xFFFFFFFD63D4D958LL, (int64_t)0xFFFFFFEA6BE0A000LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::CbrtFastest", Fixed64::CbrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Cbrt()
+	static void Fixed32_Cbrt()
+	{
+		static const int32_t input0[] = { (int32_t)0x4972, (int32_t)0x2DF, (int32_t)0xDB, (int32_t)0x2F757A, (int32_t)0x5, (int32_t)0x12, (int32_t)0xC173CC, (int32_t)0x706B3C, (int32_t)0x5175D95, (int32_t)0x129, (int32_t)0x35F78A3, (int32_t)0x1DEE, (int32_t)0x3CD11, (int32_t)0x4E8259, (int32_t)0x5D27FAB, (int32_t)0x31659CA, (int32_t)0x4A137E1, (int32_t)0xC9F34E, (int32_t)0x42, (int32_t)0x178AB44, (int32_t)0xCC635, (int32_t)0xD08F, (int32_t)0x1F338, (int32_t)0xA, (int32_t)0x4FCDD00, (int32_t)0x2, (int32_t)0x25CFFB, (int32_t)0x3F5FF, (int32_t)0x4, (int32_t)0x92256, (int32_t)0x1AD115, (int32_t)0x103473E, (int32_t)0x4D77CE, (int32_t)0xF1C33B, (int32_t)0x39D28A5, (int32_t)0x3547, (int32_t)0x3, (int32_t)0x5BFB, (int32_t)0x2, (int32_t)0xB1AEDC, (int32_t)0x1C63F2, (int32_t)0x17C, (int32_t)0x140, (int32_t)0x2, (int32_t)0x178B7, (int32_t)0x33AAC, (int32_t)0x12DCA, (int32_t)0x12945, (int32_t)0x234E60, (int32_t)0x18E890D6, (int32_t)0xFFD0A5B0, (int32_t)0xFD3C0525, (int32_t)0xFBAC09A5, (int32_t)0xFFF7739D, (int32_t)0xFD73E0AF, (int32_t)0xE9760D05, (int32_t)0xFFA1AEFF, (int32_t)0xFFFFFFD5, (int32_t)0xFD9F08A7, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFE111, (int32_t)0xFFFFFF9F, (int32_t)0xFFCB4365, (int32_t)0xFFFFFEE3, (int32_t)0xFFFD3A40, (int32_t)0xFFFFFFFA, (int32_t)0xFFE74557, (int32_t)0xFEFE682A, (int32_t)0xFA91A66B, (int32_t)0xFFFFC80D, (int32_t)0xFE03F0B1, (int32_t)0xFFFFE63B, (int32_t)0xFF6C8CBE, (int32_t)0xFFFFE830, (int32_t)0xFFFFFFE6, (int32_t)0xFFFFEED0, (int32_t)0xFFFFFEB3, (int32_t)0xFFFE8F46, (int32_t)0xFFFE454F, (int32_t)0xFFFFFCEA, (int32_t)0xFFFF7270, (int32_t)0xFFFFFFBF, (int32_t)0xF8D1E87E, (int32_t)0xFFFFFFF6, (int32_t)0xF3A79B17, (int32_t)0xFD9368F3, (int32_t)0xF105EBAD, (int32_t)0xFFFFFFEE, (int32_t)0xE845ED36, (int32_t)0xF5BCF991, (int32_t)0xFFDBD8D8, (int32_t)0xFB62740C, (int32_t)0xFFF6554E, (int32_t)0xD9910887, (int32_t)0xFFFFF484, (int32_t)0xFFFF6B31, (int32_t)0xFFFE3235, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFC17F, (int32_t)0xFFFF8EE2 };
+		static const int32_t output0[] = { (int32_t)0xA8D7, (int32_t)0x394D, (int32_t)0x2645, (int32_t)0x39EDB, (int32_t)0xADB, (int32_t)0x10A4, (int32_t)0x5C893, (int32_t)0x4D387, (int32_t)0xAEC5F, (int32_t)0x2A5D, (int32_t)0x985C0, (int32_t)0x7D2D, (int32_t)0x18F85, (int32_t)0x4482C, (int32_t)0xB6C44, (int32_t)0x93EE6, (int32_t)0xA9530, (int32_t)0x5DDF2, (int32_t)0x19A9, (int32_t)0x738D0, (int32_t)0x2566F, (int32_t)0xEF18, (int32_t)0x13FD5, (int32_t)0xDAE, (int32_t)0xAD94A, (int32_t)0x800, (int32_t)0x35B3F, (int32_t)0x1950C, (int32_t)0xA14, (int32_t)0x21722, (int32_t)0x2FE42, (int32_t)0x66068, (int32_t)0x4434E, (int32_t)0x63AC9, (int32_t)0x9BE78, (int32_t)0x97B5, (int32_t)0x928, (int32_t)0xB5FE, (int32_t)0x800, (int32_t)0x59F33, (int32_t)0x30CF6, (int32_t)0x2DFD, (int32_t)0x2B6E, (int32_t)0x800, (int32_t)0x1232E, (int32_t)0x17A63, (int32_t)0x10E6F, (int32_t)0x10D13, (int32_t)0x347D3, (int32_t)0x128B2D, (int32_t)0xFFFC61D6, (int32_t)0xFFF7165D, (int32_t)0xFFF5A701, (int32_t)0xFFFDF490, (int32_t)0xFFF75405, (int32_t)0xFFEE1067, (int32_t)0xFFFB72B5, (int32_t)0xFFFFE9C2, (int32_t)0xFFF7861D, (int32_t)0xFFFFF5EC, (int32_t)0xFFFF8171, (int32_t)0xFFFFE2D4, (int32_t)0xFFFC3FFD, (int32_t)0xFFFFD637, (int32_t)0xFFFE985E, (int32_t)0xFFFFF477, (int32_t)0xFFFD162B, (int32_t)0xFFF9A323, (int32_t)0xFFF4D6C1, (int32_t)0xFFFF65CD, (int32_t)0xFFF80545, (int32_t)0xFFFF88EA, (int32_t)0xFFFAB78D, (int32_t)0xFFFF8C03, (int32_t)0xFFFFED31, (int32_t)0xFFFF97F4, (int32_t)0xFFFFD3FE, (int32_t)0xFFFEDEE5, (int32_t)0xFFFECCBA, (int32_t)0xFFFFC54E, (int32_t)0xFFFF2DE1, (int32_t)0xFFFFE679, (int32_t)0xFFF3C01A, (int32_t)0xFFFFF252, (int32_t)0xFFF1532F, (int32_t)0xFFF77865, (int32_t)0xFFF0593D, (int32_t)0xFFFFEF5C, (int32_t)0xFFEDC11C, (int32_t)0xFFF233AC, (int32_t)0xFFFCB183, (int32_t)0xFFF56D9D, (int32_t)0xFFFDDEAA, (int32_t)0xFFEA926A, (int32_t)0xFFFFA50A, (int32_t)0xFFFF2A5A, (int32_t)0xFFFEC85F, (int32_t)0xFFFFF800, (int32_t)0xFFFF6000, (int32_t)0xFFFF3D04 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Cbrt", Fixed32::Cbrt(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CbrtFast()
+	static void Fixed32_CbrtFast()
+	{
+		static const int32_t input0[] = { (int32_t)0x18D, (int32_t)0x1FC, (int32_t)0x9E2B, (int32_t)0x6, (int32_t)0x261A19, (int32_t)0x235, (int32_t)0xE6B3, (int32_t)0x504F, (int32_t)0x10C73E, (int32_t)0x3, (int32_t)0x3, (int32_t)0xB6E, (int32_t)0x65B6B, (int32_t)0x3E1D532, (int32_t)0xE7, (int32_t)0x47, (int32_t)0x3B, (int32_t)0x16878B8, (int32_t)0x2, (int32_t)0x1CE199C, (int32_t)0xB1DA5, (int32_t)0x1EED4B4, (int32_t)0xC4DB6C, (int32_t)0x6D, (int32_t)0xD5, (int32_t)0xF0E47, (int32_t)0x4AF6, (int32_t)0xDD310C, (int32_t)0x2568A, (int32_t)0x2, (int32_t)0x2095, (int32_t)0x12208B, (int32_t)0x561DC, (int32_t)0x1893, (int32_t)0xE9F5B, (int32_t)0x31, (int32_t)0x8A001A, (int32_t)0x8, (int32_t)0xF, (int32_t)0x3, (int32_t)0x12A807A, (int32_t)0x7ECA906, (int32_t)0x2C1CF8, (int32_t)0x9C405AC, (int32_t)0x405A, (int32_t)0xA009, (int32_t)0x17EA, (int32_t)0x4, (int32_t)0x1B7, (int32_t)0xC689B2, (int32_t)0xFFDC29FB, (int32_t)0xFFFFFF5E, (int32_t)0xFFFFFD25, (int32_t)0xFFFFE124, (int32_t)0xFE5417D9, (int32_t)0xFFFFCC8D, (int32_t)0xFFFF5AC4, (int32_t)0xFFFFFD1D, (int32_t)0xFDF3BB1B, (int32_t)0xFFFFFFFB, (int32_t)0xFE1D7253, (int32_t)0xFFBD3F8B, (int32_t)0xF769A2F1, (int32_t)0xFFF3145B, (int32_t)0xFFFA0F61, (int32_t)0xFFFFF31F, (int32_t)0xFF780EF4, (int32_t)0xFFFFFF7C, (int32_t)0xFFFFFF79, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFDED1, (int32_t)0xFFFFFFF2, (int32_t)0xFFD1F91C, (int32_t)0xD0906CED, (int32_t)0xFFFFFFFD, (int32_t)0xFFA639CC, (int32_t)0xFFFFFFEA, (int32_t)0xFAF5E37D, (int32_t)0xFF930F62, (int32_t)0xFFAA6BCE, (int32_t)0xFFFFFEBE, (int32_t)0xFFFFDE14, (int32_t)0xFFFEFE7C, (int32_t)0xFF3F0E89, (int32_t)0xFFFFFB5D, (int32_t)0xFFFFFF9A, (int32_t)0xFFFFF351, (int32_t)0xFFFFFFA7, (int32_t)0xFFFC5300, (int32_t)0xFFFFFF6F, (int32_t)0xFFECC69A, (int32_t)0xFFFFA06D, (int32_t)0xFFFFFEFD, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFF98, (int32_t)0xFFFFFFF8, (int32_t)0xC4F0C46D, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFCB7, (int32_t)0xFFFFFFF7 };
+		static const int32_t output0[] = { (int32_t)0x2EAA, (int32_t)0x32AA, (int32_t)0xDA0A, (int32_t)0xB89, (int32_t)0x35D70, (int32_t)0x347D, (int32_t)0xF745, (int32_t)0xADF2, (int32_t)0x28F5D, (int32_t)0x928, (int32_t)0x928, (int32_t)0x5AD1, (int32_t)0x1DA3A, (int32_t)0x9FAC1, (int32_t)0x26F5, (int32_t)0x1A4A, (int32_t)0x18B8, (int32_t)0x71DEF, (int32_t)0x800, (int32_t)0x7BB2F, (int32_t)0x23B55, (int32_t)0x7E8DE, (int32_t)0x5D133, (int32_t)0x1E54, (int32_t)0x25EB, (int32_t)0x27823, (int32_t)0xA9FE, (int32_t)0x60C32, (int32_t)0x153C6, (int32_t)0x800, (int32_t)0x80C5, (int32_t)0x2A07B, (int32_t)0x1C0A4, (int32_t)0x7537, (int32_t)0x27203, (int32_t)0x173C, (int32_t)0x52AE7, (int32_t)0xCB2, (int32_t)0xFA8, (int32_t)0x928, (int32_t)0x6AEE4, (int32_t)0xCA8BF, (int32_t)0x3888D, (int32_t)0xD927D, (int32_t)0xA190, (int32_t)0xDAE5, (int32_t)0x7428, (int32_t)0xA14, (int32_t)0x3041, (int32_t)0x5D56D, (int32_t)0xFFFCB400, (int32_t)0xFFFFDD63, (int32_t)0xFFFFC6CE, (int32_t)0xFFFF818A, (int32_t)0xFFF876EA, (int32_t)0xFFFF6A0D, (int32_t)0xFFFF22C3, (int32_t)0xFFFFC698, (int32_t)0xFFF7EFCA, (int32_t)0xFFFFF525, (int32_t)0xFFF82805, (int32_t)0xFFFBF18B, (int32_t)0xFFF2FF5A, (int32_t)0xFFFDA74C, (int32_t)0xFFFE3061, (int32_t)0xFFFFA180, (int32_t)0xFFFADBB6, (int32_t)0xFFFFDFAC, (int32_t)0xFFFFDF6E, (int32_t)0xFFFFF2CB, (int32_t)0xFFFF7E72, (int32_t)0xFFFFF0B3, (int32_t)0xFFFC6A8F, (int32_t)0xFFE903CC, (int32_t)0xFFFFF6D8, (int32_t)0xFFFB85B7, (int32_t)0xFFFFEE36, (int32_t)0xFFF51D1C, (int32_t)0xFFFB395D, (int32_t)0xFFFB97DA, (int32_t)0xFFFFD47B, (int32_t)0xFFFF7D7E, (int32_t)0xFFFEFF80, (int32_t)0xFFFA38BB, (int32_t)0xFFFFBCC6, (int32_t)0xFFFFE256, (int32_t)0xFFFFA1FB, (int32_t)0xFFFFE3A7, (int32_t)0xFFFE74EA, (int32_t)0xFFFFDEA5, (int32_t)0xFFFD5236, (int32_t)0xFFFF47AB, (int32_t)0xFFFFD787, (int32_t)0xFFFFF477, (int32_t)0xFFFFE224, (int32_t)0xFFFFF34E, (int32_t)0xFFE745C5, (int32_t)0xFFFFF477, (int32_t)0xFFFFC411, (int32_t)0xFFFFF2CB };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::CbrtFast", Fixed32::CbrtFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CbrtFastest()
+	static void Fixed32_CbrtFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0x9, (int32_t)0xDB, (int32_t)0x2E47910F, (int32_t)0x264871, (int32_t)0x66A3, (int32_t)0x124F6F47, (int32_t)0x82, (int32_t)0x4, (int32_t)0x5CA, (int32_t)0x778, (int32_t)0x109, (int32_t)0x8A8F18, (int32_t)0x3E, (int32_t)0x9B9638B, (int32_t)0x3408, (int32_t)0x1C02478, (int32_t)0xB7220B2, (int32_t)0x6, (int32_t)0xA9359, (int32_t)0x6, (int32_t)0x2, (int32_t)0x11, (int32_t)0x9CB79, (int32_t)0x4FF6, (int32_t)0x329C1, (int32_t)0x323, (int32_t)0x6EDD06, (int32_t)0x113C6D3, (int32_t)0xD2, (int32_t)0xD0, (int32_t)0x189244F8, (int32_t)0x34, (int32_t)0x224E6, (int32_t)0xABC6A, (int32_t)0xB5A07E1, (int32_t)0x3, (int32_t)0x5, (int32_t)0xE190D7, (int32_t)0x943CE, (int32_t)0x18AE4FF, (int32_t)0x3D8C824A, (int32_t)0x4031806, (int32_t)0x1FC, (int32_t)0x10890CB, (int32_t)0x34FCFA, (int32_t)0x46F, (int32_t)0x1D, (int32_t)0x37, (int32_t)0x5, (int32_t)0xC6639, (int32_t)0xFFFFF553, (int32_t)0xFFFFEFBA, (int32_t)0xFFFFADD4, (int32_t)0xFFFFFCB9, (int32_t)0xFFFFFFF3, (int32_t)0xDD6479A3, (int32_t)0xFFFA6584, (int32_t)0xFFFED7AE, (int32_t)0xFFFFFFE8, (int32_t)0xFFFFFFBF, (int32_t)0xFFFFFFAC, (int32_t)0xFFFFE1A3, (int32_t)0xFEB3DE30, (int32_t)0xFFFFFFF2, (int32_t)0xFFFFEC8A, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFF7F, (int32_t)0xFFFE8DD4, (int32_t)0xC92CFF98, (int32_t)0xFFFFE380, (int32_t)0xFF6A6FA3, (int32_t)0xFFFFFFE7, (int32_t)0xFFFFD432, (int32_t)0xFE493939, (int32_t)0xFFFFFFF9, (int32_t)0xFFFFFFDB, (int32_t)0xFDD79186, (int32_t)0xFDA16D63, (int32_t)0xFF9F6B33, (int32_t)0xFFFFFE93, (int32_t)0xFFFFFFCB, (int32_t)0xFFFC079E, (int32_t)0xFF940D0A, (int32_t)0xFFFBBF7F, (int32_t)0xFB1C0167, (int32_t)0xFFFCFB16, (int32_t)0xFFD6DBFD, (int32_t)0xFFFFFEB2, (int32_t)0xFFFE74DB, (int32_t)0xEB01D9CE, (int32_t)0xFFFFD64D, (int32_t)0xFFFEB4AA, (int32_t)0xFFED5CDE, (int32_t)0xFFFFB771, (int32_t)0xFFF6A908, (int32_t)0xFFFBF23A, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFFB9, (int32_t)0xFFFFE4D0, (int32_t)0xFFF5706A };
+		static const int32_t output0[] = { (int32_t)0xD34, (int32_t)0x2645, (int32_t)0x16CC99, (int32_t)0x35EC0, (int32_t)0xBCC6, (int32_t)0x10BBFA, (int32_t)0x202A, (int32_t)0xA14, (int32_t)0x4866, (int32_t)0x4ECD, (int32_t)0x28C8, (int32_t)0x52C92, (int32_t)0x1921, (int32_t)0xD8D69, (int32_t)0x9685, (int32_t)0x7A6EF, (int32_t)0xE4FA1, (int32_t)0xB8A, (int32_t)0x231F3, (int32_t)0xB8A, (int32_t)0x800, (int32_t)0x1053, (int32_t)0x223B8, (int32_t)0xADB1, (int32_t)0x177CF, (int32_t)0x3B05, (int32_t)0x4CDBF, (int32_t)0x68229, (int32_t)0x25BE, (int32_t)0x259F, (int32_t)0x12760F, (int32_t)0x17B3, (int32_t)0x14A13, (int32_t)0x234C8, (int32_t)0xE458D, (int32_t)0x928, (int32_t)0xADB, (int32_t)0x6163E, (int32_t)0x219A1, (int32_t)0x75650, (int32_t)0x19115E, (int32_t)0xA16E5, (int32_t)0x32A9, (int32_t)0x66B54, (int32_t)0x3C18C, (int32_t)0x423A, (int32_t)0x1381, (int32_t)0x1825, (int32_t)0xADB, (int32_t)0x25091, (int32_t)0xFFFFA739, (int32_t)0xFFFF99D6, (int32_t)0xFFFF50B8, (int32_t)0xFFFFC41D, (int32_t)0xFFFFF112, (int32_t)0xFFEB4F5C, (int32_t)0xFFFE3942, (int32_t)0xFFFEF33C, (int32_t)0xFFFFEDAF, (int32_t)0xFFFFE679, (int32_t)0xFFFFE431, (int32_t)0xFFFF823C, (int32_t)0xFFF91312, (int32_t)0xFFFFF0B3, (int32_t)0xFFFF938F, (int32_t)0xFFFFF252, (int32_t)0xFFFFDFEB, (int32_t)0xFFFEDE7D, (int32_t)0xFFE7E11A, (int32_t)0xFFFF84DC, (int32_t)0xFFFAB137, (int32_t)0xFFFFED6F, (int32_t)0xFFFF71DE, (int32_t)0xFFF866C3, (int32_t)0xFFFFF3DB, (int32_t)0xFFFFEAD8, (int32_t)0xFFF7CBA8, (int32_t)0xFFF78917, (int32_t)0xFFFB6958, (int32_t)0xFFFFD29F, (int32_t)0xFFFFE827, (int32_t)0xFFFE6AA6, (int32_t)0xFFFB3D16, (int32_t)0xFFFE614E, (int32_t)0xFFF538F0, (int32_t)0xFFFE8DF7, (int32_t)0xFFFC8C3A, (int32_t)0xFFFFD3F2, (int32_t)0xFFFED820, (int32_t)0xFFEE7BAE, (int32_t)0xFFFF7430, (int32_t)0xFFFEE902, (int32_t)0xFFFD5951, (int32_t)0xFFFF57DB, (int32_t)0xFFFDE4EC, (int32_t)0xFFFE67D3, (int32_t)0xFFFFF476, (int32_t)0xFFFFE5B6, (int32_t)0xFFFF86C6, (int32_t)0xFFFDCE50 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::CbrtFastest", Fixed32::CbrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.RSqrt()
 	static void Fixed64_RSqrt()
 	{
@@ -716,6 +807,60 @@ namespace UnitTest
 			Util::Check("Fixed32::Exp2Fastest", Fixed32::Exp2Fastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.Exp10()
+	static void Fixed64_Exp10()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFFB8E94A174LL, (int64_t)0xD6595E14ELL, (int64_t)0xFFFFFFF463CDDA25LL, (int64_t)0xFFFFFFE46D04D68DLL, (int64_t)0xFFFFFFFEB61E288ALL, (int64_t)0xFFFFFFEC637F7AADLL, (int64_t)0xFFFFFFE9422F76A7LL, (int64_t)0xCF1BE0A25LL, (int64_t)0x1261F49490LL, (int64_t)0xFFFFFFFFFB9E98DCLL, (int64_t)0xFFFFFFF1413676C7LL, (int64_t)0xFFFFFFEDFF869B90LL, (int64_t)0x1A4D8C1468LL, (int64_t)0xFFFFFFFFAF8428A4LL, (int64_t)0xF1374DE12LL, (int64_t)0xFFFFFFEB729AAE7BLL, (int64_t)0xFFFFFFE627AA2991LL, (int64_t)0x78F86C1F3LL, (int64_t)0x80C10FB2CLL, (int64_t)0xBEB603F53LL, (int64_t)0x156A6995F6LL, (int64_t)0x5F8A1197FLL, (int64_t)0xFFFFFFE7A3718A1CLL, (int64_t)0xFFFFFFE30F0FBD53LL, (int64_t)0xB9A58B743LL, (int64_t)0xF624B7F5ALL, (int64_t)0x1B439A037LL, (int64_t)0xF40212BFALL, (int64_t)0x116D982D56LL, (int64_t)0x20EFE5338LL, (int64_t)0xFFFFFFF7CA12D03CLL, (int64_t)0xFFFFFFF71F730B4BLL, (int64_t)0xFFFFFFF0055F7E1DLL, (int64_t)0xFFFFFFFCBADBFC2ELL, (int64_t)0x1FD8B1LL, (int64_t)0x1F9LL, (int64_t)0x11E8F95FLL, (int64_t)0x80C22E8LL, (int64_t)0x7867563LL, (int64_t)0x5A52LL, (int64_t)0x77F57ECDLL, (int64_t)0x95LL, (int64_t)0x1LL, (int64_t)0xEC1D0LL, (int64_t)0x18B31LL, (int64_t)0xB6AF6LL, (int64_t)0x590ELL, (int64_t)0x5FE6D53LL, (int64_t)0xC54LL, (int64_t)0xDADDCFLL, (int64_t)0x6LL, (int64_t)0x1B66FLL, (int64_t)0x7LL, (int64_t)0x11LL, (int64_t)0x116LL, (int64_t)0xD81AF8BLL, (int64_t)0x2324F6LL, (int64_t)0x340LL, (int64_t)0xC9ALL, (int64_t)0x130F73ELL, (int64_t)0x3257C2LL, (int64_t)0x13F5LL, (int64_t)0x86D85B84LL, (int64_t)0x233LL, (int64_t)0x18LL, (int64_t)0x4ECF21F9LL, (int64_t)0x15E5B3169LL, (int64_t)0x177B5LL, (int64_t)0xFFFFFFFFDB06E408LL, (int64_t)0xFFFFFFFFFFFECFC1LL, (int64_t)0xFFFFFFFFFFFFF975LL, (int64_t)0xFFFFFFFFFFFFFE22LL, (int64_t)0xFFFFFFFFF30622BELL, (int64_t)0xFFFFFFFFFFFFFF91LL, (int64_t)0xFFFFFFFFFB955819LL, (int64_t)0xFFFFFFFFFFD0E1F0LL, (int64_t)0xFFFFFFFFFFF1FD14LL, (int64_t)0xFFFFFFFFFFFE3014LL, (int64_t)0xFFFFFFFFFFFD11C1LL, (int64_t)0xFFFFFFFFFFFFFFF3LL, (int64_t)0xFFFFFFFFFFFFF866LL, (int64_t)0xFFFFFFFFFE521FE6LL, (int64_t)0xFFFFFFFFFFFFCBD7LL, (int64_t)0xFFFFFFFFFFFFFFFALL, (int64_t)0xFFFFFFFFFFFF69E7LL, (int64_t)0xFFFFFFFFDFE1C9C1LL, (int64_t)0xFFFFFFFFFFFFFE10LL, (int64_t)0xFFFFFFFFFFFFFFF3LL, (int64_t)0xFFFFFFFFFFFFFF8ELL, (int64_t)0xFFFFFFFFF8ED2C7FLL, (int64_t)0xFFFFFFFFFFD4D4EBLL, (int64_t)0xFFFFFFFFFFFA7DD2LL, (int64_t)0xFFFFFFFFFFFF5C88LL, (int64_t)0xFFFFFFFFFFFFFFFALL, (int64_t)0xFFFFFFFFFA9E1338LL, (int64_t)0xFFFFFFFFFFF9FD63LL, (int64_t)0xFFFFFFFFFFFFFCAELL, (int64_t)0xFFFFFFFFFE4A448DLL, (int64_t)0xFFFFFFFFFFFF62BELL, (int64_t)0xFFFFFFFFFFF0F4CFLL };
+		static const int64_t output0[] = { (int64_t)0x25CE3LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xD2BEC22LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0xF61C162CLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x7C1F58D1LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x22AD7CAB8000000LL, (int64_t)0x6A4CDB210000000LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0xE47AE28000000LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x32953D2800LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x726FFCE800LL, (int64_t)0x1ALL, (int64_t)0x5LL, (int64_t)0x0LL, (int64_t)0x233038LL, (int64_t)0x100495EE0LL, (int64_t)0x100000488LL, (int64_t)0x12CBF3124LL, (int64_t)0x11337897CLL, (int64_t)0x111ED6748LL, (int64_t)0x10000CFF4LL, (int64_t)0x2F10F69C8LL, (int64_t)0x100000154LL, (int64_t)0x100000000LL, (int64_t)0x10021FD08LL, (int64_t)0x100038DFCLL, (int64_t)0x1001A4BC0LL, (int64_t)0x10000CD0CLL, (int64_t)0x10E2E2094LL, (int64_t)0x100001C60LL, (int64_t)0x101F9E76CLL, (int64_t)0x100000008LL, (int64_t)0x10003F190LL, (int64_t)0x10000000CLL, (int64_t)0x100000024LL, (int64_t)0x10000027CLL, (int64_t)0x12111690CLL, (int64_t)0x10050F930LL, (int64_t)0x100000778LL, (int64_t)0x100001D00LL, (int64_t)0x102C1FD20LL, (int64_t)0x100740598LL, (int64_t)0x100002DF0LL, (int64_t)0x35CF3A150LL, (int64_t)0x10000050CLL, (int64_t)0x100000034LL, (int64_t)0x20819FAA8LL, (int64_t)0x175D9F4F40LL, (int64_t)0x10003611CLL, (int64_t)0xB7933D18LL, (int64_t)0xFFFD4370LL, (int64_t)0xFFFFF0E6LL, (int64_t)0xFFFFFBAELL, (int64_t)0xE3CC9CDCLL, (int64_t)0xFFFFFEF6LL, (int64_t)0xF6079B76LL, (int64_t)0xFF93992ALL, (int64_t)0xFFDFBEDALL, (int64_t)0xFFFBD3C8LL, (int64_t)0xFFF94094LL, (int64_t)0xFFFFFFDALL, (int64_t)0xFFFFEE76LL, (int64_t)0xFC299DD8LL, (int64_t)0xFFFF87E0LL, (int64_t)0xFFFFFFEALL, (int64_t)0xFFFEA65CLL, (int64_t)0xBFC4EDE0LL, (int64_t)0xFFFFFB84LL, (int64_t)0xFFFFFFDALL, (int64_t)0xFFFFFEF0LL, (int64_t)0xF0384B56LL, (int64_t)0xFF9CAD52LL, (int64_t)0xFFF35140LL, (int64_t)0xFFFE8792LL, (int64_t)0xFFFFFFEALL, (int64_t)0xF3E6CB24LL, (int64_t)0xFFF22994LL, (int64_t)0xFFFFF854LL, (int64_t)0xFC17CC9CLL, (int64_t)0xFFFE95E0LL, (int64_t)0xFFDD5EAALL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Exp10", Fixed64::Exp10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Exp10Fast()
+	static void Fixed64_Exp10Fast()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFFE642E0B61LL, (int64_t)0xE0C1AC4C8LL, (int64_t)0xFFFFFFE5C2B16BE8LL, (int64_t)0xFFFFFFF093DA1CEELL, (int64_t)0xFFFFFFF955673D87LL, (int64_t)0x1A3863AF7LL, (int64_t)0x9A33DF317LL, (int64_t)0xFFFFFFEA002A3E19LL, (int64_t)0xFFFFFFE7E120B39CLL, (int64_t)0x773A8C912LL, (int64_t)0xFFFFFFF9D45F1638LL, (int64_t)0x1CA2121445LL, (int64_t)0xFFFFFFFF45EC29B3LL, (int64_t)0xDFCAED1DLL, (int64_t)0xFFFFFFF2A528A12ALL, (int64_t)0xAD17AC0C1LL, (int64_t)0xFFFFFFE6F6D221A2LL, (int64_t)0xFFFFFFF8F4BD6ABELL, (int64_t)0xFFFFFFFEC57995B2LL, (int64_t)0xFFFFFFF5418D5667LL, (int64_t)0x155C0FA64ELL, (int64_t)0xFFFFFFF72D118363LL, (int64_t)0xFFFFFFED8C33B9C0LL, (int64_t)0xFFFFFFF6B6E02E32LL, (int64_t)0xFFFFFFEFE06DB664LL, (int64_t)0x49B559425LL, (int64_t)0x68FF4CC79LL, (int64_t)0xFFFFFFFBE4CD5504LL, (int64_t)0x4F5E9E305LL, (int64_t)0x1617324230LL, (int64_t)0xFFFFFFFF3FE0836BLL, (int64_t)0xBECC770DLL, (int64_t)0x198020CED7LL, (int64_t)0x4E7E0F825LL, (int64_t)0x50LL, (int64_t)0x180293BELL, (int64_t)0xB2D81LL, (int64_t)0x8C3LL, (int64_t)0x1LL, (int64_t)0x1EEA4CF1LL, (int64_t)0x14172BLL, (int64_t)0xBLL, (int64_t)0xB65D75LL, (int64_t)0x1295FLL, (int64_t)0x30A73LL, (int64_t)0xE7LL, (int64_t)0x13FEA1A05LL, (int64_t)0x2F2BB302FLL, (int64_t)0x7DLL, (int64_t)0x3LL, (int64_t)0x843LL, (int64_t)0x9375ELL, (int64_t)0x18C90EFLL, (int64_t)0xFD2659ELL, (int64_t)0x1713C16LL, (int64_t)0x10LL, (int64_t)0x49178LL, (int64_t)0x1116FBELL, (int64_t)0x1LL, (int64_t)0x9ADBF7DLL, (int64_t)0x71B17308LL, (int64_t)0xCELL, (int64_t)0x5A249LL, (int64_t)0xD2LL, (int64_t)0x18LL, (int64_t)0x347CA701LL, (int64_t)0x3LL, (int64_t)0x5659261BLL, (int64_t)0xFFFFFFFFFFFFF83ALL, (int64_t)0xFFFFFFFFFFFFB04DLL, (int64_t)0xFFFFFFFFFFFFFFF6LL, (int64_t)0xFFFFFFFFFDA68D05LL, (int64_t)0xFFFFFFFFFFFFEAF2LL, (int64_t)0xFFFFFFFFFFE5496BLL, (int64_t)0xFFFFFFFFFEF9B27CLL, (int64_t)0xFFFFFFFFFDC02900LL, (int64_t)0xFFFFFFFFFFC32264LL, (int64_t)0xFFFFFFFFFF1C0A59LL, (int64_t)0xFFFFFFFFF4146545LL, (int64_t)0xFFFFFFFD2DA257A9LL, (int64_t)0xFFFFFFFFFFE72932LL, (int64_t)0xFFFFFFFFFFE983DELL, (int64_t)0xFFFFFFFFFFFFFF49LL, (int64_t)0xFFFFFFFFFFFCC031LL, (int64_t)0xFFFFFFFFFFFBAE21LL, (int64_t)0xFFFFFFFF9420BDB1LL, (int64_t)0xFFFFFFFFFB855934LL, (int64_t)0xFFFFFFFFFFFFFFF8LL, (int64_t)0xFFFFFFFFE7D4DEA4LL, (int64_t)0xFFFFFFFFFFFFFFFCLL, (int64_t)0xFFFFFFFFFFFFFABFLL, (int64_t)0xFFFFFFFFE09AE655LL, (int64_t)0xFFFFFFFFFFFFF953LL, (int64_t)0xFFFFFFFFFFFFFF94LL, (int64_t)0xFFFFFFFF2F2AB64FLL, (int64_t)0xFFFFFFFFFFFFE726LL, (int64_t)0xFFFFFFFFFFF9A2F6LL, (int64_t)0xFFFFFFFFFFFF224FLL, (int64_t)0xFFFFFFFFFFFFF3AALL, (int64_t)0xFFFFFFFFFFD38190LL };
+		static const int64_t output0[] = { (int64_t)0x64DA34ELL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x39DLL, (int64_t)0x2B8721D780LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x1AFD4B724000000LL, (int64_t)0xB54LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x3003BE19LL, (int64_t)0x77C28B600LL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x184LL, (int64_t)0xF1F65FDLL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x6LL, (int64_t)0x0LL, (int64_t)0x2LL, (int64_t)0x0LL, (int64_t)0x9DF4BAB20000LL, (int64_t)0x37B301A7000000LL, (int64_t)0x521A6LL, (int64_t)0x164BF2A1C0000LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x2D793BC1LL, (int64_t)0x5901F4F70LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x13A70ACB00000LL, (int64_t)0x1000000B4LL, (int64_t)0x13DB5BB94LL, (int64_t)0x10019BD0CLL, (int64_t)0x100001428LL, (int64_t)0x100000000LL, (int64_t)0x152114C74LL, (int64_t)0x1002E44CCLL, (int64_t)0x100000018LL, (int64_t)0x101A5321CLL, (int64_t)0x10002AC9CLL, (int64_t)0x100070038LL, (int64_t)0x100000210LL, (int64_t)0x11C4E3C000LL, (int64_t)0x377803D2800LL, (int64_t)0x10000011CLL, (int64_t)0x100000004LL, (int64_t)0x100001300LL, (int64_t)0x10015389CLL, (int64_t)0x10397653CLL, (int64_t)0x12726B9D4LL, (int64_t)0x103579DE8LL, (int64_t)0x100000024LL, (int64_t)0x1000A8490LL, (int64_t)0x102788DE4LL, (int64_t)0x100000000LL, (int64_t)0x11748C7ECLL, (int64_t)0x2C7CB0D88LL, (int64_t)0x1000001D8LL, (int64_t)0x1000CF8C0LL, (int64_t)0x1000001E0LL, (int64_t)0x100000034LL, (int64_t)0x19A7483F8LL, (int64_t)0x100000004LL, (int64_t)0x22C9780C0LL, (int64_t)0xFFFFEE16LL, (int64_t)0xFFFF487ELL, (int64_t)0xFFFFFFE4LL, (int64_t)0xFAA5C75CLL, (int64_t)0xFFFFCF82LL, (int64_t)0xFFC28700LL, (int64_t)0xFDA6DED0LL, (int64_t)0xFADF8906LL, (int64_t)0xFF7404ECLL, (int64_t)0xFDF54320LL, (int64_t)0xE5F91CD4LL, (int64_t)0x62CBA1LL, (int64_t)0xFFC6D696LL, (int64_t)0xFFCC40F4LL, (int64_t)0xFFFFFE58LL, (int64_t)0xFFF88508LL, (int64_t)0xFFF60E26LL, (int64_t)0x61053AC8LL, (int64_t)0xF5E468B8LL, (int64_t)0xFFFFFFE8LL, (int64_t)0xCDFB8CC6LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFF3E4LL, (int64_t)0xC1051C14LL, (int64_t)0xFFFFF09CLL, (int64_t)0xFFFFFF04LL, (int64_t)0x2720BFF3LL, (int64_t)0xFFFFC6C4LL, (int64_t)0xFFF159E4LL, (int64_t)0xFFFE0196LL, (int64_t)0xFFFFE394LL, (int64_t)0xFF99A466LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Exp10Fast", Fixed64::Exp10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Exp10Fastest()
+	static void Fixed64_Exp10Fastest()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFF407EB5D95LL, (int64_t)0x154AAB827ELL, (int64_t)0xFFFFFFF381CD4B3CLL, (int64_t)0xD17C7D846LL, (int64_t)0xFFFFFFFC45BF879DLL, (int64_t)0x1105C1717ELL, (int64_t)0xFFFFFFEB7CB766ABLL, (int64_t)0x1A1E77AAE8LL, (int64_t)0xFFFFFFFFBCEB57C4LL, (int64_t)0xFFFFFFEC4975A4C5LL, (int64_t)0xFFFFFFE3733E2D9BLL, (int64_t)0x1AADEF0659LL, (int64_t)0x164DEDB8B8LL, (int64_t)0xFFFFFFFA325C9621LL, (int64_t)0xFFFFFFFACE759F72LL, (int64_t)0xFFFFFFEFCFC15C6CLL, (int64_t)0xFFFFFFE7DCDAA93CLL, (int64_t)0xFFFFFFFC2F0B3AB5LL, (int64_t)0xE0174B588LL, (int64_t)0xFFFFFFF35B339A43LL, (int64_t)0x1D71E69E9ELL, (int64_t)0x35C6660B2LL, (int64_t)0xFFFFFFF1B23D1200LL, (int64_t)0xFFFFFFEAB84E161ALL, (int64_t)0xFFFFFFF66300A4C1LL, (int64_t)0xFFFFFFECA83809D6LL, (int64_t)0xFFFFFFF4B8196366LL, (int64_t)0x64D64C2A0LL, (int64_t)0xA00DEC8F8LL, (int64_t)0xFFFFFFFDA88D0CF8LL, (int64_t)0xB3647C9D2LL, (int64_t)0x733D83EDALL, (int64_t)0xFFFFFFE4282669A5LL, (int64_t)0x9969CB6A7LL, (int64_t)0x8DALL, (int64_t)0x53B4DD7BLL, (int64_t)0x12BE1EBLL, (int64_t)0x67F8LL, (int64_t)0x790F74LL, (int64_t)0x18DLL, (int64_t)0xA503FAELL, (int64_t)0xF3LL, (int64_t)0xFLL, (int64_t)0x10A6A364LL, (int64_t)0x1C3B2BLL, (int64_t)0x1293467LL, (int64_t)0x74B22A22LL, (int64_t)0xAA5F5BE9LL, (int64_t)0xA0FF97LL, (int64_t)0x1CLL, (int64_t)0x60E8LL, (int64_t)0xF8LL, (int64_t)0xBLL, (int64_t)0xB0144LL, (int64_t)0x1CBB19LL, (int64_t)0x2016C3ALL, (int64_t)0xF2F38LL, (int64_t)0x1ELL, (int64_t)0x1A2BLL, (int64_t)0x1ABLL, (int64_t)0xE591LL, (int64_t)0x5F5A4LL, (int64_t)0x207LL, (int64_t)0x2LL, (int64_t)0x135AFLL, (int64_t)0x2F97LL, (int64_t)0x5BB56E96LL, (int64_t)0x8ALL, (int64_t)0xFFFFFFFFFFFFFFFBLL, (int64_t)0xFFFFFFFFFFFDE1A4LL, (int64_t)0xFFFFFFFFFFFDDFE8LL, (int64_t)0xFFFFFFFFFFB82A83LL, (int64_t)0xFFFFFFFFFD8016FCLL, (int64_t)0xFFFFFFFFFFFF00ADLL, (int64_t)0xFFFFFFFFFFFF0B82LL, (int64_t)0xFFFFFFFFFD746E8ELL, (int64_t)0xFFFFFFFFFFFF9897LL, (int64_t)0xFFFFFFFFFFFFB079LL, (int64_t)0xFFFFFFFFFFFCDE68LL, (int64_t)0xFFFFFFFFFFE4813BLL, (int64_t)0xFFFFFFFFFFFFFE65LL, (int64_t)0xFFFFFFFFFFFFE6E3LL, (int64_t)0xFFFFFFFFA0B5A336LL, (int64_t)0xFFFFFFFFFFFD0FC8LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFFFF75C9LL, (int64_t)0xFFFFFFFFFFFD72BELL, (int64_t)0xFFFFFFFFFFFF5EDDLL, (int64_t)0xFFFFFFFFFFFFFFFELL, (int64_t)0xFFFFFFFFFFF2C12ALL, (int64_t)0xFFFFFFFFFFFFFA7DLL, (int64_t)0xFFFFFFFFFFF615A4LL, (int64_t)0xFFFFFFFFFFFFFFFDLL, (int64_t)0xFFFFFFFFFFFFB78DLL, (int64_t)0xFFFFFFFFFACD26D8LL, (int64_t)0xFFFFFFFFFFFFFE45LL, (int64_t)0xFFFFFFFE9846C0DFLL, (int64_t)0xFFFFFFFFFFFFFFF9LL, (int64_t)0xFFFFFFFFFFFFF23DLL, (int64_t)0xFFFFFFFFFFFFFF69LL };
+		static const int64_t output0[] = { (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0xC459FLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x8C09FAA8LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x1A64LL, (int64_t)0x6B74LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xA0153LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x0LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x8F8012E8000LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x1LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x1E9C5508800000LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0x12A7806LL, (int64_t)0x7FFFFFFFFFFFFFFFLL, (int64_t)0xF3433DCA000000LL, (int64_t)0x0LL, (int64_t)0xE7059B3E00000000LL, (int64_t)0x100001470LL, (int64_t)0x21F941590LL, (int64_t)0x102B837E4LL, (int64_t)0x10000F02CLL, (int64_t)0x101183A28LL, (int64_t)0x100000390LL, (int64_t)0x118E94D68LL, (int64_t)0x10000022CLL, (int64_t)0x100000020LL, (int64_t)0x1295F78ECLL, (int64_t)0x100413F9CLL, (int64_t)0x102B1F888LL, (int64_t)0x2DB3591B0LL, (int64_t)0x4A129D600LL, (int64_t)0x10174EBC0LL, (int64_t)0x10000003CLL, (int64_t)0x10000DFDCLL, (int64_t)0x100000238LL, (int64_t)0x100000018LL, (int64_t)0x100196D78LL, (int64_t)0x10042676CLL, (int64_t)0x104AC3804LL, (int64_t)0x10023164CLL, (int64_t)0x100000040LL, (int64_t)0x100003C70LL, (int64_t)0x1000003D8LL, (int64_t)0x100021254LL, (int64_t)0x1000DC4CCLL, (int64_t)0x1000004ACLL, (int64_t)0x100000000LL, (int64_t)0x10002CB68LL, (int64_t)0x100006DECLL, (int64_t)0x2481FC2C0LL, (int64_t)0x10000013CLL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFB224ELL, (int64_t)0xFFFB1E52LL, (int64_t)0xFF5B3548LL, (int64_t)0xFA520782LL, (int64_t)0xFFFDB58ELL, (int64_t)0xFFFDCE6ELL, (int64_t)0xFA37D518LL, (int64_t)0xFFFF1278LL, (int64_t)0xFFFF4954LL, (int64_t)0xFFF8CEF0LL, (int64_t)0xFFC0E078LL, (int64_t)0xFFFFFC4CLL, (int64_t)0xFFFFC64ELL, (int64_t)0x6CA705A8LL, (int64_t)0xFFF94054LL, (int64_t)0xFFFFFFFALL, (int64_t)0xFFFEC28ALL, (int64_t)0xFFFA239CLL, (int64_t)0xFFFE8DE0LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFE1957ALL, (int64_t)0xFFFFF356LL, (int64_t)0xFFE93AB8LL, (int64_t)0xFFFFFFF6LL, (int64_t)0xFFFF5996LL, (int64_t)0xF453356CLL, (int64_t)0xFFFFFC04LL, (int64_t)0xA1204F8LL, (int64_t)0xFFFFFFEELL, (int64_t)0xFFFFE060LL, (int64_t)0xFFFFFEA2LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Exp10Fastest", Fixed64::Exp10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Exp10()
+	static void Fixed32_Exp10()
+	{
+		static const int32_t input0[] = { (int32_t)0xFFF6DEC0, (int32_t)0x4CA8F, (int32_t)0xFFFBFCB7, (int32_t)0xFFE6FFA4, (int32_t)0xFFE8DFE6, (int32_t)0xFFEE968A, (int32_t)0x22B61, (int32_t)0xFFF18DBF, (int32_t)0x1B3459, (int32_t)0x106E2, (int32_t)0x29BA7, (int32_t)0xFFFF3911, (int32_t)0x5D9A7, (int32_t)0xFFE96CFA, (int32_t)0xFFE7D3C9, (int32_t)0x1CF6BA, (int32_t)0xFFE619AD, (int32_t)0x1264D3, (int32_t)0xFFEC7869, (int32_t)0xFFF639EF, (int32_t)0xFFF5CA27, (int32_t)0xFFF08C40, (int32_t)0x112975, (int32_t)0xFFE593CA, (int32_t)0xF3056, (int32_t)0xFFEED629, (int32_t)0x17C971, (int32_t)0xFFF96B9E, (int32_t)0xFFE7E9D7, (int32_t)0x11A3FA, (int32_t)0x18E1B8, (int32_t)0xFFF4B07F, (int32_t)0x3EE94, (int32_t)0xB47D8, (int32_t)0x55F, (int32_t)0x17E03, (int32_t)0x2, (int32_t)0x3258, (int32_t)0x189, (int32_t)0x1E1E6, (int32_t)0x15, (int32_t)0x6C7, (int32_t)0x20312, (int32_t)0x25, (int32_t)0x120, (int32_t)0x11, (int32_t)0x11, (int32_t)0x8E63, (int32_t)0x760, (int32_t)0x2A9, (int32_t)0x103, (int32_t)0x149, (int32_t)0xCB8, (int32_t)0x3, (int32_t)0x11839, (int32_t)0x6, (int32_t)0x47C7, (int32_t)0x92, (int32_t)0x59, (int32_t)0xF50F, (int32_t)0x49, (int32_t)0xA, (int32_t)0xC, (int32_t)0xC, (int32_t)0x7F3, (int32_t)0x1C, (int32_t)0x1378B, (int32_t)0x10F54, (int32_t)0xFFFFFB5F, (int32_t)0xFFFFFFF4, (int32_t)0xFFFDE5AA, (int32_t)0xFFFFFFBE, (int32_t)0xFFFFFF94, (int32_t)0xFFFFFFE9, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFD8C3, (int32_t)0xFFFFFFD0, (int32_t)0xFFFFFC7C, (int32_t)0xFFFFF56F, (int32_t)0xFFFFFAF9, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFB7B5, (int32_t)0xFFFFF902, (int32_t)0xFFFFFF72, (int32_t)0xFFFFFE40, (int32_t)0xFFFFEF11, (int32_t)0xFFFFFD1C, (int32_t)0xFFFFC5B6, (int32_t)0xFFFFFE67, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFF3BC, (int32_t)0xFFFFFEDF, (int32_t)0xFFFFFB2E, (int32_t)0xFFFFF2DD, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFEEF, (int32_t)0xFFFFAD94, (int32_t)0xFFFFF1ED, (int32_t)0xFFFFFFEC };
+		static const int32_t output0[] = { (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x6, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x93B926, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0xAA37D, (int32_t)0x195863C, (int32_t)0x2AC5, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x216599D0, (int32_t)0x7FFFFFFF, (int32_t)0x10CAB, (int32_t)0x1F0FF1, (int32_t)0x10004, (int32_t)0x1929E, (int32_t)0x1038F, (int32_t)0x4C47E8, (int32_t)0x10030, (int32_t)0x11017, (int32_t)0x66CCD0, (int32_t)0x10055, (int32_t)0x1029A, (int32_t)0x10027, (int32_t)0x10027, (int32_t)0x39960, (int32_t)0x1118E, (int32_t)0x10632, (int32_t)0x10257, (int32_t)0x102F9, (int32_t)0x11F06, (int32_t)0x10006, (int32_t)0xC6F2B, (int32_t)0x1000D, (int32_t)0x1E839, (int32_t)0x10151, (int32_t)0x100CD, (int32_t)0x91010, (int32_t)0x100A8, (int32_t)0x10017, (int32_t)0x1001B, (int32_t)0x1001B, (int32_t)0x112F9, (int32_t)0x10040, (int32_t)0x107AF4, (int32_t)0xB7A6E, (int32_t)0xF58F, (int32_t)0xFFE4, (int32_t)0x205, (int32_t)0xFF68, (int32_t)0xFF07, (int32_t)0xFFCB, (int32_t)0xFFEB, (int32_t)0xB3DF, (int32_t)0xFF91, (int32_t)0xF808, (int32_t)0xE8CA, (int32_t)0xF4AE, (int32_t)0xFFFB, (int32_t)0xFFF9, (int32_t)0x859C, (int32_t)0xF065, (int32_t)0xFEB9, (int32_t)0xFC00, (int32_t)0xDBD5, (int32_t)0xF96E, (int32_t)0x978C, (int32_t)0xFC58, (int32_t)0xFFE8, (int32_t)0xE542, (int32_t)0xFD69, (int32_t)0xF523, (int32_t)0xE378, (int32_t)0xFFF9, (int32_t)0xFD8E, (int32_t)0x79FA, (int32_t)0xE18F, (int32_t)0xFFD1 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Exp10", Fixed32::Exp10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Exp10Fast()
+	static void Fixed32_Exp10Fast()
+	{
+		static const int32_t input0[] = { (int32_t)0x85FA2, (int32_t)0xFFF4AF7C, (int32_t)0x1322C9, (int32_t)0xFFE51D3F, (int32_t)0xBD1D8, (int32_t)0x13D67D, (int32_t)0xFFE9BB3F, (int32_t)0xFFF58BCA, (int32_t)0x16CD8D, (int32_t)0x630BA, (int32_t)0xFFF6962E, (int32_t)0x1D3247, (int32_t)0xFFF026EB, (int32_t)0x158A00, (int32_t)0xFFF767BB, (int32_t)0xFFF26717, (int32_t)0xFFE420BE, (int32_t)0xFFF13F6B, (int32_t)0x41029, (int32_t)0x1861D0, (int32_t)0x2DEFD, (int32_t)0xFFF7A086, (int32_t)0xFFE420D1, (int32_t)0xFFEACFFD, (int32_t)0x7044, (int32_t)0x149EA1, (int32_t)0xFFFC8B1B, (int32_t)0xA4E4E, (int32_t)0x109435, (int32_t)0xFFE8A5CD, (int32_t)0x77F8A, (int32_t)0x1C24E8, (int32_t)0x6A806, (int32_t)0xFFF5E39C, (int32_t)0x36E, (int32_t)0x33EB, (int32_t)0x12861, (int32_t)0x3A, (int32_t)0x17D16, (int32_t)0x31FC, (int32_t)0x2B3E, (int32_t)0x2, (int32_t)0x2, (int32_t)0x1F0, (int32_t)0x1E9, (int32_t)0x13122, (int32_t)0xDF, (int32_t)0x3C, (int32_t)0x5D7, (int32_t)0x55, (int32_t)0x41, (int32_t)0x653, (int32_t)0x1ADA3, (int32_t)0x73, (int32_t)0x68, (int32_t)0x31, (int32_t)0x2F, (int32_t)0x11B4, (int32_t)0x417, (int32_t)0x8E45, (int32_t)0xAD, (int32_t)0x17E, (int32_t)0x453, (int32_t)0x361E, (int32_t)0x255C5, (int32_t)0x93, (int32_t)0x96, (int32_t)0xFFD8, (int32_t)0xFFFFFFA8, (int32_t)0xFFFFF905, (int32_t)0xFFFFFF88, (int32_t)0xFFFFD879, (int32_t)0xFFFFFFB6, (int32_t)0xFFFFAE07, (int32_t)0xFFFFFFF4, (int32_t)0xFFFFFCBF, (int32_t)0xFFFFFFA7, (int32_t)0xFFFFFB5B, (int32_t)0xFFFFEF0A, (int32_t)0xFFFFF94C, (int32_t)0xFFFFFEDD, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFEA2, (int32_t)0xFFFFAC81, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFDA, (int32_t)0xFFFD6951, (int32_t)0xFFFFFFDD, (int32_t)0xFFFFFDD3, (int32_t)0xFFFFFFDF, (int32_t)0xFFFFD528, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFF6D, (int32_t)0xFFFFFFC7, (int32_t)0xFFFFFE31, (int32_t)0xFFFFFFD9, (int32_t)0xFFFFFD82, (int32_t)0xFFFFFFFA };
+		static const int32_t output0[] = { (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x2D2C7508, (int32_t)0x7FFFFFFF, (int32_t)0x2E71989, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x2BEB6, (int32_t)0x7FFFFFFF, (int32_t)0x16, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x10804, (int32_t)0x1985C, (int32_t)0xE610B, (int32_t)0x10085, (int32_t)0x1ECE06, (int32_t)0x19151, (int32_t)0x179B4, (int32_t)0x10004, (int32_t)0x10004, (int32_t)0x1047F, (int32_t)0x1046F, (int32_t)0xF8E98, (int32_t)0x10203, (int32_t)0x1008A, (int32_t)0x10DCE, (int32_t)0x100C3, (int32_t)0x10095, (int32_t)0x10EFB, (int32_t)0x2FAC23, (int32_t)0x10109, (int32_t)0x100EF, (int32_t)0x10070, (int32_t)0x1006C, (int32_t)0x12C30, (int32_t)0x10997, (int32_t)0x39868, (int32_t)0x1018F, (int32_t)0x10375, (int32_t)0x10A26, (int32_t)0x1A084, (int32_t)0xD84A46, (int32_t)0x10153, (int32_t)0x1015A, (int32_t)0x9FC69, (int32_t)0xFF35, (int32_t)0xF06B, (int32_t)0xFEEC, (int32_t)0xB367, (int32_t)0xFF55, (int32_t)0x7A78, (int32_t)0xFFE4, (int32_t)0xF89D, (int32_t)0xFF33, (int32_t)0xF586, (int32_t)0xDBC7, (int32_t)0xF105, (int32_t)0xFD65, (int32_t)0xFFE8, (int32_t)0xFFF2, (int32_t)0xFCDF, (int32_t)0x78CE, (int32_t)0xFFF9, (int32_t)0xFFFB, (int32_t)0xFFA8, (int32_t)0xA8, (int32_t)0xFFAF, (int32_t)0xFB0A, (int32_t)0xFFB4, (int32_t)0xAE22, (int32_t)0xFFF4, (int32_t)0xFEAE, (int32_t)0xFF7C, (int32_t)0xFBDE, (int32_t)0xFFA6, (int32_t)0xFA53, (int32_t)0xFFF2 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Exp10Fast", Fixed32::Exp10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Exp10Fastest()
+	static void Fixed32_Exp10Fastest()
+	{
+		static const int32_t input0[] = { (int32_t)0x1515AA, (int32_t)0x4700B, (int32_t)0x19B616, (int32_t)0xFFE94BAB, (int32_t)0xFFE7474B, (int32_t)0xFFE479D6, (int32_t)0x88396, (int32_t)0x1BE231, (int32_t)0xFFE8B4D4, (int32_t)0xFFF800F2, (int32_t)0xFFEE7FA2, (int32_t)0x195F4E, (int32_t)0x1C4987, (int32_t)0x70F5B, (int32_t)0x16691, (int32_t)0xFFFEC2D9, (int32_t)0xEFAB8, (int32_t)0xFFECDF01, (int32_t)0x1EC20, (int32_t)0xFFF428F7, (int32_t)0x3B5D5, (int32_t)0x217BD, (int32_t)0x540F4, (int32_t)0xFFFF15F4, (int32_t)0x107197, (int32_t)0xFFE7768D, (int32_t)0xFFF91B14, (int32_t)0xD17BF, (int32_t)0xFFE68AAE, (int32_t)0xFFE75BCA, (int32_t)0xFFF494D3, (int32_t)0xFFE4305D, (int32_t)0xFFF72243, (int32_t)0xFFFD12C3, (int32_t)0x176, (int32_t)0x84, (int32_t)0x64, (int32_t)0x1417, (int32_t)0x1A411, (int32_t)0xA, (int32_t)0x12, (int32_t)0x6418, (int32_t)0x76, (int32_t)0x8, (int32_t)0x2CE5, (int32_t)0x62C, (int32_t)0xC5, (int32_t)0x102, (int32_t)0x3324, (int32_t)0x445F, (int32_t)0x3A2B, (int32_t)0x86, (int32_t)0x14, (int32_t)0x565, (int32_t)0x1CF, (int32_t)0x4C, (int32_t)0x290D6, (int32_t)0x148, (int32_t)0x6C, (int32_t)0x2E54F, (int32_t)0xEBF, (int32_t)0x13F6C, (int32_t)0xD675, (int32_t)0x2, (int32_t)0x3, (int32_t)0xE, (int32_t)0x584, (int32_t)0x317, (int32_t)0xFFFFFFF4, (int32_t)0xFFFFFFF4, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFFE3, (int32_t)0xFFFFFF4F, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFD9BE, (int32_t)0xFFFFFFF1, (int32_t)0xFFFFFE6E, (int32_t)0xFFFFDCD6, (int32_t)0xFFFFFFEE, (int32_t)0xFFFFE9E5, (int32_t)0xFFFE0E25, (int32_t)0xFFFE3C10, (int32_t)0xFFFFFFCB, (int32_t)0xFFFFFFB7, (int32_t)0xFFFE6D10, (int32_t)0xFFFF8E68, (int32_t)0xFFFFC038, (int32_t)0xFFFDAEDE, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFFF65, (int32_t)0xFFFF15DE, (int32_t)0xFFFFFFA2, (int32_t)0xFFFE4CCF, (int32_t)0xFFFFFDEC, (int32_t)0xFFFFFFD3, (int32_t)0xFFFE998D, (int32_t)0xFFFFFFA5, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFF9C6 };
+		static const int32_t output0[] = { (int32_t)0x7FFFFFFF, (int32_t)0x6B042195, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x7FFFFFFF, (int32_t)0x1927F0, (int32_t)0xEC5, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x539F84, (int32_t)0x0, (int32_t)0x140BAFCE, (int32_t)0x7BCF5B, (int32_t)0x7FFFFFFF, (int32_t)0x1F30, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x7FFFFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x4D, (int32_t)0x10365, (int32_t)0x10131, (int32_t)0x100E7, (int32_t)0x132B3, (int32_t)0x2BBC70, (int32_t)0x10017, (int32_t)0x10029, (int32_t)0x275D2, (int32_t)0x10111, (int32_t)0x10012, (int32_t)0x17F56, (int32_t)0x10EA3, (int32_t)0x101C8, (int32_t)0x10256, (int32_t)0x19583, (int32_t)0x1D98A, (int32_t)0x1B000, (int32_t)0x10136, (int32_t)0x1002E, (int32_t)0x10CC0, (int32_t)0x10435, (int32_t)0x100AF, (int32_t)0x16FE549, (int32_t)0x102F9, (int32_t)0x100F9, (int32_t)0x31288E1, (int32_t)0x12453, (int32_t)0x11B134, (int32_t)0x6E1F5, (int32_t)0x10004, (int32_t)0x10006, (int32_t)0x10020, (int32_t)0x10D0B, (int32_t)0x1073B, (int32_t)0xFFE4, (int32_t)0xFFE4, (int32_t)0xFFEB, (int32_t)0xFFF6, (int32_t)0xFFBD, (int32_t)0xFE6A, (int32_t)0xFFF2, (int32_t)0xB572, (int32_t)0xFFDD, (int32_t)0xFC6A, (int32_t)0xBA92, (int32_t)0xFFD6, (int32_t)0xD1D8, (int32_t)0x2E8, (int32_t)0x464, (int32_t)0xFF86, (int32_t)0xFF58, (int32_t)0x6D3, (int32_t)0x5C25, (int32_t)0x9041, (int32_t)0x13B, (int32_t)0xFFEB, (int32_t)0xFE9C, (int32_t)0x1F2A, (int32_t)0xFF28, (int32_t)0x51B, (int32_t)0xFB45, (int32_t)0xFF98, (int32_t)0xA2F, (int32_t)0xFF2F, (int32_t)0xFFF6, (int32_t)0xF214 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Exp10Fastest", Fixed32::Exp10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Log()
 	static void Fixed64_Log()
 	{
@@ -797,6 +942,15 @@ namespace UnitTest
 			Util::Check("Fixed64::Log2Fastest", Fixed64::Log2Fastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.Log2Ultra()
+	static void Fixed64_Log2Ultra()
+	{
+		static const int64_t input0[] = { (int64_t)0x14962AF7641331LL, (int64_t)0x2341CF02D00EBLL, (int64_t)0x2AD7378CELL, (int64_t)0xE4124FLL, (int64_t)0x211DEDBB2FLL, (int64_t)0x6B69EC5DE2B3FLL, (int64_t)0x1DE19EE2B1BDDF00LL, (int64_t)0x58E8B70B055178LL, (int64_t)0xDA764C0FD99260LL, (int64_t)0x5C79DLL, (int64_t)0x1D1LL, (int64_t)0xFBFF032ALL, (int64_t)0x18BC6D93880FFE00LL, (int64_t)0x1BDLL, (int64_t)0x1C5LL, (int64_t)0xE76A126LL, (int64_t)0x139C5FCC51CLL, (int64_t)0x5559CA69LL, (int64_t)0x62532187710400LL, (int64_t)0x1F2AD4E1133LL, (int64_t)0x121AE4C645A4150LL, (int64_t)0x7AB2C1081A299LL, (int64_t)0x1365961704BELL, (int64_t)0x2FF91DB46821LL, (int64_t)0x1LL, (int64_t)0x87AB2C359C8BB0LL, (int64_t)0x39BADDLL, (int64_t)0x2672CLL, (int64_t)0x79B220LL, (int64_t)0x403LL, (int64_t)0x216FLL, (int64_t)0x1EDC4C41LL, (int64_t)0x5B079E396BLL, (int64_t)0x1DB64D3E03C99LL, (int64_t)0x28426F51974BLL, (int64_t)0x1LL, (int64_t)0x30A40C8FLL, (int64_t)0xEF2D189LL, (int64_t)0x699LL, (int64_t)0x4310D519LL, (int64_t)0xC99ECLL, (int64_t)0x4DEBLL, (int64_t)0x101F2CAE8050F5LL, (int64_t)0xFLL, (int64_t)0x1D8E474BD992LL, (int64_t)0x77A5671D1AFLL, (int64_t)0x19DE82D6LL, (int64_t)0x59EE8D3557908LL, (int64_t)0x1LL, (int64_t)0x1E39D4EF51LL, (int64_t)0xFFE04BA5LL, (int64_t)0x1001282CDLL, (int64_t)0x10029D2F0LL, (int64_t)0x1002DCDACLL, (int64_t)0xFFDB9899LL, (int64_t)0xFFC1790FLL, (int64_t)0xFFC8BBB9LL, (int64_t)0x10027CD2BLL, (int64_t)0xFFEEBF25LL, (int64_t)0x1001B620ALL, (int64_t)0xFFFB84D9LL, (int64_t)0x1001AAFC9LL, (int64_t)0x100011FB7LL, (int64_t)0x1001F3100LL, (int64_t)0xFFCA0335LL, (int64_t)0x100170C09LL, (int64_t)0x10033B777LL, (int64_t)0xFFD740EDLL, (int64_t)0xFFF446C4LL, (int64_t)0xFFD104C2LL, (int64_t)0x1003DD552LL, (int64_t)0xFFD8A3C9LL, (int64_t)0xFFE81139LL, (int64_t)0xFFF2564DLL, (int64_t)0xFFEB7A49LL, (int64_t)0x1001700B2LL, (int64_t)0x1003F447FLL, (int64_t)0x10013C656LL, (int64_t)0xFFBFF097LL, (int64_t)0xFFE8E164LL, (int64_t)0xFFF63949LL, (int64_t)0x10004F528LL, (int64_t)0xFFE225B7LL, (int64_t)0x10023EFA4LL, (int64_t)0x10034D1B5LL, (int64_t)0x100090B1ELL, (int64_t)0x1001352F0LL, (int64_t)0x1002390D0LL, (int64_t)0x10008A3D3LL, (int64_t)0x1001B421ELL, (int64_t)0x100375530LL, (int64_t)0x10016BBE9LL, (int64_t)0xFFC920A4LL, (int64_t)0xFFFB39C5LL, (int64_t)0xFFC0F04BLL, (int64_t)0x1000ECED2LL, (int64_t)0x1001D039FLL, (int64_t)0xFFCBA763LL, (int64_t)0x1003E3D3CLL, (int64_t)0xFFC4BCA3LL };
+		static const int64_t output0[] = { (int64_t)0x145D16F630LL, (int64_t)0x1123CC8DC4LL, (int64_t)0x16BC0AB0CLL, (int64_t)0xFFFFFFF7D555E7ACLL, (int64_t)0x50CABBC68LL, (int64_t)0x12BF3DA180LL, (int64_t)0x1CE6B338B0LL, (int64_t)0x167968E718LL, (int64_t)0x17C56FEA0CLL, (int64_t)0xFFFFFFF287EFE074LL, (int64_t)0xFFFFFFE8DC703104LL, (int64_t)0xFFFFFFFFFA2D91CFLL, (int64_t)0x1CA0E82544LL, (int64_t)0xFFFFFFE8CC338BB8LL, (int64_t)0xFFFFFFE8D2C83208LL, (int64_t)0xFFFFFFFBDAB5A1F8LL, (int64_t)0x84B27EBE4LL, (int64_t)0xFFFFFFFE6A5316F8LL, (int64_t)0x169E9655F8LL, (int64_t)0x8F64315D0LL, (int64_t)0x182DA64A84LL, (int64_t)0x12F0605E44LL, (int64_t)0xC471A6790LL, (int64_t)0xD958B10C0LL, (int64_t)0xFFFFFFE000000000LL, (int64_t)0x17157D2D90LL, (int64_t)0xFFFFFFF5D9EB56ACLL, (int64_t)0xFFFFFFF143CCCF10LL, (int64_t)0xFFFFFFF6ED58B928LL, (int64_t)0xFFFFFFEA01147534LL, (int64_t)0xFFFFFFED102F7310LL, (int64_t)0xFFFFFFFCF29BDD5CLL, (int64_t)0x6821DB49CLL, (int64_t)0x10E49A4064LL, (int64_t)0xD54CD4694LL, (int64_t)0xFFFFFFE000000000LL, (int64_t)0xFFFFFFFD9AA5F8A0LL, (int64_t)0xFFFFFFFBE6E4D25CLL, (int64_t)0xFFFFFFEAB8D1E6FCLL, (int64_t)0xFFFFFFFE1147D5D4LL, (int64_t)0xFFFFFFF3A7CE84C8LL, (int64_t)0xFFFFFFEE48AC866CLL, (int64_t)0x1402CCD89CLL, (int64_t)0xFFFFFFE3E829FB68LL, (int64_t)0xCE2A777B8LL, (int64_t)0xAE712AF38LL, (int64_t)0xFFFFFFFCB173154CLL, (int64_t)0x127DA261E8LL, (int64_t)0xFFFFFFE000000000LL, (int64_t)0x4EAEF3BD8LL, (int64_t)0xFFFFFFFFFFD23FBDLL, (int64_t)0x1AB3ADLL, (int64_t)0x3C51EBLL, (int64_t)0x420EA8LL, (int64_t)0xFFFFFFFFFFCB7735LL, (int64_t)0xFFFFFFFFFFA5BFD7LL, (int64_t)0xFFFFFFFFFFB03BBDLL, (int64_t)0x396766LL, (int64_t)0xFFFFFFFFFFE71AFCLL, (int64_t)0x277F3CLL, (int64_t)0xFFFFFFFFFFF988F3LL, (int64_t)0x267E2DLL, (int64_t)0x19F14LL, (int64_t)0x2CFD2DLL, (int64_t)0xFFFFFFFFFFB21497LL, (int64_t)0x213E74LL, (int64_t)0x4A94FALL, (int64_t)0xFFFFFFFFFFC53275LL, (int64_t)0xFFFFFFFFFFEF15BFLL, (int64_t)0xFFFFFFFFFFBC3222LL, (int64_t)0x592A1DLL, (int64_t)0xFFFFFFFFFFC732BALL, (int64_t)0xFFFFFFFFFFDD7750LL, (int64_t)0xFFFFFFFFFFEC495CLL, (int64_t)0xFFFFFFFFFFE2634DLL, (int64_t)0x212E19LL, (int64_t)0x5B3B55LL, (int64_t)0x1C864ELL, (int64_t)0xFFFFFFFFFFA38914LL, (int64_t)0xFFFFFFFFFFDEA3BELL, (int64_t)0xFFFFFFFFFFF1E513LL, (int64_t)0x726EFLL, (int64_t)0xFFFFFFFFFFD4EC00LL, (int64_t)0x33D4A3LL, (int64_t)0x4C2BD7LL, (int64_t)0xD0BC7LL, (int64_t)0x1BDFDELL, (int64_t)0x334BE7LL, (int64_t)0xC76C7LL, (int64_t)0x275133LL, (int64_t)0x4FCB6CLL, (int64_t)0x20CAE6LL, (int64_t)0xFFFFFFFFFFB0CD74LL, (int64_t)0xFFFFFFFFFFF91CA1LL, (int64_t)0xFFFFFFFFFFA4FA57LL, (int64_t)0x155C61LL, (int64_t)0x29D96BLL, (int64_t)0xFFFFFFFFFFB47346LL, (int64_t)0x59BFE3LL, (int64_t)0xFFFFFFFFFFAA7672LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Log2Ultra", Fixed64::Log2Ultra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Log2()
 	static void Fixed32_Log2()
 	{
@@ -824,12 +978,75 @@ namespace UnitTest
 			Util::Check("Fixed32::Log2Fastest", Fixed32::Log2Fastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.Log2Ultra()
+	static void Fixed32_Log2Ultra()
+	{
+		static const int32_t input0[] = { (int32_t)0x284FC2, (int32_t)0x2DE, (int32_t)0xC757E, (int32_t)0x3887A1, (int32_t)0x15, (int32_t)0x2813FE, (int32_t)0x2A1BD9, (int32_t)0x62D67, (int32_t)0x33, (int32_t)0x9, (int32_t)0x43E1, (int32_t)0x15BC, (int32_t)0x20D7, (int32_t)0x2E3B8, (int32_t)0x14DF, (int32_t)0x79, (int32_t)0x1C2, (int32_t)0x7633DD, (int32_t)0x2, (int32_t)0x26E85, (int32_t)0x87CCD1, (int32_t)0x5AA5D, (int32_t)0x6F8, (int32_t)0x8B21339, (int32_t)0x24E0F, (int32_t)0xE725, (int32_t)0x6C44EFA, (int32_t)0x13EB5, (int32_t)0x73023A, (int32_t)0xB8A0BE9, (int32_t)0x244E3523, (int32_t)0x1427FB8D, (int32_t)0x1C, (int32_t)0x23, (int32_t)0x9E1, (int32_t)0x86B, (int32_t)0x138, (int32_t)0xDA8, (int32_t)0x2EF, (int32_t)0x3, (int32_t)0x1DBB53, (int32_t)0x3D6, (int32_t)0x3684250, (int32_t)0x8, (int32_t)0x56E225, (int32_t)0x8, (int32_t)0xC681CEF, (int32_t)0x15546, (int32_t)0x22A3C, (int32_t)0x111, (int32_t)0x1001B, (int32_t)0xFFD4, (int32_t)0xFFE3, (int32_t)0xFFE2, (int32_t)0xFFF0, (int32_t)0xFFCB, (int32_t)0x1003B, (int32_t)0x1001F, (int32_t)0xFFD3, (int32_t)0x1000D, (int32_t)0x10028, (int32_t)0xFFD5, (int32_t)0x1002E, (int32_t)0xFFDE, (int32_t)0xFFCB, (int32_t)0x10001, (int32_t)0xFFE0, (int32_t)0xFFE2, (int32_t)0xFFDA, (int32_t)0xFFC4, (int32_t)0x1003B, (int32_t)0x10034, (int32_t)0xFFFA, (int32_t)0x1003D, (int32_t)0x10031, (int32_t)0xFFF9, (int32_t)0x10020, (int32_t)0xFFE1, (int32_t)0xFFD3, (int32_t)0xFFFE, (int32_t)0x1000C, (int32_t)0xFFED, (int32_t)0x1003D, (int32_t)0x10001, (int32_t)0xFFD9, (int32_t)0x10027, (int32_t)0x10015, (int32_t)0x1002E, (int32_t)0x10022, (int32_t)0xFFE0, (int32_t)0xFFF1, (int32_t)0x10001, (int32_t)0xFFDA, (int32_t)0x10018, (int32_t)0xFFDA, (int32_t)0x10001, (int32_t)0xFFF9, (int32_t)0x1000E, (int32_t)0x1003D, (int32_t)0xFFDC };
+		static const int32_t output0[] = { (int32_t)0x55547, (int32_t)0xFFF98506, (int32_t)0x3A39C, (int32_t)0x5D229, (int32_t)0xFFF4646E, (int32_t)0x55322, (int32_t)0x56563, (int32_t)0x2A082, (int32_t)0xFFF5AC24, (int32_t)0xFFF32B80, (int32_t)0xFFFE15BB, (int32_t)0xFFFC7120, (int32_t)0xFFFD0991, (int32_t)0x187E4, (int32_t)0xFFFC6228, (int32_t)0xFFF6EB3A, (int32_t)0xFFF8D053, (int32_t)0x6E297, (int32_t)0xFFF10000, (int32_t)0x1482F, (int32_t)0x715D8, (int32_t)0x2808F, (int32_t)0xFFFACD07, (int32_t)0xB1ECA, (int32_t)0x13468, (int32_t)0xFFFFDA47, (int32_t)0xAC22B, (int32_t)0x50EA, (int32_t)0x6D879, (int32_t)0xB874A, (int32_t)0xD2E9F, (int32_t)0xC5549, (int32_t)0xFFF4CEAE, (int32_t)0xFFF52118, (int32_t)0xFFFB4DE9, (int32_t)0xFFFB12CE, (int32_t)0xFFF84910, (int32_t)0xFFFBC580, (int32_t)0xFFF98D7B, (int32_t)0xFFF195C0, (int32_t)0x4E4D8, (int32_t)0xFFF9F088, (int32_t)0x9C4C3, (int32_t)0xFFF30000, (int32_t)0x670E5, (int32_t)0xFFF30000, (int32_t)0xBA20F, (int32_t)0x6A2F, (int32_t)0x11D46, (int32_t)0xFFF817BE, (int32_t)0x26, (int32_t)0xFFFFFFC0, (int32_t)0xFFFFFFD6, (int32_t)0xFFFFFFD4, (int32_t)0xFFFFFFE8, (int32_t)0xFFFFFFB3, (int32_t)0x55, (int32_t)0x2C, (int32_t)0xFFFFFFBF, (int32_t)0x12, (int32_t)0x39, (int32_t)0xFFFFFFC1, (int32_t)0x42, (int32_t)0xFFFFFFCE, (int32_t)0xFFFFFFB3, (int32_t)0x1, (int32_t)0xFFFFFFD1, (int32_t)0xFFFFFFD4, (int32_t)0xFFFFFFC9, (int32_t)0xFFFFFFA9, (int32_t)0x55, (int32_t)0x4A, (int32_t)0xFFFFFFF7, (int32_t)0x57, (int32_t)0x46, (int32_t)0xFFFFFFF5, (int32_t)0x2E, (int32_t)0xFFFFFFD3, (int32_t)0xFFFFFFBF, (int32_t)0xFFFFFFFD, (int32_t)0x11, (int32_t)0xFFFFFFE4, (int32_t)0x57, (int32_t)0x1, (int32_t)0xFFFFFFC7, (int32_t)0x38, (int32_t)0x1E, (int32_t)0x42, (int32_t)0x31, (int32_t)0xFFFFFFD1, (int32_t)0xFFFFFFEA, (int32_t)0x1, (int32_t)0xFFFFFFC9, (int32_t)0x22, (int32_t)0xFFFFFFC9, (int32_t)0x1, (int32_t)0xFFFFFFF5, (int32_t)0x14, (int32_t)0x57, (int32_t)0xFFFFFFCC };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Log2Ultra", Fixed32::Log2Ultra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Log10()
+	static void Fixed64_Log10()
+	{
+		static const int64_t input0[] = { (int64_t)0x8715FF9198DLL, (int64_t)0x43FED5BAC59CDLL, (int64_t)0x4CBE9053LL, (int64_t)0x2C1LL, (int64_t)0x1766F84FDE85160LL, (int64_t)0x26F27LL, (int64_t)0x10FEBED72401FD00LL, (int64_t)0x132B2FFEB4E10200LL, (int64_t)0x7C3LL, (int64_t)0x751285F581D80LL, (int64_t)0xB3DE25316B0698LL, (int64_t)0x15F32A24D37LL, (int64_t)0xAA8DDB6C380LL, (int64_t)0x32E08E2F9LL, (int64_t)0x50D3EAD09LL, (int64_t)0x1A18D449F270230LL, (int64_t)0x17D672E6LL, (int64_t)0xE05314LL, (int64_t)0x7F78E425LL, (int64_t)0x1E012FD12CLL, (int64_t)0x603CBE7F73D458LL, (int64_t)0xA3LL, (int64_t)0x58323037LL, (int64_t)0xA58F8LL, (int64_t)0x37EE72FLL, (int64_t)0xC89E2596C3BALL, (int64_t)0x4369ED1DFB862LL, (int64_t)0x98A62AFLL, (int64_t)0xA1BA0AALL, (int64_t)0x263EECA00784D800LL, (int64_t)0x2022CLL, (int64_t)0x15E1D70AD5CB72LL, (int64_t)0x19B4E9C4D9170A00LL, (int64_t)0x7A14DEFLL, (int64_t)0x7C3DE011LL, (int64_t)0x70D60A3CD069FLL, (int64_t)0x196LL, (int64_t)0x13C5A88LL, (int64_t)0x2374ABLL, (int64_t)0x48360EFLL, (int64_t)0x6FEC36628ALL, (int64_t)0x5AC64796881ECLL, (int64_t)0xE807FBE9LL, (int64_t)0x4DLL, (int64_t)0xBC4E33468LL, (int64_t)0x234ACBDF66722E0LL, (int64_t)0xA0AF2LL, (int64_t)0x4423E49ACDBC380LL, (int64_t)0x12EE01CF0FLL, (int64_t)0x14FD53LL, (int64_t)0xFFF0317CLL, (int64_t)0x10024B413LL, (int64_t)0x1003960D0LL, (int64_t)0x10025DEDDLL, (int64_t)0x1000EA9DELL, (int64_t)0x10009F54BLL, (int64_t)0xFFE7EC6FLL, (int64_t)0xFFD57804LL, (int64_t)0x1001EF5B9LL, (int64_t)0xFFD1437DLL, (int64_t)0xFFFC2E10LL, (int64_t)0x10003D7A5LL, (int64_t)0x100040884LL, (int64_t)0xFFD72D4DLL, (int64_t)0x10006064CLL, (int64_t)0xFFC4E1FCLL, (int64_t)0x10016BE78LL, (int64_t)0xFFE14882LL, (int64_t)0xFFC43115LL, (int64_t)0x1001EAAF9LL, (int64_t)0x10023FEF7LL, (int64_t)0xFFC77B70LL, (int64_t)0xFFC415CFLL, (int64_t)0xFFC8A4E7LL, (int64_t)0x1003D8458LL, (int64_t)0xFFC71726LL, (int64_t)0x1000DB285LL, (int64_t)0xFFF19456LL, (int64_t)0x1001F4B06LL, (int64_t)0xFFFF41EFLL, (int64_t)0xFFFA4D60LL, (int64_t)0x100309377LL, (int64_t)0x1002E8478LL, (int64_t)0xFFCD2286LL, (int64_t)0x1000E2CA1LL, (int64_t)0xFFFF317FLL, (int64_t)0x100357D4ELL, (int64_t)0xFFD74E36LL, (int64_t)0x1002A38B5LL, (int64_t)0x100377213LL, (int64_t)0x100006042LL, (int64_t)0x1003CD524LL, (int64_t)0x100145E47LL, (int64_t)0xFFD855EALL, (int64_t)0x1003B1D7ALL, (int64_t)0xFFCB14A9LL, (int64_t)0xFFE39AC9LL, (int64_t)0xFFE90D6ELL, (int64_t)0x1000729F5LL, (int64_t)0x100032D14LL };
+		static const int64_t output0[] = { (int64_t)0x355B0DF32LL, (int64_t)0x571E1053CLL, (int64_t)0xFFFFFFFF7A100084LL, (int64_t)0xFFFFFFF9371943BELL, (int64_t)0x763CDAC8CLL, (int64_t)0xFFFFFFFB91E348DELL, (int64_t)0x8747DBCD4LL, (int64_t)0x881DF3CB0LL, (int64_t)0xFFFFFFF9AA4D09C0LL, (int64_t)0x5AE49D8A8LL, (int64_t)0x7124972EALL, (int64_t)0x28BA947E8LL, (int64_t)0x36F9C87DELL, (int64_t)0x809D7AF6LL, (int64_t)0xB414B1F8LL, (int64_t)0x76FEBB464LL, (int64_t)0xFFFFFFFEF811F890LL, (int64_t)0xFFFFFFFD88CE3AF2LL, (int64_t)0xFFFFFFFFB27A1A04LL, (int64_t)0x17A290430LL, (int64_t)0x6CCC137D8LL, (int64_t)0xFFFFFFF8944844FELL, (int64_t)0xFFFFFFFF89868A1CLL, (int64_t)0xFFFFFFFC32C7853ALL, (int64_t)0xFFFFFFFE22A2C34ALL, (int64_t)0x4B5EA7E6ALL, (int64_t)0x570EC7E10LL, (int64_t)0xFFFFFFFE9242F69ELL, (int64_t)0xFFFFFFFE98AF1A16LL, (int64_t)0x8CEAB7336LL, (int64_t)0xFFFFFFFB7C83F39ELL, (int64_t)0x6281503D4LL, (int64_t)0x8A28007BCLL, (int64_t)0xFFFFFFFE796B11D4LL, (int64_t)0xFFFFFFFFAF9F7E34LL, (int64_t)0x5AA30DB38LL, (int64_t)0xFFFFFFF8F9BEB46CLL, (int64_t)0xFFFFFFFDAF067F80LL, (int64_t)0xFFFFFFFCBBB36CBALL, (int64_t)0xFFFFFFFE3F09DF98LL, (int64_t)0x20C85E724LL, (int64_t)0x59200C028LL, (int64_t)0xFFFFFFFFF5120832LL, (int64_t)0xFFFFFFF840E7661CLL, (int64_t)0x1121C35C6LL, (int64_t)0x7917AB002LL, (int64_t)0xFFFFFFFC2F7499EALL, (int64_t)0x7DA9FF6CCLL, (int64_t)0x146F2EA08LL, (int64_t)0xFFFFFFFC8169F718LL, (int64_t)0xFFFFFFFFFFF92266LL, (int64_t)0xFEF84LL, (int64_t)0x18E878LL, (int64_t)0x107134LL, (int64_t)0x65E18LL, (int64_t)0x4530CLL, (int64_t)0xFFFFFFFFFFF58AB2LL, (int64_t)0xFFFFFFFFFFED85DELL, (int64_t)0xD7148LL, (int64_t)0xFFFFFFFFFFEBB206LL, (int64_t)0xFFFFFFFFFFFE573ELL, (int64_t)0x1AB2CLL, (int64_t)0x1C064LL, (int64_t)0xFFFFFFFFFFEE43E6LL, (int64_t)0x29DC4LL, (int64_t)0xFFFFFFFFFFE6506ALL, (int64_t)0x9E038LL, (int64_t)0xFFFFFFFFFFF2A81ALL, (int64_t)0xFFFFFFFFFFE60386LL, (int64_t)0xD50D4LL, (int64_t)0xFA0E4LL, (int64_t)0xFFFFFFFFFFE771AALL, (int64_t)0xFFFFFFFFFFE5F7A6LL, (int64_t)0xFFFFFFFFFFE7F2F2LL, (int64_t)0x1AB434LL, (int64_t)0xFFFFFFFFFFE74612LL, (int64_t)0x5F2B0LL, (int64_t)0xFFFFFFFFFFF9BC8ALL, (int64_t)0xD964CLL, (int64_t)0xFFFFFFFFFFFFAD76LL, (int64_t)0xFFFFFFFFFFFD867ALL, (int64_t)0x1516A4LL, (int64_t)0x1431F0LL, (int64_t)0xFFFFFFFFFFE9E69ELL, (int64_t)0x627B8LL, (int64_t)0xFFFFFFFFFFFFA64ELL, (int64_t)0x17387CLL, (int64_t)0xFFFFFFFFFFEE5232LL, (int64_t)0x1254A4LL, (int64_t)0x1811C8LL, (int64_t)0x29CCLL, (int64_t)0x1A6830LL, (int64_t)0x8D82CLL, (int64_t)0xFFFFFFFFFFEEC4C6LL, (int64_t)0x19A968LL, (int64_t)0xFFFFFFFFFFE90212LL, (int64_t)0xFFFFFFFFFFF3AA4ELL, (int64_t)0xFFFFFFFFFFF6083ELL, (int64_t)0x31C6CLL, (int64_t)0x16118LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Log10", Fixed64::Log10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Log10Fast()
+	static void Fixed64_Log10Fast()
+	{
+		static const int64_t input0[] = { (int64_t)0x67C8A84D3BLL, (int64_t)0xDLL, (int64_t)0x11FEELL, (int64_t)0x22B71LL, (int64_t)0x6E6B55B8C71LL, (int64_t)0x266CCD90E06F4LL, (int64_t)0x25B110F361A876LL, (int64_t)0x1AE7D92LL, (int64_t)0x2868AE9B5FBLL, (int64_t)0xF8261034A8ELL, (int64_t)0xCEDCCD6F9FLL, (int64_t)0xD7BF1BC1412970LL, (int64_t)0x9A7D2LL, (int64_t)0x73LL, (int64_t)0x6375CB96CCB8LL, (int64_t)0xC1BLL, (int64_t)0x2BCE6E0BE5LL, (int64_t)0xCDCCLL, (int64_t)0xAE2BA4F684A270LL, (int64_t)0x6E91C94LL, (int64_t)0x2B2DF089A037DLL, (int64_t)0x55DLL, (int64_t)0x3FEELL, (int64_t)0x3051DLL, (int64_t)0x40253EDD2DD60LL, (int64_t)0xC07B230FAFBDA8LL, (int64_t)0x2C5C0626EE80D60LL, (int64_t)0x13484A7C09A4LL, (int64_t)0xE40299915BD970LL, (int64_t)0x2LL, (int64_t)0x2ACBF6779982C400LL, (int64_t)0xB2EE4LL, (int64_t)0xC0LL, (int64_t)0x146904C1BDCE9ALL, (int64_t)0xDCLL, (int64_t)0x19F729F1AALL, (int64_t)0xD3CF59LL, (int64_t)0x6BE70C711CLL, (int64_t)0x13D919LL, (int64_t)0x18C7EFLL, (int64_t)0x1F575LL, (int64_t)0x19D7249CLL, (int64_t)0x1LL, (int64_t)0x1A6F4555B0LL, (int64_t)0x38FLL, (int64_t)0x10LL, (int64_t)0x1A67635092935LL, (int64_t)0x96LL, (int64_t)0x36LL, (int64_t)0x3ABE277EF9FLL, (int64_t)0x100047A64LL, (int64_t)0x1001FF8E8LL, (int64_t)0xFFF0DB56LL, (int64_t)0x1001E6534LL, (int64_t)0xFFD63CB9LL, (int64_t)0xFFFA3463LL, (int64_t)0x1002BC848LL, (int64_t)0x1003E8545LL, (int64_t)0xFFFBFB0ELL, (int64_t)0x10026736ALL, (int64_t)0x100302B9FLL, (int64_t)0xFFD1678ELL, (int64_t)0xFFFFCAA0LL, (int64_t)0x10012F47DLL, (int64_t)0x1001C96B3LL, (int64_t)0xFFE928AELL, (int64_t)0x100244550LL, (int64_t)0xFFFB9206LL, (int64_t)0x1003F8BC0LL, (int64_t)0xFFD37476LL, (int64_t)0x10027DFEELL, (int64_t)0x1003EC8AFLL, (int64_t)0x10037BF64LL, (int64_t)0x100080770LL, (int64_t)0xFFD33443LL, (int64_t)0xFFEA4833LL, (int64_t)0xFFD4052ELL, (int64_t)0x100117625LL, (int64_t)0xFFCEDBC9LL, (int64_t)0x1001F821ELL, (int64_t)0xFFCCF74ELL, (int64_t)0x10028A461LL, (int64_t)0x1000FD2BCLL, (int64_t)0xFFDBF242LL, (int64_t)0xFFFE52E0LL, (int64_t)0xFFDEC043LL, (int64_t)0x100384ADFLL, (int64_t)0xFFF1958ALL, (int64_t)0x1001550DELL, (int64_t)0x10016329CLL, (int64_t)0x10021C22CLL, (int64_t)0xFFF39ABELL, (int64_t)0xFFD2D335LL, (int64_t)0x100046F04LL, (int64_t)0xFFFB65C5LL, (int64_t)0xFFCF5E40LL, (int64_t)0x1003CD3B4LL, (int64_t)0xFFED723ELL, (int64_t)0x10031020ELL, (int64_t)0x1002B94C5LL };
+		static const int64_t output0[] = { (int64_t)0x20421122CLL, (int64_t)0xFFFFFFF77B21BBFALL, (int64_t)0xFFFFFFFB3C0C8D60LL, (int64_t)0xFFFFFFFB85195876LL, (int64_t)0x33F463238LL, (int64_t)0x5326CE3F2LL, (int64_t)0x66489A69ALL, (int64_t)0xFFFFFFFDD1469C54LL, (int64_t)0x2CF834A2ALL, (int64_t)0x3994D0D4ALL, (int64_t)0x250D084E2LL, (int64_t)0x726822BDALL, (int64_t)0xFFFFFFFC2B1583AALL, (int64_t)0xFFFFFFF86D803CB4LL, (int64_t)0x467E85874LL, (int64_t)0xFFFFFFF9DBB7095ELL, (int64_t)0x1A43BC792LL, (int64_t)0xFFFFFFFB16B6471ALL, (int64_t)0x70EB554B6LL, (int64_t)0xFFFFFFFE6E680E94LL, (int64_t)0x53F65235ELL, (int64_t)0xFFFFFFF98134B7ACLL, (int64_t)0xFFFFFFFA94BB4802LL, (int64_t)0xFFFFFFFBA9DCA7EELL, (int64_t)0x56B660F64LL, (int64_t)0x719D2787ELL, (int64_t)0x7AAE6ED96LL, (int64_t)0x3B182B6E8LL, (int64_t)0x72CA7B69ALL, (int64_t)0xFFFFFFF6AB06A502LL, (int64_t)0x8DB2B5DDELL, (int64_t)0xFFFFFFFC3B69E8F6LL, (int64_t)0xFFFFFFF8A67CC5A6LL, (int64_t)0x6205703DCLL, (int64_t)0xFFFFFFF8B59F5AE2LL, (int64_t)0x16A15E1F8LL, (int64_t)0xFFFFFFFD826C640ALL, (int64_t)0x20874C390LL, (int64_t)0xFFFFFFFC7B326184LL, (int64_t)0xFFFFFFFC93E02258LL, (int64_t)0xFFFFFFFB79BB469CLL, (int64_t)0xFFFFFFFF010A072CLL, (int64_t)0xFFFFFFF65DF657C0LL, (int64_t)0x16C139120LL, (int64_t)0xFFFFFFF953995676LL, (int64_t)0xFFFFFFF792378CC8LL, (int64_t)0x508B603C8LL, (int64_t)0xFFFFFFF88B0AAA9ELL, (int64_t)0xFFFFFFF8197480A2LL, (int64_t)0x2F91B6A1ALL, (int64_t)0x1F1D8LL, (int64_t)0xDE1BCLL, (int64_t)0xFFFFFFFFFFF96C2ELL, (int64_t)0xD327CLL, (int64_t)0xFFFFFFFFFFEDDB56LL, (int64_t)0xFFFFFFFFFFFD7B9ELL, (int64_t)0x1301FCLL, (int64_t)0x1B2394LL, (int64_t)0xFFFFFFFFFFFE411ALL, (int64_t)0x10B19CLL, (int64_t)0x14E97CLL, (int64_t)0xFFFFFFFFFFEBC1AELL, (int64_t)0xFFFFFFFFFFFFE8CELL, (int64_t)0x83B10LL, (int64_t)0xC69B8LL, (int64_t)0xFFFFFFFFFFF61412LL, (int64_t)0xFBF60LL, (int64_t)0xFFFFFFFFFFFE137ELL, (int64_t)0x1B9574LL, (int64_t)0xFFFFFFFFFFECA5CALL, (int64_t)0x114FD0LL, (int64_t)0x1B40D0LL, (int64_t)0x183340LL, (int64_t)0x37C98LL, (int64_t)0xFFFFFFFFFFEC89E6LL, (int64_t)0xFFFFFFFFFFF690FALL, (int64_t)0xFFFFFFFFFFECE4B2LL, (int64_t)0x79510LL, (int64_t)0xFFFFFFFFFFEAA666LL, (int64_t)0xDAE28LL, (int64_t)0xFFFFFFFFFFE9D3D6LL, (int64_t)0x11A514LL, (int64_t)0x6DEF8LL, (int64_t)0xFFFFFFFFFFF0566ELL, (int64_t)0xFFFFFFFFFFFF459ELL, (int64_t)0xFFFFFFFFFFF18E6ELL, (int64_t)0x186FC4LL, (int64_t)0xFFFFFFFFFFF9BD0ELL, (int64_t)0x94174LL, (int64_t)0x9A374LL, (int64_t)0xEA838LL, (int64_t)0xFFFFFFFFFFFA9DB6LL, (int64_t)0xFFFFFFFFFFEC5FB6LL, (int64_t)0x1ECE4LL, (int64_t)0xFFFFFFFFFFFE0046LL, (int64_t)0xFFFFFFFFFFEADF1ALL, (int64_t)0x1A6774LL, (int64_t)0xFFFFFFFFFFF7F0E6LL, (int64_t)0x15468CLL, (int64_t)0x12EBA0LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Log10Fast", Fixed64::Log10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Log10Fastest()
+	static void Fixed64_Log10Fastest()
+	{
+		static const int64_t input0[] = { (int64_t)0x2C1ACLL, (int64_t)0x15LL, (int64_t)0x10D11B455B75LL, (int64_t)0x1LL, (int64_t)0x6E1CLL, (int64_t)0x2LL, (int64_t)0x330044A4LL, (int64_t)0xA73LL, (int64_t)0x2DBD1LL, (int64_t)0x148760FF79D77A0LL, (int64_t)0x124BD471156LL, (int64_t)0x751AE9D7F5BLL, (int64_t)0x10117LL, (int64_t)0x8LL, (int64_t)0x40781922LL, (int64_t)0x8D27FLL, (int64_t)0x10LL, (int64_t)0x2BC9LL, (int64_t)0x559EEFFBA97B6LL, (int64_t)0x56D3CCAF18LL, (int64_t)0xA4833C54C5LL, (int64_t)0x301FA73B7819660LL, (int64_t)0x32C54LL, (int64_t)0x10474778E8CC5LL, (int64_t)0x41022BD7953BF8LL, (int64_t)0x1D45LL, (int64_t)0xE8DB5D050E25LL, (int64_t)0x2LL, (int64_t)0x29B35LL, (int64_t)0x128EFC227D7B9C00LL, (int64_t)0x674527653F8768LL, (int64_t)0x6699FE559D244LL, (int64_t)0x4B4666C70DFELL, (int64_t)0x19838A6A5B5E3D0LL, (int64_t)0x1F07LL, (int64_t)0x1LL, (int64_t)0x5A3FA8B8F6LL, (int64_t)0x25C628LL, (int64_t)0xC82520LL, (int64_t)0x68LL, (int64_t)0xC564915A85BBC00LL, (int64_t)0x598CCB3256F1LL, (int64_t)0xF67BCC7F51LL, (int64_t)0x2180A701EE3LL, (int64_t)0x6FB91CB5EB45LL, (int64_t)0x6FFA17E28A6D6LL, (int64_t)0x1337368E48LL, (int64_t)0x4B8CCB52AF24LL, (int64_t)0x860B5DE337LL, (int64_t)0x90FFA12B5LL, (int64_t)0xFFF5D168LL, (int64_t)0x1000AFC0CLL, (int64_t)0x1002B8F0ELL, (int64_t)0x10033E66DLL, (int64_t)0xFFCD421BLL, (int64_t)0xFFECAD71LL, (int64_t)0x100257B79LL, (int64_t)0x100392BD0LL, (int64_t)0xFFD0E4C3LL, (int64_t)0xFFC28037LL, (int64_t)0xFFDEA21FLL, (int64_t)0xFFF9DEB0LL, (int64_t)0x10034D909LL, (int64_t)0xFFE73D7BLL, (int64_t)0xFFC1FD54LL, (int64_t)0x1002B58B1LL, (int64_t)0x1003A6BBDLL, (int64_t)0xFFEB889ALL, (int64_t)0x1002C9DB9LL, (int64_t)0xFFFBEC8CLL, (int64_t)0x10018973ELL, (int64_t)0x1001D3865LL, (int64_t)0x1002BF873LL, (int64_t)0x1001ADA3CLL, (int64_t)0x10014B86ALL, (int64_t)0x100327711LL, (int64_t)0xFFE3BC87LL, (int64_t)0x100100916LL, (int64_t)0xFFC10AFFLL, (int64_t)0xFFC5415DLL, (int64_t)0x100100D2ALL, (int64_t)0xFFC1E4CELL, (int64_t)0xFFF234E1LL, (int64_t)0x1001BE21DLL, (int64_t)0x100065784LL, (int64_t)0xFFE580C1LL, (int64_t)0x1003F904CLL, (int64_t)0x1002DD014LL, (int64_t)0x100277252LL, (int64_t)0x1002EAA4ALL, (int64_t)0xFFDC6C8FLL, (int64_t)0x100182CE6LL, (int64_t)0xFFD8E613LL, (int64_t)0xFFEC6158LL, (int64_t)0x1002F8086LL, (int64_t)0x100010B37LL, (int64_t)0x1002D652BLL, (int64_t)0xFFEA13E2LL, (int64_t)0x10011B8A1LL, (int64_t)0x100379277LL };
+		static const int64_t output0[] = { (int64_t)0xFFFFFFFB9FB6497ALL, (int64_t)0xFFFFFFF7B07351D4LL, (int64_t)0x3A24CD424LL, (int64_t)0xFFFFFFF65DF657C0LL, (int64_t)0xFFFFFFFAD12DE564LL, (int64_t)0xFFFFFFF6AB06A502LL, (int64_t)0xFFFFFFFF4CA0D3CALL, (int64_t)0xFFFFFFF9CB5B7FAALL, (int64_t)0xFFFFFFFBA3C16916LL, (int64_t)0x7553D5EDCLL, (int64_t)0x2776BEC18LL, (int64_t)0x345CFD254LL, (int64_t)0xFFFFFFFB2F740FB8LL, (int64_t)0xFFFFFFF745273F86LL, (int64_t)0xFFFFFFFF66AF3C38LL, (int64_t)0xFFFFFFFC210D110ELL, (int64_t)0xFFFFFFF792378CC8LL, (int64_t)0xFFFFFFFA6AA65376LL, (int64_t)0x58B80F5FCLL, (int64_t)0x1F04B7340LL, (int64_t)0x237590FEALL, (int64_t)0x7B3F42072LL, (int64_t)0xFFFFFFFBAF5C380ELL, (int64_t)0x4D2EFD190LL, (int64_t)0x6A1239594LL, (int64_t)0xFFFFFFFA3DE03434LL, (int64_t)0x4C67C648ELL, (int64_t)0xFFFFFFF6AB06A502LL, (int64_t)0xFFFFFFFB997B96C6LL, (int64_t)0x87E472EB8LL, (int64_t)0x6D49821ACLL, (int64_t)0x59F9DFE30LL, (int64_t)0x448EF47FCLL, (int64_t)0x76D67D42CLL, (int64_t)0xFFFFFFFA445BCDA0LL, (int64_t)0xFFFFFFF65DF657C0LL, (int64_t)0x1F4970F7CLL, (int64_t)0xFFFFFFFCC2BECEB2LL, (int64_t)0xFFFFFFFD7C1F4B06LL, (int64_t)0xFFFFFFF862522AA8LL, (int64_t)0x850DFFC82LL, (int64_t)0x45C3C556CLL, (int64_t)0x2644C5832LL, (int64_t)0x2BAACBEFALL, (int64_t)0x474D5C718LL, (int64_t)0x5A95797E4LL, (int64_t)0x1489E519CLL, (int64_t)0x449570F9CLL, (int64_t)0x220936882LL, (int64_t)0xF50E7E8ALL, (int64_t)0xFFFFFFFFFFFB93A2LL, (int64_t)0x4C4E8LL, (int64_t)0x12E844LL, (int64_t)0x1686CCLL, (int64_t)0xFFFFFFFFFFE9F34ALL, (int64_t)0xFFFFFFFFFFF79AFELL, (int64_t)0x10453CLL, (int64_t)0x18D03CLL, (int64_t)0xFFFFFFFFFFEB87D6LL, (int64_t)0xFFFFFFFFFFE5460ELL, (int64_t)0xFFFFFFFFFFF180A6LL, (int64_t)0xFFFFFFFFFFFD5646LL, (int64_t)0x16F010LL, (int64_t)0xFFFFFFFFFFF53E26LL, (int64_t)0xFFFFFFFFFFE50D22LL, (int64_t)0x12D0B0LL, (int64_t)0x195B08LL, (int64_t)0xFFFFFFFFFFF71BC2LL, (int64_t)0x135DB8LL, (int64_t)0xFFFFFFFFFFFE3AB6LL, (int64_t)0xAACECLL, (int64_t)0xCAF50LL, (int64_t)0x131600LL, (int64_t)0xBA83CLL, (int64_t)0x8FED8LL, (int64_t)0x15E76CLL, (int64_t)0xFFFFFFFFFFF3B85ELL, (int64_t)0x6F63CLL, (int64_t)0xFFFFFFFFFFE4A3C6LL, (int64_t)0xFFFFFFFFFFE6789ELL, (int64_t)0x6F800LL, (int64_t)0xFFFFFFFFFFE5027ELL, (int64_t)0xFFFFFFFFFFFA01F6LL, (int64_t)0xC1AC4LL, (int64_t)0x2C0E8LL, (int64_t)0xFFFFFFFFFFF47CE2LL, (int64_t)0x1B962CLL, (int64_t)0x13E2A8LL, (int64_t)0x111F74LL, (int64_t)0x144154LL, (int64_t)0xFFFFFFFFFFF08AD6LL, (int64_t)0xA7EC4LL, (int64_t)0xFFFFFFFFFFEF029ALL, (int64_t)0xFFFFFFFFFFF779EALL, (int64_t)0x149E4CLL, (int64_t)0x7404LL, (int64_t)0x13B444LL, (int64_t)0xFFFFFFFFFFF679CALL, (int64_t)0x7B190LL, (int64_t)0x181EA4LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Log10Fastest", Fixed64::Log10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Log10()
+	static void Fixed32_Log10()
+	{
+		static const int32_t input0[] = { (int32_t)0x93F4480, (int32_t)0x3AFC7, (int32_t)0xB7, (int32_t)0xFF, (int32_t)0x143BAEA, (int32_t)0xA5B16C6, (int32_t)0x19CC7, (int32_t)0x34BBC95, (int32_t)0x5903, (int32_t)0x3DEC, (int32_t)0x16662108, (int32_t)0x4DF1, (int32_t)0x10FED792, (int32_t)0xDE7C, (int32_t)0x16BA1229, (int32_t)0x6B7AB, (int32_t)0x48F, (int32_t)0x1740B, (int32_t)0x8FEFA8, (int32_t)0xA76D656, (int32_t)0x2, (int32_t)0x17F9C, (int32_t)0x522, (int32_t)0x15, (int32_t)0x1D2DA106, (int32_t)0x3F4F998D, (int32_t)0x162352FE, (int32_t)0x7, (int32_t)0x1048E, (int32_t)0x8, (int32_t)0x4D92FEF, (int32_t)0x89159F, (int32_t)0x3C6FE0B, (int32_t)0x2, (int32_t)0x11BC, (int32_t)0xC5, (int32_t)0xC, (int32_t)0xEDD5, (int32_t)0x12CFE, (int32_t)0x4B2A9A, (int32_t)0xDE76, (int32_t)0x95B, (int32_t)0x370C357, (int32_t)0x7CF02, (int32_t)0x56E33, (int32_t)0x2502, (int32_t)0x68, (int32_t)0x2B6116, (int32_t)0x7B097E, (int32_t)0xA, (int32_t)0xFFF9, (int32_t)0x10019, (int32_t)0x10015, (int32_t)0xFFD5, (int32_t)0xFFE7, (int32_t)0xFFEE, (int32_t)0xFFE0, (int32_t)0xFFCC, (int32_t)0xFFE3, (int32_t)0x10027, (int32_t)0x1003C, (int32_t)0xFFFC, (int32_t)0xFFEA, (int32_t)0xFFF1, (int32_t)0x10009, (int32_t)0xFFD6, (int32_t)0x1000C, (int32_t)0x10036, (int32_t)0xFFCE, (int32_t)0x1001C, (int32_t)0x10002, (int32_t)0x10027, (int32_t)0xFFBF, (int32_t)0xFFC2, (int32_t)0xFFF2, (int32_t)0x10014, (int32_t)0x10017, (int32_t)0x1001A, (int32_t)0x10002, (int32_t)0x10005, (int32_t)0x10027, (int32_t)0xFFDE, (int32_t)0xFFE6, (int32_t)0xFFF7, (int32_t)0x10010, (int32_t)0xFFD5, (int32_t)0xFFCA, (int32_t)0x10017, (int32_t)0x1001A, (int32_t)0xFFC0, (int32_t)0x1003D, (int32_t)0x1003F, (int32_t)0xFFDD, (int32_t)0x1001C, (int32_t)0x10023, (int32_t)0xFFC2, (int32_t)0xFFC0, (int32_t)0xFFFB, (int32_t)0xFFC4, (int32_t)0xFFF4 };
+		static const int32_t output0[] = { (int32_t)0x35FCE, (int32_t)0x910E, (int32_t)0xFFFD722B, (int32_t)0xFFFD970E, (int32_t)0x2829B, (int32_t)0x36C65, (int32_t)0x351D, (int32_t)0x2ED1B, (int32_t)0xFFFF8A8C, (int32_t)0xFFFF6233, (int32_t)0x3C22A, (int32_t)0xFFFF7BC8, (int32_t)0x3A379, (int32_t)0xFFFFF066, (int32_t)0x3C3C8, (int32_t)0xD3C3, (int32_t)0xFFFE4026, (int32_t)0x298F, (int32_t)0x2287D, (int32_t)0x36D8D, (int32_t)0xFFFB7C0B, (int32_t)0x2CF7, (int32_t)0xFFFE4D57, (int32_t)0xFFFC8178, (int32_t)0x3DF90, (int32_t)0x435B0, (int32_t)0x3C0DD, (int32_t)0xFFFC0753, (int32_t)0x1F5, (int32_t)0xFFFC162C, (int32_t)0x31805, (int32_t)0x22311, (int32_t)0x2FC44, (int32_t)0xFFFB7C0B, (int32_t)0xFFFED72F, (int32_t)0xFFFD7A5D, (int32_t)0xFFFC4340, (int32_t)0xFFFFF7D0, (int32_t)0x1200, (int32_t)0x1E043, (int32_t)0xFFFFF063, (int32_t)0xFFFE9015, (int32_t)0x2F1E2, (int32_t)0xE47F, (int32_t)0xBC1E, (int32_t)0xFFFF28F9, (int32_t)0xFFFD3357, (int32_t)0x1A324, (int32_t)0x2170C, (int32_t)0xFFFC2EFB, (int32_t)0xFFFFFFFC, (int32_t)0xA, (int32_t)0x9, (int32_t)0xFFFFFFED, (int32_t)0xFFFFFFF5, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFF2, (int32_t)0xFFFFFFE9, (int32_t)0xFFFFFFF3, (int32_t)0x10, (int32_t)0x1A, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFF9, (int32_t)0x3, (int32_t)0xFFFFFFED, (int32_t)0x5, (int32_t)0x17, (int32_t)0xFFFFFFEA, (int32_t)0xC, (int32_t)0x0, (int32_t)0x10, (int32_t)0xFFFFFFE3, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFFF9, (int32_t)0x8, (int32_t)0x9, (int32_t)0xB, (int32_t)0x0, (int32_t)0x2, (int32_t)0x10, (int32_t)0xFFFFFFF1, (int32_t)0xFFFFFFF4, (int32_t)0xFFFFFFFC, (int32_t)0x6, (int32_t)0xFFFFFFED, (int32_t)0xFFFFFFE8, (int32_t)0x9, (int32_t)0xB, (int32_t)0xFFFFFFE4, (int32_t)0x1A, (int32_t)0x1B, (int32_t)0xFFFFFFF0, (int32_t)0xC, (int32_t)0xF, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFFE4, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFFFA };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Log10", Fixed32::Log10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Log10Fast()
+	static void Fixed32_Log10Fast()
+	{
+		static const int32_t input0[] = { (int32_t)0x294387, (int32_t)0x1DDA, (int32_t)0x4D1F9, (int32_t)0x2D5, (int32_t)0x2, (int32_t)0xB, (int32_t)0x124A, (int32_t)0x301, (int32_t)0x4FF9C8, (int32_t)0x13D0, (int32_t)0x3DB, (int32_t)0x1B49ED4, (int32_t)0x57C, (int32_t)0x13, (int32_t)0x37932, (int32_t)0x9E23943, (int32_t)0x360B, (int32_t)0x4E64931, (int32_t)0x80C, (int32_t)0x13B32A7, (int32_t)0x83E, (int32_t)0x19B3AD, (int32_t)0xD0CB0F, (int32_t)0x160227, (int32_t)0xD061B88, (int32_t)0x16A, (int32_t)0xE0C73A3, (int32_t)0xDE210E3, (int32_t)0x6922, (int32_t)0xC86E2CF, (int32_t)0x22F2601C, (int32_t)0x7D73C8, (int32_t)0xA34D, (int32_t)0x68, (int32_t)0x16D, (int32_t)0x1B, (int32_t)0x6, (int32_t)0x293C64, (int32_t)0xED2, (int32_t)0x443DC, (int32_t)0xDC81B86, (int32_t)0x13197, (int32_t)0xACE4A, (int32_t)0x3341B, (int32_t)0x1B6B81, (int32_t)0x80ECC20, (int32_t)0xCFFB9F, (int32_t)0x3F, (int32_t)0x3B954, (int32_t)0x213DF, (int32_t)0x1002C, (int32_t)0x1003B, (int32_t)0x1002B, (int32_t)0x10014, (int32_t)0xFFDF, (int32_t)0xFFC1, (int32_t)0x10010, (int32_t)0x10037, (int32_t)0xFFEF, (int32_t)0x10021, (int32_t)0xFFD3, (int32_t)0xFFFA, (int32_t)0x1002A, (int32_t)0x10029, (int32_t)0xFFF5, (int32_t)0x10006, (int32_t)0xFFE9, (int32_t)0xFFCF, (int32_t)0x1002E, (int32_t)0xFFF9, (int32_t)0x1002D, (int32_t)0x1001F, (int32_t)0xFFFF, (int32_t)0x10021, (int32_t)0x10031, (int32_t)0x10029, (int32_t)0xFFC4, (int32_t)0xFFD9, (int32_t)0x10040, (int32_t)0xFFC1, (int32_t)0xFFFC, (int32_t)0x10021, (int32_t)0xFFEB, (int32_t)0x10036, (int32_t)0xFFC8, (int32_t)0xFFC0, (int32_t)0x10037, (int32_t)0x1002C, (int32_t)0x1003A, (int32_t)0xFFDD, (int32_t)0x10000, (int32_t)0xFFD0, (int32_t)0xFFE9, (int32_t)0x10010, (int32_t)0xFFF6, (int32_t)0xFFFA, (int32_t)0x1001A, (int32_t)0x10029, (int32_t)0xFFD2, (int32_t)0xFFCF };
+		static const int32_t output0[] = { (int32_t)0x19D95, (int32_t)0xFFFF1115, (int32_t)0xAEDD, (int32_t)0xFFFE0B3A, (int32_t)0xFFFB7C0B, (int32_t)0xFFFC3993, (int32_t)0xFFFEDA9C, (int32_t)0xFFFE11C7, (int32_t)0x1E728, (int32_t)0xFFFEE381, (int32_t)0xFFFE2D86, (int32_t)0x2A3DD, (int32_t)0xFFFE54B5, (int32_t)0xFFFC7657, (int32_t)0x8A6F, (int32_t)0x36735, (int32_t)0xFFFF5312, (int32_t)0x31930, (int32_t)0xFFFE7F54, (int32_t)0x27FA3, (int32_t)0xFFFE81FF, (int32_t)0x168F3, (int32_t)0x251D8, (int32_t)0x157B3, (int32_t)0x385E1, (int32_t)0xFFFDBE02, (int32_t)0x38E4D, (int32_t)0x38CFC, (int32_t)0xFFFF9D0E, (int32_t)0x3818E, (int32_t)0x3F39F, (int32_t)0x21935, (int32_t)0xFFFFCE03, (int32_t)0xFFFD3357, (int32_t)0xFFFDBEED, (int32_t)0xFFFC9D69, (int32_t)0xFFFBF630, (int32_t)0x19D82, (int32_t)0xFFFEC33A, (int32_t)0xA142, (int32_t)0x38C2B, (int32_t)0x13AF, (int32_t)0x1089D, (int32_t)0x8170, (int32_t)0x17025, (int32_t)0x35080, (int32_t)0x2516A, (int32_t)0xFFFCFB9C, (int32_t)0x922D, (int32_t)0x514C, (int32_t)0x13, (int32_t)0x19, (int32_t)0x12, (int32_t)0x8, (int32_t)0xFFFFFFF1, (int32_t)0xFFFFFFE4, (int32_t)0x6, (int32_t)0x17, (int32_t)0xFFFFFFF8, (int32_t)0xE, (int32_t)0xFFFFFFEC, (int32_t)0xFFFFFFFD, (int32_t)0x12, (int32_t)0x11, (int32_t)0xFFFFFFFB, (int32_t)0x2, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFEA, (int32_t)0x13, (int32_t)0xFFFFFFFC, (int32_t)0x13, (int32_t)0xD, (int32_t)0xFFFFFFFF, (int32_t)0xE, (int32_t)0x15, (int32_t)0x11, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFFEF, (int32_t)0x1B, (int32_t)0xFFFFFFE4, (int32_t)0xFFFFFFFE, (int32_t)0xE, (int32_t)0xFFFFFFF6, (int32_t)0x17, (int32_t)0xFFFFFFE7, (int32_t)0xFFFFFFE4, (int32_t)0x17, (int32_t)0x13, (int32_t)0x19, (int32_t)0xFFFFFFF0, (int32_t)0x0, (int32_t)0xFFFFFFEB, (int32_t)0xFFFFFFF6, (int32_t)0x6, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFD, (int32_t)0xB, (int32_t)0x11, (int32_t)0xFFFFFFEC, (int32_t)0xFFFFFFEA };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Log10Fast", Fixed32::Log10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Log10Fastest()
+	static void Fixed32_Log10Fastest()
+	{
+		static const int32_t input0[] = { (int32_t)0xF6109F3, (int32_t)0x13E0, (int32_t)0x8F4, (int32_t)0xC6, (int32_t)0x54B, (int32_t)0x9FA982, (int32_t)0xD3EF02, (int32_t)0x154ACC6, (int32_t)0x14C528FA, (int32_t)0xACBDA, (int32_t)0x1B976C, (int32_t)0x87, (int32_t)0x7B65448, (int32_t)0x123D0, (int32_t)0x23AF3, (int32_t)0x125A3B, (int32_t)0x1F4, (int32_t)0x8, (int32_t)0x6568, (int32_t)0x108, (int32_t)0x3AC, (int32_t)0xFFA9C94, (int32_t)0x25, (int32_t)0x177C67, (int32_t)0x83C6E, (int32_t)0x83D0A, (int32_t)0x59D1760, (int32_t)0x1F, (int32_t)0x2BB1EA50, (int32_t)0x2, (int32_t)0x1BCB4, (int32_t)0x1A4AF9BF, (int32_t)0xED, (int32_t)0x3B4, (int32_t)0x23014A9, (int32_t)0x98A1A, (int32_t)0x2, (int32_t)0x131C6E6, (int32_t)0x2FC8BB, (int32_t)0x8, (int32_t)0x2A2B, (int32_t)0x294E, (int32_t)0x3569, (int32_t)0x18842D, (int32_t)0x32, (int32_t)0x2D1, (int32_t)0x4155, (int32_t)0x171, (int32_t)0x3F8572, (int32_t)0x37018776, (int32_t)0xFFD2, (int32_t)0xFFDC, (int32_t)0x1003B, (int32_t)0x1001A, (int32_t)0x10025, (int32_t)0x10041, (int32_t)0xFFDE, (int32_t)0x10017, (int32_t)0x1000D, (int32_t)0x1001A, (int32_t)0x10033, (int32_t)0x10013, (int32_t)0x1002A, (int32_t)0x10039, (int32_t)0xFFCA, (int32_t)0x1001D, (int32_t)0x1003D, (int32_t)0x1000B, (int32_t)0x10019, (int32_t)0x10038, (int32_t)0x10013, (int32_t)0xFFFC, (int32_t)0xFFEE, (int32_t)0xFFF3, (int32_t)0x10029, (int32_t)0x10031, (int32_t)0xFFFE, (int32_t)0xFFFC, (int32_t)0x10001, (int32_t)0xFFE9, (int32_t)0xFFD5, (int32_t)0x1000F, (int32_t)0xFFF4, (int32_t)0x10040, (int32_t)0x1002E, (int32_t)0xFFE7, (int32_t)0xFFBE, (int32_t)0x10004, (int32_t)0x10003, (int32_t)0x1002B, (int32_t)0xFFF0, (int32_t)0xFFEA, (int32_t)0xFFD8, (int32_t)0xFFBF, (int32_t)0xFFD5, (int32_t)0x10024, (int32_t)0x1000D, (int32_t)0xFFFF, (int32_t)0x1000B, (int32_t)0xFFF7 };
+		static const int32_t output0[] = { (int32_t)0x3985D, (int32_t)0xFFFEE3DB, (int32_t)0xFFFE8B32, (int32_t)0xFFFD7AEC, (int32_t)0xFFFE50C1, (int32_t)0x23405, (int32_t)0x25381, (int32_t)0x28847, (int32_t)0x3B9C6, (int32_t)0x10884, (int32_t)0x170D6, (int32_t)0xFFFD5058, (int32_t)0x34BA0, (int32_t)0xE8F, (int32_t)0x592E, (int32_t)0x14382, (int32_t)0xFFFDE1EA, (int32_t)0xFFFC162C, (int32_t)0xFFFF990A, (int32_t)0xFFFD9AE9, (int32_t)0xFFFE281A, (int32_t)0x39C9E, (int32_t)0xFFFCC071, (int32_t)0x15EEC, (int32_t)0xEA6C, (int32_t)0xEA74, (int32_t)0x32850, (int32_t)0xFFFCACC5, (int32_t)0x40C75, (int32_t)0xFFFB7C0B, (int32_t)0x3D65, (int32_t)0x3D3FC, (int32_t)0xFFFD8EEB, (int32_t)0xFFFE290B, (int32_t)0x2BF8D, (int32_t)0xFAC2, (int32_t)0xFFFB7C0B, (int32_t)0x27C44, (int32_t)0x1ADE4, (int32_t)0xFFFC162C, (int32_t)0xFFFF377C, (int32_t)0xFFFF352F, (int32_t)0xFFFF51C2, (int32_t)0x163B2, (int32_t)0xFFFCE1EA, (int32_t)0xFFFE0A9C, (int32_t)0xFFFF6829, (int32_t)0xFFFDC022, (int32_t)0x1CD8C, (int32_t)0x4260E, (int32_t)0xFFFFFFEC, (int32_t)0xFFFFFFF0, (int32_t)0x19, (int32_t)0xB, (int32_t)0x10, (int32_t)0x1C, (int32_t)0xFFFFFFF1, (int32_t)0x9, (int32_t)0x5, (int32_t)0xB, (int32_t)0x16, (int32_t)0x8, (int32_t)0x12, (int32_t)0x18, (int32_t)0xFFFFFFE8, (int32_t)0xC, (int32_t)0x1A, (int32_t)0x4, (int32_t)0xA, (int32_t)0x18, (int32_t)0x8, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFFA, (int32_t)0x11, (int32_t)0x15, (int32_t)0xFFFFFFFF, (int32_t)0xFFFFFFFE, (int32_t)0x0, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFED, (int32_t)0x6, (int32_t)0xFFFFFFFA, (int32_t)0x1B, (int32_t)0x13, (int32_t)0xFFFFFFF5, (int32_t)0xFFFFFFE3, (int32_t)0x1, (int32_t)0x1, (int32_t)0x12, (int32_t)0xFFFFFFF9, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFEE, (int32_t)0xFFFFFFE3, (int32_t)0xFFFFFFED, (int32_t)0xF, (int32_t)0x5, (int32_t)0xFFFFFFFF, (int32_t)0x4, (int32_t)0xFFFFFFFC };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Log10Fastest", Fixed32::Log10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Pow()
 	static void Fixed64_Pow()
 	{
 		static const int64_t input0[] = { (int64_t)0x61D41LL, (int64_t)0x45CDA16DLL, (int64_t)0x658D9LL, (int64_t)0x59CFDLL, (int64_t)0x666FCDLL, (int64_t)0x41DB783DLL, (int64_t)0x2A769794LL, (int64_t)0x34193A4LL, (int64_t)0x21D4CF7LL, (int64_t)0x8184C11LL, (int64_t)0x1305BLL, (int64_t)0x25D705LL, (int64_t)0x1FAFLL, (int64_t)0x8886ELL, (int64_t)0x1F9256LL, (int64_t)0x1B243FD0LL, (int64_t)0x2DB61LL, (int64_t)0x4110511LL, (int64_t)0x10AD4AC5LL, (int64_t)0x205CDLL, (int64_t)0x620FLL, (int64_t)0x20DALL, (int64_t)0x5138B77LL, (int64_t)0xA3DEB7A2LL, (int64_t)0x1416LL, (int64_t)0x77188LL, (int64_t)0x2EF09LL, (int64_t)0xB523B8ALL, (int64_t)0x5C5E93LL, (int64_t)0x2A2B3LL, (int64_t)0x31DE0BLL, (int64_t)0x317C9B10LL, (int64_t)0xBBD134B6LL, (int64_t)0x6B458LL, (int64_t)0x6BAA0LL, (int64_t)0x8C6365ELL, (int64_t)0xBBB7CLL, (int64_t)0x2BBB37LL, (int64_t)0x12F68LL, (int64_t)0x34AFLL, (int64_t)0xAF7E1180LL, (int64_t)0xEF6E3LL, (int64_t)0x9451LL, (int64_t)0x25F3LL, (int64_t)0x202BCLL, (int64_t)0x5D93AB0CLL, (int64_t)0x18C5LL, (int64_t)0x72B5600BLL, (int64_t)0x201CLL, (int64_t)0x149CFC7LL, (int64_t)0x36DEF25F1LL, (int64_t)0x268CD196BLL, (int64_t)0xCFC3BBAE7LL, (int64_t)0x2AE520F64LL, (int64_t)0x1894FE824LL, (int64_t)0x263512591LL, (int64_t)0x9739DCD93LL, (int64_t)0x2FD03C8C8LL, (int64_t)0x17B569C15LL, (int64_t)0x6A0AE473BLL, (int64_t)0x2F042FE06LL, (int64_t)0x460D2DACDLL, (int64_t)0x5F3FA0B0ALL, (int64_t)0x1DB55847ALL, (int64_t)0xB53D16420LL, (int64_t)0x24151A1E4LL, (int64_t)0x2C6F46E2BLL, (int64_t)0x201EEDCB8LL, (int64_t)0x1EA73C1D4LL, (int64_t)0x148D51A2DLL, (int64_t)0x4C01D5714LL, (int64_t)0xCE7E053FCLL, (int64_t)0x902952A54LL, (int64_t)0xE6278F763LL, (int64_t)0x16A3D4BEDLL, (int64_t)0x37B342D7ALL, (int64_t)0x5E95A5296LL, (int64_t)0x3B078172FLL, (int64_t)0x21320CD72LL, (int64_t)0x305039222LL, (int64_t)0x4026329A2LL, (int64_t)0x163A65017LL, (int64_t)0xB17405532LL, (int64_t)0x935EAF523LL, (int64_t)0x5EB7D0C68LL, (int64_t)0xFE012F114LL, (int64_t)0x31AB10AA9LL, (int64_t)0x2CD47D773LL, (int64_t)0x81112C849LL, (int64_t)0xA2E9F9969LL, (int64_t)0x2C8C87016LL, (int64_t)0x2CDD93DADLL, (int64_t)0x330880EE2LL, (int64_t)0x1EC8C7EF4LL, (int64_t)0x65A1DBEBDLL, (int64_t)0x118EF1AF4LL, (int64_t)0x2C7AEB08FLL, (int64_t)0xD7D42732ALL, (int64_t)0x17DF9FE81LL, (int64_t)0x192358527LL };
 		static const int64_t input1[] = { (int64_t)0xCFAD68LL, (int64_t)0x508529DLL, (int64_t)0xCB51F7LL, (int64_t)0xFFA4EBBLL, (int64_t)0xFE2D822LL, (int64_t)0x4158C69LL, (int64_t)0x1AD0456LL, (int64_t)0x959B0EALL, (int64_t)0x57720BCLL, (int64_t)0x1AD44A0LL, (int64_t)0x7ECE3778LL, (int64_t)0xA90E63LL, (int64_t)0x13D3826LL, (int64_t)0xBA401C2LL, (int64_t)0x3B3F02FLL, (int64_t)0x6A3BD49LL, (int64_t)0x1E7DF32ELL, (int64_t)0x124B799B5LL, (int64_t)0x4DB320LL, (int64_t)0xF0C1430BLL, (int64_t)0x18DE96DBLL, (int64_t)0x2D44318B6LL, (int64_t)0x20FD4E47LL, (int64_t)0x13E40275DLL, (int64_t)0x3EBF6AFLL, (int64_t)0x1720163ABLL, (int64_t)0x6C9D8706ELL, (int64_t)0xABA19E6CLL, (int64_t)0x13F8E999ALL, (int64_t)0x996A69LL, (int64_t)0x5C1F032LL, (int64_t)0x6F1B46BLL, (int64_t)0x157CCF312LL, (int64_t)0x8081C3C1DLL, (int64_t)0x1242F9FLL, (int64_t)0x1839A79LL, (int64_t)0x1FC126DF7LL, (int64_t)0x41B39B81LL, (int64_t)0x8E46E9254LL, (int64_t)0x71A2C9LL, (int64_t)0x45AD301FLL, (int64_t)0x49EFD5LL, (int64_t)0x144D8ABLL, (int64_t)0x4FB608LL, (int64_t)0x1779B4B4LL, (int64_t)0x5EA27D94ALL, (int64_t)0x2983BB9LL, (int64_t)0x21908F472LL, (int64_t)0x27B76B53CLL, (int64_t)0x8F9404EF5LL, (int64_t)0x896F77ALL, (int64_t)0xE2DA4443LL, (int64_t)0xA834514LL, (int64_t)0x200233D7LL, (int64_t)0x3041203LL, (int64_t)0x96CAC9BLL, (int64_t)0x992DEA7LL, (int64_t)0xC6618ACFLL, (int64_t)0x1420EDALL, (int64_t)0x215B3E54LL, (int64_t)0x1AC190E7LL, (int64_t)0x2AAF071LL, (int64_t)0xA2AADELL, (int64_t)0x2B730683LL, (int64_t)0xE54371LL, (int64_t)0x1A7B468LL, (int64_t)0x1943F29BLL, (int64_t)0x564B840ELL, (int64_t)0xE3EB99DLL, (int64_t)0x6E697FFDLL, (int64_t)0x73786030LL, (int64_t)0xFA69776ELL, (int64_t)0x8012734LL, (int64_t)0x3FCE56BLL, (int64_t)0x2540AE3ALL, (int64_t)0xF3B619LL, (int64_t)0x8549FD8LL, (int64_t)0xBFD54BDLL, (int64_t)0x1F63E03LL, (int64_t)0x7B74E1LL, (int64_t)0x72C806LL, (int64_t)0x20C72994LL, (int64_t)0x2712A38LL, (int64_t)0x83036DLL, (int64_t)0x77BF33B7LL, (int64_t)0x930511BLL, (int64_t)0xE243D66LL, (int64_t)0xD25757LL, (int64_t)0x57D52C6LL, (int64_t)0x957F97LL, (int64_t)0x6B6979CLL, (int64_t)0x58E0733LL, (int64_t)0xADB562LL, (int64_t)0x5B4FA2LL, (int64_t)0xCB5CE4LL, (int64_t)0x50A4A0LL, (int64_t)0x15898BCLL, (int64_t)0x1B22691BLL, (int64_t)0x5FA837LL, (int64_t)0x3F6A12DLL };
-		static const int64_t output0[] = { (int64_t)0xF894E046LL, (int64_t)0xF98B0970LL, (int64_t)0xF8C38836LL, (int64_t)0x8EB04368LL, (int64_t)0xAB709B50LL, (int64_t)0xFA83BD88LL, (int64_t)0xFD01C5B2LL, (int64_t)0xDA46A3DCLL, (int64_t)0xE715669ELL, (int64_t)0xFA45FBE0LL, (int64_t)0x125B83CLL, (int64_t)0xFB1F66CELL, (int64_t)0xF02DB4BCLL, (int64_t)0xAA70265ELL, (int64_t)0xE5393010LL, (int64_t)0xF1867C3CLL, (int64_t)0x4D6B93B6LL, (int64_t)0x23EAFF6LL, (int64_t)0xFF2C226ELL, (int64_t)0x3C11BLL, (int64_t)0x4F67C625LL, (int64_t)0x0LL, (int64_t)0x9A765E76LL, (int64_t)0x9306240ALL, (int64_t)0xCFBDA6E0LL, (int64_t)0x215DLL, (int64_t)0x0LL, (int64_t)0x1FA3E1E8LL, (int64_t)0x121A14LL, (int64_t)0xFA017EB4LL, (int64_t)0xD9D227A2LL, (int64_t)0xF4D68FF6LL, (int64_t)0xA8E3DEB6LL, (int64_t)0x0LL, (int64_t)0xF5BAC90CLL, (int64_t)0xFAF17022LL, (int64_t)0x9DLL, (int64_t)0x27316FFDLL, (int64_t)0x0LL, (int64_t)0xFA6FCD3ALL, (int64_t)0xE6FF85DCLL, (int64_t)0xFD96FD20LL, (int64_t)0xF1A6FA1CLL, (int64_t)0xFBFBF742LL, (int64_t)0x62B6F27DLL, (int64_t)0xAA59E8LL, (int64_t)0xDF6E350ALL, (int64_t)0x2F848E45LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x10ACECF94LL, (int64_t)0x22E095760LL, (int64_t)0x11C6C3CC4LL, (int64_t)0x121982CA8LL, (int64_t)0x1014C639CLL, (int64_t)0x1085619C0LL, (int64_t)0x1166EF140LL, (int64_t)0x255F27AC8LL, (int64_t)0x1007EC5D8LL, (int64_t)0x14789C8A0LL, (int64_t)0x11E8725C8LL, (int64_t)0x103F84290LL, (int64_t)0x10122D3E4LL, (int64_t)0x11C59DB60LL, (int64_t)0x1022ED8ACLL, (int64_t)0x10159792CLL, (int64_t)0x11B2709A8LL, (int64_t)0x143CAAFF4LL, (int64_t)0x1096E5598LL, (int64_t)0x11D3114C0LL, (int64_t)0x204FE43C8LL, (int64_t)0xC347A2720LL, (int64_t)0x112372DACLL, (int64_t)0x10ADB31D4LL, (int64_t)0x10D437DA4LL, (int64_t)0x10130B660LL, (int64_t)0x10F3D2D74LL, (int64_t)0x11023DF24LL, (int64_t)0x1016F9414LL, (int64_t)0x1008893C4LL, (int64_t)0x1009F953CLL, (int64_t)0x10B01A55CLL, (int64_t)0x105F19F44LL, (int64_t)0x101238B70LL, (int64_t)0x24C29C9E8LL, (int64_t)0x11AB53DE4LL, (int64_t)0x11087F40CLL, (int64_t)0x100D91284LL, (int64_t)0x10BB8A048LL, (int64_t)0x1015BDA54LL, (int64_t)0x106F7AF5CLL, (int64_t)0x105CAC1CCLL, (int64_t)0x100C9CB2CLL, (int64_t)0x1003BC874LL, (int64_t)0x101790DE4LL, (int64_t)0x100077EDCLL, (int64_t)0x1016148FCLL, (int64_t)0x1514BE8BCLL, (int64_t)0x100264AA4LL, (int64_t)0x101CC037CLL };
+		static const int64_t output0[] = { (int64_t)0xF894E046LL, (int64_t)0xF98B0970LL, (int64_t)0xF8C38836LL, (int64_t)0x8EB04368LL, (int64_t)0xAB709B50LL, (int64_t)0xFA83BD88LL, (int64_t)0xFD01C5B2LL, (int64_t)0xDA46A3DCLL, (int64_t)0xE715669ELL, (int64_t)0xFA45FBE0LL, (int64_t)0x125B83CLL, (int64_t)0xFB1F66D2LL, (int64_t)0xF02DB4BCLL, (int64_t)0xAA70265ELL, (int64_t)0xE5393010LL, (int64_t)0xF1867C3CLL, (int64_t)0x4D6B93B6LL, (int64_t)0x23EAFF6LL, (int64_t)0xFF2C226ELL, (int64_t)0x3C11BLL, (int64_t)0x4F67C625LL, (int64_t)0x0LL, (int64_t)0x9A765E76LL, (int64_t)0x93062408LL, (int64_t)0xCFBDA6E0LL, (int64_t)0x215DLL, (int64_t)0x0LL, (int64_t)0x1FA3E1E8LL, (int64_t)0x121A14LL, (int64_t)0xFA017EB4LL, (int64_t)0xD9D227A2LL, (int64_t)0xF4D68FFALL, (int64_t)0xA8E3DEB6LL, (int64_t)0x0LL, (int64_t)0xF5BAC90CLL, (int64_t)0xFAF17022LL, (int64_t)0x9DLL, (int64_t)0x27316FFCLL, (int64_t)0x0LL, (int64_t)0xFA6FCD3ALL, (int64_t)0xE6FF85DCLL, (int64_t)0xFD96FD20LL, (int64_t)0xF1A6FA1CLL, (int64_t)0xFBFBF742LL, (int64_t)0x62B6F27DLL, (int64_t)0xAA59E8LL, (int64_t)0xDF6E350ELL, (int64_t)0x2F848E45LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x10ACECF94LL, (int64_t)0x22E095768LL, (int64_t)0x11C6C3CC4LL, (int64_t)0x121982CA8LL, (int64_t)0x1014C639CLL, (int64_t)0x1085619C0LL, (int64_t)0x1166EF140LL, (int64_t)0x255F27AD8LL, (int64_t)0x1007EC5D8LL, (int64_t)0x14789C8A4LL, (int64_t)0x11E8725CCLL, (int64_t)0x103F84290LL, (int64_t)0x10122D3E4LL, (int64_t)0x11C59DB60LL, (int64_t)0x1022ED8ACLL, (int64_t)0x101597930LL, (int64_t)0x11B2709A8LL, (int64_t)0x143CAAFF8LL, (int64_t)0x1096E5598LL, (int64_t)0x11D3114C0LL, (int64_t)0x204FE43C8LL, (int64_t)0xC347A27C0LL, (int64_t)0x112372DACLL, (int64_t)0x10ADB31D4LL, (int64_t)0x10D437DA4LL, (int64_t)0x10130B660LL, (int64_t)0x10F3D2D74LL, (int64_t)0x11023DF24LL, (int64_t)0x1016F9414LL, (int64_t)0x1008893C4LL, (int64_t)0x1009F953CLL, (int64_t)0x10B01A560LL, (int64_t)0x105F19F44LL, (int64_t)0x101238B74LL, (int64_t)0x24C29C9F8LL, (int64_t)0x11AB53DE8LL, (int64_t)0x11087F40CLL, (int64_t)0x100D91284LL, (int64_t)0x10BB8A04CLL, (int64_t)0x1015BDA54LL, (int64_t)0x106F7AF5CLL, (int64_t)0x105CAC1CCLL, (int64_t)0x100C9CB2CLL, (int64_t)0x1003BC874LL, (int64_t)0x101790DE4LL, (int64_t)0x100077EDCLL, (int64_t)0x1016148FCLL, (int64_t)0x1514BE8BCLL, (int64_t)0x100264AA8LL, (int64_t)0x101CC037CLL };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util::Check("Fixed64::Pow", Fixed64::Pow(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -839,7 +1056,7 @@ namespace UnitTest
 	{
 		static const int64_t input0[] = { (int64_t)0x600ALL, (int64_t)0xD80F9LL, (int64_t)0x8DA66LL, (int64_t)0x4C7041ELL, (int64_t)0x8DFA03LL, (int64_t)0x68B18F90LL, (int64_t)0x69BC1962LL, (int64_t)0x3B3E99LL, (int64_t)0x2F08BLL, (int64_t)0x7781BALL, (int64_t)0xF995AA5ALL, (int64_t)0x17C95LL, (int64_t)0x280AC6LL, (int64_t)0x38EC42LL, (int64_t)0x9C33ALL, (int64_t)0x39A2BFELL, (int64_t)0x189ACD69LL, (int64_t)0x8C7810LL, (int64_t)0x554C25LL, (int64_t)0x5D7857C1LL, (int64_t)0xFC1DLL, (int64_t)0xAD8AB1DLL, (int64_t)0x3E452LL, (int64_t)0x51BEFCLL, (int64_t)0x390ELL, (int64_t)0x8210FLL, (int64_t)0xD6F410LL, (int64_t)0x581EELL, (int64_t)0x36415CLL, (int64_t)0x24FDLL, (int64_t)0x95218LL, (int64_t)0x28A2LL, (int64_t)0x5E07LL, (int64_t)0xDC089DLL, (int64_t)0x1845LL, (int64_t)0x6549LL, (int64_t)0x463F79LL, (int64_t)0x211EB6LL, (int64_t)0x8BC8842LL, (int64_t)0x203C35ALL, (int64_t)0x24075FLL, (int64_t)0x719B5481LL, (int64_t)0x3AD0LL, (int64_t)0x4755FLL, (int64_t)0x466972LL, (int64_t)0x1470LL, (int64_t)0x1F4ALL, (int64_t)0x2B286AACLL, (int64_t)0x6306BLL, (int64_t)0xA55A92LL, (int64_t)0xC92F5EF62LL, (int64_t)0x19862679FLL, (int64_t)0x319980B11LL, (int64_t)0x14F2290CBLL, (int64_t)0x2DF75E2C3LL, (int64_t)0x55A5EBBA1LL, (int64_t)0x3E5B331C1LL, (int64_t)0x22E977023LL, (int64_t)0x1374E2B48LL, (int64_t)0x673EE3C6ALL, (int64_t)0x67E478229LL, (int64_t)0x151B0551ALL, (int64_t)0x9F091EE09LL, (int64_t)0x494C537B4LL, (int64_t)0xC3C02C40DLL, (int64_t)0x5CEA5F968LL, (int64_t)0x5A2ED1B5ELL, (int64_t)0x145DCBDE9LL, (int64_t)0x17F872016LL, (int64_t)0x1613A0643LL, (int64_t)0x10F8B86C1LL, (int64_t)0x4328188B7LL, (int64_t)0x1D2823F5ELL, (int64_t)0x8F97BFDAALL, (int64_t)0x1B3E312B3LL, (int64_t)0x43BB70449LL, (int64_t)0x4A069B5BBLL, (int64_t)0x201ADA337LL, (int64_t)0x4DA608C28LL, (int64_t)0x5B80780AFLL, (int64_t)0x26DE2B1C6LL, (int64_t)0x96308129FLL, (int64_t)0xB236F1D8ELL, (int64_t)0x362722719LL, (int64_t)0x19045676BLL, (int64_t)0x17497D50BLL, (int64_t)0x25749BA1DLL, (int64_t)0xBF0677A69LL, (int64_t)0x474060F14LL, (int64_t)0x3A6F62907LL, (int64_t)0x4F6F8FA60LL, (int64_t)0x5C2516505LL, (int64_t)0x4266D28D7LL, (int64_t)0xF772F084ELL, (int64_t)0xFDCAC4C47LL, (int64_t)0xD8E35CB1ELL, (int64_t)0xA332986B9LL, (int64_t)0x22A041E3CLL, (int64_t)0x5FBDDFF10LL, (int64_t)0x654893497LL };
 		static const int64_t input1[] = { (int64_t)0x113AF8B30CLL, (int64_t)0x489704ELL, (int64_t)0x124D5F4LL, (int64_t)0x364BD308LL, (int64_t)0x9BF98D2E6LL, (int64_t)0x89F37FFLL, (int64_t)0x9FE078LL, (int64_t)0x41088576ALL, (int64_t)0x7AADB2F5LL, (int64_t)0x1FD3B92LL, (int64_t)0x823BA60LL, (int64_t)0x715B6B72LL, (int64_t)0x45CD4ALL, (int64_t)0x2381A8BLL, (int64_t)0x19808E8LL, (int64_t)0xA6AAED309LL, (int64_t)0xB28A31LL, (int64_t)0x5E57CB2FDLL, (int64_t)0x191D5DDDLL, (int64_t)0x28C60F0LL, (int64_t)0x19EFC49LL, (int64_t)0xB042AECLL, (int64_t)0x2C0197EB2LL, (int64_t)0x58173F51DLL, (int64_t)0x1AFFB833LL, (int64_t)0x33289D7LL, (int64_t)0xD80F17EBLL, (int64_t)0x1224AE4BF3LL, (int64_t)0x48EFC8LL, (int64_t)0x88CAB9LL, (int64_t)0x52FEF7DLL, (int64_t)0x12FF14112LL, (int64_t)0x12652FD2BBLL, (int64_t)0x8FF3F0C94LL, (int64_t)0x861372LL, (int64_t)0x81358DLL, (int64_t)0x870588A30LL, (int64_t)0x530C166FLL, (int64_t)0xB0F9D1B4LL, (int64_t)0xC6176A40LL, (int64_t)0x617A53LL, (int64_t)0xBB3BE45FLL, (int64_t)0x39E633A75LL, (int64_t)0x3A84F8FBLL, (int64_t)0x4FF15FCLL, (int64_t)0x428ED6493LL, (int64_t)0xA7D12F4B4LL, (int64_t)0x5AB8D4188LL, (int64_t)0xD8C788LL, (int64_t)0x492E2D16LL, (int64_t)0x126EFBBLL, (int64_t)0x5975D463LL, (int64_t)0x26D0D38ELL, (int64_t)0x43B09CLL, (int64_t)0xB6B586BLL, (int64_t)0x3F07D16LL, (int64_t)0xB7C346AALL, (int64_t)0x121D99AELL, (int64_t)0x84FE6510LL, (int64_t)0x6173B727LL, (int64_t)0x5E3FA5LL, (int64_t)0x1569942LL, (int64_t)0x22F06971LL, (int64_t)0x56898C3LL, (int64_t)0x2EB66D0LL, (int64_t)0x66346014LL, (int64_t)0x14222BDLL, (int64_t)0x3BFC127LL, (int64_t)0x3BA2FC5LL, (int64_t)0x337FD91ELL, (int64_t)0x27648C5LL, (int64_t)0x2774B3A9LL, (int64_t)0xB4D8FD8LL, (int64_t)0x1BCD04C0LL, (int64_t)0xA89ECC7LL, (int64_t)0x3C8094ELL, (int64_t)0x436881LL, (int64_t)0x13E18DELL, (int64_t)0x3DF1670BLL, (int64_t)0x1750525LL, (int64_t)0x1C9F6615LL, (int64_t)0x1B31EC3LL, (int64_t)0x10D363F4LL, (int64_t)0x840AE81ALL, (int64_t)0x4621735LL, (int64_t)0x6AFDC85LL, (int64_t)0x727858LL, (int64_t)0x6487F0D7LL, (int64_t)0x77B115C4LL, (int64_t)0x32A93A52LL, (int64_t)0xE8921ELL, (int64_t)0x1E1CF5C4LL, (int64_t)0xED9BFD33LL, (int64_t)0x1BC933A4LL, (int64_t)0x47CD589LL, (int64_t)0x2A724F1LL, (int64_t)0x93137ACELL, (int64_t)0x6B859BLL, (int64_t)0x14A02684LL, (int64_t)0xA0A608LL };
-		static const int64_t output0[] = { (int64_t)0x0LL, (int64_t)0xDC3FF518LL, (int64_t)0xF6026668LL, (int64_t)0x6E08265DLL, (int64_t)0x0LL, (int64_t)0xF8680766LL, (int64_t)0xFF72CCE0LL, (int64_t)0x0LL, (int64_t)0x21C77E5LL, (int64_t)0xF3C1E95ALL, (int64_t)0xFFCB2500LL, (int64_t)0x23F6D7BLL, (int64_t)0xFDFD872CLL, (int64_t)0xF0D3B852LL, (int64_t)0xF2558A06LL, (int64_t)0x0LL, (int64_t)0xFE5F32E8LL, (int64_t)0x0LL, (int64_t)0x856643FALL, (int64_t)0xFD7210E2LL, (int64_t)0xEE9DD3D6LL, (int64_t)0xDF7057C2LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x43D826F9LL, (int64_t)0xE4CBF2B6LL, (int64_t)0x20CB518LL, (int64_t)0x0LL, (int64_t)0xFDFC7E6ELL, (int64_t)0xF922750ELL, (int64_t)0xD5F023C8LL, (int64_t)0x39BLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xF90DE7F4LL, (int64_t)0xFA019D88LL, (int64_t)0x0LL, (int64_t)0x15D241A8LL, (int64_t)0x18C861D8LL, (int64_t)0x607172FLL, (int64_t)0xFD287AE2LL, (int64_t)0x8D501164LL, (int64_t)0x0LL, (int64_t)0x1C8D3FC4LL, (int64_t)0xE0066A56LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x2B4EFLL, (int64_t)0xF845A30ELL, (int64_t)0x2E4C0F8FLL, (int64_t)0x102EED648LL, (int64_t)0x12D6258C8LL, (int64_t)0x12FE88FECLL, (int64_t)0x100123B6CLL, (int64_t)0x10C5699C0LL, (int64_t)0x106B1BDA4LL, (int64_t)0x2A7AD2620LL, (int64_t)0x10E87F8B0LL, (int64_t)0x11B616008LL, (int64_t)0x20894E490LL, (int64_t)0x100B086C4LL, (int64_t)0x1005EEF60LL, (int64_t)0x15E3CD330LL, (int64_t)0x1085D5198LL, (int64_t)0x1076A77F8LL, (int64_t)0x204B4C1E8LL, (int64_t)0x1022F5898LL, (int64_t)0x100E7F590LL, (int64_t)0x10182CB38LL, (int64_t)0x111208C9CLL, (int64_t)0x100252900LL, (int64_t)0x13F57951CLL, (int64_t)0x106DF717CLL, (int64_t)0x144E3B7E0LL, (int64_t)0x105AB86A0LL, (int64_t)0x10583AD20LL, (int64_t)0x100675278LL, (int64_t)0x100DDDE6CLL, (int64_t)0x1772BF2ECLL, (int64_t)0x1028D9B60LL, (int64_t)0x11AB531C8LL, (int64_t)0x103D584C8LL, (int64_t)0x12BF25264LL, (int64_t)0x1E01FD668LL, (int64_t)0x101F76274LL, (int64_t)0x102858B94LL, (int64_t)0x100616BB8LL, (int64_t)0x2A5E6BDE0LL, (int64_t)0x202AA18A0LL, (int64_t)0x14ACD3588LL, (int64_t)0x10175AAACLL, (int64_t)0x13A8B32ECLL, (int64_t)0x3BF2E0E00LL, (int64_t)0x1589D2F20LL, (int64_t)0x10CB53E94LL, (int64_t)0x107025378LL, (int64_t)0x3CC104890LL, (int64_t)0x100530C2CLL, (int64_t)0x127B16278LL, (int64_t)0x101291364LL };
+		static const int64_t output0[] = { (int64_t)0x0LL, (int64_t)0xDC3FF510LL, (int64_t)0xF6026684LL, (int64_t)0x6E0825E9LL, (int64_t)0x0LL, (int64_t)0xF868076ELL, (int64_t)0xFF72CCE0LL, (int64_t)0x0LL, (int64_t)0x21C77E6LL, (int64_t)0xF3C1E95ALL, (int64_t)0xFFCB24F8LL, (int64_t)0x23F6D7DLL, (int64_t)0xFDFD872CLL, (int64_t)0xF0D3B854LL, (int64_t)0xF2558A0ALL, (int64_t)0x0LL, (int64_t)0xFE5F32E8LL, (int64_t)0x0LL, (int64_t)0x856643F0LL, (int64_t)0xFD7210E2LL, (int64_t)0xEE9DD3D4LL, (int64_t)0xDF7057E4LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x43D826FCLL, (int64_t)0xE4CBF2B0LL, (int64_t)0x20CB516LL, (int64_t)0x0LL, (int64_t)0xFDFC7E6ELL, (int64_t)0xF922750ELL, (int64_t)0xD5F023BELL, (int64_t)0x39BLL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xF90DE7F6LL, (int64_t)0xFA019D88LL, (int64_t)0x0LL, (int64_t)0x15D24165LL, (int64_t)0x18C86340LL, (int64_t)0x6071731LL, (int64_t)0xFD287AE6LL, (int64_t)0x8D5011CALL, (int64_t)0x0LL, (int64_t)0x1C8D403FLL, (int64_t)0xE0066AC2LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x2B4F0LL, (int64_t)0xF845A30ELL, (int64_t)0x2E4C0F7ALL, (int64_t)0x102EED644LL, (int64_t)0x12D625928LL, (int64_t)0x12FE88FACLL, (int64_t)0x100123B6CLL, (int64_t)0x10C5699A4LL, (int64_t)0x106B1BDA4LL, (int64_t)0x2A7AD2460LL, (int64_t)0x10E87FA34LL, (int64_t)0x11B61619CLL, (int64_t)0x20894E5D8LL, (int64_t)0x100B086C8LL, (int64_t)0x1005EEF5CLL, (int64_t)0x15E3CD414LL, (int64_t)0x1085D51ACLL, (int64_t)0x1076A77FCLL, (int64_t)0x204B4C090LL, (int64_t)0x1022F589CLL, (int64_t)0x100E7F598LL, (int64_t)0x10182CB3CLL, (int64_t)0x111208CE8LL, (int64_t)0x1002528F0LL, (int64_t)0x13F5792F8LL, (int64_t)0x106DF7170LL, (int64_t)0x144E3B8E4LL, (int64_t)0x105AB8694LL, (int64_t)0x10583AD04LL, (int64_t)0x100675278LL, (int64_t)0x100DDDE70LL, (int64_t)0x1772BF37CLL, (int64_t)0x1028D9B5CLL, (int64_t)0x11AB5320CLL, (int64_t)0x103D584C0LL, (int64_t)0x12BF25298LL, (int64_t)0x1E01FD50CLL, (int64_t)0x101F7626CLL, (int64_t)0x102858B90LL, (int64_t)0x100616BB4LL, (int64_t)0x2A5E6BFF0LL, (int64_t)0x202AA2BB8LL, (int64_t)0x14ACD3554LL, (int64_t)0x10175AAB0LL, (int64_t)0x13A8B328CLL, (int64_t)0x3BF2DEA88LL, (int64_t)0x1589D2F1CLL, (int64_t)0x10CB53E94LL, (int64_t)0x107025374LL, (int64_t)0x3CC104DC8LL, (int64_t)0x100530C34LL, (int64_t)0x127B16298LL, (int64_t)0x101291364LL };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util::Check("Fixed64::PowFast", Fixed64::PowFast(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -849,7 +1066,7 @@ namespace UnitTest
 	{
 		static const int64_t input0[] = { (int64_t)0x35A0FF3LL, (int64_t)0x29ADLL, (int64_t)0xF767A498LL, (int64_t)0x872FELL, (int64_t)0x92DA700LL, (int64_t)0x4AA6LL, (int64_t)0xCF996LL, (int64_t)0xDA72C6DALL, (int64_t)0xB53D98LL, (int64_t)0x8D641201LL, (int64_t)0x20EELL, (int64_t)0x36907LL, (int64_t)0x5001C42ELL, (int64_t)0x5F969344LL, (int64_t)0x35CF847ALL, (int64_t)0xE587578LL, (int64_t)0x7BA1LL, (int64_t)0xD3846LL, (int64_t)0x100A4LL, (int64_t)0x37F845LL, (int64_t)0x59E6A7LL, (int64_t)0xA292DLL, (int64_t)0x3A5B081LL, (int64_t)0x197585LL, (int64_t)0x366BLL, (int64_t)0x3A21DLL, (int64_t)0x18BELL, (int64_t)0x201ALL, (int64_t)0x3517397LL, (int64_t)0x9E5B0FLL, (int64_t)0x2621LL, (int64_t)0xC8BFFE5FLL, (int64_t)0xA00A255LL, (int64_t)0xA3EC2134LL, (int64_t)0x15434189LL, (int64_t)0xD83C5LL, (int64_t)0x20597LL, (int64_t)0xF0F3E4LL, (int64_t)0x57F71B78LL, (int64_t)0x54DC53LL, (int64_t)0x186BLL, (int64_t)0x895CE2LL, (int64_t)0x7965DB4LL, (int64_t)0x1FC77LL, (int64_t)0x5A7665LL, (int64_t)0x724EC4LL, (int64_t)0xB321LL, (int64_t)0x183A5A1ELL, (int64_t)0x9382LL, (int64_t)0x3FC71LL, (int64_t)0x10E3DB477LL, (int64_t)0x1DB807235LL, (int64_t)0x75F699916LL, (int64_t)0x629FBD6CFLL, (int64_t)0x817A919DBLL, (int64_t)0x1EE13C528LL, (int64_t)0x13E6A22E1LL, (int64_t)0x10D393D16LL, (int64_t)0xD3100B80FLL, (int64_t)0x9777B4E94LL, (int64_t)0x6FD7B88C7LL, (int64_t)0xD1CC0265ALL, (int64_t)0x631C153BDLL, (int64_t)0x7652C1B13LL, (int64_t)0x2A2226738LL, (int64_t)0xB822AFA89LL, (int64_t)0x3720C8FB3LL, (int64_t)0xCA3CCB658LL, (int64_t)0x1E8F33E41LL, (int64_t)0x2DAC2E111LL, (int64_t)0x8B73F8308LL, (int64_t)0x1810AF2C8LL, (int64_t)0x83BCD064BLL, (int64_t)0x56D28F3A3LL, (int64_t)0x3E1E561E0LL, (int64_t)0xAE1B79B84LL, (int64_t)0x1DA97B5DELL, (int64_t)0x1052CCFDELL, (int64_t)0x1F1F0DA3ELL, (int64_t)0x874FE1DAFLL, (int64_t)0x7566B8A5BLL, (int64_t)0xB9B5EF1CFLL, (int64_t)0x14E1BC2B7LL, (int64_t)0x37EB20E04LL, (int64_t)0x44AA63CCBLL, (int64_t)0xBFD1C6473LL, (int64_t)0x3C4033C79LL, (int64_t)0x1E95073DALL, (int64_t)0x5CC8FDCDALL, (int64_t)0x475AE869DLL, (int64_t)0x36482463CLL, (int64_t)0x219380E00LL, (int64_t)0x36AA5CE4DLL, (int64_t)0x2D8127EA5LL, (int64_t)0x92011616ELL, (int64_t)0x14313A46FLL, (int64_t)0x111FF6459LL, (int64_t)0x55E00D381LL, (int64_t)0x156837B37LL, (int64_t)0x4B15F4918LL };
 		static const int64_t input1[] = { (int64_t)0x270029E2ALL, (int64_t)0x35DFDD49LL, (int64_t)0xFE743E41LL, (int64_t)0xC65CCF0LL, (int64_t)0x243ABEC1CLL, (int64_t)0x627EA31LL, (int64_t)0xA59F637LL, (int64_t)0x45947219LL, (int64_t)0x3962E5CLL, (int64_t)0x1A7D2130LL, (int64_t)0x90A218LL, (int64_t)0x71EE8BDLL, (int64_t)0x5264D23LL, (int64_t)0x4831B6LL, (int64_t)0x741363B4BLL, (int64_t)0x7E835ELL, (int64_t)0x2C757D2BLL, (int64_t)0xBF5BB3411LL, (int64_t)0xC07EF4LL, (int64_t)0x24B40BEFLL, (int64_t)0x3788F7B2LL, (int64_t)0x3B9855A4LL, (int64_t)0x18B69FEELL, (int64_t)0xD48F2E6ELL, (int64_t)0x18B44040LL, (int64_t)0xEC24D2926LL, (int64_t)0x768AE225LL, (int64_t)0x15131BD4LL, (int64_t)0x80F4A25A2LL, (int64_t)0x387AC079LL, (int64_t)0xD5718BLL, (int64_t)0x1D5443FLL, (int64_t)0x6B4099477LL, (int64_t)0xBF3DE36LL, (int64_t)0x22F1A99BFLL, (int64_t)0x2BD32EADLL, (int64_t)0x453C7A8LL, (int64_t)0xA588AE0LL, (int64_t)0x1A48525LL, (int64_t)0x23C68B46LL, (int64_t)0x49E9A3LL, (int64_t)0xDC15A7CALL, (int64_t)0x692399DLL, (int64_t)0x170224C9LL, (int64_t)0x13BE3B43LL, (int64_t)0xF0E8139FLL, (int64_t)0x30F261FLL, (int64_t)0x17516AB9FLL, (int64_t)0x824161CLL, (int64_t)0x17A110F9LL, (int64_t)0x1647F90LL, (int64_t)0x2994D9DLL, (int64_t)0x8377902LL, (int64_t)0xD18919CELL, (int64_t)0x1B4E6164LL, (int64_t)0x69F6F35DLL, (int64_t)0x6446B5BLL, (int64_t)0x8CA566LL, (int64_t)0xCF5504LL, (int64_t)0x7A67503DLL, (int64_t)0x487234LL, (int64_t)0x6B5F9BLL, (int64_t)0x37514A27LL, (int64_t)0xC66362LL, (int64_t)0x7BA341LL, (int64_t)0x485E5E12LL, (int64_t)0x504E52C0LL, (int64_t)0x110BE95LL, (int64_t)0xFE43BELL, (int64_t)0x5DD394ALL, (int64_t)0x423E785LL, (int64_t)0x11C7B1BLL, (int64_t)0x1C89BAFLL, (int64_t)0x1EF3B7EELL, (int64_t)0xA67D1786LL, (int64_t)0x8E40C70LL, (int64_t)0x2126482DLL, (int64_t)0x39E1F85LL, (int64_t)0x461E8D95LL, (int64_t)0x43570E6LL, (int64_t)0x52B7CFDDLL, (int64_t)0x121D443ELL, (int64_t)0x8247FDF5LL, (int64_t)0x1C8703E0LL, (int64_t)0x99C6FCDLL, (int64_t)0x39D96D5LL, (int64_t)0x395B6F9LL, (int64_t)0x9B7348LL, (int64_t)0x36384C50LL, (int64_t)0x174E2A9BLL, (int64_t)0x5183468LL, (int64_t)0x33ED510LL, (int64_t)0x680DAELL, (int64_t)0x2AB6536FLL, (int64_t)0x99A6798LL, (int64_t)0x34730BALL, (int64_t)0x7829197LL, (int64_t)0x1CE3C1ALL, (int64_t)0x1D5A30BLL, (int64_t)0xDF86D891LL };
-		static const int64_t output0[] = { (int64_t)0x1AF79LL, (int64_t)0x10EF1DA1LL, (int64_t)0xF7790EA8LL, (int64_t)0xA5E5555ALL, (int64_t)0x22F409LL, (int64_t)0xBE55C528LL, (int64_t)0xB552610CLL, (int64_t)0xF53785F0LL, (int64_t)0xEBBEBAE0LL, (int64_t)0xF0C55E46LL, (int64_t)0xF8B258D6LL, (int64_t)0xC2909702LL, (int64_t)0xFA17ABEELL, (int64_t)0xFFB9174CLL, (int64_t)0xCC72LL, (int64_t)0xFE954DE6LL, (int64_t)0x20E0B57BLL, (int64_t)0x0LL, (int64_t)0xF7D0095CLL, (int64_t)0x5CF3D7BCLL, (int64_t)0x3D453E6CLL, (int64_t)0x2139162ELL, (int64_t)0xA9CFB6C4LL, (int64_t)0x6081EFLL, (int64_t)0x4B9B5D3BLL, (int64_t)0x0LL, (int64_t)0x82B3DFLL, (int64_t)0x56969022LL, (int64_t)0x0LL, (int64_t)0x43C186FDLL, (int64_t)0xF5690C5ALL, (int64_t)0xFF8E4812LL, (int64_t)0x1LL, (int64_t)0xFABCE82ALL, (int64_t)0x11E0A63LL, (int64_t)0x3BE2E851LL, (int64_t)0xD6CA8522LL, (int64_t)0xCC1A7304LL, (int64_t)0xFE415E50LL, (int64_t)0x6514DDF7LL, (int64_t)0xFC284494LL, (int64_t)0x14650C7LL, (int64_t)0xE9EA6508LL, (int64_t)0x647DBE9DLL, (int64_t)0x9A0D8C6CLL, (int64_t)0xA63821LL, (int64_t)0xDF4A0BC8LL, (int64_t)0x83DD4C0LL, (int64_t)0xB0C5BC96LL, (int64_t)0x687FD5D1LL, (int64_t)0x100135DF0LL, (int64_t)0x1019E8A1CLL, (int64_t)0x110FB1E0CLL, (int64_t)0x46E696010LL, (int64_t)0x13FF2C270LL, (int64_t)0x1500C264CLL, (int64_t)0x101601810LL, (int64_t)0x100071B88LL, (int64_t)0x1021AA5C8LL, (int64_t)0x2EDD61FF0LL, (int64_t)0x1008D7A88LL, (int64_t)0x10115C9CCLL, (int64_t)0x17B9D4FCCLL, (int64_t)0x1018F6290LL, (int64_t)0x100783520LL, (int64_t)0x1FEB6AE3CLL, (int64_t)0x17958E838LL, (int64_t)0x102B9A3A4LL, (int64_t)0x100A54480LL, (int64_t)0x1063DCDE8LL, (int64_t)0x10924E70CLL, (int64_t)0x10074965CLL, (int64_t)0x103CC80C8LL, (int64_t)0x13A1384A8LL, (int64_t)0x26A867078LL, (int64_t)0x11627D9C8LL, (int64_t)0x11554DF30LL, (int64_t)0x1001298E8LL, (int64_t)0x1332C22CCLL, (int64_t)0x1092A9720LL, (int64_t)0x1E77A1208LL, (int64_t)0x1307F3D88LL, (int64_t)0x1252B6430LL, (int64_t)0x1265272DCLL, (int64_t)0x10E6AA710LL, (int64_t)0x109294F4CLL, (int64_t)0x104CF92ACLL, (int64_t)0x100651C20LL, (int64_t)0x1736D99D8LL, (int64_t)0x12557FE94LL, (int64_t)0x10650EDC8LL, (int64_t)0x1026C99A0LL, (int64_t)0x100806224LL, (int64_t)0x130C668F0LL, (int64_t)0x1162AB318LL, (int64_t)0x100C435B0LL, (int64_t)0x100832FF4LL, (int64_t)0x1030F99E4LL, (int64_t)0x100894DA4LL, (int64_t)0x3DB839640LL };
+		static const int64_t output0[] = { (int64_t)0x1AF77LL, (int64_t)0x10EF1FE4LL, (int64_t)0xF7790F3CLL, (int64_t)0xA5E5551ELL, (int64_t)0x22F41FLL, (int64_t)0xBE55C6C6LL, (int64_t)0xB5525D78LL, (int64_t)0xF5375CC2LL, (int64_t)0xEBBEBC24LL, (int64_t)0xF0C56102LL, (int64_t)0xF8B258D0LL, (int64_t)0xC29093A8LL, (int64_t)0xFA17AEEELL, (int64_t)0xFFB91750LL, (int64_t)0xCC6FLL, (int64_t)0xFE954DA8LL, (int64_t)0x20E0B57ALL, (int64_t)0x0LL, (int64_t)0xF7D0095ALL, (int64_t)0x5CF3CFE9LL, (int64_t)0x3D45441ALL, (int64_t)0x21391B00LL, (int64_t)0xA9CFB066LL, (int64_t)0x6081D0LL, (int64_t)0x4B9B58BBLL, (int64_t)0x0LL, (int64_t)0x82B3D3LL, (int64_t)0x5696900FLL, (int64_t)0x0LL, (int64_t)0x43C18F8BLL, (int64_t)0xF5690CB8LL, (int64_t)0xFF8E4788LL, (int64_t)0x1LL, (int64_t)0xFABCEF88LL, (int64_t)0x11E0BE2LL, (int64_t)0x3BE2E209LL, (int64_t)0xD6CA8506LL, (int64_t)0xCC1A71B0LL, (int64_t)0xFE415F2ELL, (int64_t)0x6514E6B3LL, (int64_t)0xFC28448CLL, (int64_t)0x14650C9LL, (int64_t)0xE9EA6464LL, (int64_t)0x647DBEEBLL, (int64_t)0x9A0D9120LL, (int64_t)0xA637D2LL, (int64_t)0xDF4A0CFALL, (int64_t)0x83DD41FLL, (int64_t)0xB0C5BE44LL, (int64_t)0x687FD600LL, (int64_t)0x100135DE8LL, (int64_t)0x1019E8970LL, (int64_t)0x110FB1B48LL, (int64_t)0x46E68BC20LL, (int64_t)0x13FF2C164LL, (int64_t)0x1500C25B0LL, (int64_t)0x101601BC4LL, (int64_t)0x100071B84LL, (int64_t)0x1021AA554LL, (int64_t)0x2EDD6B540LL, (int64_t)0x1008D7A5CLL, (int64_t)0x10115C994LL, (int64_t)0x17B9D3E7CLL, (int64_t)0x1018F6254LL, (int64_t)0x100783570LL, (int64_t)0x1FEB6D8E0LL, (int64_t)0x179589F78LL, (int64_t)0x102B9A348LL, (int64_t)0x100A54470LL, (int64_t)0x1063DCFFCLL, (int64_t)0x10924E748LL, (int64_t)0x10074965CLL, (int64_t)0x103CC80B0LL, (int64_t)0x13A139A30LL, (int64_t)0x26A8678A0LL, (int64_t)0x11627DF30LL, (int64_t)0x11554D55CLL, (int64_t)0x1001298BCLL, (int64_t)0x1332C2514LL, (int64_t)0x1092A9704LL, (int64_t)0x1E779DB24LL, (int64_t)0x1307F42C0LL, (int64_t)0x1252BC290LL, (int64_t)0x126525F8CLL, (int64_t)0x10E6AA724LL, (int64_t)0x109294F60LL, (int64_t)0x104CF9214LL, (int64_t)0x100651C18LL, (int64_t)0x1736DAD58LL, (int64_t)0x12558028CLL, (int64_t)0x10650EA8CLL, (int64_t)0x1026C9980LL, (int64_t)0x1008061E4LL, (int64_t)0x130C67B68LL, (int64_t)0x1162AB5B8LL, (int64_t)0x100C437B8LL, (int64_t)0x100832FF8LL, (int64_t)0x1030F9AF8LL, (int64_t)0x100894EC0LL, (int64_t)0x3DB84DCB0LL };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util::Check("Fixed64::PowFastest", Fixed64::PowFastest(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -859,7 +1076,7 @@ namespace UnitTest
 	{
 		static const int32_t input0[] = { (int32_t)0x7, (int32_t)0x28BE, (int32_t)0xF0, (int32_t)0x1399, (int32_t)0xC7, (int32_t)0x27A, (int32_t)0x3F8, (int32_t)0x0, (int32_t)0x0, (int32_t)0xC7, (int32_t)0x23, (int32_t)0x10, (int32_t)0x16, (int32_t)0x33A2, (int32_t)0x0, (int32_t)0x0, (int32_t)0xD28F, (int32_t)0xBD8, (int32_t)0x6, (int32_t)0x3C, (int32_t)0x25C, (int32_t)0x0, (int32_t)0x0, (int32_t)0x65D, (int32_t)0x0, (int32_t)0x1, (int32_t)0x16, (int32_t)0x876, (int32_t)0x0, (int32_t)0x1F9, (int32_t)0x0, (int32_t)0x68, (int32_t)0x1F4, (int32_t)0x420, (int32_t)0x18A, (int32_t)0x48, (int32_t)0x0, (int32_t)0x2596, (int32_t)0x4CC, (int32_t)0x0, (int32_t)0xF, (int32_t)0x552, (int32_t)0xA438, (int32_t)0x0, (int32_t)0x1, (int32_t)0x2738, (int32_t)0xAFA, (int32_t)0x7, (int32_t)0x6651, (int32_t)0x1, (int32_t)0x15CAC, (int32_t)0x12621, (int32_t)0x145A5, (int32_t)0x20738, (int32_t)0x23A8D, (int32_t)0x50439, (int32_t)0x49189, (int32_t)0x32BA4, (int32_t)0x34D4B, (int32_t)0x128FC, (int32_t)0x1EE87, (int32_t)0x4C4BF, (int32_t)0x2CD4F, (int32_t)0x31D1E, (int32_t)0xE0CE3, (int32_t)0x19094, (int32_t)0x16AAD, (int32_t)0x10961, (int32_t)0x40C0E, (int32_t)0x102FD, (int32_t)0x14B9F, (int32_t)0x5D29A, (int32_t)0x10B2E, (int32_t)0xD3023, (int32_t)0xAD071, (int32_t)0x69789, (int32_t)0xDAC3B, (int32_t)0x7A7E6, (int32_t)0x3D050, (int32_t)0x60E01, (int32_t)0x1CABB, (int32_t)0x48C9A, (int32_t)0x4AAF0, (int32_t)0x19914, (int32_t)0x18D6B, (int32_t)0x2D974, (int32_t)0xFBDAE, (int32_t)0x4C89D, (int32_t)0x6B738, (int32_t)0x2B63B, (int32_t)0xD4FAB, (int32_t)0x322C2, (int32_t)0x6B584, (int32_t)0x61D03, (int32_t)0x1454F, (int32_t)0x20943, (int32_t)0xB3488, (int32_t)0x87F48, (int32_t)0x2DA67, (int32_t)0x5FA1C };
 		static const int32_t input1[] = { (int32_t)0x1178A, (int32_t)0x6F3C, (int32_t)0x11496, (int32_t)0x30A2, (int32_t)0x12F8DB, (int32_t)0x54D, (int32_t)0xE8BE, (int32_t)0x513F0, (int32_t)0xD6AA, (int32_t)0xB20, (int32_t)0x2D2, (int32_t)0xBA003, (int32_t)0x11EBF2, (int32_t)0x1525, (int32_t)0x1F71, (int32_t)0x9367C, (int32_t)0x1BA89, (int32_t)0x1462E, (int32_t)0x32C, (int32_t)0xD438, (int32_t)0x95BC4, (int32_t)0xE1, (int32_t)0x7D, (int32_t)0x47C, (int32_t)0xAE, (int32_t)0xB2976, (int32_t)0x81, (int32_t)0xE0, (int32_t)0x20C7, (int32_t)0x3B6, (int32_t)0x11B3, (int32_t)0x92, (int32_t)0x35993, (int32_t)0xFC27D, (int32_t)0xB343B, (int32_t)0x1E2A, (int32_t)0x3A7AE, (int32_t)0xD1, (int32_t)0x117FD, (int32_t)0x654, (int32_t)0x35BEB, (int32_t)0x2D8, (int32_t)0x18B, (int32_t)0x6CE, (int32_t)0x2F037, (int32_t)0x15F2, (int32_t)0x163BF, (int32_t)0x2D16, (int32_t)0x4793, (int32_t)0x624, (int32_t)0x265, (int32_t)0x246E, (int32_t)0x4A, (int32_t)0xCA6, (int32_t)0x13B, (int32_t)0x6DB, (int32_t)0x53, (int32_t)0xC1, (int32_t)0x3F4, (int32_t)0x112C, (int32_t)0x150D, (int32_t)0x46BB, (int32_t)0xA191, (int32_t)0x3884, (int32_t)0x56A7, (int32_t)0x1E4C, (int32_t)0x45, (int32_t)0x109, (int32_t)0x173, (int32_t)0xDA2, (int32_t)0xD0, (int32_t)0xC58, (int32_t)0x26F, (int32_t)0xB1, (int32_t)0x6A, (int32_t)0x1C4A, (int32_t)0xB3DA, (int32_t)0x321, (int32_t)0x5711, (int32_t)0x1067, (int32_t)0x4443, (int32_t)0xD6, (int32_t)0x2FE, (int32_t)0x5393, (int32_t)0x26D, (int32_t)0x7B1, (int32_t)0x9DA, (int32_t)0xF0A5, (int32_t)0xAAE8, (int32_t)0x1C94, (int32_t)0x2BC, (int32_t)0x5361, (int32_t)0xD1, (int32_t)0x70, (int32_t)0x2560, (int32_t)0x95, (int32_t)0x6FE, (int32_t)0x8502, (int32_t)0x44CF, (int32_t)0x3ED };
-		static const int32_t output0[] = { (int32_t)0x3, (int32_t)0x7330, (int32_t)0x98, (int32_t)0x9D1D, (int32_t)0x0, (int32_t)0xE88D, (int32_t)0x5CB, (int32_t)0x0, (int32_t)0x0, (int32_t)0xC6FD, (int32_t)0xEB9A, (int32_t)0x0, (int32_t)0x0, (int32_t)0xE049, (int32_t)0x0, (int32_t)0x0, (int32_t)0xB69C, (int32_t)0x519, (int32_t)0xE423, (int32_t)0xC6, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xEFF4, (int32_t)0x0, (int32_t)0x0, (int32_t)0xFBFF, (int32_t)0xFD07, (int32_t)0x0, (int32_t)0xEE90, (int32_t)0x0, (int32_t)0xFC58, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x72B3, (int32_t)0x0, (int32_t)0xFE6F, (int32_t)0x34D, (int32_t)0x0, (int32_t)0x0, (int32_t)0xF536, (int32_t)0xFF50, (int32_t)0x0, (int32_t)0x0, (int32_t)0xD9F7, (int32_t)0x337, (int32_t)0x3325, (int32_t)0xC618, (int32_t)0xC433, (int32_t)0x100BC, (int32_t)0x1051A, (int32_t)0x10010, (int32_t)0x10919, (int32_t)0x100FC, (int32_t)0x10B4B, (int32_t)0x1007D, (int32_t)0x100DE, (int32_t)0x104C2, (int32_t)0x1028E, (int32_t)0x10E3D, (int32_t)0x18A26, (int32_t)0x1EA80, (int32_t)0x148F4, (int32_t)0x27230, (int32_t)0x10DED, (int32_t)0x10017, (int32_t)0x10008, (int32_t)0x10207, (int32_t)0x10027, (int32_t)0x10034, (int32_t)0x116B1, (int32_t)0x10019, (int32_t)0x101C8, (int32_t)0x100FC, (int32_t)0x13B4F, (int32_t)0x647C1, (int32_t)0x10672, (int32_t)0x19398, (int32_t)0x11F4E, (int32_t)0x12B12, (int32_t)0x10144, (int32_t)0x104A6, (int32_t)0x12A53, (int32_t)0x10110, (int32_t)0x1082D, (int32_t)0x11CA4, (int32_t)0x45AD6, (int32_t)0x390D6, (int32_t)0x11E27, (int32_t)0x1072D, (int32_t)0x17370, (int32_t)0x1018D, (int32_t)0x100CA, (int32_t)0x1091C, (int32_t)0x10068, (int32_t)0x11176, (int32_t)0x30A1C, (int32_t)0x15353, (int32_t)0x1071C };
+		static const int32_t output0[] = { (int32_t)0x3, (int32_t)0x7330, (int32_t)0x98, (int32_t)0x9D1E, (int32_t)0x0, (int32_t)0xE88E, (int32_t)0x5CB, (int32_t)0x0, (int32_t)0x0, (int32_t)0xC6FD, (int32_t)0xEB9B, (int32_t)0x0, (int32_t)0x0, (int32_t)0xE04A, (int32_t)0x0, (int32_t)0x0, (int32_t)0xB69D, (int32_t)0x519, (int32_t)0xE424, (int32_t)0xC6, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xEFF4, (int32_t)0x0, (int32_t)0x0, (int32_t)0xFC00, (int32_t)0xFD08, (int32_t)0x0, (int32_t)0xEE90, (int32_t)0x0, (int32_t)0xFC59, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x72B3, (int32_t)0x0, (int32_t)0xFE70, (int32_t)0x34D, (int32_t)0x0, (int32_t)0x0, (int32_t)0xF537, (int32_t)0xFF50, (int32_t)0x0, (int32_t)0x0, (int32_t)0xD9F8, (int32_t)0x337, (int32_t)0x3325, (int32_t)0xC619, (int32_t)0xC434, (int32_t)0x100BD, (int32_t)0x1051B, (int32_t)0x10011, (int32_t)0x1091A, (int32_t)0x100FC, (int32_t)0x10B4C, (int32_t)0x1007E, (int32_t)0x100DF, (int32_t)0x104C4, (int32_t)0x10290, (int32_t)0x10E3E, (int32_t)0x18A28, (int32_t)0x1EA81, (int32_t)0x148F4, (int32_t)0x27234, (int32_t)0x10DEE, (int32_t)0x10018, (int32_t)0x10009, (int32_t)0x10208, (int32_t)0x10028, (int32_t)0x10035, (int32_t)0x116B2, (int32_t)0x1001A, (int32_t)0x101CA, (int32_t)0x100FC, (int32_t)0x13B50, (int32_t)0x647CB, (int32_t)0x10672, (int32_t)0x1939B, (int32_t)0x11F4F, (int32_t)0x12B14, (int32_t)0x10145, (int32_t)0x104A6, (int32_t)0x12A54, (int32_t)0x10111, (int32_t)0x1082E, (int32_t)0x11CA5, (int32_t)0x45ADF, (int32_t)0x390DE, (int32_t)0x11E28, (int32_t)0x1072D, (int32_t)0x17372, (int32_t)0x1018F, (int32_t)0x100CB, (int32_t)0x1091D, (int32_t)0x1006A, (int32_t)0x11177, (int32_t)0x30A23, (int32_t)0x15354, (int32_t)0x1071D };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util::Check("Fixed32::Pow", Fixed32::Pow(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -869,7 +1086,7 @@ namespace UnitTest
 	{
 		static const int32_t input0[] = { (int32_t)0x70E, (int32_t)0x4, (int32_t)0x17B, (int32_t)0xF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x1, (int32_t)0x15, (int32_t)0x5, (int32_t)0x3C1, (int32_t)0x1DC0, (int32_t)0x0, (int32_t)0x1, (int32_t)0x22, (int32_t)0x4319, (int32_t)0xCD, (int32_t)0x4452, (int32_t)0x3C, (int32_t)0x1AF2, (int32_t)0x461, (int32_t)0x4B90, (int32_t)0x0, (int32_t)0x156, (int32_t)0xA, (int32_t)0x14, (int32_t)0x95, (int32_t)0x1D20, (int32_t)0x5, (int32_t)0x5, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x67A8, (int32_t)0x4B6, (int32_t)0x4E, (int32_t)0xB2AC, (int32_t)0x0, (int32_t)0x2, (int32_t)0x0, (int32_t)0x1B, (int32_t)0x3, (int32_t)0x153, (int32_t)0xF8BC, (int32_t)0xF7, (int32_t)0x0, (int32_t)0x39, (int32_t)0x1C, (int32_t)0xEB, (int32_t)0xD784, (int32_t)0x30895, (int32_t)0x29D6D, (int32_t)0xC7C7D, (int32_t)0x61B66, (int32_t)0x12D05, (int32_t)0x14E46, (int32_t)0x1B255, (int32_t)0xD1323, (int32_t)0xEB446, (int32_t)0xB4A10, (int32_t)0x46AD4, (int32_t)0x15588, (int32_t)0xF4F71, (int32_t)0x9EFB5, (int32_t)0x7737E, (int32_t)0x3B91A, (int32_t)0x1422A, (int32_t)0x4E635, (int32_t)0x29056, (int32_t)0x116A0, (int32_t)0x67E70, (int32_t)0x13969, (int32_t)0x40685, (int32_t)0x5FE87, (int32_t)0x5CCDC, (int32_t)0xE6D34, (int32_t)0x2ABFF, (int32_t)0x103E8, (int32_t)0xC4361, (int32_t)0x249A8, (int32_t)0x1203F, (int32_t)0x89853, (int32_t)0x2C481, (int32_t)0xDD439, (int32_t)0x91787, (int32_t)0x4F9BD, (int32_t)0x1CAB6, (int32_t)0x53E1C, (int32_t)0x22C75, (int32_t)0x65910, (int32_t)0x11EBA, (int32_t)0xCC1D3, (int32_t)0x7954E, (int32_t)0x8673E, (int32_t)0x29D61, (int32_t)0x1C008, (int32_t)0xF3C3E, (int32_t)0x222AB, (int32_t)0xC21F5, (int32_t)0x11115 };
 		static const int32_t input1[] = { (int32_t)0x3CE3, (int32_t)0x3632F, (int32_t)0x6A2, (int32_t)0xA10, (int32_t)0x4A4, (int32_t)0x3A7BD, (int32_t)0x1FC, (int32_t)0x46, (int32_t)0x53, (int32_t)0x9F91, (int32_t)0x5CCE, (int32_t)0x6EE, (int32_t)0x85560, (int32_t)0xB4, (int32_t)0x36E, (int32_t)0x2C3F, (int32_t)0x21DDB, (int32_t)0x111, (int32_t)0x2FF1, (int32_t)0xB0667, (int32_t)0x9E94A, (int32_t)0x177A, (int32_t)0x833C, (int32_t)0xDA5, (int32_t)0xD9C, (int32_t)0x1021, (int32_t)0x4A4, (int32_t)0xB5, (int32_t)0x52, (int32_t)0x1CA, (int32_t)0x98E03, (int32_t)0xD9, (int32_t)0x30C, (int32_t)0x74F, (int32_t)0x1E8AF, (int32_t)0x289, (int32_t)0x45469, (int32_t)0x10707, (int32_t)0x93AE, (int32_t)0x63E94, (int32_t)0x54A, (int32_t)0xE586A, (int32_t)0xB3, (int32_t)0x7C51, (int32_t)0x234A, (int32_t)0xB5, (int32_t)0xA8F, (int32_t)0x2AB9, (int32_t)0x1761C, (int32_t)0x8B, (int32_t)0x4B, (int32_t)0x4166, (int32_t)0xDE, (int32_t)0x216C, (int32_t)0x417, (int32_t)0x274, (int32_t)0x5763, (int32_t)0x197, (int32_t)0x4A, (int32_t)0x7E, (int32_t)0x2B01, (int32_t)0xEB, (int32_t)0x4C, (int32_t)0x1A63, (int32_t)0x4FE5, (int32_t)0x30C0, (int32_t)0x298F, (int32_t)0x54, (int32_t)0x51, (int32_t)0xB3, (int32_t)0x195, (int32_t)0x750, (int32_t)0x1F0, (int32_t)0x1ABE, (int32_t)0xEE5B, (int32_t)0x2F9A, (int32_t)0x2B9, (int32_t)0x28EA, (int32_t)0x205, (int32_t)0x511, (int32_t)0xDF78, (int32_t)0x72, (int32_t)0x87, (int32_t)0x7056, (int32_t)0x1C1, (int32_t)0x158, (int32_t)0x1002, (int32_t)0x18C5, (int32_t)0xB22, (int32_t)0x687, (int32_t)0x28D8, (int32_t)0xAFEA, (int32_t)0xDF8, (int32_t)0xEA, (int32_t)0x984A, (int32_t)0x5E79, (int32_t)0x7C1D, (int32_t)0x62, (int32_t)0xA4E1, (int32_t)0xEBD };
-		static const int32_t output0[] = { (int32_t)0x6CF5, (int32_t)0x0, (int32_t)0xE000, (int32_t)0xB823, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xFCFB, (int32_t)0xFD67, (int32_t)0xB1, (int32_t)0x3765, (int32_t)0xF182, (int32_t)0x0, (int32_t)0xF850, (int32_t)0xE753, (int32_t)0xCB1B, (int32_t)0x0, (int32_t)0xFE97, (int32_t)0x4510, (int32_t)0x0, (int32_t)0x0, (int32_t)0xE4E5, (int32_t)0x0, (int32_t)0xC174, (int32_t)0xA074, (int32_t)0x99BA, (int32_t)0xE541, (int32_t)0xFE76, (int32_t)0xFCFA, (int32_t)0xEF95, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xF979, (int32_t)0x1F, (int32_t)0xEF7B, (int32_t)0x35F3, (int32_t)0x0, (int32_t)0xA2, (int32_t)0x0, (int32_t)0xD9EB, (int32_t)0x0, (int32_t)0xFC57, (int32_t)0xFC71, (int32_t)0x769C, (int32_t)0x0, (int32_t)0xBF6D, (int32_t)0x4623, (int32_t)0x11, (int32_t)0xFFE7, (int32_t)0x10052, (int32_t)0x1473F, (int32_t)0x10231, (int32_t)0x14436, (int32_t)0x100A8, (int32_t)0x100A6, (int32_t)0x1329E, (int32_t)0x1041E, (int32_t)0x100C5, (int32_t)0x10131, (int32_t)0x1488E, (int32_t)0x10042, (int32_t)0x100CE, (int32_t)0x1445B, (int32_t)0x1DF1F, (int32_t)0x148D0, (int32_t)0x109BA, (int32_t)0x10084, (int32_t)0x1004B, (int32_t)0x1000E, (int32_t)0x102F9, (int32_t)0x1017A, (int32_t)0x102B5, (int32_t)0x134A7, (int32_t)0x52363, (int32_t)0x1A481, (int32_t)0x102AE, (int32_t)0x1009D, (int32_t)0x1051B, (int32_t)0x10439, (int32_t)0x11BED, (int32_t)0x100F5, (int32_t)0x10088, (int32_t)0x32AA1, (int32_t)0x103E5, (int32_t)0x10228, (int32_t)0x10981, (int32_t)0x12C81, (int32_t)0x108C9, (int32_t)0x10C59, (int32_t)0x104AB, (int32_t)0x5C086, (int32_t)0x11DEA, (int32_t)0x101F3, (int32_t)0x1C57A, (int32_t)0x13AB9, (int32_t)0x3BEBC, (int32_t)0x10049, (int32_t)0x4FD7D, (int32_t)0x100F3 };
+		static const int32_t output0[] = { (int32_t)0x6CF5, (int32_t)0x0, (int32_t)0xE001, (int32_t)0xB823, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xFCFC, (int32_t)0xFD67, (int32_t)0xB1, (int32_t)0x3765, (int32_t)0xF183, (int32_t)0x0, (int32_t)0xF852, (int32_t)0xE754, (int32_t)0xCB1B, (int32_t)0x0, (int32_t)0xFE98, (int32_t)0x4510, (int32_t)0x0, (int32_t)0x0, (int32_t)0xE4E6, (int32_t)0x0, (int32_t)0xC175, (int32_t)0xA074, (int32_t)0x99BA, (int32_t)0xE542, (int32_t)0xFE77, (int32_t)0xFCFB, (int32_t)0xEF96, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xF97A, (int32_t)0x1F, (int32_t)0xEF7C, (int32_t)0x35F3, (int32_t)0x0, (int32_t)0xA2, (int32_t)0x0, (int32_t)0xD9EC, (int32_t)0x0, (int32_t)0xFC58, (int32_t)0xFC72, (int32_t)0x769C, (int32_t)0x0, (int32_t)0xBF6D, (int32_t)0x4623, (int32_t)0x11, (int32_t)0xFFE8, (int32_t)0x10053, (int32_t)0x14741, (int32_t)0x10232, (int32_t)0x14437, (int32_t)0x100A9, (int32_t)0x100A7, (int32_t)0x132A0, (int32_t)0x1041E, (int32_t)0x100C7, (int32_t)0x10132, (int32_t)0x1488F, (int32_t)0x10043, (int32_t)0x100CF, (int32_t)0x1445C, (int32_t)0x1DF20, (int32_t)0x148D1, (int32_t)0x109BB, (int32_t)0x10085, (int32_t)0x1004C, (int32_t)0x1000F, (int32_t)0x102F9, (int32_t)0x1017B, (int32_t)0x102B6, (int32_t)0x134A9, (int32_t)0x5236D, (int32_t)0x1A482, (int32_t)0x102B0, (int32_t)0x1009E, (int32_t)0x1051C, (int32_t)0x1043A, (int32_t)0x11BEE, (int32_t)0x100F5, (int32_t)0x10089, (int32_t)0x32AA5, (int32_t)0x103E6, (int32_t)0x1022A, (int32_t)0x10982, (int32_t)0x12C83, (int32_t)0x108CA, (int32_t)0x10C59, (int32_t)0x104AB, (int32_t)0x5C08F, (int32_t)0x11DEC, (int32_t)0x101F3, (int32_t)0x1C57B, (int32_t)0x13ABB, (int32_t)0x3BEC1, (int32_t)0x1004A, (int32_t)0x4FD88, (int32_t)0x100F4 };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util::Check("Fixed32::PowFast", Fixed32::PowFast(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -879,11 +1096,173 @@ namespace UnitTest
 	{
 		static const int32_t input0[] = { (int32_t)0xA4, (int32_t)0x0, (int32_t)0x2E, (int32_t)0xA, (int32_t)0xB, (int32_t)0x1, (int32_t)0x896A, (int32_t)0x0, (int32_t)0x13, (int32_t)0x1A1, (int32_t)0x21, (int32_t)0x239, (int32_t)0x0, (int32_t)0xB, (int32_t)0xC4, (int32_t)0x57F, (int32_t)0x0, (int32_t)0x0, (int32_t)0x420, (int32_t)0x270B, (int32_t)0x9ACA, (int32_t)0x4F7, (int32_t)0x5, (int32_t)0x1CA, (int32_t)0x10, (int32_t)0x22B, (int32_t)0x0, (int32_t)0x18, (int32_t)0x2A, (int32_t)0x11AC, (int32_t)0x1, (int32_t)0x0, (int32_t)0x72, (int32_t)0x8, (int32_t)0x7, (int32_t)0x0, (int32_t)0x1FC, (int32_t)0x6F, (int32_t)0x1BB3, (int32_t)0x0, (int32_t)0x83, (int32_t)0x3, (int32_t)0x2, (int32_t)0xA, (int32_t)0x187E, (int32_t)0x13, (int32_t)0x21, (int32_t)0x581, (int32_t)0x8C59, (int32_t)0x94, (int32_t)0x2430C, (int32_t)0x7120E, (int32_t)0x6BA58, (int32_t)0x48FDB, (int32_t)0x3D801, (int32_t)0x4DAA2, (int32_t)0x4E3C9, (int32_t)0x2B831, (int32_t)0x3A6C4, (int32_t)0x7B223, (int32_t)0x324A2, (int32_t)0x8304E, (int32_t)0x110CD, (int32_t)0xEE230, (int32_t)0x42B7E, (int32_t)0x65291, (int32_t)0x129EB, (int32_t)0x7F96D, (int32_t)0xD6C25, (int32_t)0x1149F, (int32_t)0x2B70A, (int32_t)0x2B050, (int32_t)0x98A9A, (int32_t)0x48B59, (int32_t)0xDE67C, (int32_t)0x20CD0, (int32_t)0xFB33F, (int32_t)0x156B4, (int32_t)0x582C4, (int32_t)0x23B20, (int32_t)0x12DD1, (int32_t)0x8706B, (int32_t)0x10A25, (int32_t)0x302B1, (int32_t)0x6E1D9, (int32_t)0x3F6EE, (int32_t)0x79DEF, (int32_t)0xCFA2A, (int32_t)0x33CD2, (int32_t)0x1514C, (int32_t)0xA0309, (int32_t)0x6E280, (int32_t)0x24011, (int32_t)0x1BA88, (int32_t)0x13B9C, (int32_t)0x6FDE1, (int32_t)0x8FB94, (int32_t)0x54881, (int32_t)0x560DB, (int32_t)0x2887F };
 		static const int32_t input1[] = { (int32_t)0xFF, (int32_t)0x2BE88, (int32_t)0xFE3AA, (int32_t)0x2463A, (int32_t)0x1022, (int32_t)0x49EBE, (int32_t)0x12389, (int32_t)0x3D9B2, (int32_t)0xE0119, (int32_t)0x13747, (int32_t)0x98, (int32_t)0x2F1B, (int32_t)0xAD74, (int32_t)0x6757, (int32_t)0x1255, (int32_t)0xFE6, (int32_t)0xCF, (int32_t)0x1A1DC, (int32_t)0x5C, (int32_t)0xEB6, (int32_t)0x87, (int32_t)0x469A, (int32_t)0x26C, (int32_t)0x721F, (int32_t)0x5B3, (int32_t)0xDC63, (int32_t)0x13C9, (int32_t)0xC75F6, (int32_t)0x31173, (int32_t)0x122205, (int32_t)0x1E5, (int32_t)0x105E, (int32_t)0x1B68, (int32_t)0x82689, (int32_t)0xC18B, (int32_t)0xDE6, (int32_t)0x72, (int32_t)0x1D9AA, (int32_t)0xA5837, (int32_t)0x2052, (int32_t)0x1851, (int32_t)0x33148, (int32_t)0x4B8A, (int32_t)0xDA, (int32_t)0x41, (int32_t)0x53, (int32_t)0x7A66, (int32_t)0xC268, (int32_t)0xAD86C, (int32_t)0xF53, (int32_t)0xCF02, (int32_t)0x6B54, (int32_t)0x2880, (int32_t)0x89BA, (int32_t)0x5E, (int32_t)0xA66B, (int32_t)0x7953, (int32_t)0xAE, (int32_t)0xFF2, (int32_t)0x139, (int32_t)0xDBE, (int32_t)0x674, (int32_t)0x2C0F, (int32_t)0xDF, (int32_t)0x1B6C, (int32_t)0x15DB, (int32_t)0x2BCB, (int32_t)0x1341, (int32_t)0x1BF, (int32_t)0x4A, (int32_t)0xA0F4, (int32_t)0xA1, (int32_t)0x26B, (int32_t)0x5321, (int32_t)0xFF, (int32_t)0x1933, (int32_t)0x66, (int32_t)0x120E, (int32_t)0x69A, (int32_t)0x16B, (int32_t)0x673, (int32_t)0x3DC, (int32_t)0x801, (int32_t)0x1C6, (int32_t)0x256, (int32_t)0xEB, (int32_t)0x54, (int32_t)0x86, (int32_t)0x2C4, (int32_t)0x3021, (int32_t)0x10B5, (int32_t)0xF27, (int32_t)0x270, (int32_t)0xFF, (int32_t)0x97A, (int32_t)0x328, (int32_t)0xB5F6, (int32_t)0x90, (int32_t)0x958, (int32_t)0x50D };
-		static const int32_t output0[] = { (int32_t)0xFA1C, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x9408, (int32_t)0x0, (int32_t)0x7E0C, (int32_t)0x0, (int32_t)0x0, (int32_t)0x8B, (int32_t)0xFB89, (int32_t)0x6AE5, (int32_t)0x0, (int32_t)0x7A9, (int32_t)0xA8D3, (int32_t)0xC9AA, (int32_t)0x0, (int32_t)0x0, (int32_t)0xFE85, (int32_t)0xE5CC, (int32_t)0xFFBB, (int32_t)0x564A, (int32_t)0xEA0E, (int32_t)0x1C03, (int32_t)0xD4BB, (int32_t)0x435, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xEBD9, (int32_t)0x0, (int32_t)0x81AA, (int32_t)0x0, (int32_t)0x41, (int32_t)0x0, (int32_t)0xFDD8, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x8DDE, (int32_t)0x0, (int32_t)0xBE8, (int32_t)0xF8A2, (int32_t)0xFF67, (int32_t)0xFD5F, (int32_t)0x6C8, (int32_t)0xDDD, (int32_t)0x60, (int32_t)0xB1BD, (int32_t)0x1EF56, (int32_t)0x2454B, (int32_t)0x15A12, (int32_t)0x24347, (int32_t)0x1007D, (int32_t)0x2CAD7, (int32_t)0x21F2F, (int32_t)0x100AE, (int32_t)0x11588, (int32_t)0x10282, (int32_t)0x11041, (int32_t)0x10DF5, (int32_t)0x102D1, (int32_t)0x1025E, (int32_t)0x12A50, (int32_t)0x12BA7, (int32_t)0x106BE, (int32_t)0x12B45, (int32_t)0x10495, (int32_t)0x10004, (int32_t)0x1DFB8, (int32_t)0x1009F, (int32_t)0x10586, (int32_t)0x1A28A, (int32_t)0x102A4, (int32_t)0x112C4, (int32_t)0x10118, (int32_t)0x10555, (int32_t)0x10B8A, (int32_t)0x10123, (int32_t)0x1010F, (int32_t)0x10861, (int32_t)0x1004E, (int32_t)0x101F7, (int32_t)0x1048E, (int32_t)0x10144, (int32_t)0x100AA, (int32_t)0x10158, (int32_t)0x10346, (int32_t)0x10DA4, (int32_t)0x1298A, (int32_t)0x11EFC, (int32_t)0x101FD, (int32_t)0x1008B, (int32_t)0x101FE, (int32_t)0x10639, (int32_t)0x4C2BE, (int32_t)0x100EF, (int32_t)0x1103C, (int32_t)0x104BE };
+		static const int32_t output0[] = { (int32_t)0xFA1D, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x9408, (int32_t)0x0, (int32_t)0x7E0C, (int32_t)0x0, (int32_t)0x0, (int32_t)0x8B, (int32_t)0xFB8A, (int32_t)0x6AE5, (int32_t)0x0, (int32_t)0x7A9, (int32_t)0xA8D3, (int32_t)0xC9AA, (int32_t)0x0, (int32_t)0x0, (int32_t)0xFE86, (int32_t)0xE5CD, (int32_t)0xFFBC, (int32_t)0x564A, (int32_t)0xEA0F, (int32_t)0x1C02, (int32_t)0xD4BC, (int32_t)0x435, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xEBDA, (int32_t)0x0, (int32_t)0x81AA, (int32_t)0x0, (int32_t)0x41, (int32_t)0x0, (int32_t)0xFDD9, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x8DDE, (int32_t)0x0, (int32_t)0xBE8, (int32_t)0xF8A3, (int32_t)0xFF68, (int32_t)0xFD60, (int32_t)0x6C8, (int32_t)0xDDD, (int32_t)0x60, (int32_t)0xB1BE, (int32_t)0x1EF59, (int32_t)0x2454E, (int32_t)0x15A13, (int32_t)0x24349, (int32_t)0x1007F, (int32_t)0x2CADA, (int32_t)0x21F32, (int32_t)0x100AE, (int32_t)0x11589, (int32_t)0x10283, (int32_t)0x11042, (int32_t)0x10DF6, (int32_t)0x102D3, (int32_t)0x1025E, (int32_t)0x12A51, (int32_t)0x12BA8, (int32_t)0x106BE, (int32_t)0x12B46, (int32_t)0x10496, (int32_t)0x10005, (int32_t)0x1DFBB, (int32_t)0x1009F, (int32_t)0x10587, (int32_t)0x1A28D, (int32_t)0x102A4, (int32_t)0x112C5, (int32_t)0x1011A, (int32_t)0x10555, (int32_t)0x10B8A, (int32_t)0x10124, (int32_t)0x10111, (int32_t)0x10862, (int32_t)0x1004F, (int32_t)0x101F7, (int32_t)0x1048E, (int32_t)0x10145, (int32_t)0x100AB, (int32_t)0x10159, (int32_t)0x10347, (int32_t)0x10DA6, (int32_t)0x1298B, (int32_t)0x11EFD, (int32_t)0x101FD, (int32_t)0x1008C, (int32_t)0x101FF, (int32_t)0x1063A, (int32_t)0x4C2C3, (int32_t)0x100F0, (int32_t)0x1103D, (int32_t)0x104C0 };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util::Check("Fixed32::PowFastest", Fixed32::PowFastest(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
 
+	// Fixed64.Sigmoid()
+	static void Fixed64_Sigmoid()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFFFDAEED758LL, (int64_t)0x26F0BFFCCLL, (int64_t)0x24F94743CLL, (int64_t)0x37BD96FCELL, (int64_t)0x22E879DACLL, (int64_t)0x432318E8LL, (int64_t)0x1D0EE419BLL, (int64_t)0x365731A3ELL, (int64_t)0x3A45F099FLL, (int64_t)0xFFFFFFFD88F005F4LL, (int64_t)0x166C6309ALL, (int64_t)0xFFFFFFFC8E134AE2LL, (int64_t)0xFFFFFFFDE1A67594LL, (int64_t)0x2FC7FAB2DLL, (int64_t)0x2089B99DCLL, (int64_t)0xFFFFFFFFEF503118LL, (int64_t)0xFFFFFFFDCB141494LL, (int64_t)0xFFFFFFFE9E4784F6LL, (int64_t)0x3464651DELL, (int64_t)0xFFFFFFFE179C23C5LL, (int64_t)0xFFFFFFFCE004F502LL, (int64_t)0xFFFFFFFDDD09E5D4LL, (int64_t)0xFFFFFFFC176D5631LL, (int64_t)0x2F711EA1DLL, (int64_t)0x1E6D3DFDBLL, (int64_t)0xFFFFFFF848878331LL, (int64_t)0x1390951A67LL, (int64_t)0x6CF20CB4DLL, (int64_t)0xFFFFFFEEAD7FAD1ELL, (int64_t)0xFFFFFFEB5ABB8997LL, (int64_t)0x1225DD40E4LL, (int64_t)0xFFFFFFE5024DAD8BLL, (int64_t)0xE962EBEDDLL, (int64_t)0x1196C6BCE3LL, (int64_t)0x171C0E406ELL, (int64_t)0x924F501D2LL, (int64_t)0x11621C40LL, (int64_t)0xFFFFFFFD834E4C3CLL, (int64_t)0x986CCEF53LL, (int64_t)0xFFFFFFFFD515B740LL, (int64_t)0xFFFFFFE443C21F09LL, (int64_t)0x14B131B3E9LL, (int64_t)0xD51C797DALL, (int64_t)0x481EE4E49LL, (int64_t)0xFFFFFFF60F2748ADLL, (int64_t)0x4770ECC48LL, (int64_t)0xFFFFFFF07D3FE721LL, (int64_t)0xFFFFFFFBE0CEE0B8LL, (int64_t)0xFFFFFFED204B6B1BLL, (int64_t)0xFFFFFFFA6C04A635LL, (int64_t)0xF568LL, (int64_t)0xBLL, (int64_t)0xC1E0E0LL, (int64_t)0x469LL, (int64_t)0x1A864DLL, (int64_t)0xFALL, (int64_t)0x29540D1LL, (int64_t)0x29BA8B00LL, (int64_t)0x50LL, (int64_t)0x1801LL, (int64_t)0x99FBB6LL, (int64_t)0xELL, (int64_t)0x4BE9DELL, (int64_t)0x1DAC56CLL, (int64_t)0x217DLL, (int64_t)0x8950BLL, (int64_t)0x79ALL, (int64_t)0x6A3FLL, (int64_t)0x1LL, (int64_t)0xBLL, (int64_t)0xD0B459D9LL, (int64_t)0x155B6AELL, (int64_t)0x3456F4LL, (int64_t)0x244CLL, (int64_t)0x4BLL, (int64_t)0xFFFFFFFFFFFFFDC7LL, (int64_t)0xFFFFFFFFFFFE4421LL, (int64_t)0xFFFFFFFFFFFFBAD2LL, (int64_t)0xFFFFFFFFFFFE38A4LL, (int64_t)0xFFFFFFFFFFFFFFD7LL, (int64_t)0xFFFFFFFFFFFFFFF2LL, (int64_t)0xFFFFFFFFFFFFF1A6LL, (int64_t)0xFFFFFFFFFFFFE355LL, (int64_t)0xFFFFFFFFFBA1145ELL, (int64_t)0xFFFFFFFFFFCA9F4DLL, (int64_t)0xFFFFFFFFFFD12401LL, (int64_t)0xFFFFFFFFFFFFF882LL, (int64_t)0xFFFFFFFFFFFFDC6FLL, (int64_t)0xFFFFFFFFFFFFFFF0LL, (int64_t)0xFFFFFFFFFFF3FA2CLL, (int64_t)0xFFFFFFFFF6CA5E3DLL, (int64_t)0xFFFFFFFFFFF9B814LL, (int64_t)0xFFFFFFFFFFFFFEA8LL, (int64_t)0xFFFFFFFFFFFFFEDFLL, (int64_t)0xFFFFFFFFFE6E6AF2LL, (int64_t)0xFFFFFFFFB2B3E66DLL, (int64_t)0xFFFFFFFFFFFFFFEFLL, (int64_t)0xFFFFFFFFC97B9E5ALL, (int64_t)0xFFFFFFFFFFFFFFDCLL, (int64_t)0xFFFFFFFFFF0C6BA6LL };
+		static const int64_t output0[] = { (int64_t)0x76BFD8A4LL, (int64_t)0xEB5BA204LL, (int64_t)0xE8E6D7E0LL, (int64_t)0xF8608750LL, (int64_t)0xE60A99ECLL, (int64_t)0x90B050BCLL, (int64_t)0xDC2FA12CLL, (int64_t)0xF7B3DE10LL, (int64_t)0xF976EC8CLL, (int64_t)0x140E3C1CLL, (int64_t)0xCD6B1DF4LL, (int64_t)0x7EA3A44LL, (int64_t)0x1B7870D8LL, (int64_t)0xF3B32728LL, (int64_t)0xE26055C8LL, (int64_t)0x7BD46D18LL, (int64_t)0x1961C71CLL, (int64_t)0x33633808LL, (int64_t)0xF6AAD0D8LL, (int64_t)0x21154B44LL, (int64_t)0xAC67618LL, (int64_t)0x1B082668LL, (int64_t)0x5097B1CLL, (int64_t)0xF372F968LL, (int64_t)0xDEBD97F0LL, (int64_t)0x1D2C30LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFB7BF84LL, (int64_t)0x84LL, (int64_t)0x4LL, (int64_t)0xFFFFFFC8LL, (int64_t)0x0LL, (int64_t)0xFFFFF838LL, (int64_t)0xFFFFFF9CLL, (int64_t)0x100000000LL, (int64_t)0xFFF90008LL, (int64_t)0x845819ACLL, (int64_t)0x13A718A8LL, (int64_t)0xFFFB3930LL, (int64_t)0x754BD7CCLL, (int64_t)0x0LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFE46CLL, (int64_t)0xFD354FA8LL, (int64_t)0x3281CLL, (int64_t)0xFD16A7ACLL, (int64_t)0x314LL, (int64_t)0x415AF44LL, (int64_t)0x20LL, (int64_t)0xF6C9A4LL, (int64_t)0x80003D4CLL, (int64_t)0x80000000LL, (int64_t)0x80307828LL, (int64_t)0x8000010CLL, (int64_t)0x8006A18CLL, (int64_t)0x8000002CLL, (int64_t)0x80A54FC8LL, (int64_t)0x8A68BD00LL, (int64_t)0x8000000CLL, (int64_t)0x800005FCLL, (int64_t)0x80267EDCLL, (int64_t)0x80000000LL, (int64_t)0x8012FA6CLL, (int64_t)0x8076B124LL, (int64_t)0x8000084CLL, (int64_t)0x8002253CLL, (int64_t)0x800001DCLL, (int64_t)0x80001A7CLL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0xB1775BF8LL, (int64_t)0x80556D8CLL, (int64_t)0x800D15ACLL, (int64_t)0x8000090CLL, (int64_t)0x8000000CLL, (int64_t)0x7FFFFF84LL, (int64_t)0x7FFF9114LL, (int64_t)0x7FFFEEC4LL, (int64_t)0x7FFF8E34LL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0x7FFFFC74LL, (int64_t)0x7FFFF8E4LL, (int64_t)0x7EE846ECLL, (int64_t)0x7FF2A7E4LL, (int64_t)0x7FF44914LL, (int64_t)0x7FFFFE34LL, (int64_t)0x7FFFF724LL, (int64_t)0x80000000LL, (int64_t)0x7FFCFE94LL, (int64_t)0x7DB2A7E4LL, (int64_t)0x7FFE6E14LL, (int64_t)0x7FFFFFB4LL, (int64_t)0x7FFFFFC4LL, (int64_t)0x7F9B9ADCLL, (int64_t)0x6CD23870LL, (int64_t)0x80000000LL, (int64_t)0x726C0814LL, (int64_t)0x80000000LL, (int64_t)0x7FC31AFCLL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Sigmoid", Fixed64::Sigmoid(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SigmoidFast()
+	static void Fixed64_SigmoidFast()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFFE51931085LL, (int64_t)0xFFFFFFFD4C295A13LL, (int64_t)0xFFFFFFFFCAA95358LL, (int64_t)0xFFFFFFFD9CD84D04LL, (int64_t)0x5DB6B848LL, (int64_t)0x18E73990BLL, (int64_t)0xFFFFFFFC62B4F791LL, (int64_t)0xC1E6DF79LL, (int64_t)0x27B9012BCLL, (int64_t)0xFFFFFFFF4BD937B7LL, (int64_t)0xFFFFFFFD45D3E5F3LL, (int64_t)0xFFFFFFFDDDAE6BB4LL, (int64_t)0xFFFFFFFF0B663FD7LL, (int64_t)0xC6369FE9LL, (int64_t)0xFFFFFFFF4C003347LL, (int64_t)0xFFFFFFFE634E4655LL, (int64_t)0xFFFFFFFC375CD671LL, (int64_t)0x26DBB4DCCLL, (int64_t)0x3F841308FLL, (int64_t)0xFFFFFFFFDDA472E8LL, (int64_t)0x23524BC9CLL, (int64_t)0xC7F3BE59LL, (int64_t)0xFFFFFFFF59306EE7LL, (int64_t)0xFFFFFFFE42F913A5LL, (int64_t)0xFFFFFFFFDA387478LL, (int64_t)0x1A5ABD2A74LL, (int64_t)0x1550E66CEALL, (int64_t)0xFFFFFFF14A141EA3LL, (int64_t)0xFFFFFFF097CB1BA2LL, (int64_t)0xFFFFFFFDD23CC7BCLL, (int64_t)0xFFFFFFFB803F4D38LL, (int64_t)0xFFFFFFEBE3D9A698LL, (int64_t)0x147BC79468LL, (int64_t)0x1014A27BE0LL, (int64_t)0x11E3F63C63LL, (int64_t)0x6F308B4CDLL, (int64_t)0xFFFFFFF96AC920B3LL, (int64_t)0x18128B6CF0LL, (int64_t)0x54885374ALL, (int64_t)0xEB9B1EE5DLL, (int64_t)0x39542F947LL, (int64_t)0x8FE5827D1LL, (int64_t)0xFFFFFFFF33B2B4BFLL, (int64_t)0xFFFFFFEA51FC5595LL, (int64_t)0x195884DF72LL, (int64_t)0xFFFFFFE0C7A2B102LL, (int64_t)0x14266C66E8LL, (int64_t)0xFFFFFFEE1783A91DLL, (int64_t)0x11E4FCD1E3LL, (int64_t)0xFFFFFFEE539F961DLL, (int64_t)0x3AE8LL, (int64_t)0x26B0LL, (int64_t)0x1BEA3ADLL, (int64_t)0x316ALL, (int64_t)0x12671LL, (int64_t)0x470796LL, (int64_t)0xDE4FE7LL, (int64_t)0x45LL, (int64_t)0x83B0BDLL, (int64_t)0x1385B6LL, (int64_t)0xBDBAA96LL, (int64_t)0x1DCEC1FLL, (int64_t)0x6A6LL, (int64_t)0x81CLL, (int64_t)0xAD00AAC8LL, (int64_t)0x8DA2AB1DLL, (int64_t)0x2552LL, (int64_t)0x119A91LL, (int64_t)0x471A766LL, (int64_t)0x3472E12LL, (int64_t)0x1CB3BFEFLL, (int64_t)0x1CLL, (int64_t)0x86LL, (int64_t)0x16ELL, (int64_t)0x32F8DACELL, (int64_t)0xFFFFFFFFFFFFFFECLL, (int64_t)0xFFFFFFFFFFFFFFF5LL, (int64_t)0xFFFFFFFFFFFFFED4LL, (int64_t)0xFFFFFFFFFFFFEB46LL, (int64_t)0xFFFFFFFFFFFF7E3CLL, (int64_t)0xFFFFFFFFFFFFFFF8LL, (int64_t)0xFFFFFFFFFFF3C5B6LL, (int64_t)0xFFFFFFFFFFFF306FLL, (int64_t)0xFFFFFFFFFFFFFFFELL, (int64_t)0xFFFFFFFFFFFFFFFELL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFFFFDCB1LL, (int64_t)0xFFFFFFFFFFFFE780LL, (int64_t)0xFFFFFFFFFFFFFF1CLL, (int64_t)0xFFFFFFFFFFFFFFFALL, (int64_t)0xFFFFFFFFF332D585LL, (int64_t)0xFFFFFFFFFFFFFFA0LL, (int64_t)0xFFFFFFFFFFFFFFE1LL, (int64_t)0xFFFFFFFFAE2B1393LL, (int64_t)0xFFFFFFFFF21ED64ELL, (int64_t)0xFFFFFFFFFE244C25LL, (int64_t)0xFFFFFFFFFFFFFC9BLL, (int64_t)0xFFFFFFFFFFFFFFE9LL, (int64_t)0xFFFFFFFFFFFFFFCCLL, (int64_t)0xFFFFFFFFD1E52099LL };
+		static const int64_t output0[] = { (int64_t)0x282BC090LL, (int64_t)0x10155DE4LL, (int64_t)0x72B6B454LL, (int64_t)0x158A7B0CLL, (int64_t)0x972B9858LL, (int64_t)0xD36A9150LL, (int64_t)0x6B6C39CLL, (int64_t)0xAE485F90LL, (int64_t)0xEC4456E4LL, (int64_t)0x54BBD960LL, (int64_t)0xFB6EADCLL, (int64_t)0x1B17B4B0LL, (int64_t)0x471CC1FCLL, (int64_t)0xAF378304LL, (int64_t)0x54C47B20LL, (int64_t)0x2A9289ACLL, (int64_t)0x5B0F8C8LL, (int64_t)0xEB42A004LL, (int64_t)0xFB41B218LL, (int64_t)0x776C5E94LL, (int64_t)0xE6A34A00LL, (int64_t)0xAF97897CLL, (int64_t)0x57B67C20LL, (int64_t)0x2646E468LL, (int64_t)0x76927A2CLL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFCLL, (int64_t)0x6E0LL, (int64_t)0x36CLL, (int64_t)0x1A07523CLL, (int64_t)0x2D0BAB0LL, (int64_t)0x8LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFE40LL, (int64_t)0xFFFFFFB0LL, (int64_t)0xFFC13138LL, (int64_t)0x5A91F0LL, (int64_t)0x100000000LL, (int64_t)0xFEB50B2CLL, (int64_t)0xFFFFF93CLL, (int64_t)0xF913EDC4LL, (int64_t)0xFFF7DC54LL, (int64_t)0x4F794AACLL, (int64_t)0x0LL, (int64_t)0x100000000LL, (int64_t)0x0LL, (int64_t)0xFFFFFFF8LL, (int64_t)0x4CLL, (int64_t)0xFFFFFFB0LL, (int64_t)0x60LL, (int64_t)0x80000EB0LL, (int64_t)0x800009A0LL, (int64_t)0x806FAEE4LL, (int64_t)0x80000C50LL, (int64_t)0x80004994LL, (int64_t)0x8011C2E8LL, (int64_t)0x80379714LL, (int64_t)0x80000010LL, (int64_t)0x8020EE04LL, (int64_t)0x8004E1A8LL, (int64_t)0x82F6E1ECLL, (int64_t)0x80774160LL, (int64_t)0x800001A0LL, (int64_t)0x80000200LL, (int64_t)0xA9AD1474LL, (int64_t)0xA28888B4LL, (int64_t)0x80000950LL, (int64_t)0x800466E0LL, (int64_t)0x811C75E8LL, (int64_t)0x80D1D590LL, (int64_t)0x872B1628LL, (int64_t)0x80000000LL, (int64_t)0x80000020LL, (int64_t)0x80000050LL, (int64_t)0x8CB369C4LL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0x7FFFFFC0LL, (int64_t)0x7FFFFAE0LL, (int64_t)0x7FFFDF90LL, (int64_t)0x80000000LL, (int64_t)0x7FFCF144LL, (int64_t)0x7FFFCC20LL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0x7FFFF730LL, (int64_t)0x7FFFF9E0LL, (int64_t)0x7FFFFFD0LL, (int64_t)0x80000000LL, (int64_t)0x7CCCC668LL, (int64_t)0x7FFFFFF0LL, (int64_t)0x80000000LL, (int64_t)0x6BB6FB58LL, (int64_t)0x7C87D204LL, (int64_t)0x7F890CB4LL, (int64_t)0x7FFFFF30LL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0x74814528LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SigmoidFast", Fixed64::SigmoidFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SigmoidFastest()
+	static void Fixed64_SigmoidFastest()
+	{
+		static const int64_t input0[] = { (int64_t)0x493E28LL, (int64_t)0x39153594FLL, (int64_t)0x97253F79LL, (int64_t)0xFFFFFFFF34CECDC7LL, (int64_t)0xFFFFFFFEC6A0B476LL, (int64_t)0xFFFFFFFCE7436B22LL, (int64_t)0xFFFFFFFDE3F057B4LL, (int64_t)0xFFFFFFFE3CE98C45LL, (int64_t)0xBE2E4A59LL, (int64_t)0x2A2D5C41DLL, (int64_t)0x3B596C70FLL, (int64_t)0x39C64680FLL, (int64_t)0x3672E006ELL, (int64_t)0xBB636429LL, (int64_t)0xFFFFFFFEEFBA7576LL, (int64_t)0xFFFFFFFD08031303LL, (int64_t)0x681B8178LL, (int64_t)0xFFFFFFFCAAE0C5B2LL, (int64_t)0xFFFFFFFCC9C3BC22LL, (int64_t)0xFFFFFFFEB03FEC26LL, (int64_t)0xFFFFFFFFAD8DEAC8LL, (int64_t)0x1F499F58LL, (int64_t)0x299338F6DLL, (int64_t)0xFFFFFFFE00324A95LL, (int64_t)0x2228EDCECLL, (int64_t)0xFFFFFFE31BE9FB87LL, (int64_t)0xFFFFFFE59532C80CLL, (int64_t)0xFFFFFFE3C5CDD908LL, (int64_t)0xFFFFFFFA53AB6435LL, (int64_t)0x112A7E142LL, (int64_t)0xFFFFFFE66C4A9F8DLL, (int64_t)0xFFFFFFF2EFFD3826LL, (int64_t)0xE061E8DDCLL, (int64_t)0x10E28F0C2LL, (int64_t)0x1D4FDF4AFALL, (int64_t)0xFFFFFFE319D8F507LL, (int64_t)0x17379A4C2LL, (int64_t)0x1CA36AA379LL, (int64_t)0xFFFFFFF30FF12C27LL, (int64_t)0x12F0CDFEE5LL, (int64_t)0xFFFFFFF39E054328LL, (int64_t)0x85B492650LL, (int64_t)0xFFFFFFF2B35CCB26LL, (int64_t)0xFFFFFFF4FD4BBFAALL, (int64_t)0xFFFFFFF8EE543232LL, (int64_t)0xFFFFFFEE733A299DLL, (int64_t)0x15F541E8EBLL, (int64_t)0x189EB76271LL, (int64_t)0xFFFFFFFA70169935LL, (int64_t)0x1D7DF0167ALL, (int64_t)0xEA62LL, (int64_t)0x174LL, (int64_t)0x3LL, (int64_t)0x9E0D1C1ELL, (int64_t)0x82DC3LL, (int64_t)0xB6FCD146LL, (int64_t)0xELL, (int64_t)0x520LL, (int64_t)0x137F22LL, (int64_t)0x2EDLL, (int64_t)0x1LL, (int64_t)0x33LL, (int64_t)0xDD11109LL, (int64_t)0x5LL, (int64_t)0xA1358FLL, (int64_t)0x2950ADLL, (int64_t)0xACLL, (int64_t)0x21EELL, (int64_t)0x1351A3LL, (int64_t)0x494LL, (int64_t)0xA8DB2LL, (int64_t)0x9E689LL, (int64_t)0x233B809LL, (int64_t)0x335LL, (int64_t)0x1LL, (int64_t)0xFFFFFFFFFA35D4ADLL, (int64_t)0xFFFFFFFFFFFFFF74LL, (int64_t)0xFFFFFFFFFFFF114DLL, (int64_t)0xFFFFFFFFF4633F7ALL, (int64_t)0xFFFFFFFFFFFD831BLL, (int64_t)0xFFFFFFFFFFFFFFA1LL, (int64_t)0xFFFFFFFFFFFFFFA7LL, (int64_t)0xFFFFFFFFFFE696A4LL, (int64_t)0xFFFFFFFFFFFFAA87LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFF9A17D11LL, (int64_t)0xFFFFFFFFFFFFFF21LL, (int64_t)0xFFFFFFFFFF2EF33ALL, (int64_t)0xFFFFFFFFD2E0A7D5LL, (int64_t)0xFFFFFFFF72EACB7DLL, (int64_t)0xFFFFFFFFCCF5E154LL, (int64_t)0xFFFFFFFFFFFFFFAELL, (int64_t)0xFFFFFFFFFFFFFBE8LL, (int64_t)0xFFFFFFFF03283466LL, (int64_t)0xFFFFFFFFFE6EC8BFLL, (int64_t)0xFFFFFFFFFFFFFFEFLL, (int64_t)0xFFFFFFFFFEB08CC0LL, (int64_t)0xFFFFFFFFFFFFFF88LL, (int64_t)0xFFFFFFFFFFF70CBDLL, (int64_t)0xFFFFFFFFFF771BD3LL };
+		static const int64_t output0[] = { (int64_t)0x80127D74LL, (int64_t)0xF8F81A08LL, (int64_t)0xA4BE25A4LL, (int64_t)0x4FB84ECCLL, (int64_t)0x3A2AE288LL, (int64_t)0xB140DF8LL, (int64_t)0x1BB379C4LL, (int64_t)0x25830E54LL, (int64_t)0xAD78EED8LL, (int64_t)0xEEE0792CLL, (int64_t)0xF9E0ABDCLL, (int64_t)0xF94213BCLL, (int64_t)0xF7C38CE0LL, (int64_t)0xACDCF6F0LL, (int64_t)0x41B1F110LL, (int64_t)0xC80CC64LL, (int64_t)0x99A50188LL, (int64_t)0x8D1BEC8LL, (int64_t)0x9EA5688LL, (int64_t)0x365559F8LL, (int64_t)0x6B960584LL, (int64_t)0x87D76438LL, (int64_t)0xEE43EE44LL, (int64_t)0x1E8954D8LL, (int64_t)0xE4EB8778LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xE09D48LL, (int64_t)0xBEC23D88LL, (int64_t)0x0LL, (int64_t)0x23A8LL, (int64_t)0xFFFFF25CLL, (int64_t)0xBDE6B2F8LL, (int64_t)0x100000000LL, (int64_t)0x0LL, (int64_t)0xCF66ADE8LL, (int64_t)0x100000000LL, (int64_t)0x2854LL, (int64_t)0xFFFFFFE4LL, (int64_t)0x463CLL, (int64_t)0xFFF0A0F4LL, (int64_t)0x1C1CLL, (int64_t)0x11550LL, (int64_t)0x37C524LL, (int64_t)0x68LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFAE7A0LL, (int64_t)0x100000000LL, (int64_t)0x80003B20LL, (int64_t)0x80000050LL, (int64_t)0x80000000LL, (int64_t)0xA6521154LL, (int64_t)0x80021098LL, (int64_t)0xABE5F5B4LL, (int64_t)0x80000000LL, (int64_t)0x80000140LL, (int64_t)0x8004EC08LL, (int64_t)0x800000B0LL, (int64_t)0x80000000LL, (int64_t)0x80000000LL, (int64_t)0x837A1CE8LL, (int64_t)0x80000000LL, (int64_t)0x8028B1ACLL, (int64_t)0x800A6E1CLL, (int64_t)0x80000020LL, (int64_t)0x80000884LL, (int64_t)0x8004E08CLL, (int64_t)0x80000120LL, (int64_t)0x8002AA08LL, (int64_t)0x80027FDCLL, (int64_t)0x808E3F60LL, (int64_t)0x800000C0LL, (int64_t)0x80000000LL, (int64_t)0x7E8A4E68LL, (int64_t)0x7FFFFFE0LL, (int64_t)0x7FFFC3CCLL, (int64_t)0x7D138310LL, (int64_t)0x7FFF5F40LL, (int64_t)0x7FFFFFF0LL, (int64_t)0x7FFFFFF0LL, (int64_t)0x7FF995B0LL, (int64_t)0x7FFFEA7CLL, (int64_t)0x80000000LL, (int64_t)0x7E64F60CLL, (int64_t)0x7FFFFFD0LL, (int64_t)0x7FCB3B54LL, (int64_t)0x74BA660CLL, (int64_t)0x5D9504B8LL, (int64_t)0x73448EBCLL, (int64_t)0x7FFFFFF0LL, (int64_t)0x7FFFFF00LL, (int64_t)0x4579AB58LL, (int64_t)0x7F9ABE38LL, (int64_t)0x80000000LL, (int64_t)0x7FAB55E8LL, (int64_t)0x7FFFFFF0LL, (int64_t)0x7FFDBD8CLL, (int64_t)0x7FDD71A4LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SigmoidFastest", Fixed64::SigmoidFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Sigmoid()
+	static void Fixed32_Sigmoid()
+	{
+		static const int32_t input0[] = { (int32_t)0xFFFD31D7, (int32_t)0x2E21C, (int32_t)0xFFFF8BC0, (int32_t)0x118B2, (int32_t)0xF0E, (int32_t)0xFFFCF417, (int32_t)0xFFFD210E, (int32_t)0x9F6B, (int32_t)0xFFFF8079, (int32_t)0xFFFEF41E, (int32_t)0x2AB92, (int32_t)0x1D2F2, (int32_t)0xFFFED9DA, (int32_t)0xFFFF9AB7, (int32_t)0xFFFFC001, (int32_t)0xFFFDD0CE, (int32_t)0x1101D, (int32_t)0xBCC0, (int32_t)0xFFFF6619, (int32_t)0xFFFFCF44, (int32_t)0x14F3F, (int32_t)0x3D740, (int32_t)0xFFFE810E, (int32_t)0xFFFEC29C, (int32_t)0x21E10, (int32_t)0xFFEEA6C9, (int32_t)0xFFE627BD, (int32_t)0xFFFD1E61, (int32_t)0xFFF089D5, (int32_t)0xFFF5A562, (int32_t)0xFFF6B585, (int32_t)0xFDF2E, (int32_t)0x78015, (int32_t)0xB3BEF, (int32_t)0xFFE3DB58, (int32_t)0xFFE7ACCF, (int32_t)0x15758A, (int32_t)0xFFF2D922, (int32_t)0xFFFFF016, (int32_t)0xFFFCB609, (int32_t)0x4ED1B, (int32_t)0xFFF17E17, (int32_t)0x138C32, (int32_t)0x1D820E, (int32_t)0x17BEAB, (int32_t)0x81A1A, (int32_t)0xFFE40ACE, (int32_t)0x8A07, (int32_t)0xFFF210E7, (int32_t)0x163840, (int32_t)0x6, (int32_t)0x29, (int32_t)0xB1ED, (int32_t)0xC, (int32_t)0x633D, (int32_t)0xB, (int32_t)0x250, (int32_t)0x5, (int32_t)0x43EA, (int32_t)0x24, (int32_t)0x2, (int32_t)0x9CC, (int32_t)0x37, (int32_t)0x5, (int32_t)0x2, (int32_t)0x4, (int32_t)0x6, (int32_t)0x945, (int32_t)0x73, (int32_t)0x4B, (int32_t)0x75, (int32_t)0x43, (int32_t)0x5, (int32_t)0xC7F7, (int32_t)0x59C9, (int32_t)0xFFFFFF8D, (int32_t)0xFFFFFFF4, (int32_t)0xFFFFFFB3, (int32_t)0xFFFFFEEC, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFF5, (int32_t)0xFFFFFC7B, (int32_t)0xFFFFFFF4, (int32_t)0xFFFFFF71, (int32_t)0xFFFFFFEB, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFE531, (int32_t)0xFFFFFF3D, (int32_t)0xFFFFE95F, (int32_t)0xFFFFAD8D, (int32_t)0xFFFFFCFF, (int32_t)0xFFFFEF5E, (int32_t)0xFFFFFF5F, (int32_t)0xFFFFFFED, (int32_t)0xFFFFFF59, (int32_t)0xFFFFADBD, (int32_t)0xFFFF6180, (int32_t)0xFFFFF3F8, (int32_t)0xFFFF6CED, (int32_t)0xFFFFE48E };
+		static const int32_t output0[] = { (int32_t)0xE9B, (int32_t)0xF26F, (int32_t)0x636E, (int32_t)0xBFE5, (int32_t)0x83C3, (int32_t)0xB9E, (int32_t)0xDBA, (int32_t)0xA69D, (int32_t)0x60C3, (int32_t)0x428A, (int32_t)0xEF6C, (int32_t)0xDC6D, (int32_t)0x3D9D, (int32_t)0x6702, (int32_t)0x7016, (int32_t)0x19E6, (int32_t)0xBE45, (int32_t)0xAD28, (int32_t)0x5AA5, (int32_t)0x73DB, (int32_t)0xC995, (int32_t)0xFA9E, (int32_t)0x2EDC, (int32_t)0x3977, (int32_t)0xE480, (int32_t)0x0, (int32_t)0x0, (int32_t)0xD97, (int32_t)0x1, (int32_t)0x3, (int32_t)0x7, (int32_t)0xFFFF, (int32_t)0xFFDB, (int32_t)0xFFFF, (int32_t)0x0, (int32_t)0x0, (int32_t)0x10000, (int32_t)0x1, (int32_t)0x7C06, (int32_t)0x935, (int32_t)0xFE28, (int32_t)0x1, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFEC, (int32_t)0x0, (int32_t)0xA1B1, (int32_t)0x1, (int32_t)0x10000, (int32_t)0x8001, (int32_t)0x800A, (int32_t)0xAAC5, (int32_t)0x8002, (int32_t)0x9880, (int32_t)0x8002, (int32_t)0x8093, (int32_t)0x8001, (int32_t)0x90E1, (int32_t)0x8008, (int32_t)0x8000, (int32_t)0x8272, (int32_t)0x800D, (int32_t)0x8001, (int32_t)0x8000, (int32_t)0x8000, (int32_t)0x8001, (int32_t)0x8251, (int32_t)0x801C, (int32_t)0x8012, (int32_t)0x801D, (int32_t)0x8010, (int32_t)0x8001, (int32_t)0xAF98, (int32_t)0x9638, (int32_t)0x7FE4, (int32_t)0x7FFE, (int32_t)0x7FED, (int32_t)0x7FBC, (int32_t)0x7FFF, (int32_t)0x7FFE, (int32_t)0x7F1F, (int32_t)0x7FFE, (int32_t)0x7FDD, (int32_t)0x7FFB, (int32_t)0x8000, (int32_t)0x794E, (int32_t)0x7FD0, (int32_t)0x7A59, (int32_t)0x6B91, (int32_t)0x7F40, (int32_t)0x7BD8, (int32_t)0x7FD8, (int32_t)0x7FFC, (int32_t)0x7FD7, (int32_t)0x6B9D, (int32_t)0x5999, (int32_t)0x7CFF, (int32_t)0x5C36, (int32_t)0x7926 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Sigmoid", Fixed32::Sigmoid(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SigmoidFast()
+	static void Fixed32_SigmoidFast()
+	{
+		static const int32_t input0[] = { (int32_t)0x18FEF, (int32_t)0x9C6F, (int32_t)0x33529, (int32_t)0x35F01, (int32_t)0x1F61F, (int32_t)0x23F5C, (int32_t)0xFFFF5C00, (int32_t)0xFFFFACF6, (int32_t)0xFFFF0F31, (int32_t)0x1364A, (int32_t)0x3946E, (int32_t)0xFFFEDA25, (int32_t)0xFFFC607C, (int32_t)0x317BE, (int32_t)0xFFFDDFCA, (int32_t)0xFFFC9208, (int32_t)0x106BA, (int32_t)0xFFFE389F, (int32_t)0x34D87, (int32_t)0xFFFF7E20, (int32_t)0xFFFE2420, (int32_t)0x25F20, (int32_t)0xFFFDB5AE, (int32_t)0xFFFFD904, (int32_t)0xFFFD35C4, (int32_t)0xFFF5FC7B, (int32_t)0xFFF1791C, (int32_t)0x1035D4, (int32_t)0xFFE37213, (int32_t)0x1EC051, (int32_t)0xBCEA3, (int32_t)0xFFF36718, (int32_t)0x1EADDB, (int32_t)0xFFF27A38, (int32_t)0xFFE14580, (int32_t)0xC7F4B, (int32_t)0x2E9E9, (int32_t)0xE9892, (int32_t)0xFFEE2D3B, (int32_t)0xFFFC83E4, (int32_t)0xFFEDC02E, (int32_t)0xA1329, (int32_t)0xFFFB6135, (int32_t)0xFFE6ADD8, (int32_t)0x1AB845, (int32_t)0xFFE33B68, (int32_t)0xFFF444A7, (int32_t)0xB4F0E, (int32_t)0x12F574, (int32_t)0xFFF0C180, (int32_t)0x1A, (int32_t)0x83D, (int32_t)0xCDF, (int32_t)0x4A45, (int32_t)0x21, (int32_t)0x596A, (int32_t)0x56, (int32_t)0x9D, (int32_t)0x1775, (int32_t)0x82, (int32_t)0x189, (int32_t)0x7FF, (int32_t)0x87, (int32_t)0x82, (int32_t)0xB5B0, (int32_t)0x657, (int32_t)0x64, (int32_t)0x14C3, (int32_t)0x400A, (int32_t)0x21F, (int32_t)0x1D9, (int32_t)0x5AB8, (int32_t)0x3, (int32_t)0x101, (int32_t)0x14, (int32_t)0xFFFFFB8E, (int32_t)0xFFFFFFA4, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFD44, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFC27, (int32_t)0xFFFF5C33, (int32_t)0xFFFFE28C, (int32_t)0xFFFFF027, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFC5E, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFF9, (int32_t)0xFFFFFFC1, (int32_t)0xFFFFFFF9, (int32_t)0xFFFF5AB6, (int32_t)0xFFFFD8A9, (int32_t)0xFFFF7A28, (int32_t)0xFFFFFDAB, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFDE };
+		static const int32_t output0[] = { (int32_t)0xD3A1, (int32_t)0xA5EF, (int32_t)0xF60C, (int32_t)0xF77F, (int32_t)0xE06E, (int32_t)0xE789, (int32_t)0x5859, (int32_t)0x6B6C, (int32_t)0x47E1, (int32_t)0xC54A, (int32_t)0xF90E, (int32_t)0x3DAB, (int32_t)0x6A9, (int32_t)0xF4E3, (int32_t)0x1B4B, (int32_t)0x809, (int32_t)0xBC77, (int32_t)0x24FB, (int32_t)0xF6EB, (int32_t)0x6036, (int32_t)0x2285, (int32_t)0xEA25, (int32_t)0x1789, (int32_t)0x7646, (int32_t)0xED1, (int32_t)0x3, (int32_t)0x1, (int32_t)0x10000, (int32_t)0x0, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x1, (int32_t)0x10000, (int32_t)0x1, (int32_t)0x0, (int32_t)0xFFFF, (int32_t)0xF2D2, (int32_t)0xFFFF, (int32_t)0x0, (int32_t)0x79E, (int32_t)0x0, (int32_t)0xFFFD, (int32_t)0x280, (int32_t)0x0, (int32_t)0x10000, (int32_t)0x0, (int32_t)0x1, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x1, (int32_t)0x8006, (int32_t)0x820F, (int32_t)0x8337, (int32_t)0x9270, (int32_t)0x8008, (int32_t)0x9621, (int32_t)0x8015, (int32_t)0x8027, (int32_t)0x85DC, (int32_t)0x8020, (int32_t)0x8062, (int32_t)0x81FF, (int32_t)0x8021, (int32_t)0x8020, (int32_t)0xAB9B, (int32_t)0x8195, (int32_t)0x8019, (int32_t)0x8530, (int32_t)0x8FED, (int32_t)0x8087, (int32_t)0x8076, (int32_t)0x9671, (int32_t)0x8000, (int32_t)0x8040, (int32_t)0x8005, (int32_t)0x7EE4, (int32_t)0x7FE9, (int32_t)0x7FFF, (int32_t)0x7F51, (int32_t)0x7FFF, (int32_t)0x8000, (int32_t)0x7F0A, (int32_t)0x5865, (int32_t)0x78A6, (int32_t)0x7C0A, (int32_t)0x8000, (int32_t)0x7F18, (int32_t)0x7FFF, (int32_t)0x8000, (int32_t)0x7FFF, (int32_t)0x7FF1, (int32_t)0x7FFF, (int32_t)0x580F, (int32_t)0x7630, (int32_t)0x5F48, (int32_t)0x7F6B, (int32_t)0x7FFA, (int32_t)0x8000, (int32_t)0x7FFE, (int32_t)0x7FF8 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SigmoidFast", Fixed32::SigmoidFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SigmoidFastest()
+	static void Fixed32_SigmoidFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0xFFFE2758, (int32_t)0x2E97F, (int32_t)0x2B11F, (int32_t)0xE1B9, (int32_t)0x3116B, (int32_t)0x3C4E5, (int32_t)0xFFFD87BE, (int32_t)0xFFFCD71D, (int32_t)0x2F42F, (int32_t)0xFFFFC125, (int32_t)0xFFFF0053, (int32_t)0xFFFE1391, (int32_t)0x1F4EC, (int32_t)0x296D3, (int32_t)0x16730, (int32_t)0xFFFC0ED2, (int32_t)0xFFFEFAA6, (int32_t)0x611A, (int32_t)0xFFFCFAEB, (int32_t)0x36958, (int32_t)0x23558, (int32_t)0xFFFD779D, (int32_t)0xFFFE7932, (int32_t)0x18CA6, (int32_t)0xFFFD7E65, (int32_t)0x154C74, (int32_t)0x66234, (int32_t)0xFFE597C3, (int32_t)0xFFF064C8, (int32_t)0x1BCFB8, (int32_t)0x1906FD, (int32_t)0xA515C, (int32_t)0x430B0, (int32_t)0x1DCB77, (int32_t)0xFFEAA3E6, (int32_t)0xFFF22FBC, (int32_t)0xFFE18A21, (int32_t)0xFFECF8F9, (int32_t)0xFFFA7D27, (int32_t)0xFFEC889C, (int32_t)0xFFE7D74B, (int32_t)0xFFE8CA04, (int32_t)0x1362B, (int32_t)0xFFF1F578, (int32_t)0x1F9C4, (int32_t)0x11E33E, (int32_t)0x1431DA, (int32_t)0xFFF035D8, (int32_t)0x1AC3B0, (int32_t)0xFFE090EC, (int32_t)0x4F, (int32_t)0x352C, (int32_t)0x16F, (int32_t)0x4, (int32_t)0x8E2, (int32_t)0x4, (int32_t)0x280, (int32_t)0x8, (int32_t)0xA3, (int32_t)0x3, (int32_t)0x5F, (int32_t)0x5, (int32_t)0x3532, (int32_t)0x81CD, (int32_t)0x330, (int32_t)0xD14, (int32_t)0xAA3, (int32_t)0x19BC, (int32_t)0x743, (int32_t)0x74, (int32_t)0xD6ED, (int32_t)0xB, (int32_t)0x8, (int32_t)0x7771, (int32_t)0x2155, (int32_t)0xFFFFFA05, (int32_t)0xFFFFF82F, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFF77, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFB7, (int32_t)0xFFFFFFF5, (int32_t)0xFFFFFFE6, (int32_t)0xFFFFFCBD, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFEB7, (int32_t)0xFFFFFFD8, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFF0A8, (int32_t)0xFFFFB587, (int32_t)0xFFFFE63A, (int32_t)0xFFFFFFA9, (int32_t)0xFFFFD6BE, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFD8, (int32_t)0xFFFFFC9B, (int32_t)0xFFFFF469, (int32_t)0xFFFFD9D8 };
+		static const int32_t output0[] = { (int32_t)0x22E4, (int32_t)0xF2CF, (int32_t)0xEFC0, (int32_t)0xB505, (int32_t)0xF49D, (int32_t)0xFA3A, (int32_t)0x13F7, (int32_t)0xA6E, (int32_t)0xF352, (int32_t)0x705E, (int32_t)0x44EA, (int32_t)0x20A0, (int32_t)0xE04E, (int32_t)0xEE1C, (int32_t)0xCD7B, (int32_t)0x4DF, (int32_t)0x43CE, (int32_t)0x97F5, (int32_t)0xBEB, (int32_t)0xF7D4, (int32_t)0xE6A6, (int32_t)0x12D9, (int32_t)0x2DB3, (int32_t)0xD326, (int32_t)0x1350, (int32_t)0x10000, (int32_t)0xFF91, (int32_t)0x0, (int32_t)0x1, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFD, (int32_t)0xFC2D, (int32_t)0x10000, (int32_t)0x0, (int32_t)0x1, (int32_t)0x0, (int32_t)0x0, (int32_t)0x108, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0xC544, (int32_t)0x1, (int32_t)0xE0D3, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x1, (int32_t)0x10000, (int32_t)0x0, (int32_t)0x8013, (int32_t)0x8D41, (int32_t)0x805C, (int32_t)0x8001, (int32_t)0x823C, (int32_t)0x8001, (int32_t)0x80A1, (int32_t)0x8002, (int32_t)0x8029, (int32_t)0x8000, (int32_t)0x8017, (int32_t)0x8001, (int32_t)0x8D43, (int32_t)0x9FC6, (int32_t)0x80CD, (int32_t)0x834A, (int32_t)0x82AD, (int32_t)0x8675, (int32_t)0x81D4, (int32_t)0x801D, (int32_t)0xB2C4, (int32_t)0x8002, (int32_t)0x8002, (int32_t)0x9D50, (int32_t)0x8859, (int32_t)0x7E7F, (int32_t)0x7E08, (int32_t)0x8000, (int32_t)0x7FFE, (int32_t)0x7FDE, (int32_t)0x8000, (int32_t)0x7FEE, (int32_t)0x7FFE, (int32_t)0x7FFA, (int32_t)0x7F2E, (int32_t)0x8000, (int32_t)0x7FFE, (int32_t)0x7FAD, (int32_t)0x7FF6, (int32_t)0x7FFF, (int32_t)0x7C24, (int32_t)0x6D87, (int32_t)0x7989, (int32_t)0x7FEB, (int32_t)0x75B0, (int32_t)0x8000, (int32_t)0x7FF6, (int32_t)0x7F25, (int32_t)0x7D15, (int32_t)0x7674 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SigmoidFastest", Fixed32::SigmoidFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Tanh()
+	static void Fixed64_Tanh()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFFE3A663455LL, (int64_t)0x109B6003ALL, (int64_t)0x8B574369LL, (int64_t)0xE3376289LL, (int64_t)0xFFFFFFFFA6A57438LL, (int64_t)0xFFFFFFFF61559187LL, (int64_t)0x3EAD987BFLL, (int64_t)0x93480089LL, (int64_t)0xA1B36B8LL, (int64_t)0xFFFFFFFCC0CF7FE2LL, (int64_t)0xFFFFFFFFB4EECF88LL, (int64_t)0xFFFFFFFDA2329A44LL, (int64_t)0xFFFFFFFED15AC086LL, (int64_t)0x19DB0FDBBLL, (int64_t)0xFFFFFFFF2C055237LL, (int64_t)0x37B0F076ELL, (int64_t)0x2DE6CA78DLL, (int64_t)0xFFFFFFFD966676E4LL, (int64_t)0x154515CCALL, (int64_t)0x35EE0AECELL, (int64_t)0xFFFFFFFC86171CA2LL, (int64_t)0xFFFFFFFD14C13553LL, (int64_t)0x1FE96FFBBLL, (int64_t)0x3D4D2E39FLL, (int64_t)0x14552D9CALL, (int64_t)0x120096CEE4LL, (int64_t)0xFFFFFFFE2F10653DLL, (int64_t)0xFFFFFFF455384129LL, (int64_t)0xFFFFFFF0E31B2722LL, (int64_t)0xFFFFFFFB60A88937LL, (int64_t)0xFFFFFFF57659992BLL, (int64_t)0x1259F3C264LL, (int64_t)0xFFFFFFE403EF9589LL, (int64_t)0x1A8F416EF5LL, (int64_t)0x140FCFA968LL, (int64_t)0x1A2FAF0A74LL, (int64_t)0xFFFFFFF5D84D922CLL, (int64_t)0x9053098D2LL, (int64_t)0x10BC72D3E1LL, (int64_t)0xFA033ACDFLL, (int64_t)0x1E4EB20F7CLL, (int64_t)0x1CCA7911F9LL, (int64_t)0xFFFFFFFAABCB0FB6LL, (int64_t)0xCA47D6259LL, (int64_t)0xFFFFFFE4EEC45E8ALL, (int64_t)0x1E1B61B97CLL, (int64_t)0x1CB45F28F9LL, (int64_t)0xFFFFFFF4D3575C2ALL, (int64_t)0xFFFFFFF9343C9333LL, (int64_t)0xFFFFFFE272656105LL, (int64_t)0x839673LL, (int64_t)0x1106E2LL, (int64_t)0x200LL, (int64_t)0x361E1BLL, (int64_t)0x5LL, (int64_t)0x18LL, (int64_t)0x120C49D7LL, (int64_t)0x7381ALL, (int64_t)0x5877A5EBLL, (int64_t)0x3097FDLL, (int64_t)0x5628A50BLL, (int64_t)0x2D5A03LL, (int64_t)0x39FLL, (int64_t)0x5LL, (int64_t)0x13728F0LL, (int64_t)0x3242FFLL, (int64_t)0x17LL, (int64_t)0x3F9ELL, (int64_t)0x1599EF08LL, (int64_t)0xC14CLL, (int64_t)0x80076LL, (int64_t)0x7CLL, (int64_t)0x3F34LL, (int64_t)0x2D660205LL, (int64_t)0x50613B65LL, (int64_t)0xFFFFFFFFFFFFFFF4LL, (int64_t)0xFFFFFFFFFF80FE54LL, (int64_t)0xFFFFFFFFFFFFFFFDLL, (int64_t)0xFFFFFFFFE2FA99F3LL, (int64_t)0xFFFFFFFFFFBEAB32LL, (int64_t)0xFFFFFFFFF9BA704DLL, (int64_t)0xFFFFFFFFFFFFFFE7LL, (int64_t)0xFFFFFFFFD0ADBA36LL, (int64_t)0xFFFFFFFFFFFFFF6BLL, (int64_t)0xFFFFFFFFFF9BA641LL, (int64_t)0xFFFFFFFFFF9C2B65LL, (int64_t)0xFFFFFFFFFFFEDF69LL, (int64_t)0xFFFFFFFFFFFFECFBLL, (int64_t)0xFFFFFFFFF97A7A5FLL, (int64_t)0xFFFFFFFFFFD481FELL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFEF3275FLL, (int64_t)0xFFFFFFFFFFBE0F96LL, (int64_t)0xFFFFFFFFFFFFFFFALL, (int64_t)0xFFFFFFFFFD63E0AELL, (int64_t)0xFFFFFFFFFFFFFCDDLL, (int64_t)0xFFFFFFFFFFE8C5CELL, (int64_t)0xFFFFFFFFFFFFF8B6LL, (int64_t)0xFFFFFFFFBE363952LL, (int64_t)0xFFFFFFFFFFFFE3DBLL };
+		static const int64_t output0[] = { (int64_t)0xFFFFFFFF0E6225C0LL, (int64_t)0xC6EE1A38LL, (int64_t)0x7F095628LL, (int64_t)0xB5CEE7F8LL, (int64_t)0xFFFFFFFFAA1B3AF8LL, (int64_t)0xFFFFFFFF72F2F1F8LL, (int64_t)0xFFCC2678LL, (int64_t)0x84EDCF90LL, (int64_t)0xA19DEC8LL, (int64_t)0xFFFFFFFF00C602E0LL, (int64_t)0xFFFFFFFFB7034C08LL, (int64_t)0xFFFFFFFF04779168LL, (int64_t)0xFFFFFFFF2BFE90F8LL, (int64_t)0xEC8DD448LL, (int64_t)0xFFFFFFFF52114118LL, (int64_t)0xFF83E418LL, (int64_t)0xFE5B0420LL, (int64_t)0xFFFFFFFF0413AE78LL, (int64_t)0xDE7CF8A8LL, (int64_t)0xFF655C88LL, (int64_t)0xFFFFFFFF007D3A20LL, (int64_t)0xFFFFFFFF017CFA08LL, (int64_t)0xF6B0DEC0LL, (int64_t)0xFFC26B58LL, (int64_t)0xDAA09A30LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF0D322268LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF000CA950LL, (int64_t)0xFFFFFFFF00000008LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000010LL, (int64_t)0xFFFFFF80LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00031508LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF000029F8LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x839648LL, (int64_t)0x1106D8LL, (int64_t)0x1F8LL, (int64_t)0x361DF8LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x1204A620LL, (int64_t)0x737F8LL, (int64_t)0x551B2E78LL, (int64_t)0x3097D8LL, (int64_t)0x530BEE08LL, (int64_t)0x2D59F8LL, (int64_t)0x378LL, (int64_t)0x0LL, (int64_t)0x1372830LL, (int64_t)0x3242D8LL, (int64_t)0x0LL, (int64_t)0x3F78LL, (int64_t)0x158CD8B8LL, (int64_t)0xC138LL, (int64_t)0x80058LL, (int64_t)0x58LL, (int64_t)0x3F18LL, (int64_t)0x2CEDB060LL, (int64_t)0x4DD6AB00LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFF80FE78LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFE31A43E0LL, (int64_t)0xFFFFFFFFFFBEAB48LL, (int64_t)0xFFFFFFFFF9BAC2B0LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFD135D878LL, (int64_t)0xFFFFFFFFFFFFFF88LL, (int64_t)0xFFFFFFFFFF9BA670LL, (int64_t)0xFFFFFFFFFF9C2B90LL, (int64_t)0xFFFFFFFFFFFEDF88LL, (int64_t)0xFFFFFFFFFFFFED08LL, (int64_t)0xFFFFFFFFF97AD6E0LL, (int64_t)0xFFFFFFFFFFD48208LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFEF327D8LL, (int64_t)0xFFFFFFFFFFBE0FA8LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFD63E6C8LL, (int64_t)0xFFFFFFFFFFFFFCE8LL, (int64_t)0xFFFFFFFFFFE8C5E8LL, (int64_t)0xFFFFFFFFFFFFF8C8LL, (int64_t)0xFFFFFFFFBF9F6FD8LL, (int64_t)0xFFFFFFFFFFFFE3E8LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Tanh", Fixed64::Tanh(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.TanhFast()
+	static void Fixed64_TanhFast()
+	{
+		static const int64_t input0[] = { (int64_t)0x3CB2BBF4FLL, (int64_t)0xFFFFFFFDE98791B4LL, (int64_t)0xFFFFFFFDF58C57E4LL, (int64_t)0x3B7AC1ECFLL, (int64_t)0xFFFFFFFE741735C5LL, (int64_t)0xFFFFFFFF0D029057LL, (int64_t)0x3FC7BFFEFLL, (int64_t)0x1D5B4091BLL, (int64_t)0xFFFFFFFFF14C4E78LL, (int64_t)0x2922DB83DLL, (int64_t)0xFFFFFFFFCA44B5F8LL, (int64_t)0x1689A473ALL, (int64_t)0xFFFFFFFE3F9F3375LL, (int64_t)0xFFFFFFFE6006AEA5LL, (int64_t)0xA4D1DF8LL, (int64_t)0x374F9759ELL, (int64_t)0xFFFFFFFFA33AFB18LL, (int64_t)0x25D82B40CLL, (int64_t)0xFFFFFFFEF7D4EA06LL, (int64_t)0xFFFFFFFC9D7BA9D2LL, (int64_t)0xFFFFFFFC9C0ACCA2LL, (int64_t)0x2EE8EAB3DLL, (int64_t)0xFFFFFFFDEDB33454LL, (int64_t)0x32EB34A4ELL, (int64_t)0x80FCE119LL, (int64_t)0xFFFFFFEB48345E97LL, (int64_t)0xFFFFFFFE4902883DLL, (int64_t)0xFFFFFFF7A33CDB30LL, (int64_t)0xFFFFFFFB2B819F37LL, (int64_t)0x197645C772LL, (int64_t)0xFFFFFFFD47616ABBLL, (int64_t)0x1F7F61C27ELL, (int64_t)0x1684CB05EDLL, (int64_t)0x4253795C8LL, (int64_t)0x608CCFF4CLL, (int64_t)0x1DC3FF6D7BLL, (int64_t)0x17ECA2EDEFLL, (int64_t)0xFFFFFFE334349A07LL, (int64_t)0xFFFFFFE2120CC485LL, (int64_t)0x5348246CALL, (int64_t)0x15FD07F9EBLL, (int64_t)0xFFFFFFF19001F524LL, (int64_t)0xFFFFFFE30202F407LL, (int64_t)0xFFFFFFE9A67C6114LL, (int64_t)0x18BB6005F1LL, (int64_t)0xC1DF9C6D8LL, (int64_t)0xFFFFFFFDCC5A23BCLL, (int64_t)0xFFFFFFE6C9C41E8ELL, (int64_t)0xFFFFFFFBDCAE69B8LL, (int64_t)0xFFFFFFE37581E587LL, (int64_t)0x6DD5LL, (int64_t)0x294LL, (int64_t)0x2E13F387LL, (int64_t)0xC4LL, (int64_t)0xC5B00CCLL, (int64_t)0xALL, (int64_t)0xF4B1BDFBLL, (int64_t)0x89DLL, (int64_t)0x1CEDLL, (int64_t)0x12LL, (int64_t)0x215FEDF8LL, (int64_t)0x117693LL, (int64_t)0x35FLL, (int64_t)0x83887LL, (int64_t)0xC81LL, (int64_t)0xAA44LL, (int64_t)0x53003A8LL, (int64_t)0x79368FLL, (int64_t)0x597685LL, (int64_t)0x26CDELL, (int64_t)0x3LL, (int64_t)0x1EE0LL, (int64_t)0x157E69DLL, (int64_t)0x2694B3FLL, (int64_t)0xB0LL, (int64_t)0xFFFFFFFFFCD8BCC8LL, (int64_t)0xFFFFFFFFFB54644ALL, (int64_t)0xFFFFFFFFFFFFFFF9LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFF07896D2LL, (int64_t)0xFFFFFFFFFF94F7CBLL, (int64_t)0xFFFFFFFFFFFFF290LL, (int64_t)0xFFFFFFFFC4C9DB1DLL, (int64_t)0xFFFFFFFFFFFFF187LL, (int64_t)0xFFFFFFFFFFFFC21BLL, (int64_t)0xFFFFFFFFFFFFFFDALL, (int64_t)0xFFFFFFFFFFFFFFFCLL, (int64_t)0xFFFFFFFFFFF38CAELL, (int64_t)0xFFFFFFFFFFA8D6CBLL, (int64_t)0xFFFFFFFFFFFF41F8LL, (int64_t)0xFFFFFFFF8488AC43LL, (int64_t)0xFFFFFFFFFFFE30E7LL, (int64_t)0xFFFFFFFFFFE52338LL, (int64_t)0xFFFFFFFFE2E96C71LL, (int64_t)0xFFFFFFFFFFD16997LL, (int64_t)0xFFFFFFFFFFFFFF8CLL, (int64_t)0xFFFFFFFF7D921614LL, (int64_t)0xFFFFFFFFFFFFA7AFLL, (int64_t)0xFFFFFFFFFDBBBED2LL, (int64_t)0xFFFFFFFFFFFFE100LL };
+		static const int64_t output0[] = { (int64_t)0xFFBD98D0LL, (int64_t)0xFFFFFFFF07BFA598LL, (int64_t)0xFFFFFFFF087FBE50LL, (int64_t)0xFFB2AD00LL, (int64_t)0xFFFFFFFF1637F2F0LL, (int64_t)0xFFFFFFFF42B5CED8LL, (int64_t)0xFFD2D1F0LL, (int64_t)0xF3465218LL, (int64_t)0xFFFFFFFFF1504DE8LL, (int64_t)0xFD063918LL, (int64_t)0xFFFFFFFFCB0B0428LL, (int64_t)0xE31F65E0LL, (int64_t)0xFFFFFFFF0EF70480LL, (int64_t)0xFFFFFFFF131D66D0LL, (int64_t)0xA4BE6D0LL, (int64_t)0xFF7DDA10LL, (int64_t)0xFFFFFFFFA71720D8LL, (int64_t)0xFB85DF30LL, (int64_t)0xFFFFFFFF39AF1220LL, (int64_t)0xFFFFFFFF00964E08LL, (int64_t)0xFFFFFFFF00949FD8LL, (int64_t)0xFE8CB998LL, (int64_t)0xFFFFFFFF08005608LL, (int64_t)0xFF1ECF70LL, (int64_t)0x7713EF88LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF10117888LL, (int64_t)0xFFFFFFFF000001D8LL, (int64_t)0xFFFFFFFF00085BE8LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF023506F8LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFDF2208LL, (int64_t)0xFFFF3F88LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFC0D38LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF06303E70LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00215BA0LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x6DC0LL, (int64_t)0x280LL, (int64_t)0x2D963018LL, (int64_t)0xC0LL, (int64_t)0xC58BAD0LL, (int64_t)0x0LL, (int64_t)0xBE0F0200LL, (int64_t)0x880LL, (int64_t)0x1CE0LL, (int64_t)0x0LL, (int64_t)0x212FA218LL, (int64_t)0x117780LL, (int64_t)0x340LL, (int64_t)0x838F8LL, (int64_t)0xC80LL, (int64_t)0xAA48LL, (int64_t)0x5300648LL, (int64_t)0x793D58LL, (int64_t)0x597B98LL, (int64_t)0x26CE0LL, (int64_t)0x0LL, (int64_t)0x1EE0LL, (int64_t)0x157F7D8LL, (int64_t)0x2696430LL, (int64_t)0xA0LL, (int64_t)0xFFFFFFFFFCD8A2F8LL, (int64_t)0xFFFFFFFFFB5457B0LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFF07D57B0LL, (int64_t)0xFFFFFFFFFF94F1D0LL, (int64_t)0xFFFFFFFFFFFFF2A0LL, (int64_t)0xFFFFFFFFC5D24D28LL, (int64_t)0xFFFFFFFFFFFFF1A0LL, (int64_t)0xFFFFFFFFFFFFC220LL, (int64_t)0xFFFFFFFFFFFFFFE0LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFFF38C08LL, (int64_t)0xFFFFFFFFFFA8D1E8LL, (int64_t)0xFFFFFFFFFFFF41F8LL, (int64_t)0xFFFFFFFF8D4A8990LL, (int64_t)0xFFFFFFFFFFFE30E8LL, (int64_t)0xFFFFFFFFFFE521B0LL, (int64_t)0xFFFFFFFFE3097F30LL, (int64_t)0xFFFFFFFFFFD166F0LL, (int64_t)0xFFFFFFFFFFFFFFA0LL, (int64_t)0xFFFFFFFF87CB83D0LL, (int64_t)0xFFFFFFFFFFFFA7C0LL, (int64_t)0xFFFFFFFFFDBBA670LL, (int64_t)0xFFFFFFFFFFFFE100LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::TanhFast", Fixed64::TanhFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.TanhFastest()
+	static void Fixed64_TanhFastest()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFFCCAECD052LL, (int64_t)0x9DD798F9LL, (int64_t)0x1C27E094BLL, (int64_t)0xFFFFFFFD482D0ED3LL, (int64_t)0x379B62EDELL, (int64_t)0x383077E6FLL, (int64_t)0xFFFFFFFC1A548F51LL, (int64_t)0xFFFFFFFD83613DB4LL, (int64_t)0xFFFFFFFD5335FAC3LL, (int64_t)0x3B591C47FLL, (int64_t)0xFFFFFFFEEDD24B86LL, (int64_t)0xFFFFFFFC2E948CC1LL, (int64_t)0xFFFFFFFD427166A3LL, (int64_t)0xF1DAB159LL, (int64_t)0x20366C07CLL, (int64_t)0x3DC0DA48LL, (int64_t)0x54F91018LL, (int64_t)0xFFFFFFFD8B1CD614LL, (int64_t)0xFFFFFFFC82C53142LL, (int64_t)0xFFFFFFFC5882E201LL, (int64_t)0x1E905A00BLL, (int64_t)0xFFFFFFFEE79C2496LL, (int64_t)0xFFFFFFFE692AF8B5LL, (int64_t)0xFFFFFFFC8FF68D72LL, (int64_t)0xE0F97DD9LL, (int64_t)0xB77BE16D6LL, (int64_t)0x86762B1D0LL, (int64_t)0x1C26A28678LL, (int64_t)0x1157EFD5E2LL, (int64_t)0xFFFFFFF3DF1B4028LL, (int64_t)0xFFFFFFED82B7589CLL, (int64_t)0xFFFFFFF8AF1DF6B2LL, (int64_t)0xFFFFFFF9AA699134LL, (int64_t)0xFFFFFFEF4457D31FLL, (int64_t)0x151226D5EALL, (int64_t)0xFFFFFFED0791F49BLL, (int64_t)0x76EBE56CELL, (int64_t)0xFFFFFFE70645C08FLL, (int64_t)0xFFFFFFF930DC25B3LL, (int64_t)0xFFFFFFFC9ECD573ALL, (int64_t)0xFFFFFFEAF9C4A396LL, (int64_t)0xFFFFFFEA8D74F696LL, (int64_t)0xFFFFFFF6AEF232AELL, (int64_t)0x1EB7ED367DLL, (int64_t)0xFFFFFFF51F93BAABLL, (int64_t)0xFFFFFFF664E7232DLL, (int64_t)0x40C9D8AC8LL, (int64_t)0x1A2B164CF4LL, (int64_t)0xFFFFFFF43BAB1629LL, (int64_t)0xFFFFFFF16956FB23LL, (int64_t)0x504LL, (int64_t)0x30E7BC5CLL, (int64_t)0x6D20CLL, (int64_t)0x52LL, (int64_t)0x8F3E0LL, (int64_t)0xBBA303LL, (int64_t)0x1C4LL, (int64_t)0x1BA7EDLL, (int64_t)0x30ECFLL, (int64_t)0x11FLL, (int64_t)0x397LL, (int64_t)0x5LL, (int64_t)0x29ACLL, (int64_t)0xA4C8314LL, (int64_t)0x10EEB38LL, (int64_t)0xA5DF7A48LL, (int64_t)0xEE06DLL, (int64_t)0x2A5C98F8LL, (int64_t)0x25E2541LL, (int64_t)0x2E796LL, (int64_t)0x260488E3LL, (int64_t)0x3850LL, (int64_t)0x2FC694FLL, (int64_t)0xD4C42LL, (int64_t)0xEE0E757LL, (int64_t)0xFFFFFFFFFFFAD980LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFFFFFB22LL, (int64_t)0xFFFFFFFFFF31D255LL, (int64_t)0xFFFFFFFFFFFFFEC1LL, (int64_t)0xFFFFFFFFFFFFFFF3LL, (int64_t)0xFFFFFFFFFF751CDELL, (int64_t)0xFFFFFFFFFFF072FELL, (int64_t)0xFFFFFFFFFFFF05F6LL, (int64_t)0xFFFFFFFF3CD0895BLL, (int64_t)0xFFFFFFFFFFFFFDCBLL, (int64_t)0xFFFFFFFFFD06CA97LL, (int64_t)0xFFFFFFFFFFFFFFA9LL, (int64_t)0xFFFFFFFFFFE9D1FELL, (int64_t)0xFFFFFFFFFFFFFFF9LL, (int64_t)0xFFFFFFFFCC4FF2BCLL, (int64_t)0xFFFFFFFF86559FFBLL, (int64_t)0xFFFFFFFFFFFC44C2LL, (int64_t)0xFFFFFFFFFFFFFFEBLL, (int64_t)0xFFFFFFFFFFFFFFEALL, (int64_t)0xFFFFFFFFFFFFFFF8LL, (int64_t)0xFFFFFFFFFF11EED2LL, (int64_t)0xFFFFFFFFFFFF0401LL, (int64_t)0xFFFFFFFFFFFFFF65LL, (int64_t)0xFFFFFFFFFFFFF6E4LL };
+		static const int64_t output0[] = { (int64_t)0xFFFFFFFF00D60680LL, (int64_t)0x8C797A00LL, (int64_t)0xF144FF90LL, (int64_t)0xFFFFFFFF0237F450LL, (int64_t)0xFF82B0A8LL, (int64_t)0xFF8B5608LL, (int64_t)0xFFFFFFFF0035F648LL, (int64_t)0xFFFFFFFF03841390LL, (int64_t)0xFFFFFFFF026ADE10LL, (int64_t)0xFFB17C80LL, (int64_t)0xFFFFFFFF35D1ECE0LL, (int64_t)0xFFFFFFFF003F4AB0LL, (int64_t)0xFFFFFFFF021F7DF0LL, (int64_t)0xBCC9CCC0LL, (int64_t)0xF7067178LL, (int64_t)0x3C904A28LL, (int64_t)0x52025118LL, (int64_t)0xFFFFFFFF03BB33C0LL, (int64_t)0xFFFFFFFF0079F720LL, (int64_t)0xFFFFFFFF0057ADA0LL, (int64_t)0xF506AEF8LL, (int64_t)0xFFFFFFFF33855D78LL, (int64_t)0xFFFFFFFF147BB250LL, (int64_t)0xFFFFFFFF00871B60LL, (int64_t)0xB4B0AF90LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFE50LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000EE0LL, (int64_t)0xFFFFFFFF000069B8LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFF438LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF000028F0LL, (int64_t)0xFFFFFFFF0097D740LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000048LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000030LL, (int64_t)0xFFD82280LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0xFFFFFFFF00000000LL, (int64_t)0x508LL, (int64_t)0x30426ED0LL, (int64_t)0x6E330LL, (int64_t)0x40LL, (int64_t)0x90A70LL, (int64_t)0xBD6C88LL, (int64_t)0x1C0LL, (int64_t)0x1BED60LL, (int64_t)0x31678LL, (int64_t)0x100LL, (int64_t)0x388LL, (int64_t)0x0LL, (int64_t)0x2A08LL, (int64_t)0xA59B9B0LL, (int64_t)0x1117518LL, (int64_t)0x91FD0888LL, (int64_t)0xF05D8LL, (int64_t)0x29EEE4A0LL, (int64_t)0x2637398LL, (int64_t)0x2EED0LL, (int64_t)0x25B60720LL, (int64_t)0x38C8LL, (int64_t)0x302E130LL, (int64_t)0xD6DC0LL, (int64_t)0xEEBC340LL, (int64_t)0xFFFFFFFFFFFACC80LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFFFFFB38LL, (int64_t)0xFFFFFFFFFF2FDD70LL, (int64_t)0xFFFFFFFFFFFFFEE0LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFF73C708LL, (int64_t)0xFFFFFFFFFFF04BD8LL, (int64_t)0xFFFFFFFFFFFF0390LL, (int64_t)0xFFFFFFFF5B85E1F0LL, (int64_t)0xFFFFFFFFFFFFFDE0LL, (int64_t)0xFFFFFFFFFD005878LL, (int64_t)0xFFFFFFFFFFFFFFC0LL, (int64_t)0xFFFFFFFFFFE99A30LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFCD1006F8LL, (int64_t)0xFFFFFFFF8EC2BA08LL, (int64_t)0xFFFFFFFFFFFC3B78LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0x0LL, (int64_t)0xFFFFFFFFFF0FB008LL, (int64_t)0xFFFFFFFFFFFF01A8LL, (int64_t)0xFFFFFFFFFFFFFF80LL, (int64_t)0xFFFFFFFFFFFFF6F0LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::TanhFastest", Fixed64::TanhFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Tanh()
+	static void Fixed32_Tanh()
+	{
+		static const int32_t input0[] = { (int32_t)0x28186, (int32_t)0xFFFD5B7E, (int32_t)0xFFFE3912, (int32_t)0x1D198, (int32_t)0x18CD, (int32_t)0xFFFF98E3, (int32_t)0xFFFD6E92, (int32_t)0x26525, (int32_t)0x188B0, (int32_t)0xFFFF6BFE, (int32_t)0xFFFC933F, (int32_t)0xFA1C, (int32_t)0xFFFCE5E2, (int32_t)0x2987D, (int32_t)0x139E7, (int32_t)0x5E19, (int32_t)0xC583, (int32_t)0x2237C, (int32_t)0xFFFED00C, (int32_t)0x39D99, (int32_t)0x3389A, (int32_t)0x12C86, (int32_t)0x35F2D, (int32_t)0xFFFF20F7, (int32_t)0x33737, (int32_t)0x178831, (int32_t)0xFFFB3C73, (int32_t)0x996E7, (int32_t)0x149278, (int32_t)0xFFE99B89, (int32_t)0x1DBF3B, (int32_t)0x135C63, (int32_t)0xFFE44BDA, (int32_t)0xFFF2A2CC, (int32_t)0x10AC3E, (int32_t)0xFFF2ED95, (int32_t)0x16CC8D, (int32_t)0xFFECAB27, (int32_t)0xFFEA3A27, (int32_t)0xFFFE0ABE, (int32_t)0x90663, (int32_t)0x189ED, (int32_t)0xFFECBA6A, (int32_t)0xDAEA4, (int32_t)0xAD2AD, (int32_t)0x19A65D, (int32_t)0xFFE93B01, (int32_t)0x1ECE5F, (int32_t)0x1E39A2, (int32_t)0xFFFF39A4, (int32_t)0x2C, (int32_t)0x2C16, (int32_t)0x9D0, (int32_t)0xD, (int32_t)0x1D00, (int32_t)0xB, (int32_t)0x1A, (int32_t)0x4EE0, (int32_t)0x29A9, (int32_t)0x659, (int32_t)0x2, (int32_t)0x1EA, (int32_t)0xCB8C, (int32_t)0x22E, (int32_t)0xF6, (int32_t)0x20, (int32_t)0x281, (int32_t)0x27D5, (int32_t)0x3, (int32_t)0x52, (int32_t)0xA2A, (int32_t)0x7E, (int32_t)0x453, (int32_t)0x4B33, (int32_t)0x32, (int32_t)0xFFFFFF9A, (int32_t)0xFFFFFF2E, (int32_t)0xFFFFFFEF, (int32_t)0xFFFFF1C8, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFF190, (int32_t)0xFFFFFF36, (int32_t)0xFFFFF70B, (int32_t)0xFFFFFFC0, (int32_t)0xFFFFC8A1, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFB289, (int32_t)0xFFFFFE94, (int32_t)0xFFFFFC3E, (int32_t)0xFFFFFFFD, (int32_t)0xFFFF45A3, (int32_t)0xFFFFFFA0, (int32_t)0xFFFFFE58, (int32_t)0xFFFFFF33, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFDB8, (int32_t)0xFFFFF8BF, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFF81 };
+		static const int32_t output0[] = { (int32_t)0xFC9D, (int32_t)0xFFFF0295, (int32_t)0xFFFF0E3E, (int32_t)0xF2DE, (int32_t)0x18B9, (int32_t)0xFFFF9E20, (int32_t)0xFFFF02FF, (int32_t)0xFBC7, (int32_t)0xE93D, (int32_t)0xFFFF7A8B, (int32_t)0xFFFF008B, (int32_t)0xC073, (int32_t)0xFFFF0109, (int32_t)0xFD2A, (int32_t)0xD76A, (int32_t)0x5A13, (int32_t)0xA5D7, (int32_t)0xF8FD, (int32_t)0xFFFF2B96, (int32_t)0xFFA1, (int32_t)0xFF2F, (int32_t)0xD355, (int32_t)0xFF65, (int32_t)0xFFFF4C4A, (int32_t)0xFF2D, (int32_t)0x10000, (int32_t)0xFFFF000A, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0A00, (int32_t)0x10000, (int32_t)0xE973, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF59AB, (int32_t)0x2B, (int32_t)0x2BA7, (int32_t)0x9CE, (int32_t)0xC, (int32_t)0x1CE0, (int32_t)0xA, (int32_t)0x19, (int32_t)0x4C78, (int32_t)0x294B, (int32_t)0x658, (int32_t)0x1, (int32_t)0x1E9, (int32_t)0xA94A, (int32_t)0x22D, (int32_t)0xF5, (int32_t)0x1F, (int32_t)0x280, (int32_t)0x2783, (int32_t)0x2, (int32_t)0x51, (int32_t)0xA28, (int32_t)0x7D, (int32_t)0x452, (int32_t)0x491B, (int32_t)0x31, (int32_t)0xFFFFFF9B, (int32_t)0xFFFFFF2F, (int32_t)0xFFFFFFF0, (int32_t)0xFFFFF1CC, (int32_t)0xFFFFFFFF, (int32_t)0xFFFFF194, (int32_t)0xFFFFFF37, (int32_t)0xFFFFF70C, (int32_t)0xFFFFFFC1, (int32_t)0xFFFFC97A, (int32_t)0xFFFFFFF9, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFB4D1, (int32_t)0xFFFFFE95, (int32_t)0xFFFFFC3F, (int32_t)0xFFFFFFFE, (int32_t)0xFFFF60D0, (int32_t)0xFFFFFFA1, (int32_t)0xFFFFFE59, (int32_t)0xFFFFFF34, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFDB9, (int32_t)0xFFFFF8C0, (int32_t)0xFFFFFFE6, (int32_t)0xFFFFFF82 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Tanh", Fixed32::Tanh(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.TanhFast()
+	static void Fixed32_TanhFast()
+	{
+		static const int32_t input0[] = { (int32_t)0xFFFDA297, (int32_t)0xFFFDBB2E, (int32_t)0xFFFFEC9C, (int32_t)0x21B23, (int32_t)0x24E21, (int32_t)0xFFFDFF17, (int32_t)0xFFFC38DE, (int32_t)0xFFFFA9B3, (int32_t)0xFFFDEC82, (int32_t)0x20799, (int32_t)0x19802, (int32_t)0xFFFC033C, (int32_t)0xFFFDD7F7, (int32_t)0xFFFEBBC9, (int32_t)0xFFFC09DF, (int32_t)0xFFFDDB94, (int32_t)0xFFFF8112, (int32_t)0x2260C, (int32_t)0x83B7, (int32_t)0xFFFE5AD2, (int32_t)0x8C95, (int32_t)0xFFFEAA2B, (int32_t)0xFFFE475E, (int32_t)0xFFFF77F1, (int32_t)0x1799A, (int32_t)0xFFF304DE, (int32_t)0xFFE64401, (int32_t)0xF839, (int32_t)0xFFF68F55, (int32_t)0xFFE53CB7, (int32_t)0xFFFBA750, (int32_t)0x1D1DB7, (int32_t)0x1F717, (int32_t)0x131901, (int32_t)0xFFE98FEF, (int32_t)0x10E5E2, (int32_t)0xAE845, (int32_t)0xFFF52925, (int32_t)0xFFE17F4D, (int32_t)0x2167C, (int32_t)0xFFFDA5A3, (int32_t)0x111A2B, (int32_t)0x16FE1A, (int32_t)0xFFE07E78, (int32_t)0x406DC, (int32_t)0x13A0EA, (int32_t)0xFFFF9B91, (int32_t)0xC7FB6, (int32_t)0xFFF93FE1, (int32_t)0xFFFC5A94, (int32_t)0x6, (int32_t)0x761, (int32_t)0x134, (int32_t)0x3, (int32_t)0xC3C1, (int32_t)0x4328, (int32_t)0x7DA6, (int32_t)0x3, (int32_t)0x4, (int32_t)0x149, (int32_t)0x9, (int32_t)0x19C, (int32_t)0x5, (int32_t)0xA, (int32_t)0x38, (int32_t)0x11EE, (int32_t)0x10B, (int32_t)0xB2, (int32_t)0xE, (int32_t)0x18, (int32_t)0x2B0, (int32_t)0x6, (int32_t)0x1219, (int32_t)0x2, (int32_t)0x2C38, (int32_t)0xFFFFDF86, (int32_t)0xFFFFFEED, (int32_t)0xFFFFFFDD, (int32_t)0xFFFFBD4D, (int32_t)0xFFFFB83D, (int32_t)0xFFFFDEE2, (int32_t)0xFFFFFF7D, (int32_t)0xFFFFFFF9, (int32_t)0xFFFF9C21, (int32_t)0xFFFF5244, (int32_t)0xFFFFE7CB, (int32_t)0xFFFFFEF6, (int32_t)0xFFFFFEB7, (int32_t)0xFFFFD6D8, (int32_t)0xFFFFFFDC, (int32_t)0xFFFFD326, (int32_t)0xFFFFFB67, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFE05, (int32_t)0xFFFFFF97, (int32_t)0xFFFF66CD, (int32_t)0xFFFFF864, (int32_t)0xFFFFF49E, (int32_t)0xFFFFF636, (int32_t)0xFFFFD929 };
+		static const int32_t output0[] = { (int32_t)0xFFFF047C, (int32_t)0xFFFF056C, (int32_t)0xFFFFECA6, (int32_t)0xF886, (int32_t)0xFAF4, (int32_t)0xFFFF0926, (int32_t)0xFFFF0045, (int32_t)0xFFFFACD4, (int32_t)0xFFFF07EE, (int32_t)0xF750, (int32_t)0xEBB4, (int32_t)0xFFFF002E, (int32_t)0xFFFF06C5, (int32_t)0xFFFF25AD, (int32_t)0xFFFF0030, (int32_t)0xFFFF06F6, (int32_t)0xFFFF8A8B, (int32_t)0xF920, (int32_t)0x7934, (int32_t)0xFFFF1262, (int32_t)0x7FF8, (int32_t)0xFFFF2125, (int32_t)0xFFFF0FDF, (int32_t)0xFFFF8374, (int32_t)0xE688, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0xBFA0, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0016, (int32_t)0x10000, (int32_t)0xF623, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0xF840, (int32_t)0xFFFF0497, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0xFFD6, (int32_t)0x10000, (int32_t)0xFFFFA06D, (int32_t)0x10000, (int32_t)0xFFFF0001, (int32_t)0xFFFF005A, (int32_t)0x6, (int32_t)0x760, (int32_t)0x134, (int32_t)0x3, (int32_t)0xA4D1, (int32_t)0x41A8, (int32_t)0x7472, (int32_t)0x3, (int32_t)0x4, (int32_t)0x149, (int32_t)0x9, (int32_t)0x19C, (int32_t)0x5, (int32_t)0xA, (int32_t)0x38, (int32_t)0x11E6, (int32_t)0x10B, (int32_t)0xB2, (int32_t)0xE, (int32_t)0x18, (int32_t)0x2B0, (int32_t)0x6, (int32_t)0x1211, (int32_t)0x2, (int32_t)0x2BC8, (int32_t)0xFFFFDFB3, (int32_t)0xFFFFFEED, (int32_t)0xFFFFFFDD, (int32_t)0xFFFFBEC5, (int32_t)0xFFFFBA10, (int32_t)0xFFFFDF12, (int32_t)0xFFFFFF7D, (int32_t)0xFFFFFFF9, (int32_t)0xFFFFA0E9, (int32_t)0xFFFF68CC, (int32_t)0xFFFFE7DE, (int32_t)0xFFFFFEF6, (int32_t)0xFFFFFEB7, (int32_t)0xFFFFD732, (int32_t)0xFFFFFFDC, (int32_t)0xFFFFD39B, (int32_t)0xFFFFFB67, (int32_t)0xFFFFFFE5, (int32_t)0xFFFFFE05, (int32_t)0xFFFFFF97, (int32_t)0xFFFF76CE, (int32_t)0xFFFFF865, (int32_t)0xFFFFF4A0, (int32_t)0xFFFFF638, (int32_t)0xFFFFD975 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::TanhFast", Fixed32::TanhFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.TanhFastest()
+	static void Fixed32_TanhFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0x225FC, (int32_t)0xFFFEFA7F, (int32_t)0xFFFCE988, (int32_t)0x1F1E9, (int32_t)0xFFFC4286, (int32_t)0x20044, (int32_t)0x2F04E, (int32_t)0xFFFE2E17, (int32_t)0xFFFFBD23, (int32_t)0x2C876, (int32_t)0x319CB, (int32_t)0xFFFCB290, (int32_t)0x14C9, (int32_t)0xFFFC230F, (int32_t)0xFFFDAB01, (int32_t)0xFFFCE5B9, (int32_t)0x31EC7, (int32_t)0xAA7F, (int32_t)0x23C24, (int32_t)0xFFFC6ACC, (int32_t)0xC1B4, (int32_t)0x2A9E4, (int32_t)0xFFFEFF4C, (int32_t)0xFFFCFEC2, (int32_t)0xFFFF400D, (int32_t)0x16387C, (int32_t)0xFFE28E15, (int32_t)0x15C772, (int32_t)0x2999D, (int32_t)0x1E1233, (int32_t)0xFFE31C55, (int32_t)0x9A500, (int32_t)0xFFF6EA37, (int32_t)0x17CD63, (int32_t)0x36C2A, (int32_t)0xAA04A, (int32_t)0xFFE56EE2, (int32_t)0xFFE14A31, (int32_t)0x1F335B, (int32_t)0x123FEC, (int32_t)0xFFE27AAB, (int32_t)0xFFECE64F, (int32_t)0xFFE8102D, (int32_t)0x583C9, (int32_t)0x12328A, (int32_t)0x2868F, (int32_t)0x195545, (int32_t)0x7A5FC, (int32_t)0xFFE582FD, (int32_t)0x6CD1A, (int32_t)0x139, (int32_t)0x5, (int32_t)0x4, (int32_t)0xA, (int32_t)0xAF5A, (int32_t)0x830B, (int32_t)0xF9D6, (int32_t)0xE5D8, (int32_t)0x42, (int32_t)0xD, (int32_t)0xC94, (int32_t)0x2, (int32_t)0xFC2, (int32_t)0x160, (int32_t)0x1FC2, (int32_t)0x17, (int32_t)0xF51, (int32_t)0x5F3, (int32_t)0xF8, (int32_t)0x232, (int32_t)0x2, (int32_t)0x422B, (int32_t)0x3D3, (int32_t)0xF10E, (int32_t)0x2, (int32_t)0xFFFFFF89, (int32_t)0xFFFFF3D7, (int32_t)0xFFFFE39D, (int32_t)0xFFFFFFBC, (int32_t)0xFFFFBFE8, (int32_t)0xFFFF659A, (int32_t)0xFFFFFF62, (int32_t)0xFFFFEC21, (int32_t)0xFFFF7EA2, (int32_t)0xFFFFFECF, (int32_t)0xFFFF6E8A, (int32_t)0xFFFFFD12, (int32_t)0xFFFFFFF0, (int32_t)0xFFFF9D55, (int32_t)0xFFFFFB2F, (int32_t)0xFFFFF7DC, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFF67E, (int32_t)0xFFFFDF41, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFEF8, (int32_t)0xFFFFFA9F, (int32_t)0xFFFFE414, (int32_t)0xFFFFFDB0 };
+		static const int32_t output0[] = { (int32_t)0xF920, (int32_t)0xFFFF3AC6, (int32_t)0xFFFF0111, (int32_t)0xF5C0, (int32_t)0xFFFF004A, (int32_t)0xF6CF, (int32_t)0xFE92, (int32_t)0xFFFF0D1C, (int32_t)0xFFFFBE9B, (int32_t)0xFE0C, (int32_t)0xFEF6, (int32_t)0xFFFF00B2, (int32_t)0x14C9, (int32_t)0xFFFF003A, (int32_t)0xFFFF04CA, (int32_t)0xFFFF0109, (int32_t)0xFF01, (int32_t)0x9513, (int32_t)0xFA35, (int32_t)0xFFFF0066, (int32_t)0xA39B, (int32_t)0xFD86, (int32_t)0xFFFF3CBE, (int32_t)0xFFFF0142, (int32_t)0xFFFF5D6F, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0xFD30, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0xFF74, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0xFFFF0000, (int32_t)0xFFFD, (int32_t)0x10000, (int32_t)0xFCBD, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0xFFFF0000, (int32_t)0xFFFF, (int32_t)0x13B, (int32_t)0x5, (int32_t)0x4, (int32_t)0xA, (int32_t)0x983F, (int32_t)0x78AF, (int32_t)0xC057, (int32_t)0xB71B, (int32_t)0x42, (int32_t)0xD, (int32_t)0xCA0, (int32_t)0x2, (int32_t)0xFCB, (int32_t)0x163, (int32_t)0x1F98, (int32_t)0x17, (int32_t)0xF5B, (int32_t)0x5FD, (int32_t)0xFA, (int32_t)0x236, (int32_t)0x2, (int32_t)0x40BE, (int32_t)0x3DA, (int32_t)0xBC6C, (int32_t)0x2, (int32_t)0xFFFFFF88, (int32_t)0xFFFFF3CB, (int32_t)0xFFFFE3B7, (int32_t)0xFFFFFFBC, (int32_t)0xFFFFC137, (int32_t)0xFFFF75F3, (int32_t)0xFFFFFF61, (int32_t)0xFFFFEC1F, (int32_t)0xFFFF88A0, (int32_t)0xFFFFFECD, (int32_t)0xFFFF7C68, (int32_t)0xFFFFFD0C, (int32_t)0xFFFFFFF0, (int32_t)0xFFFFA1F5, (int32_t)0xFFFFFB26, (int32_t)0xFFFFF7D0, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFF671, (int32_t)0xFFFFDF70, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFEF6, (int32_t)0xFFFFFA95, (int32_t)0xFFFFE42C, (int32_t)0xFFFFFDAB };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::TanhFastest", Fixed32::TanhFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Softplus()
+	static void Fixed64_Softplus()
+	{
+		static const int64_t input0[] = { (int64_t)0x480B57C8LL, (int64_t)0xFFFFFFFFF98FC538LL, (int64_t)0x20E9852FCLL, (int64_t)0xFFFFFFFD5917CFB3LL, (int64_t)0x312343BFELL, (int64_t)0x36AAB502ELL, (int64_t)0x1A2AD5F6BLL, (int64_t)0x215898C5CLL, (int64_t)0xFFFFFFFC63F08EF1LL, (int64_t)0xFFFFFFFFFDE79D58LL, (int64_t)0x2D412331DLL, (int64_t)0x3B0D245BFLL, (int64_t)0x15261232ALL, (int64_t)0x149659D8ALL, (int64_t)0x5D8044E8LL, (int64_t)0xFFFFFFFED2A50306LL, (int64_t)0x758F3BF8LL, (int64_t)0x1722BCF9ALL, (int64_t)0xFFFFFFFD53BC4A03LL, (int64_t)0xFFFFFFFF7DA787C7LL, (int64_t)0x1EC42077BLL, (int64_t)0x183C2911BLL, (int64_t)0x3FE01E68LL, (int64_t)0xFFFFFFFDE9141D64LL, (int64_t)0x3B481275FLL, (int64_t)0x1E1AE0807CLL, (int64_t)0xFFFFFFE8545F8E11LL, (int64_t)0x1BBBC80777LL, (int64_t)0x6E21BD94DLL, (int64_t)0x1207171A64LL, (int64_t)0xFFFFFFF75798C02FLL, (int64_t)0x131B77ACE6LL, (int64_t)0x1B8FA3EEF7LL, (int64_t)0xFFFFFFF181336B24LL, (int64_t)0xFFFFFFF3CD8241A8LL, (int64_t)0x1FA27F207FLL, (int64_t)0x138AA3FDE7LL, (int64_t)0x5811315CBLL, (int64_t)0xFFFFFFEAD2027816LL, (int64_t)0xFFFFFFEC38B5AC99LL, (int64_t)0xCD8EBFBD9LL, (int64_t)0x1B295D1876LL, (int64_t)0xFFFFFFE5CAE7598CLL, (int64_t)0x108DC49761LL, (int64_t)0xFC5EF42DFLL, (int64_t)0x4A7374B49LL, (int64_t)0x12D3743C65LL, (int64_t)0xFFFFFFE8BBF59492LL, (int64_t)0xFFFFFFFE11B2D4BDLL, (int64_t)0xFFFFFFF36F29BCA7LL, (int64_t)0x101ELL, (int64_t)0x1CECAFLL, (int64_t)0x3091LL, (int64_t)0x6967LL, (int64_t)0x1B06EA38LL, (int64_t)0x8614480LL, (int64_t)0x778A2944LL, (int64_t)0x18053LL, (int64_t)0x5FLL, (int64_t)0x2594D1C8LL, (int64_t)0x2D509F5LL, (int64_t)0x198BFBDLL, (int64_t)0x1DLL, (int64_t)0x176LL, (int64_t)0x13LL, (int64_t)0x3LL, (int64_t)0x1LL, (int64_t)0x172ELL, (int64_t)0x97BLL, (int64_t)0x31FD8LL, (int64_t)0x2DE75LL, (int64_t)0x87BF0A9ALL, (int64_t)0x14BB4LL, (int64_t)0x92CA24D9LL, (int64_t)0xBA1108LL, (int64_t)0xFFFFFFFFFBAE4D4FLL, (int64_t)0xFFFFFFFFFFF70BE7LL, (int64_t)0xFFFFFFFFFE59FB2DLL, (int64_t)0xFFFFFFFFFFFF27F2LL, (int64_t)0xFFFFFFFFFFFFE979LL, (int64_t)0xFFFFFFFFFFFFFFCFLL, (int64_t)0xFFFFFFFF217F21AELL, (int64_t)0xFFFFFFFFFFFF8E0FLL, (int64_t)0xFFFFFFFFFFFFFCB3LL, (int64_t)0xFFFFFFFFFFFFDFEELL, (int64_t)0xFFFFFFFFFF8F4262LL, (int64_t)0xFFFFFFFFFFFFF087LL, (int64_t)0xFFFFFFFFFFFF7A7ELL, (int64_t)0xFFFFFFFFFFFFF00CLL, (int64_t)0xFFFFFFFFFFFF8DE1LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFFFFFDBBLL, (int64_t)0xFFFFFFFFFFFFEDDFLL, (int64_t)0xFFFFFFFFFFFFFEDFLL, (int64_t)0xFFFFFFFFFFFFE79ALL, (int64_t)0xFFFFFFFFCA3C13D5LL, (int64_t)0xFFFFFFFFFE642CDCLL, (int64_t)0xFFFFFFFFFAE820AELL, (int64_t)0xFFFFFFFFFFF03663LL, (int64_t)0xFFFFFFFFFFBA20F4LL };
+		static const int64_t output0[] = { (int64_t)0xD7FE6EE8LL, (int64_t)0xAE3F2918LL, (int64_t)0x22D6451C8LL, (int64_t)0x117164E8LL, (int64_t)0x31DCEC43ALL, (int64_t)0x372EFBF3ELL, (int64_t)0x1D040DA87LL, (int64_t)0x2338E81F0LL, (int64_t)0x6D5FC78LL, (int64_t)0xB0667338LL, (int64_t)0x2E2C5B031LL, (int64_t)0x3B7219B3FLL, (int64_t)0x18EE49386LL, (int64_t)0x187D3E64ALL, (int64_t)0xE471036CLL, (int64_t)0x44C3DDE0LL, (int64_t)0xF2EA458CLL, (int64_t)0x1A84FE07ELL, (int64_t)0x1117EF0CLL, (int64_t)0x787B0DC8LL, (int64_t)0x20F2FB243LL, (int64_t)0x1B6A3D773LL, (int64_t)0xD35ED860LL, (int64_t)0x1DDDD8B0LL, (int64_t)0x3BAB9B12BLL, (int64_t)0x1E1AE0807CLL, (int64_t)0x0LL, (int64_t)0x1BBBC80777LL, (int64_t)0x6E25EFA21LL, (int64_t)0x1207171AA0LL, (int64_t)0xB62F8LL, (int64_t)0x131B77ACFALL, (int64_t)0x1B8FA3EEF7LL, (int64_t)0x87CLL, (int64_t)0x549CLL, (int64_t)0x1FA27F207FLL, (int64_t)0x138AA3FDF3LL, (int64_t)0x5821D40AFLL, (int64_t)0x4LL, (int64_t)0x8LL, (int64_t)0xCD8EC27FDLL, (int64_t)0x1B295D1876LL, (int64_t)0x0LL, (int64_t)0x108DC49875LL, (int64_t)0xFC5EF4537LL, (int64_t)0x4A9A4F895LL, (int64_t)0x12D3743C7DLL, (int64_t)0x0LL, (int64_t)0x22AB2D68LL, (int64_t)0x3A88LL, (int64_t)0xB1722016LL, (int64_t)0xB1808ECFLL, (int64_t)0xB1723049LL, (int64_t)0xB1724CBFLL, (int64_t)0xBF50D0FCLL, (int64_t)0xB5AB8150LL, (int64_t)0xF421653CLL, (int64_t)0xB172D82BLL, (int64_t)0xB1721837LL, (int64_t)0xC4ECE3B0LL, (int64_t)0xB2DD9DC1LL, (int64_t)0xB23EC98DLL, (int64_t)0xB1721815LL, (int64_t)0xB17218CELL, (int64_t)0xB172180BLL, (int64_t)0xB17217FBLL, (int64_t)0xB17217F9LL, (int64_t)0xB17223A6LL, (int64_t)0xB1721CD3LL, (int64_t)0xB173A7F0LL, (int64_t)0xB173874DLL, (int64_t)0xFE36814ALL, (int64_t)0xB172BDECLL, (int64_t)0x1053874CDLL, (int64_t)0xB1CF3168LL, (int64_t)0xAF4B93B4LL, (int64_t)0xB16D9E00LL, (int64_t)0xB09F6C94LL, (int64_t)0xB171ABF8LL, (int64_t)0xB1720CB8LL, (int64_t)0xB17217F8LL, (int64_t)0x59A49EACLL, (int64_t)0xB171DF18LL, (int64_t)0xB1721658LL, (int64_t)0xB17207F8LL, (int64_t)0xB139BF6CLL, (int64_t)0xB1721058LL, (int64_t)0xB171D538LL, (int64_t)0xB1721018LL, (int64_t)0xB171DEF8LL, (int64_t)0xB17217F8LL, (int64_t)0xB17216D8LL, (int64_t)0xB1720EF8LL, (int64_t)0xB1721778LL, (int64_t)0xB1720BD8LL, (int64_t)0x97F8CF30LL, (int64_t)0xB0A4814CLL, (int64_t)0xAEE9667CLL, (int64_t)0xB16A3354LL, (int64_t)0xB14F2AD8LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::Softplus", Fixed64::Softplus(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SoftplusFast()
+	static void Fixed64_SoftplusFast()
+	{
+		static const int64_t input0[] = { (int64_t)0x30BADF7BELL, (int64_t)0xFFFFFFFE78363705LL, (int64_t)0xCF11D879LL, (int64_t)0xFFFFFFFD29D2CB83LL, (int64_t)0xFFFFFFFD521CAB33LL, (int64_t)0xE60F6E49LL, (int64_t)0xFFFFFFFEADEE6D56LL, (int64_t)0xFFFFFFFE9757B926LL, (int64_t)0xFFFFFFFD6E743B33LL, (int64_t)0xFFFFFFFE73A6F8F5LL, (int64_t)0x25C96A90CLL, (int64_t)0x1F2DDF22BLL, (int64_t)0x267BC870CLL, (int64_t)0xFFFFFFFD17ABA133LL, (int64_t)0xCA9E4DA9LL, (int64_t)0x239C342FCLL, (int64_t)0xCFF33269LL, (int64_t)0x26132B63CLL, (int64_t)0x35D946D4ELL, (int64_t)0x1850E966BLL, (int64_t)0xFFFFFFFE26B80405LL, (int64_t)0x3E5732D8LL, (int64_t)0xFFFFFFFD2237AE33LL, (int64_t)0xFFFFFFFD01DEE1B3LL, (int64_t)0xFFFFFFFE866AB8A6LL, (int64_t)0xFFFFFFFB90FA64B8LL, (int64_t)0xFFFFFFE382C12208LL, (int64_t)0x1B0CD8EC76LL, (int64_t)0x179A35306FLL, (int64_t)0x1ABA6906F5LL, (int64_t)0xFFFFFFF5D76C612CLL, (int64_t)0x1AB88BE8F5LL, (int64_t)0x8690579D0LL, (int64_t)0xFFFFFFF42EA93229LL, (int64_t)0xFFFFFFE6350B9B0DLL, (int64_t)0xFFFFFFF406AC6C29LL, (int64_t)0x1F19F673FELL, (int64_t)0xFFFFFFF27E8C7525LL, (int64_t)0x192C9C8C3LL, (int64_t)0xFFFFFFFE7311C43DLL, (int64_t)0x1D53A79B7ALL, (int64_t)0x567194E4ALL, (int64_t)0x1033F68C2LL, (int64_t)0x1B30610C76LL, (int64_t)0x113C7221E2LL, (int64_t)0x800910150LL, (int64_t)0xFFFFFFE7B042AF90LL, (int64_t)0x8F5B5D6D1LL, (int64_t)0xFFFFFFF340B52227LL, (int64_t)0xFFFFFFF3ED88A0A8LL, (int64_t)0x11LL, (int64_t)0x1LL, (int64_t)0x2BLL, (int64_t)0x4E19LL, (int64_t)0x8LL, (int64_t)0x93ELL, (int64_t)0x28LL, (int64_t)0x93ABLL, (int64_t)0x5DE94C3LL, (int64_t)0xB4FFCBLL, (int64_t)0x39411LL, (int64_t)0x2491LL, (int64_t)0x5E95LL, (int64_t)0x148LL, (int64_t)0x764D08E5LL, (int64_t)0x10FC5A36LL, (int64_t)0xCLL, (int64_t)0xB8CALL, (int64_t)0x2LL, (int64_t)0x239LL, (int64_t)0x28D67C3LL, (int64_t)0x401LL, (int64_t)0x1A9LL, (int64_t)0x4B73LL, (int64_t)0xAABC87LL, (int64_t)0xFFFFFFFFFFC422D2LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFFFFFF86LL, (int64_t)0xFFFFFFFFFFFFF55DLL, (int64_t)0xFFFFFFFFFFBB7251LL, (int64_t)0xFFFFFFFFFFFFFC2BLL, (int64_t)0xFFFFFFFFFFFFD945LL, (int64_t)0xFFFFFFFFFFF115B7LL, (int64_t)0xFFFFFFFFFFFC6D3DLL, (int64_t)0xFFFFFFFFFDA290DELL, (int64_t)0xFFFFFFFFFFFFF8AALL, (int64_t)0xFFFFFFFFFF0F70B4LL, (int64_t)0xFFFFFFFFFFFFFFC4LL, (int64_t)0xFFFFFFFFFFFFFF79LL, (int64_t)0xFFFFFFFFFF11F091LL, (int64_t)0xFFFFFFFFFFFFFFE7LL, (int64_t)0xFFFFFFFFFFFEBAF6LL, (int64_t)0xFFFFFFFFFFFF9878LL, (int64_t)0xFFFFFFFFFD8F5EEBLL, (int64_t)0xFFFFFFFFD6332FC8LL, (int64_t)0xFFFFFFFFFFFD3A6ELL, (int64_t)0xFFFFFFFFFFFFFFEFLL, (int64_t)0xFFFFFFFFFFFFFEE6LL, (int64_t)0xFFFFFFFF9770E792LL, (int64_t)0xFFFFFFFFE8DE42E7LL };
+		static const int64_t output0[] = { (int64_t)0x3179379C6LL, (int64_t)0x3228A418LL, (int64_t)0x12D5EC7D5LL, (int64_t)0xE9581DCLL, (int64_t)0x10FD2220LL, (int64_t)0x13D7E59FDLL, (int64_t)0x3C943204LL, (int64_t)0x37FB59F4LL, (int64_t)0x12E80800LL, (int64_t)0x315A79E8LL, (int64_t)0x273A62E94LL, (int64_t)0x214F64B83LL, (int64_t)0x27DDB1784LL, (int64_t)0xD9CAC9CLL, (int64_t)0x12A4C821DLL, (int64_t)0x2540443D4LL, (int64_t)0x12DFAC569LL, (int64_t)0x277DD6F58LL, (int64_t)0x366460936LL, (int64_t)0x1B7B42C7BLL, (int64_t)0x256DAA1CLL, (int64_t)0xD2828124LL, (int64_t)0xE2B36D8LL, (int64_t)0xC870758LL, (int64_t)0x34BE9324LL, (int64_t)0x30566F4LL, (int64_t)0x0LL, (int64_t)0x1B0CD8EC76LL, (int64_t)0x179A35306FLL, (int64_t)0x1ABA6906F5LL, (int64_t)0x28A04LL, (int64_t)0x1AB88BE8F5LL, (int64_t)0x869140FB4LL, (int64_t)0x7BACLL, (int64_t)0x0LL, (int64_t)0x69C8LL, (int64_t)0x1F19F673FELL, (int64_t)0x16DCLL, (int64_t)0x1C30625CBLL, (int64_t)0x314056E0LL, (int64_t)0x1D53A79B7ALL, (int64_t)0x5683FD776LL, (int64_t)0x15292C11ALL, (int64_t)0x1B30610C76LL, (int64_t)0x113C72226ALL, (int64_t)0x800A6F010LL, (int64_t)0x0LL, (int64_t)0x8F5BE421DLL, (int64_t)0x30CCLL, (int64_t)0x5FE4LL, (int64_t)0xB1721809LL, (int64_t)0xB17217F9LL, (int64_t)0xB1721823LL, (int64_t)0xB1723F0DLL, (int64_t)0xB1721800LL, (int64_t)0xB1721CB2LL, (int64_t)0xB1721820LL, (int64_t)0xB17261DBLL, (int64_t)0xB4658C0FLL, (int64_t)0xB1CCA22BLL, (int64_t)0xB173E1E9LL, (int64_t)0xB1722A45LL, (int64_t)0xB1724749LL, (int64_t)0xB172189CLL, (int64_t)0xF35E7639LL, (int64_t)0xBA141E1ELL, (int64_t)0xB1721804LL, (int64_t)0xB172745ALL, (int64_t)0xB17217FALL, (int64_t)0xB172192DLL, (int64_t)0xB2B98977LL, (int64_t)0xB17219F5LL, (int64_t)0xB17218DDLL, (int64_t)0xB1723DC7LL, (int64_t)0xB1C77F17LL, (int64_t)0xB1542948LL, (int64_t)0xB17217F8LL, (int64_t)0xB17217D4LL, (int64_t)0xB17212B4LL, (int64_t)0xB14FD14CLL, (int64_t)0xB1721614LL, (int64_t)0xB17204B4LL, (int64_t)0xB16AA274LL, (int64_t)0xB1704E78LL, (int64_t)0xB04401D0LL, (int64_t)0xB1721454LL, (int64_t)0xB0F9E518LL, (int64_t)0xB17217F8LL, (int64_t)0xB17217B4LL, (int64_t)0xB0FB2494LL, (int64_t)0xB17217F8LL, (int64_t)0xB171756CLL, (int64_t)0xB171E434LL, (int64_t)0xB03A73D8LL, (int64_t)0x9D65E934LL, (int64_t)0xB170B520LL, (int64_t)0xB17217F8LL, (int64_t)0xB1721774LL, (int64_t)0x82778CDCLL, (int64_t)0xA623EA20LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SoftplusFast", Fixed64::SoftplusFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SoftplusFastest()
+	static void Fixed64_SoftplusFastest()
+	{
+		static const int64_t input0[] = { (int64_t)0xBB650C59LL, (int64_t)0xFFFFFFFFCA995F18LL, (int64_t)0xFFFFFFFCB4F63AA2LL, (int64_t)0x1B0A0D3BBLL, (int64_t)0x27E66338CLL, (int64_t)0x1C481508BLL, (int64_t)0xB92A4869LL, (int64_t)0xFFFFFFFE15F6E3C5LL, (int64_t)0xFFFFFFFEAA02BF46LL, (int64_t)0xFFFFFFFC7DCF99E1LL, (int64_t)0x1EA5267DBLL, (int64_t)0xFFFFFFFF1CECC017LL, (int64_t)0xFFFFFFFCB7E898E2LL, (int64_t)0x1E05CFBCBLL, (int64_t)0x129450AFALL, (int64_t)0xFFFFFFFF0E930B07LL, (int64_t)0x369C707DELL, (int64_t)0x3BE8427FFLL, (int64_t)0xFFFFFFFC08273A31LL, (int64_t)0xFFFFFFFF62070657LL, (int64_t)0xDA92EFD9LL, (int64_t)0x3B2E5047FLL, (int64_t)0x329ECD1EELL, (int64_t)0x3B92911CFLL, (int64_t)0x3FF94E72FLL, (int64_t)0xFFFFFFF4AA93762ALL, (int64_t)0xFFFFFFEF314D8F1FLL, (int64_t)0xFFFFFFEE444E189DLL, (int64_t)0xFFFFFFFFDD200340LL, (int64_t)0xFFFFFFF47D4441A9LL, (int64_t)0x60FCC1C0LL, (int64_t)0xFFFFFFF32B397427LL, (int64_t)0xFFFFFFEAE66AF416LL, (int64_t)0xFFFFFFF4FB93EDAALL, (int64_t)0x1110578D62LL, (int64_t)0x1BFDD3A4F7LL, (int64_t)0x1DEE7AD3FBLL, (int64_t)0xFFFFFFF956D40133LL, (int64_t)0xFFFFFFEDF788F41CLL, (int64_t)0xFFFFFFE709E4418FLL, (int64_t)0xFFFFFFF66A89212DLL, (int64_t)0xFFFFFFFBD19413B8LL, (int64_t)0x1BB016B8F7LL, (int64_t)0xFFFFFFEF85690FA0LL, (int64_t)0xFFFFFFF76AD5902FLL, (int64_t)0x1503625E6ALL, (int64_t)0xFFFFFFE8B3BFF992LL, (int64_t)0xFFFFFFF864BAFAB1LL, (int64_t)0xFFFFFFE4E164C78ALL, (int64_t)0x180AEF04F0LL, (int64_t)0x35B35LL, (int64_t)0x320981E7LL, (int64_t)0x1BE8C15LL, (int64_t)0x154F0LL, (int64_t)0x2684BFLL, (int64_t)0x118AFALL, (int64_t)0x5B2C3LL, (int64_t)0xFLL, (int64_t)0x6CDC98LL, (int64_t)0xC7B8LL, (int64_t)0xB1CCLL, (int64_t)0xD8BLL, (int64_t)0x15473CDLL, (int64_t)0x1LL, (int64_t)0x36CF5LL, (int64_t)0x4380LL, (int64_t)0x80LL, (int64_t)0x14DA767LL, (int64_t)0x7DB1562DLL, (int64_t)0x645CEDLL, (int64_t)0x265ELL, (int64_t)0x1FA11LL, (int64_t)0xFED295LL, (int64_t)0x18633866LL, (int64_t)0x5LL, (int64_t)0xFFFFFFFFFFFFFFD3LL, (int64_t)0xFFFFFFFFFFFFFFFFLL, (int64_t)0xFFFFFFFFFFE2419DLL, (int64_t)0xFFFFFFFFFFF6E8A7LL, (int64_t)0xFFFFFFFFFFFFFFD4LL, (int64_t)0xFFFFFFFFFFFFFFC1LL, (int64_t)0xFFFFFFFFF5727ACDLL, (int64_t)0xFFFFFFFFFFFFFFE7LL, (int64_t)0xFFFFFFFFFFF0F64DLL, (int64_t)0xFFFFFFFFFE9683C1LL, (int64_t)0xFFFFFFFFFFFA2A7BLL, (int64_t)0xFFFFFFFFFFFE47E2LL, (int64_t)0xFFFFFFFFFFDF2D1BLL, (int64_t)0xFFFFFFFFFFDAA0CDLL, (int64_t)0xFFFFFFFFFFFFFFEBLL, (int64_t)0xFFFFFFFFFFFFF4CELL, (int64_t)0xFFFFFFFFF7D2F5DBLL, (int64_t)0xFFFFFFFFFFC426E4LL, (int64_t)0xFFFFFFFFFF5DCCA7LL, (int64_t)0xFFFFFFFFFFEF7D94LL, (int64_t)0xFFFFFFFF515AED03LL, (int64_t)0xFFFFFFFFFFD2CEA0LL, (int64_t)0xFFFFFFFFD4D2DF45LL, (int64_t)0xFFFFFFFFFFC0B276LL, (int64_t)0xFFFFFFFFCE6A7CE8LL };
+		static const int64_t output0[] = { (int64_t)0x11FECC1A1LL, (int64_t)0x9823CB10LL, (int64_t)0x954B8ECLL, (int64_t)0x1DBFE520FLL, (int64_t)0x292B6EF6CLL, (int64_t)0x1ECDB20FBLL, (int64_t)0x11E6C56F1LL, (int64_t)0x2330DFFCLL, (int64_t)0x3BBD0AC8LL, (int64_t)0x78D9C94LL, (int64_t)0x20D79E32BLL, (int64_t)0x5847F69CLL, (int64_t)0x9701FC0LL, (int64_t)0x204D1452BLL, (int64_t)0x16F05E172LL, (int64_t)0x542E37A8LL, (int64_t)0x372109DAELL, (int64_t)0x3C48056E3LL, (int64_t)0x4CADD84LL, (int64_t)0x6E79D358LL, (int64_t)0x1355DE455LL, (int64_t)0x3B9282437LL, (int64_t)0x3348780FELL, (int64_t)0x3BF45910FLL, (int64_t)0x4043C423BLL, (int64_t)0xC884LL, (int64_t)0xD4LL, (int64_t)0x54LL, (int64_t)0xA09C01A4LL, (int64_t)0xA82CLL, (int64_t)0xE67F6B88LL, (int64_t)0x2CD4LL, (int64_t)0x4LL, (int64_t)0x11378LL, (int64_t)0x1110578E06LL, (int64_t)0x1BFDD3A4F7LL, (int64_t)0x1DEE7AD3FBLL, (int64_t)0x53E5E0LL, (int64_t)0x3CLL, (int64_t)0x0LL, (int64_t)0x483B8LL, (int64_t)0x3E23F68LL, (int64_t)0x1BB016B8F7LL, (int64_t)0x12CLL, (int64_t)0xC4908LL, (int64_t)0x1503625E6ELL, (int64_t)0x0LL, (int64_t)0x209AC8LL, (int64_t)0x0LL, (int64_t)0x180AEF04F0LL, (int64_t)0xB173C621LL, (int64_t)0xCBB0BA1BLL, (int64_t)0xB251F9F9LL, (int64_t)0xB172C2B4LL, (int64_t)0xB185605FLL, (int64_t)0xB17AE016LL, (int64_t)0xB174F223LL, (int64_t)0xB1721807LL, (int64_t)0xB1A89AB4LL, (int64_t)0xB1727C08LL, (int64_t)0xB17270FCLL, (int64_t)0xB1721EC3LL, (int64_t)0xB21CB779LL, (int64_t)0xB17217F9LL, (int64_t)0xB173CF05LL, (int64_t)0xB17239C0LL, (int64_t)0xB1721838LL, (int64_t)0xB2194E33LL, (int64_t)0xF7EDAA95LL, (int64_t)0xB1A458E9LL, (int64_t)0xB1722B3ALL, (int64_t)0xB173154DLL, (int64_t)0xB1F1C2DDLL, (int64_t)0xBDEFF4D2LL, (int64_t)0xB17217FDLL, (int64_t)0xB17217F8LL, (int64_t)0xB17217F8LL, (int64_t)0xB1633D48LL, (int64_t)0xB16D8D9CLL, (int64_t)0xB17217F8LL, (int64_t)0xB17217F8LL, (int64_t)0xAC3A6BC4LL, (int64_t)0xB17217F8LL, (int64_t)0xB16A955CLL, (int64_t)0xB0BDC974LL, (int64_t)0xB16F2E04LL, (int64_t)0xB1713C30LL, (int64_t)0xB161B38CLL, (int64_t)0xB15F6E30LL, (int64_t)0xB17217F8LL, (int64_t)0xB1721278LL, (int64_t)0xAD64E118LL, (int64_t)0xB1543544LL, (int64_t)0xB12120E0LL, (int64_t)0xB169D934LL, (int64_t)0x68BFF11CLL, (int64_t)0xB15B866CLL, (int64_t)0x9CC60934LL, (int64_t)0xB1527BB0LL, (int64_t)0x99DB9E74LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SoftplusFastest", Fixed64::SoftplusFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Softplus()
+	static void Fixed32_Softplus()
+	{
+		static const int32_t input0[] = { (int32_t)0x2C50A, (int32_t)0xFFFD7F50, (int32_t)0x24005, (int32_t)0x30B5D, (int32_t)0x3BEF3, (int32_t)0xFFFF8A79, (int32_t)0xFFFE39AA, (int32_t)0xFFFE0F4A, (int32_t)0xFFFDEBC0, (int32_t)0xFFFF2929, (int32_t)0xFFFE9996, (int32_t)0x7C5D, (int32_t)0xFFFE2EC4, (int32_t)0x2DC42, (int32_t)0xFFFCF654, (int32_t)0xFFFEA4F1, (int32_t)0xFFFE7965, (int32_t)0xFFFD06A3, (int32_t)0xFFFE2E79, (int32_t)0x1C003, (int32_t)0xFFFD16B9, (int32_t)0xBED9, (int32_t)0xFFFC63D1, (int32_t)0x1379F, (int32_t)0x52A5, (int32_t)0xFFFE2289, (int32_t)0xFFF60787, (int32_t)0x1A5F2C, (int32_t)0xFFF8C638, (int32_t)0xFFE91F68, (int32_t)0xBD1BA, (int32_t)0xFFF39B66, (int32_t)0xFFEA1A7A, (int32_t)0x12FDFD, (int32_t)0x129F14, (int32_t)0xFFE5BFEA, (int32_t)0x8800, (int32_t)0x94259, (int32_t)0x1D24F4, (int32_t)0xFFFE29AB, (int32_t)0x1A012C, (int32_t)0xFFFF9084, (int32_t)0xFFE0B241, (int32_t)0xFFFF0FE0, (int32_t)0xFFEDBEAC, (int32_t)0x110EE3, (int32_t)0x1271EE, (int32_t)0xFFF87870, (int32_t)0x7CF98, (int32_t)0xFFE420B5, (int32_t)0x4, (int32_t)0x7, (int32_t)0x8ACE, (int32_t)0x6260, (int32_t)0x405, (int32_t)0x1B, (int32_t)0x8, (int32_t)0x7, (int32_t)0x44, (int32_t)0x160, (int32_t)0x5, (int32_t)0x59, (int32_t)0x4282, (int32_t)0x5, (int32_t)0xC9B, (int32_t)0x2, (int32_t)0x83, (int32_t)0x11A, (int32_t)0x3, (int32_t)0x2, (int32_t)0x2852, (int32_t)0x7D4, (int32_t)0xC, (int32_t)0x2077, (int32_t)0x246A, (int32_t)0xFFFFF9C1, (int32_t)0xFFFFFCAD, (int32_t)0xFFFFFD45, (int32_t)0xFFFFFF44, (int32_t)0xFFFFE7A1, (int32_t)0xFFFFF68E, (int32_t)0xFFFF53CF, (int32_t)0xFFFFFFD8, (int32_t)0xFFFFFFC7, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFD7A, (int32_t)0xFFFFFFA7, (int32_t)0xFFFFFFE6, (int32_t)0xFFFFFFF1, (int32_t)0xFFFFFDE7, (int32_t)0xFFFF6588, (int32_t)0xFFFFFF99, (int32_t)0xFFFFFFD1, (int32_t)0xFFFFFF17, (int32_t)0xFFFFFFA0, (int32_t)0xFFFFFDDA, (int32_t)0xFFFFFAEE, (int32_t)0xFFFF980F, (int32_t)0xFFFFE759, (int32_t)0xFFFFFFF1 };
+		static const int32_t output0[] = { (int32_t)0x2D49A, (int32_t)0x1424, (int32_t)0x259AB, (int32_t)0x31746, (int32_t)0x3C4EC, (int32_t)0x7D5E, (int32_t)0x2816, (int32_t)0x225D, (int32_t)0x1E29, (int32_t)0x5BEE, (int32_t)0x386C, (int32_t)0xF71B, (int32_t)0x2689, (int32_t)0x2EA82, (int32_t)0xBFC, (int32_t)0x3AB5, (int32_t)0x325E, (int32_t)0xCC1, (int32_t)0x267F, (int32_t)0x1E907, (int32_t)0xD90, (int32_t)0x12241, (int32_t)0x6D5, (int32_t)0x17A01, (int32_t)0xDE16, (int32_t)0x24DD, (int32_t)0x3, (int32_t)0x1A5F2C, (int32_t)0x2F, (int32_t)0x0, (int32_t)0xBD1BA, (int32_t)0x0, (int32_t)0x0, (int32_t)0x12FDFD, (int32_t)0x129F14, (int32_t)0x0, (int32_t)0xFE5F, (int32_t)0x9425F, (int32_t)0x1D24F4, (int32_t)0x25D4, (int32_t)0x1A012C, (int32_t)0x7FB9, (int32_t)0x0, (int32_t)0x548F, (int32_t)0x0, (int32_t)0x110EE3, (int32_t)0x1271EE, (int32_t)0x23, (int32_t)0x7CFB2, (int32_t)0x0, (int32_t)0xB174, (int32_t)0xB175, (int32_t)0x10024, (int32_t)0xE754, (int32_t)0xB376, (int32_t)0xB17F, (int32_t)0xB176, (int32_t)0xB175, (int32_t)0xB194, (int32_t)0xB222, (int32_t)0xB174, (int32_t)0xB19E, (int32_t)0xD4DA, (int32_t)0xB174, (int32_t)0xB7D3, (int32_t)0xB173, (int32_t)0xB1B3, (int32_t)0xB1FF, (int32_t)0xB173, (int32_t)0xB173, (int32_t)0xC666, (int32_t)0xB563, (int32_t)0xB178, (int32_t)0xC231, (int32_t)0xC44C, (int32_t)0xAE57, (int32_t)0xAFC9, (int32_t)0xB015, (int32_t)0xB114, (int32_t)0xA58C, (int32_t)0xACC4, (int32_t)0x6990, (int32_t)0xB15E, (int32_t)0xB155, (int32_t)0xB170, (int32_t)0xB02F, (int32_t)0xB145, (int32_t)0xB165, (int32_t)0xB16A, (int32_t)0xB066, (int32_t)0x6FB0, (int32_t)0xB13E, (int32_t)0xB15A, (int32_t)0xB0FD, (int32_t)0xB142, (int32_t)0xB05F, (int32_t)0xAEEC, (int32_t)0x82B6, (int32_t)0xA56A, (int32_t)0xB16A };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::Softplus", Fixed32::Softplus(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SoftplusFast()
+	static void Fixed32_SoftplusFast()
+	{
+		static const int32_t input0[] = { (int32_t)0x1C123, (int32_t)0xFFFE4584, (int32_t)0xFFFE183D, (int32_t)0x182A1, (int32_t)0x15CC5, (int32_t)0x13EF1, (int32_t)0xFFFF899F, (int32_t)0x37F9B, (int32_t)0x19ED7, (int32_t)0xFFFE945E, (int32_t)0xFFFFCC5A, (int32_t)0xFFFFC46B, (int32_t)0x385C2, (int32_t)0xDC92, (int32_t)0x251D6, (int32_t)0x33DDC, (int32_t)0x1FC2B, (int32_t)0x2CA99, (int32_t)0x175FA, (int32_t)0x15BA6, (int32_t)0xFFFDEB9F, (int32_t)0xFFFFD835, (int32_t)0x392CC, (int32_t)0xFFFE7FCB, (int32_t)0x18B7E, (int32_t)0xFFE52491, (int32_t)0xFFEDF530, (int32_t)0x1418CB, (int32_t)0xFFE53026, (int32_t)0xFD39B, (int32_t)0xFFFE7B0C, (int32_t)0x1D8F2B, (int32_t)0xFFF4DDA5, (int32_t)0xFFF19AA3, (int32_t)0x332D, (int32_t)0x1E0EFC, (int32_t)0x17644, (int32_t)0x131F02, (int32_t)0x8A0B1, (int32_t)0x4B3F1, (int32_t)0xC9C6D, (int32_t)0xFFEAD71B, (int32_t)0x10D83C, (int32_t)0xFFF90F54, (int32_t)0x16F010, (int32_t)0x10B362, (int32_t)0x1353A7, (int32_t)0x14D84B, (int32_t)0x59787, (int32_t)0x193CF2, (int32_t)0x2B, (int32_t)0x2EF0, (int32_t)0xF3, (int32_t)0x36A7, (int32_t)0x2, (int32_t)0x17, (int32_t)0x42, (int32_t)0x9754, (int32_t)0xF4BD, (int32_t)0x39A, (int32_t)0xBD, (int32_t)0x55C, (int32_t)0x396D, (int32_t)0xA0CA, (int32_t)0x33B9, (int32_t)0x19E, (int32_t)0x9, (int32_t)0x7E2, (int32_t)0x5, (int32_t)0x2784, (int32_t)0x6A, (int32_t)0x9736, (int32_t)0x12, (int32_t)0x6, (int32_t)0xC0BE, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFF273, (int32_t)0xFFFFFD7E, (int32_t)0xFFFFFF20, (int32_t)0xFFFF818D, (int32_t)0xFFFFFFDC, (int32_t)0xFFFFFF8A, (int32_t)0xFFFFFFEB, (int32_t)0xFFFFFFF3, (int32_t)0xFFFFFF25, (int32_t)0xFFFFF9FA, (int32_t)0xFFFFFE96, (int32_t)0xFFFFFEEB, (int32_t)0xFFFFFFE4, (int32_t)0xFFFFFFE1, (int32_t)0xFFFFFA66, (int32_t)0xFFFFFCF8, (int32_t)0xFFFFDEF5, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFFCD, (int32_t)0xFFFFDD41, (int32_t)0xFFFFFDBC, (int32_t)0xFFFFFFB8 };
+		static const int32_t output0[] = { (int32_t)0x1E9FC, (int32_t)0x29D7, (int32_t)0x2381, (int32_t)0x1B5B6, (int32_t)0x19721, (int32_t)0x17FAB, (int32_t)0x7D09, (int32_t)0x3873B, (int32_t)0x1CD0B, (int32_t)0x3766, (int32_t)0x98EC, (int32_t)0x9562, (int32_t)0x38D35, (int32_t)0x136C9, (int32_t)0x269D7, (int32_t)0x347AD, (int32_t)0x21D1F, (int32_t)0x2D9D6, (int32_t)0x1AB65, (int32_t)0x1963C, (int32_t)0x1E25, (int32_t)0x9E52, (int32_t)0x399E1, (int32_t)0x3386, (int32_t)0x1BCFE, (int32_t)0x0, (int32_t)0x0, (int32_t)0x1418CB, (int32_t)0x0, (int32_t)0xFD39B, (int32_t)0x32AA, (int32_t)0x1D8F2B, (int32_t)0x0, (int32_t)0x0, (int32_t)0xCC4F, (int32_t)0x1E0EFC, (int32_t)0x1ABA1, (int32_t)0x131F02, (int32_t)0x8A0BC, (int32_t)0x4B640, (int32_t)0xC9C6D, (int32_t)0x0, (int32_t)0x10D83C, (int32_t)0x3F, (int32_t)0x16F010, (int32_t)0x10B362, (int32_t)0x1353A7, (int32_t)0x14D84B, (int32_t)0x5987A, (int32_t)0x193CF2, (int32_t)0xB187, (int32_t)0xC9FD, (int32_t)0xB1EB, (int32_t)0xCE3A, (int32_t)0xB173, (int32_t)0xB17D, (int32_t)0xB193, (int32_t)0x10821, (int32_t)0x14802, (int32_t)0xB340, (int32_t)0xB1D0, (int32_t)0xB423, (int32_t)0xCFC4, (int32_t)0x10E42, (int32_t)0xCC9C, (int32_t)0xB241, (int32_t)0xB176, (int32_t)0xB56A, (int32_t)0xB174, (int32_t)0xC5F7, (int32_t)0xB1A7, (int32_t)0x1080E, (int32_t)0xB17B, (int32_t)0xB175, (int32_t)0x1238B, (int32_t)0xB170, (int32_t)0xAAC2, (int32_t)0xB031, (int32_t)0xB102, (int32_t)0x79F3, (int32_t)0xB160, (int32_t)0xB137, (int32_t)0xB167, (int32_t)0xB16B, (int32_t)0xB104, (int32_t)0xAE73, (int32_t)0xB0BD, (int32_t)0xB0E7, (int32_t)0xB164, (int32_t)0xB162, (int32_t)0xAEA8, (int32_t)0xAFEF, (int32_t)0xA174, (int32_t)0xB170, (int32_t)0xB16E, (int32_t)0xB170, (int32_t)0xB158, (int32_t)0xA0A9, (int32_t)0xB050, (int32_t)0xB14E };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SoftplusFast", Fixed32::SoftplusFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SoftplusFastest()
+	static void Fixed32_SoftplusFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0x28C18, (int32_t)0xFFFC4FB1, (int32_t)0xFFFE4118, (int32_t)0xFFFE198F, (int32_t)0x12CD6, (int32_t)0x3EB6E, (int32_t)0x30E4E, (int32_t)0x17187, (int32_t)0xFFFC6FD4, (int32_t)0x1DFA2, (int32_t)0xFFFCCA1A, (int32_t)0x3FCC, (int32_t)0xE4F9, (int32_t)0x25EC, (int32_t)0x31771, (int32_t)0xFFFF011B, (int32_t)0xFFFEFEE4, (int32_t)0xFFFE51B7, (int32_t)0x15FB7, (int32_t)0x3EB7D, (int32_t)0x35B16, (int32_t)0x2F034, (int32_t)0xFFFEA792, (int32_t)0x21544, (int32_t)0x508E, (int32_t)0x194AB5, (int32_t)0xFFE5400D, (int32_t)0x1624E9, (int32_t)0xFFF4AF64, (int32_t)0xFFFE7DFE, (int32_t)0xFFE28D22, (int32_t)0xA2EF, (int32_t)0xAB667, (int32_t)0x101C08, (int32_t)0xFFEA3771, (int32_t)0xFFEC50AC, (int32_t)0xFFE8204B, (int32_t)0xFFEA1377, (int32_t)0x73198, (int32_t)0x1C9717, (int32_t)0xFFF94A01, (int32_t)0xFFE82890, (int32_t)0xFFF96FF4, (int32_t)0xEA324, (int32_t)0xFFE69F22, (int32_t)0x9AB58, (int32_t)0xFFFBD24A, (int32_t)0xFFE2EB29, (int32_t)0x11D779, (int32_t)0x106871, (int32_t)0x1229, (int32_t)0x7, (int32_t)0x27, (int32_t)0xF17B, (int32_t)0x32, (int32_t)0x99FF, (int32_t)0xC2D, (int32_t)0x1C4, (int32_t)0xE64, (int32_t)0x135E, (int32_t)0x6247, (int32_t)0x2, (int32_t)0x52, (int32_t)0x330, (int32_t)0xAAA, (int32_t)0x38E, (int32_t)0x3E19, (int32_t)0x3BC5, (int32_t)0x53, (int32_t)0xAA1, (int32_t)0x1A, (int32_t)0x13, (int32_t)0x8F4, (int32_t)0xEAC, (int32_t)0x3CA, (int32_t)0xFFFFE28E, (int32_t)0xFFFFFEF8, (int32_t)0xFFFFFBDF, (int32_t)0xFFFFF8C6, (int32_t)0xFFFFAFE6, (int32_t)0xFFFFFF10, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFD2B, (int32_t)0xFFFFF066, (int32_t)0xFFFF9786, (int32_t)0xFFFFFFEC, (int32_t)0xFFFFF775, (int32_t)0xFFFFFF3E, (int32_t)0xFFFFFFEF, (int32_t)0xFFFFFECA, (int32_t)0xFFFFFBC3, (int32_t)0xFFFFFF4A, (int32_t)0xFFFFC3DB, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFAD, (int32_t)0xFFFFE884, (int32_t)0xFFFFD8E5, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFE5B };
+		static const int32_t output0[] = { (int32_t)0x29F66, (int32_t)0x653, (int32_t)0x292E, (int32_t)0x23A7, (int32_t)0x171BD, (int32_t)0x3F074, (int32_t)0x31A16, (int32_t)0x1A7C5, (int32_t)0x729, (int32_t)0x2042F, (int32_t)0xA20, (int32_t)0xD353, (int32_t)0x13CB3, (int32_t)0xC51D, (int32_t)0x322D2, (int32_t)0x507D, (int32_t)0x4FE6, (int32_t)0x2BBB, (int32_t)0x19974, (int32_t)0x3F083, (int32_t)0x363DB, (int32_t)0x2FD67, (int32_t)0x3B3B, (int32_t)0x23355, (int32_t)0xDCDF, (int32_t)0x194AB5, (int32_t)0x0, (int32_t)0x1624E9, (int32_t)0x0, (int32_t)0x3333, (int32_t)0x0, (int32_t)0x10FAE, (int32_t)0xAB668, (int32_t)0x101C08, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x0, (int32_t)0x731C9, (int32_t)0x1C9717, (int32_t)0x4F, (int32_t)0x0, (int32_t)0x5C, (int32_t)0xEA324, (int32_t)0x0, (int32_t)0x9AB5C, (int32_t)0x3E5, (int32_t)0x0, (int32_t)0x11D779, (int32_t)0x106871, (int32_t)0xBAB1, (int32_t)0xB175, (int32_t)0xB185, (int32_t)0x145A5, (int32_t)0xB18B, (int32_t)0x109DF, (int32_t)0xB79C, (int32_t)0xB254, (int32_t)0xB8BF, (int32_t)0xBB51, (int32_t)0xE743, (int32_t)0xB173, (int32_t)0xB19B, (int32_t)0xB30B, (int32_t)0xB6D6, (int32_t)0xB33B, (int32_t)0xD25F, (int32_t)0xD112, (int32_t)0xB19B, (int32_t)0xB6D1, (int32_t)0xB17F, (int32_t)0xB17B, (int32_t)0xB5F7, (int32_t)0xB8E4, (int32_t)0xB359, (int32_t)0xA327, (int32_t)0xB0EE, (int32_t)0xAF64, (int32_t)0xADDC, (int32_t)0x8C82, (int32_t)0xB0FA, (int32_t)0xB171, (int32_t)0xB170, (int32_t)0xB008, (int32_t)0xA9C5, (int32_t)0x827E, (int32_t)0xB168, (int32_t)0xAD36, (int32_t)0xB111, (int32_t)0xB169, (int32_t)0xB0D7, (int32_t)0xAF56, (int32_t)0xB117, (int32_t)0x9523, (int32_t)0xB171, (int32_t)0xB148, (int32_t)0xA5FA, (int32_t)0x9EA5, (int32_t)0xB171, (int32_t)0xB0A0 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SoftplusFastest", Fixed32::SoftplusFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Sin()
 	static void Fixed64_Sin()
 	{
@@ -911,6 +1290,15 @@ namespace UnitTest
 			Util::Check("Fixed64::SinFastest", Fixed64::SinFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.SinUltra()
+	static void Fixed64_SinUltra()
+	{
+		static const int64_t input0[] = { (int64_t)0x154CD0F822LL, (int64_t)0xFFFFFFC0111CF5D9LL, (int64_t)0x3F5AC6C616LL, (int64_t)0x627CB2464CLL, (int64_t)0xFFFFFFC4EF40A7A2LL, (int64_t)0xFFFFFFCC2E0416B1LL, (int64_t)0xFFFFFFED7E13D923LL, (int64_t)0xFFFFFFFFD6084578LL, (int64_t)0x4E57DA53B4LL, (int64_t)0x3B4F2E3CAELL, (int64_t)0x39EEB6C14BLL, (int64_t)0xFFFFFFE39F4FAE60LL, (int64_t)0xFFFFFFCB34886E5FLL, (int64_t)0xFFFFFFCE8D5D5076LL, (int64_t)0xFFFFFFEB8EBBD590LL, (int64_t)0x2B4887516ELL, (int64_t)0xFFFFFFA6920BE826LL, (int64_t)0xFFFFFFBBDF88CD90LL, (int64_t)0x48C98B3339LL, (int64_t)0x25BA207F53LL, (int64_t)0xFFFFFFE8451FE189LL, (int64_t)0x2F680C7716LL, (int64_t)0xFFFFFFBDC3D21464LL, (int64_t)0xFFFFFFF3303AA70FLL, (int64_t)0xFFFFFFAFED0079F8LL, (int64_t)0xFFFFFFC2CE4B71CELL, (int64_t)0x38BE5BC239LL, (int64_t)0x5FD91886E7LL, (int64_t)0xFFFFFFB11986057BLL, (int64_t)0x27ECA269F7LL, (int64_t)0x3E58165124LL, (int64_t)0xFFFFFFFB3151475FLL, (int64_t)0xFFFFFFBD44B0BB03LL, (int64_t)0xFFFFFFD4EAC6ADB2LL, (int64_t)0xFFFFFFC9147A611BLL, (int64_t)0x295943AA5ALL, (int64_t)0xFFFFFFAD8F8A9FF4LL, (int64_t)0x30BAE941B9LL, (int64_t)0x50E9A618E9LL, (int64_t)0xFFFFFFA51AC48393LL, (int64_t)0x51AB8673BBLL, (int64_t)0xFFFFFF9F91CA1598LL, (int64_t)0xFFFFFFC7DBF91A88LL, (int64_t)0xFFFFFFD769918B47LL, (int64_t)0xFFFFFFDBA0216100LL, (int64_t)0x1D5D275192LL, (int64_t)0x417733555ALL, (int64_t)0xFFFFFFD105FB6C9BLL, (int64_t)0x32C22A651DLL, (int64_t)0x24D8C92661LL, (int64_t)0xB368F215E511LL, (int64_t)0xFFFF510786502850LL, (int64_t)0xFFFF2A5F9ECB9300LL, (int64_t)0xFFFFA6DDBAF9047CLL, (int64_t)0xFFFFBFAD497E8C9BLL, (int64_t)0x120A59F98160BLL, (int64_t)0xFFFE825DEC80AF7CLL, (int64_t)0xFFFFA2E63359388DLL, (int64_t)0x132E14E862C82LL, (int64_t)0xFFFE81B0BDDA4522LL, (int64_t)0xFFFFDE8C2989F059LL, (int64_t)0xFFFFC7EC75B93799LL, (int64_t)0xFFFFACF05CC9F621LL, (int64_t)0xFFFF0F72D26909A6LL, (int64_t)0x17AC5357012CALL, (int64_t)0xFFFF6E73D46447A8LL, (int64_t)0xFFFF0F31FCE6A224LL, (int64_t)0x160B01CD8A220LL, (int64_t)0xFFFE8EC03676FB41LL, (int64_t)0x9540DD68C4C1LL, (int64_t)0x647A9B154A35LL, (int64_t)0xFFFF6AF05F5A14A1LL, (int64_t)0xFFFF40707D91A821LL, (int64_t)0xF8C2B81E25C5LL, (int64_t)0xDAF909BD4A32LL, (int64_t)0xFFFF955C8724A6FALL, (int64_t)0xDDB2BA18EF6LL, (int64_t)0x122708C179821LL, (int64_t)0xFFFED56AE2B9AB16LL, (int64_t)0xFFFFDB21E845CB04LL, (int64_t)0xFFFF97DC362F1FF9LL, (int64_t)0xE88384E76D0LL, (int64_t)0xFFFF29819233FDC4LL, (int64_t)0xFFFFC27CE1C777BALL, (int64_t)0x16F2B68580B16LL, (int64_t)0x1BE090DCCF01LL, (int64_t)0xFFFF3C3906B335B3LL, (int64_t)0xDB1697617D6DLL, (int64_t)0x11EA7CE97F20FLL, (int64_t)0xFFFF8F725E733825LL, (int64_t)0x9886C3D0C2CDLL, (int64_t)0xA1B282279525LL, (int64_t)0x11218D0A28FF1LL, (int64_t)0x133BFF2F70C3FLL, (int64_t)0x4504661802C8LL, (int64_t)0xFFFFF0798F7ADC34LL, (int64_t)0x6101209A6042LL, (int64_t)0xFFFE8EA072A69881LL, (int64_t)0xFFFF6D4F2B17F9DFLL, (int64_t)0xFFFE7CD5ADFE9D6CLL };
+		static const int64_t output0[] = { (int64_t)0xA3293C1CLL, (int64_t)0xFFFFFFFF1BB53F0CLL, (int64_t)0x7FCD50A4LL, (int64_t)0xFFFFFFFF1C212AB4LL, (int64_t)0xFFFFFFFF6A4266ECLL, (int64_t)0xFFFFFFFF000CE3ECLL, (int64_t)0x55DD677CLL, (int64_t)0xFFFFFFFFD63904E4LL, (int64_t)0x32042270LL, (int64_t)0x5F2D4C0CLL, (int64_t)0xFB850A54LL, (int64_t)0x1A692AA8LL, (int64_t)0xFFFFFFFF6CDEA67CLL, (int64_t)0xBAC1BC4CLL, (int64_t)0xFFFFFFFF0011C4ACLL, (int64_t)0xFFFFFFFF5B4AC0ACLL, (int64_t)0xFFFFFFFF017343FCLL, (int64_t)0xD5C27AC8LL, (int64_t)0xFFFFFFFF7E730118LL, (int64_t)0x7272FD4LL, (int64_t)0xFC62633CLL, (int64_t)0xFFFFFFFFB8A18DCCLL, (int64_t)0x42361B80LL, (int64_t)0xFFFFFFFFC1D8F660LL, (int64_t)0xFFCFA8F4LL, (int64_t)0xFF697ED4LL, (int64_t)0x319554D4LL, (int64_t)0xFFE06A78LL, (int64_t)0x5A4ABFB4LL, (int64_t)0xCB17D5D4LL, (int64_t)0xFFFFFFFF88078884LL, (int64_t)0xFED679E8LL, (int64_t)0xB007D7F8LL, (int64_t)0xC86BC498LL, (int64_t)0xFF8DCA44LL, (int64_t)0xFFFFFFFF837C3034LL, (int64_t)0xFFFFFFFF5008FCFCLL, (int64_t)0xFFFFFFFF002E02D0LL, (int64_t)0xFFFFFFFF4E096BACLL, (int64_t)0xFFFFFFFFCA736DCCLL, (int64_t)0xFFFFFFFFFD15B5E0LL, (int64_t)0xFFFFFFFF2E754A9CLL, (int64_t)0x658D67B8LL, (int64_t)0xFFFFFFFFBFE79C24LL, (int64_t)0xF847A330LL, (int64_t)0xFFFFFFFF1D17EB3CLL, (int64_t)0x7C7A4D88LL, (int64_t)0xFFFFFFFFDA702D4CLL, (int64_t)0x792633C0LL, (int64_t)0xFFFFFFFF3F4C0248LL, (int64_t)0xFFFFFFFF1785B194LL, (int64_t)0x586BEF70LL, (int64_t)0x72D59D0CLL, (int64_t)0xC5AA75F4LL, (int64_t)0xFF992E64LL, (int64_t)0xFFFFFFFFC778A484LL, (int64_t)0xFFFFFFFF4377A004LL, (int64_t)0xFFFFFFFF0179A58CLL, (int64_t)0x7AE1E0D0LL, (int64_t)0xF09E5484LL, (int64_t)0x24B13648LL, (int64_t)0xFFD90508LL, (int64_t)0xFFFFFFFF06E566E8LL, (int64_t)0x50C9AE38LL, (int64_t)0xC660FF0LL, (int64_t)0xFFFFFFFF3A739A94LL, (int64_t)0xFFFFFFFF01932698LL, (int64_t)0xFFFFFFFF0C457BBCLL, (int64_t)0x6515CB14LL, (int64_t)0xBA4C1F04LL, (int64_t)0xFFFFFFFF509B24C0LL, (int64_t)0xFFFFFFFF0971EC34LL, (int64_t)0xAED2CAF4LL, (int64_t)0x7BF13F38LL, (int64_t)0xFFFFFFFF001FD9A8LL, (int64_t)0xD2DF3230LL, (int64_t)0xFFFFFFFFB1577DB8LL, (int64_t)0xFFFFFFFF8B2B19F8LL, (int64_t)0xFFFFFFFF2BE91E78LL, (int64_t)0xFFFFFFFF51D23450LL, (int64_t)0xFFFFFFFFC4DE9070LL, (int64_t)0x8B0CCCCCLL, (int64_t)0xFFFFFFFF0155459CLL, (int64_t)0xFFFFFFFF01B5F2A0LL, (int64_t)0xFFFFFFFF22A78688LL, (int64_t)0xFFFFFFFF18313808LL, (int64_t)0xE9428174LL, (int64_t)0x425F3330LL, (int64_t)0x9C161300LL, (int64_t)0xDEE93D58LL, (int64_t)0x170C8BECLL, (int64_t)0xC5E6B1F8LL, (int64_t)0xFFFFFFFF069F4EC0LL, (int64_t)0xFFFFFFFF35AB3834LL, (int64_t)0x14E5FED0LL, (int64_t)0x51B25818LL, (int64_t)0xEAF215B4LL, (int64_t)0xAF68F760LL, (int64_t)0xFB17C908LL, (int64_t)0x364E20DCLL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SinUltra", Fixed64::SinUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Sin()
 	static void Fixed32_Sin()
 	{
@@ -938,6 +1326,15 @@ namespace UnitTest
 			Util::Check("Fixed32::SinFastest", Fixed32::SinFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.SinUltra()
+	static void Fixed32_SinUltra()
+	{
+		static const int32_t input0[] = { (int32_t)0xFFED8271, (int32_t)0xFFFE4614, (int32_t)0xFFFC1BF6, (int32_t)0xFFD50396, (int32_t)0x501E0E, (int32_t)0x159D2A, (int32_t)0x1A310C, (int32_t)0xFFEDEFD9, (int32_t)0xFFD93748, (int32_t)0xFFD8B23E, (int32_t)0x63F8B0, (int32_t)0xFFD673FA, (int32_t)0x3B53F6, (int32_t)0xFFC1D1CE, (int32_t)0xFFFB8D3B, (int32_t)0x3E8A8F, (int32_t)0x38B5E9, (int32_t)0x4A0217, (int32_t)0x4E3958, (int32_t)0xFFF03004, (int32_t)0x1580E0, (int32_t)0x1A1158, (int32_t)0x3CC5C7, (int32_t)0x22B678, (int32_t)0x31A4C9, (int32_t)0xFFD4C794, (int32_t)0x2FF696, (int32_t)0xFFDEF59D, (int32_t)0xEA942, (int32_t)0x582E50, (int32_t)0xFFE508CC, (int32_t)0xFFF247D8, (int32_t)0x270C, (int32_t)0xFFA6328B, (int32_t)0xFFD0C4E1, (int32_t)0x45051D, (int32_t)0xFFF4D3F8, (int32_t)0x28EF42, (int32_t)0x196D11, (int32_t)0x5E0555, (int32_t)0x428F5B, (int32_t)0x51C2F8, (int32_t)0xFFA7A1E8, (int32_t)0xFFEC9916, (int32_t)0x103293, (int32_t)0xFFA750C7, (int32_t)0xFFBBB6B4, (int32_t)0xFFCD3CE3, (int32_t)0x63AD0B, (int32_t)0xFFD1BD5D, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0xD02AA93D, (int32_t)0x80000000, (int32_t)0x4045EC66, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x1CCA4A01, (int32_t)0x5B29CE42, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x96AB07FE, (int32_t)0x80000000, (int32_t)0x357AD1DA, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x67A3B440, (int32_t)0x99514082, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x44DB8E02, (int32_t)0x80000000, (int32_t)0x38635336, (int32_t)0xB28E953D, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0xFB0567F2, (int32_t)0x803376A3, (int32_t)0x80000000, (int32_t)0x663FA7CD, (int32_t)0x557B27D2, (int32_t)0x80000000, (int32_t)0x5D0135CE, (int32_t)0xE78F809D, (int32_t)0xF58F48E0, (int32_t)0x80000000, (int32_t)0x6B278DCF, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0x1C9FCE4E, (int32_t)0x80000000, (int32_t)0x80000000, (int32_t)0xE4681739, (int32_t)0x80000000 };
+		static const int32_t output0[] = { (int32_t)0x59F5, (int32_t)0xFFFF031A, (int32_t)0xAE55, (int32_t)0xD6E3, (int32_t)0xFFFF0005, (int32_t)0x5E4A, (int32_t)0xDF2B, (int32_t)0xB535, (int32_t)0xFFFF1DA2, (int32_t)0xFFFF002A, (int32_t)0xFFFF7820, (int32_t)0xA622, (int32_t)0x5AB9, (int32_t)0x9B33, (int32_t)0xF71C, (int32_t)0xFFFFB6A6, (int32_t)0x2944, (int32_t)0xFFFF042F, (int32_t)0x4F82, (int32_t)0x1AB2, (int32_t)0x77F6, (int32_t)0xCDF9, (int32_t)0xFFFF1DF2, (int32_t)0xFFFFD86B, (int32_t)0xFFFF6AE4, (int32_t)0xB0B6, (int32_t)0xFFFF417E, (int32_t)0xFFFF0062, (int32_t)0xDDA2, (int32_t)0x36F1, (int32_t)0xFFFF08C2, (int32_t)0xFFFF1605, (int32_t)0x26E4, (int32_t)0xFFFF0917, (int32_t)0x1B59, (int32_t)0xFFFFE7B3, (int32_t)0xFC03, (int32_t)0xFFFFE7FF, (int32_t)0x4A03, (int32_t)0xFFFFC666, (int32_t)0xFFFF7250, (int32_t)0x1481, (int32_t)0xFFFF9B9E, (int32_t)0xFFFF79AA, (int32_t)0xFFFF879D, (int32_t)0xFFFF573B, (int32_t)0xBCAD, (int32_t)0xFFFF8605, (int32_t)0xFFFF3ED5, (int32_t)0xFFFF3D67, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0x8E44, (int32_t)0xFFFF127C, (int32_t)0xFFFF039E, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0x1CCA, (int32_t)0xE280, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xA0C5, (int32_t)0xFFFF127C, (int32_t)0xFFFFC2E4, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF2F27, (int32_t)0xDD0E, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFFEBF6, (int32_t)0xFFFF127C, (int32_t)0x49FC, (int32_t)0xFFFF13E1, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xC757, (int32_t)0x261, (int32_t)0xFFFF127C, (int32_t)0xFFFFE7D8, (int32_t)0xFFFF1369, (int32_t)0xFFFF127C, (int32_t)0xCBBD, (int32_t)0xFFF3, (int32_t)0xFFFF4BF7, (int32_t)0xFFFF127C, (int32_t)0xFFFF428F, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFC4, (int32_t)0xFFFF127C, (int32_t)0xFFFF127C, (int32_t)0xFFFF0034, (int32_t)0xFFFF127C };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SinUltra", Fixed32::SinUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Cos()
 	static void Fixed64_Cos()
 	{
@@ -965,6 +1362,15 @@ namespace UnitTest
 			Util::Check("Fixed64::CosFastest", Fixed64::CosFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.CosUltra()
+	static void Fixed64_CosUltra()
+	{
+		static const int64_t input0[] = { (int64_t)0xFFFFFFC172854B0BLL, (int64_t)0xFFFFFFAE41938455LL, (int64_t)0xFFFFFFC717773527LL, (int64_t)0xFFFFFFE271223DADLL, (int64_t)0x5D2AB12DC2LL, (int64_t)0x5D0CEC5122LL, (int64_t)0x5F53EDBCB6LL, (int64_t)0xFFFFFFAD9B9128A4LL, (int64_t)0xFFFFFFF4F4633A72LL, (int64_t)0xFFFFFFB137CBCA1BLL, (int64_t)0xFFFFFFB36AA5DBEFLL, (int64_t)0xFFFFFFDFB2345B58LL, (int64_t)0xFFFFFFEBB3EEE7D0LL, (int64_t)0xE76358974LL, (int64_t)0xFFFFFFE8154EA6D9LL, (int64_t)0x490CF5916ALL, (int64_t)0x3F0FFD7936LL, (int64_t)0xFFFFFFB04DDC6F99LL, (int64_t)0x3A5A333A7CLL, (int64_t)0xFFFFFFAF906C5798LL, (int64_t)0xFFFFFFE9A04C925CLL, (int64_t)0xFFFFFFCE3FD967D5LL, (int64_t)0xD11D60642LL, (int64_t)0x4EFE4C70C5LL, (int64_t)0xFFFFFFAB9C122F10LL, (int64_t)0xFFFFFFCC765F86B1LL, (int64_t)0x4377C2785ELL, (int64_t)0xD186335A2LL, (int64_t)0x57E46377F7LL, (int64_t)0x197A6D004ALL, (int64_t)0x219C7BEAABLL, (int64_t)0x4BB8A70C1LL, (int64_t)0xFFFFFFA5D41E0CD4LL, (int64_t)0xFFFFFFE7DCCB84E8LL, (int64_t)0x2096500909LL, (int64_t)0x5CE2917221LL, (int64_t)0xA8A40A3DDLL, (int64_t)0x43EC1CCACFLL, (int64_t)0xFFFFFFCE3562BCC5LL, (int64_t)0x36818D0505LL, (int64_t)0xFFFFFFBA7B2F139DLL, (int64_t)0x3C59A88LL, (int64_t)0x331CD2946ELL, (int64_t)0xFFFFFFD7388BAF37LL, (int64_t)0xFFFFFFDF27BAC0E7LL, (int64_t)0xFFFFFFA0E8426ACALL, (int64_t)0x62DBE4CE8DLL, (int64_t)0x4C99605A71LL, (int64_t)0xFFFFFFAE575A9715LL, (int64_t)0xFFFFFFF832DBE019LL, (int64_t)0x98049A8D3A0LL, (int64_t)0x26C38F44A927LL, (int64_t)0xFFFFED675E99EFEFLL, (int64_t)0xFFFFE45C422C30D9LL, (int64_t)0xFFFFF703108C80E7LL, (int64_t)0x220FCB24C13FLL, (int64_t)0x206A6053F2DLL, (int64_t)0xFFFFF1F9D4B4B594LL, (int64_t)0xFFFFEE5B3A45B597LL, (int64_t)0x11766FE542CCLL, (int64_t)0xFFFFE2EE4458AC3DLL, (int64_t)0xFFFFF90F421CC3FFLL, (int64_t)0xFFFFE48B8DD902F8LL, (int64_t)0x18CBA42EB737LL, (int64_t)0xFFFFFB28AB334772LL, (int64_t)0x74C66B5DDB8LL, (int64_t)0xFFFFEF8AC0B6AB76LL, (int64_t)0xFFFFDA7009D2A281LL, (int64_t)0x1FFB75A62A16LL, (int64_t)0xFFFFF96FD1E89740LL, (int64_t)0xFFFFF15B0EACCB17LL, (int64_t)0x252A03C41FF4LL, (int64_t)0x1B618F89DAE3LL, (int64_t)0xFFFFDA70A0ECE2C2LL, (int64_t)0x22CC4BEE8DB8LL, (int64_t)0x1E5124B8CE82LL, (int64_t)0xFFFFFFA9AEAA93F4LL, (int64_t)0xFFFFEDF8E10A0092LL, (int64_t)0x49FD0E8B35FLL, (int64_t)0xFFFFDD1E3D28AB1DLL, (int64_t)0xFFFFEC5057EFEDC1LL, (int64_t)0x237EDE53B0DDLL, (int64_t)0xFFFFFDF3675DEF47LL, (int64_t)0xFFFFFE5158F75343LL, (int64_t)0xFFFFD96388EB49A8LL, (int64_t)0xD6D912301BBLL, (int64_t)0xFFFFED61E37A1BA4LL, (int64_t)0x1F7A9990D1D5LL, (int64_t)0x269F2EF3699ELL, (int64_t)0x11BAEC1EC655LL, (int64_t)0xFFFFFB31DACB5604LL, (int64_t)0xFFFFEB142C8B4CC9LL, (int64_t)0x51D00F9839ALL, (int64_t)0x2266AAC79ECLL, (int64_t)0xB4C56BD49B8LL, (int64_t)0x12D8DC46E551LL, (int64_t)0xFFFFF465EB575A2CLL, (int64_t)0x223B9E1343D7LL, (int64_t)0x1BF96B5D29D2LL, (int64_t)0x12EF1E3D7C3ELL };
+		static const int64_t output0[] = { (int64_t)0xF611C2D0LL, (int64_t)0xFF7B6CB0LL, (int64_t)0xEF9A605CLL, (int64_t)0xFFFFFFFFB785C8C4LL, (int64_t)0x786DFD5CLL, (int64_t)0x5D6727A0LL, (int64_t)0x78A50FE0LL, (int64_t)0xC1FCB6A0LL, (int64_t)0xCBD6FB8LL, (int64_t)0xFFFFFFFF077B7A38LL, (int64_t)0x60486078LL, (int64_t)0xA18706E4LL, (int64_t)0x1F76A40CLL, (int64_t)0xFFFFFFFFAE5C8354LL, (int64_t)0x58EF2530LL, (int64_t)0xFFFFFFFF4C8E19BCLL, (int64_t)0xF9348150LL, (int64_t)0xFFFFFFFF98D7CE10LL, (int64_t)0xFFFFFFFFC4ECAF48LL, (int64_t)0x51CB90A4LL, (int64_t)0xFFFFFFFF1288E680LL, (int64_t)0xDECE9474LL, (int64_t)0xE03CE2ECLL, (int64_t)0xFFFFFFFF19E5EFF4LL, (int64_t)0xFFFFFFFF179AEE20LL, (int64_t)0x4B535648LL, (int64_t)0xFFFFFFFFEC7410E8LL, (int64_t)0xDD015630LL, (int64_t)0xFF532AF0LL, (int64_t)0xF0DE44E4LL, (int64_t)0xFFFFFFFF6A5236D0LL, (int64_t)0x52B2EFCLL, (int64_t)0xFFFFFFFF67F052F4LL, (int64_t)0x8B55B120LL, (int64_t)0x63950BB8LL, (int64_t)0x34DF8188LL, (int64_t)0xFFFFFFFF8F629AD8LL, (int64_t)0x5E7D8468LL, (int64_t)0xE3C24048LL, (int64_t)0xFFFFFFFF8BA74F14LL, (int64_t)0xEB656644LL, (int64_t)0xFFF4269CLL, (int64_t)0xA97FB560LL, (int64_t)0xFFFFFFFF00812AE8LL, (int64_t)0x2434F934LL, (int64_t)0xA9E93338LL, (int64_t)0xFFFFFFFFE622BFC0LL, (int64_t)0x5C8BD7A0LL, (int64_t)0xFFEDCBF8LL, (int64_t)0xD78ADB4LL, (int64_t)0xC49B0D28LL, (int64_t)0xFFFFFFFF41822508LL, (int64_t)0xFFFFFFFF8FEB8FF8LL, (int64_t)0xA41C6BB8LL, (int64_t)0x470D4DA0LL, (int64_t)0x4C696A5CLL, (int64_t)0xFFFFFFFF0A657090LL, (int64_t)0xFFFFFFFF378F3DBCLL, (int64_t)0xAB45A8ACLL, (int64_t)0xFFFFFFFF004F9980LL, (int64_t)0xFFFFFFFF3C35CBE0LL, (int64_t)0x2B96C068LL, (int64_t)0xFFFFFFFF3CBBCC3CLL, (int64_t)0xFFFFFFFFF2572D80LL, (int64_t)0x6EC9F04LL, (int64_t)0xFFFFFFFF565E6324LL, (int64_t)0xFFFFFFFF1177F6ECLL, (int64_t)0xFFFFFFFF19E431C0LL, (int64_t)0xE4564078LL, (int64_t)0xFFFFFFFF28C46324LL, (int64_t)0xFFFFFFFF7A9AABFCLL, (int64_t)0x4B50DAB0LL, (int64_t)0xFFFFFFFF36F3F7C8LL, (int64_t)0xFFFFFFFF7F3D607CLL, (int64_t)0x4E3F3A90LL, (int64_t)0x2915FFBCLL, (int64_t)0xFFFFFFFFEC8A703CLL, (int64_t)0xFFFFFFFF01E2DFCCLL, (int64_t)0xFFFFFFFF27B35868LL, (int64_t)0x36DE3364LL, (int64_t)0xDB5211B4LL, (int64_t)0x2FE99084LL, (int64_t)0xFFFFFFFF00519A74LL, (int64_t)0xFFFFFFFF083FC7C0LL, (int64_t)0x8721B498LL, (int64_t)0xC9834648LL, (int64_t)0xFFFFFFFF0CA27118LL, (int64_t)0xFFFFFFFF15B51220LL, (int64_t)0xFFFFFFFF2B7946CCLL, (int64_t)0xFFFFFFFF38CCC1F8LL, (int64_t)0x35D0C5ACLL, (int64_t)0xFFFFFFFF2B347D44LL, (int64_t)0xFFFFFFFF7E7D46A0LL, (int64_t)0xFFFFFFFF325B02E8LL, (int64_t)0xFFFFFFFF84A6683CLL, (int64_t)0xCF766E74LL, (int64_t)0xFFFFFFFFB5889418LL, (int64_t)0x24EEEC20LL, (int64_t)0x2883C484LL, (int64_t)0xFFFFFFFF105E00ACLL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::CosUltra", Fixed64::CosUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Cos()
 	static void Fixed32_Cos()
 	{
@@ -992,6 +1398,123 @@ namespace UnitTest
 			Util::Check("Fixed32::CosFastest", Fixed32::CosFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.CosUltra()
+	static void Fixed32_CosUltra()
+	{
+		static const int32_t input0[] = { (int32_t)0xFFCCCB85, (int32_t)0x38BDA1, (int32_t)0xFFA04E7F, (int32_t)0xFFF1DB2E, (int32_t)0x4DE4E5, (int32_t)0xFFB481CA, (int32_t)0x45E79, (int32_t)0x51653C, (int32_t)0xFFBEC7C7, (int32_t)0xFFDF270B, (int32_t)0xFFB9FD4A, (int32_t)0x6B0DC, (int32_t)0xFFAE5701, (int32_t)0x2408A0, (int32_t)0xFFCEA02D, (int32_t)0xFFE5758A, (int32_t)0x20F69A, (int32_t)0x552827, (int32_t)0xFFDB5CED, (int32_t)0x171360, (int32_t)0x381F94, (int32_t)0x20E774, (int32_t)0x1E1B9F, (int32_t)0xFFDD56A1, (int32_t)0x1D3BD2, (int32_t)0xFFE85471, (int32_t)0x8169F, (int32_t)0x5CEA70, (int32_t)0x557547, (int32_t)0x36C3D, (int32_t)0xFFC714D9, (int32_t)0x2BC66D, (int32_t)0x537E2E, (int32_t)0x6333BA, (int32_t)0x22750F, (int32_t)0xFFBFCDFA, (int32_t)0xFFF5A8CC, (int32_t)0x3AD6C8, (int32_t)0xFFB8438D, (int32_t)0xFFC0C6D3, (int32_t)0xFFEB13F0, (int32_t)0xFFE0E1A1, (int32_t)0xFFC65455, (int32_t)0x605D92, (int32_t)0xFF9FB903, (int32_t)0x623479, (int32_t)0xFFD00862, (int32_t)0xFFAAD34A, (int32_t)0xFFEBE1ED, (int32_t)0xFFB0E96A, (int32_t)0xF394CF96, (int32_t)0x23C2FF3D, (int32_t)0xEAA64C6C, (int32_t)0x222C6DA, (int32_t)0xBD35BAA, (int32_t)0x63515F6, (int32_t)0xE35748A2, (int32_t)0xF38D29D, (int32_t)0x161E3F55, (int32_t)0x9C6D62, (int32_t)0x669DC51, (int32_t)0x4795370, (int32_t)0x2579BBDF, (int32_t)0xC3FC1C5, (int32_t)0xE2571B94, (int32_t)0xFA9D6E4B, (int32_t)0x90FCBE9, (int32_t)0xE069C74C, (int32_t)0xD98DA46E, (int32_t)0xDEBA1BF6, (int32_t)0x20BBFA7C, (int32_t)0x1CF46E14, (int32_t)0x16394C83, (int32_t)0xE352A1FB, (int32_t)0xEA1FC832, (int32_t)0xFB04333B, (int32_t)0xFC5178C1, (int32_t)0xD2E3D09, (int32_t)0xF10191CE, (int32_t)0xC1EDEAC, (int32_t)0xE26DB613, (int32_t)0xFD5E4DAC, (int32_t)0x51753CA, (int32_t)0x1936A265, (int32_t)0xE6B17840, (int32_t)0xED11253E, (int32_t)0xFF63362E, (int32_t)0xF76A836A, (int32_t)0xF3DCD95E, (int32_t)0xE030A429, (int32_t)0xDC852CD5, (int32_t)0x13CD1CBC, (int32_t)0xD9CDA702, (int32_t)0xA6DF577, (int32_t)0x7F3CDFE, (int32_t)0x1A6A7603, (int32_t)0xF56E66E1, (int32_t)0x4492F27, (int32_t)0x1C3D71C6, (int32_t)0x6D6D6BE };
+		static const int32_t output0[] = { (int32_t)0x9712, (int32_t)0xFB48, (int32_t)0x1FF6, (int32_t)0xFFFFFE4A, (int32_t)0xFFFF338D, (int32_t)0xFED7, (int32_t)0xFFFFA9D0, (int32_t)0xF596, (int32_t)0xFFFF455D, (int32_t)0x2386, (int32_t)0xA002, (int32_t)0xEB01, (int32_t)0xFFEE, (int32_t)0xFFFFE7CF, (int32_t)0xA0E3, (int32_t)0x2974, (int32_t)0x600, (int32_t)0xFFFF0E26, (int32_t)0x7CAD, (int32_t)0xFFFF885E, (int32_t)0xE92D, (int32_t)0x1520, (int32_t)0x427D, (int32_t)0xFFFF0166, (int32_t)0xFFFF6D0A, (int32_t)0x1BA5, (int32_t)0xFFFFC48D, (int32_t)0x3C8B, (int32_t)0xFFFF31EC, (int32_t)0xFFFF0A12, (int32_t)0xEEAD, (int32_t)0xFA81, (int32_t)0xFFFFC2FB, (int32_t)0x3D51, (int32_t)0xFFFF014A, (int32_t)0x34AB, (int32_t)0xFFFF6414, (int32_t)0xFFFF574D, (int32_t)0xFFFF21E9, (int32_t)0xECA0, (int32_t)0xFFFF84E0, (int32_t)0xF4C3, (int32_t)0x6F15, (int32_t)0xFFFF7ADF, (int32_t)0xFFFF8EA5, (int32_t)0xFFFF5089, (int32_t)0xFFFF55C9, (int32_t)0xFFFF0FAE, (int32_t)0x4C59, (int32_t)0xFFFF258E, (int32_t)0xFEA4, (int32_t)0xEC2D, (int32_t)0xC8B0, (int32_t)0xFD7D, (int32_t)0x6B88, (int32_t)0xD8DF, (int32_t)0xFFFF8B4D, (int32_t)0x5140, (int32_t)0x74B3, (int32_t)0xCB6A, (int32_t)0xFFFFA16C, (int32_t)0xFFFFC949, (int32_t)0xC56A, (int32_t)0xE6C9, (int32_t)0xFFFF0E6D, (int32_t)0xFFFF2B47, (int32_t)0x4432, (int32_t)0xF8C4, (int32_t)0xFFFF081A, (int32_t)0xFFFF7CE4, (int32_t)0xFFFFC825, (int32_t)0xFFFFD7C0, (int32_t)0xFFFF0204, (int32_t)0xFFFF23C0, (int32_t)0xFFFFAD45, (int32_t)0xF386, (int32_t)0xFFAB, (int32_t)0xFC63, (int32_t)0xD3E2, (int32_t)0x8528, (int32_t)0x9500, (int32_t)0x2C93, (int32_t)0xFFFF17B6, (int32_t)0xFFFFC515, (int32_t)0xD80A, (int32_t)0xFFFF3019, (int32_t)0xF535, (int32_t)0xFFFFF151, (int32_t)0xFFFF01BA, (int32_t)0xF069, (int32_t)0xFFFF1D02, (int32_t)0x26E2, (int32_t)0xFFFFDC26, (int32_t)0xEC4A, (int32_t)0xFFA2, (int32_t)0xFFFFD178, (int32_t)0xFFFF3A0D, (int32_t)0xFFFF47EE, (int32_t)0xFFFF32A0, (int32_t)0xFFFF6FA8 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::CosUltra", Fixed32::CosUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SinTurns()
+	static void Fixed64_SinTurns()
+	{
+		static const int32_t input0[] = { (int32_t)0x1135D7D8, (int32_t)0x1F15FD90, (int32_t)0x8622E6DF, (int32_t)0x3027663C, (int32_t)0x82E11637, (int32_t)0xB5EDABCB, (int32_t)0x66816182, (int32_t)0x55E63EA2, (int32_t)0x26C443C2, (int32_t)0x844BA98F, (int32_t)0xA9CECCA3, (int32_t)0x3A598834, (int32_t)0x874F7D97, (int32_t)0x88862B4D, (int32_t)0xEA2BAF5F, (int32_t)0x9C0FAA15, (int32_t)0x5617A79E, (int32_t)0x3639F8FA, (int32_t)0xA46C9D77, (int32_t)0x73E8212, (int32_t)0x85F8CD7F, (int32_t)0xB632EA41, (int32_t)0x7260A678, (int32_t)0x3B123954, (int32_t)0xF47A9B4B, (int32_t)0xA3BFDDA3, (int32_t)0x1F326D92, (int32_t)0x7D3AB16E, (int32_t)0xB61E1BBF, (int32_t)0xC7BC098F, (int32_t)0xA1D2377B, (int32_t)0x1C802EA4, (int32_t)0x435660D6, (int32_t)0x403134FE, (int32_t)0xD841667B, (int32_t)0x40CA37E4, (int32_t)0x8882E56, (int32_t)0xAF6D92A5, (int32_t)0xAE6F4EE, (int32_t)0x5562EA70, (int32_t)0xFAB6FF5B, (int32_t)0xAA64C965, (int32_t)0x6CDF5184, (int32_t)0x35D4E682, (int32_t)0x10E5F544, (int32_t)0xBC4AC275, (int32_t)0xF65B9E3F, (int32_t)0x94A2A043, (int32_t)0x90889AAD, (int32_t)0xD612505B, (int32_t)0xC45D, (int32_t)0xFFFEEE27, (int32_t)0xFFFF366A, (int32_t)0x13B81, (int32_t)0xFFFF1ADB, (int32_t)0xFFFF8F1F, (int32_t)0x8870, (int32_t)0xFFFF5E75, (int32_t)0xFFFF2F7E, (int32_t)0x12250, (int32_t)0x455E, (int32_t)0x14146, (int32_t)0x60FD, (int32_t)0xFFFF9B64, (int32_t)0x12C85, (int32_t)0x289C, (int32_t)0x16B32, (int32_t)0xFFFF526A, (int32_t)0x934D, (int32_t)0x7E48, (int32_t)0x3B99, (int32_t)0x75FE, (int32_t)0xFFFEFD98, (int32_t)0xFFFF6A95, (int32_t)0xFFFE9F9D, (int32_t)0x11779, (int32_t)0xFFFF5927, (int32_t)0xFFFF3226, (int32_t)0xFFFEFA14, (int32_t)0xFFFF24D9, (int32_t)0x8A86, (int32_t)0x203B, (int32_t)0x14BB6, (int32_t)0x1251B, (int32_t)0x168D, (int32_t)0x17910, (int32_t)0xFFFF99F1, (int32_t)0x1189E, (int32_t)0x226B, (int32_t)0x17E36, (int32_t)0xFFFEB6A9, (int32_t)0xFFFF34F5, (int32_t)0x16140, (int32_t)0x8595, (int32_t)0xFFFF3896, (int32_t)0x3537, (int32_t)0x2062, (int32_t)0x2A3C, (int32_t)0xFE62, (int32_t)0xFFFE8456 };
+		static const int64_t output0[] = { (int64_t)0x68F2D29CLL, (int64_t)0xB0E9B2A8LL, (int64_t)0xFFFFFFFFD9970130LL, (int64_t)0xECE1ABECLL, (int64_t)0xFFFFFFFFEDEC99D0LL, (int64_t)0xFFFFFFFF07C81CB4LL, (int64_t)0x95EFD0F8LL, (int64_t)0xDBE72018LL, (int64_t)0xD0743E50LL, (int64_t)0xFFFFFFFFE50F6918LL, (int64_t)0xFFFFFFFF250B7370LL, (int64_t)0xFD8AD33CLL, (int64_t)0xFFFFFFFFD2501220LL, (int64_t)0xFFFFFFFFCAD4D46CLL, (int64_t)0xFFFFFFFF7D4F7CD0LL, (int64_t)0xFFFFFFFF5D4C5DFCLL, (int64_t)0xDB478C38LL, (int64_t)0xF8AB7E04LL, (int64_t)0xFFFFFFFF386DCD04LL, (int64_t)0x2D46EC2CLL, (int64_t)0xFFFFFFFFDA9C9B34LL, (int64_t)0xFFFFFFFF075F0EC0LL, (int64_t)0x5401B370LL, (int64_t)0xFE210E48LL, (int64_t)0xFFFFFFFFB89263A4LL, (int64_t)0xFFFFFFFF3B1C9540LL, (int64_t)0xB16AAD34LL, (int64_t)0x116545C4LL, (int64_t)0xFFFFFFFF077E5488LL, (int64_t)0xFFFFFFFF04995014LL, (int64_t)0xFFFFFFFF4312ADA8LL, (int64_t)0xA4D30518LL, (int64_t)0xFF2442B0LL, (int64_t)0xFFFF4544LL, (int64_t)0xFFFFFFFF2C0A2C78LL, (int64_t)0xFFF3AEF4LL, (int64_t)0x35378900LL, (int64_t)0xFFFFFFFF14E2AA58LL, (int64_t)0x43AF95ECLL, (int64_t)0xDD891F3CLL, (int64_t)0xFFFFFFFFDEE2A7C4LL, (int64_t)0xFFFFFFFF2328F744LL, (int64_t)0x73D10080LL, (int64_t)0xF811A058LL, (int64_t)0x67283938LL, (int64_t)0xFFFFFFFF010F3554LL, (int64_t)0xFFFFFFFFC3FB0F64LL, (int64_t)0xFFFFFFFF83D12DE4LL, (int64_t)0xFFFFFFFF9AF1A844LL, (int64_t)0xFFFFFFFF24A7246CLL, (int64_t)0x4D1C8LL, (int64_t)0xFFFFFFFFFFF9475CLL, (int64_t)0xFFFFFFFFFFFB0D64LL, (int64_t)0x7BE5CLL, (int64_t)0xFFFFFFFFFFFA603CLL, (int64_t)0xFFFFFFFFFFFD3AC0LL, (int64_t)0x35940LL, (int64_t)0xFFFFFFFFFFFC08FCLL, (int64_t)0xFFFFFFFFFFFAE1E8LL, (int64_t)0x72014LL, (int64_t)0x1B3D8LL, (int64_t)0x7E29CLL, (int64_t)0x26164LL, (int64_t)0xFFFFFFFFFFFD87D8LL, (int64_t)0x76038LL, (int64_t)0xFF24LL, (int64_t)0x8EA04LL, (int64_t)0xFFFFFFFFFFFBBD50LL, (int64_t)0x39D84LL, (int64_t)0x31970LL, (int64_t)0x17674LL, (int64_t)0x2E55CLL, (int64_t)0xFFFFFFFFFFF9A860LL, (int64_t)0xFFFFFFFFFFFC552CLL, (int64_t)0xFFFFFFFFFFF759E0LL, (int64_t)0x6DBF8LL, (int64_t)0xFFFFFFFFFFFBE7A8LL, (int64_t)0xFFFFFFFFFFFAF298LL, (int64_t)0xFFFFFFFFFFF99248LL, (int64_t)0xFFFFFFFFFFFA9F04LL, (int64_t)0x3665CLL, (int64_t)0xCA80LL, (int64_t)0x82430LL, (int64_t)0x731A0LL, (int64_t)0x8DB0LL, (int64_t)0x94124LL, (int64_t)0xFFFFFFFFFFFD7EBCLL, (int64_t)0x6E328LL, (int64_t)0xD840LL, (int64_t)0x96180LL, (int64_t)0xFFFFFFFFFFF7EAB0LL, (int64_t)0xFFFFFFFFFFFB043CLL, (int64_t)0x8AB88LL, (int64_t)0x34750LL, (int64_t)0xFFFFFFFFFFFB1B08LL, (int64_t)0x14E58LL, (int64_t)0xCB74LL, (int64_t)0x1095CLL, (int64_t)0x63E54LL, (int64_t)0xFFFFFFFFFFF6AE80LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SinTurns", Fixed64::SinTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SinTurnsFast()
+	static void Fixed64_SinTurnsFast()
+	{
+		static const int32_t input0[] = { (int32_t)0x7600CF5C, (int32_t)0x9A3C4CAD, (int32_t)0xA59345E5, (int32_t)0x143BEEDE, (int32_t)0xB14DE7CB, (int32_t)0x902319A9, (int32_t)0xA0E12BB5, (int32_t)0xA1F2124F, (int32_t)0x89063FE9, (int32_t)0x9536AF51, (int32_t)0xA25363E3, (int32_t)0x76A8C5C8, (int32_t)0x8F43579B, (int32_t)0x55BCF8E6, (int32_t)0x93796453, (int32_t)0x5F512D52, (int32_t)0xF1AF4ABF, (int32_t)0xB86BBF23, (int32_t)0x60BA12B8, (int32_t)0xBC8A522F, (int32_t)0x54151C06, (int32_t)0xA4BAB2D5, (int32_t)0x8D5CAA6, (int32_t)0x5BC42F12, (int32_t)0x6B722A2C, (int32_t)0x9BA6F5AF, (int32_t)0x8C304951, (int32_t)0x69737CD0, (int32_t)0x8E5355B1, (int32_t)0x61892F7A, (int32_t)0xF4DC9E81, (int32_t)0xC94C0173, (int32_t)0xCACA102F, (int32_t)0x29424BF6, (int32_t)0xDF938123, (int32_t)0x4D7B376A, (int32_t)0x512DBB14, (int32_t)0x5E7D9A5C, (int32_t)0xEC6D14BF, (int32_t)0x583DE4D8, (int32_t)0xF0BFECA9, (int32_t)0x6C027DFE, (int32_t)0x69B496BE, (int32_t)0x25469374, (int32_t)0x15F471E, (int32_t)0x4A0EC338, (int32_t)0xE9D9EF67, (int32_t)0x3CF53722, (int32_t)0xB2C086, (int32_t)0xF69C3983, (int32_t)0x11F5, (int32_t)0xFFFFD46A, (int32_t)0xFFFF54A6, (int32_t)0x10DA0, (int32_t)0x6EBA, (int32_t)0xF807, (int32_t)0x351A, (int32_t)0xFFFF5AA0, (int32_t)0x7C79, (int32_t)0xFFFEBB74, (int32_t)0xFFFE856D, (int32_t)0xFFFF2288, (int32_t)0xFFFEB541, (int32_t)0xFFFEF1E3, (int32_t)0x62BA, (int32_t)0x10FB1, (int32_t)0x85E1, (int32_t)0xFFFFB0AB, (int32_t)0xFFFFE1FB, (int32_t)0xFFFF4EFA, (int32_t)0xFFFEA486, (int32_t)0x3A93, (int32_t)0xE7EA, (int32_t)0xFFFE9345, (int32_t)0xE74B, (int32_t)0x13D9A, (int32_t)0xFFFF2D81, (int32_t)0x12FD4, (int32_t)0xFFFF8D3D, (int32_t)0xFFFEDF45, (int32_t)0x97FA, (int32_t)0xFFFF6B2C, (int32_t)0xFFFFB90F, (int32_t)0x485F, (int32_t)0xFFFF9113, (int32_t)0xFFFE82F9, (int32_t)0xFFFE7DCB, (int32_t)0xFFFFD69D, (int32_t)0xFFFE888F, (int32_t)0x2BA5, (int32_t)0xFFFF30BB, (int32_t)0x167D, (int32_t)0xFFFF1D44, (int32_t)0xFFFF8231, (int32_t)0x1013E, (int32_t)0xFFFF284F, (int32_t)0x10DBE, (int32_t)0xCA13, (int32_t)0xFFFE8867, (int32_t)0x7B1E };
+		static const int64_t output0[] = { (int64_t)0x3E2F0510LL, (int64_t)0xFFFFFFFF66508B1CLL, (int64_t)0xFFFFFFFF33FACFC8LL, (int64_t)0x79F916C4LL, (int64_t)0xFFFFFFFF1078FE70LL, (int64_t)0xFFFFFFFF9D3CD278LL, (int64_t)0xFFFFFFFF471D7EA0LL, (int64_t)0xFFFFFFFF428BD35CLL, (int64_t)0xFFFFFFFFC7C2AA10LL, (int64_t)0xFFFFFFFF80A6DEE0LL, (int64_t)0xFFFFFFFF40F2B3B4LL, (int64_t)0x3A2D441CLL, (int64_t)0xFFFFFFFFA2539EA0LL, (int64_t)0xDC6B6568LL, (int64_t)0xFFFFFFFF8A3EF5A4LL, (int64_t)0xB80725C8LL, (int64_t)0xFFFFFFFFA7E4C5D4LL, (int64_t)0xFFFFFFFF046A945CLL, (int64_t)0xB1C2F3C8LL, (int64_t)0xFFFFFFFF00EC0A60LL, (int64_t)0xE186E1C0LL, (int64_t)0xFFFFFFFF373BF774LL, (int64_t)0x371425E8LL, (int64_t)0xC6D19A94LL, (int64_t)0x7BBC9050LL, (int64_t)0xFFFFFFFF5F4A54D8LL, (int64_t)0xFFFFFFFFB48DC458LL, (int64_t)0x868E7600LL, (int64_t)0xFFFFFFFFA7D54710LL, (int64_t)0xAE119A3CLL, (int64_t)0xFFFFFFFFBAE28D44LL, (int64_t)0xFFFFFFFF06A2B6DCLL, (int64_t)0xFFFFFFFF08EC7434LL, (int64_t)0xD9260294LL, (int64_t)0xFFFFFFFF491B8180LL, (int64_t)0xF21D0860LL, (int64_t)0xE9948EE0LL, (int64_t)0xBB997FC4LL, (int64_t)0xFFFFFFFF89B0A218LL, (int64_t)0xD4022480LL, (int64_t)0xFFFFFFFFA266B8F4LL, (int64_t)0x789FAF0CLL, (int64_t)0x8531CEE0LL, (int64_t)0xCAE0B1ACLL, (int64_t)0x89EB9F0LL, (int64_t)0xF83D5AA0LL, (int64_t)0xFFFFFFFF7B96CD60LL, (int64_t)0xFF497DA4LL, (int64_t)0x46313C4LL, (int64_t)0xFFFFFFFFC585F768LL, (int64_t)0x70D0LL, (int64_t)0xFFFFFFFFFFFEEE24LL, (int64_t)0xFFFFFFFFFFFBCB5CLL, (int64_t)0x69E18LL, (int64_t)0x2B7B4LL, (int64_t)0x61664LL, (int64_t)0x14DA4LL, (int64_t)0xFFFFFFFFFFFBF0E8LL, (int64_t)0x30E14LL, (int64_t)0xFFFFFFFFFFF808CCLL, (int64_t)0xFFFFFFFFFFF6B558LL, (int64_t)0xFFFFFFFFFFFA9078LL, (int64_t)0xFFFFFFFFFFF7E1DCLL, (int64_t)0xFFFFFFFFFFF95ED4LL, (int64_t)0x26C50LL, (int64_t)0x6AB14LL, (int64_t)0x3492CLL, (int64_t)0xFFFFFFFFFFFE0D88LL, (int64_t)0xFFFFFFFFFFFF4360LL, (int64_t)0xFFFFFFFFFFFBA7B8LL, (int64_t)0xFFFFFFFFFFF778BCLL, (int64_t)0x17008LL, (int64_t)0x5B128LL, (int64_t)0xFFFFFFFFFFF70C54LL, (int64_t)0x5AD40LL, (int64_t)0x7CB8CLL, (int64_t)0xFFFFFFFFFFFAD568LL, (int64_t)0x77500LL, (int64_t)0xFFFFFFFFFFFD2EECLL, (int64_t)0xFFFFFFFFFFF8E9D8LL, (int64_t)0x3BAE4LL, (int64_t)0xFFFFFFFFFFFC58E0LL, (int64_t)0xFFFFFFFFFFFE4240LL, (int64_t)0x1C6B8LL, (int64_t)0xFFFFFFFFFFFD4708LL, (int64_t)0xFFFFFFFFFFF6A5ECLL, (int64_t)0xFFFFFFFFFFF68560LL, (int64_t)0xFFFFFFFFFFFEFBF4LL, (int64_t)0xFFFFFFFFFFF6C908LL, (int64_t)0x11238LL, (int64_t)0xFFFFFFFFFFFAE9ACLL, (int64_t)0x8D4CLL, (int64_t)0xFFFFFFFFFFFA6F60LL, (int64_t)0xFFFFFFFFFFFCE984LL, (int64_t)0x6504CLL, (int64_t)0xFFFFFFFFFFFAB4C4LL, (int64_t)0x69ED4LL, (int64_t)0x4F5A8LL, (int64_t)0xFFFFFFFFFFF6C80CLL, (int64_t)0x30590LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SinTurnsFast", Fixed64::SinTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SinTurnsFastest()
+	static void Fixed64_SinTurnsFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0x43E675C0, (int32_t)0x933DDF25, (int32_t)0xC8525297, (int32_t)0xB50AD5F3, (int32_t)0xC0151223, (int32_t)0xA2258F71, (int32_t)0x73047AE, (int32_t)0xF8193BDD, (int32_t)0x21F5CA7E, (int32_t)0x10B67E82, (int32_t)0x805DBA63, (int32_t)0x3BDD4718, (int32_t)0x2B6A0566, (int32_t)0xF3ED695F, (int32_t)0x8DB33ACB, (int32_t)0x38E4312, (int32_t)0x15AE3676, (int32_t)0x3172E9C4, (int32_t)0x1996DA28, (int32_t)0xE87D3EE, (int32_t)0x7CC2C22, (int32_t)0xC28C6201, (int32_t)0xD8938991, (int32_t)0xA338AA, (int32_t)0x7B07156A, (int32_t)0xD84F1343, (int32_t)0x94F43EC, (int32_t)0xDDFA8B9B, (int32_t)0xFFB1895D, (int32_t)0xCC006527, (int32_t)0xE3650E77, (int32_t)0xBCFC5EC, (int32_t)0xFD937345, (int32_t)0x6E01CC1A, (int32_t)0x3CD667B8, (int32_t)0x2492D750, (int32_t)0x1ED4F866, (int32_t)0xA8493D81, (int32_t)0xCFF327A7, (int32_t)0x4F090620, (int32_t)0xC9B2A0BD, (int32_t)0x99F54E1B, (int32_t)0x3A3F9906, (int32_t)0x599FEFE6, (int32_t)0xA7E5B16F, (int32_t)0x686BB882, (int32_t)0x6928E7FC, (int32_t)0x4F0EF452, (int32_t)0x25F58624, (int32_t)0x7A115E76, (int32_t)0xFFFF337E, (int32_t)0xFFFFA808, (int32_t)0xFFFF2B58, (int32_t)0xFFFE9045, (int32_t)0xFFFF671A, (int32_t)0x420, (int32_t)0xB308, (int32_t)0xDAC3, (int32_t)0xFFFF2A6C, (int32_t)0x13CB0, (int32_t)0x4BCB, (int32_t)0xFFFEF724, (int32_t)0x16F72, (int32_t)0xFFFF7FB4, (int32_t)0xFFFF03AD, (int32_t)0xFFFFDD13, (int32_t)0xFFFF3777, (int32_t)0xBB66, (int32_t)0xA81E, (int32_t)0xFFFFBA33, (int32_t)0x13362, (int32_t)0xFFFFC739, (int32_t)0xFFFFA2EC, (int32_t)0xE385, (int32_t)0xFFFF4B70, (int32_t)0xFFFFC894, (int32_t)0x1954, (int32_t)0xFFFFFCCD, (int32_t)0xFFFF8831, (int32_t)0xFFFEB229, (int32_t)0xFFFFCC94, (int32_t)0xB1C4, (int32_t)0xAAF5, (int32_t)0x112B, (int32_t)0xFFFEA733, (int32_t)0xFFFE7A0D, (int32_t)0xFFFF7215, (int32_t)0xFFFFE1B7, (int32_t)0x61FD, (int32_t)0xFFFF2EEA, (int32_t)0x14334, (int32_t)0x109F4, (int32_t)0x15085, (int32_t)0xFFFFB74C, (int32_t)0xFFFF1EC7, (int32_t)0xFFFEDC86, (int32_t)0xFFFEDFC6, (int32_t)0xFFFFAB70, (int32_t)0x8736, (int32_t)0x9CAF };
+		static const int64_t output0[] = { (int64_t)0xFECA5E60LL, (int64_t)0xFFFFFFFF8B885D08LL, (int64_t)0xFFFFFFFF055C40D8LL, (int64_t)0xFFFFFFFF093B8F3CLL, (int64_t)0xFFFFFFFF00007788LL, (int64_t)0xFFFFFFFF41AB06C4LL, (int64_t)0x2CEF22C8LL, (int64_t)0xFFFFFFFFCEA9D1FCLL, (int64_t)0xBD8BB438LL, (int64_t)0x6619421CLL, (int64_t)0xFFFFFFFFFDB318D4LL, (int64_t)0xFEA4D884LL, (int64_t)0xE00702D4LL, (int64_t)0xFFFFFFFFB53F3AA8LL, (int64_t)0xFFFFFFFFAB870418LL, (int64_t)0x16501D38LL, (int64_t)0x81E69F64LL, (int64_t)0xEFD57308LL, (int64_t)0x9670F3A8LL, (int64_t)0x59619ED4LL, (int64_t)0x30B22ABCLL, (int64_t)0xFFFFFFFF0087B154LL, (int64_t)0xFFFFFFFF2D26CA2CLL, (int64_t)0x401821CLL, (int64_t)0x1F2A33E4LL, (int64_t)0xFFFFFFFF2C34137CLL, (int64_t)0x39FCFCACLL, (int64_t)0xFFFFFFFF42322FC0LL, (int64_t)0xFFFFFFFFFE130120LL, (int64_t)0xFFFFFFFF0B0D2F54LL, (int64_t)0xFFFFFFFF5AA58B1CLL, (int64_t)0x492ECEC0LL, (int64_t)0xFFFFFFFFF0C7432CLL, (int64_t)0x6D6CBFACLL, (int64_t)0xFF321074LL, (int64_t)0xC82FCF90LL, (int64_t)0xAFC90974LL, (int64_t)0xFFFFFFFF2A208100LL, (int64_t)0xFFFFFFFF135F51FCLL, (int64_t)0xEEC180E8LL, (int64_t)0xFFFFFFFF0740A80CLL, (int64_t)0xFFFFFFFF67B045A4LL, (int64_t)0xFD695978LL, (int64_t)0xCF0B4690LL, (int64_t)0xFFFFFFFF2B7A9954LL, (int64_t)0x8C0A26D4LL, (int64_t)0x8820DF2CLL, (int64_t)0xEEB41528LL, (int64_t)0xCD7EE274LL, (int64_t)0x252448D8LL, (int64_t)0xFFFFFFFFFFFAFB08LL, (int64_t)0xFFFFFFFFFFFDD744LL, (int64_t)0xFFFFFFFFFFFAC7D4LL, (int64_t)0xFFFFFFFFFFF6F978LL, (int64_t)0xFFFFFFFFFFFC3F4CLL, (int64_t)0x19E8LL, (int64_t)0x464E0LL, (int64_t)0x55E84LL, (int64_t)0xFFFFFFFFFFFAC20CLL, (int64_t)0x7C5CCLL, (int64_t)0x1DC38LL, (int64_t)0xFFFFFFFFFFF97FD4LL, (int64_t)0x904B8LL, (int64_t)0xFFFFFFFFFFFCD9E0LL, (int64_t)0xFFFFFFFFFFF9CE98LL, (int64_t)0xFFFFFFFFFFFF248CLL, (int64_t)0xFFFFFFFFFFFB1400LL, (int64_t)0x49974LL, (int64_t)0x4204CLL, (int64_t)0xFFFFFFFFFFFE496CLL, (int64_t)0x78B54LL, (int64_t)0xFFFFFFFFFFFE9B40LL, (int64_t)0xFFFFFFFFFFFDB72CLL, (int64_t)0x5958CLL, (int64_t)0xFFFFFFFFFFFB917CLL, (int64_t)0xFFFFFFFFFFFEA3C4LL, (int64_t)0x9F24LL, (int64_t)0xFFFFFFFFFFFFEBE4LL, (int64_t)0xFFFFFFFFFFFD0F38LL, (int64_t)0xFFFFFFFFFFF7CE6CLL, (int64_t)0xFFFFFFFFFFFEBCE8LL, (int64_t)0x45CECLL, (int64_t)0x43224LL, (int64_t)0x6BDCLL, (int64_t)0xFFFFFFFFFFF7898CLL, (int64_t)0xFFFFFFFFFFF66DE0LL, (int64_t)0xFFFFFFFFFFFC844CLL, (int64_t)0xFFFFFFFFFFFF41B4LL, (int64_t)0x267ACLL, (int64_t)0xFFFFFFFFFFFADE44LL, (int64_t)0x7EEBCLL, (int64_t)0x68708LL, (int64_t)0x84268LL, (int64_t)0xFFFFFFFFFFFE3730LL, (int64_t)0xFFFFFFFFFFFA78E0LL, (int64_t)0xFFFFFFFFFFF8D898LL, (int64_t)0xFFFFFFFFFFF8ED04LL, (int64_t)0xFFFFFFFFFFFDECACLL, (int64_t)0x3518CLL, (int64_t)0x3D878LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::SinTurnsFastest", Fixed64::SinTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SinTurns()
+	static void Fixed32_SinTurns()
+	{
+		static const int32_t input0[] = { (int32_t)0x844801BB, (int32_t)0xD9C1697F, (int32_t)0xBFB34C77, (int32_t)0xC6006717, (int32_t)0xB88DDE8B, (int32_t)0x2225C688, (int32_t)0x102F6094, (int32_t)0x49F1D61E, (int32_t)0x6E167978, (int32_t)0x4D84E58A, (int32_t)0xE6688D87, (int32_t)0x69EF12CE, (int32_t)0x4F630188, (int32_t)0xF3E42305, (int32_t)0xA4F14907, (int32_t)0xA7871049, (int32_t)0xC372D3B5, (int32_t)0xABC989B7, (int32_t)0xF6ADE40F, (int32_t)0x614FEAEA, (int32_t)0xAC037F2D, (int32_t)0xF50270F9, (int32_t)0xE4AE05C3, (int32_t)0xD9EB2AD1, (int32_t)0x3F8EB320, (int32_t)0x5E6D1102, (int32_t)0xC70DFB0F, (int32_t)0x1FD34E74, (int32_t)0x2F8CEA4C, (int32_t)0x67C366E, (int32_t)0x66E0CA2C, (int32_t)0x8B59BB7F, (int32_t)0x10574020, (int32_t)0x964EB0A3, (int32_t)0x362DB490, (int32_t)0x2EC67870, (int32_t)0xF4563FC7, (int32_t)0xEF1E3A13, (int32_t)0x36C086FC, (int32_t)0x657EB376, (int32_t)0x5460F1AE, (int32_t)0xB5DCCCF1, (int32_t)0xD6AC3227, (int32_t)0x39932204, (int32_t)0xF6D1FC6D, (int32_t)0x759EE0C8, (int32_t)0xEA707951, (int32_t)0xD2EDE5F3, (int32_t)0xD263F641, (int32_t)0x8365FD2F, (int32_t)0x17930, (int32_t)0x125CA, (int32_t)0xFFFF4898, (int32_t)0xFFFF97AD, (int32_t)0x139BE, (int32_t)0x2E9B, (int32_t)0x16549, (int32_t)0x1369D, (int32_t)0x13AA, (int32_t)0xFFFF8C6D, (int32_t)0xFFFF8F5F, (int32_t)0x156E4, (int32_t)0xFFFEC9ED, (int32_t)0xFFFFB58C, (int32_t)0x1393C, (int32_t)0xFFFF8F43, (int32_t)0xFFFF8ACB, (int32_t)0xAE31, (int32_t)0xBC54, (int32_t)0xFFFFE1FF, (int32_t)0x9C38, (int32_t)0x1015B, (int32_t)0xFFFFDE8A, (int32_t)0x3471, (int32_t)0xFFFEA0D9, (int32_t)0x16891, (int32_t)0xFFFED5F5, (int32_t)0x838B, (int32_t)0x12E6C, (int32_t)0xE1A3, (int32_t)0xFFFFDB57, (int32_t)0x16262, (int32_t)0xFFFF65B1, (int32_t)0x86BD, (int32_t)0x213A, (int32_t)0xFFFE8D8B, (int32_t)0xDA0C, (int32_t)0xFFFF1392, (int32_t)0xFFFF0A55, (int32_t)0xFFFEF01C, (int32_t)0xB015, (int32_t)0x2C6B, (int32_t)0x13F70, (int32_t)0xFFFF940B, (int32_t)0x1FBE, (int32_t)0x1313B, (int32_t)0xFFFECD34, (int32_t)0x152F5, (int32_t)0xFD17, (int32_t)0xFFFECE1A };
+		static const int32_t output0[] = { (int32_t)0xFFFFE526, (int32_t)0xFFFF3177, (int32_t)0xFFFF0001, (int32_t)0xFFFF02C5, (int32_t)0xFFFF0443, (int32_t)0xBE4E, (int32_t)0x630A, (int32_t)0xF869, (int32_t)0x6CF4, (int32_t)0xF209, (int32_t)0xFFFF6991, (int32_t)0x83F7, (int32_t)0xEDF5, (int32_t)0xFFFFB508, (int32_t)0xFFFF3667, (int32_t)0xFFFF2CCE, (int32_t)0xFFFF00EA, (int32_t)0xFFFF1EDC, (int32_t)0xFFFFC5F2, (int32_t)0xAF18, (int32_t)0xFFFF1E30, (int32_t)0xFFFFBBC7, (int32_t)0xFFFF60EB, (int32_t)0xFFFF3213, (int32_t)0xFFFC, (int32_t)0xBBE0, (int32_t)0xFFFF03D3, (int32_t)0xB43D, (int32_t)0xEB6A, (int32_t)0x2893, (int32_t)0x9408, (int32_t)0xFFFFB999, (int32_t)0x63F1, (int32_t)0xFFFF7ABC, (int32_t)0xF899, (int32_t)0xE976, (int32_t)0xFFFFB7B7, (int32_t)0xFFFF98EF, (int32_t)0xF96F, (int32_t)0x9B09, (int32_t)0xE0A3, (int32_t)0xFFFF07E2, (int32_t)0xFFFF269F, (int32_t)0xFCD2, (int32_t)0xFFFFC6CF, (int32_t)0x4083, (int32_t)0xFFFF7EC3, (int32_t)0xFFFF1B22, (int32_t)0xFFFF19A3, (int32_t)0xFFFFEAAC, (int32_t)0x9, (int32_t)0x7, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFD, (int32_t)0x7, (int32_t)0x1, (int32_t)0x8, (int32_t)0x7, (int32_t)0x0, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFFD, (int32_t)0x8, (int32_t)0xFFFFFFF8, (int32_t)0xFFFFFFFE, (int32_t)0x7, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFFD, (int32_t)0x4, (int32_t)0x4, (int32_t)0xFFFFFFFF, (int32_t)0x3, (int32_t)0x6, (int32_t)0xFFFFFFFF, (int32_t)0x1, (int32_t)0xFFFFFFF7, (int32_t)0x8, (int32_t)0xFFFFFFF8, (int32_t)0x3, (int32_t)0x7, (int32_t)0x5, (int32_t)0xFFFFFFFF, (int32_t)0x8, (int32_t)0xFFFFFFFC, (int32_t)0x3, (int32_t)0x0, (int32_t)0xFFFFFFF6, (int32_t)0x5, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFFF9, (int32_t)0xFFFFFFF9, (int32_t)0x4, (int32_t)0x1, (int32_t)0x7, (int32_t)0xFFFFFFFD, (int32_t)0x0, (int32_t)0x7, (int32_t)0xFFFFFFF8, (int32_t)0x8, (int32_t)0x6, (int32_t)0xFFFFFFF8 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SinTurns", Fixed32::SinTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SinTurnsFast()
+	static void Fixed32_SinTurnsFast()
+	{
+		static const int32_t input0[] = { (int32_t)0x1BC6BD80, (int32_t)0x4701AD48, (int32_t)0x449F75A, (int32_t)0x9768E7B3, (int32_t)0x814C907F, (int32_t)0x899886A, (int32_t)0x57AE2934, (int32_t)0x5B772F70, (int32_t)0xB740920D, (int32_t)0xE2AD607B, (int32_t)0x75EA96E2, (int32_t)0xF2E31437, (int32_t)0xE6C30787, (int32_t)0x2CD14D1E, (int32_t)0xE606A96D, (int32_t)0xAAE5B61B, (int32_t)0x280C72C, (int32_t)0x2EA87BE, (int32_t)0xBF375D31, (int32_t)0x208D70DE, (int32_t)0xC32A56CF, (int32_t)0xC1A0074F, (int32_t)0x9E6EBE53, (int32_t)0x114751FE, (int32_t)0xA499A691, (int32_t)0x1ECD6F96, (int32_t)0xB3D8ECC7, (int32_t)0xA81BF2F3, (int32_t)0x907A8E4D, (int32_t)0xD3C45A0B, (int32_t)0xE31D606F, (int32_t)0xF3F340C, (int32_t)0x77CBCC0A, (int32_t)0x468B1EA8, (int32_t)0x57ED1FC6, (int32_t)0xDB29F85B, (int32_t)0x3C1BB76E, (int32_t)0x27A1CC14, (int32_t)0xB85CAD69, (int32_t)0x48829D02, (int32_t)0x6D0E72AE, (int32_t)0xB319B6B3, (int32_t)0xF5DAA53B, (int32_t)0xC11B1475, (int32_t)0x8DAD6FA1, (int32_t)0x9F71CC05, (int32_t)0xF0127A9F, (int32_t)0x27FC060A, (int32_t)0x4A800A10, (int32_t)0x94504197, (int32_t)0xFFFE917E, (int32_t)0x1578B, (int32_t)0xFFFED439, (int32_t)0xB2A6, (int32_t)0xFFFFA391, (int32_t)0xFFFF8C7F, (int32_t)0x7BD2, (int32_t)0x15EFB, (int32_t)0x15E5E, (int32_t)0xFFFFA5F7, (int32_t)0xFFFF7C05, (int32_t)0x912C, (int32_t)0xE4D7, (int32_t)0x12F9A, (int32_t)0x1854A, (int32_t)0xFFFFB2B3, (int32_t)0xFFFFF105, (int32_t)0x6252, (int32_t)0x10311, (int32_t)0xFFFE9A86, (int32_t)0xFFFFCB7A, (int32_t)0x11550, (int32_t)0xFFFF5CE6, (int32_t)0xFFFFE3A4, (int32_t)0x9D27, (int32_t)0xFFFEAA67, (int32_t)0xE73C, (int32_t)0x11CCF, (int32_t)0xAFD, (int32_t)0xFFFE891C, (int32_t)0xFFFF07FD, (int32_t)0x2433, (int32_t)0xFFFF970D, (int32_t)0x17AEC, (int32_t)0xFFFF60E6, (int32_t)0xFFFFD6EF, (int32_t)0xFFFFD3AF, (int32_t)0xFFFF3451, (int32_t)0xFFFFAD18, (int32_t)0xFFFFF936, (int32_t)0x9A63, (int32_t)0xDF13, (int32_t)0xA133, (int32_t)0x1060A, (int32_t)0xFFFFDAA4, (int32_t)0xFFFF3504, (int32_t)0xFFFFB71B, (int32_t)0x380E, (int32_t)0xFFFF4166, (int32_t)0x770B };
+		static const int32_t output0[] = { (int32_t)0xA150, (int32_t)0xFC39, (int32_t)0x1AE5, (int32_t)0xFFFF74DF, (int32_t)0xFFFFF7D6, (int32_t)0x35A2, (int32_t)0xD5F7, (int32_t)0xC800, (int32_t)0xFFFF05E0, (int32_t)0xFFFF5741, (int32_t)0x3EB6, (int32_t)0xFFFFAF06, (int32_t)0xFFFF6B5F, (int32_t)0xE425, (int32_t)0xFFFF67A1, (int32_t)0xFFFF2193, (int32_t)0xFB7, (int32_t)0x124E, (int32_t)0xFFFF000C, (int32_t)0xB775, (int32_t)0xFFFF00C5, (int32_t)0xFFFF0034, (int32_t)0xFFFF5213, (int32_t)0x6956, (int32_t)0xFFFF37BD, (int32_t)0xAF9F, (int32_t)0xFFFF0B4D, (int32_t)0xFFFF2AC3, (int32_t)0xFFFF9B42, (int32_t)0xFFFF1D8A, (int32_t)0xFFFF5955, (int32_t)0x5D94, (int32_t)0x3332, (int32_t)0xFCB4, (int32_t)0xD51C, (int32_t)0xFFFF36D1, (int32_t)0xFED5, (int32_t)0xD390, (int32_t)0xFFFF047C, (int32_t)0xFA6F, (int32_t)0x72C8, (int32_t)0xFFFF0CB9, (int32_t)0xFFFFC0E8, (int32_t)0xFFFF0018, (int32_t)0xFFFFABAA, (int32_t)0xFFFF4D77, (int32_t)0xFFFF9E73, (int32_t)0xD4CD, (int32_t)0xF78B, (int32_t)0xFFFF8596, (int32_t)0xFFFFFFF7, (int32_t)0x8, (int32_t)0xFFFFFFF8, (int32_t)0x4, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFFD, (int32_t)0x3, (int32_t)0x8, (int32_t)0x8, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFFC, (int32_t)0x3, (int32_t)0x5, (int32_t)0x7, (int32_t)0x9, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFFF, (int32_t)0x2, (int32_t)0x6, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFFFFE, (int32_t)0x6, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFF, (int32_t)0x3, (int32_t)0xFFFFFFF7, (int32_t)0x5, (int32_t)0x6, (int32_t)0x0, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFF9, (int32_t)0x0, (int32_t)0xFFFFFFFD, (int32_t)0x9, (int32_t)0xFFFFFFFC, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFFE, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFD, (int32_t)0xFFFFFFFF, (int32_t)0x3, (int32_t)0x5, (int32_t)0x3, (int32_t)0x6, (int32_t)0xFFFFFFFF, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFE, (int32_t)0x1, (int32_t)0xFFFFFFFB, (int32_t)0x2 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SinTurnsFast", Fixed32::SinTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SinTurnsFastest()
+	static void Fixed32_SinTurnsFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0x95ECD1C3, (int32_t)0xB524158D, (int32_t)0xB433F92, (int32_t)0xE8D2C48B, (int32_t)0x2658B084, (int32_t)0x170C1D34, (int32_t)0x5680A4EA, (int32_t)0xA720F677, (int32_t)0x10BCAA6E, (int32_t)0xD132A847, (int32_t)0x77F8A30E, (int32_t)0xCEE84D55, (int32_t)0x4CF25A0E, (int32_t)0x2ABCA5F8, (int32_t)0xF201E2A, (int32_t)0x25C0482E, (int32_t)0x3A07670E, (int32_t)0x6260BA0, (int32_t)0x37EF3844, (int32_t)0x2DB0D354, (int32_t)0x4BE077DE, (int32_t)0x2BEFDA2A, (int32_t)0xBE50FA03, (int32_t)0x1247E00C, (int32_t)0x4429DB3E, (int32_t)0x774664FA, (int32_t)0xC9CDC717, (int32_t)0x892E7E95, (int32_t)0x5E969D70, (int32_t)0x5B86860A, (int32_t)0x2635EF5E, (int32_t)0x840D4B9F, (int32_t)0x31F9635A, (int32_t)0xFCE336CB, (int32_t)0x60970786, (int32_t)0xD540696D, (int32_t)0x638A1848, (int32_t)0x79B63AB0, (int32_t)0x47D4ECA, (int32_t)0xCF70977F, (int32_t)0x3C74D49A, (int32_t)0xC4103335, (int32_t)0x59615C7E, (int32_t)0xD23FA21B, (int32_t)0xE88400BD, (int32_t)0x5B2D0048, (int32_t)0xB288B7A9, (int32_t)0x357C0B16, (int32_t)0x4FA5DE2E, (int32_t)0xB2D64299, (int32_t)0xFFFFE8F0, (int32_t)0xFFFE96D3, (int32_t)0xFFFFF75A, (int32_t)0xFFFEA027, (int32_t)0xFFFF51FC, (int32_t)0xFFFFBCD4, (int32_t)0x16A9F, (int32_t)0x17135, (int32_t)0x6FE0, (int32_t)0x8FA6, (int32_t)0xFFFF651B, (int32_t)0xEBF6, (int32_t)0xFFFF56C1, (int32_t)0xA263, (int32_t)0x832F, (int32_t)0x161C1, (int32_t)0x584C, (int32_t)0xFFFF6DB3, (int32_t)0xE247, (int32_t)0xFFFF29FE, (int32_t)0xCA0F, (int32_t)0xC447, (int32_t)0xFFFE7E71, (int32_t)0xFFFFB845, (int32_t)0x15990, (int32_t)0x17D8, (int32_t)0xFBF1, (int32_t)0x149CB, (int32_t)0xFFFEF8D6, (int32_t)0x14065, (int32_t)0xD1C7, (int32_t)0x3E02, (int32_t)0xFFFF28F5, (int32_t)0x8584, (int32_t)0xFFFFA7C1, (int32_t)0x5729, (int32_t)0x1504, (int32_t)0x71BB, (int32_t)0xFFFF1DE5, (int32_t)0xFFFFE352, (int32_t)0xFFFF998C, (int32_t)0x14530, (int32_t)0xFFFF7CEF, (int32_t)0x104AC, (int32_t)0xFFFE8014, (int32_t)0x15328, (int32_t)0x178F6, (int32_t)0xFFFEE7C1, (int32_t)0x77D0, (int32_t)0xFFFFDD33 };
+		static const int32_t output0[] = { (int32_t)0xFFFF7CC6, (int32_t)0xFFFF0911, (int32_t)0x45DE, (int32_t)0xFFFF7615, (int32_t)0xCEF0, (int32_t)0x893A, (int32_t)0xD9F5, (int32_t)0xFFFF2E35, (int32_t)0x663C, (int32_t)0xFFFF1678, (int32_t)0x321F, (int32_t)0xFFFF10F4, (int32_t)0xF329, (int32_t)0xDDF0, (int32_t)0x5CDF, (int32_t)0xCCB6, (int32_t)0xFD36, (int32_t)0x267C, (int32_t)0xFAF5, (int32_t)0xE696, (int32_t)0xF52C, (int32_t)0xE198, (int32_t)0xFFFF003D, (int32_t)0x6F0E, (int32_t)0xFEA0, (int32_t)0x3667, (int32_t)0xFFFF0768, (int32_t)0xFFFFC6CB, (int32_t)0xBB36, (int32_t)0xC7CC, (int32_t)0xCE6F, (int32_t)0xFFFFE695, (int32_t)0xF0F7, (int32_t)0xFFFFEC76, (int32_t)0xB268, (int32_t)0xFFFF2206, (int32_t)0xA4A8, (int32_t)0x275A, (int32_t)0x1C26, (int32_t)0xFFFF122B, (int32_t)0xFEFF, (int32_t)0xFFFF014F, (int32_t)0xCFF1, (int32_t)0xFFFF193E, (int32_t)0xFFFF7475, (int32_t)0xC92A, (int32_t)0xFFFF0DDF, (int32_t)0xF77D, (int32_t)0xED57, (int32_t)0xFFFF0D43, (int32_t)0xFFFFFFFF, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFFFFF, (int32_t)0xFFFFFFF7, (int32_t)0xFFFFFFFB, (int32_t)0xFFFFFFFE, (int32_t)0x8, (int32_t)0x9, (int32_t)0x2, (int32_t)0x3, (int32_t)0xFFFFFFFC, (int32_t)0x5, (int32_t)0xFFFFFFFB, (int32_t)0x3, (int32_t)0x3, (int32_t)0x8, (int32_t)0x2, (int32_t)0xFFFFFFFC, (int32_t)0x5, (int32_t)0xFFFFFFFA, (int32_t)0x4, (int32_t)0x4, (int32_t)0xFFFFFFF6, (int32_t)0xFFFFFFFE, (int32_t)0x8, (int32_t)0x0, (int32_t)0x6, (int32_t)0x8, (int32_t)0xFFFFFFF9, (int32_t)0x7, (int32_t)0x5, (int32_t)0x1, (int32_t)0xFFFFFFFA, (int32_t)0x3, (int32_t)0xFFFFFFFD, (int32_t)0x2, (int32_t)0x0, (int32_t)0x2, (int32_t)0xFFFFFFFA, (int32_t)0xFFFFFFFF, (int32_t)0xFFFFFFFD, (int32_t)0x7, (int32_t)0xFFFFFFFC, (int32_t)0x6, (int32_t)0xFFFFFFF6, (int32_t)0x8, (int32_t)0x9, (int32_t)0xFFFFFFF9, (int32_t)0x2, (int32_t)0xFFFFFFFF };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::SinTurnsFastest", Fixed32::SinTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CosTurns()
+	static void Fixed64_CosTurns()
+	{
+		static const int32_t input0[] = { (int32_t)0x58C17416, (int32_t)0x37BFD40, (int32_t)0xC636EE75, (int32_t)0xC444E5AD, (int32_t)0xF79C0873, (int32_t)0x697550E8, (int32_t)0x97BBACC9, (int32_t)0x77BEF382, (int32_t)0xB85043EF, (int32_t)0xA4EEF8F5, (int32_t)0x2219A64, (int32_t)0x736E8690, (int32_t)0xE408CDBB, (int32_t)0x11276E92, (int32_t)0xD659ABC5, (int32_t)0xEC94E195, (int32_t)0xCF6E1161, (int32_t)0x620A8312, (int32_t)0x399DDFB6, (int32_t)0x300164A, (int32_t)0x3AA989A0, (int32_t)0xF8BB46C7, (int32_t)0x69CA1E78, (int32_t)0x318F234A, (int32_t)0x85D8F755, (int32_t)0x43A6936, (int32_t)0xD5B2862, (int32_t)0xE79F0123, (int32_t)0x2E26281E, (int32_t)0xF2B0C1AF, (int32_t)0x486AE3DA, (int32_t)0x632BB744, (int32_t)0xAD4BC3F7, (int32_t)0x4CE155E4, (int32_t)0xD17463E, (int32_t)0x2C8C42BA, (int32_t)0xAA842935, (int32_t)0xA65FB3C3, (int32_t)0xB3459F4B, (int32_t)0xC6C80017, (int32_t)0x96673CB3, (int32_t)0x1F8B4958, (int32_t)0xB4514751, (int32_t)0xAAC498EB, (int32_t)0x7244D7FA, (int32_t)0x566473A8, (int32_t)0x6DB64386, (int32_t)0x5E00AD16, (int32_t)0x63D91DC4, (int32_t)0xD8B6500F, (int32_t)0xFFFFB861, (int32_t)0xAE8F, (int32_t)0xFFFF2282, (int32_t)0xFFFE7E8C, (int32_t)0xFFFF7ABF, (int32_t)0xFFFF9E6B, (int32_t)0x4E6A, (int32_t)0x3F09, (int32_t)0xFFFF37DF, (int32_t)0x1601D, (int32_t)0xFFFF9273, (int32_t)0x92D3, (int32_t)0xFFFF59FA, (int32_t)0xD479, (int32_t)0xFFFF93B7, (int32_t)0x5E7B, (int32_t)0xD609, (int32_t)0x46A9, (int32_t)0xFFFE85C7, (int32_t)0x7F92, (int32_t)0xFFFF42FE, (int32_t)0xFFFEF6AC, (int32_t)0x8EBA, (int32_t)0xFFFFD7D4, (int32_t)0xFFFFC4CA, (int32_t)0xFFFECC23, (int32_t)0xFFFF4A29, (int32_t)0xC053, (int32_t)0xC125, (int32_t)0xFFFF0A33, (int32_t)0x44B6, (int32_t)0x9082, (int32_t)0xB83, (int32_t)0xFFFF7E1C, (int32_t)0xFFFE9862, (int32_t)0xFFFEA7D1, (int32_t)0x8584, (int32_t)0xFFFEFE71, (int32_t)0xFFFFE941, (int32_t)0xFFFF02E9, (int32_t)0xFFFEB2E9, (int32_t)0x42B6, (int32_t)0x13D3C, (int32_t)0xFFFF3C5B, (int32_t)0x1458F, (int32_t)0xFFFFB18C, (int32_t)0xFFFF7FAB, (int32_t)0xFFFFCB31, (int32_t)0xEECE, (int32_t)0xFFFF779D };
+		static const int64_t output0[] = { (int64_t)0xFFFFFFFF6DD9D08CLL, (int64_t)0xFF108008LL, (int64_t)0x26E56704LL, (int64_t)0x1AC65134LL, (int64_t)0xFA97417CLL, (int64_t)0xFFFFFFFF2630D4BCLL, (int64_t)0xFFFFFFFF2A377910LL, (int64_t)0xFFFFFFFF053C3DB8LL, (int64_t)0xFFFFFFFFCFFD90E8LL, (int64_t)0xFFFFFFFF622BE4B0LL, (int64_t)0xFFA65BE0LL, (int64_t)0xFFFFFFFF0C156198LL, (int64_t)0xC6071608LL, (int64_t)0xE9A4D224LL, (int64_t)0x857E3F5CLL, (int64_t)0xE378A7FCLL, (int64_t)0x5EA5FE08LL, (int64_t)0xFFFFFFFF4224B240LL, (int64_t)0x27F190B8LL, (int64_t)0xFF4E62F8LL, (int64_t)0x217132ACLL, (int64_t)0xFBEFEECCLL, (int64_t)0xFFFFFFFF251AB1A0LL, (int64_t)0x58D8C9ECLL, (int64_t)0xFFFFFFFF02A1CBB0LL, (int64_t)0xFE9F6E30LL, (int64_t)0xF25E3D80LL, (int64_t)0xD38640E8LL, (int64_t)0x6C9B5614LL, (int64_t)0xF2764D60LL, (int64_t)0xFFFFFFFFCB7C89D0LL, (int64_t)0xFFFFFFFF3D749664LL, (int64_t)0xFFFFFFFF8E904374LL, (int64_t)0xFFFFFFFFB0699690LL, (int64_t)0xF2E64098LL, (int64_t)0x75A176D4LL, (int64_t)0xFFFFFFFF7F2EB2DCLL, (int64_t)0xFFFFFFFF6964DE00LL, (int64_t)0xFFFFFFFFB15260F8LL, (int64_t)0x2A695290LL, (int64_t)0xFFFFFFFF25BC1F70LL, (int64_t)0xB708950CLL, (int64_t)0xFFFFFFFFB7992C9CLL, (int64_t)0xFFFFFFFF808D3334LL, (int64_t)0xFFFFFFFF0E6696B4LL, (int64_t)0xFFFFFFFF7A47F8BCLL, (int64_t)0xFFFFFFFF195BB8D8LL, (int64_t)0xFFFFFFFF54119094LL, (int64_t)0xFFFFFFFF3AB75470LL, (int64_t)0x91ECB168LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFD0LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFD8LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFF4LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF4LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFD0LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFE4LL, (int64_t)0xFFFFFFF4LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFFFE0LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFD8LL, (int64_t)0xFFFFFFD4LL, (int64_t)0xFFFFFFF4LL, (int64_t)0xFFFFFFE4LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFE0LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFDCLL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFD8LL, (int64_t)0xFFFFFFF4LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFE8LL, (int64_t)0xFFFFFFF4LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::CosTurns", Fixed64::CosTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CosTurnsFast()
+	static void Fixed64_CosTurnsFast()
+	{
+		static const int32_t input0[] = { (int32_t)0xE18DBA7B, (int32_t)0xCB8333F9, (int32_t)0xE908304F, (int32_t)0x29591C0, (int32_t)0xDE6F75B1, (int32_t)0x81AD117D, (int32_t)0x14E64244, (int32_t)0x4BFA7F7E, (int32_t)0x65B26662, (int32_t)0xF59F6CA3, (int32_t)0x701A1978, (int32_t)0x3AF0DA74, (int32_t)0xB8F29269, (int32_t)0x23959C64, (int32_t)0x3E0C44F6, (int32_t)0x8CC15D9F, (int32_t)0xDC29F555, (int32_t)0xFF7266C7, (int32_t)0x357F5114, (int32_t)0x3E77312, (int32_t)0x9B941891, (int32_t)0xE5CC6161, (int32_t)0xC954E55F, (int32_t)0xECDAEA11, (int32_t)0xC916159F, (int32_t)0xA27C3D87, (int32_t)0x5CE7E460, (int32_t)0x6103A072, (int32_t)0x32B54188, (int32_t)0xF801FF03, (int32_t)0xCC680745, (int32_t)0x3BD9C984, (int32_t)0x892E9551, (int32_t)0xAA3F78A7, (int32_t)0xE2D8B475, (int32_t)0x7363843A, (int32_t)0x19528C68, (int32_t)0x82C8F6B9, (int32_t)0xBB8456D3, (int32_t)0x5B98C5AE, (int32_t)0x1AFCF88C, (int32_t)0x36BCA484, (int32_t)0x1584705A, (int32_t)0xC22666D7, (int32_t)0x18AFB7BA, (int32_t)0x2C088F14, (int32_t)0xE323F123, (int32_t)0x9EFEE5CD, (int32_t)0x312BCF8C, (int32_t)0x9AB1B4A5, (int32_t)0x813B, (int32_t)0xFFFF4768, (int32_t)0xFFFF3BD0, (int32_t)0x1713E, (int32_t)0xFFFE9DD3, (int32_t)0x179AB, (int32_t)0xFFFE8008, (int32_t)0x17AF5, (int32_t)0xFFFF28D9, (int32_t)0xFFFF3054, (int32_t)0xFFFEE997, (int32_t)0x9E57, (int32_t)0xFFFEC67F, (int32_t)0xFFFFC81F, (int32_t)0xFFFEF729, (int32_t)0xFFFF18D6, (int32_t)0x97DA, (int32_t)0xFFFEA63D, (int32_t)0xFFFF3EF1, (int32_t)0xE3D7, (int32_t)0xFFFFD9A6, (int32_t)0xFFFF8A24, (int32_t)0xFFFF48AF, (int32_t)0x1125A, (int32_t)0x1402D, (int32_t)0xFFFFAD1F, (int32_t)0xF4FF, (int32_t)0xFFFE8F4B, (int32_t)0x100DC, (int32_t)0x58A9, (int32_t)0xC150, (int32_t)0xBCEF, (int32_t)0xFFFF0B62, (int32_t)0x4948, (int32_t)0xED00, (int32_t)0xFFFE9485, (int32_t)0xFFFFF437, (int32_t)0xFFFEAAC8, (int32_t)0xFFFED5DC, (int32_t)0xFFFFB3FD, (int32_t)0x1597B, (int32_t)0x58F2, (int32_t)0xDFA7, (int32_t)0x1854D, (int32_t)0xA751, (int32_t)0x13AA5, (int32_t)0x59EC, (int32_t)0xFFFEF2EC, (int32_t)0xFFFEC578, (int32_t)0xFFFFABE1 };
+		static const int64_t output0[] = { (int64_t)0xBBC9EA58LL, (int64_t)0x476067C8LL, (int64_t)0xD863C910LL, (int64_t)0xFF7C4C60LL, (int64_t)0xADEFB4E8LL, (int64_t)0xFFFFFFFF00376088LL, (int64_t)0xDF0D80F4LL, (int64_t)0xFFFFFFFFB5D0F99CLL, (int64_t)0xFFFFFFFF3384E8E8LL, (int64_t)0xF7BDC940LL, (int64_t)0xFFFFFFFF133E23E0LL, (int64_t)0x1FB4C090LL, (int64_t)0xFFFFFFFFD3E8B814LL, (int64_t)0xA46A32FCLL, (int64_t)0xC42B2F4LL, (int64_t)0xFFFFFFFF0C7172E4LL, (int64_t)0xA33318A8LL, (int64_t)0xFFF9FD2CLL, (int64_t)0x41430938LL, (int64_t)0xFED372D8LL, (int64_t)0xFFFFFFFF38709A64LL, (int64_t)0xCCDD2434LL, (int64_t)0x3A1F0004LL, (int64_t)0xE4412374LL, (int64_t)0x389E61B0LL, (int64_t)0xFFFFFFFF565A2F58LL, (int64_t)0xFFFFFFFF593C6F08LL, (int64_t)0xFFFFFFFF468802A0LL, (int64_t)0x520ADBBCLL, (int64_t)0xFB173728LL, (int64_t)0x4CC0A35CLL, (int64_t)0x1A068CE8LL, (int64_t)0xFFFFFFFF06792604LL, (int64_t)0xFFFFFFFF7DBA67C8LL, (int64_t)0xC136D440LL, (int64_t)0xFFFFFFFF0C2A77C4LL, (int64_t)0xD020E29CLL, (int64_t)0xFFFFFFFF0098F64CLL, (int64_t)0xFFFFFFFFE3E39328LL, (int64_t)0xFFFFFFFF5F8FC208LL, (int64_t)0xC9DCC4DCLL, (int64_t)0x39B3A884LL, (int64_t)0xDD1F37A4LL, (int64_t)0xD80ABD8LL, (int64_t)0xD26E1234LL, (int64_t)0x787E0E84LL, (int64_t)0xC26BA824LL, (int64_t)0xFFFFFFFF4692F1CCLL, (int64_t)0x5B2111A0LL, (int64_t)0xFFFFFFFF3501BE58LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFE8LL, (int64_t)0xFFFFFFF4LL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFE8LL, (int64_t)0xFFFFFFECLL, (int64_t)0x100000000LL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFFCLL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFF8LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFFCLL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFF0LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFCLL, (int64_t)0x100000000LL, (int64_t)0x100000008LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFF8LL, (int64_t)0xFFFFFFF0LL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFFFECLL, (int64_t)0xFFFFFFF8LL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFFCLL, (int64_t)0x100000000LL, (int64_t)0x100000000LL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFFFF0LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFF0LL, (int64_t)0xFFFFFFF8LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFECLL, (int64_t)0x100000004LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFFFE4LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFF4LL, (int64_t)0x100000000LL, (int64_t)0xFFFFFFFCLL, (int64_t)0xFFFFFFF4LL, (int64_t)0x100000004LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::CosTurnsFast", Fixed64::CosTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CosTurnsFastest()
+	static void Fixed64_CosTurnsFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0xF9C2BD25, (int32_t)0x906E8C85, (int32_t)0xC652C3A3, (int32_t)0x8A2F0CE3, (int32_t)0xA6C89C49, (int32_t)0x7704D352, (int32_t)0x8A150075, (int32_t)0x5F2DE444, (int32_t)0x2C849306, (int32_t)0xD3665C03, (int32_t)0x91CBA3C9, (int32_t)0xFA8A51B9, (int32_t)0xA74EE1EB, (int32_t)0xCF59DAB7, (int32_t)0x9BF28FB5, (int32_t)0x127CBAE, (int32_t)0xF1DED593, (int32_t)0xD34C6EEF, (int32_t)0x49A69788, (int32_t)0xCDB0200B, (int32_t)0x43073984, (int32_t)0xE8CB0027, (int32_t)0xFB3F4C1B, (int32_t)0x4BC5DA18, (int32_t)0x65477422, (int32_t)0xE34AD4E1, (int32_t)0xB20ECF57, (int32_t)0xDF62E20D, (int32_t)0xAC1E1EB9, (int32_t)0x5D7EB300, (int32_t)0x933CE6D7, (int32_t)0x91F315C7, (int32_t)0x7E0C961E, (int32_t)0x75D4572C, (int32_t)0xA153BB9F, (int32_t)0x2B42B8A8, (int32_t)0x2827C136, (int32_t)0x34A613CC, (int32_t)0x7F80295A, (int32_t)0x17B5242, (int32_t)0x6B9D56F4, (int32_t)0xF6F0C64F, (int32_t)0x9CCBD7FD, (int32_t)0xAE55B0A3, (int32_t)0xCF3D75B7, (int32_t)0x233393CE, (int32_t)0x68EBE3DC, (int32_t)0x2EBA794, (int32_t)0x817B8EA, (int32_t)0x1A5F61A0, (int32_t)0x15F44, (int32_t)0xFFFF30A5, (int32_t)0xFFFF4ABC, (int32_t)0x12815, (int32_t)0xFFFF0313, (int32_t)0xFFFEAD29, (int32_t)0x40A6, (int32_t)0xFFFFEF5F, (int32_t)0xFFFEEA00, (int32_t)0xCDF7, (int32_t)0xD273, (int32_t)0x824C, (int32_t)0x9BD3, (int32_t)0xF128, (int32_t)0xFFFF3D2F, (int32_t)0x18627, (int32_t)0xFFFFF54B, (int32_t)0xFFFF1060, (int32_t)0xFFFF05D5, (int32_t)0xFFFFD145, (int32_t)0x10F9B, (int32_t)0xBAD5, (int32_t)0xFFFF791C, (int32_t)0xFFFF559F, (int32_t)0xFFFFA4AC, (int32_t)0xFFFF6194, (int32_t)0xFFFF614D, (int32_t)0xFFFF6418, (int32_t)0xFFFFF56C, (int32_t)0xFFFF4308, (int32_t)0xFFFFEED3, (int32_t)0x8FDA, (int32_t)0x10A66, (int32_t)0x3627, (int32_t)0x144AE, (int32_t)0x10A10, (int32_t)0xEC0B, (int32_t)0xFFFED1F7, (int32_t)0xDDE3, (int32_t)0xFFFEAB4D, (int32_t)0xFFFEBCBF, (int32_t)0xFFFF048D, (int32_t)0x300C, (int32_t)0xFFFF3083, (int32_t)0xB8B1, (int32_t)0xFFFF3F7E, (int32_t)0xCF26, (int32_t)0xFFFF66B9, (int32_t)0x15038, (int32_t)0xFFFF6BAB };
+		static const int64_t output0[] = { (int64_t)0xFCF646F4LL, (int64_t)0xFFFFFFFF148AC528LL, (int64_t)0x27925C48LL, (int64_t)0xFFFFFFFF07FD09D8LL, (int64_t)0xFFFFFFFF6B762744LL, (int64_t)0xFFFFFFFF063B5CD8LL, (int64_t)0xFFFFFFFF07D4DA9CLL, (int64_t)0xFFFFFFFF4EA24E34LL, (int64_t)0x75CFA1FCLL, (int64_t)0x755A0558LL, (int64_t)0xFFFFFFFF18078CECLL, (int64_t)0xFDA9D098LL, (int64_t)0xFFFFFFFF6E28ABA0LL, (int64_t)0x5E31BE50LL, (int64_t)0xFFFFFFFF39DED38CLL, (int64_t)0xFFE18D38LL, (int64_t)0xF0BEACC4LL, (int64_t)0x74C91BE4LL, (int64_t)0xFFFFFFFFC3ED0FF8LL, (int64_t)0x546690ECLL, (int64_t)0xFFFFFFFFECFD9628LL, (int64_t)0xD79B1E54LL, (int64_t)0xFE384A84LL, (int64_t)0xFFFFFFFFB70CF1C8LL, (int64_t)0xFFFFFFFF3514975CLL, (int64_t)0xC31204D0LL, (int64_t)0xFFFFFFFFAA17D40CLL, (int64_t)0xB24D4608LL, (int64_t)0xFFFFFFFF87F621B8LL, (int64_t)0xFFFFFFFF566ADD04LL, (int64_t)0xFFFFFFFF1C006B94LL, (int64_t)0xFFFFFFFF1870A378LL, (int64_t)0xFFFFFFFF00515B20LL, (int64_t)0xFFFFFFFF07F7C8FCLL, (int64_t)0xFFFFFFFF50F1499CLL, (int64_t)0x7CC4F3F0LL, (int64_t)0x8D6F0138LL, (int64_t)0x4667F4B8LL, (int64_t)0xFFFFFFFF0006D7F4LL, (int64_t)0xFFCFA054LL, (int64_t)0xFFFFFFFF1F5DCC2CLL, (int64_t)0xF9A90914LL, (int64_t)0xFFFFFFFF3D4A5F40LL, (int64_t)0xFFFFFFFF9470D118LL, (int64_t)0x5D8BB9DCLL, (int64_t)0xA64766D0LL, (int64_t)0xFFFFFFFF27F5CC40LL, (int64_t)0xFF4F7B88LL, (int64_t)0xFAED45DCLL, (int64_t)0xCC3F0A44LL, (int64_t)0xFFFFFA38LL, (int64_t)0xFFFFFCA0LL, (int64_t)0xFFFFFD0CLL, (int64_t)0xFFFFFB28LL, (int64_t)0xFFFFFBE0LL, (int64_t)0xFFFFFA70LL, (int64_t)0xFFFFFEF0LL, (int64_t)0xFFFFFFB4LL, (int64_t)0xFFFFFB74LL, (int64_t)0xFFFFFCA4LL, (int64_t)0xFFFFFC90LL, (int64_t)0xFFFFFDDCLL, (int64_t)0xFFFFFD78LL, (int64_t)0xFFFFFC10LL, (int64_t)0xFFFFFCD4LL, (int64_t)0xFFFFF990LL, (int64_t)0xFFFFFFCCLL, (int64_t)0xFFFFFC18LL, (int64_t)0xFFFFFBECLL, (int64_t)0xFFFFFF38LL, (int64_t)0xFFFFFB90LL, (int64_t)0xFFFFFCF0LL, (int64_t)0xFFFFFDCCLL, (int64_t)0xFFFFFD3CLL, (int64_t)0xFFFFFE84LL, (int64_t)0xFFFFFD6CLL, (int64_t)0xFFFFFD6CLL, (int64_t)0xFFFFFD78LL, (int64_t)0xFFFFFFCCLL, (int64_t)0xFFFFFCECLL, (int64_t)0xFFFFFFB0LL, (int64_t)0xFFFFFDA8LL, (int64_t)0xFFFFFBA4LL, (int64_t)0xFFFFFF18LL, (int64_t)0xFFFFFAACLL, (int64_t)0xFFFFFBA8LL, (int64_t)0xFFFFFC24LL, (int64_t)0xFFFFFB0CLL, (int64_t)0xFFFFFC64LL, (int64_t)0xFFFFFA64LL, (int64_t)0xFFFFFAB0LL, (int64_t)0xFFFFFBE4LL, (int64_t)0xFFFFFF34LL, (int64_t)0xFFFFFCA0LL, (int64_t)0xFFFFFCFCLL, (int64_t)0xFFFFFCDCLL, (int64_t)0xFFFFFCA0LL, (int64_t)0xFFFFFD80LL, (int64_t)0xFFFFFA7CLL, (int64_t)0xFFFFFD94LL };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed64::CosTurnsFastest", Fixed64::CosTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CosTurns()
+	static void Fixed32_CosTurns()
+	{
+		static const int32_t input0[] = { (int32_t)0xBFF97A95, (int32_t)0x580994F2, (int32_t)0x56F3EF72, (int32_t)0x35F14976, (int32_t)0x75201A0C, (int32_t)0x7147A8D4, (int32_t)0xBFDFE619, (int32_t)0xEA916675, (int32_t)0xCBDF78B7, (int32_t)0x44FEFEFA, (int32_t)0xA16DF30B, (int32_t)0x52AA291E, (int32_t)0x645D35C6, (int32_t)0xA281F4F5, (int32_t)0x2705B488, (int32_t)0xE8ECAF53, (int32_t)0x52667E68, (int32_t)0xEB942FD7, (int32_t)0xF7E5DB95, (int32_t)0x8F86E949, (int32_t)0xBE41C5E9, (int32_t)0x5478F744, (int32_t)0xB70AA5D1, (int32_t)0xC2763001, (int32_t)0x1A937E9C, (int32_t)0x3FCCCC46, (int32_t)0xE1DCCFD3, (int32_t)0x40A5EF8A, (int32_t)0x94D5CEE5, (int32_t)0x3E1D24E8, (int32_t)0x876825E, (int32_t)0x7C11CEEC, (int32_t)0xE2CC9F73, (int32_t)0x1A77DDF4, (int32_t)0xDEA8ADE, (int32_t)0x2B70D73A, (int32_t)0x8F8D5B8, (int32_t)0xB0C0CEB9, (int32_t)0xDB708E5D, (int32_t)0xB8F4A76B, (int32_t)0xAE889C0F, (int32_t)0x2F2D23EC, (int32_t)0x7808F0A6, (int32_t)0xED442E77, (int32_t)0xD8557A51, (int32_t)0x4C0521AA, (int32_t)0x923E9B9D, (int32_t)0x451F52AA, (int32_t)0x8E5708B7, (int32_t)0x9227FAF1, (int32_t)0xFFFFF486, (int32_t)0xFFFF7F73, (int32_t)0xFFFEA33F, (int32_t)0xFFFED251, (int32_t)0x165E1, (int32_t)0xFFFFC172, (int32_t)0x64B1, (int32_t)0x3E88, (int32_t)0xFFFECCE4, (int32_t)0xFFFF1C1D, (int32_t)0x2F0C, (int32_t)0xFFFFFDA4, (int32_t)0xFFFF7F03, (int32_t)0x29FD, (int32_t)0xFFFF321C, (int32_t)0xFFFEEB64, (int32_t)0xFFFFCEC3, (int32_t)0xFFFF5AE4, (int32_t)0x3ED7, (int32_t)0x17924, (int32_t)0x124D2, (int32_t)0x66AE, (int32_t)0xFFFEAAA1, (int32_t)0xFFFF3976, (int32_t)0x12800, (int32_t)0x2E05, (int32_t)0x11A18, (int32_t)0xE124, (int32_t)0x143E0, (int32_t)0xEFBB, (int32_t)0x8B06, (int32_t)0x57B5, (int32_t)0x9987, (int32_t)0xFFFE818D, (int32_t)0xFFFF426A, (int32_t)0xFFFF13C2, (int32_t)0x150C2, (int32_t)0xFFFF4DF3, (int32_t)0x7184, (int32_t)0xFFFEE267, (int32_t)0xFFFE9941, (int32_t)0x16378, (int32_t)0xFFFEBAA5, (int32_t)0xFFFEEDB1, (int32_t)0x7EC3, (int32_t)0x905E, (int32_t)0xFFFF8A56, (int32_t)0xFFFFBDB4, (int32_t)0xFFFF0E19, (int32_t)0xFFFF14F0 };
+		static const int32_t output0[] = { (int32_t)0xFFFFFFD7, (int32_t)0xFFFF7194, (int32_t)0xFFFF774A, (int32_t)0x3E8D, (int32_t)0xFFFF0910, (int32_t)0xFFFF1086, (int32_t)0xFFFFFF36, (int32_t)0xDD64, (int32_t)0x498C, (int32_t)0xFFFFE0AF, (int32_t)0xFFFF5171, (int32_t)0xFFFF8EC9, (int32_t)0xFFFF38AA, (int32_t)0xFFFF5675, (int32_t)0x934A, (int32_t)0xD807, (int32_t)0xFFFF9046, (int32_t)0xE083, (int32_t)0xFAF4, (int32_t)0xFFFF125D, (int32_t)0xFFFFF50D, (int32_t)0xFFFF84B6, (int32_t)0xFFFFC82A, (int32_t)0xF75, (int32_t)0xCB71, (int32_t)0x141, (int32_t)0xBD1A, (int32_t)0xFFFFFBED, (int32_t)0xFFFF20BF, (int32_t)0xBD8, (int32_t)0xFA7F, (int32_t)0xFFFF0130, (int32_t)0xC104, (int32_t)0xCBDA, (int32_t)0xF136, (int32_t)0x7BC3, (int32_t)0xF9D1, (int32_t)0xFFFFA26B, (int32_t)0x9FAA, (int32_t)0xFFFFD3F5, (int32_t)0xFFFF9596, (int32_t)0x66BA, (int32_t)0xFFFF04E0, (int32_t)0xE569, (int32_t)0x8FF7, (int32_t)0xFFFFB591, (int32_t)0xFFFF193D, (int32_t)0xFFFFDFE6, (int32_t)0xFFFF0FB1, (int32_t)0xFFFF18FF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::CosTurns", Fixed32::CosTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CosTurnsFast()
+	static void Fixed32_CosTurnsFast()
+	{
+		static const int32_t input0[] = { (int32_t)0x588374EC, (int32_t)0x36FC7B14, (int32_t)0x6367E6C8, (int32_t)0xB47A35ED, (int32_t)0x64A1CF02, (int32_t)0xEC81DA81, (int32_t)0x15A6DF12, (int32_t)0x699DBB96, (int32_t)0xEA2EFF17, (int32_t)0x395D8AB6, (int32_t)0xE0101085, (int32_t)0x2C087A66, (int32_t)0x205E750C, (int32_t)0xD67D08E7, (int32_t)0xF21CE5E9, (int32_t)0x12C7CE28, (int32_t)0x31FA1BCE, (int32_t)0x8C86550F, (int32_t)0xFF0CE4, (int32_t)0x31CC747C, (int32_t)0xBFF8BF15, (int32_t)0x713BA2DA, (int32_t)0xB142D0F5, (int32_t)0xF017EC93, (int32_t)0x8593AEAF, (int32_t)0x45BCCCE4, (int32_t)0x15C8035E, (int32_t)0x8D109BB9, (int32_t)0xFF230965, (int32_t)0x688F56A0, (int32_t)0xEE974D81, (int32_t)0x2A13AE54, (int32_t)0x535EE4E2, (int32_t)0xAF363481, (int32_t)0x2389E800, (int32_t)0xCFF1A15D, (int32_t)0x5536DF36, (int32_t)0xBDB8CF75, (int32_t)0xE9F33865, (int32_t)0xC7AEF6E7, (int32_t)0xC2D3C815, (int32_t)0x100AC5C, (int32_t)0x857F8E91, (int32_t)0xFE278109, (int32_t)0x4A7AF286, (int32_t)0xC60CD3EB, (int32_t)0xEAE9DC3B, (int32_t)0xF1860877, (int32_t)0x30BD839C, (int32_t)0xE7BFCDB7, (int32_t)0x17A95, (int32_t)0x1836B, (int32_t)0xFFFF8B18, (int32_t)0xA3DD, (int32_t)0x10B8A, (int32_t)0x13B2F, (int32_t)0x1178, (int32_t)0xFFFFD948, (int32_t)0xFFFF0882, (int32_t)0xFFFED7A9, (int32_t)0x108AA, (int32_t)0x1A34, (int32_t)0xFFFFBE53, (int32_t)0x4F4, (int32_t)0xFFFF5D92, (int32_t)0xA4C0, (int32_t)0x10E93, (int32_t)0xFFFFD2B5, (int32_t)0x9B7C, (int32_t)0xFFFEE1A7, (int32_t)0xBBE2, (int32_t)0xFFFFDC29, (int32_t)0x6983, (int32_t)0xFFFF2848, (int32_t)0xFFFFCC09, (int32_t)0xC02A, (int32_t)0x148C7, (int32_t)0x9BF7, (int32_t)0x72C9, (int32_t)0xC1DE, (int32_t)0xFFFF8E8D, (int32_t)0xFFFEE807, (int32_t)0xFFFF9321, (int32_t)0xFFFEC0C0, (int32_t)0x14B22, (int32_t)0xFFFFCE14, (int32_t)0xFFFF6EB1, (int32_t)0xFFFED3F1, (int32_t)0xFFFF848A, (int32_t)0xB7E4, (int32_t)0xE27F, (int32_t)0xFFFFA426, (int32_t)0xFFFEA69C, (int32_t)0xFFFF5E6E, (int32_t)0xFFFFD219, (int32_t)0xB1BC, (int32_t)0xFFFEBE1D, (int32_t)0xBD3, (int32_t)0xFFFF162D, (int32_t)0xFFFEB7EC };
+		static const int32_t output0[] = { (int32_t)0xFFFF6F1A, (int32_t)0x382C, (int32_t)0xFFFF3C7F, (int32_t)0xFFFFB88F, (int32_t)0xFFFF379D, (int32_t)0xE341, (int32_t)0xDCB1, (int32_t)0xFFFF25AB, (int32_t)0xDC2B, (int32_t)0x2980, (int32_t)0xB54C, (int32_t)0x787E, (int32_t)0xB35F, (int32_t)0x863B, (int32_t)0xF145, (int32_t)0xE548, (int32_t)0x5661, (int32_t)0xFFFF0C00, (int32_t)0xFFEC, (int32_t)0x576F, (int32_t)0xFFFFFFD2, (int32_t)0xFFFF10A1, (int32_t)0xFFFFA566, (int32_t)0xECBC, (int32_t)0xFFFF0264, (int32_t)0xFFFFDC11, (int32_t)0xDC48, (int32_t)0xFFFF0D0C, (int32_t)0xFFF1, (int32_t)0xFFFF2935, (int32_t)0xE8FB, (int32_t)0x8332, (int32_t)0xFFFF8AD2, (int32_t)0xFFFF9979, (int32_t)0xA4A2, (int32_t)0x61A4, (int32_t)0xFFFF80A5, (int32_t)0xFFFFF1B1, (int32_t)0xDB6A, (int32_t)0x2FFD, (int32_t)0x11C0, (int32_t)0xFFEC, (int32_t)0xFFFF0253, (int32_t)0xFFBC, (int32_t)0xFFFFBEDF, (int32_t)0x25DF, (int32_t)0xDE79, (int32_t)0xF002, (int32_t)0x5DA7, (int32_t)0xD3FA, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0x10000, (int32_t)0xFFFF, (int32_t)0xFFFF };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::CosTurnsFast", Fixed32::CosTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CosTurnsFastest()
+	static void Fixed32_CosTurnsFastest()
+	{
+		static const int32_t input0[] = { (int32_t)0xF92352A1, (int32_t)0xBD79B403, (int32_t)0x3DC3B0CE, (int32_t)0x58A40A3C, (int32_t)0x7A7438AC, (int32_t)0xA3DC9017, (int32_t)0xF9AD41D7, (int32_t)0x392D0310, (int32_t)0xD4C26D21, (int32_t)0x7A5897A6, (int32_t)0xAA507681, (int32_t)0x77F62112, (int32_t)0x5BB892, (int32_t)0xE0BFD4E5, (int32_t)0xDB5EF817, (int32_t)0xC45842F5, (int32_t)0x9E3A469F, (int32_t)0xF4347799, (int32_t)0xCE4AEE2D, (int32_t)0x671F7916, (int32_t)0xEB073A39, (int32_t)0xD4E2F735, (int32_t)0x92EEE2BD, (int32_t)0xE41C423D, (int32_t)0x5AAA32CE, (int32_t)0x99DBB50F, (int32_t)0x6B1A9E22, (int32_t)0xEACA1745, (int32_t)0xE139A60F, (int32_t)0x97BED499, (int32_t)0x3892DE28, (int32_t)0xD8E606C5, (int32_t)0xFE66B863, (int32_t)0xAEA7FA79, (int32_t)0x89ED584D, (int32_t)0xAED40CA, (int32_t)0x1D2DC8E0, (int32_t)0xF774A01F, (int32_t)0x577E6624, (int32_t)0x43BE23E6, (int32_t)0xFB1805AB, (int32_t)0xD3E710E7, (int32_t)0xA5C8F403, (int32_t)0x680E5B48, (int32_t)0x997B83E7, (int32_t)0xD14CE8E9, (int32_t)0x8D3DCB67, (int32_t)0xA3935253, (int32_t)0xB2ED90C9, (int32_t)0x98D5D713, (int32_t)0xB91B, (int32_t)0x16C2, (int32_t)0x1B00, (int32_t)0xFFFF9415, (int32_t)0x4D2B, (int32_t)0xFFFEE802, (int32_t)0xFFFEFB35, (int32_t)0xFFFF8AFB, (int32_t)0x18072, (int32_t)0x126C9, (int32_t)0xFFFF2696, (int32_t)0xFFFEA6CF, (int32_t)0xFFFF85C8, (int32_t)0xFFFF3394, (int32_t)0xFFFF4219, (int32_t)0xF876, (int32_t)0xFFFFEC59, (int32_t)0xFFFF72B6, (int32_t)0xFFFF8256, (int32_t)0xF57F, (int32_t)0x7786, (int32_t)0x7652, (int32_t)0x579E, (int32_t)0x2032, (int32_t)0xFFFFC30E, (int32_t)0xFFFEBFF3, (int32_t)0xFFFF091F, (int32_t)0xFFFEFC3A, (int32_t)0xFFFF5D20, (int32_t)0x1C93, (int32_t)0xFFFE9FE1, (int32_t)0xDA49, (int32_t)0xFFFF23DA, (int32_t)0xFFFF564B, (int32_t)0xFFFF8F5D, (int32_t)0xFFFF0F44, (int32_t)0xF44B, (int32_t)0xFFFEE06B, (int32_t)0x4136, (int32_t)0x1364A, (int32_t)0xFFFF9F85, (int32_t)0xFFFF4772, (int32_t)0xFFFFEC1A, (int32_t)0x16AD9, (int32_t)0x2186, (int32_t)0xFFFFC399, (int32_t)0x17A45, (int32_t)0x13FBC, (int32_t)0x74D5, (int32_t)0xFFFF554F };
+		static const int32_t output0[] = { (int32_t)0xFC55, (int32_t)0xFFFFF025, (int32_t)0xE0A, (int32_t)0xFFFF6E6C, (int32_t)0xFFFF0268, (int32_t)0xFFFF5CE5, (int32_t)0xFCE1, (int32_t)0x2AAD, (int32_t)0x7CE1, (int32_t)0xFFFF0280, (int32_t)0xFFFF7E12, (int32_t)0xFFFF0501, (int32_t)0xFFFC, (int32_t)0xB859, (int32_t)0x9F5B, (int32_t)0x1B3F, (int32_t)0xFFFF433F, (int32_t)0xF552, (int32_t)0x57FA, (int32_t)0xFFFF2E3A, (int32_t)0xDED8, (int32_t)0x7D93, (int32_t)0xFFFF1B23, (int32_t)0xC65C, (int32_t)0xFFFF6424, (int32_t)0xFFFF31D2, (int32_t)0xFFFF20EB, (int32_t)0xDE1A, (int32_t)0xBA69, (int32_t)0xFFFF2A3C, (int32_t)0x2E67, (int32_t)0x92E8, (int32_t)0xFFC8, (int32_t)0xFFFF9646, (int32_t)0xFFFF0798, (int32_t)0xF6D1, (int32_t)0xC123, (int32_t)0xFA5A, (int32_t)0xFFFF7469, (int32_t)0xFFFFE884, (int32_t)0xFE1B, (int32_t)0x7826, (int32_t)0xFFFF6664, (int32_t)0xFFFF2AEC, (int32_t)0xFFFF306E, (int32_t)0x6979, (int32_t)0xFFFF0D6B, (int32_t)0xFFFF5B83, (int32_t)0xFFFFAF43, (int32_t)0xFFFF2E14, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF, (int32_t)0xFFFF };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util::Check("Fixed32::CosTurnsFastest", Fixed32::CosTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Tan()
 	static void Fixed64_Tan()
 	{
@@ -1313,12 +1836,14 @@ void UnitTest_TestAll()
 		UnitTest::Fixed64_Rcp();
 		UnitTest::Fixed64_RcpFast();
 		UnitTest::Fixed64_RcpFastest();
+		UnitTest::Fixed64_RcpRefined();
 		UnitTest::Fixed32_Rcp();
 		UnitTest::Fixed32_RcpFast();
 		UnitTest::Fixed32_RcpFastest();
 		UnitTest::Fixed64_Div();
 		UnitTest::Fixed64_DivFast();
 		UnitTest::Fixed64_DivFastest();
+		UnitTest::Fixed64_DivRefined();
 		UnitTest::Fixed32_Div();
 		UnitTest::Fixed32_DivFast();
 		UnitTest::Fixed32_DivFastest();
@@ -1326,10 +1851,18 @@ void UnitTest_TestAll()
 		UnitTest::Fixed64_Sqrt();
 		UnitTest::Fixed64_SqrtFast();
 		UnitTest::Fixed64_SqrtFastest();
+		UnitTest::Fixed64_SqrtRefined();
 		UnitTest::Fixed32_SqrtPrecise();
 		UnitTest::Fixed32_Sqrt();
 		UnitTest::Fixed32_SqrtFast();
 		UnitTest::Fixed32_SqrtFastest();
+		UnitTest::Fixed32_SqrtRefined();
+		UnitTest::Fixed64_Cbrt();
+		UnitTest::Fixed64_CbrtFast();
+		UnitTest::Fixed64_CbrtFastest();
+		UnitTest::Fixed32_Cbrt();
+		UnitTest::Fixed32_CbrtFast();
+		UnitTest::Fixed32_CbrtFastest();
 		UnitTest::Fixed64_RSqrt();
 		UnitTest::Fixed64_RSqrtFast();
 		UnitTest::Fixed64_RSqrtFastest();
@@ -1348,6 +1881,12 @@ void UnitTest_TestAll()
 		UnitTest::Fixed32_Exp2();
 		UnitTest::Fixed32_Exp2Fast();
 		UnitTest::Fixed32_Exp2Fastest();
+		UnitTest::Fixed64_Exp10();
+		UnitTest::Fixed64_Exp10Fast();
+		UnitTest::Fixed64_Exp10Fastest();
+		UnitTest::Fixed32_Exp10();
+		UnitTest::Fixed32_Exp10Fast();
+		UnitTest::Fixed32_Exp10Fastest();
 		UnitTest::Fixed64_Log();
 		UnitTest::Fixed64_LogFast();
 		UnitTest::Fixed64_LogFastest();
@@ -1357,27 +1896,69 @@ void UnitTest_TestAll()
 		UnitTest::Fixed64_Log2();
 		UnitTest::Fixed64_Log2Fast();
 		UnitTest::Fixed64_Log2Fastest();
+		UnitTest::Fixed64_Log2Ultra();
 		UnitTest::Fixed32_Log2();
 		UnitTest::Fixed32_Log2Fast();
 		UnitTest::Fixed32_Log2Fastest();
+		UnitTest::Fixed32_Log2Ultra();
+		UnitTest::Fixed64_Log10();
+		UnitTest::Fixed64_Log10Fast();
+		UnitTest::Fixed64_Log10Fastest();
+		UnitTest::Fixed32_Log10();
+		UnitTest::Fixed32_Log10Fast();
+		UnitTest::Fixed32_Log10Fastest();
 		UnitTest::Fixed64_Pow();
 		UnitTest::Fixed64_PowFast();
 		UnitTest::Fixed64_PowFastest();
 		UnitTest::Fixed32_Pow();
 		UnitTest::Fixed32_PowFast();
 		UnitTest::Fixed32_PowFastest();
+		UnitTest::Fixed64_Sigmoid();
+		UnitTest::Fixed64_SigmoidFast();
+		UnitTest::Fixed64_SigmoidFastest();
+		UnitTest::Fixed32_Sigmoid();
+		UnitTest::Fixed32_SigmoidFast();
+		UnitTest::Fixed32_SigmoidFastest();
+		UnitTest::Fixed64_Tanh();
+		UnitTest::Fixed64_TanhFast();
+		UnitTest::Fixed64_TanhFastest();
+		UnitTest::Fixed32_Tanh();
+		UnitTest::Fixed32_TanhFast();
+		UnitTest::Fixed32_TanhFastest();
+		UnitTest::Fixed64_Softplus();
+		UnitTest::Fixed64_SoftplusFast();
+		UnitTest::Fixed64_SoftplusFastest();
+		UnitTest::Fixed32_Softplus();
+		UnitTest::Fixed32_SoftplusFast();
+		UnitTest::Fixed32_SoftplusFastest();
 		UnitTest::Fixed64_Sin();
 		UnitTest::Fixed64_SinFast();
 		UnitTest::Fixed64_SinFastest();
+		UnitTest::Fixed64_SinUltra();
 		UnitTest::Fixed32_Sin();
 		UnitTest::Fixed32_SinFast();
 		UnitTest::Fixed32_SinFastest();
+		UnitTest::Fixed32_SinUltra();
 		UnitTest::Fixed64_Cos();
 		UnitTest::Fixed64_CosFast();
 		UnitTest::Fixed64_CosFastest();
+		UnitTest::Fixed64_CosUltra();
 		UnitTest::Fixed32_Cos();
 		UnitTest::Fixed32_CosFast();
 		UnitTest::Fixed32_CosFastest();
+		UnitTest::Fixed32_CosUltra();
+		UnitTest::Fixed64_SinTurns();
+		UnitTest::Fixed64_SinTurnsFast();
+		UnitTest::Fixed64_SinTurnsFastest();
+		UnitTest::Fixed32_SinTurns();
+		UnitTest::Fixed32_SinTurnsFast();
+		UnitTest::Fixed32_SinTurnsFastest();
+		UnitTest::Fixed64_CosTurns();
+		UnitTest::Fixed64_CosTurnsFast();
+		UnitTest::Fixed64_CosTurnsFastest();
+		UnitTest::Fixed32_CosTurns();
+		UnitTest::Fixed32_CosTurnsFast();
+		UnitTest::Fixed32_CosTurnsFastest();
 		UnitTest::Fixed64_Tan();
 		UnitTest::Fixed64_TanFast();
 		UnitTest::Fixed64_TanFastest();
@@ -23,6 +23,12 @@ public:
 			printf("MISMATCH in %s: got %" PRId64 ", expected %" PRId64 ", inputs %" PRId64 " %" PRId64 "\n", opName, output, expected, input0, input1);
 	}
 
+	static void Check(const char* opName, int64_t output, int64_t expected, int64_t input0, int64_t input1, int64_t input2)
+	{
+		if (output != expected)
+			printf("MISMATCH in %s: got %" PRId64 ", expected %" PRId64 ", inputs %" PRId64 " %" PRId64 " %" PRId64 "\n", opName, output, expected, input0, input1, input2);
+	}
+
 	// static void Check(const char* opName, int32_t output, int32_t expected, int32_t input0)
 	// {
 	// 	if (output != expected)
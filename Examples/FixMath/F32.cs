@@ -135,9 +135,13 @@ namespace FixMath
         public static F32 Sqrt(F32 a) { return FromRaw(Fixed32.Sqrt(a.Raw)); }
         public static F32 SqrtFast(F32 a) { return FromRaw(Fixed32.SqrtFast(a.Raw)); }
         public static F32 SqrtFastest(F32 a) { return FromRaw(Fixed32.SqrtFastest(a.Raw)); }
+        public static F32 SqrtRefined(F32 a) { return FromRaw(Fixed32.SqrtRefined(a.Raw)); }
         public static F32 RSqrt(F32 a) { return FromRaw(Fixed32.RSqrt(a.Raw)); }
         public static F32 RSqrtFast(F32 a) { return FromRaw(Fixed32.RSqrtFast(a.Raw)); }
         public static F32 RSqrtFastest(F32 a) { return FromRaw(Fixed32.RSqrtFastest(a.Raw)); }
+        public static F32 Cbrt(F32 a) { return FromRaw(Fixed32.Cbrt(a.Raw)); }
+        public static F32 CbrtFast(F32 a) { return FromRaw(Fixed32.CbrtFast(a.Raw)); }
+        public static F32 CbrtFastest(F32 a) { return FromRaw(Fixed32.CbrtFastest(a.Raw)); }
         public static F32 Rcp(F32 a) { return FromRaw(Fixed32.Rcp(a.Raw)); }
         public static F32 RcpFast(F32 a) { return FromRaw(Fixed32.RcpFast(a.Raw)); }
         public static F32 RcpFastest(F32 a) { return FromRaw(Fixed32.RcpFastest(a.Raw)); }
@@ -147,19 +151,43 @@ namespace FixMath
         public static F32 Exp2(F32 a) { return FromRaw(Fixed32.Exp2(a.Raw)); }
         public static F32 Exp2Fast(F32 a) { return FromRaw(Fixed32.Exp2Fast(a.Raw)); }
         public static F32 Exp2Fastest(F32 a) { return FromRaw(Fixed32.Exp2Fastest(a.Raw)); }
+        public static F32 Exp10(F32 a) { return FromRaw(Fixed32.Exp10(a.Raw)); }
+        public static F32 Exp10Fast(F32 a) { return FromRaw(Fixed32.Exp10Fast(a.Raw)); }
+        public static F32 Exp10Fastest(F32 a) { return FromRaw(Fixed32.Exp10Fastest(a.Raw)); }
         public static F32 Log(F32 a) { return FromRaw(Fixed32.Log(a.Raw)); }
         public static F32 LogFast(F32 a) { return FromRaw(Fixed32.LogFast(a.Raw)); }
         public static F32 LogFastest(F32 a) { return FromRaw(Fixed32.LogFastest(a.Raw)); }
         public static F32 Log2(F32 a) { return FromRaw(Fixed32.Log2(a.Raw)); }
         public static F32 Log2Fast(F32 a) { return FromRaw(Fixed32.Log2Fast(a.Raw)); }
         public static F32 Log2Fastest(F32 a) { return FromRaw(Fixed32.Log2Fastest(a.Raw)); }
+        public static F32 Log2Ultra(F32 a) { return FromRaw(Fixed32.Log2Ultra(a.Raw)); }
+        public static F32 Log10(F32 a) { return FromRaw(Fixed32.Log10(a.Raw)); }
+        public static F32 Log10Fast(F32 a) { return FromRaw(Fixed32.Log10Fast(a.Raw)); }
+        public static F32 Log10Fastest(F32 a) { return FromRaw(Fixed32.Log10Fastest(a.Raw)); }
+        public static F32 Sigmoid(F32 a) { return FromRaw(Fixed32.Sigmoid(a.Raw)); }
+        public static F32 SigmoidFast(F32 a) { return FromRaw(Fixed32.SigmoidFast(a.Raw)); }
+        public static F32 SigmoidFastest(F32 a) { return FromRaw(Fixed32.SigmoidFastest(a.Raw)); }
+        public static F32 Tanh(F32 a) { return FromRaw(Fixed32.Tanh(a.Raw)); }
+        public static F32 TanhFast(F32 a) { return FromRaw(Fixed32.TanhFast(a.Raw)); }
+        public static F32 TanhFastest(F32 a) { return FromRaw(Fixed32.TanhFastest(a.Raw)); }
+        public static F32 Softplus(F32 a) { return FromRaw(Fixed32.Softplus(a.Raw)); }
+        public static F32 SoftplusFast(F32 a) { return FromRaw(Fixed32.SoftplusFast(a.Raw)); }
+        public static F32 SoftplusFastest(F32 a) { return FromRaw(Fixed32.SoftplusFastest(a.Raw)); }
 
         public static F32 Sin(F32 a) { return FromRaw(Fixed32.Sin(a.Raw)); }
         public static F32 SinFast(F32 a) { return FromRaw(Fixed32.SinFast(a.Raw)); }
         public static F32 SinFastest(F32 a) { return FromRaw(Fixed32.SinFastest(a.Raw)); }
+        public static F32 SinUltra(F32 a) { return FromRaw(Fixed32.SinUltra(a.Raw)); }
         public static F32 Cos(F32 a) { return FromRaw(Fixed32.Cos(a.Raw)); }
         public static F32 CosFast(F32 a) { return FromRaw(Fixed32.CosFast(a.Raw)); }
         public static F32 CosFastest(F32 a) { return FromRaw(Fixed32.CosFastest(a.Raw)); }
+        public static F32 CosUltra(F32 a) { return FromRaw(Fixed32.CosUltra(a.Raw)); }
+        public static F32 SinTurns(int angle) { return FromRaw(Fixed32.SinTurns(angle)); }
+        public static F32 SinTurnsFast(int angle) { return FromRaw(Fixed32.SinTurnsFast(angle)); }
+        public static F32 SinTurnsFastest(int angle) { return FromRaw(Fixed32.SinTurnsFastest(angle)); }
+        public static F32 CosTurns(int angle) { return FromRaw(Fixed32.CosTurns(angle)); }
+        public static F32 CosTurnsFast(int angle) { return FromRaw(Fixed32.CosTurnsFast(angle)); }
+        public static F32 CosTurnsFastest(int angle) { return FromRaw(Fixed32.CosTurnsFastest(angle)); }
         public static F32 Tan(F32 a) { return FromRaw(Fixed32.Tan(a.Raw)); }
         public static F32 TanFast(F32 a) { return FromRaw(Fixed32.TanFast(a.Raw)); }
         public static F32 TanFastest(F32 a) { return FromRaw(Fixed32.TanFastest(a.Raw)); }
@@ -184,6 +212,11 @@ namespace FixMath
         public static F32 Clamp(F32 a, F32 min, F32 max) { return FromRaw(Fixed32.Clamp(a.Raw, min.Raw, max.Raw)); }
         public static F32 Clamp01(F32 a) { return FromRaw(Fixed32.Clamp(a.Raw, Fixed32.Zero, Fixed32.One)); }
 
+        public static F32 AddSat(F32 a, F32 b) { return FromRaw(Fixed32.AddSat(a.Raw, b.Raw)); }
+        public static F32 SubSat(F32 a, F32 b) { return FromRaw(Fixed32.SubSat(a.Raw, b.Raw)); }
+        public static F32 MulSat(F32 a, F32 b) { return FromRaw(Fixed32.MulSat(a.Raw, b.Raw)); }
+        public static F32 LerpSat(F32 a, F32 b, F32 t) { return FromRaw(Fixed32.LerpSat(a.Raw, b.Raw, t.Raw)); }
+
         public static F32 Lerp(F32 a, F32 b, F32 t)
         {
             int tb = t.Raw;
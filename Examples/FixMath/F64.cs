@@ -144,35 +144,65 @@ namespace FixMath
         public static F64 Div(F64 a, F64 b) { return FromRaw(Fixed64.Div(a.Raw, b.Raw)); }
         public static F64 DivFast(F64 a, F64 b) { return FromRaw(Fixed64.DivFast(a.Raw, b.Raw)); }
         public static F64 DivFastest(F64 a, F64 b) { return FromRaw(Fixed64.DivFastest(a.Raw, b.Raw)); }
+        public static F64 DivRefined(F64 a, F64 b) { return FromRaw(Fixed64.DivRefined(a.Raw, b.Raw)); }
         public static F64 SqrtPrecise(F64 a) { return FromRaw(Fixed64.SqrtPrecise(a.Raw)); }
         public static F64 Sqrt(F64 a) { return FromRaw(Fixed64.Sqrt(a.Raw)); }
         public static F64 SqrtFast(F64 a) { return FromRaw(Fixed64.SqrtFast(a.Raw)); }
         public static F64 SqrtFastest(F64 a) { return FromRaw(Fixed64.SqrtFastest(a.Raw)); }
+        public static F64 SqrtRefined(F64 a) { return FromRaw(Fixed64.SqrtRefined(a.Raw)); }
         public static F64 RSqrt(F64 a) { return FromRaw(Fixed64.RSqrt(a.Raw)); }
         public static F64 RSqrtFast(F64 a) { return FromRaw(Fixed64.RSqrtFast(a.Raw)); }
         public static F64 RSqrtFastest(F64 a) { return FromRaw(Fixed64.RSqrtFastest(a.Raw)); }
+        public static F64 Cbrt(F64 a) { return FromRaw(Fixed64.Cbrt(a.Raw)); }
+        public static F64 CbrtFast(F64 a) { return FromRaw(Fixed64.CbrtFast(a.Raw)); }
+        public static F64 CbrtFastest(F64 a) { return FromRaw(Fixed64.CbrtFastest(a.Raw)); }
         public static F64 Rcp(F64 a) { return FromRaw(Fixed64.Rcp(a.Raw)); }
         public static F64 RcpFast(F64 a) { return FromRaw(Fixed64.RcpFast(a.Raw)); }
         public static F64 RcpFastest(F64 a) { return FromRaw(Fixed64.RcpFastest(a.Raw)); }
+        public static F64 RcpRefined(F64 a) { return FromRaw(Fixed64.RcpRefined(a.Raw)); }
         public static F64 Exp(F64 a) { return FromRaw(Fixed64.Exp(a.Raw)); }
         public static F64 ExpFast(F64 a) { return FromRaw(Fixed64.ExpFast(a.Raw)); }
         public static F64 ExpFastest(F64 a) { return FromRaw(Fixed64.ExpFastest(a.Raw)); }
         public static F64 Exp2(F64 a) { return FromRaw(Fixed64.Exp2(a.Raw)); }
         public static F64 Exp2Fast(F64 a) { return FromRaw(Fixed64.Exp2Fast(a.Raw)); }
         public static F64 Exp2Fastest(F64 a) { return FromRaw(Fixed64.Exp2Fastest(a.Raw)); }
+        public static F64 Exp10(F64 a) { return FromRaw(Fixed64.Exp10(a.Raw)); }
+        public static F64 Exp10Fast(F64 a) { return FromRaw(Fixed64.Exp10Fast(a.Raw)); }
+        public static F64 Exp10Fastest(F64 a) { return FromRaw(Fixed64.Exp10Fastest(a.Raw)); }
         public static F64 Log(F64 a) { return FromRaw(Fixed64.Log(a.Raw)); }
         public static F64 LogFast(F64 a) { return FromRaw(Fixed64.LogFast(a.Raw)); }
         public static F64 LogFastest(F64 a) { return FromRaw(Fixed64.LogFastest(a.Raw)); }
         public static F64 Log2(F64 a) { return FromRaw(Fixed64.Log2(a.Raw)); }
         public static F64 Log2Fast(F64 a) { return FromRaw(Fixed64.Log2Fast(a.Raw)); }
         public static F64 Log2Fastest(F64 a) { return FromRaw(Fixed64.Log2Fastest(a.Raw)); }
+        public static F64 Log2Ultra(F64 a) { return FromRaw(Fixed64.Log2Ultra(a.Raw)); }
+        public static F64 Log10(F64 a) { return FromRaw(Fixed64.Log10(a.Raw)); }
+        public static F64 Log10Fast(F64 a) { return FromRaw(Fixed64.Log10Fast(a.Raw)); }
+        public static F64 Log10Fastest(F64 a) { return FromRaw(Fixed64.Log10Fastest(a.Raw)); }
+        public static F64 Sigmoid(F64 a) { return FromRaw(Fixed64.Sigmoid(a.Raw)); }
+        public static F64 SigmoidFast(F64 a) { return FromRaw(Fixed64.SigmoidFast(a.Raw)); }
+        public static F64 SigmoidFastest(F64 a) { return FromRaw(Fixed64.SigmoidFastest(a.Raw)); }
+        public static F64 Tanh(F64 a) { return FromRaw(Fixed64.Tanh(a.Raw)); }
+        public static F64 TanhFast(F64 a) { return FromRaw(Fixed64.TanhFast(a.Raw)); }
+        public static F64 TanhFastest(F64 a) { return FromRaw(Fixed64.TanhFastest(a.Raw)); }
+        public static F64 Softplus(F64 a) { return FromRaw(Fixed64.Softplus(a.Raw)); }
+        public static F64 SoftplusFast(F64 a) { return FromRaw(Fixed64.SoftplusFast(a.Raw)); }
+        public static F64 SoftplusFastest(F64 a) { return FromRaw(Fixed64.SoftplusFastest(a.Raw)); }
 
         public static F64 Sin(F64 a) { return FromRaw(Fixed64.Sin(a.Raw)); }
         public static F64 SinFast(F64 a) { return FromRaw(Fixed64.SinFast(a.Raw)); }
         public static F64 SinFastest(F64 a) { return FromRaw(Fixed64.SinFastest(a.Raw)); }
+        public static F64 SinUltra(F64 a) { return FromRaw(Fixed64.SinUltra(a.Raw)); }
         public static F64 Cos(F64 a) { return FromRaw(Fixed64.Cos(a.Raw)); }
         public static F64 CosFast(F64 a) { return FromRaw(Fixed64.CosFast(a.Raw)); }
         public static F64 CosFastest(F64 a) { return FromRaw(Fixed64.CosFastest(a.Raw)); }
+        public static F64 CosUltra(F64 a) { return FromRaw(Fixed64.CosUltra(a.Raw)); }
+        public static F64 SinTurns(int angle) { return FromRaw(Fixed64.SinTurns(angle)); }
+        public static F64 SinTurnsFast(int angle) { return FromRaw(Fixed64.SinTurnsFast(angle)); }
+        public static F64 SinTurnsFastest(int angle) { return FromRaw(Fixed64.SinTurnsFastest(angle)); }
+        public static F64 CosTurns(int angle) { return FromRaw(Fixed64.CosTurns(angle)); }
+        public static F64 CosTurnsFast(int angle) { return FromRaw(Fixed64.CosTurnsFast(angle)); }
+        public static F64 CosTurnsFastest(int angle) { return FromRaw(Fixed64.CosTurnsFastest(angle)); }
         public static F64 Tan(F64 a) { return FromRaw(Fixed64.Tan(a.Raw)); }
         public static F64 TanFast(F64 a) { return FromRaw(Fixed64.TanFast(a.Raw)); }
         public static F64 TanFastest(F64 a) { return FromRaw(Fixed64.TanFastest(a.Raw)); }
@@ -197,6 +227,11 @@ namespace FixMath
         public static F64 Clamp(F64 a, F64 min, F64 max) { return FromRaw(Fixed64.Clamp(a.Raw, min.Raw, max.Raw)); }
         public static F64 Clamp01(F64 a) { return FromRaw(Fixed64.Clamp(a.Raw, Fixed64.Zero, Fixed64.One)); }
 
+        public static F64 AddSat(F64 a, F64 b) { return FromRaw(Fixed64.AddSat(a.Raw, b.Raw)); }
+        public static F64 SubSat(F64 a, F64 b) { return FromRaw(Fixed64.SubSat(a.Raw, b.Raw)); }
+        public static F64 MulSat(F64 a, F64 b) { return FromRaw(Fixed64.MulSat(a.Raw, b.Raw)); }
+        public static F64 LerpSat(F64 a, F64 b, F64 t) { return FromRaw(Fixed64.LerpSat(a.Raw, b.Raw, t.Raw)); }
+
         public static F64 Lerp(F64 a, F64 b, F64 t)
         {
             long tb = t.Raw;
@@ -221,6 +221,13 @@ namespace FixPointCSTest
             );
         }
 
+        public static Operation Int_F64(string funcName, Action<int, int[], F64[]> execute)
+        {
+            return new Operation(funcName, new ValueBoundsF64(), new[] { typeof(int) }, new[] { typeof(F64) },
+                (int count, Array[] inputs, Array[] outputs) => { execute(count, (int[])inputs[0], (F64[])outputs[0]); }
+            );
+        }
+
         public static Operation F64_F64_F64(string funcName, Action<int, F64[], F64[], F64[]> execute)
         {
             return new Operation(funcName, new ValueBoundsF64(), new[] { typeof(F64), typeof(F64) }, new[] { typeof(F64) }, (int count, Array[] inputs, Array[] outputs) => { execute(count, (F64[])inputs[0], (F64[])inputs[1], (F64[])outputs[0]); });
@@ -238,6 +245,13 @@ namespace FixPointCSTest
             );
         }
 
+        public static Operation Int_F32(string funcName, Action<int, int[], F32[]> execute)
+        {
+            return new Operation(funcName, new ValueBoundsF32(), new[] { typeof(int) }, new[] { typeof(F32) },
+                (int count, Array[] inputs, Array[] outputs) => { execute(count, (int[])inputs[0], (F32[])outputs[0]); }
+            );
+        }
+
         public static Operation F32_F32_F32(string funcName, Action<int, F32[], F32[], F32[]> execute)
         {
             return new Operation(funcName, new ValueBoundsF32(), new[] { typeof(F32), typeof(F32) }, new[] { typeof(F32) }, (int count, Array[] inputs, Array[] outputs) => { execute(count, (F32[])inputs[0], (F32[])inputs[1], (F32[])outputs[0]); });
@@ -565,6 +579,8 @@ namespace FixPointCSTest
                     result[ndx] = new F64[count];
                 else if (type == typeof(F32))
                     result[ndx] = new F32[count];
+                else if (type == typeof(int))
+                    result[ndx] = new int[count];
                 else
                     throw new InvalidOperationException("Unknown input data type: " + type);
             }
@@ -591,6 +607,11 @@ namespace FixPointCSTest
                     F32[] tmp = generator(rnd, count).Select(d => F32.FromDouble(d)).ToArray();
                     Array.Copy(tmp, 0, result[ndx], offset, count);
                 }
+                else if (type == typeof(int))
+                {
+                    int[] tmp = generator(rnd, count).Select(d => (int)d).ToArray();
+                    Array.Copy(tmp, 0, result[ndx], offset, count);
+                }
                 else
                     throw new InvalidOperationException("Unknown input data type: " + type);
             }
@@ -1236,6 +1257,7 @@ namespace FixPointCSTest
                     Operation.F64_F64("Fixed64.Rcp", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Rcp(i0[i]); } }),
                     Operation.F64_F64("Fixed64.RcpFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.RcpFast(i0[i]); } }),
                     Operation.F64_F64("Fixed64.RcpFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.RcpFastest(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.RcpRefined", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.RcpRefined(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Rcp", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Rcp(i0[i]); } }),
                     Operation.F32_F32("Fixed32.RcpFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.RcpFast(i0[i]); } }),
                     Operation.F32_F32("Fixed32.RcpFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.RcpFastest(i0[i]); } }),
@@ -1252,6 +1274,7 @@ namespace FixPointCSTest
                     Operation.F64_F64_F64("Fixed64.Div", (int n, F64[] i0, F64[] i1, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Div(i0[i], i1[i]); } }),
                     Operation.F64_F64_F64("Fixed64.DivFast", (int n, F64[] i0, F64[] i1, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.DivFast(i0[i], i1[i]); } }),
                     Operation.F64_F64_F64("Fixed64.DivFastest", (int n, F64[] i0, F64[] i1, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.DivFastest(i0[i], i1[i]); } }),
+                    Operation.F64_F64_F64("Fixed64.DivRefined", (int n, F64[] i0, F64[] i1, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.DivRefined(i0[i], i1[i]); } }),
                     Operation.F32_F32_F32("Fixed32.Div", (int n, F32[] i0, F32[] i1, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Div(i0[i], i1[i]); } }),
                     Operation.F32_F32_F32("Fixed32.DivFast", (int n, F32[] i0, F32[] i1, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.DivFast(i0[i], i1[i]); } }),
                     Operation.F32_F32_F32("Fixed32.DivFastest", (int n, F32[] i0, F32[] i1, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.DivFastest(i0[i], i1[i]); } })
@@ -1272,13 +1295,32 @@ namespace FixPointCSTest
                     Operation.F64_F64("Fixed64.Sqrt", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Sqrt(i0[i]); } }),
                     Operation.F64_F64("Fixed64.SqrtFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SqrtFast(i0[i]); } }),
                     Operation.F64_F64("Fixed64.SqrtFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SqrtFastest(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.SqrtRefined", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SqrtRefined(i0[i]); } }),
                     Operation.F32_F32("Fixed32.SqrtPrecise", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SqrtPrecise(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Sqrt", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Sqrt(i0[i]); } }),
                     Operation.F32_F32("Fixed32.SqrtFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SqrtFast(i0[i]); } }),
                     Operation.F32_F32("Fixed32.SqrtFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SqrtFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.SqrtRefined", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SqrtRefined(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, bounds.InputPosMax)),
+                }
+            ),
+
+            new UnaryOpFamily(
+                (double i0) => { return Math.Cbrt(i0); },
+                RelativeUnaryErrorEvaluator(),
+                new[] {
+                    Operation.F64_F64("Fixed64.Cbrt", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Cbrt(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.CbrtFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CbrtFast(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.CbrtFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CbrtFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Cbrt", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Cbrt(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.CbrtFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CbrtFast(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.CbrtFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CbrtFastest(i0[i]); } }),
                 },
                 bounds => new[] {
                     InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, bounds.InputPosMax)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputNegMin, bounds.InputNegMax)),
                 }
             ),
 
@@ -1334,6 +1376,24 @@ namespace FixPointCSTest
                 }
             ),
 
+            new UnaryOpFamily(
+                (double i0) => { return Math.Pow(10.0, i0); },
+                RelativeUnaryErrorEvaluator(),
+                new[] {
+                    Operation.F64_F64("Fixed64.Exp10", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Exp10(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.Exp10Fast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Exp10Fast(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.Exp10Fastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Exp10Fastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Exp10", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Exp10(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Exp10Fast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Exp10Fast(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Exp10Fastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Exp10Fastest(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Uniform(-30.0, 30.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, 3.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputNegMin, -3.0))
+                }
+            ),
+
             new UnaryOpFamily(
                 (double i0) => { return Math.Log(i0); },
                 RelativeUnaryErrorEvaluator(16.0),
@@ -1358,9 +1418,28 @@ namespace FixPointCSTest
                     Operation.F64_F64("Fixed64.Log2", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log2(i0[i]); } }),
                     Operation.F64_F64("Fixed64.Log2Fast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log2Fast(i0[i]); } }),
                     Operation.F64_F64("Fixed64.Log2Fastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log2Fastest(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.Log2Ultra", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log2Ultra(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Log2", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log2(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Log2Fast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log2Fast(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Log2Fastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log2Fastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Log2Ultra", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log2Ultra(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, bounds.InputPosMax)),
+                    InputGenerator.Unary(Input.Exponential(0.999, 1.001)),
+                }
+            ),
+
+            new UnaryOpFamily(
+                (double i0) => { return Math.Log10(i0); },
+                RelativeUnaryErrorEvaluator(16.0),
+                new[] {
+                    Operation.F64_F64("Fixed64.Log10", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log10(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.Log10Fast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log10Fast(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.Log10Fastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Log10Fastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Log10", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log10(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Log10Fast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log10Fast(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Log10Fastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Log10Fastest(i0[i]); } }),
                 },
                 bounds => new[] {
                     InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, bounds.InputPosMax)),
@@ -1385,6 +1464,63 @@ namespace FixPointCSTest
                 }
             ),
 
+            new UnaryOpFamily(
+                (double i0) => { return 1.0 / (1.0 + Math.Exp(-i0)); },
+                AbsoluteUnaryErrorEvaluator(),
+                new[] {
+                    Operation.F64_F64("Fixed64.Sigmoid", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Sigmoid(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.SigmoidFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SigmoidFast(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.SigmoidFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SigmoidFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Sigmoid", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Sigmoid(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.SigmoidFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SigmoidFast(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.SigmoidFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SigmoidFastest(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Uniform(-4.0, 4.0)),
+                    InputGenerator.Unary(Input.Uniform(-32.0, 32.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, 1.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputNegMin, -1.0))
+                }
+            ),
+
+            new UnaryOpFamily(
+                (double i0) => { return Math.Tanh(i0); },
+                AbsoluteUnaryErrorEvaluator(),
+                new[] {
+                    Operation.F64_F64("Fixed64.Tanh", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Tanh(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.TanhFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.TanhFast(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.TanhFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.TanhFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Tanh", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Tanh(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.TanhFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.TanhFast(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.TanhFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.TanhFastest(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Uniform(-4.0, 4.0)),
+                    InputGenerator.Unary(Input.Uniform(-32.0, 32.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, 1.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputNegMin, -1.0))
+                }
+            ),
+
+            new UnaryOpFamily(
+                (double i0) => { return Math.Max(i0, 0.0) + Math.Log(1.0 + Math.Exp(-Math.Abs(i0))); },
+                RelativeUnaryErrorEvaluator(),
+                new[] {
+                    Operation.F64_F64("Fixed64.Softplus", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Softplus(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.SoftplusFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SoftplusFast(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.SoftplusFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SoftplusFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.Softplus", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Softplus(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.SoftplusFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SoftplusFast(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.SoftplusFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SoftplusFastest(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Uniform(-4.0, 4.0)),
+                    InputGenerator.Unary(Input.Uniform(-32.0, 32.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputPosMin, 1.0)),
+                    InputGenerator.Unary(Input.Exponential(bounds.InputNegMin, -1.0))
+                }
+            ),
+
             new UnaryOpFamily(
                 (double i0) => { return Math.Sin(i0); },
                 SinCosErrorEvaluator(),
@@ -1392,9 +1528,11 @@ namespace FixPointCSTest
                     Operation.F64_F64("Fixed64.Sin", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Sin(i0[i]); } }),
                     Operation.F64_F64("Fixed64.SinFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SinFast(i0[i]); } }),
                     Operation.F64_F64("Fixed64.SinFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SinFastest(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.SinUltra", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SinUltra(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Sin", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Sin(i0[i]); } }),
                     Operation.F32_F32("Fixed32.SinFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SinFast(i0[i]); } }),
                     Operation.F32_F32("Fixed32.SinFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SinFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.SinUltra", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SinUltra(i0[i]); } }),
                 },
                 bounds => new[] {
                     InputGenerator.Unary(Input.Uniform(-100.0, 100.0)),
@@ -1409,9 +1547,11 @@ namespace FixPointCSTest
                     Operation.F64_F64("Fixed64.Cos", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.Cos(i0[i]); } }),
                     Operation.F64_F64("Fixed64.CosFast", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CosFast(i0[i]); } }),
                     Operation.F64_F64("Fixed64.CosFastest", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CosFastest(i0[i]); } }),
+                    Operation.F64_F64("Fixed64.CosUltra", (int n, F64[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CosUltra(i0[i]); } }),
                     Operation.F32_F32("Fixed32.Cos", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.Cos(i0[i]); } }),
                     Operation.F32_F32("Fixed32.CosFast", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CosFast(i0[i]); } }),
                     Operation.F32_F32("Fixed32.CosFastest", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CosFastest(i0[i]); } }),
+                    Operation.F32_F32("Fixed32.CosUltra", (int n, F32[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CosUltra(i0[i]); } }),
                 },
                 bounds => new[] {
                     InputGenerator.Unary(Input.Uniform(-100.0, 100.0)),
@@ -1419,6 +1559,40 @@ namespace FixPointCSTest
                 }
             ),
 
+            new UnaryOpFamily(
+                (double i0) => { return Math.Sin(i0 * (Math.PI / (1L << 31))); },
+                AbsoluteUnaryErrorEvaluator(),
+                new[] {
+                    Operation.Int_F64("Fixed64.SinTurns", (int n, int[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SinTurns(i0[i]); } }),
+                    Operation.Int_F64("Fixed64.SinTurnsFast", (int n, int[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SinTurnsFast(i0[i]); } }),
+                    Operation.Int_F64("Fixed64.SinTurnsFastest", (int n, int[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.SinTurnsFastest(i0[i]); } }),
+                    Operation.Int_F32("Fixed32.SinTurns", (int n, int[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SinTurns(i0[i]); } }),
+                    Operation.Int_F32("Fixed32.SinTurnsFast", (int n, int[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SinTurnsFast(i0[i]); } }),
+                    Operation.Int_F32("Fixed32.SinTurnsFastest", (int n, int[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.SinTurnsFastest(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Uniform(-2147483648.0, 2147483647.0)),
+                    InputGenerator.Unary(Input.Uniform(-1e5, 1e5)),
+                }
+            ),
+
+            new UnaryOpFamily(
+                (double i0) => { return Math.Cos(i0 * (Math.PI / (1L << 31))); },
+                AbsoluteUnaryErrorEvaluator(),
+                new[] {
+                    Operation.Int_F64("Fixed64.CosTurns", (int n, int[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CosTurns(i0[i]); } }),
+                    Operation.Int_F64("Fixed64.CosTurnsFast", (int n, int[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CosTurnsFast(i0[i]); } }),
+                    Operation.Int_F64("Fixed64.CosTurnsFastest", (int n, int[] i0, F64[] o) => { for (int i=0; i<n; i++) { o[i] = F64.CosTurnsFastest(i0[i]); } }),
+                    Operation.Int_F32("Fixed32.CosTurns", (int n, int[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CosTurns(i0[i]); } }),
+                    Operation.Int_F32("Fixed32.CosTurnsFast", (int n, int[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CosTurnsFast(i0[i]); } }),
+                    Operation.Int_F32("Fixed32.CosTurnsFastest", (int n, int[] i0, F32[] o) => { for (int i=0; i<n; i++) { o[i] = F32.CosTurnsFastest(i0[i]); } }),
+                },
+                bounds => new[] {
+                    InputGenerator.Unary(Input.Uniform(-2147483648.0, 2147483647.0)),
+                    InputGenerator.Unary(Input.Uniform(-1e5, 1e5)),
+                }
+            ),
+
             new UnaryOpFamily(
                 (double i0) => { return Math.Tan(i0); },
                 RelativeUnaryErrorEvaluator(16.0),
@@ -17,6 +17,12 @@ class Util
 			System.out.printf("MISMATCH in %s: got %d, expected %d, inputs %d %d\n", opName, output, expected, input0, input1);
 	}
 
+	public static void Check(String opName, long output, long expected, long input0, long input1, long input2)
+	{
+		if (output != expected)
+			System.out.printf("MISMATCH in %s: got %d, expected %d, inputs %d %d %d\n", opName, output, expected, input0, input1, input2);
+	}
+
 	public static void Check(String opName, int output, int expected, int input0)
 	{
 		if (output != expected)
@@ -28,6 +34,12 @@ class Util
 		if (output != expected)
 			System.out.printf("MISMATCH in %s: got %d, expected %d, inputs %d %d\n", opName, output, expected, input0, input1);
 	}
+
+	public static void Check(String opName, int output, int expected, int input0, int input1, int input2)
+	{
+		if (output != expected)
+			System.out.printf("MISMATCH in %s: got %d, expected %d, inputs %d %d %d\n", opName, output, expected, input0, input1, input2);
+	}
 }
 
 public class FixPointTest
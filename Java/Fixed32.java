@@ -62,6 +62,8 @@ public class Fixed32
     // Private constants
     private static final int RCP_LN2       = (int)(0x171547652L >> 16);    // 1.0 / log(2.0) ~= 1.4426950408889634
     private static final int RCP_LOG2_E    = (int)(2977044471L >> 16);     // 1.0 / log2(e) ~= 0.6931471805599453
+    private static final int LOG2_10       = 1783446566;                   // log2(10.0) ~= 3.321928094887362 (s3.29)
+    private static final long LOG10_2      = 1292913986L;                  // log10(2.0) ~= 0.3010299956639812 (s32.32)
     private static final int RCP_TWO_PI    = 683565276;                    // 1.0 / (4.0 * 0.5 * pi);  -- the 4.0 factor converts directly to s2.30
 
     /// <summary>
@@ -253,6 +255,41 @@ public class Fixed32
         return (int)((ta + tb) >> Shift);
     }
 
+    /// <summary>
+    /// Adds the two FP numbers together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    public static int AddSat(int a, int b)
+    {
+        return FixedUtil.SaturateToInt((long)a + (long)b);
+    }
+
+    /// <summary>
+    /// Subtracts the two FP numbers from each other, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    public static int SubSat(int a, int b)
+    {
+        return FixedUtil.SaturateToInt((long)a - (long)b);
+    }
+
+    /// <summary>
+    /// Multiplies two FP values together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    public static int MulSat(int a, int b)
+    {
+        return FixedUtil.SaturateToInt(((long)a * (long)b) >> Shift);
+    }
+
+    /// <summary>
+    /// Linearly interpolate from a to b by t, saturating to MinValue/MaxValue on overflow.
+    /// Returns the same value as Lerp() whenever that does not overflow.
+    /// </summary>
+    public static int LerpSat(int a, int b, int t)
+    {
+        // a*(1-t) + b*t == a + (b-a)*t, with a single rounding like in Lerp().
+        long delta = ((long)b - (long)a) * (long)t;
+        return FixedUtil.SaturateToInt((long)a + (delta >> Shift));
+    }
+
     private static int Nlz(int x)
     {
         return Integer.numberOfLeadingZeros(x);
@@ -347,40 +384,13 @@ public class Fixed32
     /// </summary>
     public static int Mod(int a, int b)
     {
-        int di = a / b;
-        int ret = a - (di * b);
-        return ret;
-    }
-
-    /// <summary>
-    /// Calculates the square root of the given number.
-    /// </summary>
-    public static int SqrtPrecise(int a)
-    {
-        // Adapted from https://github.com/chmike/fpsqrt
-        if (a <= 0)
+        if (b == 0)
         {
-            if (a < 0)
-                FixedUtil.InvalidArgument("Fixed32.SqrtPrecise", "a", a);
+            FixedUtil.InvalidArgument("Fixed32.Mod", "b", b);
             return 0;
         }
 
-        int r = a;
-        int b = 0x40000000;
-        int q = 0;
-        while (b > 0x40)
-        {
-            int t = q + b;
-            if (Integer.compareUnsigned(r, t) >= 0)
-            {
-                r -= t;
-                q = t + b;
-            }
-            r <<= 1;
-            b >>= 1;
-        }
-        q >>>= 8;
-        return q;
+        return a % b;
     }
 
     public static int Sqrt(int x)
@@ -470,6 +480,189 @@ public class Fixed32
         return FixedUtil.ShiftRight(yr, 14 - offset);
     }
 
+    /// <summary>
+    /// Calculates the square root with one Newton-Raphson refinement step, rounded down to the
+    /// exact result.
+    /// </summary>
+    public static int SqrtRefined(int x)
+    {
+        // Return 0 for all non-positive values.
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil.InvalidArgument("Fixed32.SqrtRefined", "x", x);
+            return 0;
+        }
+
+        // One Newton-Raphson step y = (y0 + n / y0) / 2 from the polynomial approximation (in 64 bits).
+        long n = (long)x << Shift;
+        long y0 = Sqrt(x);
+        long y = (y0 + n / y0) >> 1;
+
+        // The step never undershoots, round down to the exact square root.
+        if (y * y > n)
+            y--;
+        return (int)y;
+    }
+
+    /// <summary>
+    /// Calculates the square root of the given number. Raw values below 2^30 use SqrtRefined(),
+    /// larger ones a bit-by-bit loop.
+    /// </summary>
+    public static int SqrtPrecise(int a)
+    {
+        // Adapted from https://github.com/chmike/fpsqrt
+        if (a <= 0)
+        {
+            if (a < 0)
+                FixedUtil.InvalidArgument("Fixed32.SqrtPrecise", "a", a);
+            return 0;
+        }
+
+        // Below 2^30 the loop yields the exact square root (rounded down), which SqrtRefined()
+        // computes much faster. Larger values overflow the remainder of the loop, so keep using
+        // it for them.
+        if (a < (1 << 30))
+            return SqrtRefined(a);
+
+        int r = a;
+        int b = 0x40000000;
+        int q = 0;
+        while (b > 0x40)
+        {
+            int t = q + b;
+            if (Integer.compareUnsigned(r, t) >= 0)
+            {
+                r -= t;
+                q = t + b;
+            }
+            r <<= 1;
+            b >>= 1;
+        }
+        q >>>= 8;
+        return q;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    public static int Cbrt(int x)
+    {
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int CBRT2 = 1352829926; // cbrt(2.0)
+        final int CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        int ax = (x == MinValue) ? MaxValue : Abs(x);
+        int offset = 15 - Nlz(ax);
+        int n = FixedUtil.ShiftRight(ax, offset - 14);
+        assert(n >= ONE);
+        int y = FixedUtil.CbrtPoly3Lut8(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        int q = (offset + 18) / 3 - 6;
+        int r = offset - 3 * q;
+        int adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s16.16 (the adjusted value can reach 2.0, so use s3.29).
+        int yr = (int)(((long)adjust * (long)y) >> 31);
+        yr = FixedUtil.ShiftRight(yr, 13 - q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    public static int CbrtFast(int x)
+    {
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int CBRT2 = 1352829926; // cbrt(2.0)
+        final int CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        int ax = (x == MinValue) ? MaxValue : Abs(x);
+        int offset = 15 - Nlz(ax);
+        int n = FixedUtil.ShiftRight(ax, offset - 14);
+        assert(n >= ONE);
+        int y = FixedUtil.CbrtPoly4(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        int q = (offset + 18) / 3 - 6;
+        int r = offset - 3 * q;
+        int adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s16.16 (the adjusted value can reach 2.0, so use s3.29).
+        int yr = (int)(((long)adjust * (long)y) >> 31);
+        yr = FixedUtil.ShiftRight(yr, 13 - q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    public static int CbrtFastest(int x)
+    {
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int CBRT2 = 1352829926; // cbrt(2.0)
+        final int CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        int ax = (x == MinValue) ? MaxValue : Abs(x);
+        int offset = 15 - Nlz(ax);
+        int n = FixedUtil.ShiftRight(ax, offset - 14);
+        assert(n >= ONE);
+        int y = FixedUtil.CbrtPoly3(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        int q = (offset + 18) / 3 - 6;
+        int r = offset - 3 * q;
+        int adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s16.16 (the adjusted value can reach 2.0, so use s3.29).
+        int yr = (int)(((long)adjust * (long)y) >> 31);
+        yr = FixedUtil.ShiftRight(yr, 13 - q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates Cbrt() for the first count elements of x into result.
+    /// </summary>
+    public static void CbrtBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Cbrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFast() for the first count elements of x into result.
+    /// </summary>
+    public static void CbrtFastBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CbrtFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void CbrtFastestBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CbrtFastest(x[i]);
+    }
+
     /// <summary>
     /// Calculates the reciprocal square root.
     /// </summary>
@@ -649,6 +842,96 @@ public class Fixed32
         return FixedUtil.ShiftRight(sign * res, offset);
     }
 
+    /// <summary>
+    /// Calculates AddSat() for the first count elements of a and b into result.
+    /// </summary>
+    public static void AddSatBatch(int[] a, int[] b, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = AddSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates SubSat() for the first count elements of a and b into result.
+    /// </summary>
+    public static void SubSatBatch(int[] a, int[] b, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SubSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates MulSat() for the first count elements of a and b into result.
+    /// </summary>
+    public static void MulSatBatch(int[] a, int[] b, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = MulSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates LerpSat() for the first count elements of a, b and t into result.
+    /// </summary>
+    public static void LerpSatBatch(int[] a, int[] b, int[] t, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = LerpSat(a[i], b[i], t[i]);
+    }
+
+    /// <summary>
+    /// Calculates Mul() for the first count elements of a and b into result.
+    /// </summary>
+    public static void MulBatch(int[] a, int[] b, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Mul(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Div() for the first count elements of a and b into result.
+    /// </summary>
+    public static void DivBatch(int[] a, int[] b, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Div(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Sqrt() for the first count elements of x into result.
+    /// </summary>
+    public static void SqrtBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Sqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates RSqrt() for the first count elements of x into result.
+    /// </summary>
+    public static void RSqrtBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = RSqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Rcp() for the first count elements of x into result.
+    /// </summary>
+    public static void RcpBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Rcp(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SqrtRefined() for the first count elements of x into result.
+    /// </summary>
+    public static void SqrtRefinedBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SqrtRefined(x[i]);
+    }
+
     /// <summary>
     /// Calculates the base 2 exponent.
     /// </summary>
@@ -721,6 +1004,78 @@ public class Fixed32
         return Exp2Fastest(Mul(x, RCP_LN2));
     }
 
+    public static int Exp10(int x)
+    {
+        // 10^x == 2^(x * log2(10)), with the product kept as s33.30.
+        long p = ((long)x * (long)LOG2_10) >> 15;
+
+        // Handle values that would under or overflow.
+        if (p >= ( 15L << 30)) return MaxValue;
+        if (p <= -( 16L << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        int y = FixedUtil.Exp2Poly5((int)(p & 0x3FFFFFFF));
+        int intPart = (int)(p >> 30);
+        return FixedUtil.ShiftRight(y, 14 - intPart);
+    }
+
+    public static int Exp10Fast(int x)
+    {
+        // 10^x == 2^(x * log2(10)), with the product kept as s33.30.
+        long p = ((long)x * (long)LOG2_10) >> 15;
+
+        // Handle values that would under or overflow.
+        if (p >= ( 15L << 30)) return MaxValue;
+        if (p <= -( 16L << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        int y = FixedUtil.Exp2Poly4((int)(p & 0x3FFFFFFF));
+        int intPart = (int)(p >> 30);
+        return FixedUtil.ShiftRight(y, 14 - intPart);
+    }
+
+    public static int Exp10Fastest(int x)
+    {
+        // 10^x == 2^(x * log2(10)), with the product kept as s33.30.
+        long p = ((long)x * (long)LOG2_10) >> 15;
+
+        // Handle values that would under or overflow.
+        if (p >= ( 15L << 30)) return MaxValue;
+        if (p <= -( 16L << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        int y = FixedUtil.Exp2Poly3((int)(p & 0x3FFFFFFF));
+        int intPart = (int)(p >> 30);
+        return FixedUtil.ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates Exp10() for the first count elements of x into result.
+    /// </summary>
+    public static void Exp10Batch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Exp10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fast() for the first count elements of x into result.
+    /// </summary>
+    public static void Exp10FastBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Exp10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fastest() for the first count elements of x into result.
+    /// </summary>
+    public static void Exp10FastestBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Exp10Fastest(x[i]);
+    }
+
     public static int Log(int x)
     {
         // Return 0 for invalid values
@@ -854,42 +1209,354 @@ public class Fixed32
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates the base 2 logarithm with about 18 bits of precision, by linear interpolation
+    /// of a 256-entry table (about 15 bits of relative precision near 1.0, where a short series
+    /// is used instead). Cheaper than Log2Fastest().
     /// </summary>
-    public static int Pow(int x, int exponent)
+    public static int Log2Ultra(int x)
     {
         // Return 0 for invalid values
         if (x <= 0)
         {
-            if (x < 0)
-                FixedUtil.InvalidArgument("Fixed32.Pow", "x", x);
+            FixedUtil.InvalidArgument("Fixed32.Log2Ultra", "x", x);
             return 0;
         }
 
-        return Exp(Mul(exponent, Log(x)));
+        // Close to 1.0 the result approaches zero and the table loses relative precision, so use
+        // log2(1 + e) = (e - e^2/2 + e^3/3 - e^4/4 + e^5/5) / ln(2) on e = x - 1 (as s0.32) instead.
+        int d = x - One;
+        if (d > -(One >> 4) && d < (One >> 4))
+        {
+            long e = (long)d * 65536;
+            long t = 309816401; // 1 / (5 * ln(2))
+            t = -387270501 + ((e * t) >> 32); // -1 / (4 * ln(2))
+            t = 516360668 + ((e * t) >> 32); // 1 / (3 * ln(2))
+            t = -774541002 + ((e * t) >> 32); // -1 / (2 * ln(2))
+            t = 1549082005 + ((e * t) >> 32); // 1 / ln(2)
+            return (int)((e * t) >> 46);
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+
+        // Table approximation of mantissa.
+        final int ONE = (1 << 30);
+        assert(n >= ONE);
+        int y = FixedUtil.Log2Lut256(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return offset * One + (y >> 14);
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates Log2Ultra() for the first count elements of x into result.
     /// </summary>
-    public static int PowFast(int x, int exponent)
+    public static void Log2UltraBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log2Ultra(x[i]);
+    }
+
+    public static int Log10(int x)
     {
         // Return 0 for invalid values
         if (x <= 0)
         {
-            if (x < 0)
-                FixedUtil.InvalidArgument("Fixed32.PowFast", "x", x);
+            FixedUtil.InvalidArgument("Fixed32.Log10", "x", x);
             return 0;
         }
 
-        return ExpFast(Mul(exponent, LogFast(x)));
-    }
-
-    /// <summary>
-    /// Calculates x to the power of the exponent.
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+
+        // Polynomial approximation.
+        final int ONE = (1 << 30);
+        assert(n >= ONE);
+        int y = FixedUtil.Log10Poly5Lut8(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return (int)(((long)offset * LOG10_2 + ((long)y << 2)) >> 16);
+    }
+
+    public static int Log10Fast(int x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil.InvalidArgument("Fixed32.Log10Fast", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+
+        // Polynomial approximation.
+        final int ONE = (1 << 30);
+        assert(n >= ONE);
+        int y = FixedUtil.Log10Poly3Lut8(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return (int)(((long)offset * LOG10_2 + ((long)y << 2)) >> 16);
+    }
+
+    public static int Log10Fastest(int x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil.InvalidArgument("Fixed32.Log10Fastest", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+
+        // Polynomial approximation.
+        final int ONE = (1 << 30);
+        assert(n >= ONE);
+        int y = FixedUtil.Log10Poly5(n - ONE);
+
+        // Combine integer and fractional parts (into s16.16).
+        return (int)(((long)offset * LOG10_2 + ((long)y << 2)) >> 16);
+    }
+
+    /// <summary>
+    /// Calculates Log10() for the first count elements of x into result.
+    /// </summary>
+    public static void Log10Batch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fast() for the first count elements of x into result.
+    /// </summary>
+    public static void Log10FastBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fastest() for the first count elements of x into result.
+    /// </summary>
+    public static void Log10FastestBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log10Fastest(x[i]);
+    }
+
+    // x^m for x >= 0 and m >= 0 by repeated squaring. All factors are >= 1 whenever the result
+    // can overflow, so a saturated value stays saturated.
+    private static int PowIntAbs(int x, long m)
+    {
+        int r = ((m & 1) != 0) ? x : One;
+        m >>= 1;
+        while (m != 0)
+        {
+            x = MulSat(x, x);
+            if ((m & 1) != 0)
+                r = MulSat(r, x);
+            m >>= 1;
+        }
+        return r;
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike Pow(), x can be
+    /// negative. Negative powers use Rcp(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    public static int PowInt(int x, int n)
+    {
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil.InvalidArgument("Fixed32.PowInt", "n", n);
+            return 0;
+        }
+
+        int sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        int ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(Rcp(ax), -(long)n));
+        return sign * Rcp(PowIntAbs(ax, -(long)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFast(), x can be
+    /// negative. Negative powers use RcpFast(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    public static int PowIntFast(int x, int n)
+    {
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil.InvalidArgument("Fixed32.PowIntFast", "n", n);
+            return 0;
+        }
+
+        int sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        int ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFast(ax), -(long)n));
+        return sign * RcpFast(PowIntAbs(ax, -(long)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFastest(), x can be
+    /// negative. Negative powers use RcpFastest(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    public static int PowIntFastest(int x, int n)
+    {
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil.InvalidArgument("Fixed32.PowIntFastest", "n", n);
+            return 0;
+        }
+
+        int sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        int ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFastest(ax), -(long)n));
+        return sign * RcpFastest(PowIntAbs(ax, -(long)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowInt(),
+    /// and exponents of 0.5, -0.5 and -1 with Sqrt(), RSqrt() and Rcp().
+    /// </summary>
+    public static int Pow(int x, int exponent)
+    {
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil.InvalidArgument("Fixed32.Pow", "x", x);
+            return 0;
+        }
+
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return Sqrt(x);
+        if (exponent == -Half)
+            return RSqrt(x);
+        if (exponent == Neg1)
+            return Rcp(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowInt(x, (int)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) is kept as s5.26 and the product as s33.30, instead of
+        // rounding both to s16.16 (and converting to and from natural logarithms).
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+        int lg = offset * (1 << 26) + (FixedUtil.Log2Poly4Lut16(n - (1 << 30)) >> 4);
+        long p = ((long)exponent * (long)lg) >> 12;
+
+        // Handle values that would under or overflow.
+        if (p >= ( 15L << 30)) return MaxValue;
+        if (p <= -( 16L << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        int y = FixedUtil.Exp2Poly5((int)(p & 0x3FFFFFFF));
+        int intPart = (int)(p >> 30);
+        return FixedUtil.ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFast(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFast(), RSqrtFast() and RcpFast().
+    /// </summary>
+    public static int PowFast(int x, int exponent)
+    {
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil.InvalidArgument("Fixed32.PowFast", "x", x);
+            return 0;
+        }
+
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFast(x);
+        if (exponent == -Half)
+            return RSqrtFast(x);
+        if (exponent == Neg1)
+            return RcpFast(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFast(x, (int)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) is kept as s5.26 and the product as s33.30, instead of
+        // rounding both to s16.16 (and converting to and from natural logarithms).
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+        int lg = offset * (1 << 26) + (FixedUtil.Log2Poly3Lut16(n - (1 << 30)) >> 4);
+        long p = ((long)exponent * (long)lg) >> 12;
+
+        // Handle values that would under or overflow.
+        if (p >= ( 15L << 30)) return MaxValue;
+        if (p <= -( 16L << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        int y = FixedUtil.Exp2Poly4((int)(p & 0x3FFFFFFF));
+        int intPart = (int)(p >> 30);
+        return FixedUtil.ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFastest(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFastest(), RSqrtFastest() and RcpFastest().
     /// </summary>
     public static int PowFastest(int x, int exponent)
     {
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -898,7 +1565,250 @@ public class Fixed32
             return 0;
         }
 
-        return ExpFastest(Mul(exponent, LogFastest(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFastest(x);
+        if (exponent == -Half)
+            return RSqrtFastest(x);
+        if (exponent == Neg1)
+            return RcpFastest(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFastest(x, (int)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) is kept as s5.26 and the product as s33.30, instead of
+        // rounding both to s16.16 (and converting to and from natural logarithms).
+        int offset = 15 - Nlz(x);
+        int n = FixedUtil.ShiftRight(x, offset - 14);
+        int lg = offset * (1 << 26) + (FixedUtil.Log2Poly5(n - (1 << 30)) >> 4);
+        long p = ((long)exponent * (long)lg) >> 12;
+
+        // Handle values that would under or overflow.
+        if (p >= ( 15L << 30)) return MaxValue;
+        if (p <= -( 16L << 30)) return 0;
+
+        // Compute exp2 for fractional part, and combine with the integer part (into s16.16).
+        int y = FixedUtil.Exp2Poly3((int)(p & 0x3FFFFFFF));
+        int intPart = (int)(p >> 30);
+        return FixedUtil.ShiftRight(y, 14 - intPart);
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    public static int Sigmoid(int x)
+    {
+        // Handle values that saturate to 0 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        int y = FixedUtil.SigmoidPoly5Lut64(Abs(x) << 10) >> 14;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    public static int SigmoidFast(int x)
+    {
+        // Handle values that saturate to 0 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        int y = FixedUtil.SigmoidPoly3Lut64(Abs(x) << 10) >> 14;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    public static int SigmoidFastest(int x)
+    {
+        // Handle values that saturate to 0 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        int y = FixedUtil.SigmoidPoly2Lut64(Abs(x) << 10) >> 14;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    public static int Tanh(int x)
+    {
+        // Handle values that saturate to -1 or 1.
+        if (x >= 8 * One) return One;
+        if (x <= -8 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        int y = (FixedUtil.SigmoidPoly5Lut64(Abs(x) << 11) - (1 << 29)) >> 13;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    public static int TanhFast(int x)
+    {
+        // Handle values that saturate to -1 or 1.
+        if (x >= 8 * One) return One;
+        if (x <= -8 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        int y = (FixedUtil.SigmoidPoly3Lut64(Abs(x) << 11) - (1 << 29)) >> 13;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    public static int TanhFastest(int x)
+    {
+        // Handle values that saturate to -1 or 1.
+        if (x >= 8 * One) return One;
+        if (x <= -8 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        int y = (FixedUtil.SigmoidPoly2Lut64(Abs(x) << 11) - (1 << 29)) >> 13;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    public static int Softplus(int x)
+    {
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 16 * One) return x;
+        if (x <= -16 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        int y = FixedUtil.SoftplusPoly5Lut64(Abs(x) << 10) >> 14;
+        return Max(x, 0) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    public static int SoftplusFast(int x)
+    {
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 16 * One) return x;
+        if (x <= -16 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        int y = FixedUtil.SoftplusPoly3Lut64(Abs(x) << 10) >> 14;
+        return Max(x, 0) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    public static int SoftplusFastest(int x)
+    {
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 16 * One) return x;
+        if (x <= -16 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        int y = FixedUtil.SoftplusPoly2Lut64(Abs(x) << 10) >> 14;
+        return Max(x, 0) + y;
+    }
+
+    /// <summary>
+    /// Calculates Sigmoid() for the first count elements of x into result.
+    /// </summary>
+    public static void SigmoidBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Sigmoid(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFast() for the first count elements of x into result.
+    /// </summary>
+    public static void SigmoidFastBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SigmoidFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void SigmoidFastestBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SigmoidFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Tanh() for the first count elements of x into result.
+    /// </summary>
+    public static void TanhBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Tanh(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFast() for the first count elements of x into result.
+    /// </summary>
+    public static void TanhFastBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = TanhFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void TanhFastestBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = TanhFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Softplus() for the first count elements of x into result.
+    /// </summary>
+    public static void SoftplusBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Softplus(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFast() for the first count elements of x into result.
+    /// </summary>
+    public static void SoftplusFastBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SoftplusFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void SoftplusFastestBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SoftplusFastest(x[i]);
     }
 
     private static int UnitSin(int z)
@@ -994,6 +1904,20 @@ public class Fixed32
         return UnitSinFastest(z) >> 14;
     }
 
+    /// <summary>
+    /// Calculates sine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than SinFastest().
+    /// </summary>
+    public static int SinUltra(int x)
+    {
+        // Map [0, 2pi] to [0, 4] (as s2.30).
+        // This also wraps the values into one period.
+        int z = Mul(RCP_TWO_PI, x);
+
+        // Interpolate sin from the table and convert back to s16.16.
+        return FixedUtil.SinLut256(z) >> 14;
+    }
+
     public static int Cos(int x)
     {
         return Sin(x + PiHalf);
@@ -1009,11 +1933,193 @@ public class Fixed32
         return SinFastest(x + PiHalf);
     }
 
+    /// <summary>
+    /// Calculates cosine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than CosFastest().
+    /// </summary>
+    public static int CosUltra(int x)
+    {
+        return SinUltra(x + PiHalf);
+    }
+
+    /// <summary>
+    /// Calculates SinUltra() for the first count elements of x into result.
+    /// </summary>
+    public static void SinUltraBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosUltra() for the first count elements of x into result.
+    /// </summary>
+    public static void CosUltraBatch(int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Advances a binary angle by a quarter turn, wrapping around at a full turn.
+    /// </summary>
+    private static int AddQuarterTurn(int angle)
+    {
+        return angle + (1 << 30);
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full int range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    public static int SinTurns(int angle)
+    {
+        // A binary angle is the s2.30 quarter-turn value that UnitSin() takes.
+        return UnitSin(angle) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full int range is one turn.
+    /// </summary>
+    public static int CosTurns(int angle)
+    {
+        return UnitSin(AddQuarterTurn(angle)) >> 14;
+    }
+
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full int range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    public static int SinTurnsFast(int angle)
+    {
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFast() takes.
+        return UnitSinFast(angle) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full int range is one turn.
+    /// </summary>
+    public static int CosTurnsFast(int angle)
+    {
+        return UnitSinFast(AddQuarterTurn(angle)) >> 14;
+    }
+
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full int range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    public static int SinTurnsFastest(int angle)
+    {
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFastest() takes.
+        return UnitSinFastest(angle) >> 14;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full int range is one turn.
+    /// </summary>
+    public static int CosTurnsFastest(int angle)
+    {
+        return UnitSinFastest(AddQuarterTurn(angle)) >> 14;
+    }
+
+
+    /// <summary>
+    /// Calculates SinTurns() for the first count elements of angle into result.
+    /// </summary>
+    public static void SinTurnsBatch(int[] angle, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurns() for the first count elements of angle into result.
+    /// </summary>
+    public static void CosTurnsBatch(int[] angle, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    public static void SinCosTurnsBatch(int[] angle, int[] sinX, int[] cosX, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            sinX[i] = UnitSin(angle[i]) >> 14;
+            cosX[i] = UnitSin(AddQuarterTurn(angle[i])) >> 14;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    public static void SinTurnsFastBatch(int[] angle, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    public static void CosTurnsFastBatch(int[] angle, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    public static void SinCosTurnsFastBatch(int[] angle, int[] sinX, int[] cosX, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            sinX[i] = UnitSinFast(angle[i]) >> 14;
+            cosX[i] = UnitSinFast(AddQuarterTurn(angle[i])) >> 14;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    public static void SinTurnsFastestBatch(int[] angle, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    public static void CosTurnsFastestBatch(int[] angle, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    public static void SinCosTurnsFastestBatch(int[] angle, int[] sinX, int[] cosX, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            sinX[i] = UnitSinFastest(angle[i]) >> 14;
+            cosX[i] = UnitSinFastest(AddQuarterTurn(angle[i])) >> 14;
+        }
+    }
+
     public static int Tan(int x)
     {
         int z = Mul(RCP_TWO_PI, x);
         int sinX = UnitSin(z);
-        int cosX = UnitSin(z + (1 << 30));
+        int cosX = UnitSin(AddQuarterTurn(z));
         return Div(sinX, cosX);
     }
 
@@ -1021,7 +2127,7 @@ public class Fixed32
     {
         int z = Mul(RCP_TWO_PI, x);
         int sinX = UnitSinFast(z);
-        int cosX = UnitSinFast(z + (1 << 30));
+        int cosX = UnitSinFast(AddQuarterTurn(z));
         return DivFast(sinX, cosX);
     }
 
@@ -1029,7 +2135,7 @@ public class Fixed32
     {
         int z = Mul(RCP_TWO_PI, x);
         int sinX = UnitSinFastest(z);
-        int cosX = UnitSinFastest(z + (1 << 30));
+        int cosX = UnitSinFastest(AddQuarterTurn(z));
         return DivFastest(sinX, cosX);
     }
 
@@ -1196,6 +2302,153 @@ public class Fixed32
         }
     }
 
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full int range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    public static int Atan2Turns(int y, int x)
+    {
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil.InvalidArgument("Fixed32.Atan2Turns", "y, x", y, x);
+            return 0;
+        }
+
+        int nx = Abs(x);
+        int ny = Abs(y);
+        int negMask = ((x ^ y) >> 31);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            int k = Atan2Div(ny, nx);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly5Lut8(k), RCP_TWO_PI);
+            int angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            int k = Atan2Div(nx, ny);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly5Lut8(k), RCP_TWO_PI);
+            int angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full int range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    public static int Atan2TurnsFast(int y, int x)
+    {
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil.InvalidArgument("Fixed32.Atan2TurnsFast", "y, x", y, x);
+            return 0;
+        }
+
+        int nx = Abs(x);
+        int ny = Abs(y);
+        int negMask = ((x ^ y) >> 31);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            int k = Atan2DivFast(ny, nx);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly3Lut8(k), RCP_TWO_PI);
+            int angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            int k = Atan2DivFast(nx, ny);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly3Lut8(k), RCP_TWO_PI);
+            int angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full int range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    public static int Atan2TurnsFastest(int y, int x)
+    {
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil.InvalidArgument("Fixed32.Atan2TurnsFastest", "y, x", y, x);
+            return 0;
+        }
+
+        int nx = Abs(x);
+        int ny = Abs(y);
+        int negMask = ((x ^ y) >> 31);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            int k = Atan2DivFastest(ny, nx);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly4(k), RCP_TWO_PI);
+            int angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            int k = Atan2DivFastest(nx, ny);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly4(k), RCP_TWO_PI);
+            int angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates Atan2Turns() for the first count elements of y and x into result.
+    /// </summary>
+    public static void Atan2TurnsBatch(int[] y, int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Atan2Turns(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFast() for the first count elements of y and x into result.
+    /// </summary>
+    public static void Atan2TurnsFastBatch(int[] y, int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Atan2TurnsFast(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFastest() for the first count elements of y and x into result.
+    /// </summary>
+    public static void Atan2TurnsFastestBatch(int[] y, int[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Atan2TurnsFastest(y[i], x[i]);
+    }
+
     public static int Asin(int x)
     {
         // Return 0 for invalid values
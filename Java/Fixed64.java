@@ -62,6 +62,8 @@ public class Fixed64
     // Private constants
     private static final long RCP_LN2      = 0x171547652L; // 1.0 / log(2.0) ~= 1.4426950408889634
     private static final long RCP_LOG2_E   = 2977044471L;  // 1.0 / log2(e) ~= 0.6931471805599453
+    private static final long LOG2_10      = 14267572527L; // log2(10.0) ~= 3.321928094887362
+    private static final long LOG10_2      = 1292913986L;  // log10(2.0) ~= 0.3010299956639812
     private static final int  RCP_HALF_PI  = 683565276; // 1.0 / (4.0 * 0.5 * Math.PI);  // the 4.0 factor converts directly to s2.30
 
     /// <summary>
@@ -268,7 +270,61 @@ public class Fixed64
     /// </summary>
     public static long Lerp(long a, long b, long t)
     {
-        return Mul(a, t) + Mul(b, One - t);
+        return Mul(a, One - t) + Mul(b, t);
+    }
+
+    /// <summary>
+    /// Adds the two FP numbers together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    public static long AddSat(long a, long b)
+    {
+        long r = a + b;
+        long overflow = ((a ^ r) & (b ^ r)) >> 63;  // result sign differs from both inputs
+        long sat = (a >> 63) ^ MaxValue;
+        return (r & ~overflow) | (sat & overflow);
+    }
+
+    /// <summary>
+    /// Subtracts the two FP numbers from each other, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    public static long SubSat(long a, long b)
+    {
+        long r = a - b;
+        long overflow = ((a ^ b) & (a ^ r)) >> 63;  // input signs differ and result sign differs from a
+        long sat = (a >> 63) ^ MaxValue;
+        return (r & ~overflow) | (sat & overflow);
+    }
+
+    /// <summary>
+    /// Multiplies two FP values together, saturating to MinValue/MaxValue on overflow.
+    /// </summary>
+    public static long MulSat(long a, long b)
+    {
+        // High 64 bits of the full 128-bit product, from 32-bit halves.
+        long alo = a & 0xFFFFFFFFL;
+        long ahi = a >> 32;
+        long blo = b & 0xFFFFFFFFL;
+        long bhi = b >> 32;
+        // The product of the unsigned low halves can exceed MaxValue, so multiply them unsigned.
+        long lolo = FixedUtil.LogicalShiftRight(alo * blo, 32);
+        long mid1 = ahi * blo + lolo;
+        long mid2 = alo * bhi + (mid1 & 0xFFFFFFFFL);
+        long hi = ahi * bhi + (mid1 >> 32) + (mid2 >> 32);
+
+        // The result (product >> 32) fits in a long iff hi fits in an int.
+        long check = (hi + 0x80000000L) >> 32;
+        long overflow = (check | -check) >> 63;
+        long sat = (hi >> 63) ^ MaxValue;
+        return (Mul(a, b) & ~overflow) | (sat & overflow);
+    }
+
+    /// <summary>
+    /// Linearly interpolate from a to b by t, saturating to MinValue/MaxValue on overflow.
+    /// Returns the same value as Lerp() whenever none of its terms overflow.
+    /// </summary>
+    public static long LerpSat(long a, long b, long t)
+    {
+        return AddSat(MulSat(a, SubSat(One, t)), MulSat(b, t));
     }
 
     private static int Nlz(long x)
@@ -281,7 +337,7 @@ public class Fixed64
     /// </summary>
     public static long DivPrecise(long arg_a, long arg_b)
     {
-        // From http://www.hackersdelight.org/hdcodetxt/divlu.c.txt
+        // From https://web.archive.org/web/20190109053731/http://www.hackersdelight.org/hdcodetxt/divlu.c.txt
 
         long sign_dif = arg_a ^ arg_b;
 
@@ -434,48 +490,90 @@ public class Fixed64
     }
 
     /// <summary>
-    /// Divides two FP values and returns the modulus.
+    /// Returns (a * b) >> 62 for non-negative a and b, with b at most 2^62. The result is at
+    /// most 2 smaller than the exact value.
     /// </summary>
-    public static long Mod(long a, long b)
+    private static long MulHigh62(long a, long b)
     {
-        if (b == 0)
-        {
-            FixedUtil.InvalidArgument("Fixed64.Mod", "b", b);
+        long ah = a >> 31;
+        long al = a & 0x7FFFFFFF;
+        long bh = b >> 31;
+        long bl = b & 0x7FFFFFFF;
+        return ah * bh + ((ah * bl) >> 31) + ((al * bh) >> 31);
+    }
+
+    // Computes a / b for b != 0 and b != MinValue (see DivRefined()).
+    private static long RefinedQuotient(long a, long b)
+    {
+        // Handle negative values (|MinValue| is clamped to MaxValue).
+        int sign = ((a ^ b) < 0) ? -1 : 1;
+        long ua = (a == MinValue) ? MaxValue : Abs(a);
+        long ub = Abs(b);
+        if (ua == 0)
+            return 0;
+
+        // Saturate if the quotient does not fit in s32.32.
+        if ((ua >> 31) >= ub)
+            return (sign < 0) ? MinValue : MaxValue;
+
+        // Normalize both inputs into [1.0, 2.0( range (as s1.62).
+        int ka = Nlz(ua) - 1;
+        int kb = Nlz(ub) - 1;
+        long ma = ua << ka;
+        long mb = ub << kb;
+
+        // Polynomial approximation of 1 / mb (s2.30, about 24 bits), refined with one
+        // Newton-Raphson step r = r0 + r0 * (1 - mb * r0) to about 46 bits (as s1.62).
+        final int ONE = (1 << 30);
+        int r0 = FixedUtil.RcpPoly4Lut8((int)(mb >> 32) - ONE);
+        long e = ( 1L << 62) - (((mb >> 31) * r0) << 1) - (((mb & 0x7FFFFFFF) * r0) >> 30);
+        long r = ((long)r0 << 32) + (((long)r0 * (e >> 10)) >> 20);
+
+        // Quotient of the mantissas (s1.62), apply exponent to convert to s32.32.
+        int shift = 30 + ka - kb;
+        if (shift >= 63)
             return 0;
+        long q = FixedUtil.ShiftRight(MulHigh62(ma, r), shift);
+
+        // Quotients with more significant bits than the reciprocal are corrected with the
+        // residual a - q * b. Here ub is small enough for the residual to fit in 64 bits.
+        if (shift <= 22)
+        {
+            long rem = (ua << 32) - q * ub;
+            long d = FixedUtil.ShiftRight(MulHigh62(Abs(rem) << 4, r), 66 - kb);
+            q += (rem < 0) ? -d : d;
         }
 
-        return a % b;
+        return sign * q;
     }
 
     /// <summary>
-    /// Calculates the square root of the given number.
+    /// Calculates division with one Newton-Raphson refinement step. Within 1 ULP of DivPrecise()
+    /// but considerably faster. Saturates to MinValue/MaxValue if the quotient overflows.
     /// </summary>
-    public static long SqrtPrecise(long a)
+    public static long DivRefined(long a, long b)
     {
-        // Adapted from https://github.com/chmike/fpsqrt
-        if (a <= 0)
+        if (b == MinValue || b == 0)
         {
-            if (a < 0)
-                FixedUtil.InvalidArgument("Fixed64.SqrtPrecise", "a", a);
+            FixedUtil.InvalidArgument("Fixed64.DivRefined", "b", b);
             return 0;
         }
 
-        long r = a;
-        long b = 0x4000000000000000L;
-        long q = 0;
-        while (b > 0x40)
+        return RefinedQuotient(a, b);
+    }
+
+    /// <summary>
+    /// Divides two FP values and returns the modulus.
+    /// </summary>
+    public static long Mod(long a, long b)
+    {
+        if (b == 0)
         {
-            long t = q + b;
-            if (Long.compareUnsigned(r, t) >= 0)
-            {
-                r -= t;
-                q = t + b;
-            }
-            r <<= 1;
-            b >>= 1;
+            FixedUtil.InvalidArgument("Fixed64.Mod", "b", b);
+            return 0;
         }
-        q >>>= 16;
-        return q;
+
+        return a % b;
     }
 
     public static long Sqrt(long x)
@@ -565,6 +663,216 @@ public class Fixed64
         return (offset >= 0) ? (yr << offset) : (yr >> -offset);
     }
 
+    /// <summary>
+    /// Calculates the square root with one Newton-Raphson refinement step, rounded down to the
+    /// exact result.
+    /// </summary>
+    public static long SqrtRefined(long x)
+    {
+        // Return 0 for all non-positive values.
+        if (x <= 0)
+        {
+            if (x < 0)
+                FixedUtil.InvalidArgument("Fixed64.SqrtRefined", "x", x);
+            return 0;
+        }
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int SQRT2 = 1518500249; // sqrt(2.0)
+
+        // Normalize input into [1.0, 4.0( range (as s2.60), using an even exponent.
+        int offset = (Nlz(x) - 2) & ~1;
+        long m = FixedUtil.ShiftRight(x, -offset);
+
+        // Polynomial approximation of sqrt(m) (as s2.30, about 23 bits).
+        long y0 = (m >= ( 1L << 61))
+            ? ((long)SQRT2 * FixedUtil.SqrtPoly3Lut8((int)(m >> 31) - ONE)) >> 30
+            : FixedUtil.SqrtPoly3Lut8((int)(m >> 30) - ONE);
+
+        // One Newton-Raphson step y = y0 + (m - y0^2) / (2 * y0) (as s2.61). The residual is
+        // exact and only needs a rough reciprocal of y0.
+        int r = (y0 >= ( 1L << 31)) ? (1 << 29) : FixedUtil.RcpPoly4Lut8((int)y0 - ONE);
+        long d = m - y0 * y0;
+        long y = (y0 << 31) + (((d >> 10) * r) >> 20);
+
+        // Apply exponent, convert back to s32.32.
+        long res = y >> (15 + offset / 2);
+
+        // Round down to the exact square root using the residual x - res^2 (as s0.64), which
+        // is small enough to be exact in 64 bits.
+        long rem = (x << 32) - res * res;
+        while (rem < 0)
+        {
+            res--;
+            rem += 2 * res + 1;
+        }
+        while (rem > 2 * res)
+        {
+            rem -= 2 * res + 1;
+            res++;
+        }
+        return res;
+    }
+
+    /// <summary>
+    /// Calculates the square root of the given number. Raw values below 2^62 use SqrtRefined(),
+    /// larger ones a bit-by-bit loop.
+    /// </summary>
+    public static long SqrtPrecise(long a)
+    {
+        // Adapted from https://github.com/chmike/fpsqrt
+        if (a <= 0)
+        {
+            if (a < 0)
+                FixedUtil.InvalidArgument("Fixed64.SqrtPrecise", "a", a);
+            return 0;
+        }
+
+        // Below 2^62 the loop yields the exact square root (rounded down), which SqrtRefined()
+        // computes much faster. Larger values overflow the remainder of the loop, so keep using
+        // it for them.
+        if (a < ( 1L << 62))
+            return SqrtRefined(a);
+
+        long r = a;
+        long b = 0x4000000000000000L;
+        long q = 0;
+        while (b > 0x40)
+        {
+            long t = q + b;
+            if (Long.compareUnsigned(r, t) >= 0)
+            {
+                r -= t;
+                q = t + b;
+            }
+            r <<= 1;
+            b >>= 1;
+        }
+        q >>>= 16;
+        return q;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    public static long Cbrt(long x)
+    {
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int CBRT2 = 1352829926; // cbrt(2.0)
+        final int CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        long ax = (x == MinValue) ? MaxValue : Abs(x);
+        int offset = 31 - Nlz(ax);
+        int n = (int)(((offset >= 0) ? (ax >> offset) : (ax << -offset)) >> 2);
+        assert(n >= ONE);
+        int y = FixedUtil.CbrtPoly3Lut8(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        int q = (offset + 33) / 3 - 11;
+        int r = offset - 3 * q;
+        int adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s32.32 (the adjusted value can reach 2.0).
+        long yr = ((long)adjust * (long)y) >> 28;
+        yr = (q >= 0) ? (yr << q) : (yr >> -q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    public static long CbrtFast(long x)
+    {
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int CBRT2 = 1352829926; // cbrt(2.0)
+        final int CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        long ax = (x == MinValue) ? MaxValue : Abs(x);
+        int offset = 31 - Nlz(ax);
+        int n = (int)(((offset >= 0) ? (ax >> offset) : (ax << -offset)) >> 2);
+        assert(n >= ONE);
+        int y = FixedUtil.CbrtPoly4(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        int q = (offset + 33) / 3 - 11;
+        int r = offset - 3 * q;
+        int adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s32.32 (the adjusted value can reach 2.0).
+        long yr = ((long)adjust * (long)y) >> 28;
+        yr = (q >= 0) ? (yr << q) : (yr >> -q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates the cube root. Negative values have negative cube roots.
+    /// </summary>
+    public static long CbrtFastest(long x)
+    {
+        if (x == 0)
+            return 0;
+
+        // Constants (s2.30).
+        final int ONE = (1 << 30);
+        final int CBRT2 = 1352829926; // cbrt(2.0)
+        final int CBRT4 = 1704458901; // cbrt(4.0)
+
+        // Normalize magnitude into [1.0, 2.0( range (as s2.30).
+        long ax = (x == MinValue) ? MaxValue : Abs(x);
+        int offset = 31 - Nlz(ax);
+        int n = (int)(((offset >= 0) ? (ax >> offset) : (ax << -offset)) >> 2);
+        assert(n >= ONE);
+        int y = FixedUtil.CbrtPoly3(n - ONE);
+
+        // Divide offset by 3 (rounding down), compute adjust value for the remainder.
+        int q = (offset + 33) / 3 - 11;
+        int r = offset - 3 * q;
+        int adjust = (r == 0) ? ONE : ((r == 1) ? CBRT2 : CBRT4);
+
+        // Apply exponent, convert back to s32.32 (the adjusted value can reach 2.0).
+        long yr = ((long)adjust * (long)y) >> 28;
+        yr = (q >= 0) ? (yr << q) : (yr >> -q);
+        return (x < 0) ? -yr : yr;
+    }
+
+    /// <summary>
+    /// Calculates Cbrt() for the first count elements of x into result.
+    /// </summary>
+    public static void CbrtBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Cbrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFast() for the first count elements of x into result.
+    /// </summary>
+    public static void CbrtFastBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CbrtFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CbrtFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void CbrtFastestBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CbrtFastest(x[i]);
+    }
+
     /// <summary>
     /// Calculates the reciprocal square root.
     /// </summary>
@@ -745,6 +1053,130 @@ public class Fixed64
         return FixedUtil.ShiftRight(y, offset);
     }
 
+    /// <summary>
+    /// Calculates reciprocal with one Newton-Raphson refinement step. Within 1 ULP of
+    /// DivPrecise(One, x) but considerably faster. Saturates to MinValue/MaxValue if the
+    /// result overflows.
+    /// </summary>
+    public static long RcpRefined(long x)
+    {
+        if (x == MinValue || x == 0)
+        {
+            FixedUtil.InvalidArgument("Fixed64.RcpRefined", "x", x);
+            return 0;
+        }
+
+        return RefinedQuotient(One, x);
+    }
+
+    /// <summary>
+    /// Calculates AddSat() for the first count elements of a and b into result.
+    /// </summary>
+    public static void AddSatBatch(long[] a, long[] b, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = AddSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates SubSat() for the first count elements of a and b into result.
+    /// </summary>
+    public static void SubSatBatch(long[] a, long[] b, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SubSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates MulSat() for the first count elements of a and b into result.
+    /// </summary>
+    public static void MulSatBatch(long[] a, long[] b, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = MulSat(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates LerpSat() for the first count elements of a, b and t into result.
+    /// </summary>
+    public static void LerpSatBatch(long[] a, long[] b, long[] t, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = LerpSat(a[i], b[i], t[i]);
+    }
+
+    /// <summary>
+    /// Calculates Mul() for the first count elements of a and b into result.
+    /// </summary>
+    public static void MulBatch(long[] a, long[] b, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Mul(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Div() for the first count elements of a and b into result.
+    /// </summary>
+    public static void DivBatch(long[] a, long[] b, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Div(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates Sqrt() for the first count elements of x into result.
+    /// </summary>
+    public static void SqrtBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Sqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates RSqrt() for the first count elements of x into result.
+    /// </summary>
+    public static void RSqrtBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = RSqrt(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Rcp() for the first count elements of x into result.
+    /// </summary>
+    public static void RcpBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Rcp(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates DivRefined() for the first count elements of a and b into result.
+    /// </summary>
+    public static void DivRefinedBatch(long[] a, long[] b, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = DivRefined(a[i], b[i]);
+    }
+
+    /// <summary>
+    /// Calculates SqrtRefined() for the first count elements of x into result.
+    /// </summary>
+    public static void SqrtRefinedBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SqrtRefined(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates RcpRefined() for the first count elements of x into result.
+    /// </summary>
+    public static void RcpRefinedBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = RcpRefined(x[i]);
+    }
+
     /// <summary>
     /// Calculates the base 2 exponent.
     /// </summary>
@@ -817,11 +1249,56 @@ public class Fixed64
         return Exp2Fastest(Mul(x, RCP_LN2));
     }
 
-    // Natural logarithm (base e).
-    public static long Log(long x)
+    public static long Exp10(long x)
     {
-        // Return 0 for invalid values
-        if (x <= 0)
+        // 10^x == 2^(x * log2(10))
+        return Exp2(MulSat(x, LOG2_10));
+    }
+
+    public static long Exp10Fast(long x)
+    {
+        // 10^x == 2^(x * log2(10))
+        return Exp2Fast(MulSat(x, LOG2_10));
+    }
+
+    public static long Exp10Fastest(long x)
+    {
+        // 10^x == 2^(x * log2(10))
+        return Exp2Fastest(MulSat(x, LOG2_10));
+    }
+
+    /// <summary>
+    /// Calculates Exp10() for the first count elements of x into result.
+    /// </summary>
+    public static void Exp10Batch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Exp10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fast() for the first count elements of x into result.
+    /// </summary>
+    public static void Exp10FastBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Exp10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Exp10Fastest() for the first count elements of x into result.
+    /// </summary>
+    public static void Exp10FastestBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Exp10Fastest(x[i]);
+    }
+
+    // Natural logarithm (base e).
+    public static long Log(long x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
         {
             FixedUtil.InvalidArgument("Fixed64.Log", "x", x);
             return 0;
@@ -945,10 +1422,316 @@ public class Fixed64
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates the base 2 logarithm with about 18 bits of precision, by linear interpolation
+    /// of a 256-entry table (about 15 bits of relative precision near 1.0, where a short series
+    /// is used instead). Cheaper than Log2Fastest().
+    /// </summary>
+    public static long Log2Ultra(long x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil.InvalidArgument("Fixed64.Log2Ultra", "x", x);
+            return 0;
+        }
+
+        // Close to 1.0 the result approaches zero and the table loses relative precision, so use
+        // log2(1 + e) = (e - e^2/2 + e^3/3 - e^4/4 + e^5/5) / ln(2) on e = x - 1 (as s0.32) instead.
+        long e = x - One;
+        if (e > -(One >> 4) && e < (One >> 4))
+        {
+            long t = 309816401; // 1 / (5 * ln(2))
+            t = -387270501 + ((e * t) >> 32); // -1 / (4 * ln(2))
+            t = 516360668 + ((e * t) >> 32); // 1 / (3 * ln(2))
+            t = -774541002 + ((e * t) >> 32); // -1 / (2 * ln(2))
+            t = 1549082005 + ((e * t) >> 32); // 1 / ln(2)
+            return (e * t) >> 30;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        int offset = 31 - Nlz(x);
+        int n = (int)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+
+        // Table approximation of mantissa.
+        final int ONE = (1 << 30);
+        assert(n >= ONE);
+        long y = (long)FixedUtil.Log2Lut256(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return offset * One + y;
+    }
+
+    /// <summary>
+    /// Calculates Log2Ultra() for the first count elements of x into result.
+    /// </summary>
+    public static void Log2UltraBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log2Ultra(x[i]);
+    }
+
+    public static long Log10(long x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil.InvalidArgument("Fixed64.Log10", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        final int ONE = (1 << 30);
+        int offset = 31 - Nlz(x);
+        int n = (int)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        assert(n >= ONE);
+        long y = (long)FixedUtil.Log10Poly5Lut8(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return (long)offset * LOG10_2 + y;
+    }
+
+    public static long Log10Fast(long x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil.InvalidArgument("Fixed64.Log10Fast", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        final int ONE = (1 << 30);
+        int offset = 31 - Nlz(x);
+        int n = (int)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        assert(n >= ONE);
+        long y = (long)FixedUtil.Log10Poly3Lut8(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return (long)offset * LOG10_2 + y;
+    }
+
+    public static long Log10Fastest(long x)
+    {
+        // Return 0 for invalid values
+        if (x <= 0)
+        {
+            FixedUtil.InvalidArgument("Fixed64.Log10Fastest", "x", x);
+            return 0;
+        }
+
+        // Normalize value to range [1.0, 2.0( as s2.30 and extract exponent.
+        final int ONE = (1 << 30);
+        int offset = 31 - Nlz(x);
+        int n = (int)(((offset >= 0) ? (x >> offset) : (x << -offset)) >> 2);
+        assert(n >= ONE);
+        long y = (long)FixedUtil.Log10Poly5(n - ONE) << 2;
+
+        // Combine integer and fractional parts (into s32.32).
+        return (long)offset * LOG10_2 + y;
+    }
+
+    /// <summary>
+    /// Calculates Log10() for the first count elements of x into result.
+    /// </summary>
+    public static void Log10Batch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log10(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fast() for the first count elements of x into result.
+    /// </summary>
+    public static void Log10FastBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log10Fast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Log10Fastest() for the first count elements of x into result.
+    /// </summary>
+    public static void Log10FastestBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Log10Fastest(x[i]);
+    }
+
+    // x^m for x >= 0 and m >= 0 by repeated squaring. All factors are >= 1 whenever the result
+    // can overflow, so a saturated value stays saturated.
+    private static long PowIntAbs(long x, long m)
+    {
+        long r = ((m & 1) != 0) ? x : One;
+        m >>= 1;
+        while (m != 0)
+        {
+            x = MulSat(x, x);
+            if ((m & 1) != 0)
+                r = MulSat(r, x);
+            m >>= 1;
+        }
+        return r;
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike Pow(), x can be
+    /// negative. Negative powers use Rcp(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    public static long PowInt(long x, int n)
+    {
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil.InvalidArgument("Fixed64.PowInt", "n", n);
+            return 0;
+        }
+
+        long sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        long ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(Rcp(ax), -(long)n));
+        return sign * Rcp(PowIntAbs(ax, -(long)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFast(), x can be
+    /// negative. Negative powers use RcpFast(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    public static long PowIntFast(long x, int n)
+    {
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil.InvalidArgument("Fixed64.PowIntFast", "n", n);
+            return 0;
+        }
+
+        long sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        long ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFast(ax), -(long)n));
+        return sign * RcpFast(PowIntAbs(ax, -(long)n));
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the integer n by repeated squaring. Unlike PowFastest(), x can be
+    /// negative. Negative powers use RcpFastest(). Saturates to -MaxValue/MaxValue on overflow.
+    /// </summary>
+    public static long PowIntFastest(long x, int n)
+    {
+        // n^0 == 1
+        if (n == 0)
+            return One;
+
+        // Return 0 for invalid values
+        if (x == 0)
+        {
+            if (n < 0)
+                FixedUtil.InvalidArgument("Fixed64.PowIntFastest", "n", n);
+            return 0;
+        }
+
+        long sign = (x < 0 && (n & 1) != 0) ? -1 : 1;
+        long ax = (x == MinValue) ? MaxValue : Abs(x);
+        if (n > 0)
+            return sign * PowIntAbs(ax, n);
+
+        // For negative powers, invert the base if it is below one (its reciprocal is then large
+        // and precise), otherwise invert the result. 1/x overflows for the two smallest values.
+        if (ax < One)
+            return sign * ((ax <= 2) ? MaxValue : PowIntAbs(RcpFastest(ax), -(long)n));
+        return sign * RcpFastest(PowIntAbs(ax, -(long)n));
+    }
+
+    // Log2Wide() reduces the mantissa m in [1 + i/64, 1 + (i+1)/64( to m * r - 1, where r is
+    // Log2WideRcpTable[i] / 1024 (close to the reciprocal of the interval midpoint), and
+    // Log2WideTable[i] is -log2(r) as s13.50.
+    private static final int[] Log2WideRcpTable =
+    {
+        1016, 1001, 986, 971, 957, 943, 930, 917, 904, 892, 880, 868, 857, 846, 835, 824,
+        814, 804, 794, 785, 776, 767, 758, 749, 741, 732, 724, 716, 708, 701, 694, 686,
+        679, 672, 665, 659, 652, 646, 639, 633, 627, 621, 615, 610, 604, 599, 593, 588,
+        583, 577, 572, 567, 563, 558, 553, 548, 544, 539, 535, 531, 526, 522, 518, 514,
+    };
+
+    private static final long[] Log2WideTable =
+    {
+        12739910109114L, 36899952123439L, 61424779539800L, 86325577023921L,
+        109915849505706L, 133853780600797L, 156402239599007L, 179268120991617L,
+        202460489465084L, 224166784132086L, 246167078174630L, 268469445177499L,
+        289185821441394L, 310169827108682L, 331428467647269L, 352969027239626L,
+        372802365368826L, 392880868394535L, 413210673347539L, 431727621067932L,
+        450458093710443L, 469407073229532L, 488579717997901L, 507981371235725L,
+        525424010923084L, 545273506959864L, 563123469139974L, 581171768291806L,
+        599422861565083L, 615562542235566L, 631864200901458L, 650697225927101L,
+        667357169019477L, 684189757083279L, 701198605818097L, 715920732690888L,
+        733266910480454L, 748283937736819L, 765981095648219L, 781305079227158L,
+        796775007702725L, 812393687771805L, 828164007882271L, 841423919984538L,
+        857480033045678L, 870982440073696L, 887334895752236L, 901088832392313L,
+        914960225079413L, 931763790921570L, 945900783657030L, 960161895563393L,
+        971661626513226L, 986151733416957L, 1000772266078475L, 1015525593769779L,
+        1027425502026676L, 1042424040836402L, 1054523390725611L, 1066713543339329L,
+        1082081020424012L, 1094480547904240L, 1106975457302149L, 1119567227429205L,
+    };
+
+    /// <summary>
+    /// Calculates log2(x) as s13.50 for Pow(), with a precision of about 39 bits (wider than the
+    /// s2.30 kernels of Log2() can provide).
+    /// </summary>
+    private static long Log2Wide(long x)
+    {
+        // Normalize value to range [1.0, 2.0( as s23.40 and extract exponent.
+        int nlz = Nlz(x);
+        long m = (nlz >= 23) ? (x << (nlz - 23)) : (x >> (23 - nlz));
+        int offset = 31 - nlz;
+
+        // z = m * r - 1 is exact (as s13.50) and |z| < 2^-6.9.
+        final long ONE = 1L << 50;
+        int i = (int)(m >> 34) & 63;
+        long z = m * Log2WideRcpTable[i] - ONE;
+
+        // ln(1 + z) = z - z^2/2 + z^3/3 - z^4/4 + z^5/5, where (Mul(a, b) >> 18) multiplies two s13.50 values.
+        long t = 225179981368525L; // 1/5
+        t = -281474976710656L + (Mul(z, t) >> 18); // -1/4
+        t = 375299968947541L + (Mul(z, t) >> 18); // 1/3
+        t = -562949953421312L + (Mul(z, t) >> 18); // -1/2
+        t = ONE + (Mul(z, t) >> 18);
+        long lnz = Mul(z, t) >> 18;
+
+        // log2(x) = offset - log2(r) + ln(1 + z) / ln(2), where 1/ln(2) is s32.32.
+        return offset * ONE + Log2WideTable[i] + Mul(lnz, 6196328019L);
+    }
+
+    /// <summary>
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowInt(),
+    /// and exponents of 0.5, -0.5 and -1 with Sqrt(), RSqrt() and Rcp().
     /// </summary>
     public static long Pow(long x, long exponent)
     {
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -957,14 +1740,32 @@ public class Fixed64
             return 0;
         }
 
-        return Exp(Mul(exponent, Log(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return Sqrt(x);
+        if (exponent == -Half)
+            return RSqrt(x);
+        if (exponent == Neg1)
+            return Rcp(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowInt(x, (int)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)). log2(x) and the product are kept as s13.50, so that the error of
+        // the logarithm is not multiplied by the exponent (and without converting to and from
+        // natural logarithms).
+        return Exp2(MulSat(exponent, Log2Wide(x)) >> 18);
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFast(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFast(), RSqrtFast() and RcpFast().
     /// </summary>
     public static long PowFast(long x, long exponent)
     {
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -973,14 +1774,30 @@ public class Fixed64
             return 0;
         }
 
-        return ExpFast(Mul(exponent, LogFast(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFast(x);
+        if (exponent == -Half)
+            return RSqrtFast(x);
+        if (exponent == Neg1)
+            return RcpFast(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFast(x, (int)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)), without the rounding of converting to and from natural logarithms.
+        return Exp2Fast(MulSat(exponent, Log2Fast(x)));
     }
 
     /// <summary>
-    /// Calculates x to the power of the exponent.
+    /// Calculates x to the power of the exponent. Integer exponents are calculated with PowIntFastest(),
+    /// and exponents of 0.5, -0.5 and -1 with SqrtFastest(), RSqrtFastest() and RcpFastest().
     /// </summary>
     public static long PowFastest(long x, long exponent)
     {
+        // n^0 == 1
+        if (exponent == 0)
+            return One;
+
         // Return 0 for invalid values
         if (x <= 0)
         {
@@ -989,7 +1806,237 @@ public class Fixed64
             return 0;
         }
 
-        return ExpFastest(Mul(exponent, LogFastest(x)));
+        // Fast paths for common exponents.
+        if (exponent == Half)
+            return SqrtFastest(x);
+        if (exponent == -Half)
+            return RSqrtFastest(x);
+        if (exponent == Neg1)
+            return RcpFastest(x);
+        if ((exponent & FractionMask) == 0 && exponent >= -64 * One && exponent <= 64 * One)
+            return PowIntFastest(x, (int)(exponent >> Shift));
+
+        // x^e == 2^(e * log2(x)), without the rounding of converting to and from natural logarithms.
+        return Exp2Fastest(MulSat(exponent, Log2Fastest(x)));
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    public static long Sigmoid(long x)
+    {
+        // Handle values that saturate to 0 or 1.
+        if (x >= 32 * One) return One;
+        if (x <= -32 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        long y = (long)FixedUtil.SigmoidPoly5Lut64((int)(Abs(x) >> 6)) << 2;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    public static long SigmoidFast(long x)
+    {
+        // Handle values that saturate to 0 or 1.
+        if (x >= 32 * One) return One;
+        if (x <= -32 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        long y = (long)FixedUtil.SigmoidPoly3Lut64((int)(Abs(x) >> 6)) << 2;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the logistic sigmoid 1 / (1 + e^-x).
+    /// </summary>
+    public static long SigmoidFastest(long x)
+    {
+        // Handle values that saturate to 0 or 1.
+        if (x >= 32 * One) return One;
+        if (x <= -32 * One) return 0;
+
+        // Polynomial approximation of sigmoid(|x|), with input as s5.26.
+        long y = (long)FixedUtil.SigmoidPoly2Lut64((int)(Abs(x) >> 6)) << 2;
+
+        // sigmoid(-x) == 1 - sigmoid(x)
+        return (x >= 0) ? y : One - y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    public static long Tanh(long x)
+    {
+        // Handle values that saturate to -1 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        long y = (long)(FixedUtil.SigmoidPoly5Lut64((int)(Abs(x) >> 5)) - (1 << 29)) << 3;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    public static long TanhFast(long x)
+    {
+        // Handle values that saturate to -1 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        long y = (long)(FixedUtil.SigmoidPoly3Lut64((int)(Abs(x) >> 5)) - (1 << 29)) << 3;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the hyperbolic tangent.
+    /// </summary>
+    public static long TanhFastest(long x)
+    {
+        // Handle values that saturate to -1 or 1.
+        if (x >= 16 * One) return One;
+        if (x <= -16 * One) return Neg1;
+
+        // tanh(|x|) == 2 * sigmoid(2 * |x|) - 1, with sigmoid input as s5.26.
+        long y = (long)(FixedUtil.SigmoidPoly2Lut64((int)(Abs(x) >> 5)) - (1 << 29)) << 3;
+
+        // tanh(-x) == -tanh(x)
+        return (x >= 0) ? y : -y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    public static long Softplus(long x)
+    {
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 32 * One) return x;
+        if (x <= -32 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        long y = (long)FixedUtil.SoftplusPoly5Lut64((int)(Abs(x) >> 6)) << 2;
+        return Max(x, Zero) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    public static long SoftplusFast(long x)
+    {
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 32 * One) return x;
+        if (x <= -32 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        long y = (long)FixedUtil.SoftplusPoly3Lut64((int)(Abs(x) >> 6)) << 2;
+        return Max(x, Zero) + y;
+    }
+
+    /// <summary>
+    /// Calculates the softplus function log(1 + e^x).
+    /// </summary>
+    public static long SoftplusFastest(long x)
+    {
+        // Handle values where the result is x or 0 (within precision).
+        if (x >= 32 * One) return x;
+        if (x <= -32 * One) return 0;
+
+        // softplus(x) == max(x, 0) + log(1 + e^-|x|), with input as s5.26.
+        long y = (long)FixedUtil.SoftplusPoly2Lut64((int)(Abs(x) >> 6)) << 2;
+        return Max(x, Zero) + y;
+    }
+
+    /// <summary>
+    /// Calculates Sigmoid() for the first count elements of x into result.
+    /// </summary>
+    public static void SigmoidBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Sigmoid(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFast() for the first count elements of x into result.
+    /// </summary>
+    public static void SigmoidFastBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SigmoidFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SigmoidFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void SigmoidFastestBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SigmoidFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Tanh() for the first count elements of x into result.
+    /// </summary>
+    public static void TanhBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Tanh(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFast() for the first count elements of x into result.
+    /// </summary>
+    public static void TanhFastBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = TanhFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates TanhFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void TanhFastestBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = TanhFastest(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Softplus() for the first count elements of x into result.
+    /// </summary>
+    public static void SoftplusBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Softplus(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFast() for the first count elements of x into result.
+    /// </summary>
+    public static void SoftplusFastBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SoftplusFast(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates SoftplusFastest() for the first count elements of x into result.
+    /// </summary>
+    public static void SoftplusFastestBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SoftplusFastest(x[i]);
     }
 
     private static int UnitSin(int z)
@@ -1062,7 +2109,7 @@ public class Fixed64
         int z = MulIntLongLow(RCP_HALF_PI, x);
 
         // Compute sine and convert to s32.32.
-        return (long)UnitSin(z) << 2;
+        return (long)UnitSin(z) * 4;
     }
 
     public static long SinFast(long x)
@@ -1072,7 +2119,7 @@ public class Fixed64
         int z = MulIntLongLow(RCP_HALF_PI, x);
 
         // Compute sine and convert to s32.32.
-        return (long)UnitSinFast(z) << 2;
+        return (long)UnitSinFast(z) * 4;
     }
 
     public static long SinFastest(long x)
@@ -1082,7 +2129,21 @@ public class Fixed64
         int z = MulIntLongLow(RCP_HALF_PI, x);
 
         // Compute sine and convert to s32.32.
-        return (long)UnitSinFastest(z) << 2;
+        return (long)UnitSinFastest(z) * 4;
+    }
+
+    /// <summary>
+    /// Calculates sine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than SinFastest().
+    /// </summary>
+    public static long SinUltra(long x)
+    {
+        // Map [0, 2pi] to [0, 4] (as s2.30).
+        // This also wraps the values into one period.
+        int z = MulIntLongLow(RCP_HALF_PI, x);
+
+        // Interpolate sine from the table and convert to s32.32.
+        return (long)FixedUtil.SinLut256(z) * 4;
     }
 
     public static long Cos(long x)
@@ -1100,11 +2161,194 @@ public class Fixed64
         return SinFastest(x + PiHalf);
     }
 
+    /// <summary>
+    /// Calculates cosine with about 13 bits of precision, by linear interpolation of a 256-entry
+    /// table. Cheaper than CosFastest().
+    /// </summary>
+    public static long CosUltra(long x)
+    {
+        return SinUltra(x + PiHalf);
+    }
+
+    /// <summary>
+    /// Calculates SinUltra() for the first count elements of x into result.
+    /// </summary>
+    public static void SinUltraBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosUltra() for the first count elements of x into result.
+    /// </summary>
+    public static void CosUltraBatch(long[] x, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosUltra(x[i]);
+    }
+
+    /// <summary>
+    /// Advances a binary angle by a quarter turn, wrapping around at a full turn.
+    /// </summary>
+    private static int AddQuarterTurn(int angle)
+    {
+        return angle + (1 << 30);
+    }
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full int range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    public static long SinTurns(int angle)
+    {
+        // A binary angle is the s2.30 quarter-turn value that UnitSin() takes. The s2.30 result
+        // is scaled to s32.32 with a multiply, as it can be negative.
+        return (long)UnitSin(angle) * 4;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full int range is one turn.
+    /// </summary>
+    public static long CosTurns(int angle)
+    {
+        return (long)UnitSin(AddQuarterTurn(angle)) * 4;
+    }
+
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full int range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    public static long SinTurnsFast(int angle)
+    {
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFast() takes.
+        return (long)UnitSinFast(angle) * 4;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full int range is one turn.
+    /// </summary>
+    public static long CosTurnsFast(int angle)
+    {
+        return (long)UnitSinFast(AddQuarterTurn(angle)) * 4;
+    }
+
+
+    /// <summary>
+    /// Calculates sine of a binary angle, where the full int range is one turn (2^30 is a
+    /// quarter turn). Unlike Sin(), needs no scaling from radians and wraps around exactly.
+    /// </summary>
+    public static long SinTurnsFastest(int angle)
+    {
+        // A binary angle is the s2.30 quarter-turn value that UnitSinFastest() takes.
+        return (long)UnitSinFastest(angle) * 4;
+    }
+
+    /// <summary>
+    /// Calculates cosine of a binary angle, where the full int range is one turn.
+    /// </summary>
+    public static long CosTurnsFastest(int angle)
+    {
+        return (long)UnitSinFastest(AddQuarterTurn(angle)) * 4;
+    }
+
+
+    /// <summary>
+    /// Calculates SinTurns() for the first count elements of angle into result.
+    /// </summary>
+    public static void SinTurnsBatch(int[] angle, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurns() for the first count elements of angle into result.
+    /// </summary>
+    public static void CosTurnsBatch(int[] angle, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosTurns(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    public static void SinCosTurnsBatch(int[] angle, long[] sinX, long[] cosX, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            sinX[i] = (long)UnitSin(angle[i]) * 4;
+            cosX[i] = (long)UnitSin(AddQuarterTurn(angle[i])) * 4;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    public static void SinTurnsFastBatch(int[] angle, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFast() for the first count elements of angle into result.
+    /// </summary>
+    public static void CosTurnsFastBatch(int[] angle, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosTurnsFast(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    public static void SinCosTurnsFastBatch(int[] angle, long[] sinX, long[] cosX, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            sinX[i] = (long)UnitSinFast(angle[i]) * 4;
+            cosX[i] = (long)UnitSinFast(AddQuarterTurn(angle[i])) * 4;
+        }
+    }
+
+    /// <summary>
+    /// Calculates SinTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    public static void SinTurnsFastestBatch(int[] angle, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = SinTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates CosTurnsFastest() for the first count elements of angle into result.
+    /// </summary>
+    public static void CosTurnsFastestBatch(int[] angle, long[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = CosTurnsFastest(angle[i]);
+    }
+
+    /// <summary>
+    /// Calculates the sine and cosine of the first count elements of angle into sinX and cosX.
+    /// </summary>
+    public static void SinCosTurnsFastestBatch(int[] angle, long[] sinX, long[] cosX, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            sinX[i] = (long)UnitSinFastest(angle[i]) * 4;
+            cosX[i] = (long)UnitSinFastest(AddQuarterTurn(angle[i])) * 4;
+        }
+    }
+
     public static long Tan(long x)
     {
         int z = MulIntLongLow(RCP_HALF_PI, x);
         long sinX = (long)UnitSin(z) << 32;
-        long cosX = (long)UnitSin(z + (1 << 30)) << 32;
+        long cosX = (long)UnitSin(AddQuarterTurn(z)) << 32;
         return Div(sinX, cosX);
     }
 
@@ -1112,7 +2356,7 @@ public class Fixed64
     {
         int z = MulIntLongLow(RCP_HALF_PI, x);
         long sinX = (long)UnitSinFast(z) << 32;
-        long cosX = (long)UnitSinFast(z + (1 << 30)) << 32;
+        long cosX = (long)UnitSinFast(AddQuarterTurn(z)) << 32;
         return DivFast(sinX, cosX);
     }
 
@@ -1120,7 +2364,7 @@ public class Fixed64
     {
         int z = MulIntLongLow(RCP_HALF_PI, x);
         long sinX = (long)UnitSinFastest(z) << 32;
-        long cosX = (long)UnitSinFastest(z + (1 << 30)) << 32;
+        long cosX = (long)UnitSinFastest(AddQuarterTurn(z)) << 32;
         return DivFastest(sinX, cosX);
     }
 
@@ -1292,6 +2536,156 @@ public class Fixed64
         }
     }
 
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full int range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    public static int Atan2Turns(long y, long x)
+    {
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil.InvalidArgument("Fixed64.Atan2Turns", "y, x", y, x);
+            return 0;
+        }
+
+        // \note these round negative numbers slightly
+        long nx = x ^ (x >> 63);
+        long ny = y ^ (y >> 63);
+        int negMask = (int)((x ^ y) >> 63);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            int k = Atan2Div(ny, nx);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly5Lut8(k), RCP_HALF_PI);
+            int angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            int k = Atan2Div(nx, ny);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly5Lut8(k), RCP_HALF_PI);
+            int angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full int range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    public static int Atan2TurnsFast(long y, long x)
+    {
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil.InvalidArgument("Fixed64.Atan2TurnsFast", "y, x", y, x);
+            return 0;
+        }
+
+        // \note these round negative numbers slightly
+        long nx = x ^ (x >> 63);
+        long ny = y ^ (y >> 63);
+        int negMask = (int)((x ^ y) >> 63);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            int k = Atan2DivFast(ny, nx);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly3Lut8(k), RCP_HALF_PI);
+            int angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            int k = Atan2DivFast(nx, ny);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly3Lut8(k), RCP_HALF_PI);
+            int angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates the angle of the vector (x, y) as a binary angle, where the full int range is
+    /// one turn (2^30 is a quarter turn and MinValue half a turn).
+    /// </summary>
+    public static int Atan2TurnsFastest(long y, long x)
+    {
+        if (x == 0)
+        {
+            if (y > 0) return 1 << 30;
+            if (y < 0) return -(1 << 30);
+
+            FixedUtil.InvalidArgument("Fixed64.Atan2TurnsFastest", "y, x", y, x);
+            return 0;
+        }
+
+        // \note these round negative numbers slightly
+        long nx = x ^ (x >> 63);
+        long ny = y ^ (y >> 63);
+        int negMask = (int)((x ^ y) >> 63);
+
+        // The octant angle is converted from radians (s2.30) to turns, after which the
+        // quadrants are exact offsets.
+        if (nx >= ny)
+        {
+            int k = Atan2DivFastest(ny, nx);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly4(k), RCP_HALF_PI);
+            int angle = (negMask ^ z) - negMask;
+            if (x > 0) return angle;
+
+            // Adding or subtracting half a turn both flip the top bit.
+            return angle ^ (1 << 31);
+        }
+        else
+        {
+            int k = Atan2DivFastest(nx, ny);
+            int z = FixedUtil.Qmul30(FixedUtil.AtanPoly4(k), RCP_HALF_PI);
+            int angle = (negMask ^ z) - negMask;
+            return ((y > 0) ? (1 << 30) : -(1 << 30)) - angle;
+        }
+    }
+
+    /// <summary>
+    /// Calculates Atan2Turns() for the first count elements of y and x into result.
+    /// </summary>
+    public static void Atan2TurnsBatch(long[] y, long[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Atan2Turns(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFast() for the first count elements of y and x into result.
+    /// </summary>
+    public static void Atan2TurnsFastBatch(long[] y, long[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Atan2TurnsFast(y[i], x[i]);
+    }
+
+    /// <summary>
+    /// Calculates Atan2TurnsFastest() for the first count elements of y and x into result.
+    /// </summary>
+    public static void Atan2TurnsFastestBatch(long[] y, long[] x, int[] result, int count)
+    {
+        for (int i = 0; i < count; i++)
+            result[i] = Atan2TurnsFastest(y[i], x[i]);
+    }
+
     public static long Asin(long x)
     {
         // Return 0 for invalid values
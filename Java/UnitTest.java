@@ -395,6 +395,15 @@ class UnitTest
 			Util.Check("Fixed64.RcpFastest", Fixed64.RcpFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.RcpRefined()
+	public static void Fixed64_RcpRefined()
+	{
+		long[] input0 = new long[]{ -253220600627L, -43387L, 14610832716L, 5L, -837284159L, -21358303005674L, 33520822456L, 211356855L, -29901L, -1661549609657L, 191226399L, 773143804855L, -26430767930581572L, -2679057L, 3818682199842397184L, 314L, -3140582180852L, -4064025676052909568L, 2107L, 677161308137456384L, -23145155L, -123793916454425168L, 1L, 160339095926197L, -14098L, -11032363L, 377L, 13800L, -70456659L, -99848L, 11L, 2377L, -180229720331420L, -1203382112L, 6818488L, 58233026878L, -12043L, -39L, 506L, 4016370383606343L, -177508392169013760L, -82353L, 23643290L, 171322961991793504L, -132387352015712L, -323104289580L, 16926372473L, 1905378847106256128L, -291307040520L, -22L, 4277885766001L, 185176635389968064L, -172L, -3411207616L, 29506372514171980L, 9433209134469L, -26419L, -420237949876823L, 1677613625091425L, 75L, -56583431156L, -2428962L, 2L, 1381032905913735424L, -151000756395L, -80440L, 19783066125446532L, 21963736L, -1811980945465408768L, -65575883L, 120287267788690896L, 80100751518L, -8020711854153229L, -2419333L, 3L, 281L, -5235900440L, -44L, 1L, 201229941173L, -3005829935584828L, -913L, 218475451607L, 3082569L, -107639765865L, -274L, 13L, 52834L, -188082098495L, -3333407390662L, 2204147L, 132169247L, -107780L, -6L, 70981L, 73079929572L, -27452L, -78952089L, 1134583L, 1645771841L };
+		long[] output0 = new long[]{ -72848512L, -425167540362540L, 1262538859L, 3689348814741910323L, -22031641080L, -863680L, 550307024L, 87277718405L, -616927329310375L, -11102132L, 96465468001L, 23859395L, -697L, -6885536244174L, 4L, 58747592591431693L, -5873670L, -4L, 8754980576036806L, 27L, -797002399582L, -149L, 9223372036854775807L, 115048L, -1308465319457338L, -1672057389129L, 48930355633181834L, 1336720585051416L, -261816900425L, -184748258089391L, 1676976733973595601L, 7760514965801241L, -102351L, -15329082832L, 2705400973604L, 316774604L, -1531739938031184L, -472993437787424400L, 36456015955947730L, 4592L, -103L, -223996018040745L, 780210540652L, 107L, -139339L, -57092228L, 1089822648L, 9L, -63324058L, -838488366986797800L, 4312117L, 99L, -107248512056450881L, -5407687291L, 625L, 1955510L, -698237786203472L, -43895L, 10995L, 245956587649460688L, -326009640L, -7594496774222L, 9223372036854775807L, 13L, -122163256L, -229323024287786L, 932L, 839872782741L, -10L, -281303784711L, 153L, 230294269L, -2299L, -7624723042966L, 6148914691236517205L, 65646776063023315L, -3523127356L, -419244183493398900L, 9223372036854775807L, 91669976L, -6136L, -20204538963537296L, 84433944L, 5984211245136L, -171374806L, -67323883480691794L, 1418980313362273201L, 349145324482521L, -98078148L, -5533900L, 8369107901473L, 139569109247L, -171151828481253L, -3074457345618258602L, 259882842925706L, 252418744L, -671963575466616L, -233644787710L, 16258611378550L, 11208567077L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.RcpRefined", Fixed64.RcpRefined(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Rcp()
 	public static void Fixed32_Rcp()
 	{
@@ -452,6 +461,16 @@ class UnitTest
 			Util.Check("Fixed64.DivFastest", Fixed64.DivFastest(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
 
+	// Fixed64.DivRefined()
+	public static void Fixed64_DivRefined()
+	{
+		long[] input0 = new long[]{ 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 288423935L, 3763194179752L, 3077611551433L, -509721130237L, 407529266189L, -3519139999638L, 140085490065L, -3084018839436L, 727010750338L, 4197822143954L, -3204514431492L, 2948142543372L, -1705873842794L, 3657185887703L, 936354158436L, -2259785823052L, -1942370886904L, -1280971470596L, -911739646424L, -3096273751441L, 2775584695292L, -1834283598854L, 4121509507919L, -2660546163238L, -4179280703946L, -1706074286794L, -4000684116642796032L, 544972236333794304L, 2494320746000234496L, 4355034913186014208L, 1331873407116478464L, 4226947864394351616L, 1549613912524237824L, -671526428476668928L, -2342221484233227264L, -4312140400471022080L, 3497203345319337984L, -3797893816873756672L, -4204246355179272192L, -3559511891905337856L, -225778830911226368L, -1687800851795053568L, 3299585921343879168L, -3985722855758251008L, -1133621479032151552L, 2548300341678097408L, -3412300878449073152L, -4206845377330245632L, -3330174485166706688L, -3038808434860886016L, 3067487984504000512L, 4293060925305L, 4294750300141L, 4293763644363L, 4292824596353L, 4291569025946L, 4290768330022L, 4292476834514L, 4293248892761L, 4291271889464L, 4294690281547L, 4291426214788L, 4290890557666L, 4291857668620L, 4292212286356L, 4294932846901L, 4292127775108L, 4292016186342L, 4294290969203L, 4291985334728L, 4292318085470L, 4293082846303L, 4292331248348L, 4294341878565L, 4291116710334L, 4294897106459L };
+		long[] input1 = new long[]{ -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -4396875775L, -14299458879L, -2437319033079367L, 12860634847L, 326440822327455L, -340024438671174464L, -3280261678208381L, 242675356553229L, 43619841316402L, -240124845770731168L, -533761292810L, 62079014334070L, 85500874191L, -2542652621168L, -861185638157L, 2421215103012259328L, 3788378419570859520L, -706094601694554L, -258512120668L, 643162778575561L, 262982728267209120L, -23478560555513L, -6160128514L, 32178228007L, 1374490582533L, -4929183426316L, 1926757413323173888L, 2607989825795710976L, 1080970784890995712L, -3217024516593702400L, 3574116674799116288L, -4238161525793223680L, 371655990733490176L, 2539565915792258048L, -2751845619388713472L, 2844201177370936320L, -3760014576127345152L, 2359024057727967232L, -262916889151022080L, -2642649142443714560L, -2087923763373119488L, 2699031231158928384L, 1998222447936419840L, -4049737818621550080L, -2560030142182071296L, -3782993535934908416L, 3710667205759590400L, 307941924689154048L, -3846412834078615552L, -3711931644132121600L, 417356882325635072L, -4292447824742L, -4294894137091L, -4294608669593L, -4291018866896L, -4294667792335L, -4291426148408L, -4293677894155L, -4292904197819L, -4293274905279L, -4292095543522L, -4291063260458L, -4294196529795L, -4291850122236L, -4294936654431L, -4294048245415L, -4293559380609L, -4291341754474L, -4292097821374L, -4291866247402L, -4291093661000L, -4293858417747L, -4292564967272L, -4293689015869L, -4291662154518L, -4293897739603L };
+		long[] output0 = new long[]{ -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -281738996L, -1130308221262L, -5423270L, -170227645096L, 5361844L, 44451L, -183419L, -54582221L, 71584107L, -75083L, 25785467901L, 203968699L, -85691198309L, -6177601160L, -4669853176L, -4008L, -2202L, 7791775L, 15147807977L, -20676561L, 45330L, 335548171L, -2873600527397L, -355114606003L, -13059292055L, 1486561288L, -8917992126L, 897487370L, 9910560192L, -5814295921L, 1600494121L, -4283603333L, 17907799797L, -1135699621L, 3655642818L, -6511670884L, -3994764831L, -6914651711L, 68679880771L, 5785099096L, 464438746L, -2685796806L, 7092110108L, 4227075944L, 1901878848L, -2893176137L, -3949618724L, -58674255976L, 3718527137L, 3516116162L, 31567133866L, -4295580756L, -4294823456L, -4294122200L, -4296774687L, -4291868313L, -4294308934L, -4293765875L, -4295312156L, -4292963490L, -4297563770L, -4295330580L, -4291660730L, -4294974847L, -4292242908L, -4295852086L, -4293535221L, -4295642297L, -4297161910L, -4295086469L, -4296192825L, -4294191524L, -4294733446L, -4295620353L, -4294421431L, -4295966911L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.DivRefined", Fixed64.DivRefined(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
+	}
+
 	// Fixed32.Div()
 	public static void Fixed32_Div()
 	{
@@ -518,6 +537,15 @@ class UnitTest
 			Util.Check("Fixed64.SqrtFastest", Fixed64.SqrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.SqrtRefined()
+	public static void Fixed64_SqrtRefined()
+	{
+		long[] input0 = new long[]{ 1944096398953121792L, 7152929417042138L, 422418414377L, 589154340L, 1023029861L, 1772103386335115L, 3L, 91L, 547926L, 28108L, 1505537639529L, 90511330L, 16146343975L, 26664779290973L, 13923888138807L, 5737252082822283L, 11494868L, 5728476636673616L, 4205L, 23573938543L, 146107014344192032L, 4250637L, 60063115032027944L, 48604677939873488L, 904874234029L, 8866855083303179L, 4438786326728755712L, 5902L, 700744399L, 5938746L, 1182366547981839L, 493266698064L, 1027474655686L, 153L, 2679127571059172L, 2766226L, 1L, 1L, 797046915L, 1612L, 511986384609385920L, 281319746055928L, 12922222L, 35356L, 56863284138789552L, 4362796288248965632L, 356781836L, 2716638549L, 3503262646L, 4043763483500L, 1297213298L, 41L, 21154L, 8283335971016L, 33821295588210548L, 457365843226L, 549206689759290048L, 40079703807936L, 3002621505398631L, 532081833155L, 1841130392052998L, 2752613033264937L, 603584372376L, 425488094965067584L, 109634370L, 3L, 406248307084383L, 105252970L, 45899116999502288L, 5033531L, 4143877298417514L, 9727406L, 7187126L, 2L, 212340808366L, 519L, 1516968543302503424L, 1698763213912L, 3941902355452913664L, 956495691708L, 24852316L, 1633925988L, 7770108441059L, 799159782897198L, 21112667799288840L, 28692692642785L, 23317842L, 572038912884661120L, 20917L, 5857L, 23227992L, 159306L, 1814L, 6908204503751053L, 4039801L, 186L, 466L, 140058523L, 1487263797882976L, 18630397322390152L };
+		long[] output0 = new long[]{ 91377406692108L, 5542706731985L, 42594286881L, 1590722673L, 2096158342L, 2758826940828L, 113511L, 625173L, 48511073L, 10987399L, 80412902725L, 623492744L, 8327545816L, 338414472222L, 244545791600L, 4964001416662L, 222193794L, 4960203605741L, 4249745L, 10062270870L, 25050446070369L, 135116049L, 16061416959858L, 14448373686486L, 62341039790L, 6171130577224L, 138074045740797L, 5034768L, 1734841282L, 159708233L, 2253491880497L, 46027864782L, 66430189248L, 810635L, 3392162333897L, 108999312L, 65536L, 65536L, 1850213618L, 2631252L, 46893120795001L, 1099208401091L, 235585485L, 12322859L, 15627730024519L, 136887060663670L, 1237887845L, 3415826945L, 3878968741L, 131787070361L, 2360400112L, 419635L, 9531827L, 188617753929L, 12052442012294L, 44321228987L, 48567733849342L, 414898803430L, 3591122549837L, 47804540288L, 2812044598070L, 3438369229215L, 50915372332L, 42748771359096L, 686204075L, 113511L, 1320917557224L, 672352633L, 14040484551045L, 147033503L, 4218745960038L, 204398851L, 175694254L, 92681L, 30199285215L, 1493013L, 80717595866979L, 85417401314L, 130116646516483L, 64094599730L, 326710704L, 2649086386L, 182681037988L, 1852664333283L, 9522511104181L, 351047256840L, 316463850L, 49567009420369L, 9478282L, 5015538L, 315853551L, 26157485L, 2791248L, 5447064568893L, 131722485L, 893791L, 1414727L, 775594466L, 2527399725494L, 8945219237735L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SqrtRefined", Fixed64.SqrtRefined(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.SqrtPrecise()
 	public static void Fixed32_SqrtPrecise()
 	{
@@ -554,6 +582,69 @@ class UnitTest
 			Util.Check("Fixed32.SqrtFastest", Fixed32.SqrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.SqrtRefined()
+	public static void Fixed32_SqrtRefined()
+	{
+		int[] input0 = new int[]{ 3934, 1511870, 75, 1615301, 56, 89, 125538690, 149213782, 9508, 46478, 32268729, 891, 659485, 104, 1971, 4, 53306, 90483906, 451853599, 72582, 6665, 60, 2, 11, 292, 5257, 3, 26586, 16, 90769, 583054992, 35719, 133703593, 169, 102, 6409729, 5924365, 67002, 88296, 16, 1416, 6340488, 61660, 56283489, 43, 7012, 38, 415514542, 1490, 18, 324899710, 4002, 164096825, 177015289, 632, 130, 1477937, 12, 11043, 11627543, 45, 9443, 18007252, 112475073, 85594, 1806, 7157, 7780, 2, 330255, 791, 854252543, 2049, 54432331, 102, 1128860, 1051193, 39, 289045178, 44793395, 273, 10, 35, 985641505, 299978, 291332, 233723, 811021131, 288002199, 843300892, 8, 924120, 12, 8153733, 388972714, 161097718, 378072517, 588642, 1315, 25849684 };
+		int[] output0 = new int[]{ 16056, 314772, 2217, 325361, 1915, 2415, 2868327, 3127119, 24962, 55190, 1454222, 7641, 207894, 2610, 11365, 512, 59105, 2435149, 5441753, 68969, 20899, 1982, 362, 849, 4374, 18561, 443, 41741, 1024, 77127, 6181512, 48382, 2960134, 3328, 2585, 648126, 623104, 66264, 76069, 1024, 9633, 644616, 63568, 1920571, 1678, 21436, 1578, 5218348, 9881, 1086, 4614393, 16194, 3279367, 3406005, 6435, 2918, 311220, 886, 26901, 872939, 1717, 24876, 1086334, 2714989, 74896, 10879, 21657, 22580, 362, 147117, 7199, 7482265, 11588, 1888723, 2585, 271994, 262470, 1598, 4352340, 1713353, 4229, 809, 1514, 8037101, 140211, 138176, 123762, 7290478, 4344480, 7434148, 724, 246095, 886, 731001, 5048932, 3249261, 4977686, 196410, 9283, 1301570 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SqrtRefined", Fixed32.SqrtRefined(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Cbrt()
+	public static void Fixed64_Cbrt()
+	{
+		long[] input0 = new long[]{ 140404945735L, 48026889768448512L, 3076285314L, 3L, 184939548L, 530390287836090624L, 4757617675076469L, 50000511L, 2759593372L, 406L, 109465L, 324590414372209L, 1029917652L, 2L, 284327398862906L, 91812043L, 121269285849286944L, 1L, 1305854314285535L, 89633658930324720L, 11379437L, 92165054616178768L, 30L, 1725811505820695L, 45728433L, 620999973860412L, 266217L, 24969L, 972570L, 10023100678L, 110079344993L, 70593673152238L, 796353161656292992L, 3092L, 90448315537624L, 255928833L, 81329811062830880L, 62737L, 341958L, 17244882025518L, 36309L, 2196784158299555328L, 2199456022952629L, 623227441L, 231835120L, 9085351371793L, 6994034L, 97525701L, 787749962L, 6982446645142L, -5832107452507L, -890183168456136L, -8245L, -15899356476L, -173L, -7025477583271L, -1580911563697847L, -8220400621348L, -304012864415L, -1373402841592L, -1992318128819L, -190537114480L, -51L, -1269704713325017600L, -17014511592L, -7151082431L, -1879705070251161L, -333062L, -106927L, -1110962L, -5206065400L, -1932978508088L, -16886623703751L, -75L, -2468625670657L, -23888734L, -41L, -224796761446L, -7444133L, -23211559876952L, -88789950L, -12588602557486920L, -146177757421040L, -642352169737L, -7925675861794460L, -570277437514721L, -8561830664L, -50087131L, -17L, -12L, -746571440220L, -9893L, -951681363079L, -1148248112542L, -8L, -878812107339L, -42730111892564008L, -7988629547286050L, -168922232099768256L, -149508944437533600L };
+		long[] output0 = new long[]{ 13733060878L, 960435193728L, 3842808906L, 3810778L, 1505392795L, 2138807807488L, 444395639232L, 973415023L, 3706138149L, 19565093L, 126395517L, 181587155584L, 2668337396L, 3329021L, 173745184576L, 1191991374L, 1307846735872L, 2642245L, 288805071360L, 1182488519680L, 594310610L, 1193517144064L, 8210072L, 316935600896L, 944862613L, 225425860480L, 169975032L, 77227792L, 261786266L, 5696926464L, 12663152770L, 109201469984L, 2449110999040L, 38493410L, 118606020352L, 1677566113L, 1144782944256L, 104989972L, 184769738L, 68264249064L, 87493938L, 3434807232000L, 343619923456L, 2256950824L, 1623178610L, 55134123688L, 505299834L, 1216222239L, 2440259624L, 50502062608L, -47560720272L, -254175119488L, -53378959L, -6644052962L, -14722738L, -50605593200L, -307805064192L, -53325822784L, -17766580960L, -29370131064L, -33247536660L, -15204299794L, -9798583L, -2861151064064L, -6795890926L, -5090539792L, -326089249280L, -183153373L, -125411019L, -273656863L, -4579412668L, -32914119780L, -67788212832L, -11142783L, -35710147360L, -760975999L, -9111037L, -16065833128L, -515914751L, -75371651328L, -1178766695L, -614656396800L, -139187535616L, -22798047268L, -526807568000L, -219113229664L, -5405411772L, -973976811L, -6793958L, -6049233L, -23969759812L, -56721701L, -25989849008L, -27668471804L, -5284491L, -25308820900L, -923743241984L, -528198703872L, -1460614226176L, -1402368999168L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Cbrt", Fixed64.Cbrt(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CbrtFast()
+	public static void Fixed64_CbrtFast()
+	{
+		long[] input0 = new long[]{ 1L, 165391600258733L, 1827L, 59343L, 176091602299L, 185977204623597184L, 1377482554306329344L, 30276L, 13L, 44L, 5931302797937158L, 252625539620176L, 64735128L, 3417854149751962624L, 156L, 189537506L, 5L, 1120235364075576L, 521663815085L, 861818690799L, 336965739410401280L, 1L, 90656330737L, 39190044563629384L, 32413250537343556L, 22251L, 9285L, 8062530279337257L, 2244L, 121028L, 2720L, 1723468229886323L, 80463L, 2554051373698481L, 360L, 3L, 24183934458058160L, 95233891421795952L, 63241819L, 293096074999098L, 3L, 1789839L, 652795962L, 20660388018916748L, 511312352L, 24604742382460692L, 10368679052L, 91841871188L, 499205515420L, 97L, -1978601L, -180807642467933L, -40674L, -15900444355L, -32268758273L, -3865499251498871296L, -1824L, -215021L, -8443290L, -7913703L, -20028935916787L, -170L, -13L, -501391057207114L, -74885035186885008L, -3L, -3139620937L, -116888051065L, -9468074232930568L, -49L, -36143311230L, -249L, -17713522L, -8208058474879145L, -273774487681L, -188265895264L, -11051678689L, -20235754166838L, -76645996L, -1L, -9896809020355L, -466252148794L, -16150L, -22L, -282091573961626368L, -69381498L, -42372577568L, -23337294532816L, -79149L, -430L, -8018020725276346L, -112472350818L, -11279239517L, -7L, -14L, -84970449618102128L, -132688L, -6004275446516L, -1272339958502293248L, -148572855L };
+		long[] output0 = new long[]{ 2642245L, 145036821888L, 32301249L, 103061818L, 14810093684L, 1508220784384L, 2939930424320L, 82352360L, 6212730L, 9328130L, 478294116224L, 167031927936L, 1060941944L, 3980064359936L, 14223872L, 1517774742L, 4518222L, 274416958944L, 21270375152L, 25144377556L, 1838662301952L, 2642245L, 11869826396L, 897484841216L, 842457841024L, 74318016L, 55534767L, 529822742080L, 34592063L, 130698855L, 36883703L, 316789823488L, 114071058L, 361172145728L, 18796487L, 3810762L, 764106029184L, 1206633767936L, 1052719682L, 175511374880L, 3810762L, 320804770L, 2292109332L, 725022323840L, 2112874825L, 768511396352L, 5761694041L, 11921337884L, 20960487136L, 12140259L, -331714221L, -149411454208L, -90869101L, -6644257478L, -8412114731L, -4146711433216L, -32283547L, -158293012L, -538033524L, -526547951L, -71755844992L, -14637307L, -6212730L, -209909378304L, -1113697005568L, -3810762L, -3869002166L, -12918913718L, -558970374656L, -9668715L, -8735964640L, -16623059L, -688762964L, -532993703552L, -17156891512L, -15143786022L, -5885559213L, -72002114304L, -1122366571L, -2642245L, -56728615424L, -20488465088L, -66788318L, -7403742L, -1732901955840L, -1085717717L, -9211674640L, -75508366848L, -113446445L, -19943046L, -528845306560L, -12754106086L, -5925681514L, -5054412L, -6368160L, -1161618066432L, -134766447L, -48024655656L, -2863102795776L, -1399423671L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.CbrtFast", Fixed64.CbrtFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CbrtFastest()
+	public static void Fixed64_CbrtFastest()
+	{
+		long[] input0 = new long[]{ 5833L, 6068863L, 3932360661515449344L, 3118776939947151872L, 716L, 4L, 6156867530810478L, 243L, 45L, 40362356823651L, 605145607705017L, 3004199298914L, 328675859226L, 6188131L, 67407745813682L, 67569045206201152L, 48697384L, 76263990894L, 11422888895L, 3250869L, 497457378805348992L, 368544108230L, 4215819549760818L, 70585541L, 342L, 198901170L, 7194540948800595L, 9776L, 1L, 8497788586L, 289100L, 1385470072276393L, 30608191622798L, 2131344618641584L, 88773L, 13035L, 63288L, 3571182L, 160803L, 2262160L, 91170777471L, 37221177407664L, 740177336L, 2L, 18850581322558L, 2L, 4435923868689897472L, 265L, 17110L, 33569L, -59478L, -340295000603L, -31350690387590L, -19935903586015L, -3959905L, -72998316996L, -6638731620L, -55710569090L, -9103362832144574L, -16617691214315L, -2802L, -629732970662L, -225L, -24825172837L, -139613388L, -2014292184298631168L, -452637779915559552L, -711170709480702L, -69L, -5170944601L, -1067643233677L, -13L, -474266L, -5049L, -164438538487447L, -13364L, -497L, -1823003410490699L, -17268345585696L, -128L, -206782120L, -27122971819895L, -2635103849080408064L, -148069131832613L, -142870L, -3917902393556L, -44L, -1L, -538231243L, -5608257354357L, -9055543855248L, -5238944122941L, -1809130508L, -44625785516L, -807L, -667665533396751104L, -164828203209L, -137500169504646720L, -76388361704L, -43158069619746L };
+		long[] output0 = new long[]{ 47567800L, 482006113L, 4170416125952L, 3860699365888L, 23640179L, 4194304L, 484314761344L, 16486712L, 9399070L, 90627842416L, 223469450496L, 38128567328L, 18233651904L, 485142667L, 107523910800L, 1076083123328L, 964980859L, 11203917582L, 5951009027L, 391447098L, 2093504159744L, 18945152048L, 426799377216L, 1091883711L, 18478881L, 1542511378L, 510108871296L, 56494211L, 2642245L, 5391729788L, 174694437L, 294552744960L, 82647601344L, 340002817024L, 117877790L, 62187137L, 105288178L, 403862077L, 143679229L, 346821008L, 11892768440L, 88212956528L, 2390315706L, 3329021L, 70313774144L, 3329021L, 4341085964288L, 16970483L, 68080741L, 85231166L, -103130163L, -18446701600L, -83308435840L, -71638274496L, -417983403L, -11041768746L, -4966333092L, -10091774192L, -551692411392L, -67419848776L, -37253238L, -22645810928L, -16069665L, -7708694332L, -1370624868L, -3336745650688L, -2028861435648L, -235849192960L, -10836292L, -4568889580L, -27003373464L, -6213004L, -206035413L, -45328007L, -144747087744L, -62704320L, -20928007L, -322788573952L, -68291765760L, -13316085L, -1562593812L, -79393933760L, -3649228246016L, -139773832064L, -138115858L, -41650918048L, -9328823L, -2642245L, -2149283174L, -46945083336L, -55070684792L, -45887815568L, -3219522845L, -9372403848L, -24601329L, -2309184602112L, -14486479096L, -1363644960768L, -11210008232L, -92679397376L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.CbrtFastest", Fixed64.CbrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Cbrt()
+	public static void Fixed32_Cbrt()
+	{
+		int[] input0 = new int[]{ 18802, 735, 219, 3110266, 5, 18, 12678092, 7367484, 85417365, 297, 56588451, 7662, 249105, 5145177, 97681323, 51796426, 77674465, 13235022, 66, 24685380, 837173, 53391, 127800, 10, 83680512, 2, 2478075, 259583, 4, 598614, 1757461, 16992062, 5076942, 15844155, 60631205, 13639, 3, 23547, 2, 11644636, 1860594, 380, 320, 2, 96439, 211628, 77258, 76101, 2313824, 417894614, -3103312, -46398171, -72611419, -560227, -42737489, -378139387, -6181121, -43, -39909209, -4, -7919, -97, -3456155, -285, -181696, -6, -1620649, -16881622, -91117973, -14323, -33296207, -6597, -9663298, -6096, -26, -4400, -333, -94394, -113329, -790, -36240, -65, -120461186, -10, -207119593, -40670989, -251270227, -18, -398070474, -172164719, -2369320, -77433844, -633522, -644806521, -2940, -38095, -118219, -2, -16001, -28958 };
+		int[] output0 = new int[]{ 43223, 14669, 9797, 237275, 2779, 4260, 379027, 316295, 715871, 10845, 624064, 32045, 102277, 280620, 748612, 605926, 693552, 384498, 6569, 473296, 153199, 61208, 81877, 3502, 710986, 2048, 219967, 103692, 2580, 136994, 196162, 417896, 279374, 408265, 638584, 38837, 2344, 46590, 2048, 368435, 199926, 11773, 11118, 2048, 74542, 96867, 69231, 68883, 214995, 1215277, -237098, -584099, -678143, -134000, -568315, -1175449, -298315, -5694, -555491, -2580, -32399, -7468, -245763, -10697, -92066, -2953, -190933, -416989, -731455, -39475, -522939, -30486, -346227, -29693, -4815, -26636, -11266, -74011, -78662, -15026, -53791, -6535, -802790, -3502, -961745, -559003, -1025731, -4260, -1195748, -904276, -216701, -692835, -139606, -1404310, -23286, -54694, -79777, -2048, -40960, -49916 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Cbrt", Fixed32.Cbrt(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CbrtFast()
+	public static void Fixed32_CbrtFast()
+	{
+		int[] input0 = new int[]{ 397, 508, 40491, 6, 2497049, 565, 59059, 20559, 1099582, 3, 3, 2926, 416619, 65131826, 231, 71, 59, 23623864, 2, 30284188, 728485, 32429236, 12901228, 109, 213, 986695, 19190, 14496012, 153226, 2, 8341, 1187979, 352732, 6291, 958299, 49, 9043994, 8, 15, 3, 19562618, 132950278, 2891000, 163841452, 16474, 40969, 6122, 4, 439, 13011378, -2348549, -162, -731, -7900, -28043303, -13171, -42300, -739, -34358501, -5, -31624621, -4374645, -144071951, -846757, -389279, -3297, -8909068, -132, -135, -9, -8495, -14, -3016420, -795841299, -3, -5883444, -22, -84548739, -7139486, -5608498, -322, -8684, -65924, -12644727, -1187, -102, -3247, -89, -240896, -145, -1259878, -24467, -259, -6, -104, -8, -990854035, -6, -841, -9 };
+		int[] output0 = new int[]{ 11946, 12970, 55818, 2953, 220528, 13437, 63301, 44530, 167773, 2344, 2344, 23249, 121402, 654017, 9973, 6730, 6328, 466415, 2048, 506671, 146261, 518366, 381235, 7764, 9707, 161827, 43518, 396338, 86982, 2048, 32965, 172155, 114852, 30007, 160259, 5948, 338663, 3250, 4008, 2344, 437988, 829631, 231565, 889469, 41360, 56037, 29736, 2580, 12353, 382317, -216064, -8861, -14642, -32374, -493846, -38387, -56637, -14696, -528438, -2779, -514043, -265845, -852134, -153780, -118687, -24192, -336970, -8276, -8338, -3381, -33166, -3917, -234865, -1506356, -2344, -293449, -4554, -713444, -312995, -288806, -11141, -33410, -65664, -378693, -17210, -7594, -24069, -7257, -101142, -8539, -175562, -47189, -10361, -2953, -7644, -3250, -1620539, -2953, -15343, -3381 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.CbrtFast", Fixed32.CbrtFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CbrtFastest()
+	public static void Fixed32_CbrtFastest()
+	{
+		int[] input0 = new int[]{ 9, 219, 776442127, 2508913, 26275, 307195719, 130, 4, 1482, 1912, 265, 9080600, 62, 163144587, 13320, 29369464, 192028850, 6, 693081, 6, 2, 17, 641913, 20470, 207297, 803, 7265542, 18073299, 210, 208, 412239096, 52, 140518, 703594, 190449633, 3, 5, 14782679, 607182, 25879807, 1032618570, 67311622, 508, 17338571, 3472634, 1135, 29, 55, 5, 812601, -2733, -4166, -21036, -839, -13, -580617821, -367228, -75858, -24, -65, -84, -7773, -21766608, -14, -4982, -10, -129, -94764, -919797864, -7296, -9801821, -25, -11214, -28755655, -7, -37, -36204154, -39752349, -6329549, -365, -53, -260194, -7074550, -278657, -82050713, -197866, -2696195, -334, -101157, -352200242, -10675, -84822, -1221410, -18575, -612088, -265670, -6, -71, -6960, -692118 };
+		int[] output0 = new int[]{ 3380, 9797, 1494169, 220864, 48326, 1096698, 8234, 2580, 18534, 20173, 10440, 339090, 6433, 888169, 38533, 501487, 937889, 2954, 143859, 2954, 2048, 4179, 140216, 44465, 96207, 15109, 314815, 426537, 9662, 9631, 1209871, 6067, 84499, 144584, 935309, 2344, 2779, 398910, 137633, 480848, 1642846, 661221, 12969, 420692, 246156, 16954, 4993, 6181, 2779, 151697, -22727, -26154, -44872, -15331, -3822, -1355940, -116414, -68804, -4689, -6535, -7119, -32196, -453870, -3917, -27761, -3502, -8213, -74115, -1580774, -31524, -347849, -4753, -36386, -497981, -3109, -5416, -537688, -554729, -300712, -11617, -6105, -103770, -312042, -106162, -706320, -94729, -226246, -11278, -75744, -1147986, -35792, -71422, -173743, -43045, -138004, -104493, -2954, -6730, -31034, -143792 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.CbrtFastest", Fixed32.CbrtFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.RSqrt()
 	public static void Fixed64_RSqrt()
 	{
@@ -716,6 +807,60 @@ class UnitTest
 			Util.Check("Fixed32.Exp2Fastest", Fixed32.Exp2Fastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.Exp10()
+	public static void Fixed64_Exp10()
+	{
+		long[] input0 = new long[]{ -19082731148L, 57538896206L, -49865172443L, -118430050675L, -5534504822L, -84230047059L, -97673840985L, 55595371045L, 78952830096L, -73492260L, -63330421049L, -77317366896L, 112970175592L, -1350293340L, 64750935570L, -88271573381L, -111003686511L, 32472744435L, 34562177836L, 51193593683L, 91979617782L, 25646143871L, -104632055268L, -124301361837L, 49834145603L, 66073624410L, 7318642743L, 65500425210L, 74853133654L, 8841483064L, -35264475076L, -38127072437L, -68629332451L, -14044890066L, 2087089L, 505L, 300480863L, 135013096L, 126252387L, 23122L, 2012577485L, 149L, 1L, 967120L, 101169L, 748278L, 22798L, 100560211L, 3156L, 14343631L, 6L, 112239L, 7L, 17L, 278L, 226602891L, 2303222L, 832L, 3226L, 19986238L, 3299266L, 5109L, 2262326148L, 563L, 24L, 1322197497L, 5878002025L, 96181L, -620305400L, -77887L, -1675L, -478L, -217701698L, -111L, -74098663L, -3087888L, -918252L, -118764L, -192063L, -13L, -1946L, -28172314L, -13353L, -6L, -38425L, -538850879L, -496L, -13L, -114L, -118674305L, -2829077L, -361006L, -41848L, -6L, -90303688L, -393885L, -850L, -28687219L, -40258L, -985905L };
+		long[] output0 = new long[]{ 154851L, 9223372036854775807L, 0L, 0L, 220982306L, 0L, 0L, 9223372036854775807L, 9223372036854775807L, 4129035820L, 0L, 0L, 9223372036854775807L, 2082429137L, 9223372036854775807L, 0L, 0L, 156174402768076800L, 478733625064423424L, 9223372036854775807L, 9223372036854775807L, 4019462994919424L, 0L, 0L, 9223372036854775807L, 9223372036854775807L, 217252177920L, 9223372036854775807L, 9223372036854775807L, 491505117184L, 26L, 5L, 0L, 2306104L, 4299775712L, 4294968456L, 5045694756L, 4617374076L, 4595738440L, 4295020532L, 12634253768L, 4294967636L, 4294967296L, 4297194760L, 4295200252L, 4296690624L, 4295019788L, 4532871316L, 4294974560L, 4328122220L, 4294967304L, 4295225744L, 4294967308L, 4294967332L, 4294967932L, 4849756428L, 4300273968L, 4294969208L, 4294974720L, 4341234976L, 4302570904L, 4294979056L, 14444372304L, 4294968588L, 4294967348L, 8725854888L, 100354969408L, 4295188764L, 3079879960L, 4294787952L, 4294963430L, 4294966190L, 3821837532L, 4294967030L, 4127693686L, 4287863082L, 4292853466L, 4294693832L, 4294525076L, 4294967258L, 4294962806L, 4230585816L, 4294936544L, 4294967274L, 4294878812L, 3217354208L, 4294966148L, 4294967258L, 4294967024L, 4030221142L, 4288458066L, 4294136128L, 4294870930L, 4294967274L, 4091988772L, 4294060436L, 4294965332L, 4229418140L, 4294874592L, 4292697770L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Exp10", Fixed64.Exp10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Exp10Fast()
+	public static void Fixed64_Exp10Fast()
+	{
+		long[] input0 = new long[]{ -6909195423L, 60332623048L, -112697709592L, -66238931730L, -28631941753L, 7038450423L, 41393451799L, -94486512103L, -103597165668L, 32005212434L, -26501769672L, 122978178117L, -3121862221L, 3754618141L, -57358638806L, 46464155841L, -107528183390L, -30253684034L, -5276854862L, -46144858521L, 91738842702L, -37898583197L, -79252178496L, -39881527758L, -69249157532L, 19785946149L, 28184988793L, -17636174588L, 21305615109L, 94878450224L, -3223288981L, 3201070861L, 109523816151L, 21070149669L, 80L, 402822078L, 732545L, 2243L, 1L, 518671601L, 1316651L, 11L, 11951477L, 76127L, 199283L, 231L, 5367273989L, 12662288431L, 125L, 3L, 2115L, 603998L, 25989359L, 265446814L, 24198166L, 16L, 299384L, 17919934L, 1L, 162381693L, 1907454728L, 206L, 369225L, 210L, 24L, 880584449L, 3L, 1448683035L, -1990L, -20403L, -10L, -39416571L, -5390L, -1750677L, -17190276L, -37738240L, -3988892L, -14939559L, -199989947L, -12119287895L, -1627854L, -1473570L, -183L, -212943L, -283103L, -1809793615L, -75146956L, -8L, -405479772L, -4L, -1345L, -526719403L, -1709L, -108L, -3503638961L, -6362L, -417034L, -56753L, -3158L, -2915952L };
+		long[] output0 = new long[]{ 105751374L, 9223372036854775807L, 0L, 0L, 925L, 186950735744L, 9223372036854775807L, 0L, 0L, 121549598010376192L, 2900L, 9223372036854775807L, 805551641L, 32147813888L, 0L, 9223372036854775807L, 0L, 388L, 253715965L, 0L, 9223372036854775807L, 6L, 0L, 2L, 0L, 173674429808640L, 15677943397220352L, 336294L, 392247184719872L, 9223372036854775807L, 762919873L, 23892807536L, 9223372036854775807L, 345730584674304L, 4294967476L, 5330287508L, 4296654092L, 4294972456L, 4294967296L, 5671832692L, 4297999564L, 4294967320L, 4322570780L, 4295142556L, 4295426104L, 4294967824L, 76317704192L, 3811787483136L, 4294967580L, 4294967300L, 4294972160L, 4296358044L, 4355220796L, 4951816660L, 4351041000L, 4294967332L, 4295656592L, 4336422372L, 4294967296L, 4685613036L, 11941907848L, 4294967768L, 4295817408L, 4294967776L, 4294967348L, 6886294520L, 4294967300L, 9338060992L, 4294962710L, 4294920318L, 4294967268L, 4205168476L, 4294954882L, 4290938624L, 4255571664L, 4208953606L, 4285793516L, 4260709152L, 3858308308L, 6474657L, 4291221142L, 4291576052L, 4294966872L, 4294477064L, 4294315558L, 1627732680L, 4125386936L, 4294967272L, 3455814854L, 4294967280L, 4294964196L, 3238337556L, 4294963356L, 4294967044L, 656457715L, 4294952644L, 4294007268L, 4294836630L, 4294960020L, 4288259174L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Exp10Fast", Fixed64.Exp10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Exp10Fastest()
+	public static void Fixed64_Exp10Fastest()
+	{
+		long[] input0 = new long[]{ -51406742123L, 91447067262L, -53656859844L, 56233547846L, -16009689187L, 73111007614L, -88101919061L, 112180308712L, -1125427260L, -84666899259L, -122620596837L, 114587272793L, 95796705464L, -24924875231L, -22305988750L, -69528888212L, -103668864708L, -16390604107L, 60153968008L, -54304466365L, 126464990878L, 14435115186L, -61434162688L, -91397155302L, -41288686399L, -83077101098L, -48450935962L, 27068252832L, 42964273400L, -10057085704L, 48155314642L, 30934580954L, -119585478235L, 41181558439L, 2266L, 1404362107L, 19653099L, 26616L, 7933812L, 397L, 173031342L, 243L, 15L, 279356260L, 1850155L, 19477607L, 1957833250L, 2858376169L, 10551191L, 28L, 24808L, 248L, 11L, 721220L, 1882905L, 33647674L, 995128L, 30L, 6699L, 427L, 58769L, 390564L, 519L, 2L, 79279L, 12183L, 1538616982L, 138L, -5L, -138844L, -139288L, -4707709L, -41937156L, -65363L, -62590L, -42701170L, -26473L, -20359L, -205208L, -1801925L, -411L, -6429L, -1598708938L, -192568L, -1L, -35383L, -167234L, -41251L, -2L, -868054L, -1411L, -649820L, -3L, -18547L, -87218472L, -443L, -6035160865L, -7L, -3523L, -151L };
+		long[] output0 = new long[]{ 0L, 9223372036854775807L, 0L, 9223372036854775807L, 804255L, 9223372036854775807L, 0L, 9223372036854775807L, 2349464232L, 0L, 0L, 9223372036854775807L, 9223372036854775807L, 6756L, 27508L, 0L, 0L, 655699L, 9223372036854775807L, 0L, 9223372036854775807L, 9861264736256L, 0L, 0L, 1L, 0L, 0L, 8616138330079232L, 9223372036854775807L, 19560454L, 9223372036854775807L, 68472352001753088L, 0L, -1799861785474367488L, 4294972528L, 9119733136L, 4340594660L, 4295028780L, 4313332264L, 4294968208L, 4712910184L, 4294967852L, 4294967328L, 4989090028L, 4299243420L, 4340185224L, 12267655600L, 19883742720L, 4319407040L, 4294967356L, 4295024604L, 4294967864L, 4294967320L, 4296633720L, 4299319148L, 4373362692L, 4297266764L, 4294967360L, 4294982768L, 4294968280L, 4295103060L, 4295869644L, 4294968492L, 4294967296L, 4295150440L, 4294995436L, 9799975616L, 4294967612L, 4294967280L, 4294648398L, 4294647378L, 4284167496L, 4199679874L, 4294817166L, 4294823534L, 4197963032L, 4294906488L, 4294920532L, 4294495984L, 4290830456L, 4294966348L, 4294952526L, 1822885288L, 4294525012L, 4294967290L, 4294886026L, 4294583196L, 4294872544L, 4294967288L, 4292973946L, 4294964054L, 4293475000L, 4294967286L, 4294924694L, 4099093868L, 4294966276L, 168953080L, 4294967278L, 4294959200L, 4294966946L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Exp10Fastest", Fixed64.Exp10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Exp10()
+	public static void Fixed32_Exp10()
+	{
+		int[] input0 = new int[]{ -598336, 313999, -262985, -1638492, -1515546, -1141110, 142177, -946753, 1782873, 67298, 170919, -50927, 383399, -1479430, -1584183, 1898170, -1697363, 1205459, -1279895, -640529, -669145, -1012672, 1124725, -1731638, 995414, -1124823, 1558897, -431202, -1578537, 1156090, 1630648, -741249, 257684, 739288, 1375, 97795, 2, 12888, 393, 123366, 21, 1735, 131858, 37, 288, 17, 17, 36451, 1888, 681, 259, 329, 3256, 3, 71737, 6, 18375, 146, 89, 62735, 73, 10, 12, 12, 2035, 28, 79755, 69460, -1185, -12, -137814, -66, -108, -23, -9, -10045, -48, -900, -2705, -1287, -2, -3, -18507, -1790, -142, -448, -4335, -740, -14922, -409, -10, -3140, -289, -1234, -3363, -3, -273, -21100, -3603, -20 };
+		int[] output0 = new int[]{ 0, 2147483647, 6, 0, 0, 0, 9681190, 0, 2147483647, 697213, 26576444, 10949, 2147483647, 0, 0, 2147483647, 0, 2147483647, 0, 0, 0, 0, 2147483647, 0, 2147483647, 0, 2147483647, 0, 0, 2147483647, 2147483647, 0, 560306640, 2147483647, 68779, 2035697, 65540, 103070, 66447, 4999144, 65584, 69655, 6737104, 65621, 66202, 65575, 65575, 235872, 70030, 67122, 66135, 66297, 73478, 65542, 814891, 65549, 124985, 65873, 65741, 593936, 65704, 65559, 65563, 65563, 70393, 65600, 1080052, 752238, 62863, 65508, 517, 65384, 65287, 65483, 65515, 46047, 65425, 63496, 59594, 62638, 65531, 65529, 34204, 61541, 65209, 64512, 56277, 63854, 38796, 64600, 65512, 58690, 64873, 62755, 58232, 65529, 64910, 31226, 57743, 65489 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Exp10", Fixed32.Exp10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Exp10Fast()
+	public static void Fixed32_Exp10Fast()
+	{
+		int[] input0 = new int[]{ 548770, -741508, 1254089, -1761985, 774616, 1300093, -1459393, -685110, 1494413, 405690, -616914, 1913415, -1038613, 1411584, -563269, -891113, -1826626, -966805, 266281, 1597904, 188157, -548730, -1826607, -1388547, 28740, 1351329, -226533, 675406, 1086517, -1530419, 491402, 1844456, 436230, -662628, 878, 13291, 75873, 58, 97558, 12796, 11070, 2, 2, 496, 489, 78114, 223, 60, 1495, 85, 65, 1619, 109987, 115, 104, 49, 47, 4532, 1047, 36421, 173, 382, 1107, 13854, 153029, 147, 150, 65496, -88, -1787, -120, -10119, -74, -20985, -12, -833, -89, -1189, -4342, -1716, -291, -10, -6, -350, -21375, -3, -2, -38, -169647, -35, -557, -33, -10968, -5, -147, -57, -463, -39, -638, -6 };
+		int[] output0 = new int[]{ 2147483647, 0, 2147483647, 0, 2147483647, 2147483647, 0, 0, 2147483647, 2147483647, 0, 2147483647, 0, 2147483647, 0, 0, 0, 0, 757888264, 2147483647, 48699785, 0, 0, 0, 179894, 2147483647, 22, 2147483647, 2147483647, 0, 2147483647, 2147483647, 2147483647, 0, 67588, 104540, 942347, 65669, 2018822, 102737, 96692, 65540, 65540, 66687, 66671, 1019544, 66051, 65674, 69070, 65731, 65685, 69371, 3124259, 65801, 65775, 65648, 65644, 76848, 67991, 235624, 65935, 66421, 68134, 106628, 14174790, 65875, 65882, 654441, 65333, 61547, 65260, 45927, 65365, 31352, 65508, 63645, 65331, 62854, 56263, 61701, 64869, 65512, 65522, 64735, 30926, 65529, 65531, 65448, 168, 65455, 64266, 65460, 44578, 65524, 65198, 65404, 64478, 65446, 64083, 65522 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Exp10Fast", Fixed32.Exp10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Exp10Fastest()
+	public static void Fixed32_Exp10Fastest()
+	{
+		int[] input0 = new int[]{ 1381802, 290827, 1685014, -1487957, -1620149, -1803818, 557974, 1827377, -1526572, -524046, -1146974, 1662798, 1853831, 462683, 91793, -81191, 981688, -1253631, 125984, -775945, 243157, 137149, 344308, -59916, 1077655, -1608051, -451820, 858047, -1668434, -1614902, -748333, -1822627, -581053, -191805, 374, 132, 100, 5143, 107537, 10, 18, 25624, 118, 8, 11493, 1580, 197, 258, 13092, 17503, 14891, 134, 20, 1381, 463, 76, 168150, 328, 108, 189775, 3775, 81772, 54901, 2, 3, 14, 1412, 791, -12, -12, -9, -4, -29, -177, -6, -9794, -15, -402, -9002, -18, -5659, -127451, -115696, -53, -73, -103152, -29080, -16328, -151842, -9, -155, -59938, -94, -111409, -532, -45, -91763, -91, -4, -1594 };
+		int[] output0 = new int[]{ 2147483647, 1795432853, 2147483647, 0, 0, 0, 2147483647, 2147483647, 0, 0, 0, 2147483647, 2147483647, 2147483647, 1648624, 3781, 2147483647, 0, 5480324, 0, 336310222, 8114011, 2147483647, 7984, 2147483647, 0, 0, 2147483647, 0, 0, 0, 0, 0, 77, 66405, 65841, 65767, 78515, 2866288, 65559, 65577, 161234, 65809, 65554, 98134, 69283, 65992, 66134, 103811, 121226, 110592, 65846, 65582, 68800, 66613, 65711, 24110409, 66297, 65785, 51546337, 74835, 1159476, 451061, 65540, 65542, 65568, 68875, 67387, 65508, 65508, 65515, 65526, 65469, 65130, 65522, 46450, 65501, 64618, 47762, 65494, 53720, 744, 1124, 65414, 65368, 1747, 23589, 36929, 315, 65515, 65180, 7978, 65320, 1307, 64325, 65432, 2607, 65327, 65526, 61972 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Exp10Fastest", Fixed32.Exp10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Log()
 	public static void Fixed64_Log()
 	{
@@ -797,6 +942,15 @@ class UnitTest
 			Util.Check("Fixed64.Log2Fastest", Fixed64.Log2Fastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.Log2Ultra()
+	public static void Fixed64_Log2Ultra()
+	{
+		long[] input0 = new long[]{ 5794610817536817L, 620248846631147L, 11499960526L, 14946895L, 142236039983L, 1889642901023551L, 2153176793341615872L, 25025670812094840L, 61491613978432096L, 378781L, 465L, 4227793706L, 1782420032942243328L, 445L, 453L, 242655526L, 1347646440732L, 1431947881L, 27675951189001216L, 2141801287987L, 81537911393763664L, 2158530580816537L, 21327030715582L, 52746991724577L, 1L, 38187328222301104L, 3783389L, 157484L, 7975456L, 1027L, 8559L, 517753921L, 390969833835L, 522701074611353L, 44265800570699L, 1L, 816057487L, 250794377L, 1689L, 1125176601L, 825836L, 19947L, 4537876394037493L, 15L, 32496918714770L, 8222017704367L, 434012886L, 1582097698748680L, 1L, 129819275089L, 4292889509L, 4296180429L, 4297708272L, 4297969068L, 4292581529L, 4290869519L, 4291345337L, 4297575723L, 4293836581L, 4296761866L, 4294673625L, 4296716233L, 4295040951L, 4297011456L, 4291429173L, 4296477705L, 4298356599L, 4292296941L, 4294198980L, 4291888322L, 4299019602L, 4292387785L, 4293398841L, 4294071885L, 4293622345L, 4296474802L, 4299113599L, 4296263254L, 4290769047L, 4293452132L, 4294326601L, 4295292200L, 4293010871L, 4297322404L, 4298428853L, 4295559966L, 4296233712L, 4297298128L, 4295533523L, 4296753694L, 4298593584L, 4296457193L, 4291371172L, 4294654405L, 4290834507L, 4295937746L, 4296868767L, 4291536739L, 4299046204L, 4291083427L };
+		long[] output0 = new long[]{ 87461131824L, 73615052228L, 6102756108L, -35075528788L, 21687417960L, 80517898624L, 124129589424L, 96526198552L, 102096693772L, -57848897420L, -99380875004L, -97676849L, 122958652740L, -99653284936L, -99542879736L, -17805499912L, 35620645860L, -6806104328L, 97149933048L, 38491330000L, 103845087876L, 81342258756L, 52732520336L, 58343493824L, -137438953472L, 99144773008L, -43588561236L, -63287013616L, -38967658200L, -94471162572L, -81332833520L, -13109568164L, 27952788636L, 72554791012L, 57257313940L, -137438953472L, -10290333536L, -17601080740L, -91388516612L, -8300014124L, -53019245368L, -76090145172L, 85946325148L, -120658986136L, 55342233528L, 46826434360L, -14202759860L, 79417205224L, -137438953472L, 21121416152L, -2998339L, 1749933L, 3953131L, 4329128L, -3442891L, -5914665L, -5227587L, 3762022L, -1631492L, 2588476L, -423693L, 2522669L, 106260L, 2948397L, -5106537L, 2178676L, 4887802L, -3853707L, -1108545L, -4443614L, 5843485L, -3722566L, -2263216L, -1291940L, -1940659L, 2174489L, 5978965L, 1869390L, -6059756L, -2186306L, -924397L, 468719L, -2823168L, 3396771L, 4991959L, 854983L, 1826782L, 3361767L, 816839L, 2576691L, 5229420L, 2149094L, -5190284L, -451423L, -5965225L, 1399905L, 2742635L, -4951226L, 5881827L, -5605774L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Log2Ultra", Fixed64.Log2Ultra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Log2()
 	public static void Fixed32_Log2()
 	{
@@ -824,12 +978,75 @@ class UnitTest
 			Util.Check("Fixed32.Log2Fastest", Fixed32.Log2Fastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.Log2Ultra()
+	public static void Fixed32_Log2Ultra()
+	{
+		int[] input0 = new int[]{ 2641858, 734, 816510, 3704737, 21, 2626558, 2759641, 404839, 51, 9, 17377, 5564, 8407, 189368, 5343, 121, 450, 7746525, 2, 159365, 8899793, 371293, 1784, 145888057, 151055, 59173, 113528570, 81589, 7537210, 193596393, 609105187, 338164621, 28, 35, 2529, 2155, 312, 3496, 751, 3, 1948499, 982, 57164368, 8, 5693989, 8, 208149743, 87366, 141884, 273, 65563, 65492, 65507, 65506, 65520, 65483, 65595, 65567, 65491, 65549, 65576, 65493, 65582, 65502, 65483, 65537, 65504, 65506, 65498, 65476, 65595, 65588, 65530, 65597, 65585, 65529, 65568, 65505, 65491, 65534, 65548, 65517, 65597, 65537, 65497, 65575, 65557, 65582, 65570, 65504, 65521, 65537, 65498, 65560, 65498, 65537, 65529, 65550, 65597, 65500 };
+		int[] output0 = new int[]{ 349511, -424698, 238492, 381481, -760722, 348962, 353635, 172162, -676828, -840832, -125509, -233184, -194159, 100324, -237016, -595142, -470957, 451223, -983040, 84015, 464344, 163983, -340729, 728778, 78952, -9657, 705067, 20714, 448633, 755530, 863903, 808265, -733522, -712424, -307735, -322866, -505584, -277120, -422533, -944704, 320728, -397176, 640195, -851968, 422117, -851968, 762383, 27183, 73030, -518210, 38, -64, -42, -44, -24, -77, 85, 44, -65, 18, 57, -63, 66, -50, -77, 1, -47, -44, -55, -87, 85, 74, -9, 87, 70, -11, 46, -45, -65, -3, 17, -28, 87, 1, -57, 56, 30, 66, 49, -47, -22, 1, -55, 34, -55, 1, -11, 20, 87, -52 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Log2Ultra", Fixed32.Log2Ultra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Log10()
+	public static void Fixed64_Log10()
+	{
+		long[] input0 = new long[]{ 9283034487181L, 1196188584663501L, 1287557203L, 705L, 105394258276012384L, 159527L, 1224625979922709760L, 1381250481722032640L, 1987L, 2059558677126528L, 50628272155461272L, 1508383018295L, 11720390525824L, 13657236217L, 21697047817L, 117530391155769904L, 399930086L, 14701332L, 2138629157L, 128868929836L, 27088386643973208L, 163L, 1479684151L, 678136L, 58648367L, 220581561025466L, 1185955660675170L, 160064175L, 169582762L, 2755900194062391296L, 131628L, 6159288226925426L, 1852362378421144064L, 128011759L, 2084429841L, 1985033553118879L, 406L, 20732552L, 2323627L, 75718895L, 480704357002L, 1596922417152492L, 3892837353L, 77L, 50547864680L, 158941818747560672L, 658162L, 306876210768233344L, 81302507279L, 1375571L, 4293931388L, 4297372691L, 4298727632L, 4297449181L, 4295928286L, 4295619915L, 4293389423L, 4292179972L, 4296996281L, 4291904381L, 4294716944L, 4295219109L, 4295231620L, 4292291917L, 4295362124L, 4291092988L, 4296457848L, 4292954242L, 4291047701L, 4296977145L, 4297326327L, 4291263344L, 4291040719L, 4291339495L, 4298998872L, 4291237670L, 4295864965L, 4294022230L, 4297018118L, 4294918639L, 4294593888L, 4298150775L, 4298015864L, 4291633798L, 4295896225L, 4294914431L, 4298472782L, 4292300342L, 4297734325L, 4298600979L, 4294991938L, 4298954020L, 4296302151L, 4292367850L, 4298841466L, 4291499177L, 4293106377L, 4293463406L, 4295436789L, 4295175444L };
+		long[] output0 = new long[]{ 14322556722L, 23385408828L, -2247098236L, -29140368450L, 31739194508L, -19027244834L, 36314135764L, 36538629296L, -27207595584L, 24398911656L, 30371574506L, 10933061608L, 14757431262L, 2157804278L, 3021255160L, 31942489188L, -4428007280L, -10589685006L, -1300620796L, 6344475696L, 29205018584L, -31871974146L, -1987671524L, -16327932614L, -8008842422L, 20231913066L, 23369383440L, -6136072546L, -6028322282L, 37827081014L, -19385814114L, 26442269652L, 37086037948L, -6552874540L, -1348501964L, 24330165048L, -30169713556L, -9948463232L, -14030771014L, -7532322920L, 8800036644L, 23924359208L, -183367630L, -33270831588L, 4598805958L, 32505507842L, -16383698454L, 33732687564L, 5485292040L, -15008663784L, -449946L, 1044356L, 1632376L, 1077556L, 417304L, 283404L, -685390L, -1210914L, 880968L, -1330682L, -108738L, 109356L, 114788L, -1162266L, 171460L, -1683350L, 647224L, -874470L, -1703034L, 872660L, 1024228L, -1609302L, -1706074L, -1576206L, 1750068L, -1620462L, 389808L, -410486L, 890444L, -21130L, -162182L, 1382052L, 1323504L, -1448290L, 403384L, -22962L, 1521788L, -1158606L, 1201316L, 1577416L, 10700L, 1730608L, 579628L, -1129274L, 1681768L, -1506798L, -808370L, -653250L, 203884L, 90392L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Log10", Fixed64.Log10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Log10Fast()
+	public static void Fixed64_Log10Fast()
+	{
+		long[] input0 = new long[]{ 445748104507L, 13L, 73710L, 142193L, 7587954920561L, 675979954358004L, 10609260499150966L, 28212626L, 2776879445499L, 17052647770766L, 888467713951L, 60727245920086384L, 632786L, 115L, 109357577981112L, 3099L, 188146912229L, 52684L, 49024633458172528L, 115940500L, 759620945183613L, 1373L, 16366L, 197917L, 1128459402403168L, 54178586045693352L, 199777287487884640L, 21201208215972L, 64179153281997168L, 2L, 3083829363402261504L, 732900L, 192L, 5744968685440666L, 220L, 111520903594L, 13881177L, 463437852956L, 1300761L, 1624047L, 128373L, 433530012L, 1L, 113535964592L, 911L, 16L, 464501602855221L, 150L, 54L, 4036773801887L, 4295260772L, 4297062632L, 4293974870L, 4296959284L, 4292230329L, 4294587491L, 4297836616L, 4299064645L, 4294703886L, 4297487210L, 4298124191L, 4291913614L, 4294953632L, 4296209533L, 4296840883L, 4293470382L, 4297344336L, 4294676998L, 4299131840L, 4292047990L, 4297580526L, 4299081903L, 4298620772L, 4295493488L, 4292031555L, 4293543987L, 4292085038L, 4296111653L, 4291746761L, 4297032222L, 4291622734L, 4297630817L, 4296004284L, 4292604482L, 4294857440L, 4292788291L, 4298656479L, 4294022538L, 4296364254L, 4296422044L, 4297179692L, 4294154942L, 4292006709L, 4295257860L, 4294665669L, 4291780160L, 4298953652L, 4293751358L, 4298179086L, 4297823429L };
+		long[] output0 = new long[]{ 8659210796L, -36588897286L, -20467380896L, -19241805706L, 13946466872L, 22320833522L, 27456546458L, -9373836204L, 12071422506L, 15456865610L, 9945777378L, 30710836186L, -16457038934L, -32522617676L, 18923149428L, -26378565282L, 7050348434L, -21093791974L, 30311535798L, -6737621356L, 22538429278L, -27897055316L, -23274502142L, -18625026066L, 23276687204L, 30497994878L, 32932031894L, 15863035624L, 30813959834L, -40080333566L, 38036790750L, -16183072522L, -31566543450L, 26312377308L, -31312618782L, 6074786296L, -10696760310L, 8731804560L, -15112969852L, -14698929576L, -19432520036L, -4277532884L, -41373247552L, 6108188960L, -28662213002L, -36201591608L, 21620982728L, -32027006306L, -33932672862L, 12769258010L, 127448L, 909756L, -431058L, 864892L, -1189034L, -164962L, 1245692L, 1778580L, -114406L, 1094044L, 1370492L, -1326674L, -5938L, 539408L, 813496L, -650222L, 1032032L, -126082L, 1807732L, -1268278L, 1134544L, 1786064L, 1585984L, 228504L, -1275418L, -618246L, -1252174L, 496912L, -1399194L, 896552L, -1453098L, 1156372L, 450296L, -1026450L, -47714L, -946578L, 1601476L, -410354L, 606580L, 631668L, 960568L, -352842L, -1286218L, 126180L, -131002L, -1384678L, 1730420L, -528154L, 1394316L, 1239968L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Log10Fast", Fixed64.Log10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Log10Fastest()
+	public static void Fixed64_Log10Fastest()
+	{
+		long[] input0 = new long[]{ 180652L, 21L, 18490291739509L, 1L, 28188L, 2L, 855655588L, 2675L, 187345L, 92453603311974304L, 1257306001750L, 8047403302747L, 65815L, 8L, 1081612578L, 578175L, 16L, 11209L, 1506257911060406L, 372920594200L, 706576405701L, 216729631997400672L, 207956L, 286373245258949L, 18298260809923576L, 7493L, 256028856094245L, 2L, 170805L, 1337283364439956480L, 29067958105900904L, 1804985328849476L, 82765744115198L, 114904078893835216L, 7943L, 1L, 387615078646L, 2475560L, 13116704L, 104L, 888978333819976704L, 98461239367409L, 1058638954321L, 2302277590755L, 122840841317189L, 1969918931674838L, 82530700872L, 83068078698276L, 575716320055L, 38922752693L, 4294300008L, 4295687180L, 4297821966L, 4298368621L, 4291641883L, 4293700977L, 4297423737L, 4298714064L, 4291880131L, 4290936887L, 4292780575L, 4294565552L, 4298430729L, 4293344635L, 4290903380L, 4297808049L, 4298795965L, 4293626010L, 4297891257L, 4294700172L, 4296578878L, 4296882277L, 4297848947L, 4296727100L, 4296325226L, 4298274577L, 4293115015L, 4296018198L, 4290841343L, 4291117405L, 4296019242L, 4290897102L, 4294063329L, 4296794653L, 4295382916L, 4293230785L, 4299133004L, 4297969684L, 4297552466L, 4298025546L, 4292635791L, 4296551654L, 4292404755L, 4293681496L, 4298080390L, 4295035703L, 4297942315L, 4293530594L, 4296128673L, 4298609271L };
+		long[] output0 = new long[]{ -18795312774L, -35694358060L, 15607845924L, -41373247552L, -22260357788L, -40080333566L, -3009358902L, -26652999766L, -18727474922L, 31494856412L, 10593496088L, 14056149588L, -20678701128L, -37494505594L, -2572207048L, -16625364722L, -36201591608L, -23980518538L, 23815321084L, 8326443840L, 9518518250L, 33083891826L, -18532780018L, 20718801296L, 28473267604L, -24731700172L, 20509910158L, -40080333566L, -18899822906L, 36478332600L, 29336543660L, 24152768048L, 18403510268L, 31900292140L, -24622936672L, -41373247552L, 8398507900L, -13912584526L, -10802476282L, -32710186328L, 35716594818L, 18727327084L, 10272659506L, 11721817850L, 19140036376L, 24315926500L, 5513302428L, 18410311580L, 9136466050L, 4111367818L, -289886L, 312552L, 1239108L, 1476300L, -1445046L, -550146L, 1066300L, 1626172L, -1341482L, -1751538L, -950106L, -174522L, 1503248L, -704986L, -1766110L, 1233072L, 1661704L, -582718L, 1269176L, -116042L, 699628L, 831312L, 1250816L, 763964L, 589528L, 1435500L, -804770L, 456252L, -1793082L, -1673058L, 456704L, -1768834L, -392714L, 793284L, 180456L, -754462L, 1807916L, 1303208L, 1122164L, 1327444L, -1013034L, 687812L, -1113446L, -558614L, 1351244L, 29700L, 1291332L, -624182L, 504208L, 1580708L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Log10Fastest", Fixed64.Log10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Log10()
+	public static void Fixed32_Log10()
+	{
+		int[] input0 = new int[]{ 155141248, 241607, 183, 255, 21215978, 173741766, 105671, 55295125, 22787, 15852, 375791880, 19953, 285136786, 56956, 381293097, 440235, 1167, 95243, 9433000, 175560278, 2, 98204, 1314, 21, 489529606, 1062181261, 371413758, 7, 66702, 8, 81342447, 8983967, 63372811, 2, 4540, 197, 12, 60885, 77054, 4926106, 56950, 2395, 57721687, 511746, 355891, 9474, 104, 2842902, 8063358, 10, 65529, 65561, 65557, 65493, 65511, 65518, 65504, 65484, 65507, 65575, 65596, 65532, 65514, 65521, 65545, 65494, 65548, 65590, 65486, 65564, 65538, 65575, 65471, 65474, 65522, 65556, 65559, 65562, 65538, 65541, 65575, 65502, 65510, 65527, 65552, 65493, 65482, 65559, 65562, 65472, 65597, 65599, 65501, 65564, 65571, 65474, 65472, 65531, 65476, 65524 };
+		int[] output0 = new int[]{ 221134, 37134, -167381, -157938, 164507, 224357, 13597, 191771, -30068, -40397, 246314, -33848, 238457, -3994, 246728, 54211, -114650, 10639, 141437, 224653, -295925, 11511, -111273, -229000, 253840, 275888, 245981, -260269, 501, -256468, 202757, 140049, 195652, -295925, -75985, -165283, -244928, -2096, 4608, 122947, -3997, -94187, 192994, 58495, 48158, -55047, -183465, 107300, 136972, -250117, -4, 10, 9, -19, -11, -8, -14, -23, -13, 16, 26, -2, -10, -7, 3, -19, 5, 23, -22, 12, 0, 16, -29, -27, -7, 8, 9, 11, 0, 2, 16, -15, -12, -4, 6, -19, -24, 9, 11, -28, 26, 27, -16, 12, 15, -27, -28, -3, -27, -6 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Log10", Fixed32.Log10(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Log10Fast()
+	public static void Fixed32_Log10Fast()
+	{
+		int[] input0 = new int[]{ 2704263, 7642, 315897, 725, 2, 11, 4682, 769, 5241288, 5072, 987, 28614356, 1404, 19, 227634, 165820739, 13835, 82200881, 2060, 20656807, 2110, 1684397, 13683471, 1442343, 218504072, 362, 235697059, 232919267, 26914, 210166479, 586309660, 8221640, 41805, 104, 365, 27, 6, 2702436, 3794, 279516, 231218054, 78231, 708170, 209947, 1796993, 135187488, 13630367, 63, 244052, 136159, 65580, 65595, 65579, 65556, 65503, 65473, 65552, 65591, 65519, 65569, 65491, 65530, 65578, 65577, 65525, 65542, 65513, 65487, 65582, 65529, 65581, 65567, 65535, 65569, 65585, 65577, 65476, 65497, 65600, 65473, 65532, 65569, 65515, 65590, 65480, 65472, 65591, 65580, 65594, 65501, 65536, 65488, 65513, 65552, 65526, 65530, 65562, 65577, 65490, 65487 };
+		int[] output0 = new int[]{ 105877, -61163, 44765, -128198, -295925, -247405, -75108, -126521, 124712, -72831, -119418, 173021, -109387, -231849, 35439, 223029, -44270, 203056, -98476, 163747, -97793, 92403, 152024, 87987, 230881, -147966, 233037, 232700, -25330, 229774, 258975, 137525, -12797, -183465, -147731, -221847, -264656, 105858, -81094, 41282, 232491, 5039, 67741, 33136, 94245, 217216, 151914, -197732, 37421, 20812, 19, 25, 18, 8, -15, -28, 6, 23, -8, 14, -20, -3, 18, 17, -5, 2, -10, -22, 19, -4, 19, 13, -1, 14, 21, 17, -27, -17, 27, -28, -2, 14, -10, 23, -25, -28, 23, 19, 25, -16, 0, -21, -10, 6, -5, -3, 11, 17, -20, -22 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Log10Fast", Fixed32.Log10Fast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Log10Fastest()
+	public static void Fixed32_Log10Fastest()
+	{
+		int[] input0 = new int[]{ 258017779, 5088, 2292, 198, 1355, 10463618, 13889282, 22326470, 348465402, 707546, 1808236, 135, 129389640, 74704, 146163, 1202747, 500, 8, 25960, 264, 940, 268082324, 37, 1539175, 539758, 539914, 94181216, 31, 733080144, 2, 113844, 441121215, 237, 948, 36705449, 625178, 2, 20039398, 3131579, 8, 10795, 10574, 13673, 1606701, 50, 721, 16725, 369, 4162930, 922847094, 65490, 65500, 65595, 65562, 65573, 65601, 65502, 65559, 65549, 65562, 65587, 65555, 65578, 65593, 65482, 65565, 65597, 65547, 65561, 65592, 65555, 65532, 65518, 65523, 65577, 65585, 65534, 65532, 65537, 65513, 65493, 65551, 65524, 65600, 65582, 65511, 65470, 65540, 65539, 65579, 65520, 65514, 65496, 65471, 65493, 65572, 65549, 65535, 65547, 65527 };
+		int[] output0 = new int[]{ 235613, -72741, -95438, -165140, -110399, 144389, 152449, 165959, 244166, 67716, 94422, -176040, 215968, 3727, 22830, 82818, -138774, -256468, -26358, -156951, -120806, 236702, -212879, 89836, 60012, 60020, 206928, -217915, 265333, -295925, 15717, 250876, -160021, -120565, 180109, 64194, -295925, 162884, 110052, -256468, -51332, -51921, -44606, 91058, -204310, -128356, -38871, -147422, 118156, 271886, -20, -16, 25, 11, 16, 28, -15, 9, 5, 11, 22, 8, 18, 24, -24, 12, 26, 4, 10, 24, 8, -2, -8, -6, 17, 21, -1, -2, 0, -10, -19, 6, -6, 27, 19, -11, -29, 1, 1, 18, -7, -10, -18, -29, -19, 15, 5, -1, 4, -4 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Log10Fastest", Fixed32.Log10Fastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Pow()
 	public static void Fixed64_Pow()
 	{
 		long[] input0 = new long[]{ 400705L, 1171104109L, 415961L, 367869L, 6713293L, 1104902205L, 712415124L, 54629284L, 35474679L, 135810065L, 77915L, 2479877L, 8111L, 559214L, 2069078L, 455360464L, 187233L, 68224273L, 279792325L, 132557L, 25103L, 8410L, 85166967L, 2749282210L, 5142L, 487816L, 192265L, 189938570L, 6053523L, 172723L, 3268107L, 830249744L, 3151049910L, 439384L, 440992L, 147207774L, 768892L, 2865975L, 77672L, 13487L, 2944274816L, 980707L, 37969L, 9715L, 131772L, 1569958668L, 6341L, 1924489227L, 8220L, 21614535L, 14729291249L, 10348206443L, 55771380455L, 11514548068L, 6598682660L, 10256197009L, 40594427283L, 12834818248L, 6364240917L, 28465579835L, 12620856838L, 18804300493L, 25568086794L, 7974782074L, 48650871840L, 9685803492L, 11927842347L, 8622365880L, 8228422100L, 5516892717L, 20403017492L, 55429846012L, 38698035796L, 61781636963L, 6077369325L, 14951918970L, 25389847190L, 15845562159L, 8910851442L, 12969021986L, 17219922338L, 5966811159L, 47634732338L, 39559296291L, 25425677416L, 68183847188L, 13332712105L, 12033972083L, 34646181961L, 43731884393L, 11958513686L, 12043500973L, 13699124962L, 8263597812L, 27281702589L, 4713290484L, 11940049039L, 57936081706L, 6408502913L, 6747948327L };
 		long[] input1 = new long[]{ 13610344L, 84431517L, 13324791L, 268062395L, 266524706L, 68521065L, 28116054L, 156872938L, 91693244L, 28132512L, 2127443832L, 11079267L, 20789286L, 195297730L, 62124079L, 111394121L, 511570734L, 4910979509L, 5092128L, 4039197451L, 417240795L, 12151101622L, 553471559L, 5339359069L, 65795759L, 6207660971L, 29156208750L, 2879495788L, 5361277338L, 10054249L, 96596018L, 116503659L, 5768016658L, 34495806493L, 19148703L, 25401977L, 8524033527L, 1102289793L, 38192190036L, 7447241L, 1168977951L, 4845525L, 21289131L, 5223944L, 393852084L, 25403316554L, 43531193L, 9009951858L, 10661311804L, 38541479669L, 144111482L, 3805955139L, 176375060L, 537015255L, 50598403L, 158117019L, 160620199L, 3328281295L, 21106394L, 559627860L, 448893159L, 44757105L, 10660574L, 728958595L, 15025009L, 27767912L, 423883419L, 1447789582L, 238991773L, 1852407805L, 1937268784L, 4201215854L, 134293300L, 66905451L, 624995898L, 15971865L, 139763672L, 201151677L, 32914947L, 8090849L, 7522310L, 549923220L, 40970808L, 8586093L, 2009019319L, 154161435L, 237256038L, 13784919L, 92099270L, 9797527L, 112629660L, 93194035L, 11384162L, 5984162L, 13327588L, 5285024L, 22583484L, 455239963L, 6268983L, 66494765L };
-		long[] output0 = new long[]{ 4170506310L, 4186638704L, 4173563958L, 2393916264L, 2876283728L, 4202937736L, 4244751794L, 3662062556L, 3876939422L, 4198890464L, 19249212L, 4213139150L, 4029527228L, 2859476574L, 3845730320L, 4052122684L, 1298895798L, 37662710L, 4281082478L, 246043L, 1332200997L, 0L, 2591448694L, 2466653194L, 3485312736L, 8541L, 0L, 530833896L, 1186324L, 4194401972L, 3654428578L, 4107702262L, 2833505974L, 0L, 4122659084L, 4210126882L, 157L, 657551357L, 0L, 4201631034L, 3875505628L, 4254530848L, 4054252060L, 4227594050L, 1656156797L, 11164136L, 3748541706L, 797216325L, 0L, 0L, 4476293012L, 9362298720L, 4771822788L, 4858588328L, 4316750748L, 4434827712L, 4671336768L, 10031889096L, 4303275480L, 5495179424L, 4807140808L, 4361568912L, 4314026980L, 4770618208L, 4331591852L, 4317608236L, 4750510504L, 5432324084L, 4453193112L, 4784723136L, 8673706952L, 52420028192L, 4600573356L, 4477104596L, 4517494180L, 4314936928L, 4550634868L, 4565753636L, 4319056916L, 4303918020L, 4305425724L, 4479624540L, 4394688324L, 4314073968L, 9867741672L, 4743052772L, 4572312588L, 4309193348L, 4491616328L, 4317764180L, 4411862876L, 4392141260L, 4308192044L, 4298885236L, 4319677924L, 4295458524L, 4318120188L, 5658896572L, 4297476772L, 4325114748L };
+		long[] output0 = new long[]{ 4170506310L, 4186638704L, 4173563958L, 2393916264L, 2876283728L, 4202937736L, 4244751794L, 3662062556L, 3876939422L, 4198890464L, 19249212L, 4213139154L, 4029527228L, 2859476574L, 3845730320L, 4052122684L, 1298895798L, 37662710L, 4281082478L, 246043L, 1332200997L, 0L, 2591448694L, 2466653192L, 3485312736L, 8541L, 0L, 530833896L, 1186324L, 4194401972L, 3654428578L, 4107702266L, 2833505974L, 0L, 4122659084L, 4210126882L, 157L, 657551356L, 0L, 4201631034L, 3875505628L, 4254530848L, 4054252060L, 4227594050L, 1656156797L, 11164136L, 3748541710L, 797216325L, 0L, 0L, 4476293012L, 9362298728L, 4771822788L, 4858588328L, 4316750748L, 4434827712L, 4671336768L, 10031889112L, 4303275480L, 5495179428L, 4807140812L, 4361568912L, 4314026980L, 4770618208L, 4331591852L, 4317608240L, 4750510504L, 5432324088L, 4453193112L, 4784723136L, 8673706952L, 52420028352L, 4600573356L, 4477104596L, 4517494180L, 4314936928L, 4550634868L, 4565753636L, 4319056916L, 4303918020L, 4305425724L, 4479624544L, 4394688324L, 4314073972L, 9867741688L, 4743052776L, 4572312588L, 4309193348L, 4491616332L, 4317764180L, 4411862876L, 4392141260L, 4308192044L, 4298885236L, 4319677924L, 4295458524L, 4318120188L, 5658896572L, 4297476776L, 4325114748L };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util.Check("Fixed64.Pow", Fixed64.Pow(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -839,7 +1056,7 @@ class UnitTest
 	{
 		long[] input0 = new long[]{ 24586L, 884985L, 580198L, 80151582L, 9304579L, 1756467088L, 1773934946L, 3882649L, 192651L, 7831994L, 4187335258L, 97429L, 2624198L, 3730498L, 639802L, 60435454L, 412798313L, 9205776L, 5590053L, 1568167873L, 64541L, 181971741L, 255058L, 5357308L, 14606L, 532751L, 14087184L, 360942L, 3555676L, 9469L, 610840L, 10402L, 24071L, 14420125L, 6213L, 25929L, 4603769L, 2170550L, 146573378L, 33801050L, 2361183L, 1906005121L, 15056L, 292191L, 4614514L, 5232L, 8010L, 724069036L, 405611L, 10836626L, 54005198690L, 6851553183L, 13314296593L, 5622632651L, 12338979523L, 22990994337L, 16738628033L, 9371611171L, 5222837064L, 27714796650L, 27888419369L, 5665477914L, 42690801161L, 19675822004L, 52546421773L, 24941820264L, 24208284510L, 5467061737L, 6434529302L, 5926159939L, 4555769537L, 18027219127L, 7826718558L, 38545391018L, 7312970419L, 18181719113L, 19871151547L, 8618091319L, 20843629608L, 24562335919L, 10433507782L, 40316179103L, 47839124878L, 14536550169L, 6715434859L, 6251074827L, 10054384157L, 51277953641L, 19126423316L, 15686052103L, 21323381344L, 24734950661L, 17824557271L, 66424080462L, 68126788679L, 58220464926L, 43808032441L, 9294847548L, 25700466448L, 27188081815L };
 		long[] input1 = new long[]{ 74003821324L, 76116046L, 19191284L, 910938888L, 41869169382L, 144652287L, 10477688L, 17457239914L, 2058203893L, 33373074L, 136559200L, 1901816690L, 4574538L, 37231243L, 26740968L, 44739515145L, 11700785L, 25324991229L, 421354973L, 42754288L, 27196489L, 184822508L, 11812830898L, 23646696733L, 452966451L, 53643735L, 3624867819L, 77924813811L, 4779976L, 8964793L, 87027581L, 5099307282L, 79007044283L, 38642060436L, 8786802L, 8467853L, 36244589104L, 1393301103L, 2969162164L, 3323423296L, 6388307L, 3141264479L, 15542205045L, 981793019L, 83826172L, 17866515603L, 45048067252L, 24352997768L, 14206856L, 1227762966L, 19328955L, 1500894307L, 651219854L, 4436124L, 191584363L, 66092310L, 3083028138L, 303929774L, 2231264528L, 1634973479L, 6176677L, 22452546L, 586180977L, 90740931L, 48981712L, 1714708500L, 21111485L, 62898471L, 62533573L, 864016670L, 41306309L, 661959593L, 189632472L, 466420928L, 176811207L, 63441230L, 4417665L, 20846814L, 1039230731L, 24446245L, 480208405L, 28516035L, 282289140L, 2215307290L, 73537333L, 112188549L, 7501912L, 1686630615L, 2008094148L, 849951314L, 15241758L, 505214404L, 3986423091L, 466170788L, 75289993L, 44508401L, 2467527374L, 7046555L, 346039940L, 10528264L };
-		long[] output0 = new long[]{ 0L, 3695179032L, 4127352424L, 1846027869L, 0L, 4167567206L, 4285713632L, 0L, 35420133L, 4089571674L, 4291503360L, 37711227L, 4261250860L, 4040407122L, 4065692166L, 0L, 4267651816L, 0L, 2238071802L, 4252111074L, 4003320790L, 3748681666L, 0L, 0L, 1138239225L, 3838571190L, 34387224L, 0L, 4261183086L, 4179784974L, 3589284808L, 923L, 0L, 0L, 4178438132L, 4194409864L, 0L, 366100904L, 415785432L, 101127983L, 4247288546L, 2370834788L, 0L, 479018948L, 3758516822L, 0L, 0L, 177391L, 4165313294L, 776736655L, 4344174152L, 5056387272L, 5098737644L, 4296162156L, 4501969344L, 4407279012L, 11403077152L, 4538759344L, 4754333704L, 8733910160L, 4306536132L, 4301188960L, 5876011824L, 4435300760L, 4419385336L, 8668889576L, 4331624600L, 4310168976L, 4320316216L, 4582313116L, 4297402624L, 5357671708L, 4410274172L, 5450741728L, 4390094496L, 4387482912L, 4301738616L, 4309507692L, 6294336236L, 4337802080L, 4743049672L, 4359292104L, 5032268388L, 8055150184L, 4327957108L, 4337273748L, 4301351864L, 11373297120L, 8634636448L, 5549929864L, 4319455916L, 5277168364L, 16092368384L, 5781663520L, 4508171924L, 4412560248L, 16308521104L, 4300409900L, 4960903800L, 4314436452L };
+		long[] output0 = new long[]{ 0L, 3695179024L, 4127352452L, 1846027753L, 0L, 4167567214L, 4285713632L, 0L, 35420134L, 4089571674L, 4291503352L, 37711229L, 4261250860L, 4040407124L, 4065692170L, 0L, 4267651816L, 0L, 2238071792L, 4252111074L, 4003320788L, 3748681700L, 0L, 0L, 1138239228L, 3838571184L, 34387222L, 0L, 4261183086L, 4179784974L, 3589284798L, 923L, 0L, 0L, 4178438134L, 4194409864L, 0L, 366100837L, 415785792L, 101127985L, 4247288550L, 2370834890L, 0L, 479019071L, 3758516930L, 0L, 0L, 177392L, 4165313294L, 776736634L, 4344174148L, 5056387368L, 5098737580L, 4296162156L, 4501969316L, 4407279012L, 11403076704L, 4538759732L, 4754334108L, 8733910488L, 4306536136L, 4301188956L, 5876012052L, 4435300780L, 4419385340L, 8668889232L, 4331624604L, 4310168984L, 4320316220L, 4582313192L, 4297402608L, 5357671160L, 4410274160L, 5450741988L, 4390094484L, 4387482884L, 4301738616L, 4309507696L, 6294336380L, 4337802076L, 4743049740L, 4359292096L, 5032268440L, 8055149836L, 4327957100L, 4337273744L, 4301351860L, 11373297648L, 8634641336L, 5549929812L, 4319455920L, 5277168268L, 16092359304L, 5781663516L, 4508171924L, 4412560244L, 16308522440L, 4300409908L, 4960903832L, 4314436452L };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util.Check("Fixed64.PowFast", Fixed64.PowFast(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -849,7 +1066,7 @@ class UnitTest
 	{
 		long[] input0 = new long[]{ 56233971L, 10669L, 4150764696L, 553726L, 153986816L, 19110L, 850326L, 3664955098L, 11877784L, 2372145665L, 8430L, 223495L, 1342293038L, 1603703620L, 902792314L, 240678264L, 31649L, 866374L, 65700L, 3668037L, 5891751L, 665901L, 61190273L, 1668485L, 13931L, 238109L, 6334L, 8218L, 55669655L, 10377999L, 9761L, 3368025695L, 167813717L, 2750161204L, 356729225L, 885701L, 132503L, 15791076L, 1475812216L, 5561427L, 6251L, 9002210L, 127294900L, 130167L, 5928549L, 7491268L, 45857L, 406477342L, 37762L, 261233L, 4533892215L, 7977595445L, 31665527062L, 26474174159L, 34756696539L, 8289240360L, 5342110433L, 4516822294L, 56656705551L, 40659275412L, 30022535367L, 56316929626L, 26604557245L, 31762160403L, 11310098232L, 49428494985L, 14798327731L, 54287709784L, 8203222593L, 12260139281L, 37434131208L, 6459945672L, 35363030603L, 23306236835L, 16674808288L, 46736579460L, 7962342878L, 4381790174L, 8354060862L, 36322549167L, 31514659419L, 49851331023L, 5605409463L, 15010500100L, 18432277707L, 51491136627L, 16173448313L, 8209331162L, 24906816730L, 19154241181L, 14571161148L, 9013038592L, 14674153037L, 12215025317L, 39192715630L, 5420328047L, 4596917337L, 23051948929L, 5746424631L, 20155681048L };
 		long[] input1 = new long[]{ 10469154346L, 903863625L, 4269030977L, 207998192L, 9725275164L, 103279153L, 173667895L, 1167356441L, 60173916L, 444408112L, 9478680L, 119466173L, 86396195L, 4731318L, 31158844235L, 8291166L, 745897259L, 51367326737L, 12615412L, 615779311L, 931723186L, 999839140L, 414621678L, 3566153326L, 414466112L, 63389378854L, 1988813349L, 353573844L, 34616255906L, 947568761L, 13988235L, 30753855L, 28790330487L, 200531510L, 9380207039L, 735260333L, 72599464L, 173574880L, 27559205L, 600214342L, 4843939L, 3692406730L, 110246301L, 386016457L, 331234115L, 4041741215L, 51324447L, 6259387295L, 136582684L, 396431609L, 23363472L, 43601309L, 137853186L, 3515423182L, 458121572L, 1777791837L, 105147227L, 9217382L, 13587716L, 2053591101L, 4747828L, 7036827L, 928074279L, 13001570L, 8102721L, 1214144018L, 1347310272L, 17874581L, 16663486L, 98384202L, 69461893L, 18643739L, 29924271L, 519288814L, 2793215878L, 149163120L, 556156973L, 60694405L, 1176407445L, 70611174L, 1387778013L, 303907902L, 2185756149L, 478610400L, 161247181L, 60659413L, 60143353L, 10187592L, 909659216L, 390998683L, 85472360L, 54449424L, 6819246L, 716591983L, 161114008L, 54997178L, 125997463L, 30293018L, 30778123L, 3750156433L };
-		long[] output0 = new long[]{ 110457L, 284106145L, 4151905960L, 2783270234L, 2290697L, 3193292072L, 3042074892L, 4114056688L, 3955145440L, 4039466566L, 4172437718L, 3264255746L, 4195855342L, 4290320204L, 52338L, 4271197670L, 551597435L, 0L, 4157606236L, 1559484348L, 1027948140L, 557389358L, 2848962244L, 6324719L, 1268473147L, 0L, 8565727L, 1452707874L, 0L, 1136756477L, 4117302362L, 4287514642L, 1L, 4206684202L, 18745955L, 1004726353L, 3603596578L, 3424285444L, 4265696848L, 1695866359L, 4230497428L, 21385415L, 3924452616L, 1685962397L, 2584579180L, 10893345L, 3746171848L, 138269888L, 2965748886L, 1753208273L, 4296236528L, 4322134556L, 4579859980L, 19032268816L, 5367841392L, 5637940812L, 4318042128L, 4295433096L, 4330268104L, 12580167664L, 4304239240L, 4313172428L, 6368874444L, 4321141392L, 4302845216L, 8568352316L, 6330837048L, 4340687780L, 4305798272L, 4399681000L, 4448380684L, 4302607964L, 4358701256L, 5269324968L, 10377130104L, 4666677704L, 4652850992L, 4296186088L, 5153497804L, 4448753440L, 8178504200L, 5108612488L, 4918567984L, 4937904860L, 4536837904L, 4448669516L, 4375679660L, 4301593632L, 6231529944L, 4921491092L, 4400934344L, 4335638944L, 4303381028L, 5113276656L, 4666864408L, 4307826096L, 4303564788L, 4346321380L, 4303965604L, 16567735872L };
+		long[] output0 = new long[]{ 110455L, 284106724L, 4151906108L, 2783270174L, 2290719L, 3193292486L, 3042073976L, 4114046146L, 3955145764L, 4039467266L, 4172437712L, 3264254888L, 4195856110L, 4290320208L, 52335L, 4271197608L, 551597434L, 0L, 4157606234L, 1559482345L, 1027949594L, 557390592L, 2848960614L, 6324688L, 1268471995L, 0L, 8565715L, 1452707855L, 0L, 1136758667L, 4117302456L, 4287514504L, 1L, 4206686088L, 18746338L, 1004724745L, 3603596550L, 3424285104L, 4265697070L, 1695868595L, 4230497420L, 21385417L, 3924452452L, 1685962475L, 2584580384L, 10893266L, 3746172154L, 138269727L, 2965749316L, 1753208320L, 4296236520L, 4322134384L, 4579859272L, 19032226848L, 5367841124L, 5637940656L, 4318043076L, 4295433092L, 4330267988L, 12580205888L, 4304239196L, 4313172372L, 6368870012L, 4321141332L, 4302845296L, 8568363232L, 6330818424L, 4340687688L, 4305798256L, 4399681532L, 4448380744L, 4302607964L, 4358701232L, 5269330480L, 10377132192L, 4666679088L, 4652848476L, 4296186044L, 5153498388L, 4448753412L, 8178490148L, 5108613824L, 4918592144L, 4937899916L, 4536837924L, 4448669536L, 4375679508L, 4301593624L, 6231534936L, 4921492108L, 4400933516L, 4335638912L, 4303380964L, 5113281384L, 4666865080L, 4307826616L, 4303564792L, 4346321656L, 4303965888L, 16567819440L };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util.Check("Fixed64.PowFastest", Fixed64.PowFastest(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -859,7 +1076,7 @@ class UnitTest
 	{
 		int[] input0 = new int[]{ 7, 10430, 240, 5017, 199, 634, 1016, 0, 0, 199, 35, 16, 22, 13218, 0, 0, 53903, 3032, 6, 60, 604, 0, 0, 1629, 0, 1, 22, 2166, 0, 505, 0, 104, 500, 1056, 394, 72, 0, 9622, 1228, 0, 15, 1362, 42040, 0, 1, 10040, 2810, 7, 26193, 1, 89260, 75297, 83365, 132920, 146061, 328761, 299401, 207780, 216395, 76028, 126599, 312511, 183631, 204062, 920803, 102548, 92845, 67937, 265230, 66301, 84895, 381594, 68398, 864291, 708721, 432009, 896059, 501734, 249936, 396801, 117435, 298138, 305904, 104724, 101739, 186740, 1031598, 313501, 440120, 177723, 872363, 205506, 439684, 400643, 83279, 133443, 734344, 556872, 186983, 391708 };
 		int[] input1 = new int[]{ 71562, 28476, 70806, 12450, 1243355, 1357, 59582, 332784, 54954, 2848, 722, 761859, 1174514, 5413, 8049, 603772, 113289, 83502, 812, 54328, 613316, 225, 125, 1148, 174, 731510, 129, 224, 8391, 950, 4531, 146, 219539, 1032829, 734267, 7722, 239534, 209, 71677, 1620, 220139, 728, 395, 1742, 192567, 5618, 91071, 11542, 18323, 1572, 613, 9326, 74, 3238, 315, 1755, 83, 193, 1012, 4396, 5389, 18107, 41361, 14468, 22183, 7756, 69, 265, 371, 3490, 208, 3160, 623, 177, 106, 7242, 46042, 801, 22289, 4199, 17475, 214, 766, 21395, 621, 1969, 2522, 61605, 43752, 7316, 700, 21345, 209, 112, 9568, 149, 1790, 34050, 17615, 1005 };
-		int[] output0 = new int[]{ 3, 29488, 152, 40221, 0, 59533, 1483, 0, 0, 50941, 60314, 0, 0, 57417, 0, 0, 46748, 1305, 58403, 198, 0, 0, 0, 61428, 0, 0, 64511, 64775, 0, 61072, 0, 64600, 0, 0, 0, 29363, 0, 65135, 845, 0, 0, 62774, 65360, 0, 0, 55799, 823, 13093, 50712, 50227, 65724, 66842, 65552, 67865, 65788, 68427, 65661, 65758, 66754, 66190, 69181, 100902, 125568, 84212, 160304, 69101, 65559, 65544, 66055, 65575, 65588, 71345, 65561, 65992, 65788, 80719, 411585, 67186, 103320, 73550, 76562, 65860, 66726, 76371, 65808, 67629, 72868, 285398, 233686, 73255, 67373, 95088, 65933, 65738, 67868, 65640, 70006, 199196, 86867, 67356 };
+		int[] output0 = new int[]{ 3, 29488, 152, 40222, 0, 59534, 1483, 0, 0, 50941, 60315, 0, 0, 57418, 0, 0, 46749, 1305, 58404, 198, 0, 0, 0, 61428, 0, 0, 64512, 64776, 0, 61072, 0, 64601, 0, 0, 0, 29363, 0, 65136, 845, 0, 0, 62775, 65360, 0, 0, 55800, 823, 13093, 50713, 50228, 65725, 66843, 65553, 67866, 65788, 68428, 65662, 65759, 66756, 66192, 69182, 100904, 125569, 84212, 160308, 69102, 65560, 65545, 66056, 65576, 65589, 71346, 65562, 65994, 65788, 80720, 411595, 67186, 103323, 73551, 76564, 65861, 66726, 76372, 65809, 67630, 72869, 285407, 233694, 73256, 67373, 95090, 65935, 65739, 67869, 65642, 70007, 199203, 86868, 67357 };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util.Check("Fixed32.Pow", Fixed32.Pow(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -869,7 +1086,7 @@ class UnitTest
 	{
 		int[] input0 = new int[]{ 1806, 4, 379, 15, 0, 0, 0, 1, 21, 5, 961, 7616, 0, 1, 34, 17177, 205, 17490, 60, 6898, 1121, 19344, 0, 342, 10, 20, 149, 7456, 5, 5, 0, 0, 0, 26536, 1206, 78, 45740, 0, 2, 0, 27, 3, 339, 63676, 247, 0, 57, 28, 235, 55172, 198805, 171373, 818301, 400230, 77061, 85574, 111189, 856867, 963654, 739856, 289492, 87432, 1003377, 651189, 488318, 243994, 82474, 321077, 168022, 71328, 425584, 80233, 263813, 392839, 380124, 945460, 175103, 66536, 803681, 149928, 73791, 563283, 181377, 906297, 595847, 326077, 117430, 343580, 142453, 416016, 73402, 836051, 496974, 550718, 171361, 114696, 998462, 139947, 795125, 69909 };
 		int[] input1 = new int[]{ 15587, 221999, 1698, 2576, 1188, 239549, 508, 70, 83, 40849, 23758, 1774, 546144, 180, 878, 11327, 138715, 273, 12273, 722535, 649546, 6010, 33596, 3493, 3484, 4129, 1188, 181, 82, 458, 626179, 217, 780, 1871, 125103, 649, 283753, 67335, 37806, 409236, 1354, 940138, 179, 31825, 9034, 181, 2703, 10937, 95772, 139, 75, 16742, 222, 8556, 1047, 628, 22371, 407, 74, 126, 11009, 235, 76, 6755, 20453, 12480, 10639, 84, 81, 179, 405, 1872, 496, 6846, 61019, 12186, 697, 10474, 517, 1297, 57208, 114, 135, 28758, 449, 344, 4098, 6341, 2850, 1671, 10456, 45034, 3576, 234, 38986, 24185, 31773, 98, 42209, 3773 };
-		int[] output0 = new int[]{ 27893, 0, 57344, 47139, 0, 0, 0, 64763, 64871, 177, 14181, 61826, 0, 63568, 59219, 51995, 0, 65175, 17680, 0, 0, 58597, 0, 49524, 41076, 39354, 58689, 65142, 64762, 61333, 0, 0, 0, 63865, 31, 61307, 13811, 0, 162, 0, 55787, 0, 64599, 64625, 30364, 0, 49005, 17955, 17, 65511, 65618, 83775, 66097, 82998, 65704, 65702, 78494, 66590, 65733, 65841, 84110, 65602, 65742, 83035, 122655, 84176, 68026, 65668, 65611, 65550, 66297, 65914, 66229, 79015, 336739, 107649, 66222, 65693, 66843, 66617, 72685, 65781, 65672, 207521, 66533, 66088, 67969, 76929, 67785, 68697, 66731, 376966, 73194, 66035, 116090, 80569, 245436, 65609, 327037, 65779 };
+		int[] output0 = new int[]{ 27893, 0, 57345, 47139, 0, 0, 0, 64764, 64871, 177, 14181, 61827, 0, 63570, 59220, 51995, 0, 65176, 17680, 0, 0, 58598, 0, 49525, 41076, 39354, 58690, 65143, 64763, 61334, 0, 0, 0, 63866, 31, 61308, 13811, 0, 162, 0, 55788, 0, 64600, 64626, 30364, 0, 49005, 17955, 17, 65512, 65619, 83777, 66098, 82999, 65705, 65703, 78496, 66590, 65735, 65842, 84111, 65603, 65743, 83036, 122656, 84177, 68027, 65669, 65612, 65551, 66297, 65915, 66230, 79017, 336749, 107650, 66224, 65694, 66844, 66618, 72686, 65781, 65673, 207525, 66534, 66090, 67970, 76931, 67786, 68697, 66731, 376975, 73196, 66035, 116091, 80571, 245441, 65610, 327048, 65780 };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util.Check("Fixed32.PowFast", Fixed32.PowFast(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
@@ -879,11 +1096,173 @@ class UnitTest
 	{
 		int[] input0 = new int[]{ 164, 0, 46, 10, 11, 1, 35178, 0, 19, 417, 33, 569, 0, 11, 196, 1407, 0, 0, 1056, 9995, 39626, 1271, 5, 458, 16, 555, 0, 24, 42, 4524, 1, 0, 114, 8, 7, 0, 508, 111, 7091, 0, 131, 3, 2, 10, 6270, 19, 33, 1409, 35929, 148, 148236, 463374, 440920, 298971, 251905, 318114, 320457, 178225, 239300, 504355, 205986, 536654, 69837, 975408, 273278, 414353, 76267, 522605, 879653, 70815, 177930, 176208, 625306, 297817, 910972, 134352, 1028927, 87732, 361156, 146208, 77265, 553067, 68133, 197297, 451033, 259822, 499183, 850474, 212178, 86348, 656137, 451200, 147473, 113288, 80796, 458209, 588692, 346241, 352475, 166015 };
 		int[] input1 = new int[]{ 255, 179848, 1041322, 149050, 4130, 302782, 74633, 252338, 917785, 79687, 152, 12059, 44404, 26455, 4693, 4070, 207, 106972, 92, 3766, 135, 18074, 620, 29215, 1459, 56419, 5065, 816630, 201075, 1188357, 485, 4190, 7016, 534153, 49547, 3558, 114, 121258, 677943, 8274, 6225, 209224, 19338, 218, 65, 83, 31334, 49768, 710764, 3923, 52994, 27476, 10368, 35258, 94, 42603, 31059, 174, 4082, 313, 3518, 1652, 11279, 223, 7020, 5595, 11211, 4929, 447, 74, 41204, 161, 619, 21281, 255, 6451, 102, 4622, 1690, 363, 1651, 988, 2049, 454, 598, 235, 84, 134, 708, 12321, 4277, 3879, 624, 255, 2426, 808, 46582, 144, 2392, 1293 };
-		int[] output0 = new int[]{ 64028, 0, 0, 0, 37896, 0, 32268, 0, 0, 139, 64393, 27365, 0, 1961, 43219, 51626, 0, 0, 65157, 58828, 65467, 22090, 59918, 7171, 54459, 1077, 0, 0, 0, 0, 60377, 0, 33194, 0, 65, 0, 64984, 0, 0, 0, 36318, 0, 3048, 63650, 65383, 64863, 1736, 3549, 96, 45501, 126806, 148811, 88594, 148295, 65661, 182999, 139055, 65710, 71048, 66178, 69697, 69109, 66257, 66142, 76368, 76711, 67262, 76613, 66709, 65540, 122808, 65695, 66950, 107146, 66212, 70340, 65816, 66901, 68490, 65827, 65807, 67681, 65614, 66039, 66702, 65860, 65706, 65880, 66374, 69028, 76170, 73468, 66045, 65675, 66046, 67129, 311998, 65775, 69692, 66750 };
+		int[] output0 = new int[]{ 64029, 0, 0, 0, 37896, 0, 32268, 0, 0, 139, 64394, 27365, 0, 1961, 43219, 51626, 0, 0, 65158, 58829, 65468, 22090, 59919, 7170, 54460, 1077, 0, 0, 0, 0, 60378, 0, 33194, 0, 65, 0, 64985, 0, 0, 0, 36318, 0, 3048, 63651, 65384, 64864, 1736, 3549, 96, 45502, 126809, 148814, 88595, 148297, 65663, 183002, 139058, 65710, 71049, 66179, 69698, 69110, 66259, 66142, 76369, 76712, 67262, 76614, 66710, 65541, 122811, 65695, 66951, 107149, 66212, 70341, 65818, 66901, 68490, 65828, 65809, 67682, 65615, 66039, 66702, 65861, 65707, 65881, 66375, 69030, 76171, 73469, 66045, 65676, 66047, 67130, 312003, 65776, 69693, 66752 };
 		for (int ndx = 0; ndx < 100; ndx++)
 			Util.Check("Fixed32.PowFastest", Fixed32.PowFastest(input0[ndx], input1[ndx]), output0[ndx], input0[ndx], input1[ndx]);
 	}
 
+	// Fixed64.Sigmoid()
+	public static void Fixed64_Sigmoid()
+	{
+		long[] input0 = new long[]{ -621881512L, 10452991948L, 9925063740L, 14962749390L, 9370574252L, 1126373608L, 7800242587L, 14586944062L, 15642593695L, -10587470348L, 6019231898L, -14796240158L, -9099119212L, 12826159917L, 8734349788L, -279957224L, -9477811052L, -5934447370L, 14063915486L, -8193825851L, -13421447934L, -9176488492L, -16786827727L, 12735080989L, 8167612379L, -33142897871L, 84030069351L, 29244836685L, -74398585570L, -88672073321L, 77944668388L, -115925471861L, 62649188061L, 75544050915L, 99254943854L, 39274742226L, 291642432L, -10681955268L, 40916283219L, -719997120L, -119122288887L, 88872170473L, 57206609882L, 19359747657L, -42695440211L, 19177327688L, -66618136799L, -17703182152L, -81062565093L, -23957559755L, 62824L, 11L, 12706016L, 1129L, 1738317L, 250L, 43335889L, 700091136L, 80L, 6145L, 10091446L, 14L, 4975070L, 31114604L, 8573L, 562443L, 1946L, 27199L, 1L, 11L, 3501480409L, 22394542L, 3430132L, 9292L, 75L, -569L, -113631L, -17710L, -116572L, -41L, -14L, -3674L, -7339L, -73329570L, -3498163L, -3070975L, -1918L, -9105L, -16L, -787924L, -154509763L, -411628L, -344L, -289L, -26318094L, -1296832915L, -17L, -914645414L, -36L, -15963226L };
+		long[] output0 = new long[]{ 1992284324L, 3948651012L, 3907442656L, 4167075664L, 3859454444L, 2427474108L, 3694108972L, 4155760144L, 4185320588L, 336477212L, 3446349300L, 132790852L, 460878040L, 4088604456L, 3797964232L, 2077519128L, 425838364L, 862140424L, 4138389720L, 555043652L, 180778520L, 453518952L, 84507420L, 4084398440L, 3736967152L, 1911856L, 4294967280L, 4290232196L, 132L, 4L, 4294967240L, 0L, 4294965304L, 4294967196L, 4294967296L, 4294508552L, 2220366252L, 329717928L, 4294654256L, 1967904716L, 0L, 4294967292L, 4294960236L, 4248129448L, 206876L, 4246120364L, 788L, 68529988L, 32L, 16173476L, 2147499340L, 2147483648L, 2150660136L, 2147483916L, 2147918220L, 2147483692L, 2158317512L, 2322119936L, 2147483660L, 2147485180L, 2150006492L, 2147483648L, 2148727404L, 2155262244L, 2147485772L, 2147624252L, 2147484124L, 2147490428L, 2147483648L, 2147483648L, 2977389560L, 2153082252L, 2148341164L, 2147485964L, 2147483660L, 2147483524L, 2147455252L, 2147479236L, 2147454516L, 2147483648L, 2147483648L, 2147482740L, 2147481828L, 2129151724L, 2146609124L, 2146715924L, 2147483188L, 2147481380L, 2147483648L, 2147286676L, 2108860388L, 2147380756L, 2147483572L, 2147483588L, 2140904156L, 1825716336L, 2147483648L, 1919682580L, 2147483648L, 2143492860L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Sigmoid", Fixed64.Sigmoid(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SigmoidFast()
+	public static void Fixed64_SigmoidFast()
+	{
+		long[] input0 = new long[]{ -7221342075L, -11607123437L, -894872744L, -10253480700L, 1572255816L, 6684907787L, -15523842159L, 3253133177L, 10662974140L, -3022440521L, -11713387021L, -9165706316L, -4103716905L, 3325468649L, -3019885753L, -6923860395L, -16251038095L, 10430926284L, 17049923727L, -576425240L, 9481534620L, 3354639961L, -2798620953L, -7466314843L, -633834376L, 113191496308L, 91551591658L, -63181676893L, -66172806238L, -9357703236L, -19323204296L, -86371621224L, 87976023144L, 69065669600L, 76839009379L, 29847237837L, -28273205069L, 103390342384L, 22691526474L, 63244987997L, 15389096263L, 38626928593L, -3427617601L, -93113789035L, 108859285362L, -134089625342L, 86543984360L, -76914906851L, 76856218083L, -75906443747L, 15080L, 9904L, 29270957L, 12650L, 75377L, 4654998L, 14569447L, 69L, 8630461L, 1279414L, 198945430L, 31255583L, 1702L, 2076L, 2902502088L, 2376248093L, 9554L, 1153681L, 74557286L, 54996498L, 481542127L, 28L, 134L, 366L, 855169742L, -20L, -11L, -300L, -5306L, -33220L, -8L, -801354L, -53137L, -2L, -2L, -1L, -9039L, -6272L, -228L, -6L, -214772347L, -96L, -31L, -1372908653L, -232860082L, -31175643L, -869L, -23L, -52L, -773513063L };
+		long[] output0 = new long[]{ 673955984L, 269835748L, 1924576340L, 361397004L, 2536216664L, 3546976592L, 112640924L, 2923978640L, 3963901668L, 1421597024L, 263645916L, 454538416L, 1193067004L, 2939650820L, 1422162720L, 714246572L, 95484104L, 3947012100L, 4215386648L, 2003590804L, 3869460992L, 2945943932L, 1471577120L, 642180200L, 1989311020L, 4294967296L, 4294967292L, 1760L, 876L, 436687420L, 47233712L, 8L, 4294967288L, 4294966848L, 4294967216L, 4290851128L, 5935600L, 4294967296L, 4273277740L, 4294965564L, 4178832836L, 4294433876L, 1333349036L, 0L, 4294967296L, 0L, 4294967288L, 76L, 4294967216L, 96L, 2147487408L, 2147486112L, 2154802916L, 2147486800L, 2147502484L, 2148647656L, 2151126804L, 2147483664L, 2149641732L, 2147803560L, 2197217772L, 2155299168L, 2147484064L, 2147484160L, 2846692468L, 2726856884L, 2147486032L, 2147772128L, 2166126056L, 2161235344L, 2267747880L, 2147483648L, 2147483680L, 2147483728L, 2360568260L, 2147483648L, 2147483648L, 2147483584L, 2147482336L, 2147475344L, 2147483648L, 2147283268L, 2147470368L, 2147483648L, 2147483648L, 2147483648L, 2147481392L, 2147482080L, 2147483600L, 2147483648L, 2093794920L, 2147483632L, 2147483648L, 1807154008L, 2089275908L, 2139688116L, 2147483440L, 2147483648L, 2147483648L, 1954628904L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SigmoidFast", Fixed64.SigmoidFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SigmoidFastest()
+	public static void Fixed64_SigmoidFastest()
+	{
+		long[] input0 = new long[]{ 4800040L, 15323060559L, 2535800697L, -3408998969L, -5257513866L, -13299913950L, -9060722764L, -7567995835L, 3190704729L, 11321852957L, 15931459343L, 15508727823L, 14615969902L, 3143853097L, -4567960202L, -12750482685L, 1746633080L, -14313011790L, -13794821086L, -5632955354L, -1383208248L, 524918616L, 11160227693L, -8586638699L, 9169722604L, -124085732473L, -113460983796L, -121235449592L, -24366062539L, 4607959362L, -109852319859L, -56103192538L, 60232207836L, 4532531394L, 125894085370L, -124120402681L, 6232319170L, 123000759161L, -55567111129L, 81349443301L, -53183429848L, 35891258960L, -57120339162L, -47290007638L, -30361243086L, -75376219747L, 94309050603L, 105742033521L, -23889274571L, 126666937978L, 60002L, 372L, 3L, 2651659294L, 536003L, 3070021958L, 14L, 1312L, 1277730L, 749L, 1L, 51L, 231805193L, 5L, 10565007L, 2707629L, 172L, 8686L, 1266083L, 1172L, 691634L, 648841L, 36943881L, 821L, 1L, -97135443L, -140L, -61107L, -194822278L, -163045L, -95L, -89L, -1665372L, -21881L, -1L, -106857199L, -223L, -13700294L, -757028907L, -2366977155L, -856301228L, -82L, -1048L, -4242000794L, -26294081L, -17L, -21984064L, -120L, -586563L, -8971309L };
+		long[] output0 = new long[]{ 2148695412L, 4177009160L, 2763924900L, 1337478860L, 975889032L, 185863672L, 464746948L, 629345876L, 2910383832L, 4007688492L, 4192250844L, 4181857212L, 4156787936L, 2900162288L, 1102180624L, 209767524L, 2577727880L, 147963592L, 166352520L, 911563256L, 1804993924L, 2279040056L, 3997429316L, 512316632L, 3840640888L, 0L, 0L, 0L, 14720328L, 3200400776L, 0L, 9128L, 4294963804L, 3186012920L, 4294967296L, 0L, 3479612904L, 4294967296L, 10324L, 4294967268L, 17980L, 4293959924L, 7196L, 70992L, 3654948L, 104L, 4294967296L, 4294967296L, 16443296L, 4294967296L, 2147498784L, 2147483728L, 2147483648L, 2790396244L, 2147618968L, 2883974580L, 2147483648L, 2147483968L, 2147806216L, 2147483824L, 2147483648L, 2147483648L, 2205818088L, 2147483648L, 2150150572L, 2148167196L, 2147483680L, 2147485828L, 2147803276L, 2147483936L, 2147658248L, 2147647452L, 2156805984L, 2147483840L, 2147483648L, 2122993256L, 2147483616L, 2147468236L, 2098430736L, 2147442496L, 2147483632L, 2147483632L, 2147063216L, 2147478140L, 2147483648L, 2120545804L, 2147483600L, 2144025428L, 1958372876L, 1570047160L, 1933872828L, 2147483632L, 2147483392L, 1165601624L, 2140847672L, 2147483648L, 2141935080L, 2147483632L, 2147335564L, 2145218980L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SigmoidFastest", Fixed64.SigmoidFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Sigmoid()
+	public static void Fixed32_Sigmoid()
+	{
+		int[] input0 = new int[]{ -183849, 188956, -29760, 71858, 3854, -199657, -188146, 40811, -32647, -68578, 174994, 119538, -75302, -25929, -16383, -143154, 69661, 48320, -39399, -12476, 85823, 251712, -98034, -81252, 138768, -1136951, -1693763, -188831, -1013291, -678558, -608891, 1040174, 491541, 736239, -1844392, -1594161, 1406346, -861918, -4074, -215543, 322843, -950761, 1281074, 1933838, 1556139, 530970, -1832242, 35335, -913177, 1456192, 6, 41, 45549, 12, 25405, 11, 592, 5, 17386, 36, 2, 2508, 55, 5, 2, 4, 6, 2373, 115, 75, 117, 67, 5, 51191, 22985, -115, -12, -77, -276, -8, -11, -901, -12, -143, -21, -3, -6863, -195, -5793, -21107, -769, -4258, -161, -19, -167, -21059, -40576, -3080, -37651, -7026 };
+		int[] output0 = new int[]{ 3739, 62063, 25454, 49125, 33731, 2974, 3514, 42653, 24771, 17034, 61292, 56429, 15773, 26370, 28694, 6630, 48709, 44328, 23205, 29659, 51605, 64158, 11996, 14711, 58496, 0, 0, 3479, 1, 3, 7, 65535, 65499, 65535, 0, 0, 65536, 1, 31750, 2357, 65064, 1, 65536, 65536, 65536, 65516, 0, 41393, 1, 65536, 32769, 32778, 43717, 32770, 39040, 32770, 32915, 32769, 37089, 32776, 32768, 33394, 32781, 32769, 32768, 32768, 32769, 33361, 32796, 32786, 32797, 32784, 32769, 44952, 38456, 32740, 32766, 32749, 32700, 32767, 32766, 32543, 32766, 32733, 32763, 32768, 31054, 32720, 31321, 27537, 32576, 31704, 32728, 32764, 32727, 27549, 22937, 31999, 23606, 31014 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Sigmoid", Fixed32.Sigmoid(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SigmoidFast()
+	public static void Fixed32_SigmoidFast()
+	{
+		int[] input0 = new int[]{ 102383, 40047, 210217, 220929, 128543, 147292, -41984, -21258, -61647, 79434, 234606, -75227, -237444, 202686, -139318, -224760, 67258, -116577, 216455, -33248, -121824, 155424, -150098, -9980, -182844, -656261, -952036, 1062356, -1871341, 2015313, 773795, -825576, 2010587, -886216, -2013824, 819019, 190953, 956562, -1168069, -228380, -1195986, 660265, -302795, -1659432, 1751109, -1885336, -768857, 741134, 1242484, -999040, 26, 2109, 3295, 19013, 33, 22890, 86, 157, 6005, 130, 393, 2047, 135, 130, 46512, 1623, 100, 5315, 16394, 543, 473, 23224, 3, 257, 20, -1138, -92, -6, -700, -5, -2, -985, -41933, -7540, -4057, -2, -930, -5, -2, -7, -63, -7, -42314, -10071, -34264, -597, -27, -2, -8, -34 };
+		int[] output0 = new int[]{ 54177, 42479, 62988, 63359, 57454, 59273, 22617, 27500, 18401, 50506, 63758, 15787, 1705, 62691, 6987, 2057, 48247, 9467, 63211, 24630, 8837, 59941, 6025, 30278, 3793, 3, 1, 65536, 0, 65536, 65535, 1, 65536, 1, 0, 65535, 62162, 65535, 0, 1950, 0, 65533, 640, 0, 65536, 0, 1, 65535, 65536, 1, 32774, 33295, 33591, 37488, 32776, 38433, 32789, 32807, 34268, 32800, 32866, 33279, 32801, 32800, 43931, 33173, 32793, 34096, 36845, 32903, 32886, 38513, 32768, 32832, 32773, 32484, 32745, 32767, 32593, 32767, 32768, 32522, 22629, 30886, 31754, 32768, 32536, 32767, 32768, 32767, 32753, 32767, 22543, 30256, 24392, 32619, 32762, 32768, 32766, 32760 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SigmoidFast", Fixed32.SigmoidFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SigmoidFastest()
+	public static void Fixed32_SigmoidFastest()
+	{
+		int[] input0 = new int[]{ -121000, 190847, 176415, 57785, 201067, 247013, -161858, -207075, 193583, -16091, -65453, -126063, 128236, 169683, 91952, -258350, -66906, 24858, -197909, 223576, 144728, -165987, -100046, 101542, -164251, 1395828, 418356, -1730621, -1022776, 1822648, 1640189, 676188, 274608, 1952631, -1399834, -905284, -1996255, -1246983, -361177, -1275748, -1583285, -1521148, 79403, -920200, 129476, 1172286, 1323482, -1034792, 1754032, -2060052, 79, 13612, 367, 4, 2274, 4, 640, 8, 163, 3, 95, 5, 13618, 33229, 816, 3348, 2723, 6588, 1859, 116, 55021, 11, 8, 30577, 8533, -1531, -2001, -2, -10, -137, -2, -73, -11, -26, -835, -3, -10, -329, -40, -4, -3928, -19065, -6598, -87, -10562, -2, -40, -869, -2967, -9768 };
+		int[] output0 = new int[]{ 8932, 62159, 61376, 46341, 62621, 64058, 5111, 2670, 62290, 28766, 17642, 8352, 57422, 60956, 52603, 1247, 17358, 38901, 3051, 63444, 59046, 4825, 11699, 54054, 4944, 65536, 65425, 0, 1, 65536, 65536, 65533, 64557, 65536, 0, 1, 0, 0, 264, 0, 0, 0, 50500, 1, 57555, 65536, 65536, 1, 65536, 0, 32787, 36161, 32860, 32769, 33340, 32769, 32929, 32770, 32809, 32768, 32791, 32769, 36163, 40902, 32973, 33610, 33453, 34421, 33236, 32797, 45764, 32770, 32770, 40272, 34905, 32383, 32264, 32768, 32766, 32734, 32768, 32750, 32766, 32762, 32558, 32768, 32766, 32685, 32758, 32767, 31780, 28039, 31113, 32747, 30128, 32768, 32758, 32549, 32021, 30324 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SigmoidFastest", Fixed32.SigmoidFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Tanh()
+	public static void Fixed64_Tanh()
+	{
+		long[] input0 = new long[]{ -7610157995L, 4457889850L, 2337751913L, 3812057737L, -1499106248L, -2661969529L, 16825026495L, 2470969481L, 169555640L, -13945045022L, -1259417720L, -10163676604L, -5077548922L, 6940589499L, -3556421065L, 14949484398L, 12321597325L, -10361604380L, 5709585610L, 14476685006L, -14930207582L, -12536695469L, 8566276027L, 16455492511L, 5458024906L, 77319294692L, -7800330947L, -50109857495L, -64909269214L, -19853178569L, -45259056853L, 78818558564L, -120193051255L, 114072579829L, 86164613480L, 112469150324L, -43615677908L, 38741776594L, 71881118689L, 67112250591L, 130169311100L, 123656016377L, -22887592010L, 54299288153L, -116253237622L, 129308408188L, 123285219577L, -47993889750L, -29188385997L, -126929772283L, 8623731L, 1115874L, 512L, 3546651L, 5L, 24L, 302795223L, 473114L, 1484236267L, 3184637L, 1445504267L, 2972163L, 927L, 5L, 20392176L, 3293951L, 23L, 16286L, 362409736L, 49484L, 524406L, 124L, 16180L, 761659909L, 1348549477L, -12L, -8323500L, -3L, -486893069L, -4281550L, -105222067L, -25L, -793920970L, -149L, -6576575L, -6542491L, -73879L, -4869L, -109413793L, -2850306L, -1L, -17619105L, -4321386L, -6L, -43786066L, -803L, -1522226L, -1866L, -1103742638L, -7205L };
+		long[] output0 = new long[]{ -4053654080L, 3337493048L, 2131318312L, 3050235896L, -1441056008L, -2366443016L, 4291569272L, 2230177680L, 169467592L, -4281990432L, -1224520696L, -4220022424L, -3556863752L, 3968717896L, -2918104808L, 4286833688L, 4267377696L, -4226568584L, 3732732072L, 4284832904L, -4286760416L, -4269999608L, 4138786496L, 4290931544L, 3667958320L, 4294967296L, -4073577880L, -4294967296L, -4294967296L, -4294137520L, -4294967288L, 4294967296L, -4294967296L, 4294967296L, 4294967296L, 4294967296L, -4294967280L, 4294967168L, 4294967296L, 4294967296L, 4294967296L, 4294967296L, -4294765304L, 4294967296L, -4294967296L, 4294967296L, 4294967296L, -4294967296L, -4294956552L, -4294967296L, 8623688L, 1115864L, 504L, 3546616L, 0L, 0L, 302294560L, 473080L, 1427844728L, 3184600L, 1393290760L, 2972152L, 888L, 0L, 20391984L, 3293912L, 0L, 16248L, 361552056L, 49464L, 524376L, 88L, 16152L, 753774688L, 1305914112L, 0L, -8323464L, 0L, -484817952L, -4281528L, -105200976L, 0L, -785000328L, -120L, -6576528L, -6542448L, -73848L, -4856L, -109390112L, -2850296L, 0L, -17618984L, -4321368L, 0L, -43784504L, -792L, -1522200L, -1848L, -1080070184L, -7192L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Tanh", Fixed64.Tanh(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.TanhFast()
+	public static void Fixed64_TanhFast()
+	{
+		long[] input0 = new long[]{ 16293543759L, -8966925900L, -8765286428L, 15966412495L, -6642256443L, -4076695465L, 17120886767L, 7880313115L, -246657416L, 11042404413L, -901466632L, 6049908538L, -7522536587L, -6978883931L, 172826104L, 14847407518L, -1556415720L, 10158781452L, -4432008698L, -14537741870L, -14561915742L, 12592261949L, -8896957356L, 13668403790L, 2164056345L, -88982921577L, -7365031875L, -35916031184L, -20744921289L, 109358466930L, -11687335237L, 135281099390L, 96717178349L, 17804269000L, 25917456204L, 127842348411L, 102754348527L, -123678189049L, -128546192251L, 22355789514L, 94439471595L, -62008462044L, -124520303609L, -95991078636L, 106222847473L, 52042516184L, -9456442436L, -108284076402L, -17772418632L, -122582604409L, 28117L, 660L, 773059463L, 196L, 207290572L, 10L, 4105289211L, 2205L, 7405L, 18L, 559934968L, 1144467L, 863L, 538759L, 3201L, 43588L, 87032744L, 7943823L, 5863045L, 158942L, 3L, 7904L, 22537885L, 40454975L, 176L, -52904760L, -78355382L, -7L, -1L, -260532526L, -7014453L, -3440L, -993404131L, -3705L, -15845L, -38L, -4L, -815954L, -5712181L, -48648L, -2071417789L, -118553L, -1760456L, -488018831L, -3053161L, -116L, -2188241388L, -22609L, -38027566L, -7936L };
+		long[] output0 = new long[]{ 4290615504L, -4164967016L, -4152377776L, 4289899776L, -3922201872L, -3175756072L, 4292006384L, 4081472024L, -246395416L, 4245043480L, -888470488L, 3810485728L, -4043897728L, -3974273328L, 172746448L, 4286437904L, -1491656488L, 4219854640L, -3327192544L, -4285116920L, -4285227048L, 4270635416L, -4160727544L, 4280209264L, 1997795208L, -4294967296L, -4025386872L, -4294966824L, -4294419480L, 4294967296L, -4257937672L, 4294967296L, 4294967296L, 4292813320L, 4294918024L, 4294967296L, 4294967296L, -4294967296L, -4294967296L, 4294708536L, 4294967296L, -4294967296L, -4294967296L, -4294967296L, 4294967296L, 4294967296L, -4191142288L, -4294967296L, -4292781152L, -4294967296L, 28096L, 640L, 764817432L, 192L, 207141584L, 0L, 3188654592L, 2176L, 7392L, 0L, 556769816L, 1144704L, 832L, 538872L, 3200L, 43592L, 87033416L, 7945560L, 5864344L, 158944L, 0L, 7904L, 22542296L, 40461360L, 160L, -52911368L, -78358608L, 0L, 0L, -260221008L, -7015984L, -3424L, -976073432L, -3680L, -15840L, -32L, 0L, -816120L, -5713432L, -48648L, -1924494960L, -118552L, -1760848L, -485916880L, -3053840L, -96L, -2016705584L, -22592L, -38033808L, -7936L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.TanhFast", Fixed64.TanhFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.TanhFastest()
+	public static void Fixed64_TanhFastest()
+	{
+		long[] input0 = new long[]{ -13775351726L, 2648152313L, 7558007115L, -11673989421L, 14926884574L, 15083208303L, -16738119855L, -10680713804L, -11488855357L, 15931131007L, -4599952506L, -16398381887L, -11770173789L, 4057641305L, 8647000188L, 1036048968L, 1425608728L, -10550979052L, -14985907902L, -15694896639L, 8204427275L, -4704164714L, -6825510731L, -14764569230L, 3774447065L, 49253586646L, 36094259664L, 120907269752L, 74489779682L, -52091469784L, -79411324772L, -31421761870L, -27205725900L, -71867837665L, 90498848234L, -81477372773L, 31922738894L, -107268947825L, -29245037133L, -14515611846L, -90298866794L, -92116027754L, -40014564690L, 131934795389L, -46714864981L, -41256803539L, 17391520456L, 112392031476L, -50538539479L, -62657201373L, 1284L, 820493404L, 446988L, 82L, 586720L, 12296963L, 452L, 1812461L, 200399L, 287L, 919L, 5L, 10668L, 172786452L, 17754936L, 2782886472L, 974957L, 710711544L, 39724353L, 190358L, 637831395L, 14416L, 50096463L, 871490L, 249620311L, -337536L, -1L, -1246L, -13512107L, -319L, -13L, -9102114L, -1019138L, -64010L, -3274667685L, -565L, -49886569L, -87L, -1453570L, -7L, -867175748L, -2041208837L, -244542L, -21L, -22L, -8L, -15601966L, -64511L, -155L, -2332L };
+		long[] output0 = new long[]{ -4280940928L, 2356771328L, 4047830928L, -4257745840L, 4286754984L, 4287321608L, -4291430840L, -4235979888L, -4254409200L, 4289821824L, -3392017184L, -4290819408L, -4259349008L, 3167341760L, 4144394616L, 1016089128L, 1375883544L, -4232367168L, -4286974176L, -4289221216L, 4110855928L, -3430589064L, -3951316400L, -4286112928L, 3031478160L, 4294967296L, 4294966864L, 4294967296L, 4294967296L, -4294967296L, -4294967296L, -4294963488L, -4294940232L, -4294967296L, 4294967296L, -4294967296L, 4294964280L, -4294967296L, -4294956816L, -4285016256L, -4294967296L, -4294967296L, -4294967224L, 4294967296L, -4294967296L, -4294967248L, 4292354688L, 4294967296L, -4294967296L, -4294967296L, 1288L, 809660112L, 451376L, 64L, 592496L, 12414088L, 448L, 1830240L, 202360L, 256L, 904L, 0L, 10760L, 173652400L, 17921304L, 2449279112L, 984536L, 703521952L, 40072088L, 192208L, 632686368L, 14536L, 50520368L, 880064L, 250331968L, -340864L, 0L, -1224L, -13640336L, -288L, 0L, -9189624L, -1029160L, -64624L, -2759466512L, -544L, -50309000L, -64L, -1467856L, 0L, -854587656L, -1899841016L, -246920L, 0L, 0L, 0L, -15749112L, -65112L, -128L, -2320L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.TanhFastest", Fixed64.TanhFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Tanh()
+	public static void Fixed32_Tanh()
+	{
+		int[] input0 = new int[]{ 164230, -173186, -116462, 119192, 6349, -26397, -168302, 156965, 100528, -37890, -224449, 64028, -203294, 170109, 80359, 24089, 50563, 140156, -77812, 236953, 211098, 76934, 220973, -57097, 210743, 1542193, -312205, 628455, 1348216, -1467511, 1949499, 1268835, -1815590, -875828, 1092670, -856683, 1494157, -1266905, -1426905, -128322, 591459, 100845, -1262998, 896676, 709293, 1680989, -1492223, 2018911, 1980834, -50780, 44, 11286, 2512, 13, 7424, 11, 26, 20192, 10665, 1625, 2, 490, 52108, 558, 246, 32, 641, 10197, 3, 82, 2602, 126, 1107, 19251, 50, -102, -210, -17, -3640, -2, -3696, -202, -2293, -64, -14175, -8, -6, -19831, -364, -962, -3, -47709, -96, -424, -205, -6, -584, -1857, -27, -127 };
+		int[] output0 = new int[]{ 64669, -64875, -61890, 62174, 6329, -25056, -64769, 64455, 59709, -34165, -65397, 49267, -65271, 64810, 55146, 23059, 42455, 63741, -54378, 65441, 65327, 54101, 65381, -46006, 65325, 65536, -65526, 65536, 65536, -65536, 65536, 65536, -65536, -65536, 65536, -65536, 65536, -65536, -65536, -62976, 65536, 59763, -65536, 65536, 65536, 65536, -65536, 65536, 65536, -42581, 43, 11175, 2510, 12, 7392, 10, 25, 19576, 10571, 1624, 1, 489, 43338, 557, 245, 31, 640, 10115, 2, 81, 2600, 125, 1106, 18715, 49, -101, -209, -16, -3636, -1, -3692, -201, -2292, -63, -13958, -7, -5, -19247, -363, -961, -2, -40752, -95, -423, -204, -5, -583, -1856, -26, -126 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Tanh", Fixed32.Tanh(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.TanhFast()
+	public static void Fixed32_TanhFast()
+	{
+		int[] input0 = new int[]{ -154985, -148690, -4964, 138019, 151073, -131305, -247586, -22093, -136062, 133017, 104450, -261316, -141321, -82999, -259617, -140396, -32494, 140812, 33719, -107822, 35989, -87509, -112802, -34831, 96666, -850722, -1686527, 63545, -618667, -1753929, -284848, 1908151, 128791, 1251585, -1470481, 1107426, 714821, -710363, -1999027, 136828, -154205, 1120811, 1506842, -2064776, 263900, 1286378, -25711, 819126, -442399, -238956, 6, 1889, 308, 3, 50113, 17192, 32166, 3, 4, 329, 9, 412, 5, 10, 56, 4590, 267, 178, 14, 24, 688, 6, 4633, 2, 11320, -8314, -275, -35, -17075, -18371, -8478, -131, -7, -25567, -44476, -6197, -266, -329, -10536, -36, -11482, -1177, -27, -507, -105, -39219, -1948, -2914, -2506, -9943 };
+		int[] output0 = new int[]{ -64388, -64148, -4954, 63622, 64244, -63194, -65467, -21292, -63506, 63312, 60340, -65490, -63803, -55891, -65488, -63754, -30069, 63776, 31028, -60830, 32760, -57051, -61473, -31884, 59016, -65536, -65536, 49056, -65536, -65536, -65514, 65536, 63011, 65536, -65536, 65536, 65536, -65536, -65536, 63552, -64361, 65536, 65536, -65536, 65494, 65536, -24467, 65536, -65535, -65446, 6, 1888, 308, 3, 42193, 16808, 29810, 3, 4, 329, 9, 412, 5, 10, 56, 4582, 267, 178, 14, 24, 688, 6, 4625, 2, 11208, -8269, -275, -35, -16699, -17904, -8430, -131, -7, -24343, -38708, -6178, -266, -329, -10446, -36, -11365, -1177, -27, -507, -105, -35122, -1947, -2912, -2504, -9867 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.TanhFast", Fixed32.TanhFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.TanhFastest()
+	public static void Fixed32_TanhFastest()
+	{
+		int[] input0 = new int[]{ 140796, -66945, -202360, 127465, -245114, 131140, 192590, -119273, -17117, 182390, 203211, -216432, 5321, -253169, -152831, -203335, 204487, 43647, 146468, -234804, 49588, 174564, -65716, -196926, -49139, 1456252, -1929707, 1427314, 170397, 1970739, -1893291, 632064, -595401, 1559907, 224298, 696394, -1741086, -2012623, 2044763, 1196012, -1934677, -1251761, -1568723, 361417, 1192586, 165519, 1660229, 501244, -1735939, 445722, 313, 5, 4, 10, 44890, 33547, 63958, 58840, 66, 13, 3220, 2, 4034, 352, 8130, 23, 3921, 1523, 248, 562, 2, 16939, 979, 61710, 2, -119, -3113, -7267, -68, -16408, -39526, -158, -5087, -33118, -305, -37238, -750, -16, -25259, -1233, -2084, -5, -2434, -8383, -4, -2, -264, -1377, -7148, -592 };
+		int[] output0 = new int[]{ 63776, -50490, -65263, 62912, -65462, 63183, 65170, -62180, -16741, 65036, 65270, -65358, 5321, -65478, -64310, -65271, 65281, 38163, 64053, -65434, 41883, 64902, -49986, -65214, -41617, 65536, -65536, 65536, 64816, 65536, -65536, 65536, -65536, 65536, 65396, 65536, -65536, -65536, 65536, 65536, -65536, -65536, -65536, 65533, 65536, 64701, 65536, 65535, -65536, 65535, 315, 5, 4, 10, 38975, 30895, 49239, 46875, 66, 13, 3232, 2, 4043, 355, 8088, 23, 3931, 1533, 250, 566, 2, 16574, 986, 48236, 2, -120, -3125, -7241, -68, -16073, -35341, -159, -5089, -30560, -307, -33688, -756, -16, -24075, -1242, -2096, -5, -2447, -8336, -4, -2, -266, -1387, -7124, -597 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.TanhFastest", Fixed32.TanhFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.Softplus()
+	public static void Fixed64_Softplus()
+	{
+		long[] input0 = new long[]{ 1208702920L, -108018376L, 8834798332L, -11390169165L, 13190315006L, 14674513966L, 7024238443L, 8951270492L, -15503159567L, -35152552L, 12147897117L, 15851472319L, 5677065002L, 5526363530L, 1568687336L, -5055905018L, 1972321272L, 6210441114L, -11480053245L, -2186836025L, 8258717563L, 6505533723L, 1071652456L, -8974492316L, 15913264991L, 129299939452L, -101663666671L, 119114565495L, 29563279693L, 77428365924L, -37185077201L, 82065206502L, 118374002423L, -62256878812L, -52386709080L, 135870226559L, 83930381799L, 23640348107L, -90965903338L, -84947915623L, 55178951641L, 116658083958L, -112559957620L, 71097948001L, 67745301215L, 19985288009L, 80857021541L, -99925781358L, -8293002051L, -53969568601L, 4126L, 1895599L, 12433L, 26983L, 453438008L, 140592256L, 2005543236L, 98387L, 95L, 630510024L, 47516149L, 26787773L, 29L, 374L, 19L, 3L, 1L, 5934L, 2427L, 204760L, 188021L, 2277444250L, 84916L, 2462721241L, 12194056L, -72463025L, -586777L, -27657427L, -55310L, -5767L, -49L, -3732987474L, -29169L, -845L, -8210L, -7388574L, -3961L, -34178L, -4084L, -29215L, -1L, -581L, -4641L, -289L, -6246L, -902032427L, -26989348L, -85450578L, -1034653L, -4579084L };
+		long[] output0 = new long[]{ 3623775976L, 2923374872L, 9351483848L, 292644072L, 13384991802L, 14813216574L, 7788878471L, 9454911984L, 114687096L, 2959504184L, 12394541105L, 15957334847L, 6692311942L, 6573778506L, 3832611692L, 1153687008L, 4075439500L, 7118774398L, 286781196L, 2021330376L, 8844718659L, 7359158131L, 3546208352L, 501078192L, 16017633579L, 129299939452L, 0L, 119114565495L, 29567679009L, 77428365984L, 746232L, 82065206522L, 118374002423L, 2172L, 21660L, 135870226559L, 83930381811L, 23657791663L, 4L, 8L, 55178962941L, 116658083958L, 0L, 71097948277L, 67745301815L, 20026030229L, 80857021565L, 0L, 581643624L, 14984L, 2977046550L, 2977992399L, 2977050697L, 2977057983L, 3209744636L, 3047915856L, 4095829308L, 2977093675L, 2977044535L, 3303859120L, 3000868289L, 2990459277L, 2977044501L, 2977044686L, 2977044491L, 2977044475L, 2977044473L, 2977047462L, 2977045715L, 2977146864L, 2977138509L, 4264984906L, 2977086956L, 4382553293L, 2983145832L, 2940965812L, 2976751104L, 2963238036L, 2977016824L, 2977041592L, 2977044472L, 1503960748L, 2977029912L, 2977044056L, 2977040376L, 2973351788L, 2977042520L, 2977027384L, 2977042456L, 2977029880L, 2977044472L, 2977044184L, 2977042168L, 2977044344L, 2977041368L, 2549665584L, 2963571020L, 2934531708L, 2976527188L, 2974755544L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.Softplus", Fixed64.Softplus(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SoftplusFast()
+	public static void Fixed64_SoftplusFast()
+	{
+		long[] input0 = new long[]{ 13080852414L, -6573115643L, 3474053241L, -12183221373L, -11507291341L, 3859770953L, -5671850666L, -6050825946L, -11031790797L, -6649612043L, 10143312140L, 8369599019L, 10330343180L, -12487777997L, 3399372201L, 9559032572L, 3488821865L, 10220647996L, 14454910286L, 6527293035L, -7940340731L, 1045902040L, -12310827469L, -12853517901L, -6334793562L, -19042507592L, -122360356344L, 116179659894L, 101371424879L, 114796594933L, -43630436052L, 114765326581L, 36121704912L, -50756767191L, -110779196659L, -51427644375L, 133579568126L, -58006407899L, 6757664963L, -6659390403L, 125957544826L, 23204548170L, 4349454530L, 116775783542L, 74028556770L, 34369241424L, -104417022064L, 38482073297L, -54748962265L, -51849420632L, 17L, 1L, 43L, 19993L, 8L, 2366L, 40L, 37803L, 98473155L, 11861963L, 234513L, 9361L, 24213L, 328L, 1984760037L, 284973622L, 12L, 47306L, 2L, 569L, 42821571L, 1025L, 425L, 19315L, 11189383L, -3923246L, -1L, -122L, -2723L, -4492719L, -981L, -9915L, -977481L, -234179L, -39677730L, -1878L, -15765324L, -60L, -135L, -15601519L, -25L, -83210L, -26504L, -40935701L, -701288504L, -181650L, -17L, -282L, -1754208366L, -388087065L };
+		long[] output0 = new long[]{ 13280442822L, 841524248L, 5056153557L, 244679132L, 285024800L, 5326658045L, 1016345092L, 939219444L, 317196288L, 828013032L, 10530205332L, 8941620099L, 10701444996L, 228371612L, 5004624413L, 9999500244L, 5066376553L, 10600935256L, 14600767798L, 7377005691L, 627943964L, 3531768100L, 237713112L, 210175832L, 884904740L, 50685684L, 0L, 116179659894L, 101371424879L, 114796594933L, 166404L, 114765326581L, 36122660788L, 31660L, 0L, 27080L, 133579568126L, 5852L, 7566927307L, 826300128L, 125957544826L, 23223850870L, 5680316698L, 116775783542L, 74028556906L, 34370678800L, 0L, 38482625053L, 12492L, 24548L, 2977044489L, 2977044473L, 2977044515L, 2977054477L, 2977044480L, 2977045682L, 2977044512L, 2977063387L, 3026553871L, 2982978091L, 2977161705L, 2977049157L, 2977056585L, 2977044636L, 4083054137L, 3121880606L, 2977044484L, 2977068122L, 2977044474L, 2977044781L, 2998503799L, 2977044981L, 2977044701L, 2977054151L, 2982641431L, 2975082824L, 2977044472L, 2977044436L, 2977043124L, 2974798156L, 2977043988L, 2977039540L, 2976555636L, 2976927352L, 2957246928L, 2977043540L, 2969167128L, 2977044472L, 2977044404L, 2969248916L, 2977044472L, 2977002860L, 2977031220L, 2956620760L, 2640701748L, 2976953632L, 2977044472L, 2977044340L, 2188872924L, 2787371552L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SoftplusFast", Fixed64.SoftplusFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SoftplusFastest()
+	public static void Fixed64_SoftplusFastest()
+	{
+		long[] input0 = new long[]{ 3143961689L, -895918312L, -14143833438L, 7258297275L, 10710561676L, 7591776395L, 3106556009L, -8221432891L, -5737627834L, -15069111839L, 8226236379L, -3809689577L, -14094395166L, 8059157451L, 4987357946L, -4050449657L, 14659553246L, 16081233919L, -17043080655L, -2650339753L, 3667062745L, 15886255231L, 13588287982L, 15991378383L, 17172850479L, -48677816790L, -72187277537L, -76163442531L, -585104576L, -49437982295L, 1627177408L, -55109389273L, -90623511530L, -47318831702L, 73288617314L, 120222622967L, 128555078651L, -28608036557L, -77451430884L, -107208228465L, -41162301139L, -17958693960L, 118918396151L, -70776189024L, -36862324689L, 90251091562L, -100063512174L, -32669762895L, -116477606006L, 103262651632L, 219957L, 839483879L, 29264917L, 87280L, 2524351L, 1149690L, 373443L, 15L, 7134360L, 51128L, 45516L, 3467L, 22311885L, 1L, 224501L, 17280L, 128L, 21866343L, 2108773933L, 6577389L, 9822L, 129553L, 16700053L, 409155686L, 5L, -45L, -1L, -1949283L, -595801L, -44L, -63L, -177046835L, -25L, -985523L, -23690303L, -382341L, -112670L, -2151141L, -2449203L, -21L, -2866L, -137169445L, -3922204L, -10629977L, -1081964L, -2930053885L, -2961760L, -724377787L, -4148618L, -831882008L };
+		long[] output0 = new long[]{ 4830577057L, 2552482576L, 156547308L, 7985844751L, 11051396972L, 8268751099L, 4805383921L, 590405628L, 1002244808L, 126721172L, 8816026411L, 1481111196L, 158343104L, 8670758187L, 6157623666L, 1412315048L, 14798593454L, 16181647075L, 80403844L, 1853477720L, 5190313045L, 15991317559L, 13766197502L, 16093909263L, 17250927163L, 51332L, 212L, 84L, 2694578596L, 43052L, 3867110280L, 11476L, 4L, 70520L, 73288617478L, 120222622967L, 128555078651L, 5498336L, 60L, 0L, 295864L, 65159016L, 118918396151L, 300L, 805128L, 90251091566L, 0L, 2136776L, 0L, 103262651632L, 2977154593L, 3417356827L, 2991716857L, 2977088180L, 2978308191L, 2977619990L, 2977231395L, 2977044487L, 2980616884L, 2977070088L, 2977067260L, 2977046211L, 2988226425L, 2977044473L, 2977156869L, 2977053120L, 2977044536L, 2988002867L, 4159548053L, 2980337897L, 2977049402L, 2977109325L, 2985411293L, 3186619602L, 2977044477L, 2977044472L, 2977044472L, 2976070984L, 2976746908L, 2977044472L, 2977044472L, 2889509828L, 2977044472L, 2976552284L, 2965227892L, 2976853508L, 2976988208L, 2975970188L, 2975821360L, 2977044472L, 2977043064L, 2909069592L, 2975085892L, 2971738336L, 2976504116L, 1757409564L, 2975565420L, 2630224180L, 2974972848L, 2581306996L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SoftplusFastest", Fixed64.SoftplusFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.Softplus()
+	public static void Fixed32_Softplus()
+	{
+		int[] input0 = new int[]{ 181514, -164016, 147461, 199517, 245491, -30087, -116310, -127158, -136256, -54999, -91754, 31837, -119100, 187458, -199084, -88847, -99995, -194909, -119175, 114691, -190791, 48857, -236591, 79775, 21157, -122231, -653433, 1728300, -473544, -1499288, 774586, -812186, -1435014, 1244669, 1220372, -1720342, 34816, 606809, 1910004, -120405, 1704236, -28540, -2051519, -61472, -1196372, 1117923, 1208814, -493456, 511896, -1826635, 4, 7, 35534, 25184, 1029, 27, 8, 7, 68, 352, 5, 89, 17026, 5, 3227, 2, 131, 282, 3, 2, 10322, 2004, 12, 8311, 9322, -1599, -851, -699, -188, -6239, -2418, -44081, -40, -57, -4, -646, -89, -26, -15, -537, -39544, -103, -47, -233, -96, -550, -1298, -26609, -6311, -15 };
+		int[] output0 = new int[]{ 185498, 5156, 154027, 202566, 247020, 32094, 10262, 8797, 7721, 23534, 14444, 63259, 9865, 191106, 3068, 15029, 12894, 3265, 9855, 125191, 3472, 74305, 1749, 96769, 56854, 9437, 3, 1728300, 47, 0, 774586, 0, 0, 1244669, 1220372, 0, 65119, 606815, 1910004, 9684, 1704236, 32697, 0, 21647, 0, 1117923, 1208814, 35, 511922, 0, 45428, 45429, 65572, 59220, 45942, 45439, 45430, 45429, 45460, 45602, 45428, 45470, 54490, 45428, 47059, 45427, 45491, 45567, 45427, 45427, 50790, 46435, 45432, 49713, 50252, 44631, 45001, 45077, 45332, 42380, 44228, 27024, 45406, 45397, 45424, 45103, 45381, 45413, 45418, 45158, 28592, 45374, 45402, 45309, 45378, 45151, 44780, 33462, 42346, 45418 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.Softplus", Fixed32.Softplus(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SoftplusFast()
+	public static void Fixed32_SoftplusFast()
+	{
+		int[] input0 = new int[]{ 114979, -113276, -124867, 98977, 89285, 81649, -30305, 229275, 106199, -93090, -13222, -15253, 230850, 56466, 152022, 212444, 130091, 182937, 95738, 88998, -136289, -10187, 234188, -98357, 101246, -1760111, -1182416, 1317067, -1757146, 1037211, -99572, 1937195, -729691, -943453, 13101, 1969916, 95812, 1253122, 565425, 308209, 826477, -1386725, 1103932, -454828, 1503248, 1094498, 1266599, 1366091, 366471, 1654002, 43, 12016, 243, 13991, 2, 23, 66, 38740, 62653, 922, 189, 1372, 14701, 41162, 13241, 414, 9, 2018, 5, 10116, 106, 38710, 18, 6, 49342, -4, -3469, -642, -224, -32371, -36, -118, -21, -13, -219, -1542, -362, -277, -28, -31, -1434, -776, -8459, -3, -8, -4, -51, -8895, -580, -72 };
+		int[] output0 = new int[]{ 125436, 10711, 9089, 112054, 104225, 98219, 32009, 231227, 118027, 14182, 39148, 38242, 232757, 79561, 158167, 214957, 138527, 186838, 109413, 103996, 7717, 40530, 236001, 13190, 113918, 0, 0, 1317067, 0, 1037211, 12970, 1937195, 0, 0, 52303, 1969916, 109473, 1253122, 565436, 308800, 826477, 0, 1103932, 63, 1503248, 1094498, 1266599, 1366091, 366714, 1654002, 45447, 51709, 45547, 52794, 45427, 45437, 45459, 67617, 83970, 45888, 45520, 46115, 53188, 69186, 52380, 45633, 45430, 46442, 45428, 50679, 45479, 67598, 45435, 45429, 74635, 45424, 43714, 45105, 45314, 31219, 45408, 45367, 45415, 45419, 45316, 44659, 45245, 45287, 45412, 45410, 44712, 45039, 41332, 45424, 45422, 45424, 45400, 41129, 45136, 45390 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SoftplusFast", Fixed32.SoftplusFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SoftplusFastest()
+	public static void Fixed32_SoftplusFastest()
+	{
+		int[] input0 = new int[]{ 166936, -241743, -114408, -124529, 77014, 256878, 200270, 94599, -233516, 122786, -210406, 16332, 58617, 9708, 202609, -65253, -65820, -110153, 90039, 256893, 219926, 192564, -88174, 136516, 20622, 1657525, -1753075, 1451241, -741532, -98818, -1929950, 41711, 702055, 1055752, -1427599, -1290068, -1564597, -1436809, 471448, 1873687, -439807, -1562480, -430092, 959268, -1663198, 633688, -273846, -1905879, 1169273, 1075313, 4649, 7, 39, 61819, 50, 39423, 3117, 452, 3684, 4958, 25159, 2, 82, 816, 2730, 910, 15897, 15301, 83, 2721, 26, 19, 2292, 3756, 970, -7538, -264, -1057, -1850, -20506, -240, -2, -4, -725, -3994, -26746, -20, -2187, -194, -17, -310, -1085, -182, -15397, -2, -83, -6012, -10011, -2, -421 };
+		int[] output0 = new int[]{ 171878, 1619, 10542, 9127, 94653, 258164, 203286, 108485, 1833, 132143, 2592, 54099, 81075, 50461, 205522, 20605, 20454, 11195, 104820, 258179, 222171, 195943, 15163, 144213, 56543, 1657525, 0, 1451241, 0, 13107, 0, 69550, 702056, 1055752, 0, 0, 0, 0, 471497, 1873687, 79, 0, 92, 959268, 0, 633692, 997, 0, 1169273, 1075313, 47793, 45429, 45445, 83365, 45451, 68063, 47004, 45652, 47295, 47953, 59203, 45427, 45467, 45835, 46806, 45883, 53855, 53522, 45467, 46801, 45439, 45435, 46583, 47332, 45913, 41767, 45294, 44900, 44508, 35970, 45306, 45425, 45424, 45064, 43461, 33406, 45416, 44342, 45329, 45417, 45271, 44886, 45335, 38179, 45425, 45384, 42490, 40613, 45425, 45216 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SoftplusFastest", Fixed32.SoftplusFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Sin()
 	public static void Fixed64_Sin()
 	{
@@ -911,6 +1290,15 @@ class UnitTest
 			Util.Check("Fixed64.SinFastest", Fixed64.SinFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.SinUltra()
+	public static void Fixed64_SinUltra()
+	{
+		long[] input0 = new long[]{ 91483076642L, -274590796327L, 272105915926L, 422998853196L, -253684045918L, -222566279503L, -79489148637L, -704101000L, 336481375156L, 254731500718L, 248818090315L, -121881252256L, -226751910305L, -212376661898L, -87799638640L, 185900421486L, -384096802778L, -292602458736L, 312618988345L, 162036481875L, -101919497847L, 203609110294L, -284477483932L, -55025424625L, -343916119560L, -262826921522L, 243711853113L, 411664156391L, -338874202757L, 171473791479L, 267765829924L, -20647426209L, -286610375933L, -185039671886L, -235879636709L, 177591265882L, -354074058764L, 209294279097L, 347517360361L, -390392937581L, 350770066363L, -414165887592L, -241122600312L, -174322513081L, -156227247872L, 126116909458L, 281172727130L, -201763099493L, 218005923101L, 158255883873L, 197263319491857L, -192382216689584L, -234884802309376L, -98003721845636L, -70723993432933L, 317370695947787L, -419610041995396L, -102365389047667L, 337418243157122L, -420353853995742L, -36781403017127L, -61656575428711L, -91326627842527L, -264489145923162L, 416462400393930L, -160031213074520L, -264767605923292L, 387784491180576L, -405993754789055L, 164105825076417L, 110477750651445L, -163894352276319L, -210623089498079L, 273515196327365L, 240763145112114L, -117250339854598L, 15234981007094L, 319341758748705L, -328294906352874L, -40536299418876L, -114502919053319L, 15978223007440L, -235838496309820L, -67633357031494L, 403707201587990L, 30651317014273L, -215259353500237L, 240890075512173L, 315181051146767L, -123753603057627L, 167704578278093L, 177788059882789L, 301372765540337L, 338374484757567L, 75885195035336L, -17070087807948L, 106657469849666L, -406130183989119L, -161288183875105L, -425692764398228L };
+		long[] output0 = new long[]{ 2737388572L, -3830104308L, 2144161956L, -3823031628L, -2512230676L, -4294122516L, 1440573308L, -700906268L, 839131760L, 1596804108L, 4219800148L, 443099816L, -2468436356L, 3133258828L, -4293802836L, -2763341652L, -4270636036L, 3586292424L, -2173501160L, 120008660L, 4234306364L, -1197371956L, 1110842240L, -1042745760L, 4291799284L, 4285103828L, 831870164L, 4292897400L, 1514848180L, 3407336916L, -2012772220L, 4275468776L, 2953304056L, 3362505880L, 4287482436L, -2089013196L, -2952200964L, -4291951920L, -2985727060L, -898404916L, -48908832L, -3515528548L, 1703765944L, -1075340252L, 4165444400L, -3806860484L, 2088390024L, -630182580L, 2032546752L, -3233021368L, -3900329580L, 1483468656L, 1926601996L, 3316282868L, 4288228964L, -948394876L, -3163054076L, -4270217844L, 2061623504L, 4036908164L, 615593544L, 4292412680L, -4179269912L, 1355394616L, 208015344L, -3314312556L, -4268546408L, -4089087044L, 1695927060L, 3125550852L, -2942622528L, -4136506316L, 2933050100L, 2079407928L, -4292879960L, 3537842736L, -1319666248L, -1960109576L, -3558269320L, -2922236848L, -992046992L, 2332871884L, -4272601700L, -4266265952L, -3713563000L, -3889088504L, 3913449844L, 1113535280L, 2618692352L, 3739827544L, 386698220L, 3320230392L, -4183863616L, -3394553804L, 350617296L, 1370642456L, 3941733812L, 2942891872L, 4212640008L, 911089884L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SinUltra", Fixed64.SinUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Sin()
 	public static void Fixed32_Sin()
 	{
@@ -938,6 +1326,15 @@ class UnitTest
 			Util.Check("Fixed32.SinFastest", Fixed32.SinFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.SinUltra()
+	public static void Fixed32_SinUltra()
+	{
+		int[] input0 = new int[]{ -1211791, -113132, -254986, -2817130, 5250574, 1416490, 1716492, -1183783, -2541752, -2575810, 6551728, -2722822, 3888118, -4075058, -291525, 4098703, 3716585, 4850199, 5126488, -1036284, 1409248, 1708376, 3982791, 2274936, 3253449, -2832492, 3143318, -2165347, 960834, 5779024, -1767220, -899112, 9996, -5885301, -3095327, 4523293, -732168, 2682690, 1666321, 6161749, 4362075, 5358328, -5791256, -1271530, 1061523, -5812025, -4475212, -3326749, 6532363, -3031715, -2147483648, -2147483648, -802510531, -2147483648, 1078324326, -2147483648, -2147483648, -2147483648, 483019265, 1529466434, -2147483648, -2147483648, -2147483648, -1767176194, -2147483648, 897241562, -2147483648, -2147483648, -2147483648, 1738781760, -1722728318, -2147483648, -2147483648, -2147483648, 1155239426, -2147483648, 946033462, -1299278531, -2147483648, -2147483648, -2147483648, -83531790, -2144110941, -2147483648, 1715447757, 1434134482, -2147483648, 1560360398, -410025827, -175159072, -2147483648, 1797754319, -2147483648, -2147483648, -2147483648, 480235086, -2147483648, -2147483648, -462940359, -2147483648 };
+		int[] output0 = new int[]{ 23029, -64742, 44629, 55011, -65531, 24138, 57131, 46389, -57950, -65494, -34784, 42530, 23225, 39731, 63260, -18778, 10564, -64465, 20354, 6834, 30710, 52729, -57870, -10133, -38172, 45238, -48770, -65438, 56738, 14065, -63294, -59899, 9956, -63209, 7001, -6221, 64515, -6145, 18947, -14746, -36272, 5249, -25698, -34390, -30819, -43205, 48301, -31227, -49451, -49817, -60804, -60804, 36420, -60804, -64610, -60804, -60804, -60804, 7370, 57984, -60804, -60804, -60804, 41157, -60804, -15644, -60804, -60804, -60804, -53465, 56590, -60804, -60804, -60804, -5130, -60804, 18940, -60447, -60804, -60804, -60804, 51031, 609, -60804, -6184, -60567, -60804, 52157, 65523, -46089, -60804, -48497, -60804, -60804, -60804, 65476, -60804, -60804, -65484, -60804 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SinUltra", Fixed32.SinUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Cos()
 	public static void Fixed64_Cos()
 	{
@@ -965,6 +1362,15 @@ class UnitTest
 			Util.Check("Fixed64.CosFastest", Fixed64.CosFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed64.CosUltra()
+	public static void Fixed64_CosUltra()
+	{
+		long[] input0 = new long[]{ -268661601525L, -351087131563L, -244419447513L, -126950949459L, 400148213186L, 399648772386L, 409429982390L, -353872303964L, -47439463822L, -338366313957L, -328923227153L, -138744145064L, -87175534640L, 62112762228L, -102721739047L, 313750032746L, 270851209526L, -342291091559L, 250621409916L, -345469331560L, -96094875044L, -213677152299L, 56133813826L, 339273871557L, -362453782768L, -221352327503L, 289772042334L, 56243729826L, 377493878775L, 109428146250L, 144359287467L, 20326281409L, -387283284780L, -103669857048L, 139960781065L, 398938173985L, 45269165021L, 291724118735L, -213852701499L, 234101736709L, -298581027939L, 63281800L, 219526894702L, -175144980681L, -141067370265L, -408420193590L, 424596000397L, 328990743153L, -350721763563L, -33506467815L, 10446596264864L, 42621364119847L, -20446752149521L, -30390078394151L, -9882442104601L, 37451228037439L, 2227578421037L, -15419658947180L, -19399389629033L, 19200381108940L, -31961999954883L, -7631047703553L, -30186945314056L, 27262911952695L, -5322887182478L, 8024722103736L, -18095758988426L, -41300240719231L, 35164871076374L, -7216318343360L, -16101586187497L, 40862382039028L, 30105833954019L, -41297705639230L, 38260842597816L, 33333857275522L, -370731740172L, -19821793509230L, 5084451222367L, -38353031877859L, -21645159830079L, 39027802878173L, -2253123621049L, -1849638300861L, -42453454599768L, 14764237586875L, -20470292669532L, 34611422876117L, 42465129359774L, 19494523029077L, -5283433982460L, -23003097510711L, 5622128542618L, 2364021701100L, 12422500665784L, 20722617869649L, -12756399465940L, 37639450477527L, 30758062074322L, 20818213829694L };
+		long[] output0 = new long[]{ 4128359120L, 4286278832L, 4019871836L, -1215969084L, 2020474204L, 1567041440L, 2024083424L, 3254564512L, 213741496L, -4169434568L, 1615356024L, 2709980900L, 527868940L, -1369668780L, 1492067632L, -3010586180L, 4180967760L, -1730687472L, -991121592L, 1372295332L, -3984005504L, 3738080372L, 3762086636L, -3860467724L, -3898937824L, 1263752776L, -327937816L, 3707852336L, 4283640560L, 4041098468L, -2511194416L, 86716156L, -2551164172L, 2337648928L, 1670712248L, 887062920L, -1889363240L, 1585284200L, 3821158472L, -1951969516L, 3949291076L, 4294190748L, 2843719008L, -4286502168L, 607451444L, 2850632504L, -433930304L, 1552668576L, 4293774328L, 226012596L, 3298495784L, -3195919096L, -1880387592L, 2753326008L, 1192054176L, 1281976924L, -4120547184L, -3362832964L, 2873469100L, -4289750656L, -3284808736L, 731299944L, -3276026820L, -229167744L, 116170500L, -2845940956L, -4001892628L, -3860581952L, 3830857848L, -3611008220L, -2238010372L, 1263590064L, -3373008952L, -2160238468L, 1312766608L, 689307580L, -326471620L, -4263321652L, -3628902296L, 920531812L, 3679588788L, 803836036L, -4289619340L, -4156569664L, 2267133080L, 3380823624L, -4082994920L, -3930779104L, -3565599028L, -3342024200L, 902874540L, -3570107068L, -2172828000L, -3450141976L, -2069469124L, 3480645236L, -1249340392L, 619637792L, 679724164L, -4020371284L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.CosUltra", Fixed64.CosUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed32.Cos()
 	public static void Fixed32_Cos()
 	{
@@ -992,6 +1398,123 @@ class UnitTest
 			Util.Check("Fixed32.CosFastest", Fixed32.CosFastest(input0[ndx]), output0[ndx], input0[ndx]);
 	}
 
+	// Fixed32.CosUltra()
+	public static void Fixed32_CosUltra()
+	{
+		int[] input0 = new int[]{ -3355771, 3718561, -6271361, -926930, 5104869, -4947510, 286329, 5334332, -4274233, -2152693, -4588214, 438492, -5351679, 2361504, -3235795, -1739382, 2160282, 5580839, -2401043, 1512288, 3678100, 2156404, 1973151, -2271583, 1915858, -1551247, 530079, 6089328, 5600583, 224317, -3730215, 2868845, 5471790, 6501306, 2258191, -4207110, -677684, 3856072, -4701299, -4143405, -1371152, -2039391, -3779499, 6315410, -6309629, 6435961, -3143582, -5582006, -1318419, -5183126, -208351338, 599981885, -358200212, 35833562, 198400938, 104142326, -480819038, 255382173, 371081045, 10251618, 107600977, 75060080, 628734943, 205504965, -497607788, -90345909, 152030185, -529938612, -645028754, -558228490, 549190268, 485781012, 372853891, -481123845, -367015886, -83610821, -61769535, 221134089, -251555378, 203349676, -496126445, -44151380, 85414858, 423010917, -424576960, -317643458, -10275282, -144014486, -203630242, -533683159, -595252011, 332209340, -640833790, 174978423, 133418494, 443184643, -177314079, 71905063, 473788870, 114742974 };
+		int[] output0 = new int[]{ 38674, 64328, 8182, -438, -52339, 65239, -22064, 62870, -47779, 9094, 40962, 60161, 65518, -6193, 41187, 10612, 1536, -61914, 31917, -30626, 59693, 5408, 17021, -65178, -37622, 7077, -15219, 15499, -52756, -62958, 61101, 64129, -15621, 15697, -65206, 13483, -39916, -43187, -56855, 60576, -31520, 62659, 28437, -34081, -29019, -44919, -43575, -61522, 19545, -55922, 65188, 60461, 51376, 64893, 27528, 55519, -29875, 20800, 29875, 52074, -24212, -14007, 50538, 59081, -61843, -54457, 17458, 63684, -63462, -33564, -14299, -10304, -65020, -56384, -21179, 62342, 65451, 64611, 54242, 34088, 38144, 11411, -59466, -15083, 55306, -53223, 62773, -3759, -65094, 61545, -58110, 9954, -9178, 60490, 65442, -11912, -50675, -47122, -52576, -36952 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.CosUltra", Fixed32.CosUltra(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SinTurns()
+	public static void Fixed64_SinTurns()
+	{
+		int[] input0 = new int[]{ 288741336, 521534864, -2044533025, 807888444, -2099177929, -1242715189, 1719755138, 1441152674, 650396610, -2075416177, -1446064989, 978946100, -2024833641, -2004473011, -366235809, -1676695019, 1444390814, 909768954, -1536385673, 121537042, -2047292033, -1238177215, 1918936696, 991050068, -193291445, -1547706973, 523398546, 2100998510, -1239540801, -943978097, -1580058757, 478162596, 1129734358, 1076966654, -666802565, 1086994404, 143142486, -1351773531, 182908142, 1432545904, -88670373, -1436235419, 1826574724, 903145090, 283505988, -1135951243, -161767873, -1801281469, -1870095699, -703442853, 50269, -70105, -51606, 80769, -58661, -28897, 34928, -41355, -53378, 74320, 17758, 82246, 24829, -25756, 76933, 10396, 92978, -44438, 37709, 32328, 15257, 30206, -66152, -38251, -90211, 71545, -42713, -52698, -67052, -56103, 35462, 8251, 84918, 75035, 5773, 96528, -26127, 71838, 8811, 97846, -84311, -51979, 90432, 34197, -51050, 13623, 8290, 10812, 65122, -97194 };
+		long[] output0 = new long[]{ 1760744092L, 2968105640L, -644415184L, 3974212588L, -303261232L, -4164412236L, 2515521784L, 3689357336L, 3497279056L, -451974888L, -3673459856L, 4253733692L, -766504416L, -892021652L, -2192606000L, -2729681412L, 3678899256L, 4171988484L, -3348247292L, 759622700L, -627270860L, -4171297088L, 1409397616L, 4263579208L, -1198365788L, -3303238336L, 2976558388L, 291849668L, -4169247608L, -4217810924L, -3169669720L, 2765292824L, 4280566448L, 4294919492L, -3556103048L, 4294160116L, 892832000L, -3944568232L, 1135580652L, 3716751164L, -555571260L, -3705079996L, 1943076992L, 4161904728L, 1730689336L, -4277193388L, -1006956700L, -2083443228L, -1695438780L, -3680033684L, 315848L, -440484L, -324252L, 507484L, -368580L, -181568L, 219456L, -259844L, -335384L, 466964L, 111576L, 516764L, 156004L, -161832L, 483384L, 65316L, 584196L, -279216L, 236932L, 203120L, 95860L, 189788L, -415648L, -240340L, -566816L, 449528L, -268376L, -331112L, -421304L, -352508L, 222812L, 51840L, 533552L, 471456L, 36272L, 606500L, -164164L, 451368L, 55360L, 614784L, -529744L, -326596L, 568200L, 214864L, -320760L, 85592L, 52084L, 67932L, 409172L, -610688L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SinTurns", Fixed64.SinTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SinTurnsFast()
+	public static void Fixed64_SinTurnsFast()
+	{
+		int[] input0 = new int[]{ 1979764572, -1707324243, -1517074971, 339472094, -1320294453, -1876747863, -1595855947, -1577971121, -1996079127, -1791578287, -1571593245, 1990772168, -1891412069, 1438447846, -1820761005, 1599155538, -240170305, -1200898269, 1622807224, -1131785681, 1410669574, -1531268395, 148228774, 1539583762, 1802644012, -1683556945, -1942992559, 1769176272, -1907141199, 1636380538, -186868095, -917765773, -892727249, 692210678, -543981277, 1299920746, 1361951508, 1585289820, -328395585, 1480451288, -255857495, 1812102654, 1773442750, 625382260, 23021342, 1242481464, -371593369, 1022703394, 11714694, -157533821, 4597, -11158, -43866, 69024, 28346, 63495, 13594, -42336, 31865, -83084, -96915, -56696, -84671, -69149, 25274, 69553, 34273, -20309, -7685, -45318, -88954, 14995, 59370, -93371, 59211, 81306, -53887, 77780, -29379, -73915, 38906, -38100, -18161, 18527, -28397, -97543, -98869, -10595, -96113, 11173, -53061, 5757, -58044, -32207, 65854, -55217, 69054, 51731, -96153, 31518 };
+		long[] output0 = new long[]{ 1043268880L, -2578412772L, -3422892088L, 2046367428L, -4018602384L, -1656958344L, -3101852000L, -3178507428L, -943543792L, -2136547616L, -3205319756L, 976045084L, -1571578208L, 3698025832L, -1975585372L, 3087476168L, -1478179372L, -4220873636L, 2982343624L, -4279498144L, 3783713216L, -3368290444L, 924067304L, 3335625364L, 2075955280L, -2696260392L, -1265777576L, 2257483264L, -1479194864L, 2920389180L, -1159557820L, -4183640356L, -4145253324L, 3643146900L, -3068427904L, 4061988960L, 3918827232L, 3147399108L, -1984912872L, 3556910208L, -1570326284L, 2023730956L, 2234633952L, 3403723180L, 144620016L, 4164770464L, -2221486752L, 4283006372L, 73601988L, -981076120L, 28880L, -70108L, -275620L, 433688L, 178100L, 398948L, 85412L, -266008L, 200212L, -522036L, -608936L, -356232L, -532004L, -434476L, 158800L, 437012L, 215340L, -127608L, -48288L, -284744L, -558916L, 94216L, 373032L, -586668L, 372032L, 510860L, -338584L, 488704L, -184596L, -464424L, 244452L, -239392L, -114112L, 116408L, -178424L, -612884L, -621216L, -66572L, -603896L, 70200L, -333396L, 36172L, -364704L, -202364L, 413772L, -346940L, 433876L, 325032L, -604148L, 198032L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SinTurnsFast", Fixed64.SinTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.SinTurnsFastest()
+	public static void Fixed64_SinTurnsFastest()
+	{
+		int[] input0 = new int[]{ 1139176896, -1824661723, -934129001, -1257581069, -1072360925, -1574596751, 120604590, -132564003, 569756286, 280395394, -2141341085, 1004357400, 728368486, -202544801, -1917633845, 59654930, 363738742, 829614532, 429316648, 243782638, 130821154, -1030987263, -661419631, 10696874, 2064061802, -665906365, 156189676, -570782821, -5142179, -872389337, -479916425, 198165996, -40668347, 1845611546, 1020684216, 613603152, 517273702, -1471595135, -806148185, 1325991456, -911040323, -1711976933, 977246470, 1503653862, -1478119057, 1751890050, 1764288508, 1326380114, 636847652, 2047958646, -52354, -22520, -54440, -94139, -39142, 1056, 45832, 56003, -54676, 81072, 19403, -67804, 94066, -32844, -64595, -8941, -51337, 47974, 43038, -17869, 78690, -14535, -23828, 58245, -46224, -14188, 6484, -819, -30671, -85463, -13164, 45508, 43765, 4395, -88269, -99827, -36331, -7753, 25085, -53526, 82740, 68084, 86149, -18612, -57657, -74618, -73786, -21648, 34614, 40111 };
+		long[] output0 = new long[]{ 4274675296L, -1953997560L, -4205035304L, -4140069060L, -4294936696L, -3193239868L, 753869512L, -827731460L, 3180049464L, 1712931356L, -38594348L, 4272216196L, 3758555860L, -1254147416L, -1417214952L, 374349112L, 2179374948L, 4023743240L, 2523984808L, 1499569876L, 816982716L, -4286074540L, -3537450452L, 67207708L, 522859492L, -3553356932L, 972881068L, -3184382016L, -32308960L, -4109553836L, -2774168804L, 1227804352L, -255376596L, 1835843500L, 4281471092L, 3358576528L, 2949187956L, -3588194048L, -3969953284L, 4005658856L, -4173289460L, -2555361884L, 4251539832L, 3473622672L, -3565512364L, 2349475540L, 2283855660L, 4004779304L, 3447644788L, 623134936L, -328952L, -141500L, -342060L, -591496L, -245940L, 6632L, 287968L, 351876L, -343540L, 509388L, 121912L, -426028L, 591032L, -206368L, -405864L, -56180L, -322560L, 301428L, 270412L, -112276L, 494420L, -91328L, -149716L, 365964L, -290436L, -89148L, 40740L, -5148L, -192712L, -536980L, -82712L, 285932L, 274980L, 27612L, -554612L, -627232L, -228276L, -48716L, 157612L, -336316L, 519868L, 427784L, 541288L, -116944L, -362272L, -468840L, -463612L, -136020L, 217484L, 252024L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.SinTurnsFastest", Fixed64.SinTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SinTurns()
+	public static void Fixed32_SinTurns()
+	{
+		int[] input0 = new int[]{ -2075655749, -641635969, -1078768521, -973052137, -1198662005, 572901000, 271540372, 1240585758, 1846966648, 1300555146, -429355641, 1777275598, 1331888520, -203152635, -1527691001, -1484320695, -1015884875, -1412855369, -156376049, 1632627434, -1409056979, -184389383, -458357309, -638899503, 1066316576, 1584206082, -955385073, 533941876, 797764172, 108803694, 1726007852, -1957053569, 274153504, -1773227869, 908965008, 784758896, -195674169, -283231725, 918587132, 1702802294, 1415639470, -1243820815, -693358041, 965943812, -154010515, 1973346504, -361727663, -756161037, -765200831, -2090468049, 96560, 75210, -46952, -26707, 80318, 11931, 91465, 79517, 5034, -29587, -28833, 87780, -79379, -19060, 80188, -28861, -30005, 44593, 48212, -7681, 39992, 65883, -8566, 13425, -89895, 92305, -76299, 33675, 77420, 57763, -9385, 90722, -39503, 34493, 8506, -94837, 55820, -60526, -62891, -69604, 45077, 11371, 81776, -27637, 8126, 78139, -78540, 86773, 64791, -78310 };
+		int[] output0 = new int[]{ -6874, -52873, -65535, -64827, -64445, 48718, 25354, 63593, 27892, 61961, -38511, 33783, 60917, -19192, -51609, -54066, -65302, -57636, -14862, 44824, -57808, -17465, -40725, -52717, 65532, 48096, -64557, 46141, 60266, 10387, 37896, -18023, 25585, -34116, 63641, 59766, -18505, -26385, 63855, 39689, 57507, -63518, -55649, 64722, -14641, 16515, -33085, -58590, -58973, -5460, 9, 7, -5, -3, 7, 1, 8, 7, 0, -3, -3, 8, -8, -2, 7, -3, -3, 4, 4, -1, 3, 6, -1, 1, -9, 8, -8, 3, 7, 5, -1, 8, -4, 3, 0, -10, 5, -6, -7, -7, 4, 1, 7, -3, 0, 7, -8, 8, 6, -8 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SinTurns", Fixed32.SinTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SinTurnsFast()
+	public static void Fixed32_SinTurnsFast()
+	{
+		int[] input0 = new int[]{ 466009472, 1191292232, 71956314, -1754732621, -2125688705, 144279658, 1471031604, 1534537584, -1220505075, -491954053, 1978308322, -219999177, -423426169, 751914270, -435771027, -1427786213, 41994028, 48924606, -1086890703, 546140382, -1020635441, -1046476977, -1636909485, 289886718, -1533434223, 516779926, -1277629241, -1474563341, -1871016371, -742106613, -484614033, 255800332, 2009844746, 1183522472, 1475157958, -618006437, 1008449390, 664914964, -1201885847, 1216519426, 1829663406, -1290160461, -170220229, -1055189899, -1918013535, -1619932155, -267224417, 670828042, 1249905168, -1806679657, -93826, 87947, -76743, 45734, -23663, -29569, 31698, 89851, 89694, -23049, -33787, 37164, 58583, 77722, 99658, -19789, -3835, 25170, 66321, -91514, -13446, 70992, -41754, -7260, 40231, -87449, 59196, 72911, 2813, -95972, -63491, 9267, -26867, 97004, -40730, -10513, -11345, -52143, -21224, -1738, 39523, 57107, 41267, 67082, -9564, -51964, -18661, 14350, -48794, 30475 };
+		int[] output0 = new int[]{ 41296, 64569, 6885, -35617, -2090, 13730, 54775, 51200, -64032, -43199, 16054, -20730, -38049, 58405, -39007, -56941, 4023, 4686, -65524, 46965, -65339, -65484, -44525, 26966, -51267, 44959, -62643, -54589, -25790, -57974, -42667, 23956, 13106, 64692, 54556, -51503, 65237, 54160, -64388, 64111, 29384, -62279, -16152, -65512, -21590, -45705, -24973, 54477, 63371, -31338, -9, 8, -8, 4, -3, -3, 3, 8, 8, -3, -4, 3, 5, 7, 9, -2, -1, 2, 6, -9, -2, 6, -5, -1, 3, -9, 5, 6, 0, -10, -7, 0, -3, 9, -4, -2, -2, -5, -3, -1, 3, 5, 3, 6, -1, -5, -2, 1, -5, 2 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SinTurnsFast", Fixed32.SinTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.SinTurnsFastest()
+	public static void Fixed32_SinTurnsFastest()
+	{
+		int[] input0 = new int[]{ -1779641917, -1255926387, 188956562, -388840309, 643346564, 386669876, 1451271402, -1491011977, 280799854, -785209273, 2012783374, -823636651, 1290951182, 717006328, 253763114, 633358382, 973563662, 103156640, 938424388, 766563156, 1273001950, 737139242, -1101989373, 306700300, 1143593790, 2001102074, -909261033, -1993441643, 1586929008, 1535542794, 641068894, -2079503457, 838427482, -52218165, 1620510598, -717198995, 1669994568, 2041985712, 75321034, -814704769, 1014289562, -1005571275, 1499552894, -767581669, -394002243, 1529675848, -1299662935, 897321750, 1336270382, -1294581095, -5904, -92461, -2214, -90073, -44548, -17196, 92831, 94517, 28640, 36774, -39653, 60406, -43327, 41571, 33583, 90561, 22604, -37453, 57927, -54786, 51727, 50247, -98703, -18363, 88464, 6104, 64497, 84427, -67370, 82021, 53703, 15874, -55051, 34180, -22591, 22313, 5380, 29115, -57883, -7342, -26228, 83248, -33553, 66732, -98284, 86824, 96502, -71743, 30672, -8909 };
+		int[] output0 = new int[]{ -33594, -63215, 17886, -35307, 52976, 35130, 55797, -53707, 26172, -59784, 12831, -61196, 62249, 56816, 23775, 52406, 64822, 9852, 64245, 59030, 62764, 57752, -65475, 28430, 65184, 13927, -63640, -14645, 47926, 51148, 52847, -6507, 61687, -5002, 45672, -56826, 42152, 10074, 7206, -60885, 65279, -65201, 53233, -59074, -35723, 51498, -61985, 63357, 60759, -62141, -1, -9, -1, -9, -5, -2, 8, 9, 2, 3, -4, 5, -5, 3, 3, 8, 2, -4, 5, -6, 4, 4, -10, -2, 8, 0, 6, 8, -7, 7, 5, 1, -6, 3, -3, 2, 0, 2, -6, -1, -3, 7, -4, 6, -10, 8, 9, -7, 2, -1 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.SinTurnsFastest", Fixed32.SinTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CosTurns()
+	public static void Fixed64_CosTurns()
+	{
+		int[] input0 = new int[]{ 1489073174, 58457408, -969478539, -1002117715, -140769165, 1769296104, -1749308215, 2009002882, -1202699281, -1527842571, 35756644, 1936623248, -469185093, 287796882, -698766395, -325787243, -814870175, 1644856082, 966647734, 50337354, 984189344, -121944377, 1774853752, 831464266, -2049378475, 70936886, 224077922, -409009885, 774252574, -223297105, 1214964698, 1663809348, -1387543561, 1289836004, 219629118, 747389626, -1434179275, -1503677501, -1287282869, -959971305, -1771619149, 529221976, -1269741743, -1429956373, 1917114362, 1449423784, 1840661382, 1577102614, 1675173316, -659140593, -18335, 44687, -56702, -98676, -34113, -24981, 20074, 16137, -51233, 90141, -28045, 37587, -42502, 54393, -27721, 24187, 54793, 18089, -96825, 32658, -48386, -67924, 36538, -10284, -15158, -78813, -46551, 49235, 49445, -62925, 17590, 36994, 2947, -33252, -92062, -88111, 34180, -65935, -5823, -64791, -85271, 17078, 81212, -50085, 83343, -20084, -32853, -13519, 61134, -34915 };
+		long[] output0 = new long[]{ -2451976052L, 4279271432L, 652568324L, 449204532L, 4204216700L, -3654232900L, -3586688752L, -4207133256L, -805465880L, -2647923536L, 4289092576L, -4092239464L, 3322353160L, 3919893028L, 2239643484L, 3816335356L, 1587936776L, -3185266112L, 670142648L, 4283327224L, 561066668L, 4226805452L, -3672460896L, 1490602476L, -4250809424L, 4271861296L, 4066262400L, 3548791016L, 1822119444L, 4067839328L, -881030704L, -3263916444L, -1903148172L, -1335257456L, 4075176088L, 1973515988L, -2161200420L, -2526749184L, -1320001288L, 711545488L, -3661881488L, 3070792972L, -1214698340L, -2138229964L, -4053363020L, -2243430212L, -3869525800L, -2884530028L, -3309874064L, 2448208232L, 4294967288L, 4294967288L, 4294967276L, 4294967248L, 4294967280L, 4294967288L, 4294967288L, 4294967288L, 4294967276L, 4294967256L, 4294967288L, 4294967280L, 4294967284L, 4294967276L, 4294967288L, 4294967284L, 4294967276L, 4294967288L, 4294967248L, 4294967292L, 4294967280L, 4294967268L, 4294967284L, 4294967288L, 4294967292L, 4294967264L, 4294967276L, 4294967280L, 4294967280L, 4294967276L, 4294967288L, 4294967280L, 4294967288L, 4294967280L, 4294967256L, 4294967252L, 4294967284L, 4294967268L, 4294967288L, 4294967276L, 4294967264L, 4294967288L, 4294967260L, 4294967280L, 4294967256L, 4294967284L, 4294967288L, 4294967288L, 4294967272L, 4294967284L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.CosTurns", Fixed64.CosTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CosTurnsFast()
+	public static void Fixed64_CosTurnsFast()
+	{
+		int[] input0 = new int[]{ -510805381, -880593927, -385339313, 43356608, -563120719, -2119364227, 350634564, 1274707838, 1706190434, -174101341, 1880758648, 988863092, -1192062359, 597007460, 1040991478, -1933484641, -601229995, -9279801, 897536276, 65499922, -1684793199, -439590559, -917183137, -321197551, -921299553, -1568916089, 1558701152, 1627627634, 850739592, -134086909, -865597627, 1004128644, -1993435823, -1438680921, -489114507, 1935901754, 424840296, -2100758855, -1148954925, 1536738734, 452786316, 918332548, 361001050, -1037670697, 414169018, 738758420, -484183773, -1627462195, 824954764, -1699629915, 33083, -47256, -50224, 94526, -90669, 96683, -98296, 97013, -55079, -53164, -71273, 40535, -80257, -14305, -67799, -59178, 38874, -88515, -49423, 58327, -9818, -30172, -46929, 70234, 81965, -21217, 62719, -94389, 65756, 22697, 49488, 48367, -62622, 18760, 60672, -93051, -3017, -87352, -76324, -19459, 88443, 22770, 57255, 99661, 42833, 80549, 23020, -68884, -80520, -21535 };
+		long[] output0 = new long[]{ 3150572120L, 1197500360L, 3630418192L, 4286336096L, 2918167784L, -4291338104L, 3742204148L, -1244595812L, -3430618904L, 4156410176L, -3972127776L, 531939472L, -739723244L, 2758423292L, 205697780L, -4086205724L, 2738034856L, 4294573356L, 1094912312L, 4275270360L, -3348063644L, 3437044788L, 975110148L, 3829474164L, 949903792L, -2846216360L, -2797834488L, -3111648608L, 1376443324L, 4212602664L, 1287693148L, 436636904L, -4186364412L, -2185599032L, 3241595968L, -4090857532L, 3491816092L, -4284942772L, -471624920L, -2691710456L, 3386688732L, 968075396L, 3709810596L, 226536408L, 3530428980L, 2021527172L, 3261835300L, -3110932020L, 1528893856L, -3405660584L, 4294967296L, 4294967296L, 4294967296L, 4294967272L, 4294967284L, 4294967276L, 4294967272L, 4294967276L, 4294967296L, 4294967300L, 4294967292L, 4294967300L, 4294967288L, 4294967296L, 4294967288L, 4294967292L, 4294967300L, 4294967280L, 4294967296L, 4294967292L, 4294967296L, 4294967304L, 4294967296L, 4294967288L, 4294967280L, 4294967300L, 4294967292L, 4294967276L, 4294967288L, 4294967300L, 4294967292L, 4294967296L, 4294967296L, 4294967300L, 4294967292L, 4294967280L, 4294967296L, 4294967280L, 4294967288L, 4294967296L, 4294967276L, 4294967300L, 4294967292L, 4294967268L, 4294967296L, 4294967284L, 4294967296L, 4294967292L, 4294967284L, 4294967300L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.CosTurnsFast", Fixed64.CosTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed64.CosTurnsFastest()
+	public static void Fixed64_CosTurnsFastest()
+	{
+		int[] input0 = new int[]{ -104678107, -1871803259, -967654493, -1976627997, -1496802231, 1996804946, -1978335115, 1596843076, 746885894, -748266493, -1848925239, -91598407, -1488002581, -816194889, -1678602315, 19385262, -237054573, -749965585, 1235654536, -844095477, 1124546948, -389349337, -79737829, 1271257624, 1699181602, -481635103, -1307652265, -547167731, -1407312199, 1568584448, -1824725289, -1846340153, 2114754078, 1976850220, -1588348001, 725792936, 673694006, 883299276, 2139105626, 24859202, 1805473524, -151992753, -1664362499, -1370115933, -818055753, 590582734, 1760289756, 48998292, 135772394, 442458528, 89924, -53083, -46404, 75797, -64749, -86743, 16550, -4257, -71168, 52727, 53875, 33356, 39891, 61736, -49873, 99879, -2741, -61344, -64043, -11963, 69531, 47829, -34532, -43617, -23380, -40556, -40627, -39912, -2708, -48376, -4397, 36826, 68198, 13863, 83118, 68112, 60427, -77321, 56803, -87219, -82753, -64371, 12300, -53117, 47281, -49282, 53030, -39239, 86072, -37973 };
+		long[] output0 = new long[]{ 4243998452L, -3950328536L, 663903304L, -4160943656L, -2492061884L, -4190413608L, -4163577188L, -2975707596L, 1976541692L, 1968833880L, -3891819284L, 4255764632L, -2446808160L, 1580318288L, -3324062836L, 4292971832L, 4039027908L, 1959336932L, -1007874056L, 1416007916L, -318925272L, 3617267284L, 4265101956L, -1223888440L, -3404425380L, 3272738000L, -1441278964L, 2991408648L, -2013912648L, -2845123324L, -3825177708L, -3884932232L, -4289635552L, -4161287940L, -2936976996L, 2093282288L, 2372862264L, 1181217976L, -4294518796L, 4291797076L, -3768726484L, 4188604692L, -3266683072L, -1804545768L, 1569438172L, 2789697232L, -3624547264L, 4283399048L, 4209853916L, 3426683460L, 4294965816L, 4294966432L, 4294966540L, 4294966056L, 4294966240L, 4294965872L, 4294967024L, 4294967220L, 4294966132L, 4294966436L, 4294966416L, 4294966748L, 4294966648L, 4294966288L, 4294966484L, 4294965648L, 4294967244L, 4294966296L, 4294966252L, 4294967096L, 4294966160L, 4294966512L, 4294966732L, 4294966588L, 4294966916L, 4294966636L, 4294966636L, 4294966648L, 4294967244L, 4294966508L, 4294967216L, 4294966696L, 4294966180L, 4294967064L, 4294965932L, 4294966184L, 4294966308L, 4294966028L, 4294966372L, 4294965860L, 4294965936L, 4294966244L, 4294967092L, 4294966432L, 4294966524L, 4294966492L, 4294966432L, 4294966656L, 4294965884L, 4294966676L };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed64.CosTurnsFastest", Fixed64.CosTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CosTurns()
+	public static void Fixed32_CosTurns()
+	{
+		int[] input0 = new int[]{ -1074169195, 1477022962, 1458827122, 905005430, 1965038092, 1900521684, -1075845607, -359569803, -874547017, 1157562106, -1586629877, 1386883358, 1683830214, -1568541451, 654685320, -387141805, 1382448744, -342609961, -135930987, -1886983863, -1102985751, 1417213764, -1224038959, -1032441855, 445873820, 1070386246, -505622573, 1084616586, -1797927195, 1042097384, 141984350, 2081541868, -489906317, 444063220, 233474782, 728815418, 150525368, -1329541447, -613380515, -1191925909, -1366778865, 791487468, 2013851814, -314298761, -665486767, 1275404714, -1841390691, 1159680682, -1906898761, -1842873615, -2938, -32909, -89281, -77231, 91617, -16014, 25777, 16008, -78620, -58339, 12044, -604, -33021, 10749, -52708, -70812, -12605, -42268, 16087, 96548, 74962, 26286, -87391, -50826, 75776, 11781, 72216, 57636, 82912, 61371, 35590, 22453, 39303, -97907, -48534, -60478, 86210, -45581, 29060, -73113, -91839, 91000, -83291, -70223, 32451, 36958, -30122, -16972, -61927, -60176 };
+		int[] output0 = new int[]{ -41, -36460, -34998, 16013, -63216, -61306, -202, 56676, 18828, -8017, -44687, -28983, -51030, -43403, 37706, 55303, -28602, 57475, 64244, -60835, -2803, -31562, -14294, 3957, 52081, 321, 48410, -1043, -57153, 3032, 64127, -65232, 49412, 52186, 61750, 31683, 63953, -23957, 40874, -11275, -27242, 26298, -64288, 58729, 36855, -19055, -59075, -8218, -61519, -59137, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.CosTurns", Fixed32.CosTurns(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CosTurnsFast()
+	public static void Fixed32_CosTurnsFast()
+	{
+		int[] input0 = new int[]{ 1485010156, 922516244, 1667753672, -1267059219, 1688325890, -327034239, 363257618, 1771944854, -366018793, 962431670, -535818107, 738753126, 543061260, -696448793, -232987159, 315084328, 838474702, -1937353457, 16714980, 835482748, -1074217195, 1899733722, -1321021195, -266867565, -2053919057, 1170001124, 365429598, -1928291399, -14481051, 1754224288, -292074111, 705932884, 1398727906, -1355402111, 596240384, -806248099, 1429659446, -1111961739, -369936283, -944834841, -1026308075, 16821340, -2055237999, -30965495, 1249571462, -972237845, -353772485, -242874249, 817726364, -406860361, 96917, 99179, -29928, 41949, 68490, 80687, 4472, -9912, -63358, -75863, 67754, 6708, -16813, 1268, -41582, 42176, 69267, -11595, 39804, -73305, 48098, -9175, 27011, -55224, -13303, 49194, 84167, 39927, 29385, 49630, -29043, -71673, -27871, -81728, 84770, -12780, -37199, -76815, -31606, 47076, 57983, -23514, -88420, -41362, -11751, 45500, -82403, 3027, -59859, -83988 };
+		int[] output0 = new int[]{ -37094, 14380, -50049, -18289, -51299, 58177, 56497, -55893, 56363, 10624, 46412, 30846, 45919, 34363, 61765, 58696, 22113, -62464, 65516, 22383, -46, -61279, -23194, 60604, -64924, -9199, 56392, -62196, 65521, -54987, 59643, 33586, -29998, -26247, 42146, 24996, -32603, -3663, 56170, 12285, 4544, 65516, -64941, 65468, -16673, 9695, 56953, 61442, 23975, 54266, 65535, 65535, 65536, 65536, 65535, 65535, 65536, 65536, 65535, 65535, 65535, 65536, 65536, 65536, 65536, 65536, 65535, 65536, 65536, 65535, 65535, 65536, 65536, 65535, 65536, 65536, 65535, 65536, 65536, 65536, 65536, 65535, 65536, 65535, 65535, 65536, 65536, 65535, 65536, 65536, 65536, 65536, 65535, 65536, 65536, 65536, 65535, 65536, 65535, 65535 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.CosTurnsFast", Fixed32.CosTurnsFast(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
+	// Fixed32.CosTurnsFastest()
+	public static void Fixed32_CosTurnsFastest()
+	{
+		int[] input0 = new int[]{ -115125599, -1116097533, 1036234958, 1487145532, 2054437036, -1545826281, -106085929, 959251216, -725455583, 2052626342, -1437567359, 2012619026, 6011026, -524299035, -614533097, -1000848651, -1640348001, -197888103, -833950163, 1730115862, -351847879, -723323083, -1829838147, -467910083, 1521103566, -1713654513, 1796906530, -355854523, -516315633, -1749101415, 949149224, -656013627, -26822557, -1364723079, -1980934067, 183320778, 489539808, -143351777, 1467901476, 1136534502, -82311765, -739831577, -1513556989, 1745771336, -1719958553, -783488791, -1925330073, -1550626221, -1293053751, -1730816237, 47387, 5826, 6912, -27627, 19755, -71678, -66763, -29957, 98418, 75465, -55658, -88369, -31288, -52332, -48615, 63606, -5031, -36170, -32170, 62847, 30598, 30290, 22430, 8242, -15602, -81933, -63201, -66502, -41696, 7315, -90143, 55881, -56358, -43445, -28835, -61628, 62539, -73621, 16694, 79434, -24699, -47246, -5094, 92889, 8582, -15463, 96837, 81852, 29909, -43697 };
+		int[] output0 = new int[]{ 64597, -4059, 3594, -37268, -64920, -41755, 64737, 10925, 31969, -64896, -33262, -64255, 65532, 47193, 40795, 6975, -48321, 62802, 22522, -53702, 57048, 32147, -58589, 50780, -39900, -52782, -57109, 56858, 47721, -54724, 11879, 37608, 65480, -27066, -63592, 63185, 49443, 64090, -35735, -6012, 65051, 30758, -39324, -54548, -53138, 27001, -62101, -42109, -20669, -53740, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535 };
+		for (int ndx = 0; ndx < 100; ndx++)
+			Util.Check("Fixed32.CosTurnsFastest", Fixed32.CosTurnsFastest(input0[ndx]), output0[ndx], input0[ndx]);
+	}
+
 	// Fixed64.Tan()
 	public static void Fixed64_Tan()
 	{
@@ -1311,12 +1834,14 @@ class UnitTest
 		Fixed64_Rcp();
 		Fixed64_RcpFast();
 		Fixed64_RcpFastest();
+		Fixed64_RcpRefined();
 		Fixed32_Rcp();
 		Fixed32_RcpFast();
 		Fixed32_RcpFastest();
 		Fixed64_Div();
 		Fixed64_DivFast();
 		Fixed64_DivFastest();
+		Fixed64_DivRefined();
 		Fixed32_Div();
 		Fixed32_DivFast();
 		Fixed32_DivFastest();
@@ -1324,10 +1849,18 @@ class UnitTest
 		Fixed64_Sqrt();
 		Fixed64_SqrtFast();
 		Fixed64_SqrtFastest();
+		Fixed64_SqrtRefined();
 		Fixed32_SqrtPrecise();
 		Fixed32_Sqrt();
 		Fixed32_SqrtFast();
 		Fixed32_SqrtFastest();
+		Fixed32_SqrtRefined();
+		Fixed64_Cbrt();
+		Fixed64_CbrtFast();
+		Fixed64_CbrtFastest();
+		Fixed32_Cbrt();
+		Fixed32_CbrtFast();
+		Fixed32_CbrtFastest();
 		Fixed64_RSqrt();
 		Fixed64_RSqrtFast();
 		Fixed64_RSqrtFastest();
@@ -1346,6 +1879,12 @@ class UnitTest
 		Fixed32_Exp2();
 		Fixed32_Exp2Fast();
 		Fixed32_Exp2Fastest();
+		Fixed64_Exp10();
+		Fixed64_Exp10Fast();
+		Fixed64_Exp10Fastest();
+		Fixed32_Exp10();
+		Fixed32_Exp10Fast();
+		Fixed32_Exp10Fastest();
 		Fixed64_Log();
 		Fixed64_LogFast();
 		Fixed64_LogFastest();
@@ -1355,27 +1894,69 @@ class UnitTest
 		Fixed64_Log2();
 		Fixed64_Log2Fast();
 		Fixed64_Log2Fastest();
+		Fixed64_Log2Ultra();
 		Fixed32_Log2();
 		Fixed32_Log2Fast();
 		Fixed32_Log2Fastest();
+		Fixed32_Log2Ultra();
+		Fixed64_Log10();
+		Fixed64_Log10Fast();
+		Fixed64_Log10Fastest();
+		Fixed32_Log10();
+		Fixed32_Log10Fast();
+		Fixed32_Log10Fastest();
 		Fixed64_Pow();
 		Fixed64_PowFast();
 		Fixed64_PowFastest();
 		Fixed32_Pow();
 		Fixed32_PowFast();
 		Fixed32_PowFastest();
+		Fixed64_Sigmoid();
+		Fixed64_SigmoidFast();
+		Fixed64_SigmoidFastest();
+		Fixed32_Sigmoid();
+		Fixed32_SigmoidFast();
+		Fixed32_SigmoidFastest();
+		Fixed64_Tanh();
+		Fixed64_TanhFast();
+		Fixed64_TanhFastest();
+		Fixed32_Tanh();
+		Fixed32_TanhFast();
+		Fixed32_TanhFastest();
+		Fixed64_Softplus();
+		Fixed64_SoftplusFast();
+		Fixed64_SoftplusFastest();
+		Fixed32_Softplus();
+		Fixed32_SoftplusFast();
+		Fixed32_SoftplusFastest();
 		Fixed64_Sin();
 		Fixed64_SinFast();
 		Fixed64_SinFastest();
+		Fixed64_SinUltra();
 		Fixed32_Sin();
 		Fixed32_SinFast();
 		Fixed32_SinFastest();
+		Fixed32_SinUltra();
 		Fixed64_Cos();
 		Fixed64_CosFast();
 		Fixed64_CosFastest();
+		Fixed64_CosUltra();
 		Fixed32_Cos();
 		Fixed32_CosFast();
 		Fixed32_CosFastest();
+		Fixed32_CosUltra();
+		Fixed64_SinTurns();
+		Fixed64_SinTurnsFast();
+		Fixed64_SinTurnsFastest();
+		Fixed32_SinTurns();
+		Fixed32_SinTurnsFast();
+		Fixed32_SinTurnsFastest();
+		Fixed64_CosTurns();
+		Fixed64_CosTurnsFast();
+		Fixed64_CosTurnsFastest();
+		Fixed32_CosTurns();
+		Fixed32_CosTurnsFast();
+		Fixed32_CosTurnsFastest();
 		Fixed64_Tan();
 		Fixed64_TanFast();
 		Fixed64_TanFastest();
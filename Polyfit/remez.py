@@ -31,8 +31,13 @@
 # - https://news.ycombinator.com/item?id=10115336
 # - http://sollya.gforge.inria.fr/
 
+import argparse
 import math
+import os
 import random
+import subprocess
+import sys
+import tempfile
 import mpmath as mp
 import numpy.polynomial as P
 import numpy.polynomial.chebyshev as C
@@ -405,9 +410,11 @@ FUNCS = [
 	('Exp2', lambda x: 2.0**x, lambda x: 2.0**x, (0.0, 1.0)),
 	('Log', lambda x: mp.log(x+1), lambda x: mp.log(x+1) * (mp.log(2.0) - mp.log(x+1)), (epsilon, 1.0-epsilon)),
 	('Log2', lambda x: mp.log(x+1, 2.0), lambda x: mp.log(x+1, 2.0) * (1 - mp.log(x+1, 2.0)), (epsilon, 1.0-epsilon)),
+	('Log10', lambda x: mp.log10(x+1), lambda x: mp.log10(x+1) * (mp.log10(2.0) - mp.log10(x+1)), (epsilon, 1.0-epsilon)),
 	('Rcp', lambda x: 1.0 / (x+1), lambda x: 1.0 / (x+1), (0.0, 1.0)),
 	('Sqrt', lambda x: mp.sqrt(x+1), lambda x: mp.sqrt(x+1), (0.0, 1.0)),
 	('RSqrt', lambda x: 1.0 / mp.sqrt(x+1), lambda x: 1.0 / mp.sqrt(x+1), (0.0, 1.0)),
+	('Cbrt', lambda x: mp.cbrt(x+1), lambda x: mp.cbrt(x+1), (0.0, 1.0)),
 	('Atan', lambda x: mp.atan(x), lambda x: mp.atan(x), (0.0, 1.0)),
 	('Sin', sinSqr, sinSqr, (epsilon, 1.0)),
 ]
@@ -439,6 +446,215 @@ def generateCode():
 
 		file.write('\t}\n')
 
+# Functions approximated over a wider input range with uniform 0.5-wide segments. Unlike the
+# tables above, the segment polynomials use segment-local coordinates, so the coefficients stay
+# small. The input is an s5.26 value in [0.0, 32.0( range.
+SEGMENTED_FUNCS = [
+	('Sigmoid', lambda x: 1.0 / (1.0 + mp.exp(-x)), (0.0, 32.0)),				# 1 / (1 + e^-x)
+	('Softplus', lambda x: mp.log(1.0 + mp.exp(-x)), (0.0, 32.0)),				# log(1 + e^-x)
+]
+
+def writeLocalCoefficients(file, name, maxError, order, segments):
+	numSegments = len(segments)
+	precision = -math.log(maxError, 2.0)
+	funcName = f'{name}Poly{order}Lut{numSegments}'
+	tableName = f'{funcName}Table'
+
+	# write constant table
+	file.write('\n')
+	file.write(f'\t\tprivate static readonly int[] {tableName} =\n')
+	file.write('\t\t{\n')
+
+	for remez in segments:
+		# polynomial in segment-local coordinates [0.0, 1.0]
+		p = remezToPoly(remez)
+		coefs = ' '.join(f'{int(mp.floor(c * (1<<30) + 0.5))},' for c in reversed(p.coef))
+		file.write(f'\t\t\t{coefs}\n')
+
+	file.write('\t\t};\n')
+
+	# write function
+	file.write('\n')
+	file.write(f'\t\t// Precision: {precision:.2f} bits\n')
+	file.write('\t\t[MethodImpl(AggressiveInlining)]\n')
+	file.write(f'\t\tpublic static int {funcName}(int a)\n')
+	file.write('\t\t{\n')
+	file.write(f'\t\t\tint offset = (a >> 25) * {order + 1};\n')
+	file.write('\t\t\tint k = (a & 0x1FFFFFF) << 5;\n')
+
+	for ndx in reversed(range(order + 1)):
+		if ndx == order:
+			file.write(f'\t\t\tint y = Qmul30(k, {tableName}[offset + {0}]);\n')
+		elif ndx > 0:
+			file.write(f'\t\t\ty = Qmul30(k, y + {tableName}[offset + {order - ndx}]);\n')
+		else:
+			file.write(f'\t\t\ty = y + {tableName}[offset + {order}];\n')
+
+	file.write('\t\t\treturn y;\n')
+	file.write('\t\t}\n')
+	file.flush()
+
+def generateSegmentedCode():
+	with open(f'fitted-segmented.txt', 'w', newline='\n') as file:
+		for (name, func, domain) in SEGMENTED_FUNCS:
+			print()
+			print(f'{name}():')
+			(xMin, xMax) = domain
+			numSegments = int((xMax - xMin) * 2)
+			for order in [2, 3, 5]:
+				(maxError, segments) = remezFitSegmented(name, func, lambda x: mp.mpf(1.0), domain, numSegments, order)
+				print(f'  {name}<{order}>[{numSegments}](): {-math.log(maxError, 2.0):.2f} bits')
+				writeLocalCoefficients(file, name, maxError, order, segments)
+
+# C++ header generation. The kernels take an s2.30 input in [0.0, 1.0( range and return an s2.30
+# value. Segmented kernels evaluate the polynomials in segment-local coordinates (like the
+# segmented functions above), so any power-of-two segment count works without the coefficients
+# overflowing.
+#
+# The kernels are written into namespace FixedUtil next to the built-in ones, with a 'Remez' suffix
+# so that their names don't clash, and can be bound to the precision tiers through the FP_KERNEL_*
+# macros (see --bind).
+
+def funcInfo(name):
+	for (funcName, func, weightFunc, domain) in FUNCS:
+		if funcName == name:
+			return (func, weightFunc, domain)
+	raise ValueError(f'unknown function {name}, expected one of: {", ".join(f[0] for f in FUNCS)}')
+
+def kernelName(name, order, numSegments):
+	return f'{name}Poly{order}Remez' if numSegments == 1 else f'{name}Poly{order}Lut{numSegments}Remez'
+
+def writeCppKernel(file, name, maxError, order, segments):
+	numSegments = len(segments)
+	precision = -math.log(maxError, 2.0)
+	funcName = kernelName(name, order, numSegments)
+	tableName = f'{funcName}Table'
+	segmentBits = int(math.log2(numSegments))
+
+	if numSegments > 1:
+		file.write(f'    static const FP_INT {tableName}[] =\n')
+		file.write('    {\n')
+		for remez in segments:
+			p = remezToPoly(remez)
+			coefs = ' '.join(f'{int(mp.floor(c * (1<<30) + 0.5))},' for c in reversed(p.coef))
+			file.write(f'        {coefs}\n')
+		file.write('    };\n')
+		file.write('\n')
+
+	file.write(f'    // Precision: {precision:.2f} bits\n')
+	file.write(f'    static FP_INT {funcName}(FP_INT a)\n')
+	file.write('    {\n')
+	if numSegments == 1:
+		p = remezToPoly(segments[0])
+		coefs = [int(mp.floor(c * (1<<30) + 0.5)) for c in reversed(p.coef)]
+		x = 'a'
+	else:
+		coefs = [f'{tableName}[offset + {ndx}]' for ndx in range(order + 1)]
+		x = 'k'
+		file.write(f'        FP_INT offset = (a >> {30 - segmentBits}) * {order + 1};\n')
+		file.write(f'        FP_INT k = (a & 0x{(1 << (30 - segmentBits)) - 1:X}) << {segmentBits};\n')
+
+	file.write(f'        FP_INT y = FixedUtil::Qmul30({x}, {coefs[0]});\n')
+	for c in coefs[1:-1]:
+		file.write(f'        y = FixedUtil::Qmul30({x}, y + {c});\n')
+	file.write(f'        y = y + {coefs[-1]};\n')
+	file.write('        return y;\n')
+	file.write('    }\n')
+
+# Compiles and runs a program that evaluates the kernels of the header against the reference
+# function, and returns the measured precision (in bits) of each kernel. The rounding of the
+# coefficients and of each multiply (up to order + 1 units in the last place) is not counted as
+# error, as the weighted error is meaningless at that level where the weight approaches zero.
+def validateCppHeader(headerPath, name, func, weightFunc, kernels, numSamples=8192):
+	rnd = random.Random(1234)
+	inputs = [(i << 30) // numSamples + rnd.randrange((1 << 30) // numSamples) for i in range(numSamples)]
+	xs = [mp.mpf(a) / (1 << 30) for a in inputs]
+	expected = [float(func(x)) for x in xs]
+	weights = [float(weightFunc(x)) for x in xs]
+
+	with tempfile.TemporaryDirectory() as tmpDir:
+		srcPath = os.path.join(tmpDir, 'validate.cpp')
+		exePath = os.path.join(tmpDir, 'validate')
+		with open(srcPath, 'w', newline='\n') as file:
+			file.write('#include <math.h>\n#include <stdio.h>\n')
+			file.write(f'#include "{os.path.basename(headerPath)}"\n\n')
+			file.write(f'static const int32_t inputs[{numSamples}] = {{ {", ".join(str(a) for a in inputs)} }};\n')
+			file.write(f'static const double expected[{numSamples}] = {{ {", ".join(repr(v) for v in expected)} }};\n')
+			file.write(f'static const double weights[{numSamples}] = {{ {", ".join(repr(v) for v in weights)} }};\n\n')
+			file.write('int main()\n{\n')
+			for (kernel, order) in kernels:
+				file.write('    {\n        double maxError = 0.0;\n')
+				file.write(f'        for (int i = 0; i < {numSamples}; i++)\n')
+				file.write(f'            maxError = fmax(maxError, fmax(fabs(FixedUtil::{kernel}(inputs[i]) / 1073741824.0 - expected[i]) - {order + 1} / 1073741824.0, 0.0) / weights[i]);\n')
+				file.write(f'        printf("{kernel} %.17g\\n", maxError);\n    }}\n')
+			file.write('    return 0;\n}\n')
+
+		cppDir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Cpp')
+		compiler = os.environ.get('CXX', 'c++')
+		subprocess.check_call([compiler, '-O2', '-std=c++11', '-I', os.path.dirname(os.path.abspath(headerPath)), '-I', cppDir, srcPath, '-o', exePath])
+		output = subprocess.check_output([exePath]).decode()
+
+	bits = {}
+	for line in output.splitlines():
+		(kernel, maxError) = line.split()
+		bits[kernel] = -math.log(max(float(maxError), 1e-30), 2.0)
+	return bits
+
+# Writes a C++ header with the given (order, numSegments) variants of a function, and validates the
+# compiled kernels. Returns False if a kernel is more than one bit less precise than its fit. The
+# bindings map FP_KERNEL_* tier names (e.g. LOG2_FAST) to the variant the tier should use.
+def generateHeader(path, name, variants, bindings={}, validate=True):
+	(func, weightFunc, domain) = funcInfo(name)
+	guard = '__' + os.path.splitext(os.path.basename(path))[0].upper() + '_H'
+
+	# The epsilon margins of the domains are relative to the default precision. Use a margin that is
+	# representable at the working precision but far below the s2.30 resolution, as the kernels
+	# assume that the segments start exactly at multiples of 1/numSegments.
+	margin = mp.mpf(2) ** -40
+	(xMin, xMax) = domain
+	domain = (max(xMin, margin) if xMin > 0 else xMin, min(xMax, 1 - margin) if xMax < 1 else xMax)
+
+	fitted = []
+	with open(path, 'w', newline='\n') as file:
+		file.write('//\n// GENERATED FILE!!!\n//\n')
+		file.write('// Generated with Polyfit/remez.py, part of the FixPointCS project (MIT license).\n//\n')
+		file.write(f'#pragma once\n#ifndef {guard}\n#define {guard}\n\n')
+		file.write('#include "FixedUtil.h"\n\n')
+		file.write(f'// Polynomial approximations for {name}(), see FUNCS in Polyfit/remez.py for the approximated\n')
+		file.write('// function. The input is an s2.30 value in [0.0, 1.0( range, the output an s2.30 value.\n')
+		file.write('//\n')
+		file.write('// Include this header after FixedUtil.h and before Fixed32.h/Fixed64.h. A kernel can then be bound\n')
+		file.write(f'// to a precision tier by defining the tier macro before FixedUtil.h (e.g. FP_KERNEL_{name.upper()}_FAST), or\n')
+		file.write('// with the bindings at the end of this header (see remez.py --bind).\n')
+		file.write('namespace FixedUtil\n{\n')
+		for (order, numSegments) in variants:
+			assert numSegments >= 1 and (numSegments & (numSegments - 1)) == 0, 'segment count must be a power of two'
+			(maxError, segments) = remezFitSegmented(name, func, weightFunc, domain, numSegments, order)
+			kernel = kernelName(name, order, numSegments)
+			print(f'  {kernel}(): {-math.log(maxError, 2.0):.2f} bits')
+			file.write('\n')
+			writeCppKernel(file, name, maxError, order, segments)
+			fitted.append((kernel, order, -math.log(maxError, 2.0)))
+		file.write('}\n\n')
+		if bindings:
+			file.write('// Tier bindings, replacing the defaults of FixedUtil.h.\n')
+			for (tier, variant) in bindings.items():
+				file.write(f'#undef FP_KERNEL_{tier}\n')
+				file.write(f'#define FP_KERNEL_{tier} {kernelName(name, *variant)}\n')
+			file.write('\n')
+		file.write(f'#endif // {guard}\n')
+
+	if not validate:
+		return True
+
+	measured = validateCppHeader(path, name, func, weightFunc, [(kernel, order) for (kernel, order, _) in fitted])
+	ok = True
+	for (kernel, _, fitBits) in fitted:
+		status = 'ok' if measured[kernel] >= fitBits - 1.0 else 'FAILED'
+		ok = ok and (status == 'ok')
+		print(f'  validate {kernel}(): {measured[kernel]:.2f} bits in C++ (fit {fitBits:.2f} bits) {status}')
+	return ok
+
 def plotError():
 	print('Plotting error..')
 	#func = lambda x: 1.0 / (x + 1.0)
@@ -453,5 +669,32 @@ def plotError():
 
 # Main
 
-generateCode()
-#plotError()
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser(description='Fits polynomial approximations. Without --header, writes all the C# variants to fitted.txt and fitted-segmented.txt.')
+	parser.add_argument('--header', help='write a C++ header with the --variants of --func to this path')
+	parser.add_argument('--func', help='function to approximate (name in FUNCS, e.g. Rcp)')
+	parser.add_argument('--variants', nargs='+', default=['4', '3x8', '2x64'], help='polynomial order and segment count of each kernel, e.g. 4 (no table) or 2x64')
+	parser.add_argument('--bind', nargs='+', default=[], help='bind tiers to variants in the header, e.g. LOG2_FAST=3x64 (the tier name of an FP_KERNEL_* macro)')
+	parser.add_argument('--digits', type=int, default=20, help='working precision of the header fits in decimal digits')
+	parser.add_argument('--no-validate', action='store_true', help='skip compiling and checking the header')
+	args = parser.parse_args()
+
+	if args.header:
+		if not args.func:
+			parser.error('--header requires --func')
+		dps = args.digits
+		mp.mp.dps = dps
+		parseVariant = lambda variant: tuple(int(v) for v in (variant.split('x') + ['1'])[:2])
+		variants = [parseVariant(variant) for variant in args.variants]
+		bindings = {}
+		for binding in args.bind:
+			(tier, _, variant) = binding.partition('=')
+			if parseVariant(variant) not in variants:
+				parser.error(f'--bind {binding}: {variant} is not one of the --variants')
+			bindings[tier.upper()] = parseVariant(variant)
+		print(f'{args.func}():')
+		sys.exit(0 if generateHeader(args.header, args.func, variants, bindings, not args.no_validate) else 1)
+
+	generateCode()
+	generateSegmentedCode()
+	#plotError()
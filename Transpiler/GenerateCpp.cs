@@ -40,6 +40,20 @@ namespace Transpiler
             Util,
         }
 
+        // Approximation kernels used by the precision tiers. The Fixed32/Fixed64 code calls them through
+        // FP_KERNEL_* macros, so that a configuration written by CppTuner can pick other kernels.
+        private static readonly string[,] TierKernels =
+        {
+            { "EXP2_FULL", "Exp2Poly5" }, { "EXP2_FAST", "Exp2Poly4" }, { "EXP2_FASTEST", "Exp2Poly3" },
+            { "RCP_FULL", "RcpPoly4Lut8" }, { "RCP_FAST", "RcpPoly6" }, { "RCP_FASTEST", "RcpPoly4" },
+            { "SQRT_FULL", "SqrtPoly3Lut8" }, { "SQRT_FAST", "SqrtPoly4" }, { "SQRT_FASTEST", "SqrtPoly3" },
+            { "RSQRT_FULL", "RSqrtPoly3Lut16" }, { "RSQRT_FAST", "RSqrtPoly5" }, { "RSQRT_FASTEST", "RSqrtPoly3" },
+            { "LOG_FULL", "LogPoly5Lut8" }, { "LOG_FAST", "LogPoly3Lut8" }, { "LOG_FASTEST", "LogPoly5" },
+            { "LOG2_FULL", "Log2Poly4Lut16" }, { "LOG2_FAST", "Log2Poly3Lut16" }, { "LOG2_FASTEST", "Log2Poly5" },
+            { "SIN_FULL", "SinPoly4" }, { "SIN_FAST", "SinPoly3" }, { "SIN_FASTEST", "SinPoly2" },
+            { "ATAN_FULL", "AtanPoly5Lut8" }, { "ATAN_FAST", "AtanPoly3Lut8" }, { "ATAN_FASTEST", "AtanPoly4" },
+        };
+
         public static void ConvertFile(string inPath, string outPath, Mode mode)
         {
             Console.WriteLine("Generating {0}..", outPath);
@@ -58,6 +72,7 @@ namespace Transpiler
             lines = Util.Preprocess(lines, "CPP");
             lines = Util.Unindent(lines, 1);
 
+            string instrumentCall = null;
             foreach (string line_in in lines)
             {
                 string line = line_in;
@@ -67,6 +82,10 @@ namespace Transpiler
                 if (line_trimmed.StartsWith("["))
                     continue;
 
+                // Public functions get an FP_INSTRUMENT_CALL at the start of their body
+                string pendingCall = instrumentCall;
+                instrumentCall = (mode != Mode.Util) ? MakeInstrumentCall(line_trimmed, mode) : null;
+
                 // Process the line
                 line = Util.ReplaceWholeWord(line, "public", "");
                 line = Util.ReplaceWholeWord(line, "private", "");
@@ -83,6 +102,8 @@ namespace Transpiler
                 line = Util.ReplaceWholeWord(line, "Debug.Assert", "FP_ASSERT");
                 line = line.Replace("FixedUtil.", "FixedUtil::");
                 line = line.Replace("Fixed64.", "Fixed64::");
+                if (mode != Mode.Util)
+                    line = ReplaceTierKernels(line);
                 line = Util.ReplaceWholeWord(line, "-2147483648", "INT32_MIN");
                 line = Util.ReplaceWholeWord(line, "2147483647", "INT32_MAX");
                 line = Util.ReplaceWholeWord(line, "-9223372036854775808L", "INT64_MIN");
@@ -94,15 +115,52 @@ namespace Transpiler
 
                 // Add the line
                 sb.AppendLine(line);
+                if (pendingCall != null && line_trimmed == "{")
+                    sb.AppendLine(line.Substring(0, line.IndexOf('{')) + "    " + pendingCall);
             }
 
             // Save the file
             File.WriteAllText(outPath, sb.ToString().Replace("\r", ""), Encoding.ASCII);
         }
 
+        // Returns the instrumentation call for the signature of a public function, or null. The call
+        // records the first two integer arguments; batch functions only count calls.
+        private static string MakeInstrumentCall(string line, Mode mode)
+        {
+            Match m = Regex.Match(line, @"^public static [a-z]+(\[\])? ([A-Za-z0-9_]+)\(([^)]*)\)$");
+            if (!m.Success)
+                return null;
+
+            List<string> args = new List<string>();
+            bool isBatch = false;
+            foreach (string param in m.Groups[3].Value.Split(new[] { ',' }, StringSplitOptions.RemoveEmptyEntries))
+            {
+                string[] parts = param.Trim().Split(' ');
+                if (parts[0].EndsWith("[]"))
+                    isBatch = true;
+                else if ((parts[0] == "int" || parts[0] == "long") && args.Count < 2)
+                    args.Add(parts[1]);
+            }
+            if (isBatch)
+                args.Clear();
+
+            string funcName = "Fixed" + GetModeShortDesc(mode) + "::" + m.Groups[2].Value;
+            return $"FP_INSTRUMENT_CALL{args.Count}(\"{funcName}\"{string.Concat(args.Select(a => ", " + a))});";
+        }
+
+        private static string ReplaceTierKernels(string str)
+        {
+            for (int i = 0; i < TierKernels.GetLength(0); i++)
+                str = str.Replace("FixedUtil::" + TierKernels[i, 1] + "(", "FixedUtil::FP_KERNEL_" + TierKernels[i, 0] + "(");
+            return str;
+        }
+
         private static string ConvertArrays(string str)
         {
-            return Regex.Replace(str, "static readonly FP_INT\\[\\] ([a-zA-Z0-9_]+)", "static FP_INT $1[]");
+            str = Regex.Replace(str, "static readonly (FP_INT|FP_LONG)\\[\\] ([a-zA-Z0-9_]+)", "static $1 $2[]");
+
+            // Array parameters (batch functions) are passed as pointers
+            return Regex.Replace(str, "(FP_INT|FP_LONG)\\[\\] ([a-zA-Z0-9_]+)", "$1* $2");
         }
 
         // Converts all 64bit constants into C++ form.
@@ -133,6 +191,36 @@ namespace Transpiler
                 includes += "#include \"FixedUtil.h\"\n";
             if (mode == Mode.Fp32)
                 includes += "#include \"Fixed64.h\"\n";
+            if (mode == Mode.Util)
+            {
+                includes += @"
+// If FP_INSTRUMENT is defined, every public Fixed32/Fixed64 function counts its calls, builds log2
+// histograms of its first two arguments and counts invalid arguments, see FixedInstrument.h. With
+// FP_CUSTOM_INVALID_ARGS, the custom handlers need to call FixedInstrument::RecordInvalid() themselves.
+//#define FP_INSTRUMENT
+#ifdef FP_INSTRUMENT
+#   include ""FixedInstrument.h""
+#   define FP_INSTRUMENT_CALL0(funcName) static const int fpInstrumentId = FixedInstrument::Register(funcName); FixedInstrument::Record(fpInstrumentId)
+#   define FP_INSTRUMENT_CALL1(funcName, a) static const int fpInstrumentId = FixedInstrument::Register(funcName); FixedInstrument::Record(fpInstrumentId, (int64_t)(a))
+#   define FP_INSTRUMENT_CALL2(funcName, a, b) static const int fpInstrumentId = FixedInstrument::Register(funcName); FixedInstrument::Record(fpInstrumentId, (int64_t)(a), (int64_t)(b))
+#   define FP_INSTRUMENT_INVALID(funcName) FixedInstrument::RecordInvalid(funcName)
+#else
+#   define FP_INSTRUMENT_CALL0(funcName)
+#   define FP_INSTRUMENT_CALL1(funcName, a)
+#   define FP_INSTRUMENT_CALL2(funcName, a, b)
+#   define FP_INSTRUMENT_INVALID(funcName)
+#endif
+
+// Approximation kernels used by the precision tiers (e.g. FP_KERNEL_RCP_FAST in RcpFast() and DivFast()).
+// CppTuner benchmarks the alternatives on the host CPU and writes a header that redefines them; include
+// it before FixedUtil.h, or name it in FP_KERNEL_CONFIG (e.g. -DFP_KERNEL_CONFIG='""FixedKernels.h""').
+#ifdef FP_KERNEL_CONFIG
+#   include FP_KERNEL_CONFIG
+#endif
+";
+                for (int i = 0; i < TierKernels.GetLength(0); i++)
+                    includes += $"#ifndef FP_KERNEL_{TierKernels[i, 0]}\n#   define FP_KERNEL_{TierKernels[i, 0]} {TierKernels[i, 1]}\n#endif\n";
+            }
 
             // Main header
             string header = $@"//
@@ -185,10 +273,10 @@ namespace Fixed{desc}
     extern void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue);
     extern void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue1, FP_LONG argValue2);
 #else
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue) {{ }}
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue1, FP_INT argValue2) {{ }}
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue) {{ }}
-    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue1, FP_LONG argValue2) {{ }}
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue) {{ FP_INSTRUMENT_INVALID(funcName); }}
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_INT argValue1, FP_INT argValue2) {{ FP_INSTRUMENT_INVALID(funcName); }}
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue) {{ FP_INSTRUMENT_INVALID(funcName); }}
+    static inline void InvalidArgument(const char* funcName, const char* argName, FP_LONG argValue1, FP_LONG argValue2) {{ FP_INSTRUMENT_INVALID(funcName); }}
 #endif
 ";
             }